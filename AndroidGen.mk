@@ -4,6 +4,7 @@
 LOCAL_SRC_FILES := \
 	execserver/xsDefs.cpp \
 	execserver/xsExecutionServer.cpp \
+	execserver/xsPosixEvent.cpp \
 	execserver/xsPosixFileReader.cpp \
 	execserver/xsPosixTestProcess.cpp \
 	execserver/xsProtocol.cpp \
@@ -21,6 +22,7 @@ LOCAL_SRC_FILES := \
 	executor/xeTestCase.cpp \
 	executor/xeTestCaseListParser.cpp \
 	executor/xeTestCaseResult.cpp \
+	executor/xeTestLogIndex.cpp \
 	executor/xeTestLogParser.cpp \
 	executor/xeTestLogWriter.cpp \
 	executor/xeTestResultParser.cpp \
@@ -41,6 +43,7 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/framework/vulkan/vkNullDriver.cpp \
 	external/vulkancts/framework/vulkan/vkPlatform.cpp \
 	external/vulkancts/framework/vulkan/vkPrograms.cpp \
+	external/vulkancts/framework/vulkan/vkProgramCompileService.cpp \
 	external/vulkancts/framework/vulkan/vkQueryUtil.cpp \
 	external/vulkancts/framework/vulkan/vkRef.cpp \
 	external/vulkancts/framework/vulkan/vkRefUtil.cpp \
@@ -252,6 +255,7 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/modules/vulkan/vktTestCaseUtil.cpp \
 	external/vulkancts/modules/vulkan/vktTestGroupUtil.cpp \
 	external/vulkancts/modules/vulkan/vktTestPackage.cpp \
+	external/vulkancts/modules/vulkan/vktTransferService.cpp \
 	external/vulkancts/modules/vulkan/vktTestPackageEntry.cpp \
 	external/vulkancts/modules/vulkan/wsi/vktWsiDisplayTimingTests.cpp \
 	external/vulkancts/modules/vulkan/wsi/vktWsiIncrementalPresentTests.cpp \
@@ -274,6 +278,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuFuzzyImageCompare.cpp \
 	framework/common/tcuImageCompare.cpp \
 	framework/common/tcuImageIO.cpp \
+	framework/common/tcuInstrumentation.cpp \
 	framework/common/tcuInterval.cpp \
 	framework/common/tcuMatrix.cpp \
 	framework/common/tcuMaybe.cpp \
@@ -283,6 +288,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuRasterizationVerifier.cpp \
 	framework/common/tcuRenderTarget.cpp \
 	framework/common/tcuResource.cpp \
+	framework/common/tcuResourceCache.cpp \
 	framework/common/tcuResultCollector.cpp \
 	framework/common/tcuSeedBuilder.cpp \
 	framework/common/tcuStringTemplate.cpp \
@@ -290,6 +296,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuSurfaceAccess.cpp \
 	framework/common/tcuTestCase.cpp \
 	framework/common/tcuTestContext.cpp \
+	framework/common/tcuTestHierarchyIndex.cpp \
 	framework/common/tcuTestHierarchyIterator.cpp \
 	framework/common/tcuTestHierarchyUtil.cpp \
 	framework/common/tcuTestLog.cpp \
@@ -324,6 +331,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/decpp/deMemPool.cpp \
 	framework/delibs/decpp/deMeta.cpp \
 	framework/delibs/decpp/deMutex.cpp \
+	framework/delibs/decpp/deParallel.cpp \
 	framework/delibs/decpp/dePoolArray.cpp \
 	framework/delibs/decpp/dePoolString.cpp \
 	framework/delibs/decpp/deProcess.cpp \
@@ -342,6 +350,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/decpp/deUniquePtr.cpp \
 	framework/delibs/deimage/deImage.c \
 	framework/delibs/deimage/deTarga.c \
+	framework/delibs/depool/deConcurrentMemPool.c \
 	framework/delibs/depool/deMemPool.c \
 	framework/delibs/depool/dePoolArray.c \
 	framework/delibs/depool/dePoolHash.c \
@@ -396,6 +405,7 @@ LOCAL_SRC_FILES := \
 	framework/egl/wrapper/eglwLibrary.cpp \
 	framework/egl/wrapper/eglwWrapper.cpp \
 	framework/opengl/gluCallLogWrapper.cpp \
+	framework/opengl/gluCallTrace.cpp \
 	framework/opengl/gluContextFactory.cpp \
 	framework/opengl/gluContextInfo.cpp \
 	framework/opengl/gluDefs.cpp \
@@ -406,6 +416,7 @@ LOCAL_SRC_FILES := \
 	framework/opengl/gluObjectWrapper.cpp \
 	framework/opengl/gluPixelTransfer.cpp \
 	framework/opengl/gluPlatform.cpp \
+	framework/opengl/gluProgramBinaryCache.cpp \
 	framework/opengl/gluProgramInterfaceQuery.cpp \
 	framework/opengl/gluRenderConfig.cpp \
 	framework/opengl/gluRenderContext.cpp \
@@ -922,16 +933,19 @@ LOCAL_SRC_FILES := \
 	modules/internal/ditAstcTests.cpp \
 	modules/internal/ditBuildInfoTests.cpp \
 	modules/internal/ditDelibsTests.cpp \
+	modules/internal/ditEtcTests.cpp \
 	modules/internal/ditFrameworkTests.cpp \
 	modules/internal/ditImageCompareTests.cpp \
 	modules/internal/ditImageIOTests.cpp \
 	modules/internal/ditSRGB8ConversionTest.cpp \
 	modules/internal/ditSeedBuilderTests.cpp \
+	modules/internal/ditShaderLibraryTests.cpp \
 	modules/internal/ditTestCase.cpp \
 	modules/internal/ditTestLogTests.cpp \
 	modules/internal/ditTestPackage.cpp \
 	modules/internal/ditTestPackageEntry.cpp \
 	modules/internal/ditTextureFormatTests.cpp \
+	modules/internal/ditTextureSamplerTests.cpp \
 	modules/internal/ditVulkanTests.cpp
 
 LOCAL_C_INCLUDES := \
@@ -36,16 +36,32 @@
 namespace opt
 {
 
-DE_DECLARE_COMMAND_LINE_OPT(Port,		int);
-DE_DECLARE_COMMAND_LINE_OPT(SingleExec,	bool);
+DE_DECLARE_COMMAND_LINE_OPT(Port,			int);
+DE_DECLARE_COMMAND_LINE_OPT(SingleExec,		bool);
+
+#if (DE_OS != DE_OS_WIN32)
+DE_DECLARE_COMMAND_LINE_OPT(LogTransport,	xs::PosixTestProcess::LogTransport);
+DE_DECLARE_COMMAND_LINE_OPT(LogTee,			bool);
+#endif
 
 void registerOptions (de::cmdline::Parser& parser)
 {
 	using de::cmdline::Option;
 	using de::cmdline::NamedValue;
 
-	parser << Option<Port>		("p", "port",	"Port", "50016")
-		   << Option<SingleExec>("s", "single",	"Kill execserver after first session");
+	parser << Option<Port>			("p", "port",			"Port", "50016")
+		   << Option<SingleExec>	("s", "single",			"Kill execserver after first session");
+
+#if (DE_OS != DE_OS_WIN32)
+	static const NamedValue<xs::PosixTestProcess::LogTransport> s_logTransports[] =
+	{
+		{ "file",	xs::PosixTestProcess::LOGTRANSPORT_FILE	},
+		{ "pipe",	xs::PosixTestProcess::LOGTRANSPORT_PIPE	}
+	};
+
+	parser << Option<LogTransport>	(DE_NULL, "log-transport",	"Read test log from file or stream it through pipe", s_logTransports, "file")
+		   << Option<LogTee>		(DE_NULL, "log-tee",		"Also write streamed test log into working directory");
+#endif
 }
 
 }
@@ -54,15 +70,6 @@ int main (int argc, const char* const* argv)
 {
 	de::cmdline::CommandLine	cmdLine;
 
-#if (DE_OS == DE_OS_WIN32)
-	xs::Win32TestProcess		testProcess;
-#else
-	xs::PosixTestProcess		testProcess;
-
-	// Set line buffered mode to stdout so executor gets any log messages in a timely manner.
-	setvbuf(stdout, DE_NULL, _IOLBF, 4*1024);
-#endif
-
 	// Parse command line.
 	{
 		de::cmdline::Parser	parser;
@@ -75,6 +82,15 @@ int main (int argc, const char* const* argv)
 		}
 	}
 
+#if (DE_OS == DE_OS_WIN32)
+	xs::Win32TestProcess		testProcess;
+#else
+	xs::PosixTestProcess		testProcess	(cmdLine.getOption<opt::LogTransport>(), cmdLine.getOption<opt::LogTee>());
+
+	// Set line buffered mode to stdout so executor gets any log messages in a timely manner.
+	setvbuf(stdout, DE_NULL, _IOLBF, 4*1024);
+#endif
+
 	try
 	{
 		const xs::ExecutionServer::RunMode	runMode		= cmdLine.getOption<opt::SingleExec>()
@@ -132,6 +132,7 @@ Message* readMessage (de::Socket& socket)
 		case MESSAGETYPE_HELLO:					return new HelloMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_TEST:					return new TestMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_LOG_DATA:		return new ProcessLogDataMessage(&messageBuf[0], (int)messageBuf.size());
+		case MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED:	return new CompressedProcessLogDataMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_INFO:					return new InfoMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_LAUNCH_FAILED:	return new ProcessLaunchFailedMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_FINISHED:		return new ProcessFinishedMessage(&messageBuf[0], (int)messageBuf.size());
@@ -527,6 +528,17 @@ public:
 	void runProgram (void) { printf("%s", infoStr.c_str()); }
 };
 
+//! Open test log output, log may be streamed into inherited file descriptor ("fd:<N>").
+deFile* createLogFile (const char* logFileName)
+{
+#if (DE_OS != DE_OS_WIN32)
+	if (deStringBeginsWith(logFileName, "fd:"))
+		return deFile_createFromHandle((deUintptr)atoi(logFileName+3));
+#endif
+
+	return deFile_create(logFileName, DE_FILEMODE_OPEN|DE_FILEMODE_CREATE|DE_FILEMODE_TRUNCATE|DE_FILEMODE_WRITE);
+}
+
 class LogDataTest : public TestCase
 {
 public:
@@ -594,7 +606,7 @@ public:
 
 	void runProgram (void)
 	{
-		deFile* file = deFile_create(m_testCtx.logFileName.c_str(), DE_FILEMODE_OPEN|DE_FILEMODE_CREATE|DE_FILEMODE_TRUNCATE|DE_FILEMODE_WRITE);
+		deFile* file = createLogFile(m_testCtx.logFileName.c_str());
 		XS_CHECK(file);
 
 		const char line0[] = "Foo\n";
@@ -692,7 +704,7 @@ public:
 
 	void runProgram (void)
 	{
-		deFile* file = deFile_create(m_testCtx.logFileName.c_str(), DE_FILEMODE_OPEN|DE_FILEMODE_CREATE|DE_FILEMODE_TRUNCATE|DE_FILEMODE_WRITE);
+		deFile* file = createLogFile(m_testCtx.logFileName.c_str());
 		XS_CHECK(file);
 
 		deUint8 tmpBuf[1024*16];
@@ -711,6 +723,136 @@ public:
 	}
 };
 
+class CompressedLogDataTest : public TestCase
+{
+public:
+	enum
+	{
+		NUM_LINES = 512*1024
+	};
+
+	CompressedLogDataTest (TestContext& testCtx)
+		: TestCase(testCtx, "compressedlogdata")
+	{
+	}
+
+	static string getLine (int lineNdx)
+	{
+		return string("<Text>Line ") + de::toString(lineNdx) + "</Text>\n";
+	}
+
+	void runClient (de::Socket& socket)
+	{
+		{
+			HelloMessage hello;
+			hello.features = PROTOCOLFEATURE_COMPRESSED_LOG_DATA;
+			sendMessage(socket, hello);
+
+			ScopedMsgPtr reply(readMessage(socket));
+
+			if (reply->type != MESSAGETYPE_HELLO)
+				XS_FAIL("Expected HELLO reply");
+
+			if (static_cast<const HelloMessage*>(reply.get())->features != PROTOCOLFEATURE_COMPRESSED_LOG_DATA)
+				XS_FAIL("Server didn't enable log data compression");
+		}
+
+		xs::ExecuteBinaryMessage execMsg;
+		execMsg.name		= m_testCtx.testerPath;
+		execMsg.params		= "--program=compressedlogdata";
+		execMsg.caseList	= "";
+		execMsg.workDir		= "";
+
+		sendMessage(socket, execMsg);
+
+		const int		timeout				= 30000; // 30s.
+		TestClock		clock;
+
+		bool			gotProcessStarted	= false;
+		bool			gotProcessFinished	= false;
+		string			receivedData;
+		size_t			compressedBytes		= 0;
+		vector<deUint8>	decompressed;
+
+		for (;;)
+		{
+			if (clock.getMilliseconds() > timeout)
+				break;
+
+			ScopedMsgPtr msg(readMessage(socket));
+
+			if (msg->type == MESSAGETYPE_PROCESS_STARTED)
+				gotProcessStarted = true;
+			else if (msg->type == MESSAGETYPE_PROCESS_LAUNCH_FAILED)
+				XS_FAIL("Got PROCESS_LAUNCH_FAILED");
+			else if (gotProcessStarted && msg->type == MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED)
+			{
+				const CompressedProcessLogDataMessage*	logMsg	= static_cast<const CompressedProcessLogDataMessage*>(msg.get());
+				vector<deUint8>							payload;
+
+				logMsg->write(payload);
+				CompressedProcessLogDataMessage::decompress(&payload[MESSAGE_HEADER_SIZE], payload.size()-MESSAGE_HEADER_SIZE, decompressed);
+
+				receivedData.append(decompressed.begin(), decompressed.end());
+				compressedBytes += payload.size();
+			}
+			else if (gotProcessStarted && msg->type == MESSAGETYPE_PROCESS_FINISHED)
+			{
+				gotProcessFinished = true;
+				break;
+			}
+			else if (msg->type == MESSAGETYPE_KEEPALIVE)
+			{
+				// Reply with keepalive.
+				sendMessage(socket, KeepAliveMessage());
+				continue;
+			}
+			else if (msg->type == MESSAGETYPE_INFO)
+				printf("%s", static_cast<const InfoMessage*>(msg.get())->info.c_str());
+			else
+				XS_FAIL("Invalid message");
+		}
+
+		if (!gotProcessStarted)
+			XS_FAIL("Did't get PROCESS_STARTED message");
+
+		if (!gotProcessFinished)
+			XS_FAIL("Did't get PROCESS_FINISHED message");
+
+		{
+			string expected;
+
+			for (int lineNdx = 0; lineNdx < NUM_LINES; lineNdx++)
+				expected += getLine(lineNdx);
+
+			if (receivedData != expected)
+			{
+				printf("  received: %d bytes\n  expected: %d bytes\n", (int)receivedData.size(), (int)expected.size());
+				XS_FAIL("Log data doesn't match");
+			}
+		}
+
+		printf("  Received %d bytes as %d compressed bytes in %d ms\n", (int)receivedData.size(), (int)compressedBytes, clock.getMilliseconds());
+	}
+
+	void runProgram (void)
+	{
+		deFile* file = createLogFile(m_testCtx.logFileName.c_str());
+		XS_CHECK(file);
+
+		for (int lineNdx = 0; lineNdx < NUM_LINES; lineNdx++)
+		{
+			const string	line		= getLine(lineNdx);
+			deInt64			numWritten	= 0;
+
+			XS_CHECK(deFile_write(file, line.c_str(), (deInt64)line.size(), &numWritten) == DE_FILERESULT_SUCCESS);
+			XS_CHECK(numWritten == (deInt64)line.size());
+		}
+
+		deFile_destroy(file);
+	}
+};
+
 class KeepAliveTest : public TestCase
 {
 public:
@@ -898,6 +1040,7 @@ void runExecServerTests (int argc, const char* const* argv)
 	testCases.push_back(new LogDataTest(testCtx));
 	testCases.push_back(new KeepAliveTest(testCtx));
 	testCases.push_back(new BigLogDataTest(testCtx));
+	testCases.push_back(new CompressedLogDataTest(testCtx));
 
 	try
 	{
@@ -42,6 +42,7 @@ enum
 	SERVER_IDLE_THRESHOLD		= 10,
 	SERVER_IDLE_SLEEP			= 50,
 	FILEREADER_IDLE_SLEEP		= 100,
+	PROCESS_POLL_INTERVAL		= 20,	//!< Max wait time before checking process state when using event-driven IO.
 
 	LOG_BUFFER_BLOCK_SIZE		= 1024,
 	LOG_BUFFER_NUM_BLOCKS		= 512,
@@ -49,10 +50,11 @@ enum
 	INFO_BUFFER_BLOCK_SIZE		= 64,
 	INFO_BUFFER_NUM_BLOCKS		= 128,
 
-	SEND_BUFFER_SIZE			= 16*1024,
+	SEND_BUFFER_SIZE			= 64*1024,
 	RECV_BUFFER_SIZE			= 4*1024,
 
 	FILEREADER_TMP_BUFFER_SIZE	= 1024,
+	COMPRESSED_LOG_FRAME_SIZE	= 32*1024,	//!< Max uncompressed size of batched log data frame.
 	SEND_RECV_TMP_BUFFER_SIZE	= 4*1024,
 
 	MIN_MSG_PAYLOAD_SIZE		= 32
@@ -22,10 +22,16 @@
  *//*--------------------------------------------------------------------*/
 
 #include "xsExecutionServer.hpp"
+#include "xsPosixEvent.hpp"
 #include "deClock.h"
 
 #include <cstdio>
 
+#if defined(XS_USE_POSIX_EVENTS)
+#	include <poll.h>
+#	include <errno.h>
+#endif
+
 using std::vector;
 using std::string;
 
@@ -145,6 +151,7 @@ ExecutionRequestHandler::ExecutionRequestHandler (ExecutionServer* server, de::S
 	, m_bufferIn		(RECV_BUFFER_SIZE)
 	, m_bufferOut		(SEND_BUFFER_SIZE)
 	, m_run				(false)
+	, m_protocolFeatures	(0)
 	, m_sendRecvTmpBuf	(SEND_RECV_TMP_BUFFER_SIZE)
 {
 	// Set flags.
@@ -203,6 +210,7 @@ void ExecutionRequestHandler::acquireTestDriver (void)
 	m_testDriver = m_execServer->acquireTestDriver();
 	DE_ASSERT(m_testDriver);
 	m_testDriver->reset();
+	m_testDriver->setProtocolFeatures(m_protocolFeatures);
 
 }
 
@@ -210,7 +218,9 @@ void ExecutionRequestHandler::processSession (void)
 {
 	m_run = true;
 
+#if !defined(XS_USE_POSIX_EVENTS)
 	deUint64 lastIoTime = deGetMicroseconds();
+#endif
 
 	while (m_run)
 	{
@@ -227,6 +237,7 @@ void ExecutionRequestHandler::processSession (void)
 		{
 			DE_ASSERT(!m_msgBuilder.isComplete());
 			m_msgBuilder.read(m_bufferIn);
+			anyIO = true;
 		}
 
 		if (m_msgBuilder.isComplete())
@@ -235,6 +246,7 @@ void ExecutionRequestHandler::processSession (void)
 			processMessage(m_msgBuilder.getMessageType(), m_msgBuilder.getMessageData(), m_msgBuilder.getMessageDataSize());
 
 			m_msgBuilder.clear();
+			anyIO = true;
 		}
 
 		// Keepalives, anyone?
@@ -244,6 +256,11 @@ void ExecutionRequestHandler::processSession (void)
 		if (m_testDriver)
 			anyIO = getTestDriver()->poll(m_bufferOut) || anyIO;
 
+#if defined(XS_USE_POSIX_EVENTS)
+		// Block until socket or test process has something for us.
+		if (m_run && !anyIO)
+			waitForIO();
+#else
 		// If no IO happens in a reasonable amount of time, go to sleep.
 		{
 			deUint64 curTime = deGetMicroseconds();
@@ -254,9 +271,53 @@ void ExecutionRequestHandler::processSession (void)
 			else
 				deYield(); // Just give other threads chance to run.
 		}
+#endif
+	}
+}
+
+#if defined(XS_USE_POSIX_EVENTS)
+
+static int getTimeUntil (deUint64 curTime, deUint64 deadline)
+{
+	return curTime >= deadline ? 0 : (int)((deadline - curTime + 999) / 1000);
+}
+
+void ExecutionRequestHandler::waitForIO (void)
+{
+	const deUint64	curTime		= deGetMicroseconds();
+	struct pollfd	fds[2];
+	int				numFds		= 0;
+	int				timeout		= de::min(getTimeUntil(curTime, m_lastKeepAliveSent + KEEPALIVE_SEND_INTERVAL*1000 + 1),
+										  getTimeUntil(curTime, m_lastKeepAliveReceived + KEEPALIVE_TIMEOUT*1000 + 1));
+
+	fds[numFds].fd		= (int)m_socket->getHandle();
+	fds[numFds].events	= (short)((m_bufferIn.getNumFree() > 0 ? POLLIN : 0) | (m_bufferOut.getNumElements() > 0 ? POLLOUT : 0));
+	fds[numFds].revents	= 0;
+	numFds++;
+
+	if (m_testDriver)
+	{
+		const int eventFd = m_testDriver->getEventFd();
+
+		if (eventFd >= 0)
+		{
+			fds[numFds].fd		= eventFd;
+			fds[numFds].events	= POLLIN;
+			fds[numFds].revents	= 0;
+			numFds++;
+		}
+
+		// Process exit and read timeouts are not signaled, check them periodically.
+		if (eventFd < 0 || m_testDriver->isProcessActive())
+			timeout = de::min<int>(timeout, PROCESS_POLL_INTERVAL);
 	}
+
+	if (::poll(fds, (nfds_t)numFds, timeout) < 0 && errno != EINTR)
+		throw ConnectionError("poll() failed");
 }
 
+#endif // XS_USE_POSIX_EVENTS
+
 void ExecutionRequestHandler::processMessage (MessageType type, const deUint8* data, size_t dataSize)
 {
 	switch (type)
@@ -267,6 +328,25 @@ void ExecutionRequestHandler::processMessage (MessageType type, const deUint8* d
 			DBG_PRINT(("HelloMessage: version = %d\n", msg.version));
 			if (msg.version != PROTOCOL_VERSION)
 				throw ProtocolError("Unsupported protocol version");
+
+			if (msg.features != 0)
+			{
+				// Client requested extensions, reply with supported subset.
+				HelloMessage	reply;
+				vector<deUint8>	buf;
+
+				m_protocolFeatures	= msg.features & PROTOCOLFEATURE_ALL;
+				reply.features		= m_protocolFeatures;
+				reply.write(buf);
+
+				if (m_bufferOut.getNumFree() < (int)buf.size())
+					throw ProtocolError("Send buffer full");
+
+				m_bufferOut.pushFront(&buf[0], (int)buf.size());
+
+				if (m_testDriver)
+					m_testDriver->setProtocolFeatures(m_protocolFeatures);
+			}
 			break;
 		}
 
@@ -107,6 +107,7 @@ private:
 
 	bool						receive							(void);
 	bool						send							(void);
+	void						waitForIO						(void);
 
 	ExecutionServer*			m_execServer;
 	TestDriver*					m_testDriver;
@@ -116,6 +117,7 @@ private:
 
 	bool						m_run;
 	MessageBuilder				m_msgBuilder;
+	deUint32					m_protocolFeatures;		//!< Features negotiated with HelloMessage.
 
 	// \todo [2011-09-30 pyry] Move to some watchdog class instead.
 	deUint64					m_lastKeepAliveSent;
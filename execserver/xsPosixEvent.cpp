@@ -0,0 +1,241 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Execution Server
+ * ---------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Event primitives for poll()-based IO.
+ *//*--------------------------------------------------------------------*/
+
+#include "xsPosixEvent.hpp"
+#include "deClock.h"
+
+#if defined(XS_USE_POSIX_EVENTS)
+#	include <unistd.h>
+#	include <fcntl.h>
+#	include <poll.h>
+#	include <errno.h>
+#endif
+
+#if defined(XS_USE_INOTIFY)
+#	include <sys/inotify.h>
+#endif
+
+namespace xs
+{
+namespace posix
+{
+
+#if defined(XS_USE_POSIX_EVENTS)
+
+static void setNonBlockingCloseOnExec (int fd)
+{
+	const int flags = fcntl(fd, F_GETFL);
+
+	if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0 || fcntl(fd, F_SETFD, FD_CLOEXEC) != 0)
+		XS_FAIL("Failed to set pipe flags");
+}
+
+WakeupPipe::WakeupPipe (void)
+{
+	if (pipe(m_fds) != 0)
+		XS_FAIL("Failed to create wakeup pipe");
+
+	try
+	{
+		setNonBlockingCloseOnExec(m_fds[0]);
+		setNonBlockingCloseOnExec(m_fds[1]);
+	}
+	catch (...)
+	{
+		close(m_fds[0]);
+		close(m_fds[1]);
+		throw;
+	}
+}
+
+WakeupPipe::~WakeupPipe (void)
+{
+	close(m_fds[0]);
+	close(m_fds[1]);
+}
+
+void WakeupPipe::signal (void)
+{
+	const deUint8	value	= 1;
+	ssize_t			result;
+
+	// \note Full pipe (EAGAIN) means that wakeup is already pending.
+	do
+	{
+		result = write(m_fds[1], &value, 1);
+	} while (result < 0 && errno == EINTR);
+}
+
+void WakeupPipe::drain (void)
+{
+	deUint8	buf[64];
+	ssize_t	result;
+
+	do
+	{
+		result = read(m_fds[0], &buf[0], sizeof(buf));
+	} while (result > 0 || (result < 0 && errno == EINTR));
+}
+
+bool waitForFd (int fd, deUint32 events, int cancelFd, int timeoutMs)
+{
+	struct pollfd	fds[2];
+	int				numFds		= 0;
+	int				fdNdx		= -1;
+	const deUint64	startTime	= deGetMicroseconds();
+
+	if (fd >= 0)
+	{
+		fds[numFds].fd		= fd;
+		fds[numFds].events	= (short)(((events & WAITEVENT_READ) ? POLLIN : 0) | ((events & WAITEVENT_WRITE) ? POLLOUT : 0));
+		fds[numFds].revents	= 0;
+		fdNdx = numFds++;
+	}
+
+	if (cancelFd >= 0)
+	{
+		fds[numFds].fd		= cancelFd;
+		fds[numFds].events	= POLLIN;
+		fds[numFds].revents	= 0;
+		numFds++;
+	}
+
+	for (;;)
+	{
+		int timeLeft = timeoutMs;
+
+		if (timeoutMs != WAIT_INFINITE)
+			timeLeft = de::max(0, timeoutMs - (int)((deGetMicroseconds() - startTime) / 1000));
+
+		if (::poll(fds, (nfds_t)numFds, timeLeft) >= 0)
+			break;
+		else if (errno != EINTR)
+			XS_FAIL("poll() failed");
+	}
+
+	return fdNdx >= 0 && fds[fdNdx].revents != 0;
+}
+
+#else // !XS_USE_POSIX_EVENTS
+
+WakeupPipe::WakeupPipe (void)
+{
+	m_fds[0] = -1;
+	m_fds[1] = -1;
+}
+
+WakeupPipe::~WakeupPipe (void)
+{
+}
+
+void WakeupPipe::signal (void)
+{
+}
+
+void WakeupPipe::drain (void)
+{
+}
+
+bool waitForFd (int fd, deUint32 events, int cancelFd, int timeoutMs)
+{
+	DE_UNREF(fd);
+	DE_UNREF(events);
+	DE_UNREF(cancelFd);
+	DE_UNREF(timeoutMs);
+	XS_FAIL("waitForFd() is not supported");
+	return false;
+}
+
+#endif // XS_USE_POSIX_EVENTS
+
+FileWatch::FileWatch (void)
+	: m_fd(-1)
+{
+}
+
+FileWatch::~FileWatch (void)
+{
+	stop();
+}
+
+bool FileWatch::start (const char* filename)
+{
+	DE_ASSERT(m_fd < 0);
+
+#if defined(XS_USE_INOTIFY)
+	m_fd = inotify_init();
+
+	if (m_fd < 0)
+		return false;
+
+	try
+	{
+		setNonBlockingCloseOnExec(m_fd);
+	}
+	catch (const std::exception&)
+	{
+		stop();
+		return false;
+	}
+
+	if (inotify_add_watch(m_fd, filename, IN_MODIFY|IN_CLOSE_WRITE|IN_DELETE_SELF|IN_MOVE_SELF) < 0)
+	{
+		stop();
+		return false;
+	}
+
+	return true;
+#else
+	DE_UNREF(filename);
+	return false;
+#endif
+}
+
+void FileWatch::stop (void)
+{
+#if defined(XS_USE_POSIX_EVENTS)
+	if (m_fd >= 0)
+	{
+		close(m_fd);
+		m_fd = -1;
+	}
+#endif
+}
+
+void FileWatch::drain (void)
+{
+#if defined(XS_USE_INOTIFY)
+	deUint8	buf[1024];
+	ssize_t	result;
+
+	DE_ASSERT(m_fd >= 0);
+
+	do
+	{
+		result = read(m_fd, &buf[0], sizeof(buf));
+	} while (result > 0 || (result < 0 && errno == EINTR));
+#endif
+}
+
+} // posix
+} // xs
@@ -0,0 +1,116 @@
+#ifndef _XSPOSIXEVENT_HPP
+#define _XSPOSIXEVENT_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Execution Server
+ * ---------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Event primitives for poll()-based IO.
+ *//*--------------------------------------------------------------------*/
+
+#include "xsDefs.hpp"
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+#	define XS_USE_POSIX_EVENTS 1
+#endif
+
+#if defined(XS_USE_POSIX_EVENTS) && ((DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)) && defined(__linux__)
+#	define XS_USE_INOTIFY 1
+#endif
+
+namespace xs
+{
+namespace posix
+{
+
+enum
+{
+	WAIT_INFINITE	= -1
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Self-pipe for waking up thread blocked in poll()
+ *
+ * signal() can be called from any thread. Read end becomes readable
+ * until drain() is called. On platforms without poll() support the
+ * object is inert and getFd() returns -1.
+ *//*--------------------------------------------------------------------*/
+class WakeupPipe
+{
+public:
+						WakeupPipe		(void);
+						~WakeupPipe		(void);
+
+	void				signal			(void);
+	void				drain			(void);
+
+	int					getFd			(void) const { return m_fds[0]; }
+
+private:
+						WakeupPipe		(const WakeupPipe& other);
+	WakeupPipe&			operator=		(const WakeupPipe& other);
+
+	int					m_fds[2];
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief File modification watch
+ *
+ * Uses inotify where available. If start() returns false, caller must
+ * fall back to polling the file periodically.
+ *//*--------------------------------------------------------------------*/
+class FileWatch
+{
+public:
+						FileWatch		(void);
+						~FileWatch		(void);
+
+	bool				start			(const char* filename);
+	void				stop			(void);
+	void				drain			(void);
+
+	bool				isActive		(void) const { return m_fd >= 0; }
+	int					getFd			(void) const { return m_fd; }
+
+private:
+						FileWatch		(const FileWatch& other);
+	FileWatch&			operator=		(const FileWatch& other);
+
+	int					m_fd;
+};
+
+enum WaitEvent
+{
+	WAITEVENT_READ		= (1<<0),
+	WAITEVENT_WRITE		= (1<<1)
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Wait until fd becomes ready or cancelFd becomes readable
+ * \param fd		File descriptor to wait for, ignored if negative
+ * \param events	Combination of WaitEvent flags for fd
+ * \param cancelFd	File descriptor that cancels wait, ignored if negative
+ * \param timeoutMs	Timeout in milliseconds or WAIT_INFINITE
+ * \return True if fd is ready (or closed), false on cancel or timeout
+ *//*--------------------------------------------------------------------*/
+bool					waitForFd		(int fd, deUint32 events, int cancelFd, int timeoutMs);
+
+} // posix
+} // xs
+
+#endif // _XSPOSIXEVENT_HPP
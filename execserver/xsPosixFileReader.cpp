@@ -30,10 +30,11 @@ namespace xs
 namespace posix
 {
 
-FileReader::FileReader (int blockSize, int numBlocks)
+FileReader::FileReader (int blockSize, int numBlocks, WakeupPipe* dataEvent)
 	: m_file		(DE_NULL)
 	, m_buf			(blockSize, numBlocks)
 	, m_isRunning	(false)
+	, m_dataEvent	(dataEvent)
 {
 }
 
@@ -58,6 +59,11 @@ void FileReader::start (const char* filename)
 	}
 #endif
 
+	// Watch must be set up before first read so that no modification is missed.
+	// If watching is not supported, reader falls back to polling.
+	m_fileWatch.start(filename);
+	m_cancelEvent.drain();
+
 	m_isRunning	= true;
 
 	de::Thread::start();
@@ -85,12 +91,21 @@ void FileReader::run (void)
 				// Canceled.
 				break;
 			}
+
+			if (m_dataEvent)
+				m_dataEvent->signal();
 		}
 		else if (result == DE_FILERESULT_END_OF_FILE ||
 				 result == DE_FILERESULT_WOULD_BLOCK)
 		{
 			// Wait for more data.
-			deSleep(FILEREADER_IDLE_SLEEP);
+			if (m_fileWatch.isActive())
+			{
+				waitForFd(m_fileWatch.getFd(), WAITEVENT_READ, m_cancelEvent.getFd(), WAIT_INFINITE);
+				m_fileWatch.drain();
+			}
+			else
+				deSleep(FILEREADER_IDLE_SLEEP);
 		}
 		else
 			break; // Error.
@@ -103,10 +118,13 @@ void FileReader::stop (void)
 		return; // Nothing to do.
 
 	m_buf.cancel();
+	m_cancelEvent.signal();
 
 	// Join thread.
 	join();
 
+	m_fileWatch.stop();
+
 	// Destroy file.
 	deFile_destroy(m_file);
 	m_file = DE_NULL;
@@ -24,6 +24,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "xsDefs.hpp"
+#include "xsPosixEvent.hpp"
 #include "deFile.h"
 #include "deThread.hpp"
 
@@ -35,7 +36,7 @@ namespace posix
 class FileReader : public de::Thread
 {
 public:
-							FileReader			(int blockSize, int numBlocks);
+							FileReader			(int blockSize, int numBlocks, WakeupPipe* dataEvent = DE_NULL);
 							~FileReader			(void);
 
 	void					start				(const char* filename);
@@ -50,6 +51,10 @@ private:
 	deFile*					m_file;
 	ThreadedByteBuffer		m_buf;
 	bool					m_isRunning;
+
+	WakeupPipe*				m_dataEvent;		//!< Signaled when new data is available (may be null).
+	WakeupPipe				m_cancelEvent;
+	FileWatch				m_fileWatch;
 };
 
 } // posix
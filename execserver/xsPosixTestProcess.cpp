@@ -23,11 +23,17 @@
 
 #include "xsPosixTestProcess.hpp"
 #include "deFilePath.hpp"
+#include "deStringUtil.hpp"
 #include "deClock.h"
 
 #include <string.h>
 #include <stdio.h>
 
+#if defined(XS_USE_POSIX_EVENTS)
+#	include <unistd.h>
+#	include <fcntl.h>
+#endif
+
 using std::string;
 using std::vector;
 
@@ -61,6 +67,8 @@ void CaseListWriter::start (const char* caseList, deFile* dst)
 	if (!deFile_setFlags(m_file, DE_FILE_NONBLOCKING))
 		XS_FAIL("Failed to set non-blocking mode");
 
+	m_cancelEvent.drain();
+
 	de::Thread::start();
 }
 
@@ -76,7 +84,14 @@ void CaseListWriter::run (void)
 		if (result == DE_FILERESULT_SUCCESS)
 			pos += numWritten;
 		else if (result == DE_FILERESULT_WOULD_BLOCK)
+		{
+#if defined(XS_USE_POSIX_EVENTS)
+			// Wait until pipe has space or stop() is called.
+			waitForFd((int)deFile_getHandle(m_file), WAITEVENT_WRITE, m_cancelEvent.getFd(), WAIT_INFINITE);
+#else
 			deSleep(1); // Yield.
+#endif
+		}
 		else
 			break; // Error.
 	}
@@ -88,6 +103,7 @@ void CaseListWriter::stop (void)
 		return; // Nothing to do.
 
 	m_run = false;
+	m_cancelEvent.signal();
 
 	// Join thread.
 	join();
@@ -95,9 +111,10 @@ void CaseListWriter::stop (void)
 	m_file = DE_NULL;
 }
 
-PipeReader::PipeReader (ThreadedByteBuffer* dst)
-	: m_file	(DE_NULL)
-	, m_buf		(dst)
+PipeReader::PipeReader (ThreadedByteBuffer* dst, WakeupPipe* dataEvent)
+	: m_file		(DE_NULL)
+	, m_buf			(dst)
+	, m_dataEvent	(dataEvent)
 {
 }
 
@@ -115,6 +132,8 @@ void PipeReader::start (deFile* file)
 
 	m_file = file;
 
+	m_cancelEvent.drain();
+
 	de::Thread::start();
 }
 
@@ -140,12 +159,29 @@ void PipeReader::run (void)
 				// Canceled.
 				break;
 			}
+
+			if (m_dataEvent)
+				m_dataEvent->signal();
 		}
 		else if (result == DE_FILERESULT_END_OF_FILE ||
 				 result == DE_FILERESULT_WOULD_BLOCK)
 		{
+#if defined(XS_USE_POSIX_EVENTS)
+			if (result == DE_FILERESULT_END_OF_FILE)
+			{
+				// Write end closed, most likely process has exited. Let listener know and
+				// wait until stopped.
+				if (m_dataEvent)
+					m_dataEvent->signal();
+
+				waitForFd(-1, 0, m_cancelEvent.getFd(), WAIT_INFINITE);
+			}
+			else
+				waitForFd((int)deFile_getHandle(m_file), WAITEVENT_READ, m_cancelEvent.getFd(), WAIT_INFINITE);
+#else
 			// Wait for more data.
 			deSleep(FILEREADER_IDLE_SLEEP);
+#endif
 		}
 		else
 			break; // Error.
@@ -159,6 +195,7 @@ void PipeReader::stop (void)
 
 	// Buffer must be in canceled state or otherwise stopping reader might block.
 	DE_ASSERT(m_buf->isCanceled());
+	m_cancelEvent.signal();
 
 	// Join thread.
 	join();
@@ -168,19 +205,97 @@ void PipeReader::stop (void)
 
 } // unix
 
-PosixTestProcess::PosixTestProcess (void)
-	: m_process				(DE_NULL)
+PosixTestProcess::PosixTestProcess (LogTransport logTransport, bool teeLogFile)
+	: m_logTransport		(logTransport)
+	, m_teeLogFile			(teeLogFile)
+	, m_process				(DE_NULL)
 	, m_processStartTime	(0)
 	, m_infoBuffer			(INFO_BUFFER_BLOCK_SIZE, INFO_BUFFER_NUM_BLOCKS)
-	, m_stdOutReader		(&m_infoBuffer)
-	, m_stdErrReader		(&m_infoBuffer)
-	, m_logReader			(LOG_BUFFER_BLOCK_SIZE, LOG_BUFFER_NUM_BLOCKS)
+	, m_logBuffer			(LOG_BUFFER_BLOCK_SIZE, LOG_BUFFER_NUM_BLOCKS)
+	, m_logPipe				(DE_NULL)
+	, m_logTee				(DE_NULL)
+	, m_stdOutReader		(&m_infoBuffer, &m_dataEvent)
+	, m_stdErrReader		(&m_infoBuffer, &m_dataEvent)
+	, m_logReader			(LOG_BUFFER_BLOCK_SIZE, LOG_BUFFER_NUM_BLOCKS, &m_dataEvent)
+	, m_logPipeReader		(&m_logBuffer, &m_dataEvent)
 {
+	DE_ASSERT(de::inBounds<int>(logTransport, 0, LOGTRANSPORT_LAST));
 }
 
 PosixTestProcess::~PosixTestProcess (void)
 {
 	delete m_process;
+	closeLogFiles();
+}
+
+void PosixTestProcess::createLogPipe (int* writeFd)
+{
+#if defined(XS_USE_POSIX_EVENTS)
+	int fds[2];
+
+	DE_ASSERT(!m_logPipe);
+
+	if (pipe(fds) != 0)
+		throw TestProcessException("Failed to create log pipe");
+
+	// \note Write end must stay inheritable, read end must not leak into test process.
+	if (fcntl(fds[0], F_SETFD, FD_CLOEXEC) != 0)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		throw TestProcessException("Failed to set log pipe flags");
+	}
+
+	m_logPipe = deFile_createFromHandle((deUintptr)fds[0]);
+
+	if (!m_logPipe)
+	{
+		// \note deFile_createFromHandle() closes the handle on failure.
+		close(fds[1]);
+		throw TestProcessException("Failed to create log pipe");
+	}
+
+	*writeFd = fds[1];
+#else
+	DE_UNREF(writeFd);
+	throw TestProcessException("Log pipe transport is not supported on this platform");
+#endif
+}
+
+void PosixTestProcess::closeLogFiles (void)
+{
+	if (m_logPipe)
+	{
+		deFile_destroy(m_logPipe);
+		m_logPipe = DE_NULL;
+	}
+
+	if (m_logTee)
+	{
+		deFile_destroy(m_logTee);
+		m_logTee = DE_NULL;
+	}
+}
+
+void PosixTestProcess::writeLogTee (const deUint8* data, int numBytes)
+{
+	int pos = 0;
+
+	while (pos < numBytes)
+	{
+		deInt64	numWritten	= 0;
+
+		if (deFile_write(m_logTee, data+pos, numBytes-pos, &numWritten) != DE_FILERESULT_SUCCESS)
+		{
+			// Stop teeing instead of failing the whole session.
+			printf("PosixTestProcess: Failed to write log file copy '%s'\n", m_logFileName.c_str());
+			deFile_destroy(m_logTee);
+			m_logTee = DE_NULL;
+			return;
+		}
+
+		pos += (int)numWritten;
+	}
 }
 
 void PosixTestProcess::start (const char* name, const char* params, const char* workingDir, const char* caseList)
@@ -199,9 +314,27 @@ void PosixTestProcess::start (const char* name, const char* params, const char*
 			throw TestProcessException(string("Failed to remove '") + m_logFileName + "'");
 	}
 
+	int logPipeFd = -1;
+
+	if (m_logTransport == LOGTRANSPORT_PIPE)
+	{
+		createLogPipe(&logPipeFd);
+
+		if (m_teeLogFile)
+		{
+			m_logTee = deFile_create(m_logFileName.c_str(), DE_FILEMODE_CREATE|DE_FILEMODE_WRITE);
+			if (!m_logTee)
+				printf("PosixTestProcess: Failed to create log file copy '%s'\n", m_logFileName.c_str());
+		}
+	}
+
 	// Construct command line.
 	string cmdLine = de::FilePath(name).isAbsolutePath() ? name : de::FilePath::join(workingDir, name).getPath();
-	cmdLine += string(" --deqp-log-filename=") + logFilePath.getBaseName();
+
+	if (logPipeFd >= 0)
+		cmdLine += string(" --deqp-log-filename=fd:") + de::toString(logPipeFd);
+	else
+		cmdLine += string(" --deqp-log-filename=") + logFilePath.getBaseName();
 
 	if (hasCaseList)
 		cmdLine += " --deqp-stdin-caselist";
@@ -218,6 +351,12 @@ void PosixTestProcess::start (const char* name, const char* params, const char*
 	}
 	catch (const de::ProcessError& e)
 	{
+#if defined(XS_USE_POSIX_EVENTS)
+		if (logPipeFd >= 0)
+			close(logPipeFd);
+#endif
+		closeLogFiles();
+
 		delete m_process;
 		m_process = DE_NULL;
 		throw TestProcessException(e.what());
@@ -225,6 +364,15 @@ void PosixTestProcess::start (const char* name, const char* params, const char*
 
 	m_processStartTime = deGetMicroseconds();
 
+	if (logPipeFd >= 0)
+	{
+#if defined(XS_USE_POSIX_EVENTS)
+		// Only test process may hold write end, otherwise reader never sees end of file.
+		close(logPipeFd);
+#endif
+		m_logPipeReader.start(m_logPipe);
+	}
+
 	// Create stdout & stderr readers.
 	if (m_process->getStdOut())
 		m_stdOutReader.start(m_process->getStdOut());
@@ -266,6 +414,15 @@ void PosixTestProcess::cleanup (void)
 	m_caseListWriter.stop();
 	m_logReader.stop();
 
+	if (m_logPipeReader.isStarted())
+	{
+		m_logBuffer.cancel();
+		m_logPipeReader.stop();
+		m_logBuffer.clear();
+	}
+
+	closeLogFiles();
+
 	// \note Info buffer must be canceled before stopping pipe readers.
 	m_infoBuffer.cancel();
 
@@ -274,6 +431,7 @@ void PosixTestProcess::cleanup (void)
 
 	// Reset info buffer.
 	m_infoBuffer.clear();
+	m_dataEvent.drain();
 
 	if (m_process)
 	{
@@ -313,6 +471,16 @@ int PosixTestProcess::getExitCode (void) const
 
 int PosixTestProcess::readTestLog (deUint8* dst, int numBytes)
 {
+	if (m_logTransport == LOGTRANSPORT_PIPE)
+	{
+		const int numRead = m_logBuffer.tryRead(numBytes, dst);
+
+		if (numRead > 0 && m_logTee)
+			writeLogTee(dst, numRead);
+
+		return numRead;
+	}
+
 	if (!m_logReader.isRunning())
 	{
 		if (deGetMicroseconds() - m_processStartTime > LOG_FILE_TIMEOUT*1000)
@@ -26,6 +26,7 @@
 #include "xsDefs.hpp"
 #include "xsTestProcess.hpp"
 #include "xsPosixFileReader.hpp"
+#include "xsPosixEvent.hpp"
 #include "deProcess.hpp"
 #include "deThread.hpp"
 
@@ -52,12 +53,13 @@ private:
 	deFile*					m_file;
 	std::vector<char>		m_caseList;
 	bool					m_run;
+	WakeupPipe				m_cancelEvent;
 };
 
 class PipeReader : public de::Thread
 {
 public:
-							PipeReader			(ThreadedByteBuffer* dst);
+							PipeReader			(ThreadedByteBuffer* dst, WakeupPipe* dataEvent = DE_NULL);
 							~PipeReader			(void);
 
 	void					start				(deFile* file);
@@ -68,6 +70,8 @@ public:
 private:
 	deFile*					m_file;
 	ThreadedByteBuffer*		m_buf;
+	WakeupPipe*				m_dataEvent;		//!< Signaled when new data is available or pipe is closed (may be null).
+	WakeupPipe				m_cancelEvent;
 };
 
 } // posix
@@ -75,7 +79,15 @@ private:
 class PosixTestProcess : public TestProcess
 {
 public:
-							PosixTestProcess		(void);
+	enum LogTransport
+	{
+		LOGTRANSPORT_FILE = 0,		//!< Test process writes TestResults.qpa into working directory, server reads it back.
+		LOGTRANSPORT_PIPE,			//!< Test process writes log into inherited pipe, no file is needed.
+
+		LOGTRANSPORT_LAST
+	};
+
+							PosixTestProcess		(LogTransport logTransport = LOGTRANSPORT_FILE, bool teeLogFile = false);
 	virtual					~PosixTestProcess		(void);
 
 	virtual void			start					(const char* name, const char* params, const char* workingDir, const char* caseList);
@@ -89,20 +101,35 @@ public:
 	virtual int				readTestLog				(deUint8* dst, int numBytes);
 	virtual int				readInfoLog				(deUint8* dst, int numBytes) { return m_infoBuffer.tryRead(numBytes, dst); }
 
+	virtual int				getEventFd				(void) { return m_dataEvent.getFd();	}
+	virtual void			clearEvents				(void) { m_dataEvent.drain();			}
+
 private:
 							PosixTestProcess		(const PosixTestProcess& other);
 	PosixTestProcess&		operator=				(const PosixTestProcess& other);
 
+	void					createLogPipe			(int* writeFd);
+	void					closeLogFiles			(void);
+	void					writeLogTee				(const deUint8* data, int numBytes);
+
+	const LogTransport		m_logTransport;
+	const bool				m_teeLogFile;			//!< Write copy of streamed log into working directory in pipe mode.
+
 	de::Process*			m_process;
 	deUint64				m_processStartTime;		//!< Used for determining log file timeout.
 	std::string				m_logFileName;
 	ThreadedByteBuffer		m_infoBuffer;
+	posix::WakeupPipe		m_dataEvent;			//!< Signaled by reader threads when new data is available.
+	ThreadedByteBuffer		m_logBuffer;			//!< Log data received through pipe.
+	deFile*					m_logPipe;				//!< Read end of log pipe.
+	deFile*					m_logTee;
 
 	// Threads.
 	posix::CaseListWriter	m_caseListWriter;
 	posix::PipeReader		m_stdOutReader;
 	posix::PipeReader		m_stdErrReader;
 	posix::FileReader		m_logReader;
+	posix::PipeReader		m_logPipeReader;
 };
 
 } // xs
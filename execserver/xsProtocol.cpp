@@ -23,6 +23,8 @@
 
 #include "xsProtocol.hpp"
 
+#include <zlib.h>
+
 using std::string;
 using std::vector;
 
@@ -76,6 +78,11 @@ public:
 		m_pos += 1;
 	}
 
+	bool hasMoreData (void) const
+	{
+		return m_pos < m_size;
+	}
+
 	void assumEnd (void)
 	{
 		if (m_pos != m_size)
@@ -164,7 +171,8 @@ HelloMessage::HelloMessage (const deUint8* data, size_t dataSize)
 	: Message(MESSAGETYPE_HELLO)
 {
 	MessageParser parser(data, dataSize);
-	version = parser.get<int>();
+	version		= parser.get<int>();
+	features	= parser.hasMoreData() ? (deUint32)parser.get<int>() : 0u;
 	parser.assumEnd();
 }
 
@@ -172,6 +180,9 @@ void HelloMessage::write (vector<deUint8>& buf) const
 {
 	MessageWriter writer(type, buf);
 	writer.put(version);
+
+	if (features != 0)
+		writer.put((int)features);
 }
 
 TestMessage::TestMessage (const deUint8* data, size_t dataSize)
@@ -222,6 +233,74 @@ void ProcessLogDataMessage::write (vector<deUint8>& buf) const
 	writer.put(logData.c_str());
 }
 
+// Compressed payload: [uncompressed size][zlib stream]
+
+CompressedProcessLogDataMessage::CompressedProcessLogDataMessage (const deUint8* data, size_t dataSize)
+	: Message(MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED)
+{
+	MessageParser parser(data, dataSize);
+	uncompressedSize = parser.get<int>();
+	compressedData.assign(data+sizeof(int), data+dataSize);
+}
+
+void CompressedProcessLogDataMessage::write (vector<deUint8>& buf) const
+{
+	MessageWriter writer(type, buf);
+	writer.put(uncompressedSize);
+
+	const size_t curPos = buf.size();
+	buf.resize(curPos + compressedData.size());
+	if (!compressedData.empty())
+		deMemcpy(&buf[curPos], &compressedData[0], compressedData.size());
+}
+
+void CompressedProcessLogDataMessage::decompress (const deUint8* data, size_t dataSize, vector<deUint8>& dst)
+{
+	MessageParser	parser		(data, dataSize);
+	const int		dstSize		= parser.get<int>();
+	uLongf			numWritten	= (uLongf)dstSize;
+
+	XS_CHECK_MSG(dstSize >= 0, "Invalid uncompressed size");
+
+	dst.resize((size_t)dstSize);
+
+	if (dstSize == 0)
+		return;
+
+	if (uncompress(&dst[0], &numWritten, data+sizeof(int), (uLong)(dataSize-sizeof(int))) != Z_OK || numWritten != (uLongf)dstSize)
+		XS_FAIL("Failed to decompress log data");
+}
+
+size_t CompressedProcessLogDataMessage::getMaxMessageSize (size_t srcSize)
+{
+	return MESSAGE_HEADER_SIZE + sizeof(int) + (size_t)compressBound((uLong)srcSize);
+}
+
+size_t CompressedProcessLogDataMessage::compress (const deUint8* src, size_t srcSize, vector<deUint8>& dst)
+{
+	const size_t	payloadOffset	= MESSAGE_HEADER_SIZE + sizeof(int);
+	uLongf			compressedSize	= 0;
+
+	if (dst.size() < getMaxMessageSize(srcSize))
+		dst.resize(getMaxMessageSize(srcSize));
+
+	compressedSize = (uLongf)(dst.size() - payloadOffset);
+
+	// \note Best speed since server may run on slow device and base64 image data doesn't compress much better anyway.
+	if (compress2(&dst[payloadOffset], &compressedSize, src, (uLong)srcSize, Z_BEST_SPEED) != Z_OK)
+		XS_FAIL("Failed to compress log data");
+
+	{
+		const size_t	msgSize		= payloadOffset + (size_t)compressedSize;
+		const int		netSrcSize	= hostToNetwork((int)srcSize);
+
+		writeHeader(MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED, msgSize, &dst[0], MESSAGE_HEADER_SIZE);
+		deMemcpy(&dst[MESSAGE_HEADER_SIZE], &netSrcSize, sizeof(int));
+
+		return msgSize;
+	}
+}
+
 ProcessLaunchFailedMessage::ProcessLaunchFailedMessage (const deUint8* data, size_t dataSize)
 	: Message(MESSAGETYPE_PROCESS_LAUNCH_FAILED)
 {
@@ -42,6 +42,14 @@ enum
 	KEEPALIVE_TIMEOUT			= 30000,
 };
 
+//! Optional protocol extensions, negotiated with HelloMessage.
+enum ProtocolFeature
+{
+	PROTOCOLFEATURE_COMPRESSED_LOG_DATA	= (1<<0),	//!< ExecServer may send log data as MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED.
+
+	PROTOCOLFEATURE_ALL					= PROTOCOLFEATURE_COMPRESSED_LOG_DATA
+};
+
 enum MessageType
 {
 	MESSAGETYPE_NONE					= 0,	//!< Not valid.
@@ -58,6 +66,7 @@ enum MessageType
 	MESSAGETYPE_PROCESS_FINISHED		= 202,	//!< Requested process has finished (for any reason).
 	MESSAGETYPE_PROCESS_LOG_DATA		= 203,	//!< Unprocessed log data from TestResults.qpa.
 	MESSAGETYPE_INFO					= 204,	//!< Generic info message from ExecServer (for debugging purposes).
+	MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED	= 205,	//!< Deflate-compressed log data, only sent if negotiated.
 
 	MESSAGETYPE_KEEPALIVE				= 102	//!< Keep-alive packet
 };
@@ -100,13 +109,23 @@ typedef SimpleMessage<MESSAGETYPE_STOP_EXECUTION>			StopExecutionMessage;
 typedef SimpleMessage<MESSAGETYPE_PROCESS_STARTED>			ProcessStartedMessage;
 typedef SimpleMessage<MESSAGETYPE_KEEPALIVE>				KeepAliveMessage;
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Hello message
+ *
+ * Features is an optional bitmask of ProtocolFeature values and is
+ * omitted from the payload when zero, so plain hello is compatible with
+ * older servers. ExecServer replies to hello with non-zero features with
+ * hello containing the accepted subset. Servers that don't support
+ * features close the connection instead.
+ *//*--------------------------------------------------------------------*/
 class HelloMessage : public Message
 {
 public:
 	int				version;
+	deUint32		features;
 
 					HelloMessage	(const deUint8* data, size_t dataSize);
-					HelloMessage	(void) : Message(MESSAGETYPE_HELLO), version(PROTOCOL_VERSION) {}
+					HelloMessage	(void) : Message(MESSAGETYPE_HELLO), version(PROTOCOL_VERSION), features(0) {}
 					~HelloMessage	(void) {}
 
 	void			write			(std::vector<deUint8>& buf) const;
@@ -138,6 +157,25 @@ public:
 	void			write						(std::vector<deUint8>& buf) const;
 };
 
+class CompressedProcessLogDataMessage : public Message
+{
+public:
+	int						uncompressedSize;
+	std::vector<deUint8>	compressedData;
+
+							CompressedProcessLogDataMessage		(const deUint8* data, size_t dataSize);
+							~CompressedProcessLogDataMessage	(void) {}
+
+	void					write								(std::vector<deUint8>& buf) const;
+
+	//! Decompress payload of message (without header) into dst.
+	static void				decompress							(const deUint8* data, size_t dataSize, std::vector<deUint8>& dst);
+	//! Write complete message containing compressed src into dst. Returns message size.
+	static size_t			compress							(const deUint8* src, size_t srcSize, std::vector<deUint8>& dst);
+	//! Upper bound for size of compressed message.
+	static size_t			getMaxMessageSize					(size_t srcSize);
+};
+
 class ProcessLaunchFailedMessage : public Message
 {
 public:
@@ -46,6 +46,9 @@ TestDriver::TestDriver (xs::TestProcess* testProcess)
 	, m_process				(testProcess)
 	, m_lastProcessDataTime	(0)
 	, m_dataMsgTmpBuf		(SEND_RECV_TMP_BUFFER_SIZE)
+	, m_protocolFeatures	(0)
+	, m_logFrame			(COMPRESSED_LOG_FRAME_SIZE)
+	, m_logFrameSize		(0)
 {
 }
 
@@ -58,7 +61,9 @@ void TestDriver::reset (void)
 {
 	m_process->cleanup();
 
-	m_state = STATE_NOT_STARTED;
+	m_state				= STATE_NOT_STARTED;
+	m_protocolFeatures	= 0;
+	m_logFrameSize		= 0;
 }
 
 void TestDriver::startProcess (const char* name, const char* params, const char* workingDir, const char* caseList)
@@ -114,6 +119,9 @@ bool TestDriver::poll (ByteBuffer& messageBuffer)
 			DBG_PRINT(("  STATE_PROCESS_RUNNING\n"));
 			bool gotProcessData = false;
 
+			// Clear pending events before reading so that data arriving after this point wakes up the server.
+			m_process->clearEvents();
+
 			// Poll log file and info buffer.
 			gotProcessData = pollLogFile(messageBuffer)	|| gotProcessData;
 			gotProcessData = pollInfo(messageBuffer)	|| gotProcessData;
@@ -139,6 +147,9 @@ bool TestDriver::poll (ByteBuffer& messageBuffer)
 			DBG_PRINT(("  STATE_READING_DATA\n"));
 			bool gotProcessData = false;
 
+			// Clear pending events before reading so that data arriving after this point wakes up the server.
+			m_process->clearEvents();
+
 			// Poll log file and info buffer.
 			gotProcessData = pollLogFile(messageBuffer)	|| gotProcessData;
 			gotProcessData = pollInfo(messageBuffer)	|| gotProcessData;
@@ -151,6 +162,10 @@ bool TestDriver::poll (ByteBuffer& messageBuffer)
 			}
 			else if (deGetMicroseconds() - m_lastProcessDataTime > READ_DATA_TIMEOUT*1000)
 			{
+				// Batched log data must be sent before finishing.
+				if (!flushLogFrame(messageBuffer))
+					return false;
+
 				// Read timeout occurred.
 				m_state = STATE_PROCESS_FINISHED;
 				return true; // State change.
@@ -181,7 +196,10 @@ bool TestDriver::poll (ByteBuffer& messageBuffer)
 
 bool TestDriver::pollLogFile (ByteBuffer& messageBuffer)
 {
-	return pollBuffer(messageBuffer, MESSAGETYPE_PROCESS_LOG_DATA);
+	if (m_protocolFeatures & PROTOCOLFEATURE_COMPRESSED_LOG_DATA)
+		return pollCompressedLog(messageBuffer);
+	else
+		return pollBuffer(messageBuffer, MESSAGETYPE_PROCESS_LOG_DATA);
 }
 
 bool TestDriver::pollInfo (ByteBuffer& messageBuffer)
@@ -224,6 +242,48 @@ bool TestDriver::pollBuffer (ByteBuffer& messageBuffer, MessageType msgType)
 	return true;
 }
 
+bool TestDriver::pollCompressedLog (ByteBuffer& messageBuffer)
+{
+	bool gotData = false;
+
+	// Batch log data into frame.
+	if (m_logFrameSize < (int)m_logFrame.size())
+	{
+		const int numRead = m_process->readTestLog(&m_logFrame[m_logFrameSize], (int)m_logFrame.size()-m_logFrameSize);
+
+		if (numRead > 0)
+		{
+			m_logFrameSize	+= numRead;
+			gotData			 = true;
+		}
+	}
+
+	// Send frame when it is full or link has nothing else to send. While previous data
+	// is still being sent, batching more data doesn't add latency but improves compression.
+	if (m_logFrameSize > 0 && (m_logFrameSize == (int)m_logFrame.size() || messageBuffer.getNumElements() == 0))
+		gotData = flushLogFrame(messageBuffer) || gotData;
+
+	return gotData;
+}
+
+bool TestDriver::flushLogFrame (ByteBuffer& messageBuffer)
+{
+	if (m_logFrameSize == 0)
+		return true;
+
+	if (messageBuffer.getNumFree() < (int)CompressedProcessLogDataMessage::getMaxMessageSize((size_t)m_logFrameSize))
+		return false; // Wait until there is room.
+
+	const size_t msgSize = CompressedProcessLogDataMessage::compress(&m_logFrame[0], (size_t)m_logFrameSize, m_compressedMsgBuf);
+
+	messageBuffer.pushFront(&m_compressedMsgBuf[0], (int)msgSize);
+
+	DBG_PRINT(("  wrote %d bytes of compressed log data (%d uncompressed)\n", (int)msgSize, m_logFrameSize));
+
+	m_logFrameSize = 0;
+	return true;
+}
+
 bool TestDriver::writeMessage (ByteBuffer& messageBuffer, const Message& message)
 {
 	vector<deUint8> buf;
@@ -45,6 +45,11 @@ public:
 
 	bool					poll				(ByteBuffer& messageBuffer);
 
+	void					setProtocolFeatures	(deUint32 features) { m_protocolFeatures = features; }
+
+	int						getEventFd			(void) const { return m_process->getEventFd(); }
+	bool					isProcessActive		(void) const { return m_state == STATE_PROCESS_RUNNING || m_state == STATE_READING_DATA; }
+
 private:
 	enum State
 	{
@@ -61,6 +66,8 @@ private:
 	bool					pollLogFile			(ByteBuffer& messageBuffer);
 	bool					pollInfo			(ByteBuffer& messageBuffer);
 	bool					pollBuffer			(ByteBuffer& messageBuffer, MessageType msgType);
+	bool					pollCompressedLog	(ByteBuffer& messageBuffer);
+	bool					flushLogFrame		(ByteBuffer& messageBuffer);
 
 	bool					writeMessage		(ByteBuffer& messageBuffer, const Message& message);
 
@@ -73,6 +80,11 @@ private:
 	deUint64				m_lastProcessDataTime;
 
 	std::vector<deUint8>	m_dataMsgTmpBuf;
+
+	deUint32				m_protocolFeatures;
+	std::vector<deUint8>	m_logFrame;				//!< Log data batched for compression.
+	int						m_logFrameSize;
+	std::vector<deUint8>	m_compressedMsgBuf;
 };
 
 } // xs
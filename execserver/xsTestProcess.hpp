@@ -51,6 +51,11 @@ public:
 	virtual int				readTestLog				(deUint8* dst, int numBytes)	= DE_NULL;
 	virtual int				readInfoLog				(deUint8* dst, int numBytes)	= DE_NULL;
 
+	//! POSIX file descriptor that becomes readable when new output may be available, -1 if not supported.
+	virtual int				getEventFd				(void)							{ return -1;	}
+	//! Clear pending events. Called before reading output.
+	virtual void			clearEvents				(void)							{				}
+
 protected:
 							TestProcess				(void) {}
 };
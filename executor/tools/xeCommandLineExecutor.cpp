@@ -69,6 +69,7 @@ DE_DECLARE_COMMAND_LINE_OPT(ContinueFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(TestLogFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(InfoLogFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(Summary,		bool);
+DE_DECLARE_COMMAND_LINE_OPT(CompressLog,	bool);
 
 // TargetConfiguration
 DE_DECLARE_COMMAND_LINE_OPT(BinaryName,		string);
@@ -105,6 +106,7 @@ void registerOptions (de::cmdline::Parser& parser)
 		   << Option<TestLogFile>	("o",		"out",			"Output test log filename.",											"TestLog.qpa")
 		   << Option<InfoLogFile>	("i",		"info",			"Output info log filename.",											"InfoLog.txt")
 		   << Option<Summary>		(DE_NULL,	"summary",		"Print summary after running tests.",									s_yesNo, "yes")
+		   << Option<CompressLog>	(DE_NULL,	"compress-log",	"Request compressed test log transfer. Requires ExecServer support.",	s_yesNo, "no")
 		   << Option<BinaryName>	("b",		"binaryname",	"Test binary path. Relative to working directory.",						"<Unused>")
 		   << Option<WorkingDir>	("wd",		"workdir",		"Working directory for the test execution.",							".")
 		   << Option<CmdLineArgs>	(DE_NULL,	"cmdline",		"Additional command line arguments for the test binary.",				"");
@@ -121,8 +123,9 @@ enum RunMode
 struct CommandLine
 {
 	CommandLine (void)
-		: port		(0)
-		, summary	(false)
+		: port			(0)
+		, summary		(false)
+		, compressLog	(false)
 	{
 	}
 
@@ -137,6 +140,7 @@ struct CommandLine
 	string					outFile;
 	string					infoFile;
 	bool					summary;
+	bool					compressLog;
 };
 
 bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -201,6 +205,7 @@ bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
 	cmdLine.outFile					= opts.getOption<opt::TestLogFile>();
 	cmdLine.infoFile				= opts.getOption<opt::InfoLogFile>();
 	cmdLine.summary					= opts.getOption<opt::Summary>();
+	cmdLine.compressLog				= opts.getOption<opt::CompressLog>();
 	cmdLine.targetCfg.binaryName	= opts.getOption<opt::BinaryName>();
 	cmdLine.targetCfg.workingDir	= opts.getOption<opt::WorkingDir>();
 	cmdLine.targetCfg.cmdLineArgs	= opts.getOption<opt::CmdLineArgs>();
@@ -458,12 +463,14 @@ void writeInfoLog (const xe::InfoLog& log, const char* filename)
 
 xe::CommLink* createCommLink (const CommandLine& cmdLine)
 {
+	const deUint32 protocolFeatures = cmdLine.compressLog ? (deUint32)xs::PROTOCOLFEATURE_COMPRESSED_LOG_DATA : 0u;
+
 	if (cmdLine.runMode == RUNMODE_START_SERVER)
 	{
 		xe::LocalTcpIpLink* link = new xe::LocalTcpIpLink();
 		try
 		{
-			link->start(cmdLine.serverBinOrAddress.c_str(), DE_NULL, cmdLine.port);
+			link->start(cmdLine.serverBinOrAddress.c_str(), DE_NULL, cmdLine.port, protocolFeatures);
 			return link;
 		}
 		catch (...)
@@ -486,7 +493,7 @@ xe::CommLink* createCommLink (const CommandLine& cmdLine)
 		{
 			std::string error;
 
-			link->connect(address);
+			link->connect(address, protocolFeatures);
 			return link;
 		}
 		catch (const std::exception& error)
@@ -0,0 +1,220 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Decode binary GL call trace into call log and timing statistics.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluCallTrace.hpp"
+#include "deString.h"
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdio>
+
+using std::vector;
+using std::string;
+
+enum
+{
+	NUM_HISTOGRAM_BUCKETS	= 24	//!< Buckets are powers of two microseconds, last bucket takes the rest.
+};
+
+struct CommandLine
+{
+	CommandLine (void)
+		: printCalls	(true)
+		, printStats	(true)
+	{
+	}
+
+	string			filename;
+	bool			printCalls;
+	bool			printStats;
+};
+
+struct FunctionStats
+{
+	FunctionStats (void)
+		: numCalls		(0)
+		, totalTime		(0)
+		, minTime		(~0u)
+		, maxTime		(0)
+	{
+		for (int ndx = 0; ndx < NUM_HISTOGRAM_BUCKETS; ndx++)
+			histogram[ndx] = 0;
+	}
+
+	deUint32		function;
+	deUint64		numCalls;
+	deUint64		totalTime;
+	deUint32		minTime;
+	deUint32		maxTime;
+	deUint64		histogram[NUM_HISTOGRAM_BUCKETS];
+};
+
+static int getHistogramBucket (deUint32 duration)
+{
+	int bucket = 0;
+
+	while (duration > 0 && bucket < NUM_HISTOGRAM_BUCKETS-1)
+	{
+		duration >>= 1;
+		bucket += 1;
+	}
+
+	return bucket;
+}
+
+static void printCalls (const vector<glu::CallTraceRecord>& records)
+{
+	for (vector<glu::CallTraceRecord>::const_iterator record = records.begin(); record != records.end(); ++record)
+	{
+		std::ostringstream	callStr;
+		std::ostringstream	returnStr;
+
+		glu::decodeCallTraceRecord(*record, callStr, returnStr);
+
+		printf("%s\n", callStr.str().c_str());
+
+		if (!returnStr.str().empty())
+			printf("%s\n", returnStr.str().c_str());
+	}
+}
+
+static void printStats (const vector<glu::CallTraceRecord>& records)
+{
+	vector<FunctionStats>	stats	(glu::CALLTRACEFUNC_LAST);
+	deUint64				first	= records.empty() ? 0 : records.front().timestamp;
+	deUint64				last	= first;
+
+	for (vector<glu::CallTraceRecord>::const_iterator record = records.begin(); record != records.end(); ++record)
+	{
+		FunctionStats& func = stats[record->function < (deUint32)glu::CALLTRACEFUNC_LAST ? record->function : 0];
+
+		func.numCalls		+= 1;
+		func.totalTime		+= record->duration;
+		func.minTime		 = de::min(func.minTime, record->duration);
+		func.maxTime		 = de::max(func.maxTime, record->duration);
+		func.histogram[getHistogramBucket(record->duration)] += 1;
+
+		first	= de::min(first, record->timestamp);
+		last	= de::max(last, record->timestamp + record->duration);
+	}
+
+	printf("\n%d calls in %.3f ms\n\n", (int)records.size(), double(last - first) / 1000.0);
+	printf("%-40s %10s %12s %10s %10s %10s\n", "Function", "Calls", "Total (us)", "Mean (us)", "Min (us)", "Max (us)");
+
+	for (deUint32 function = 0; function < (deUint32)stats.size(); function++)
+	{
+		const FunctionStats& func = stats[function];
+
+		if (func.numCalls == 0)
+			continue;
+
+		printf("%-40s %10llu %12llu %10.1f %10u %10u\n",
+			   glu::getCallTraceFunctionName(function),
+			   (unsigned long long)func.numCalls,
+			   (unsigned long long)func.totalTime,
+			   double(func.totalTime) / double(func.numCalls),
+			   func.minTime,
+			   func.maxTime);
+	}
+
+	printf("\nDuration histograms (calls per bucket, bucket N covers [2^(N-1), 2^N) us)\n\n");
+
+	for (deUint32 function = 0; function < (deUint32)stats.size(); function++)
+	{
+		const FunctionStats&	func		= stats[function];
+		int						lastBucket	= NUM_HISTOGRAM_BUCKETS-1;
+
+		if (func.numCalls == 0)
+			continue;
+
+		while (lastBucket > 0 && func.histogram[lastBucket] == 0)
+			lastBucket -= 1;
+
+		printf("%-40s", glu::getCallTraceFunctionName(function));
+
+		for (int bucket = 0; bucket <= lastBucket; bucket++)
+			printf(" %llu", (unsigned long long)func.histogram[bucket]);
+
+		printf("\n");
+	}
+}
+
+static void printHelp (const char* binName)
+{
+	printf("%s: [options] [filename]\n", binName);
+	printf(" --no-calls       Don't print decoded calls.\n");
+	printf(" --no-stats       Don't print per-function timing statistics.\n");
+}
+
+static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
+{
+	for (int argNdx = 1; argNdx < argc; argNdx++)
+	{
+		const char* arg = argv[argNdx];
+
+		if (deStringEqual(arg, "--no-calls"))
+			cmdLine.printCalls = false;
+		else if (deStringEqual(arg, "--no-stats"))
+			cmdLine.printStats = false;
+		else if (!deStringBeginsWith(arg, "--") && cmdLine.filename.empty())
+			cmdLine.filename = arg;
+		else
+			return false;
+	}
+
+	if (cmdLine.filename.empty())
+		return false;
+
+	return true;
+}
+
+int main (int argc, const char* const* argv)
+{
+	try
+	{
+		CommandLine					cmdLine;
+		vector<glu::CallTraceRecord>	records;
+
+		if (!parseCommandLine(cmdLine, argc, argv))
+		{
+			printHelp(argv[0]);
+			return -1;
+		}
+
+		glu::readCallTraceFile(cmdLine.filename.c_str(), records);
+
+		if (cmdLine.printCalls)
+			printCalls(records);
+
+		if (cmdLine.printStats)
+			printStats(records);
+	}
+	catch (const std::exception& e)
+	{
+		printf("FATAL ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return 0;
+}
@@ -20,13 +20,14 @@
  * \file
  * \brief Merge two test logs.
  *
- * \todo [2013-11-08 pyry] Write variant that can operate with less memory.
+ * Logs are indexed first and case data is then copied directly from
+ * source files, so memory use doesn't depend on the size of case data.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeTestLogIndex.hpp"
 #include "xeTestLogWriter.hpp"
 #include "deString.h"
+#include "deSharedPtr.hpp"
 
 #include <vector>
 #include <string>
@@ -38,8 +39,6 @@
 
 using std::vector;
 using std::string;
-using std::set;
-using std::map;
 
 enum Flags
 {
@@ -58,104 +57,134 @@ struct CommandLine
 	deUint32		flags;
 };
 
-class LogHandler : public xe::TestLogHandler
+enum
 {
-public:
-	LogHandler (xe::BatchResult* batchResult, deUint32 flags)
-		: m_batchResult	(batchResult)
-		, m_flags		(flags)
+	COPY_BUFFER_SIZE	= 64*1024
+};
+
+static void mergeSessionInfo (xe::SessionInfo& combinedInfo, const xe::SessionInfo& info, deUint32 flags)
+{
+	if (flags & FLAG_USE_LAST_INFO)
 	{
+		if (!info.targetName.empty())		combinedInfo.targetName			= info.targetName;
+		if (!info.releaseId.empty())		combinedInfo.releaseId			= info.releaseId;
+		if (!info.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
+		if (!info.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
+		if (!info.configName.empty())		combinedInfo.configName			= info.configName;
+		if (!info.resultName.empty())		combinedInfo.resultName			= info.resultName;
+		if (!info.timestamp.empty())		combinedInfo.timestamp			= info.timestamp;
 	}
-
-	void setSessionInfo (const xe::SessionInfo& info)
+	else
 	{
-		xe::SessionInfo& combinedInfo = m_batchResult->getSessionInfo();
-
-		if (m_flags & FLAG_USE_LAST_INFO)
-		{
-			if (!info.targetName.empty())		combinedInfo.targetName			= info.targetName;
-			if (!info.releaseId.empty())		combinedInfo.releaseId			= info.releaseId;
-			if (!info.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
-			if (!info.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
-			if (!info.configName.empty())		combinedInfo.configName			= info.configName;
-			if (!info.resultName.empty())		combinedInfo.resultName			= info.resultName;
-			if (!info.timestamp.empty())		combinedInfo.timestamp			= info.timestamp;
-		}
-		else
-		{
-			if (combinedInfo.targetName.empty())		combinedInfo.targetName			= info.targetName;
-			if (combinedInfo.releaseId.empty())			combinedInfo.releaseId			= info.releaseId;
-			if (combinedInfo.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
-			if (combinedInfo.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
-			if (combinedInfo.configName.empty())		combinedInfo.configName			= info.configName;
-			if (combinedInfo.resultName.empty())		combinedInfo.resultName			= info.resultName;
-			if (combinedInfo.timestamp.empty())			combinedInfo.timestamp			= info.timestamp;
-		}
+		if (combinedInfo.targetName.empty())		combinedInfo.targetName			= info.targetName;
+		if (combinedInfo.releaseId.empty())			combinedInfo.releaseId			= info.releaseId;
+		if (combinedInfo.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
+		if (combinedInfo.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
+		if (combinedInfo.configName.empty())		combinedInfo.configName			= info.configName;
+		if (combinedInfo.resultName.empty())		combinedInfo.resultName			= info.resultName;
+		if (combinedInfo.timestamp.empty())			combinedInfo.timestamp			= info.timestamp;
 	}
+}
+
+static void writeTestCase (std::istream& src, const xe::TestLogIndexEntry& entry, vector<deUint8>& copyBuf, std::ostream& dst)
+{
+	dst << "\n#beginTestCaseResult " << entry.casePath << "\n";
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
+	if (entry.dataSize > 0)
 	{
-		if (m_batchResult->hasTestCaseResult(casePath))
+		deUint8		lastCh	= 0;
+
+		for (vector<xe::TestLogDataChunk>::const_iterator dataChunk = entry.dataChunks.begin(); dataChunk != entry.dataChunks.end(); ++dataChunk)
 		{
-			xe::TestCaseResultPtr existingResult = m_batchResult->getTestCaseResult(casePath);
-			existingResult->clear();
-			return existingResult;
+			deUint64	numLeft	= dataChunk->size;
+
+			src.clear();
+			src.seekg((std::streamoff)dataChunk->offset);
+
+			while (numLeft > 0)
+			{
+				const std::streamsize chunkSize = (std::streamsize)de::min<deUint64>(numLeft, (deUint64)copyBuf.size());
+
+				src.read((char*)&copyBuf[0], chunkSize);
+
+				if (src.gcount() != chunkSize)
+					throw std::runtime_error("Failed to read data for " + entry.casePath);
+
+				dst.write((const char*)&copyBuf[0], chunkSize);
+
+				lastCh	 = copyBuf[(size_t)chunkSize-1];
+				numLeft	-= (deUint64)chunkSize;
+			}
 		}
-		else
-			return m_batchResult->createTestCaseResult(casePath);
-	}
 
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-		// Ignored.
+		if (lastCh != '\n' && lastCh != '\r')
+			dst << "\n";
 	}
 
-	void testCaseResultComplete (const xe::TestCaseResultPtr&)
+	if (entry.containerCode == xe::TESTSTATUSCODE_CRASH		||
+		entry.containerCode == xe::TESTSTATUSCODE_TIMEOUT	||
+		entry.containerCode == xe::TESTSTATUSCODE_TERMINATED)
+		dst << "#terminateTestCaseResult " << xe::getTestStatusCodeName(entry.containerCode) << "\n";
+	else
+		dst << "#endTestCaseResult\n";
+}
+
+static void writeMergedLog (const CommandLine& cmdLine, std::ostream& dst)
+{
+	vector<de::SharedPtr<xe::TestLogIndex> >	indices;
+	vector<de::SharedPtr<std::ifstream> >		srcFiles;
+	vector<const xe::TestLogIndex*>				indexPtrs;
+	xe::SessionInfo								sessionInfo;
+
+	for (vector<string>::const_iterator filename = cmdLine.srcFilenames.begin(); filename != cmdLine.srcFilenames.end(); ++filename)
 	{
-		// Ignored.
-	}
+		indices.push_back(de::SharedPtr<xe::TestLogIndex>(new xe::TestLogIndex()));
+		indices.back()->build(filename->c_str(), 0);
+		indexPtrs.push_back(indices.back().get());
 
-private:
-	xe::BatchResult* const	m_batchResult;
-	const deUint32			m_flags;
-};
+		for (vector<xe::SessionInfo>::const_iterator info = indices.back()->getSessionInfos().begin(); info != indices.back()->getSessionInfos().end(); ++info)
+			mergeSessionInfo(sessionInfo, *info, cmdLine.flags);
 
-static void readLogFile (xe::BatchResult* dstResult, const char* filename, deUint32 flags)
-{
-	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
-	LogHandler			resultHandler	(dstResult, flags);
-	xe::TestLogParser	parser			(&resultHandler);
-	deUint8				buf				[2048];
-	int					numRead			= 0;
+		srcFiles.push_back(de::SharedPtr<std::ifstream>(new std::ifstream(filename->c_str(), std::ifstream::binary|std::ifstream::in)));
 
-	if (!in.good())
-		throw std::runtime_error(string("Failed to open '") + filename + "'");
+		if (!srcFiles.back()->good())
+			throw std::runtime_error("Failed to open '" + *filename + "'");
+	}
 
-	for (;;)
 	{
-		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
-		numRead = (int)in.gcount();
+		const xe::MergedTestLogIndex	mergedIndex	(indexPtrs, 0);
+		vector<deUint8>					copyBuf		(COPY_BUFFER_SIZE);
 
-		if (numRead <= 0)
-			break;
+		xe::writeSessionInfo(sessionInfo, dst);
 
-		parser.parse(&buf[0], numRead);
-	}
+		dst << "#beginSession\n";
+
+		for (int caseNdx = 0; caseNdx < mergedIndex.getNumCases(); caseNdx++)
+		{
+			// Result from last log containing the case wins.
+			for (int logNdx = mergedIndex.getNumLogs()-1; logNdx >= 0; logNdx--)
+			{
+				if (const xe::TestLogIndexEntry* entry = mergedIndex.getEntry(caseNdx, logNdx))
+				{
+					writeTestCase(*srcFiles[logNdx], *entry, copyBuf, dst);
+					break;
+				}
+			}
+		}
 
-	in.close();
+		dst << "\n#endSession\n";
+	}
 }
 
 static void mergeTestLogs (const CommandLine& cmdLine)
 {
-	xe::BatchResult batchResult;
-
-	for (vector<string>::const_iterator filename = cmdLine.srcFilenames.begin(); filename != cmdLine.srcFilenames.end(); ++filename)
-		readLogFile(&batchResult, filename->c_str(), cmdLine.flags);
-
 	if (!cmdLine.dstFilename.empty())
-		xe::writeBatchResultToFile(batchResult, cmdLine.dstFilename.c_str());
+	{
+		std::ofstream dst (cmdLine.dstFilename.c_str(), std::ofstream::binary|std::ofstream::trunc);
+		writeMergedLog(cmdLine, dst);
+	}
 	else
-		xe::writeTestLog(batchResult, std::cout);
+		writeMergedLog(cmdLine, std::cout);
 }
 
 static void printHelp (const char* binName)
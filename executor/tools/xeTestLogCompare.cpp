@@ -21,26 +21,21 @@
  * \brief Test log compare utility.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeTestLogIndex.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
 #include "deThread.hpp"
+#include "deSharedPtr.hpp"
 #include "deCommandLine.hpp"
 
 #include <vector>
 #include <string>
 #include <cstdio>
 #include <cstdlib>
-#include <fstream>
 #include <iostream>
-#include <set>
-#include <map>
 
 using std::vector;
 using std::string;
-using std::set;
-using std::map;
 
 enum OutputMode
 {
@@ -116,140 +111,47 @@ struct CommandLine
 	vector<string>		filenames;
 };
 
-struct ShortBatchResult
-{
-	vector<xe::TestCaseResultHeader>	resultHeaders;
-	map<string, int>					resultMap;
-};
-
-class ShortResultHandler : public xe::TestLogHandler
+class LogFileIndexer : public de::Thread
 {
 public:
-	ShortResultHandler (ShortBatchResult& result)
-		: m_result(result)
-	{
-	}
-
-	void setSessionInfo (const xe::SessionInfo&)
+	LogFileIndexer (const char* filename)
+		: m_filename	(filename)
 	{
-		// Ignored.
 	}
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-		// Ignored.
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
+	void run (void)
 	{
-		xe::TestCaseResultHeader	header;
-		int							caseNdx	= (int)m_result.resultHeaders.size();
-
-		header.casePath			= caseData->getTestCasePath();
-		header.caseType			= xe::TESTCASETYPE_SELF_VALIDATE;
-		header.statusCode		= caseData->getStatusCode();
-		header.statusDetails	= caseData->getStatusDetails();
-
-		if (header.statusCode == xe::TESTSTATUSCODE_LAST)
+		try
 		{
-			xe::TestCaseResult fullResult;
-
-			xe::parseTestCaseResultFromData(&m_testResultParser, &fullResult, *caseData.get());
-
-			header = xe::TestCaseResultHeader(fullResult);
+			m_index.build(m_filename.c_str(), xe::TestLogIndex::FLAG_PARSE_STATUS);
+		}
+		catch (const std::exception& e)
+		{
+			m_error = m_filename + ": " + e.what();
 		}
-
-		// Insert into result list & map.
-		m_result.resultHeaders.push_back(header);
-		m_result.resultMap[header.casePath] = caseNdx;
-	}
-
-private:
-	ShortBatchResult&		m_result;
-	xe::TestResultParser	m_testResultParser;
-};
-
-static void readLogFile (ShortBatchResult& batchResult, const char* filename)
-{
-	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
-	ShortResultHandler	resultHandler	(batchResult);
-	xe::TestLogParser	parser			(&resultHandler);
-	deUint8				buf				[1024];
-	int					numRead			= 0;
-
-	for (;;)
-	{
-		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
-		numRead = (int)in.gcount();
-
-		if (numRead <= 0)
-			break;
-
-		parser.parse(&buf[0], numRead);
-	}
-
-	in.close();
-}
-
-class LogFileReader : public de::Thread
-{
-public:
-	LogFileReader (ShortBatchResult& batchResult, const char* filename)
-		: m_batchResult	(batchResult)
-		, m_filename	(filename)
-	{
 	}
 
-	void run (void)
-	{
-		readLogFile(m_batchResult, m_filename.c_str());
-	}
+	const xe::TestLogIndex&	getIndex	(void) const { return m_index;	}
+	const string&			getError	(void) const { return m_error;	}
 
 private:
-	ShortBatchResult&	m_batchResult;
-	std::string			m_filename;
+	xe::TestLogIndex	m_index;
+	string				m_filename;
+	string				m_error;
 };
 
-static void computeCaseList (vector<string>& cases, const vector<ShortBatchResult>& batchResults)
+static void getTestResultHeaders (vector<xe::TestCaseResultHeader>& headers, const xe::MergedTestLogIndex& mergedIndex, int caseNdx)
 {
-	// \todo [2012-07-10 pyry] Do proper case ordering (eg. handle missing cases nicely).
-	set<string> addedCases;
+	headers.resize(mergedIndex.getNumLogs());
 
-	for (vector<ShortBatchResult>::const_iterator batchIter = batchResults.begin(); batchIter != batchResults.end(); batchIter++)
+	for (int ndx = 0; ndx < mergedIndex.getNumLogs(); ndx++)
 	{
-		for (vector<xe::TestCaseResultHeader>::const_iterator caseIter = batchIter->resultHeaders.begin(); caseIter != batchIter->resultHeaders.end(); caseIter++)
-		{
-			if (addedCases.find(caseIter->casePath) == addedCases.end())
-			{
-				cases.push_back(caseIter->casePath);
-				addedCases.insert(caseIter->casePath);
-			}
-		}
-	}
-}
-
-static void getTestResultHeaders (vector<xe::TestCaseResultHeader>& headers, const vector<ShortBatchResult>& batchResults, const char* casePath)
-{
-	headers.resize(batchResults.size());
+		const xe::TestLogIndexEntry* entry = mergedIndex.getEntry(caseNdx, ndx);
 
-	for (int ndx = 0; ndx < (int)batchResults.size(); ndx++)
-	{
-		const ShortBatchResult&				batchResult	= batchResults[ndx];
-		map<string, int>::const_iterator	resultPos	= batchResult.resultMap.find(casePath);
-
-		if (resultPos != batchResult.resultMap.end())
-			headers[ndx] = batchResult.resultHeaders[resultPos->second];
-		else
-		{
-			headers[ndx].casePath	= casePath;
-			headers[ndx].caseType	= xe::TESTCASETYPE_SELF_VALIDATE;
-			headers[ndx].statusCode	= xe::TESTSTATUSCODE_LAST;
-		}
+		headers[ndx].casePath		= mergedIndex.getCasePath(caseNdx);
+		headers[ndx].caseType		= xe::TESTCASETYPE_SELF_VALIDATE;
+		headers[ndx].statusCode		= entry ? entry->statusCode : xe::TESTSTATUSCODE_LAST;
+		headers[ndx].statusDetails	= entry ? entry->statusDetails : string();
 	}
 }
 
@@ -263,40 +165,41 @@ static const char* getStatusCodeName (xe::TestStatusCode code)
 
 static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
 {
-	vector<ShortBatchResult>	results;
-	vector<string>				batchNames;
-	bool						compareOk	= true;
+	vector<de::SharedPtr<LogFileIndexer> >	indexers;
+	vector<const xe::TestLogIndex*>			indices;
+	vector<string>							batchNames;
+	bool									compareOk	= true;
 
 	XE_CHECK(!cmdLine.filenames.empty());
 
 	try
 	{
-		// Read in batch results
-		results.resize(cmdLine.filenames.size());
+		// Index batch results
+		for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
 		{
-			std::vector<de::SharedPtr<LogFileReader> > readers;
+			indexers.push_back(de::SharedPtr<LogFileIndexer>(new LogFileIndexer(cmdLine.filenames[ndx].c_str())));
+			indexers.back()->start();
+		}
 
-			for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
-			{
-				readers.push_back(de::SharedPtr<LogFileReader>(new LogFileReader(results[ndx], cmdLine.filenames[ndx].c_str())));
-				readers.back()->start();
-			}
+		for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
+			indexers[ndx]->join();
 
-			for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
-			{
-				readers[ndx]->join();
+		for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
+		{
+			if (!indexers[ndx]->getError().empty())
+				throw xe::Error(indexers[ndx]->getError());
 
-				// Use file name as batch name.
-				batchNames.push_back(de::FilePath(cmdLine.filenames[ndx].c_str()).getBaseName());
-			}
+			indices.push_back(&indexers[ndx]->getIndex());
+
+			// Use file name as batch name.
+			batchNames.push_back(de::FilePath(cmdLine.filenames[ndx].c_str()).getBaseName());
 		}
 
 		// Compute unified case list.
-		vector<string> caseList;
-		computeCaseList(caseList, results);
+		const xe::MergedTestLogIndex mergedIndex (indices, xe::MergedTestLogIndex::FLAG_COMPLETE_ONLY);
 
 		// Stats.
-		int		numCases		= (int)caseList.size();
+		int		numCases		= mergedIndex.getNumCases();
 		int		numEqual		= 0;
 
 		if (cmdLine.outFormat == OUTPUTFORMAT_CSV)
@@ -308,13 +211,13 @@ static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
 		}
 
 		// Compare cases.
-		for (vector<string>::const_iterator caseIter = caseList.begin(); caseIter != caseList.end(); caseIter++)
+		for (int caseNdx = 0; caseNdx < numCases; caseNdx++)
 		{
-			const string&						caseName	= *caseIter;
+			const string&						caseName	= mergedIndex.getCasePath(caseNdx);
 			vector<xe::TestCaseResultHeader>	headers;
 			bool								allEqual	= true;
 
-			getTestResultHeaders(headers, results, caseName.c_str());
+			getTestResultHeaders(headers, mergedIndex, caseNdx);
 
 			for (vector<xe::TestCaseResultHeader>::const_iterator iter = headers.begin()+1; iter != headers.end(); iter++)
 			{
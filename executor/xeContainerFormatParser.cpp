@@ -38,10 +38,11 @@ static int getNextBufferSize (int curSize, int minNewSize)
 }
 
 ContainerFormatParser::ContainerFormatParser (void)
-	: m_element		(CONTAINERELEMENT_INCOMPLETE)
-	, m_elementLen	(0)
-	, m_state		(STATE_AT_LINE_START)
-	, m_buf			(CONTAINERFORMATPARSER_INITIAL_BUFFER_SIZE)
+	: m_element			(CONTAINERELEMENT_INCOMPLETE)
+	, m_elementLen		(0)
+	, m_elementOffset	(0)
+	, m_state			(STATE_AT_LINE_START)
+	, m_buf				(CONTAINERFORMATPARSER_INITIAL_BUFFER_SIZE)
 {
 }
 
@@ -53,6 +54,7 @@ void ContainerFormatParser::clear (void)
 {
 	m_element		= CONTAINERELEMENT_INCOMPLETE;
 	m_elementLen	= 0;
+	m_elementOffset	= 0;
 	m_state			= STATE_AT_LINE_START;
 	m_buf.clear();
 }
@@ -129,6 +131,7 @@ void ContainerFormatParser::advance (void)
 	if (m_element != CONTAINERELEMENT_INCOMPLETE)
 	{
 		m_buf.popBack(m_elementLen);
+		m_elementOffset += (deUint64)m_elementLen;
 
 		m_element		= CONTAINERELEMENT_INCOMPLETE;
 		m_elementLen	= 0;
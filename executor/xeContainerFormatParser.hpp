@@ -63,6 +63,9 @@ public:
 
 	ContainerElement			getElement					(void) const { return m_element; }
 
+	//! Offset of current element from beginning of fed data stream.
+	deUint64					getElementOffset			(void) const { return m_elementOffset; }
+
 	// SESSION_INFO
 	const char*					getSessionInfoAttribute		(void) const;
 	const char*					getSessionInfoValue			(void) const;
@@ -104,6 +107,7 @@ private:
 
 	ContainerElement			m_element;
 	int							m_elementLen;
+	deUint64					m_elementOffset;
 	State						m_state;
 	std::string					m_attribute;
 	std::string					m_value;
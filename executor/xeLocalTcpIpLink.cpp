@@ -46,7 +46,7 @@ LocalTcpIpLink::~LocalTcpIpLink (void)
 	stop();
 }
 
-void LocalTcpIpLink::start (const char* execServerPath, const char* workDir, int port)
+void LocalTcpIpLink::start (const char* execServerPath, const char* workDir, int port, deUint32 protocolFeatures)
 {
 	XE_CHECK(!m_process);
 
@@ -82,7 +82,7 @@ void LocalTcpIpLink::start (const char* execServerPath, const char* workDir, int
 
 			try
 			{
-				m_link.connect(address);
+				m_link.connect(address, protocolFeatures);
 				break;
 			}
 			catch (const de::SocketError&)
@@ -38,7 +38,7 @@ public:
 								~LocalTcpIpLink			(void);
 
 	// LocalTcpIpLink -specific API
-	void						start					(const char* execServerPath, const char* workDir, int port);
+	void						start					(const char* execServerPath, const char* workDir, int port, deUint32 protocolFeatures = 0);
 	void						stop					(void);
 
 	// CommLink API
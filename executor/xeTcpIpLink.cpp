@@ -72,6 +72,48 @@ static void writeStopExecution (de::BlockBuffer<deUint8>& dst)
 	dst.flush();
 }
 
+// Blocking socket IO used before send and receive threads are started. Return false if connection was closed.
+
+static bool sendBytes (de::Socket& socket, const deUint8* data, size_t numBytes)
+{
+	size_t pos = 0;
+
+	while (pos < numBytes)
+	{
+		size_t			numSent	= 0;
+		deSocketResult	result	= socket.send(data+pos, numBytes-pos, &numSent);
+
+		if (result == DE_SOCKETRESULT_CONNECTION_CLOSED || result == DE_SOCKETRESULT_CONNECTION_TERMINATED)
+			return false;
+		else if (result == DE_SOCKETRESULT_ERROR)
+			XE_FAIL("Socket error");
+
+		pos += numSent;
+	}
+
+	return true;
+}
+
+static bool receiveBytes (de::Socket& socket, deUint8* dst, size_t numBytes)
+{
+	size_t pos = 0;
+
+	while (pos < numBytes)
+	{
+		size_t			numRecv	= 0;
+		deSocketResult	result	= socket.receive(dst+pos, numBytes-pos, &numRecv);
+
+		if (result == DE_SOCKETRESULT_CONNECTION_CLOSED || result == DE_SOCKETRESULT_CONNECTION_TERMINATED)
+			return false;
+		else if (result == DE_SOCKETRESULT_ERROR)
+			XE_FAIL("Socket error");
+
+		pos += numRecv;
+	}
+
+	return true;
+}
+
 // TcpIpLinkState
 
 TcpIpLinkState::TcpIpLinkState (CommLinkState initialState, const char* initialErr)
@@ -389,6 +431,14 @@ void TcpIpRecvThread::handleMessage (xs::MessageType messageType, const deUint8*
 			break;
 		}
 
+		case xs::MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED:
+			XE_CHECK_MSG(m_state.getState() == COMMLINKSTATE_TEST_PROCESS_RUNNING, "Unexpected PROCESS_LOG_DATA_COMPRESSED message");
+			xs::CompressedProcessLogDataMessage::decompress(data, dataSize, m_decompressBuf);
+
+			if (!m_decompressBuf.empty())
+				m_state.onTestLogData(&m_decompressBuf[0], m_decompressBuf.size());
+			break;
+
 		case xs::MESSAGETYPE_PROCESS_LOG_DATA:
 		case xs::MESSAGETYPE_INFO:
 			// Ignore leading \0 if such is present. \todo [2012-06-19 pyry] Improve protocol.
@@ -455,7 +505,7 @@ void TcpIpLink::closeConnection (void)
 		m_socket.close();
 }
 
-void TcpIpLink::connect (const de::SocketAddress& address)
+void TcpIpLink::connect (const de::SocketAddress& address, deUint32 protocolFeatures)
 {
 	XE_CHECK(m_socket.getState() == DE_SOCKETSTATE_CLOSED);
 	XE_CHECK(m_state.getState() == COMMLINKSTATE_ERROR);
@@ -466,6 +516,12 @@ void TcpIpLink::connect (const de::SocketAddress& address)
 
 	try
 	{
+		// \note Servers that don't support protocol extensions close the connection, and
+		//		 may not accept another one if started with --single. Thus extensions are
+		//		 only requested if explicitly enabled.
+		if (protocolFeatures != 0)
+			negotiateFeatures(protocolFeatures);
+
 		// Clear error and set state to ready.
 		m_state.setState(COMMLINKSTATE_READY, "");
 		m_state.onKeepaliveReceived();
@@ -484,6 +540,50 @@ void TcpIpLink::connect (const de::SocketAddress& address)
 	}
 }
 
+void TcpIpLink::negotiateFeatures (deUint32 features)
+{
+	const char* const		unsupportedMsg	= "ExecServer doesn't support requested protocol features";
+	xs::HelloMessage		hello;
+	std::vector<deUint8>	buf;
+
+	DE_ASSERT((features & ~xs::PROTOCOLFEATURE_ALL) == 0);
+
+	hello.features = features;
+	hello.write(buf);
+
+	if (!sendBytes(m_socket, &buf[0], buf.size()))
+		XE_FAIL(unsupportedMsg);
+
+	// Wait for reply, skipping any keepalives.
+	for (;;)
+	{
+		xs::MessageType	type	= xs::MESSAGETYPE_NONE;
+		size_t			size	= 0;
+
+		buf.resize(xs::MESSAGE_HEADER_SIZE);
+
+		if (!receiveBytes(m_socket, &buf[0], xs::MESSAGE_HEADER_SIZE))
+			XE_FAIL(unsupportedMsg);
+
+		xs::Message::parseHeader(&buf[0], xs::MESSAGE_HEADER_SIZE, type, size);
+		XE_CHECK_MSG(size >= (size_t)xs::MESSAGE_HEADER_SIZE, "Invalid message size");
+
+		buf.resize(size);
+
+		if (size > (size_t)xs::MESSAGE_HEADER_SIZE && !receiveBytes(m_socket, &buf[xs::MESSAGE_HEADER_SIZE], size-xs::MESSAGE_HEADER_SIZE))
+			XE_FAIL(unsupportedMsg);
+
+		if (type == xs::MESSAGETYPE_HELLO)
+		{
+			const xs::HelloMessage reply(size > (size_t)xs::MESSAGE_HEADER_SIZE ? &buf[xs::MESSAGE_HEADER_SIZE] : DE_NULL, size-xs::MESSAGE_HEADER_SIZE);
+			XE_CHECK_MSG((reply.features & ~hello.features) == 0, "Server enabled unsupported protocol features");
+			return;
+		}
+		else
+			XE_CHECK_MSG(type == xs::MESSAGETYPE_KEEPALIVE, "Unexpected message during protocol negotiation");
+	}
+}
+
 void TcpIpLink::disconnect (void)
 {
 	try
@@ -111,6 +111,7 @@ private:
 
 	std::vector<deUint8>		m_curMsgBuf;
 	size_t						m_curMsgPos;
+	std::vector<deUint8>		m_decompressBuf;
 
 	bool						m_isRunning;
 };
@@ -122,7 +123,7 @@ public:
 								~TcpIpLink				(void);
 
 	// TcpIpLink -specific API
-	void						connect					(const de::SocketAddress& address);
+	void						connect					(const de::SocketAddress& address, deUint32 protocolFeatures = 0);
 	void						disconnect				(void);
 
 	// CommLink API
@@ -138,6 +139,7 @@ public:
 
 private:
 	void						closeConnection			(void);
+	void						negotiateFeatures		(deUint32 features);
 
 	static void					keepaliveTimerCallback	(void* ptr);
 
@@ -0,0 +1,490 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test log index.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeTestLogIndex.hpp"
+#include "xeContainerFormatParser.hpp"
+#include "xeTestResultParser.hpp"
+#include "deParallel.hpp"
+#include "deString.h"
+
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+
+using std::string;
+using std::vector;
+
+namespace xe
+{
+
+namespace
+{
+
+enum
+{
+	READ_BUFFER_SIZE			= 64*1024,
+	STATUS_PARSE_BATCH_SIZE		= 2*1024*1024,	//!< Bytes of case data buffered before parsing status.
+	STATUS_PARSE_MIN_CASES		= 16				//!< Minimum number of cases parsed per thread.
+};
+
+class StatusParseTask : public de::RangeTask
+{
+public:
+	StatusParseTask (vector<TestLogIndexEntry>& entries, const vector<int>& entryNdx, const vector<TestCaseResultPtr>& caseData)
+		: m_entries		(entries)
+		, m_entryNdx	(entryNdx)
+		, m_caseData	(caseData)
+	{
+	}
+
+	void execute (int begin, int end)
+	{
+		TestResultParser parser;
+
+		for (int ndx = begin; ndx < end; ndx++)
+		{
+			TestLogIndexEntry&	entry	= m_entries[m_entryNdx[ndx]];
+			TestCaseResult		result;
+
+			parseTestCaseResultFromData(&parser, &result, *m_caseData[ndx]);
+
+			entry.statusCode	= result.statusCode;
+			entry.statusDetails	= result.statusDetails;
+		}
+	}
+
+private:
+	vector<TestLogIndexEntry>&			m_entries;
+	const vector<int>&					m_entryNdx;
+	const vector<TestCaseResultPtr>&	m_caseData;
+};
+
+class IndexBuilder
+{
+public:
+	IndexBuilder (vector<SessionInfo>& sessionInfos, vector<TestLogIndexEntry>& entries, deUint32 flags)
+		: m_sessionInfos	(sessionInfos)
+		, m_entries			(entries)
+		, m_flags			(flags)
+		, m_inSession		(false)
+		, m_curEntryNdx		(-1)
+		, m_numPendingBytes	(0)
+	{
+	}
+
+	void				feed				(const deUint8* bytes, size_t numBytes);
+	void				finish				(void);
+
+private:
+	void				completeCase		(TestStatusCode containerCode, TestStatusCode statusCode, const char* statusDetails);
+	void				flushPending		(void);
+
+	vector<SessionInfo>&		m_sessionInfos;
+	vector<TestLogIndexEntry>&	m_entries;
+	const deUint32				m_flags;
+
+	ContainerFormatParser		m_parser;
+	SessionInfo					m_sessionInfo;
+	bool						m_inSession;
+
+	int							m_curEntryNdx;
+	TestCaseResultPtr			m_curCaseData;		//!< Case data buffered for status parsing.
+
+	vector<int>					m_pendingEntries;
+	vector<TestCaseResultPtr>	m_pendingCaseData;
+	size_t						m_numPendingBytes;
+};
+
+void IndexBuilder::feed (const deUint8* bytes, size_t numBytes)
+{
+	m_parser.feed(bytes, numBytes);
+
+	for (;;)
+	{
+		const ContainerElement element = m_parser.getElement();
+
+		if (element == CONTAINERELEMENT_INCOMPLETE)
+			break;
+
+		switch (element)
+		{
+			case CONTAINERELEMENT_BEGIN_SESSION:
+				if (m_inSession)
+					throw Error("Unexpected #beginSession");
+
+				m_sessionInfos.push_back(m_sessionInfo);
+				m_inSession = true;
+				break;
+
+			case CONTAINERELEMENT_END_SESSION:
+				if (!m_inSession)
+					throw Error("Unexpected #endSession");
+
+				m_inSession = false;
+				break;
+
+			case CONTAINERELEMENT_SESSION_INFO:
+			{
+				if (m_inSession)
+					throw Error("Unexpected #sessionInfo");
+
+				const char*		attribute	= m_parser.getSessionInfoAttribute();
+				const char*		value		= m_parser.getSessionInfoValue();
+
+				if (deStringEqual(attribute, "releaseName"))
+					m_sessionInfo.releaseName = value;
+				else if (deStringEqual(attribute, "releaseId"))
+					m_sessionInfo.releaseId = value;
+				else if (deStringEqual(attribute, "targetName"))
+					m_sessionInfo.targetName = value;
+				else if (deStringEqual(attribute, "candyTargetName"))
+					m_sessionInfo.candyTargetName = value;
+				else if (deStringEqual(attribute, "configName"))
+					m_sessionInfo.configName = value;
+				else if (deStringEqual(attribute, "resultName"))
+					m_sessionInfo.resultName = value;
+				else if (deStringEqual(attribute, "timestamp"))
+					m_sessionInfo.timestamp = value;
+				break;
+			}
+
+			case CONTAINERELEMENT_BEGIN_TEST_CASE_RESULT:
+			{
+				if (!m_inSession)
+					throw Error("Unexpected #beginTestCaseResult");
+
+				// \note Previous case, if any, is left incomplete.
+				m_curEntryNdx = (int)m_entries.size();
+				m_entries.push_back(TestLogIndexEntry());
+				m_entries.back().casePath = m_parser.getTestCasePath();
+
+				if (m_flags & TestLogIndex::FLAG_PARSE_STATUS)
+					m_curCaseData = TestCaseResultPtr(new TestCaseResultData(m_parser.getTestCasePath()));
+				break;
+			}
+
+			case CONTAINERELEMENT_END_TEST_CASE_RESULT:
+				if (m_curEntryNdx >= 0)
+					completeCase(TESTSTATUSCODE_LAST, TESTSTATUSCODE_LAST, "");
+				break;
+
+			case CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT:
+				if (m_curEntryNdx >= 0)
+				{
+					TestStatusCode	statusCode	= TESTSTATUSCODE_CRASH;
+					const char*		reason		= m_parser.getTerminateReason();
+
+					try
+					{
+						statusCode = getTestStatusCode(reason);
+					}
+					catch (const xe::ParseError&)
+					{
+						// Could not map status code.
+					}
+
+					completeCase(statusCode, statusCode, reason);
+				}
+				break;
+
+			case CONTAINERELEMENT_END_OF_STRING:
+				if (m_curEntryNdx >= 0)
+					completeCase(TESTSTATUSCODE_TERMINATED, TESTSTATUSCODE_TERMINATED, "Unexpected end of string");
+				break;
+
+			case CONTAINERELEMENT_TEST_LOG_DATA:
+				if (m_curEntryNdx >= 0)
+				{
+					TestLogIndexEntry&	entry			= m_entries[m_curEntryNdx];
+					const int			numDataBytes	= m_parser.getDataSize();
+
+					const deUint64		offset			= m_parser.getElementOffset();
+
+					// \note Case data is contiguous in file unless there are stray container lines within case.
+					if (!entry.dataChunks.empty() && entry.dataChunks.back().offset + entry.dataChunks.back().size == offset)
+						entry.dataChunks.back().size += (deUint64)numDataBytes;
+					else
+					{
+						const TestLogDataChunk chunk = { offset, (deUint64)numDataBytes };
+						entry.dataChunks.push_back(chunk);
+					}
+
+					entry.dataSize += (deUint64)numDataBytes;
+
+					if (m_curCaseData)
+					{
+						const int offset = m_curCaseData->getDataSize();
+
+						m_curCaseData->setDataSize(offset+numDataBytes);
+						m_parser.getData(m_curCaseData->getData()+offset, numDataBytes, 0);
+					}
+				}
+				break;
+
+			default:
+				throw ContainerParseError("Unknown container element");
+		}
+
+		m_parser.advance();
+	}
+}
+
+void IndexBuilder::completeCase (TestStatusCode containerCode, TestStatusCode statusCode, const char* statusDetails)
+{
+	TestLogIndexEntry& entry = m_entries[m_curEntryNdx];
+
+	entry.containerCode = containerCode;
+
+	if (m_flags & TestLogIndex::FLAG_PARSE_STATUS)
+	{
+		if (statusCode == TESTSTATUSCODE_LAST)
+		{
+			// Status must be parsed from case data.
+			m_pendingEntries.push_back(m_curEntryNdx);
+			m_pendingCaseData.push_back(m_curCaseData);
+			m_numPendingBytes += (size_t)m_curCaseData->getDataSize();
+
+			if (m_numPendingBytes >= (size_t)STATUS_PARSE_BATCH_SIZE)
+				flushPending();
+		}
+		else
+		{
+			entry.statusCode	= statusCode;
+			entry.statusDetails	= statusDetails;
+		}
+	}
+
+	m_curEntryNdx = -1;
+	m_curCaseData.clear();
+}
+
+void IndexBuilder::flushPending (void)
+{
+	StatusParseTask task(m_entries, m_pendingEntries, m_pendingCaseData);
+
+	de::parallelFor((int)m_pendingEntries.size(), STATUS_PARSE_MIN_CASES, task);
+
+	m_pendingEntries.clear();
+	m_pendingCaseData.clear();
+	m_numPendingBytes = 0;
+}
+
+void IndexBuilder::finish (void)
+{
+	flushPending();
+	m_curEntryNdx = -1;
+	m_curCaseData.clear();
+}
+
+struct EntryPathLess
+{
+	EntryPathLess (const vector<TestLogIndexEntry>& entries) : m_entries(&entries) {}
+
+	bool operator() (int a, int b) const
+	{
+		return (*m_entries)[a].casePath < (*m_entries)[b].casePath;
+	}
+
+	const vector<TestLogIndexEntry>* m_entries;
+};
+
+//! Range of entries with same case path in sorted entry list.
+struct PathRun
+{
+	int		firstEntryNdx;		//!< First entry in log order.
+	int		lastEntryNdx;		//!< Last entry in log order.
+};
+
+static void computePathRuns (vector<PathRun>& dst, const TestLogIndex& index, bool completeOnly)
+{
+	const vector<int>&	sorted	= index.getSortedEntries();
+	const string*		curPath	= DE_NULL;
+
+	for (vector<int>::const_iterator iter = sorted.begin(); iter != sorted.end(); ++iter)
+	{
+		const TestLogIndexEntry& entry = index.getEntry(*iter);
+
+		if (completeOnly && !entry.isComplete())
+			continue;
+
+		if (curPath && *curPath == entry.casePath)
+			dst.back().lastEntryNdx = *iter;
+		else
+		{
+			const PathRun run = { *iter, *iter };
+			dst.push_back(run);
+			curPath = &entry.casePath;
+		}
+	}
+}
+
+} // anonymous
+
+// TestLogIndex
+
+TestLogIndex::TestLogIndex (void)
+{
+}
+
+TestLogIndex::~TestLogIndex (void)
+{
+}
+
+void TestLogIndex::clear (void)
+{
+	m_sessionInfos.clear();
+	m_entries.clear();
+	m_sortedEntries.clear();
+}
+
+void TestLogIndex::build (const char* filename, deUint32 flags)
+{
+	std::ifstream		in		(filename, std::ifstream::binary|std::ifstream::in);
+	vector<deUint8>		buf		(READ_BUFFER_SIZE);
+
+	if (!in.good())
+		throw std::runtime_error(string("Failed to open '") + filename + "'");
+
+	clear();
+
+	{
+		IndexBuilder builder(m_sessionInfos, m_entries, flags);
+
+		for (;;)
+		{
+			in.read((char*)&buf[0], (std::streamsize)buf.size());
+
+			const size_t numRead = (size_t)in.gcount();
+
+			if (numRead == 0)
+				break;
+
+			builder.feed(&buf[0], numRead);
+		}
+
+		builder.finish();
+	}
+
+	m_sortedEntries.resize(m_entries.size());
+	for (int ndx = 0; ndx < (int)m_entries.size(); ndx++)
+		m_sortedEntries[ndx] = ndx;
+
+	std::stable_sort(m_sortedEntries.begin(), m_sortedEntries.end(), EntryPathLess(m_entries));
+}
+
+// MergedTestLogIndex
+
+MergedTestLogIndex::MergedTestLogIndex (const vector<const TestLogIndex*>& indices, deUint32 flags)
+	: m_indices		(indices)
+	, m_numCases	(0)
+{
+	const int							numLogs		= (int)indices.size();
+	vector<vector<PathRun> >			runs		(numLogs);
+	vector<size_t>						cursors		(numLogs, 0);
+	vector<int>							mergedRows;
+	vector<std::pair<deUint64, int> >	order;		//!< First appearance key and row index.
+
+	for (int logNdx = 0; logNdx < numLogs; logNdx++)
+		computePathRuns(runs[logNdx], *indices[logNdx], (flags & FLAG_COMPLETE_ONLY) != 0);
+
+	// Stream through sorted runs, emitting one row per unique path.
+	for (;;)
+	{
+		const string*	minPath		= DE_NULL;
+		int				firstLogNdx	= -1;
+
+		for (int logNdx = 0; logNdx < numLogs; logNdx++)
+		{
+			if (cursors[logNdx] < runs[logNdx].size())
+			{
+				const string& path = indices[logNdx]->getEntry(runs[logNdx][cursors[logNdx]].firstEntryNdx).casePath;
+
+				if (!minPath || path < *minPath)
+				{
+					minPath		= &path;
+					firstLogNdx	= logNdx;
+				}
+			}
+		}
+
+		if (!minPath)
+			break;
+
+		{
+			const int		rowNdx		= m_numCases++;
+			const string	path		= *minPath;
+			const deUint64	orderKey	= ((deUint64)firstLogNdx << 32) | (deUint64)runs[firstLogNdx][cursors[firstLogNdx]].firstEntryNdx;
+
+			for (int logNdx = 0; logNdx < numLogs; logNdx++)
+			{
+				if (cursors[logNdx] < runs[logNdx].size() &&
+					indices[logNdx]->getEntry(runs[logNdx][cursors[logNdx]].firstEntryNdx).casePath == path)
+				{
+					mergedRows.push_back(runs[logNdx][cursors[logNdx]].lastEntryNdx);
+					cursors[logNdx] += 1;
+				}
+				else
+					mergedRows.push_back(-1);
+			}
+
+			order.push_back(std::make_pair(orderKey, rowNdx));
+		}
+	}
+
+	// Reorder by first appearance.
+	std::sort(order.begin(), order.end());
+
+	m_caseEntries.resize(mergedRows.size());
+
+	for (int caseNdx = 0; caseNdx < m_numCases; caseNdx++)
+	{
+		const int srcRowNdx = order[caseNdx].second;
+
+		for (int logNdx = 0; logNdx < numLogs; logNdx++)
+			m_caseEntries[caseNdx*numLogs + logNdx] = mergedRows[srcRowNdx*numLogs + logNdx];
+	}
+}
+
+MergedTestLogIndex::~MergedTestLogIndex (void)
+{
+}
+
+const TestLogIndexEntry* MergedTestLogIndex::getEntry (int caseNdx, int logNdx) const
+{
+	const int entryNdx = getEntryNdx(caseNdx, logNdx);
+	return entryNdx >= 0 ? &m_indices[logNdx]->getEntry(entryNdx) : DE_NULL;
+}
+
+const string& MergedTestLogIndex::getCasePath (int caseNdx) const
+{
+	for (int logNdx = 0; logNdx < getNumLogs(); logNdx++)
+	{
+		if (const TestLogIndexEntry* entry = getEntry(caseNdx, logNdx))
+			return entry->casePath;
+	}
+
+	DE_ASSERT(false);
+	throw std::logic_error("Case without entries");
+}
+
+} // xe
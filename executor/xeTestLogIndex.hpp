@@ -0,0 +1,152 @@
+#ifndef _XETESTLOGINDEX_HPP
+#define _XETESTLOGINDEX_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test log index.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeTestCaseResult.hpp"
+#include "xeBatchResult.hpp"
+
+#include <string>
+#include <vector>
+
+namespace xe
+{
+
+//! Contiguous range of case data in log file.
+struct TestLogDataChunk
+{
+	deUint64			offset;
+	deUint64			size;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Test case result location and status in log file
+ *
+ * Case data is usually stored in a single chunk, but container lines
+ * interleaved with the case data split it into multiple chunks.
+ *
+ * containerCode is the status given by the container format:
+ * TESTSTATUSCODE_LAST for #endTestCaseResult, code from
+ * #terminateTestCaseResult, or TESTSTATUSCODE_RUNNING if the case never
+ * completed. statusCode and statusDetails are filled only if index was
+ * built with TestLogIndex::FLAG_PARSE_STATUS.
+ *//*--------------------------------------------------------------------*/
+struct TestLogIndexEntry
+{
+	std::string			casePath;
+	std::vector<TestLogDataChunk>	dataChunks;		//!< Case data chunks in log order.
+	deUint64			dataSize;			//!< Total size of case data in bytes.
+	TestStatusCode		containerCode;
+	TestStatusCode		statusCode;
+	std::string			statusDetails;
+
+	TestLogIndexEntry (void)
+		: dataSize		(0)
+		, containerCode	(TESTSTATUSCODE_RUNNING)
+		, statusCode	(TESTSTATUSCODE_LAST)
+	{
+	}
+
+	bool				isComplete			(void) const { return containerCode != TESTSTATUSCODE_RUNNING; }
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Index of test case results in log file
+ *
+ * Index is built with a single streaming pass over the log. Case data
+ * is not kept in memory, but can be read back using the recorded
+ * offsets. If status is requested, case XML is parsed in batches on
+ * multiple threads while the log is being read.
+ *//*--------------------------------------------------------------------*/
+class TestLogIndex
+{
+public:
+	enum Flags
+	{
+		FLAG_PARSE_STATUS	= (1<<0)	//!< Parse final status code and details for each case.
+	};
+
+										TestLogIndex		(void);
+										~TestLogIndex		(void);
+
+	void								build				(const char* filename, deUint32 flags);
+	void								clear				(void);
+
+	const std::vector<SessionInfo>&		getSessionInfos		(void) const	{ return m_sessionInfos;		}
+
+	int									getNumEntries		(void) const	{ return (int)m_entries.size();	}
+	const TestLogIndexEntry&			getEntry			(int ndx) const	{ return m_entries[ndx];		}
+
+	//! Entry indices sorted by case path. Entries with equal path are in log order.
+	const std::vector<int>&				getSortedEntries	(void) const	{ return m_sortedEntries;		}
+
+private:
+										TestLogIndex		(const TestLogIndex& other);
+	TestLogIndex&						operator=			(const TestLogIndex& other);
+
+	std::vector<SessionInfo>			m_sessionInfos;
+	std::vector<TestLogIndexEntry>		m_entries;
+	std::vector<int>					m_sortedEntries;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Case list merged from multiple log indices
+ *
+ * Cases are ordered by first appearance: all cases from first log in
+ * log order, followed by new cases from second log and so on. For each
+ * log the last entry with the case path is selected. Merge is computed
+ * by streaming through sorted entry runs of all indices at once.
+ *//*--------------------------------------------------------------------*/
+class MergedTestLogIndex
+{
+public:
+	enum Flags
+	{
+		FLAG_COMPLETE_ONLY	= (1<<0)	//!< Ignore entries for cases that never completed.
+	};
+
+										MergedTestLogIndex	(const std::vector<const TestLogIndex*>& indices, deUint32 flags);
+										~MergedTestLogIndex	(void);
+
+	int									getNumLogs			(void) const	{ return (int)m_indices.size();	}
+	int									getNumCases			(void) const	{ return m_numCases;			}
+
+	const std::string&					getCasePath			(int caseNdx) const;
+
+	//! Entry index in given log or -1 if case is missing from the log.
+	int									getEntryNdx			(int caseNdx, int logNdx) const	{ return m_caseEntries[caseNdx*getNumLogs() + logNdx];	}
+	const TestLogIndexEntry*			getEntry			(int caseNdx, int logNdx) const;
+
+private:
+										MergedTestLogIndex	(const MergedTestLogIndex& other);
+	MergedTestLogIndex&					operator=			(const MergedTestLogIndex& other);
+
+	std::vector<const TestLogIndex*>	m_indices;
+	int									m_numCases;
+	std::vector<int>					m_caseEntries;		//!< getNumLogs() entry indices per case.
+};
+
+} // xe
+
+#endif // _XETESTLOGINDEX_HPP
@@ -61,7 +61,7 @@ std::ostream& operator<< (std::ostream& stream, const ContainerValue& value)
 	return stream;
 }
 
-static void writeSessionInfo (const SessionInfo& info, std::ostream& stream)
+void writeSessionInfo (const SessionInfo& info, std::ostream& stream)
 {
 	if (!info.releaseName.empty())
 		stream << "#sessionInfo releaseName " << ContainerValue(info.releaseName) << "\n";
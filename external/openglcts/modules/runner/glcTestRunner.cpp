@@ -24,7 +24,10 @@
 
 #include "glcTestRunner.hpp"
 #include "deFilePath.hpp"
+#include "deProcess.h"
 #include "deStringUtil.hpp"
+#include "deThread.h"
+#include "deThread.hpp"
 #include "deUniquePtr.hpp"
 #include "glcConfigList.hpp"
 #include "qpXmlWriter.h"
@@ -69,6 +72,152 @@ private:
 	tcu::App		 m_app;
 };
 
+// \note NotSupported is treated as pass.
+static bool isSessionOk(const tcu::TestRunStatus& result)
+{
+	DE_ASSERT(result.numExecuted == result.numPassed + result.numFailed + result.numNotSupported + result.numWarnings);
+
+	return result.numExecuted == (result.numPassed + result.numNotSupported + result.numWarnings) && result.isComplete;
+}
+
+bool executeSession(tcu::Platform& platform, tcu::Archive& archive, const std::vector<std::string>& args)
+{
+	vector<const char*> argv;
+	argv.push_back("cts-runner"); // Dummy binary name
+	for (vector<string>::const_iterator i = args.begin(); i != args.end(); i++)
+		argv.push_back(i->c_str());
+
+	RunSession session(platform, archive, (int)argv.size(), &argv[0]);
+
+	while (session.iterate())
+		;
+
+	return isSessionOk(session.getResult());
+}
+
+// SessionProcess
+
+class OutputReader : public de::Thread
+{
+public:
+	OutputReader(deFile* src, FILE* dst) : m_src(src), m_dst(dst)
+	{
+	}
+
+	void run(void)
+	{
+		deUint8 buf[4096];
+		deInt64 numRead = 0;
+
+		while (deFile_read(m_src, &buf[0], (deInt64)sizeof(buf), &numRead) == DE_FILERESULT_SUCCESS)
+		{
+			if (m_dst)
+				fwrite(&buf[0], 1, (size_t)numRead, m_dst);
+		}
+	}
+
+private:
+	deFile* m_src;
+	FILE*   m_dst;
+};
+
+// Child process running a single session. Console output is captured into a file.
+class SessionProcess
+{
+public:
+	SessionProcess(const string& commandLine, const string& consoleLogPath)
+		: m_process(deProcess_create())
+		, m_consoleLog(DE_NULL)
+		, m_stdOutReader(DE_NULL)
+		, m_stdErrReader(DE_NULL)
+	{
+		if (!m_process)
+			throw std::bad_alloc();
+
+		if (!deProcess_start(m_process, commandLine.c_str(), DE_NULL))
+		{
+			const string error = deProcess_getLastError(m_process);
+			deProcess_destroy(m_process);
+			throw tcu::Exception("Failed to launch session process: " + error);
+		}
+
+		// \note Output is drained even if console log can't be created, otherwise child would block.
+		m_consoleLog = fopen(consoleLogPath.c_str(), "wb");
+
+		m_stdOutReader = new OutputReader(deProcess_getStdOut(m_process), m_consoleLog);
+		m_stdErrReader = new OutputReader(deProcess_getStdErr(m_process), m_consoleLog);
+
+		deProcess_closeStdIn(m_process);
+
+		m_stdOutReader->start();
+		m_stdErrReader->start();
+	}
+
+	~SessionProcess(void)
+	{
+		if (deProcess_isRunning(m_process))
+		{
+			deProcess_kill(m_process);
+			deProcess_waitForFinish(m_process);
+		}
+
+		m_stdOutReader->join();
+		m_stdErrReader->join();
+
+		delete m_stdOutReader;
+		delete m_stdErrReader;
+
+		if (m_consoleLog)
+			fclose(m_consoleLog);
+
+		deProcess_destroy(m_process);
+	}
+
+	inline bool isRunning(void)
+	{
+		return deProcess_isRunning(m_process) == DE_TRUE;
+	}
+
+	inline int getExitCode(void) const
+	{
+		return deProcess_getExitCode(m_process);
+	}
+
+private:
+	SessionProcess(const SessionProcess& other);
+	SessionProcess& operator=(const SessionProcess& other);
+
+	deProcess*	m_process;
+	FILE*		  m_consoleLog;
+	OutputReader* m_stdOutReader;
+	OutputReader* m_stdErrReader;
+};
+
+static string quoteArg(const string& arg)
+{
+	string res = "\"";
+
+	for (string::const_iterator i = arg.begin(); i != arg.end(); ++i)
+	{
+#if (DE_OS == DE_OS_WIN32)
+		if (*i == '"')
+			res += '\\';
+#else
+		if (*i == '"' || *i == '\\')
+			res += '\\';
+#endif
+		res += *i;
+	}
+
+	return res + "\"";
+}
+
+static string getConsoleLogFileName(const string& logFilename)
+{
+	const size_t extPos = logFilename.rfind('.');
+	return (extPos != string::npos ? logFilename.substr(0, extPos) : logFilename) + "-console.txt";
+}
+
 static void appendConfigArgs(const Config& config, std::vector<std::string>& args, const char* fboConfig)
 {
 	if (fboConfig != NULL)
@@ -572,8 +721,11 @@ TestRunner::TestRunner(tcu::Platform& platform, tcu::Archive& archive, const cha
 	, m_logDirPath(logDirPath)
 	, m_type(type)
 	, m_flags(flags)
+	, m_numProcesses(0)
 	, m_iterState(ITERATE_INIT)
 	, m_curSession(DE_NULL)
+	, m_nextSessionNdx(0)
+	, m_nextResultNdx(0)
 	, m_sessionsExecuted(0)
 	, m_sessionsPassed(0)
 	, m_sessionsFailed(0)
@@ -583,6 +735,18 @@ TestRunner::TestRunner(tcu::Platform& platform, tcu::Archive& archive, const cha
 TestRunner::~TestRunner(void)
 {
 	delete m_curSession;
+
+	for (vector<ActiveProcess>::iterator procIter = m_activeProcesses.begin(); procIter != m_activeProcesses.end();
+		 ++procIter)
+		delete procIter->process;
+}
+
+void TestRunner::setParallelExecution(const char* executablePath, int numProcesses)
+{
+	DE_ASSERT(m_iterState == ITERATE_INIT);
+
+	m_executablePath = executablePath;
+	m_numProcesses   = numProcesses;
 }
 
 bool TestRunner::iterate(void)
@@ -591,7 +755,12 @@ bool TestRunner::iterate(void)
 	{
 	case ITERATE_INIT:
 		init();
-		m_iterState = (m_sessionIter != m_runSessions.end()) ? ITERATE_INIT_SESSION : ITERATE_DEINIT;
+		if (m_sessionIter == m_runSessions.end())
+			m_iterState = ITERATE_DEINIT;
+		else if (m_numProcesses > 0 && !(m_flags & PRINT_SUMMARY))
+			m_iterState = ITERATE_PARALLEL_SESSIONS;
+		else
+			m_iterState = ITERATE_INIT_SESSION;
 		return true;
 
 	case ITERATE_DEINIT:
@@ -619,6 +788,11 @@ bool TestRunner::iterate(void)
 			m_iterState = ITERATE_DEINIT_SESSION;
 		return true;
 
+	case ITERATE_PARALLEL_SESSIONS:
+		if (!iterateParallelSessions())
+			m_iterState = ITERATE_DEINIT;
+		return true;
+
 	default:
 		DE_ASSERT(false);
 		return false;
@@ -661,7 +835,10 @@ void TestRunner::init(void)
 		m_summary.runParams.push_back(*runIter);
 
 	// Session iterator
-	m_sessionIter = m_runSessions.begin();
+	m_sessionIter	= m_runSessions.begin();
+	m_nextSessionNdx = 0;
+	m_nextResultNdx  = 0;
+	m_sessionResults.assign(m_runSessions.size(), SESSIONRESULT_PENDING);
 }
 
 void TestRunner::deinit(void)
@@ -681,13 +858,8 @@ void TestRunner::deinit(void)
 	m_summary.clear();
 }
 
-void TestRunner::initSession(const TestRunParams& runParams)
+vector<string> TestRunner::getSessionArgs(const TestRunParams& runParams) const
 {
-	DE_ASSERT(!m_curSession);
-
-	tcu::print("\n  Test run %d / %d\n", (int)(m_sessionIter - m_runSessions.begin() + 1), (int)m_runSessions.size());
-
-	// Compute final args for run.
 	vector<string> args(runParams.args);
 	args.push_back(string("--deqp-log-filename=") + de::FilePath::join(m_logDirPath, runParams.logFilename).getPath());
 
@@ -697,6 +869,24 @@ void TestRunner::initSession(const TestRunParams& runParams)
 	if (!(m_flags & VERBOSE_SHADERS))
 		args.push_back("--deqp-log-shader-sources=disable");
 
+	return args;
+}
+
+void TestRunner::recordSessionResult(bool isOk)
+{
+	m_sessionsExecuted += 1;
+	(isOk ? m_sessionsPassed : m_sessionsFailed) += 1;
+}
+
+void TestRunner::initSession(const TestRunParams& runParams)
+{
+	DE_ASSERT(!m_curSession);
+
+	tcu::print("\n  Test run %d / %d\n", (int)(m_sessionIter - m_runSessions.begin() + 1), (int)m_runSessions.size());
+
+	// Compute final args for run.
+	const vector<string> args = getSessionArgs(runParams);
+
 	std::ostringstream			  ostr;
 	std::ostream_iterator<string> out_it(ostr, ", ");
 	std::copy(args.begin(), args.end(), out_it);
@@ -717,15 +907,7 @@ void TestRunner::deinitSession(void)
 	DE_ASSERT(m_curSession);
 
 	// Collect results.
-	// \note NotSupported is treated as pass.
-	const tcu::TestRunStatus& result = m_curSession->getResult();
-	bool					  isOk =
-		result.numExecuted == (result.numPassed + result.numNotSupported + result.numWarnings) && result.isComplete;
-
-	DE_ASSERT(result.numExecuted == result.numPassed + result.numFailed + result.numNotSupported + result.numWarnings);
-
-	m_sessionsExecuted += 1;
-	(isOk ? m_sessionsPassed : m_sessionsFailed) += 1;
+	recordSessionResult(isSessionOk(m_curSession->getResult()));
 
 	delete m_curSession;
 	m_curSession = DE_NULL;
@@ -736,4 +918,77 @@ inline bool TestRunner::iterateSession(void)
 	return m_curSession->iterate();
 }
 
+void TestRunner::launchSessionProcess(int sessionNdx)
+{
+	const TestRunParams& runParams = m_runSessions[sessionNdx];
+	const vector<string> args	  = getSessionArgs(runParams);
+	string				 cmdLine   = quoteArg(m_executablePath) + " --run-session";
+
+	for (vector<string>::const_iterator argIter = args.begin(); argIter != args.end(); ++argIter)
+		cmdLine += " " + quoteArg(*argIter);
+
+	tcu::print("  Test run %d / %d started: %s\n", sessionNdx + 1, (int)m_runSessions.size(),
+			   runParams.logFilename.c_str());
+
+	ActiveProcess active;
+	active.sessionNdx = sessionNdx;
+	active.process	= new SessionProcess(
+		cmdLine, de::FilePath::join(m_logDirPath, getConsoleLogFileName(runParams.logFilename)).getPath());
+
+	m_activeProcesses.push_back(active);
+}
+
+bool TestRunner::iterateParallelSessions(void)
+{
+	bool gotStateChange = false;
+
+	// Collect finished sessions. Child exits with 0 only if its session passed.
+	for (vector<ActiveProcess>::iterator procIter = m_activeProcesses.begin(); procIter != m_activeProcesses.end();)
+	{
+		if (procIter->process->isRunning())
+		{
+			++procIter;
+			continue;
+		}
+
+		const int  exitCode = procIter->process->getExitCode();
+		const bool isOk		= exitCode == 0;
+
+		tcu::print("  Test run %d / %d finished: %s (exit code %d)\n", procIter->sessionNdx + 1,
+				   (int)m_runSessions.size(), isOk ? "PASSED" : "FAILED", exitCode);
+
+		m_sessionResults[procIter->sessionNdx] = isOk ? SESSIONRESULT_PASSED : SESSIONRESULT_FAILED;
+
+		delete procIter->process;
+		procIter	   = m_activeProcesses.erase(procIter);
+		gotStateChange = true;
+	}
+
+	// Record results in session order.
+	while (m_nextResultNdx < (int)m_sessionResults.size() && m_sessionResults[m_nextResultNdx] != SESSIONRESULT_PENDING)
+	{
+		recordSessionResult(m_sessionResults[m_nextResultNdx] == SESSIONRESULT_PASSED);
+		m_nextResultNdx += 1;
+	}
+
+	// Launch new sessions up to concurrency limit.
+	while ((int)m_activeProcesses.size() < m_numProcesses && m_nextSessionNdx < (int)m_runSessions.size())
+	{
+		launchSessionProcess(m_nextSessionNdx++);
+		gotStateChange = true;
+	}
+
+	if (m_activeProcesses.empty())
+	{
+		DE_ASSERT(m_nextSessionNdx == (int)m_runSessions.size());
+		DE_ASSERT(m_nextResultNdx == (int)m_runSessions.size());
+		return false;
+	}
+
+	if (!gotStateChange)
+		deSleep(10);
+
+	return true;
+}
+
 } // glcts
@@ -70,6 +70,10 @@ struct TestRunSummary
 };
 
 class RunSession;
+class SessionProcess;
+
+// Execute single session in current process. Used by child processes in parallel run mode.
+bool executeSession(tcu::Platform& platform, tcu::Archive& archive, const std::vector<std::string>& args);
 
 class TestRunner
 {
@@ -89,6 +93,10 @@ public:
 			   deUint32 flags);
 	~TestRunner(void);
 
+	// Run sessions in child processes launched from executablePath with --run-session.
+	// \note executablePath is not searched from PATH.
+	void setParallelExecution(const char* executablePath, int numProcesses);
+
 	bool iterate(void);
 
 private:
@@ -102,6 +110,12 @@ private:
 	void deinitSession(void);
 	bool iterateSession(void);
 
+	std::vector<std::string> getSessionArgs(const TestRunParams& runParams) const;
+	void recordSessionResult(bool isOk);
+
+	void launchSessionProcess(int sessionNdx);
+	bool iterateParallelSessions(void);
+
 	enum IterateState
 	{
 		ITERATE_INIT = 0, //!< Call init() on this iteration.
@@ -111,6 +125,8 @@ private:
 		ITERATE_DEINIT_SESSION,  //!< Deinit session and move to next.
 		ITERATE_ITERATE_SESSION, //!< Iterate current session.
 
+		ITERATE_PARALLEL_SESSIONS, //!< Launch and wait for session processes.
+
 		ITERATESTATE_LAST
 	};
 
@@ -119,6 +135,8 @@ private:
 	std::string	m_logDirPath;
 	glu::ApiType   m_type;
 	deUint32	   m_flags;
+	std::string	m_executablePath;
+	int			   m_numProcesses;
 
 	// Iteration state.
 	IterateState							   m_iterState;
@@ -126,6 +144,25 @@ private:
 	std::vector<TestRunParams>::const_iterator m_sessionIter;
 	RunSession*								   m_curSession;
 
+	// Parallel execution state.
+	struct ActiveProcess
+	{
+		int				sessionNdx;
+		SessionProcess* process;
+	};
+
+	enum SessionResult
+	{
+		SESSIONRESULT_PENDING = 0,
+		SESSIONRESULT_PASSED,
+		SESSIONRESULT_FAILED
+	};
+
+	int						   m_nextSessionNdx;
+	int						   m_nextResultNdx;
+	std::vector<ActiveProcess> m_activeProcesses;
+	std::vector<SessionResult> m_sessionResults;
+
 	// Totals / stats.
 	int			   m_sessionsExecuted;
 	int			   m_sessionsPassed;
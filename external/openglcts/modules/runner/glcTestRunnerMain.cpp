@@ -22,26 +22,39 @@
  * \brief CTS runner main().
  */ /*-------------------------------------------------------------------*/
 
+#include "deFilePath.hpp"
 #include "deString.h"
 #include "deUniquePtr.hpp"
 #include "glcTestRunner.hpp"
 #include "tcuPlatform.hpp"
 #include "tcuResource.hpp"
 
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_OSX)
+#include <unistd.h>
+#endif
 
 // See tcuMain.cpp
 tcu::Platform* createPlatform(void);
 
 struct CommandLine
 {
-	CommandLine(void) : runType(glu::ApiType::es(2, 0)), flags(0)
+	CommandLine(void) : runType(glu::ApiType::es(2, 0)), flags(0), numJobs(0), runSession(false)
 	{
 	}
 
-	glu::ApiType runType;
-	std::string  dstLogDir;
-	deUint32	 flags;
+	glu::ApiType			 runType;
+	std::string				 dstLogDir;
+	deUint32				 flags;
+	int						 numJobs;
+	bool					 runSession;
+	std::vector<std::string> sessionArgs;
 };
 
 static bool parseCommandLine(CommandLine& cmdLine, int argc, const char* const* argv)
@@ -90,6 +103,22 @@ static bool parseCommandLine(CommandLine& cmdLine, int argc, const char* const*
 		}
 		else if (deStringEqual(arg, "--verbose"))
 			cmdLine.flags = glcts::TestRunner::VERBOSE_ALL;
+		else if (deStringBeginsWith(arg, "--jobs="))
+		{
+			const int value = atoi(arg + 7);
+
+			if (value < 1)
+				return false;
+
+			cmdLine.numJobs = value;
+		}
+		else if (deStringEqual(arg, "--run-session"))
+		{
+			// Internal: remaining arguments are passed to a single session executed in this process.
+			cmdLine.runSession = true;
+			cmdLine.sessionArgs.assign(argv + argNdx + 1, argv + argc);
+			break;
+		}
 		else
 			return false;
 	}
@@ -97,6 +126,42 @@ static bool parseCommandLine(CommandLine& cmdLine, int argc, const char* const*
 	return true;
 }
 
+// deProcess_start() doesn't search PATH, so binary path must be resolved before re-executing it.
+static std::string getExecutablePath(const char* argv0)
+{
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)
+	{
+		char		  buf[4096];
+		const ssize_t len = readlink("/proc/self/exe", buf, sizeof(buf) - 1);
+
+		if (len > 0)
+			return std::string(buf, (size_t)len);
+	}
+#endif
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_OSX)
+	if (!strchr(argv0, '/') && getenv("PATH"))
+	{
+		const std::string path = getenv("PATH");
+		size_t			  begin = 0;
+
+		while (begin <= path.size())
+		{
+			const size_t	  end		= std::min(path.find(':', begin), path.size());
+			const std::string dir		= path.substr(begin, end - begin);
+			const std::string candidate = de::FilePath::join(dir.empty() ? "." : dir, argv0).getPath();
+
+			if (access(candidate.c_str(), X_OK) == 0)
+				return candidate;
+
+			begin = end + 1;
+		}
+	}
+#endif
+
+	return argv0;
+}
+
 static void printHelp(const char* binName)
 {
 	printf("%s:\n", binName);
@@ -106,6 +171,7 @@ static void printHelp(const char* binName)
 	printf("  --logdir=[path]      Destination directory for log files\n");
 	printf("  --summary            Print summary without running the tests\n");
 	printf("  --verbose            Print out and log more information\n");
+	printf("  --jobs=[N]           Run N sessions in parallel in separate processes\n");
 }
 
 int main(int argc, char** argv)
@@ -122,9 +188,16 @@ int main(int argc, char** argv)
 	{
 		de::UniquePtr<tcu::Platform> platform(createPlatform());
 		tcu::DirArchive				 archive(".");
+
+		if (cmdLine.runSession)
+			return glcts::executeSession(*platform, archive, cmdLine.sessionArgs) ? 0 : 1;
+
 		glcts::TestRunner runner(static_cast<tcu::Platform&>(*platform.get()), archive, cmdLine.dstLogDir.c_str(),
 								 cmdLine.runType, cmdLine.flags);
 
+		if (cmdLine.numJobs > 0)
+			runner.setParallelExecution(getExecutablePath(argv[0]).c_str(), cmdLine.numJobs);
+
 		for (;;)
 		{
 			if (!runner.iterate())
@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "vkGlslToSpirV.hpp"
+#include "tcuInstrumentation.hpp"
 #include "deArrayUtil.hpp"
 #include "deSingleton.h"
 #include "deMemory.h"
@@ -232,9 +233,10 @@ bool compileGlslToSpirV (const glu::ProgramSources& program, std::vector<deUint3
 			program.addShader(&shader);
 
 			{
-				const deUint64	compileStartTime	= deGetMicroseconds();
-				const int		compileRes			= shader.parse(&builtinRes, 110, false, (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules));
-				glu::ShaderInfo	shaderBuildInfo;
+				const tcu::InstrumentationScope	scope				("vk::compileGlslToSpirV parse");
+				const deUint64					compileStartTime	= deGetMicroseconds();
+				const int						compileRes			= shader.parse(&builtinRes, 110, false, (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules));
+				glu::ShaderInfo					shaderBuildInfo;
 
 				shaderBuildInfo.type			= (glu::ShaderType)shaderType;
 				shaderBuildInfo.source			= srcText;
@@ -248,8 +250,9 @@ bool compileGlslToSpirV (const glu::ProgramSources& program, std::vector<deUint3
 			DE_ASSERT(buildInfo->shaders.size() == 1);
 			if (buildInfo->shaders[0].compileOk)
 			{
-				const deUint64	linkStartTime	= deGetMicroseconds();
-				const int		linkRes			= program.link((EShMessages)(EShMsgSpvRules | EShMsgVulkanRules));
+				const tcu::InstrumentationScope	scope			("vk::compileGlslToSpirV link");
+				const deUint64					linkStartTime	= deGetMicroseconds();
+				const int						linkRes			= program.link((EShMessages)(EShMsgSpvRules | EShMsgVulkanRules));
 
 				buildInfo->program.infoLog		= program.getInfoLog(); // \todo [2015-11-05 scygan] Include debug log?
 				buildInfo->program.linkOk		= (linkRes != 0);
@@ -258,6 +261,7 @@ bool compileGlslToSpirV (const glu::ProgramSources& program, std::vector<deUint3
 
 			if (buildInfo->program.linkOk)
 			{
+				const tcu::InstrumentationScope		scope			("vk::compileGlslToSpirV generate");
 				const glslang::TIntermediate* const	intermediate	= program.getIntermediate(shaderStage);
 				glslang::GlslangToSpv(*intermediate, *dst);
 			}
@@ -0,0 +1,304 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Background GLSL to SPIR-V compilation with result cache.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkProgramCompileService.hpp"
+#include "tcuInstrumentation.hpp"
+#include "deSha1.hpp"
+
+#include <stdexcept>
+
+namespace vk
+{
+
+using std::string;
+
+namespace
+{
+
+size_t getShaderInfoSize (const glu::ShaderProgramInfo& info)
+{
+	size_t size = info.program.infoLog.size();
+
+	for (size_t shaderNdx = 0; shaderNdx < info.shaders.size(); shaderNdx++)
+		size += info.shaders[shaderNdx].source.size() + info.shaders[shaderNdx].infoLog.size();
+
+	return size;
+}
+
+ProgramBinary* copyProgramBinary (const ProgramBinary& binary)
+{
+	return new ProgramBinary(binary.getFormat(), binary.getSize(), binary.getBinary());
+}
+
+} // anonymous
+
+ProgramCompileService::ProgramCompileService (int numThreads, size_t maxCacheSize)
+	: m_maxCacheSize		(maxCacheSize)
+	, m_queueSem			(0)
+	, m_completedSem		(0)
+	, m_isShutdown			(false)
+	, m_cacheSize			(0)
+	, m_isCompileSupported	(true)
+	, m_numCacheHits		(0)
+{
+	for (int threadNdx = 0; threadNdx < numThreads; threadNdx++)
+	{
+		m_threads.push_back(WorkerThreadSp(new WorkerThread(*this)));
+		m_threads.back()->start();
+	}
+}
+
+ProgramCompileService::~ProgramCompileService (void)
+{
+	{
+		const de::ScopedLock lock (m_lock);
+		m_isShutdown = true;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < m_threads.size(); threadNdx++)
+		m_queueSem.increment();
+
+	for (size_t threadNdx = 0; threadNdx < m_threads.size(); threadNdx++)
+		m_threads[threadNdx]->join();
+}
+
+string ProgramCompileService::computeKey (const glu::ProgramSources& sources)
+{
+	de::Sha1Stream stream;
+
+	for (int shaderType = 0; shaderType < glu::SHADERTYPE_LAST; shaderType++)
+		stream << sources.sources[shaderType];
+
+	return stream.finalize().toString();
+}
+
+void ProgramCompileService::prefetch (const glu::ProgramSources& sources)
+{
+	if (m_threads.empty() || !m_isCompileSupported)
+		return;
+
+	{
+		const string			key		= computeKey(sources);
+		const de::ScopedLock	lock	(m_lock);
+
+		if (m_entries.find(key) != m_entries.end())
+			return;
+
+		{
+			Entry& entry = m_entries[key];
+
+			entry.state		= ENTRYSTATE_QUEUED;
+			entry.sources	= sources;
+			entry.contextId	= tcu::Instrumentation::getCurrentContext();
+		}
+
+		m_queue.push_back(key);
+	}
+
+	m_queueSem.increment();
+}
+
+ProgramBinary* ProgramCompileService::build (const glu::ProgramSources& sources, glu::ShaderProgramInfo* buildInfo)
+{
+	const string key = computeKey(sources);
+
+	for (;;)
+	{
+		Entry*	entry			= DE_NULL;
+		bool	compileHere		= false;
+
+		{
+			const de::ScopedLock		lock	(m_lock);
+			const EntryMap::iterator	iter	= m_entries.find(key);
+
+			if (iter == m_entries.end() || iter->second.state == ENTRYSTATE_FAILED)
+				break;
+
+			entry = &iter->second;
+
+			if (entry->state == ENTRYSTATE_COMPLETED)
+			{
+				m_numCacheHits += 1;
+				*buildInfo = entry->buildInfo;
+
+				return copyProgramBinary(*entry->binary);
+			}
+			else if (entry->state == ENTRYSTATE_QUEUED)
+			{
+				// Not started yet, compile here instead of waiting for a worker
+				entry->state	= ENTRYSTATE_COMPILING;
+				compileHere		= true;
+			}
+			else
+			{
+				DE_ASSERT(entry->state == ENTRYSTATE_COMPILING);
+				DE_ASSERT(!entry->hasWaiter);
+				entry->hasWaiter = true;
+			}
+		}
+
+		if (compileHere)
+			compile(key, *entry);
+		else
+			m_completedSem.decrement();
+	}
+
+	// Not compiled, or compilation failed. Compile on this thread so that errors are reported normally.
+	{
+		de::MovePtr<ProgramBinary> binary;
+
+		try
+		{
+			binary = de::MovePtr<ProgramBinary>(buildProgram(sources, PROGRAM_FORMAT_SPIRV, buildInfo));
+		}
+		catch (const tcu::NotSupportedError&)
+		{
+			m_isCompileSupported = false;
+			throw;
+		}
+
+		const de::ScopedLock	lock	(m_lock);
+		Entry&					entry	= m_entries[key];
+
+		DE_ASSERT(entry.state == ENTRYSTATE_LAST || entry.state == ENTRYSTATE_FAILED);
+
+		m_cacheSize			-= entry.size;
+		entry.state			= ENTRYSTATE_COMPLETED;
+		entry.binary		= de::SharedPtr<ProgramBinary>(copyProgramBinary(*binary));
+		entry.buildInfo		= *buildInfo;
+		entry.size			= sizeof(Entry) + key.size() + binary->getSize() + getShaderInfoSize(*buildInfo);
+		m_cacheSize			+= entry.size;
+
+		m_completedKeys.push_back(key);
+		evictOldEntries();
+
+		return binary.release();
+	}
+}
+
+void ProgramCompileService::processQueue (void)
+{
+	for (;;)
+	{
+		string		key;
+		Entry*		entry		= DE_NULL;
+		deUint32	contextId	= 0;
+
+		m_queueSem.decrement();
+
+		{
+			const de::ScopedLock lock (m_lock);
+
+			if (m_isShutdown)
+				return;
+
+			DE_ASSERT(!m_queue.empty());
+			key = m_queue.front();
+			m_queue.pop_front();
+
+			{
+				const EntryMap::iterator iter = m_entries.find(key);
+
+				// Entry may have been taken over by build()
+				if (iter == m_entries.end() || iter->second.state != ENTRYSTATE_QUEUED)
+					continue;
+
+				entry			= &iter->second;
+				entry->state	= ENTRYSTATE_COMPILING;
+				contextId		= entry->contextId;
+			}
+		}
+
+		{
+			// Credit compilation to the case that queued it
+			const tcu::InstrumentationContextScope context (contextId);
+
+			compile(key, *entry);
+		}
+	}
+}
+
+void ProgramCompileService::compile (const string& key, Entry& entry)
+{
+	// Entry in COMPILING state is not accessed by other threads, except for hasWaiter.
+	de::SharedPtr<ProgramBinary>	binary;
+	glu::ShaderProgramInfo			buildInfo;
+
+	DE_ASSERT(entry.state == ENTRYSTATE_COMPILING);
+
+	try
+	{
+		binary = de::SharedPtr<ProgramBinary>(buildProgram(entry.sources, PROGRAM_FORMAT_SPIRV, &buildInfo));
+	}
+	catch (const std::exception&)
+	{
+		// build() compiles again on the calling thread to report the error
+	}
+
+	{
+		const de::ScopedLock lock (m_lock);
+
+		entry.state		= binary ? ENTRYSTATE_COMPLETED : ENTRYSTATE_FAILED;
+		entry.sources	= glu::ProgramSources();
+
+		if (binary)
+		{
+			entry.binary	= binary;
+			entry.buildInfo	= buildInfo;
+			entry.size		= sizeof(Entry) + key.size() + binary->getSize() + getShaderInfoSize(buildInfo);
+		}
+		else
+			entry.size		= sizeof(Entry) + key.size();
+
+		m_cacheSize += entry.size;
+		m_completedKeys.push_back(key);
+
+		if (entry.hasWaiter)
+		{
+			entry.hasWaiter = false;
+			m_completedSem.increment();
+		}
+
+		evictOldEntries();
+	}
+}
+
+void ProgramCompileService::evictOldEntries (void)
+{
+	// \note Must be called with m_lock held
+	while (m_cacheSize > m_maxCacheSize && !m_completedKeys.empty())
+	{
+		const EntryMap::iterator iter = m_entries.find(m_completedKeys.front());
+
+		m_completedKeys.pop_front();
+
+		// Key may be stale if entry was recompiled after failure or evicted earlier
+		if (iter != m_entries.end() && (iter->second.state == ENTRYSTATE_COMPLETED || iter->second.state == ENTRYSTATE_FAILED) && !iter->second.hasWaiter)
+		{
+			m_cacheSize -= iter->second.size;
+			m_entries.erase(iter);
+		}
+	}
+}
+
+} // vk
@@ -0,0 +1,150 @@
+#ifndef _VKPROGRAMCOMPILESERVICE_HPP
+#define _VKPROGRAMCOMPILESERVICE_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Background GLSL to SPIR-V compilation with result cache.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkPrograms.hpp"
+#include "gluShaderProgram.hpp"
+#include "deMutex.hpp"
+#include "deSemaphore.hpp"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace vk
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Background GLSL to SPIR-V compiler with result cache
+ *
+ * Programs passed to prefetch() are compiled on worker threads, and
+ * build() returns a copy of the cached result when the same sources have
+ * been compiled before. If compilation is in progress, build() waits for
+ * it, and otherwise compiles on the calling thread.
+ *
+ * Results are identified by SHA-1 of program sources. Failed compilations
+ * are recompiled by build() on the calling thread, so errors and build
+ * logs are reported exactly as by vk::buildProgram(). Successful results
+ * are kept until the total size exceeds the cache limit, in which case
+ * the oldest results are dropped first.
+ *
+ * Once building from source is found unsupported, for example when
+ * glslang is not available, prefetch() does nothing.
+ *
+ * prefetch() and build() must be called from a single thread.
+ *//*--------------------------------------------------------------------*/
+class ProgramCompileService
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_CACHE_SIZE	= 64*1024*1024		//!< Approximate memory used by cached binaries and build logs.
+	};
+
+									ProgramCompileService	(int numThreads, size_t maxCacheSize = DEFAULT_MAX_CACHE_SIZE);
+									~ProgramCompileService	(void);
+
+	//! Queue program for compilation unless it is already cached or queued.
+	void							prefetch				(const glu::ProgramSources& sources);
+
+	//! Same as vk::buildProgram(sources, PROGRAM_FORMAT_SPIRV, buildInfo).
+	ProgramBinary*					build					(const glu::ProgramSources& sources, glu::ShaderProgramInfo* buildInfo);
+
+	//! False once compilation on the calling thread has thrown NotSupportedError.
+	bool							isCompileSupported		(void) const { return m_isCompileSupported;		}
+
+	int								getNumThreads			(void) const { return (int)m_threads.size();	}
+	int								getNumCacheHits			(void) const { return m_numCacheHits;			}
+
+private:
+									ProgramCompileService	(const ProgramCompileService&);	// not allowed!
+	ProgramCompileService&			operator=				(const ProgramCompileService&);	// not allowed!
+
+	enum EntryState
+	{
+		ENTRYSTATE_QUEUED = 0,
+		ENTRYSTATE_COMPILING,
+		ENTRYSTATE_COMPLETED,
+		ENTRYSTATE_FAILED,
+
+		ENTRYSTATE_LAST
+	};
+
+	struct Entry
+	{
+		EntryState						state;
+		bool							hasWaiter;		//!< build() is waiting for completion.
+		glu::ProgramSources				sources;		//!< Only kept until compiled.
+		de::SharedPtr<ProgramBinary>	binary;
+		glu::ShaderProgramInfo			buildInfo;
+		size_t							size;
+		deUint32						contextId;		//!< Instrumentation context that queued the entry.
+
+		Entry (void) : state(ENTRYSTATE_LAST), hasWaiter(false), size(0), contextId(0) {}
+	};
+
+	class WorkerThread : public de::Thread
+	{
+	public:
+						WorkerThread	(ProgramCompileService& service) : m_service(service) {}
+		void			run				(void) { m_service.processQueue(); }
+
+	private:
+		ProgramCompileService&	m_service;
+	};
+
+	typedef std::map<std::string, Entry>	EntryMap;
+	typedef de::SharedPtr<WorkerThread>		WorkerThreadSp;
+
+	static std::string				computeKey				(const glu::ProgramSources& sources);
+
+	void							processQueue			(void);
+	void							compile					(const std::string& key, Entry& entry);
+	void							evictOldEntries			(void);
+
+	const size_t					m_maxCacheSize;
+
+	de::Mutex						m_lock;
+	de::Semaphore					m_queueSem;			//!< Number of queued keys, plus one per thread on shutdown.
+	de::Semaphore					m_completedSem;		//!< Signaled when entry with waiter completes.
+	bool							m_isShutdown;
+
+	EntryMap						m_entries;
+	std::deque<std::string>			m_queue;			//!< Keys to compile.
+	std::deque<std::string>			m_completedKeys;	//!< Cached keys, oldest first.
+	size_t							m_cacheSize;
+
+	bool							m_isCompileSupported;
+	int								m_numCacheHits;
+
+	std::vector<WorkerThreadSp>		m_threads;
+};
+
+} // vk
+
+#endif // _VKPROGRAMCOMPILESERVICE_HPP
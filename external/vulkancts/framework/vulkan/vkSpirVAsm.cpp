@@ -23,6 +23,7 @@
 
 #include "vkSpirVAsm.hpp"
 #include "vkSpirVProgram.hpp"
+#include "tcuInstrumentation.hpp"
 #include "deClock.h"
 
 #include <algorithm>
@@ -43,9 +44,10 @@ static const spv_target_env s_defaultEnvironment = SPV_ENV_VULKAN_1_0;
 
 bool assembleSpirV (const SpirVAsmSource* program, std::vector<deUint32>* dst, SpirVProgramInfo* buildInfo)
 {
-	const spv_context	context		= spvContextCreate(s_defaultEnvironment);
-	spv_binary			binary		= DE_NULL;
-	spv_diagnostic		diagnostic	= DE_NULL;
+	const tcu::InstrumentationScope	scope		("vk::assembleSpirV");
+	const spv_context				context		= spvContextCreate(s_defaultEnvironment);
+	spv_binary						binary		= DE_NULL;
+	spv_diagnostic					diagnostic	= DE_NULL;
 
 	if (!context)
 		throw std::bad_alloc();
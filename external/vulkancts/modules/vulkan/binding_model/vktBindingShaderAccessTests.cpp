@@ -1129,7 +1129,7 @@ vk::Move<vk::VkPipeline> SingleCmdRenderInstance::createPipeline (vk::VkPipeline
 		(vk::VkPipeline)0,												// basePipelineHandle
 		0u,																// basePipelineIndex
 	};
-	return createGraphicsPipeline(m_vki, m_device, (vk::VkPipelineCache)0u, &createInfo);
+	return createGraphicsPipeline(m_vki, m_device, m_context.getPipelineCache(), &createInfo);
 }
 
 void SingleCmdRenderInstance::renderToTarget (void)
@@ -1912,6 +1912,7 @@ class ComputePipeline
 public:
 											ComputePipeline			(const vk::DeviceInterface&			vki,
 																	 vk::VkDevice						device,
+																	 vk::VkPipelineCache				pipelineCache,
 																	 const vk::BinaryCollection&		programCollection,
 																	 deUint32							numDescriptorSets,
 																	 const vk::VkDescriptorSetLayout*	descriptorSetLayouts);
@@ -1927,6 +1928,7 @@ private:
 
 	static vk::Move<vk::VkPipeline>			createPipeline			(const vk::DeviceInterface&			vki,
 																	 vk::VkDevice						device,
+																	 vk::VkPipelineCache				pipelineCache,
 																	 const vk::BinaryCollection&		programCollection,
 																	 vk::VkPipelineLayout				layout);
 
@@ -1936,11 +1938,12 @@ private:
 
 ComputePipeline::ComputePipeline (const vk::DeviceInterface&		vki,
 								  vk::VkDevice						device,
+								  vk::VkPipelineCache				pipelineCache,
 								  const vk::BinaryCollection&		programCollection,
 								  deUint32							numDescriptorSets,
 								  const vk::VkDescriptorSetLayout*	descriptorSetLayouts)
 	: m_pipelineLayout	(createPipelineLayout(vki, device, numDescriptorSets, descriptorSetLayouts))
-	, m_pipeline		(createPipeline(vki, device, programCollection, *m_pipelineLayout))
+	, m_pipeline		(createPipeline(vki, device, pipelineCache, programCollection, *m_pipelineLayout))
 {
 }
 
@@ -1964,6 +1967,7 @@ vk::Move<vk::VkPipelineLayout> ComputePipeline::createPipelineLayout (const vk::
 
 vk::Move<vk::VkPipeline> ComputePipeline::createPipeline (const vk::DeviceInterface&	vki,
 														  vk::VkDevice					device,
+														  vk::VkPipelineCache			pipelineCache,
 														  const vk::BinaryCollection&	programCollection,
 														  vk::VkPipelineLayout			layout)
 {
@@ -1988,7 +1992,7 @@ vk::Move<vk::VkPipeline> ComputePipeline::createPipeline (const vk::DeviceInterf
 		(vk::VkPipeline)0,				// basePipelineHandle
 		0u,								// basePipelineIndex
 	};
-	return createComputePipeline(vki, device, (vk::VkPipelineCache)0u, &createInfo);
+	return createComputePipeline(vki, device, pipelineCache, &createInfo);
 }
 
 class ComputeCommand
@@ -2573,7 +2577,7 @@ tcu::TestStatus BufferComputeInstance::testResourceAccess (void)
 	const vk::Unique<vk::VkDescriptorSetLayout>		descriptorSetLayout	(createDescriptorSetLayout());
 	const vk::Unique<vk::VkDescriptorPool>			descriptorPool		(createDescriptorPool());
 	const vk::Unique<vk::VkDescriptorSet>			descriptorSet		(createDescriptorSet(*descriptorPool, *descriptorSetLayout, *bufferA, viewOffsetA, *bufferB, viewOffsetB, m_result.getBuffer()));
-	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
+	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getPipelineCache(), m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
 
 	const vk::VkAccessFlags							inputBit			= (isUniformBuffer) ? (vk::VK_ACCESS_UNIFORM_READ_BIT) : (vk::VK_ACCESS_SHADER_READ_BIT);
 	const vk::VkBufferMemoryBarrier					bufferBarriers[]	=
@@ -4525,7 +4529,7 @@ tcu::TestStatus ImageFetchComputeInstance::testResourceAccess (void)
 	const vk::Unique<vk::VkDescriptorSetLayout>		descriptorSetLayout	(createDescriptorSetLayout());
 	const vk::Unique<vk::VkDescriptorPool>			descriptorPool		(createDescriptorPool());
 	const vk::Unique<vk::VkDescriptorSet>			descriptorSet		(createDescriptorSet(*descriptorPool, *descriptorSetLayout));
-	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
+	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getPipelineCache(), m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
 
 	const vk::VkDescriptorSet						descriptorSets[]	= { *descriptorSet };
 	const int										numDescriptorSets	= (m_updateMethod == DESCRIPTOR_UPDATE_METHOD_WITH_PUSH_TEMPLATE || m_updateMethod == DESCRIPTOR_UPDATE_METHOD_WITH_PUSH) ? 0 : DE_LENGTH_OF_ARRAY(descriptorSets);
@@ -6131,7 +6135,7 @@ tcu::TestStatus ImageSampleComputeInstance::testResourceAccess (void)
 	const vk::Unique<vk::VkDescriptorSetLayout>		descriptorSetLayout	(createDescriptorSetLayout());
 	const vk::Unique<vk::VkDescriptorPool>			descriptorPool		(createDescriptorPool());
 	const vk::Unique<vk::VkDescriptorSet>			descriptorSet		(createDescriptorSet(*descriptorPool, *descriptorSetLayout));
-	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
+	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getPipelineCache(), m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
 
 	const vk::VkDescriptorSet						descriptorSets[]	= { *descriptorSet };
 	const int										numDescriptorSets	= (m_updateMethod == DESCRIPTOR_UPDATE_METHOD_WITH_PUSH_TEMPLATE || m_updateMethod == DESCRIPTOR_UPDATE_METHOD_WITH_PUSH) ? 0 : DE_LENGTH_OF_ARRAY(descriptorSets);
@@ -7519,7 +7523,7 @@ tcu::TestStatus TexelBufferComputeInstance::testResourceAccess (void)
 	const vk::Unique<vk::VkDescriptorSetLayout>		descriptorSetLayout	(createDescriptorSetLayout());
 	const vk::Unique<vk::VkDescriptorPool>			descriptorPool		(createDescriptorPool());
 	const vk::Unique<vk::VkDescriptorSet>			descriptorSet		(createDescriptorSet(*descriptorPool, *descriptorSetLayout));
-	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
+	const ComputePipeline							pipeline			(m_vki, m_device, m_context.getPipelineCache(), m_context.getBinaryCollection(), 1, &descriptorSetLayout.get());
 
 	const vk::VkDescriptorSet						descriptorSets[]	= { *descriptorSet };
 	const int										numDescriptorSets	= (m_updateMethod == DESCRIPTOR_UPDATE_METHOD_WITH_PUSH_TEMPLATE || m_updateMethod == DESCRIPTOR_UPDATE_METHOD_WITH_PUSH) ? 0 : DE_LENGTH_OF_ARRAY(descriptorSets);
@@ -447,7 +447,7 @@ void DrawTestInstanceBase::initPipeline (const vk::VkDevice device)
 	pipelineCreateInfo.addState(PipelineCreateInfo::RasterizerState());
 	pipelineCreateInfo.addState(PipelineCreateInfo::MultiSampleState());
 
-	m_pipeline = vk::createGraphicsPipeline(m_vk, device, DE_NULL, &pipelineCreateInfo);
+	m_pipeline = vk::createGraphicsPipeline(m_vk, device, m_context.getPipelineCache(), &pipelineCreateInfo);
 }
 
 void DrawTestInstanceBase::beginRenderPass (void)
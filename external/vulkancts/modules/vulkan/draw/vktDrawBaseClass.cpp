@@ -179,7 +179,7 @@ void DrawTestsBaseClass::initPipeline (const vk::VkDevice device)
 	pipelineCreateInfo.addState(PipelineCreateInfo::RasterizerState());
 	pipelineCreateInfo.addState(PipelineCreateInfo::MultiSampleState());
 
-	m_pipeline = vk::createGraphicsPipeline(m_vk, device, DE_NULL, &pipelineCreateInfo);
+	m_pipeline = vk::createGraphicsPipeline(m_vk, device, m_context.getPipelineCache(), &pipelineCreateInfo);
 }
 
 void DrawTestsBaseClass::beginRenderPass (void)
@@ -428,7 +428,7 @@ InstancedDrawInstance::InstancedDrawInstance(Context &context, TestParams params
 	pipelineCreateInfo.addState(PipelineCreateInfo::RasterizerState());
 	pipelineCreateInfo.addState(PipelineCreateInfo::MultiSampleState());
 
-	m_pipeline = vk::createGraphicsPipeline(m_vk, device, DE_NULL, &pipelineCreateInfo);
+	m_pipeline = vk::createGraphicsPipeline(m_vk, device, m_context.getPipelineCache(), &pipelineCreateInfo);
 }
 
 tcu::TestStatus InstancedDrawInstance::iterate()
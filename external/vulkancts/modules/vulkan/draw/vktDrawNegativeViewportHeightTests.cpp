@@ -234,7 +234,7 @@ NegativeViewportHeightTestInstance::NegativeViewportHeightTestInstance (Context&
 	pipelineCreateInfo.addState (PipelineCreateInfo::MultiSampleState	());
 	pipelineCreateInfo.addState (PipelineCreateInfo::DynamicState		(dynamicStates));
 
-	m_pipeline = createGraphicsPipeline(vk, device, DE_NULL, &pipelineCreateInfo);
+	m_pipeline = createGraphicsPipeline(vk, device, m_context.getPipelineCache(), &pipelineCreateInfo);
 }
 
 tcu::ConstPixelBufferAccess NegativeViewportHeightTestInstance::draw (const VkViewport viewport)
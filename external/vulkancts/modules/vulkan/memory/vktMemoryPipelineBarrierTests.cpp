@@ -693,74 +693,254 @@ void* mapMemory (const vk::DeviceInterface&	vkd,
 	return ptr;
 }
 
+// Reference model of memory contents. Memory is split into chunks that are allocated on first write,
+// so that large allocations only cost memory for the ranges tests actually touch.
 class ReferenceMemory
 {
 public:
 			ReferenceMemory	(size_t size);
 
-	void	set				(size_t pos, deUint8 val);
 	deUint8	get				(size_t pos) const;
 	bool	isDefined		(size_t pos) const;
 
-	void	setDefined		(size_t offset, size_t size, const void* data);
 	void	setUndefined	(size_t offset, size_t size);
 	void	setData			(size_t offset, size_t size, const void* data);
+	void	xorData			(size_t offset, size_t size, const void* mask);
 
-	size_t	getSize			(void) const { return m_data.size(); }
+	//! Find first defined byte in range that differs from data. Returns false if all defined bytes match.
+	bool	findMismatch	(size_t offset, size_t size, const void* data, size_t* mismatchPos) const;
+
+	size_t	getSize			(void) const { return m_size; }
 
 private:
-	vector<deUint8>		m_data;
-	vector<deUint64>	m_defined;
+	enum
+	{
+		CHUNK_SIZE_LOG2	= 16,
+		CHUNK_SIZE		= 1u << CHUNK_SIZE_LOG2
+	};
+
+	bool	isAllocated		(size_t chunkNdx) const { return !m_chunkData[chunkNdx].empty(); }
+	void	allocate		(size_t chunkNdx);
+
+	size_t						m_size;
+	vector<vector<deUint8> >	m_chunkData;
+	vector<vector<deUint64> >	m_chunkDefined;
 };
 
 ReferenceMemory::ReferenceMemory (size_t size)
-	: m_data	(size, 0)
-	, m_defined	(size / 64 + (size % 64 == 0 ? 0 : 1), 0ull)
+	: m_size			(size)
+	, m_chunkData		(size / CHUNK_SIZE + (size % CHUNK_SIZE == 0 ? 0 : 1))
+	, m_chunkDefined	(m_chunkData.size())
 {
 }
 
-void ReferenceMemory::set (size_t pos, deUint8 val)
+void ReferenceMemory::allocate (size_t chunkNdx)
 {
-	DE_ASSERT(pos < m_data.size());
+	DE_ASSERT(!isAllocated(chunkNdx));
+
+	m_chunkData[chunkNdx].resize(CHUNK_SIZE, 0);
+	m_chunkDefined[chunkNdx].resize(CHUNK_SIZE / 64, 0ull);
+}
 
-	m_data[pos] = val;
-	m_defined[pos / 64] |= 0x1ull << (pos % 64);
+// Bit mask of count bits starting from bit ndx. ndx + count <= 64.
+deUint64 getBitRangeMask (size_t ndx, size_t count)
+{
+	DE_ASSERT(count > 0 && ndx + count <= 64);
+	return (count == 64 ? ~0ull : ((0x1ull << count) - 1ull)) << ndx;
+}
+
+void setBitRange (deUint64* bits, size_t begin, size_t end, bool value)
+{
+	for (size_t ndx = begin; ndx < end;)
+	{
+		const size_t	bitNdx	= ndx % 64;
+		const size_t	count	= de::min<size_t>(64 - bitNdx, end - ndx);
+		const deUint64	mask	= getBitRangeMask(bitNdx, count);
+
+		if (value)
+			bits[ndx / 64] |= mask;
+		else
+			bits[ndx / 64] &= ~mask;
+
+		ndx += count;
+	}
 }
 
 void ReferenceMemory::setData (size_t offset, size_t size, const void* data_)
 {
 	const deUint8* data = (const deUint8*)data_;
 
-	DE_ASSERT(offset < m_data.size());
-	DE_ASSERT(offset + size <= m_data.size());
+	DE_ASSERT(offset < m_size);
+	DE_ASSERT(offset + size <= m_size);
 
-	// \todo [2016-03-09 mika] Optimize
-	for (size_t pos = 0; pos < size; pos++)
+	for (size_t pos = offset; pos < offset + size;)
 	{
-		m_data[offset + pos] = data[pos];
-		m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+		const size_t	chunkNdx	= pos >> CHUNK_SIZE_LOG2;
+		const size_t	chunkPos	= pos & (CHUNK_SIZE - 1);
+		const size_t	count		= de::min<size_t>(CHUNK_SIZE - chunkPos, offset + size - pos);
+
+		if (!isAllocated(chunkNdx))
+			allocate(chunkNdx);
+
+		deMemcpy(&m_chunkData[chunkNdx][chunkPos], data + (pos - offset), count);
+		setBitRange(&m_chunkDefined[chunkNdx][0], chunkPos, chunkPos + count, true);
+
+		pos += count;
+	}
+}
+
+void ReferenceMemory::setUndefined (size_t offset, size_t size)
+{
+	DE_ASSERT(offset + size <= m_size);
+
+	for (size_t pos = offset; pos < offset + size;)
+	{
+		const size_t	chunkNdx	= pos >> CHUNK_SIZE_LOG2;
+		const size_t	chunkPos	= pos & (CHUNK_SIZE - 1);
+		const size_t	count		= de::min<size_t>(CHUNK_SIZE - chunkPos, offset + size - pos);
+
+		if (isAllocated(chunkNdx))
+		{
+			if (count == CHUNK_SIZE)
+			{
+				// Whole chunk is undefined, release it.
+				vector<deUint8>().swap(m_chunkData[chunkNdx]);
+				vector<deUint64>().swap(m_chunkDefined[chunkNdx]);
+			}
+			else
+				setBitRange(&m_chunkDefined[chunkNdx][0], chunkPos, chunkPos + count, false);
+		}
+
+		pos += count;
 	}
 }
 
-void ReferenceMemory::setUndefined	(size_t offset, size_t size)
+void ReferenceMemory::xorData (size_t offset, size_t size, const void* mask_)
 {
-	// \todo [2016-03-09 mika] Optimize
-	for (size_t pos = 0; pos < size; pos++)
-		m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+	const deUint8* mask = (const deUint8*)mask_;
+
+	DE_ASSERT(offset + size <= m_size);
+
+	for (size_t pos = offset; pos < offset + size;)
+	{
+		const size_t	chunkNdx	= pos >> CHUNK_SIZE_LOG2;
+		const size_t	chunkPos	= pos & (CHUNK_SIZE - 1);
+		const size_t	count		= de::min<size_t>(CHUNK_SIZE - chunkPos, offset + size - pos);
+
+		// \note Undefined bytes stay undefined so they can be modified as well.
+		if (isAllocated(chunkNdx))
+		{
+			deUint8* const			dst	= &m_chunkData[chunkNdx][chunkPos];
+			const deUint8* const	src	= mask + (pos - offset);
+
+			for (size_t ndx = 0; ndx < count; ndx++)
+				dst[ndx] ^= src[ndx];
+		}
+
+		pos += count;
+	}
+}
+
+bool ReferenceMemory::findMismatch (size_t offset, size_t size, const void* data_, size_t* mismatchPos) const
+{
+	const deUint8* data = (const deUint8*)data_;
+
+	DE_ASSERT(offset + size <= m_size);
+
+	for (size_t pos = offset; pos < offset + size;)
+	{
+		const size_t	chunkNdx	= pos >> CHUNK_SIZE_LOG2;
+		const size_t	chunkPos	= pos & (CHUNK_SIZE - 1);
+		const size_t	count		= de::min<size_t>(CHUNK_SIZE - chunkPos, offset + size - pos);
+
+		if (isAllocated(chunkNdx))
+		{
+			const deUint8* const	ref		= &m_chunkData[chunkNdx][0];
+			const deUint64* const	defined	= &m_chunkDefined[chunkNdx][0];
+			const deUint8* const	src		= data + (pos - offset) - chunkPos;
+
+			// Process 64 bytes per defined mask word. Fully defined words are compared with memcmp.
+			for (size_t ndx = chunkPos; ndx < chunkPos + count;)
+			{
+				const size_t	bitNdx		= ndx % 64;
+				const size_t	wordCount	= de::min<size_t>(64 - bitNdx, chunkPos + count - ndx);
+				const deUint64	rangeMask	= getBitRangeMask(bitNdx, wordCount);
+				const deUint64	word		= defined[ndx / 64] & rangeMask;
+
+				if (word != 0 && (word != rangeMask || deMemCmp(&ref[ndx], &src[ndx], wordCount) != 0))
+				{
+					for (size_t byteNdx = 0; byteNdx < wordCount; byteNdx++)
+					{
+						if ((word & (0x1ull << (bitNdx + byteNdx))) != 0 && ref[ndx + byteNdx] != src[ndx + byteNdx])
+						{
+							*mismatchPos = (pos - chunkPos) + ndx + byteNdx;
+							return true;
+						}
+					}
+				}
+
+				ndx += wordCount;
+			}
+		}
+
+		pos += count;
+	}
+
+	return false;
 }
 
 deUint8 ReferenceMemory::get (size_t pos) const
 {
-	DE_ASSERT(pos < m_data.size());
+	DE_ASSERT(pos < m_size);
 	DE_ASSERT(isDefined(pos));
-	return m_data[pos];
+	return m_chunkData[pos >> CHUNK_SIZE_LOG2][pos & (CHUNK_SIZE - 1)];
 }
 
 bool ReferenceMemory::isDefined (size_t pos) const
 {
-	DE_ASSERT(pos < m_data.size());
+	DE_ASSERT(pos < m_size);
 
-	return (m_defined[pos / 64] & (0x1ull << (pos % 64))) != 0;
+	const size_t	chunkNdx	= pos >> CHUNK_SIZE_LOG2;
+	const size_t	chunkPos	= pos & (CHUNK_SIZE - 1);
+
+	return isAllocated(chunkNdx) && (m_chunkDefined[chunkNdx][chunkPos / 64] & (0x1ull << (chunkPos % 64))) != 0;
+}
+
+// Compare defined bytes of reference against data, report first mismatch. Returns true if all defined bytes match.
+bool verifyReference (tcu::ResultCollector& resultCollector, const string& prefix, const ReferenceMemory& reference, const deUint8* data, size_t size)
+{
+	size_t pos = 0;
+
+	if (!reference.findMismatch(0, size, data, &pos))
+		return true;
+
+	resultCollector.fail(
+			prefix
+			+ " Result differs from reference, Expected: "
+			+ de::toString(tcu::toHex<8>(reference.get(pos)))
+			+ ", Got: "
+			+ de::toString(tcu::toHex<8>(data[pos]))
+			+ ", At offset: "
+			+ de::toString(pos));
+
+	return false;
+}
+
+// Set reference to sequence of random bytes, matching per-byte de::Random::getUint8() calls.
+void setRandomReferenceData (ReferenceMemory& reference, size_t size, de::Random& rng)
+{
+	const size_t		blockSize	= 65536;
+	vector<deUint8>		data		(de::min(blockSize, size));
+
+	for (size_t offset = 0; offset < size; offset += blockSize)
+	{
+		const size_t count = de::min(blockSize, size - offset);
+
+		for (size_t ndx = 0; ndx < count; ndx++)
+			data[ndx] = rng.getUint8();
+
+		reference.setData(offset, count, &data[0]);
+	}
 }
 
 class Memory
@@ -1415,66 +1595,43 @@ void HostMemoryAccess::verify (VerifyContext& context, size_t commandIndex)
 {
 	tcu::ResultCollector&	resultCollector	= context.getResultCollector();
 	ReferenceMemory&		reference		= context.getReference();
+	const string			prefix			= de::toString(commandIndex) + ":" + getName();
 	de::Random				rng				(m_seed);
 
 	if (m_read && m_write)
 	{
-		for (size_t pos = 0; pos < m_size; pos++)
+		const size_t	blockSize	= 65536;
+		vector<deUint8>	mask		(de::min(blockSize, m_size));
+
+		for (size_t offset = 0; offset < m_size; offset += blockSize)
 		{
-			const deUint8	mask	= rng.getUint8();
-			const deUint8	value	= m_readData[pos];
+			const size_t count = de::min(blockSize, m_size - offset);
 
-			if (reference.isDefined(pos))
-			{
-				if (value != reference.get(pos))
-				{
-					resultCollector.fail(
-							de::toString(commandIndex) + ":" + getName()
-							+ " Result differs from reference, Expected: "
-							+ de::toString(tcu::toHex<8>(reference.get(pos)))
-							+ ", Got: "
-							+ de::toString(tcu::toHex<8>(value))
-							+ ", At offset: "
-							+ de::toString(pos));
-					break;
-				}
+			for (size_t ndx = 0; ndx < count; ndx++)
+				mask[ndx] = rng.getUint8();
 
-				reference.set(pos, reference.get(pos) ^ mask);
-			}
-		}
-	}
-	else if (m_read)
-	{
-		for (size_t pos = 0; pos < m_size; pos++)
-		{
-			const deUint8	value	= m_readData[pos];
+			size_t mismatchPos = 0;
 
-			if (reference.isDefined(pos))
+			if (reference.findMismatch(offset, count, &m_readData[offset], &mismatchPos))
 			{
-				if (value != reference.get(pos))
-				{
-					resultCollector.fail(
-							de::toString(commandIndex) + ":" + getName()
-							+ " Result differs from reference, Expected: "
-							+ de::toString(tcu::toHex<8>(reference.get(pos)))
-							+ ", Got: "
-							+ de::toString(tcu::toHex<8>(value))
-							+ ", At offset: "
-							+ de::toString(pos));
-					break;
-				}
+				resultCollector.fail(
+						prefix
+						+ " Result differs from reference, Expected: "
+						+ de::toString(tcu::toHex<8>(reference.get(mismatchPos)))
+						+ ", Got: "
+						+ de::toString(tcu::toHex<8>(m_readData[mismatchPos]))
+						+ ", At offset: "
+						+ de::toString(mismatchPos));
+				break;
 			}
-		}
-	}
-	else if (m_write)
-	{
-		for (size_t pos = 0; pos < m_size; pos++)
-		{
-			const deUint8	value	= rng.getUint8();
 
-			reference.set(pos, value);
+			reference.xorData(offset, count, &mask[0]);
 		}
 	}
+	else if (m_read)
+		verifyReference(resultCollector, prefix, reference, &m_readData[0], m_size);
+	else if (m_write)
+		setRandomReferenceData(reference, m_size, rng);
 	else
 		DE_FATAL("Host memory access without read or write.");
 }
@@ -2192,15 +2349,21 @@ void FillBuffer::submit (SubmitContext& context)
 void FillBuffer::verify (VerifyContext& context, size_t)
 {
 	ReferenceMemory&	reference	= context.getReference();
+	const size_t		blockSize	= 65536;
+	vector<deUint8>		data		(blockSize);
 
-	for (size_t ndx = 0; ndx < m_bufferSize; ndx++)
+	// \note Block size is multiple of 4 so the same pattern block can be reused.
+	for (size_t ndx = 0; ndx < blockSize; ndx++)
 	{
 #if (DE_ENDIANNESS == DE_LITTLE_ENDIAN)
-		reference.set(ndx, (deUint8)(0xffu & (m_value >> (8*(ndx % 4)))));
+		data[ndx] = (deUint8)(0xffu & (m_value >> (8*(ndx % 4))));
 #else
-		reference.set(ndx, (deUint8)(0xffu & (m_value >> (8*(3 - (ndx % 4))))));
+		data[ndx] = (deUint8)(0xffu & (m_value >> (8*(3 - (ndx % 4)))));
 #endif
 	}
+
+	for (size_t offset = 0; offset < (size_t)m_bufferSize; offset += blockSize)
+		reference.setData(offset, de::min(blockSize, (size_t)m_bufferSize - offset), &data[0]);
 }
 
 class UpdateBuffer : public CmdCommand
@@ -2353,32 +2516,10 @@ void BufferCopyToBuffer::verify (VerifyContext& context, size_t commandIndex)
 
 	{
 		void* const	ptr		= mapMemory(vkd, device, *m_memory, m_bufferSize);
-		bool		isOk	= true;
 
 		vk::invalidateMappedMemoryRange(vkd, device, *m_memory, 0, m_bufferSize);
 
-		{
-			const deUint8* const data = (const deUint8*)ptr;
-
-			for (size_t pos = 0; pos < (size_t)m_bufferSize; pos++)
-			{
-				if (reference.isDefined(pos))
-				{
-					if (data[pos] != reference.get(pos))
-					{
-						resultCollector.fail(
-								de::toString(commandIndex) + ":" + getName()
-								+ " Result differs from reference, Expected: "
-								+ de::toString(tcu::toHex<8>(reference.get(pos)))
-								+ ", Got: "
-								+ de::toString(tcu::toHex<8>(data[pos]))
-								+ ", At offset: "
-								+ de::toString(pos));
-						break;
-					}
-				}
-			}
-		}
+		const bool	isOk	= verifyReference(resultCollector, de::toString(commandIndex) + ":" + getName(), reference, (const deUint8*)ptr, (size_t)m_bufferSize);
 
 		vkd.unmapMemory(device, *m_memory);
 
@@ -2463,8 +2604,7 @@ void BufferCopyFromBuffer::verify (VerifyContext& context, size_t)
 	ReferenceMemory&	reference	(context.getReference());
 	de::Random			rng			(m_seed);
 
-	for (size_t ndx = 0; ndx < (size_t)m_bufferSize; ndx++)
-		reference.set(ndx, rng.getUint8());
+	setRandomReferenceData(reference, (size_t)m_bufferSize, rng);
 }
 
 class BufferCopyToImage : public CmdCommand
@@ -2684,28 +2824,7 @@ void BufferCopyToImage::verify (VerifyContext& context, size_t commandIndex)
 
 		vk::invalidateMappedMemoryRange(vkd, device, *memory, 0,  4 * m_imageWidth * m_imageHeight);
 
-		{
-			const deUint8* const	data = (const deUint8*)ptr;
-
-			for (size_t pos = 0; pos < (size_t)( 4 * m_imageWidth * m_imageHeight); pos++)
-			{
-				if (reference.isDefined(pos))
-				{
-					if (data[pos] != reference.get(pos))
-					{
-						resultCollector.fail(
-								de::toString(commandIndex) + ":" + getName()
-								+ " Result differs from reference, Expected: "
-								+ de::toString(tcu::toHex<8>(reference.get(pos)))
-								+ ", Got: "
-								+ de::toString(tcu::toHex<8>(data[pos]))
-								+ ", At offset: "
-								+ de::toString(pos));
-						break;
-					}
-				}
-			}
-		}
+		verifyReference(resultCollector, de::toString(commandIndex) + ":" + getName(), reference, (const deUint8*)ptr, (size_t)(4 * m_imageWidth * m_imageHeight));
 
 		vkd.unmapMemory(device, *memory);
 	}
@@ -2909,8 +3028,7 @@ void BufferCopyFromImage::verify (VerifyContext& context, size_t)
 	ReferenceMemory&	reference		(context.getReference());
 	de::Random			rng	(m_seed);
 
-	for (size_t ndx = 0; ndx < (size_t)(4 * m_imageWidth * m_imageHeight); ndx++)
-		reference.set(ndx, rng.getUint8());
+	setRandomReferenceData(reference, (size_t)(4 * m_imageWidth * m_imageHeight), rng);
 }
 
 class ImageCopyToBuffer : public CmdCommand
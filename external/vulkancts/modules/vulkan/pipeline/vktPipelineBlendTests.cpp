@@ -643,7 +643,7 @@ BlendTestInstance::BlendTestInstance (Context&									context,
 		{
 			colorBlendStateParams.attachmentCount	= 1u;
 			colorBlendStateParams.pAttachments		= &m_blendStates[quadNdx];
-			m_graphicsPipelines[quadNdx]			= createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
+			m_graphicsPipelines[quadNdx]			= createGraphicsPipeline(vk, vkDevice, m_context.getPipelineCache(), &graphicsPipelineParams);
 		}
 	}
 
@@ -916,12 +916,7 @@ tcu::TestStatus BlendTestInstance::verifyImage (void)
 
 	// Compare result with reference image
 	{
-		const DeviceInterface&				vk							= m_context.getDeviceInterface();
-		const VkDevice						vkDevice					= m_context.getDevice();
-		const VkQueue						queue						= m_context.getUniversalQueue();
-		const deUint32						queueFamilyIndex			= m_context.getUniversalQueueFamilyIndex();
-		SimpleAllocator						allocator					(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::UniquePtr<tcu::TextureLevel>	result						(readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize).release());
+		de::UniquePtr<tcu::TextureLevel>	result						(readColorAttachment(m_context.getTransferService(), *m_colorImage, m_colorFormat, m_renderSize).release());
 		const tcu::Vec4						threshold					(getFormatThreshold(tcuColorFormat));
 
 		compareOk = tcu::floatThresholdCompare(m_context.getTestContext().getLog(),
@@ -660,7 +660,7 @@ DepthTestInstance::DepthTestInstance (Context&				context,
 		for (int quadNdx = 0; quadNdx < DepthTest::QUAD_COUNT; quadNdx++)
 		{
 			depthStencilStateParams.depthCompareOp	= depthCompareOps[quadNdx];
-			m_graphicsPipelines[quadNdx]			= createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
+			m_graphicsPipelines[quadNdx]			= createGraphicsPipeline(vk, vkDevice, m_context.getPipelineCache(), &graphicsPipelineParams);
 		}
 	}
 
@@ -839,12 +839,7 @@ tcu::TestStatus DepthTestInstance::verifyImage (void)
 
 	// Compare result with reference image
 	{
-		const DeviceInterface&			vk					= m_context.getDeviceInterface();
-		const VkDevice					vkDevice			= m_context.getDevice();
-		const VkQueue					queue				= m_context.getUniversalQueue();
-		const deUint32					queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
-		SimpleAllocator					allocator			(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize);
+		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(m_context.getTransferService(), *m_colorImage, m_colorFormat, m_renderSize);
 
 		compareOk = tcu::intThresholdPositionDeviationCompare(m_context.getTestContext().getLog(),
 															  "IntImageCompare",
@@ -185,6 +185,7 @@ Move<VkRenderPass> makeRenderPass (const DeviceInterface& vk,
 
 Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&		vk,
 									   const VkDevice				device,
+									   const VkPipelineCache		pipelineCache,
 									   const VkPipelineLayout		pipelineLayout,
 									   const VkRenderPass			renderPass,
 									   const VkShaderModule			vertexModule,
@@ -384,7 +385,7 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&		vk,
 		0,													// deInt32											basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &graphicsPipelineInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &graphicsPipelineInfo);
 }
 
 Move<VkImage> makeImage (const DeviceInterface&		vk,
@@ -588,7 +589,7 @@ tcu::TestStatus test (Context& context, const CaseDef caseDef)
 			imageViewType, COLOR_FORMAT, makeColorSubresourceRange(layerNdx, 1))));
 		attachmentHandles.push_back(**colorAttachments.back());
 
-		pipeline.push_back(makeSharedPtr(makeGraphicsPipeline(vk, device, *pipelineLayout, *renderPass, *vertexModule, *fragmentModule,
+		pipeline.push_back(makeSharedPtr(makeGraphicsPipeline(vk, device, context.getPipelineCache(), *pipelineLayout, *renderPass, *vertexModule, *fragmentModule,
 			caseDef.renderSize, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP, layerNdx, true, caseDef.multisample)));
 	}
 
@@ -983,7 +984,7 @@ tcu::TestStatus testNoAtt (Context& context, const bool multisample)
 	}
 
 	// Create render pass and pipeline
-	pipeline.push_back(makeSharedPtr(makeGraphicsPipeline(vk, device, *pipelineLayout, *renderPass, *vertexModule, *fragmentModule,
+	pipeline.push_back(makeSharedPtr(makeGraphicsPipeline(vk, device, context.getPipelineCache(), *pipelineLayout, *renderPass, *vertexModule, *fragmentModule,
 		renderSize, VK_PRIMITIVE_TOPOLOGY_POINT_LIST, 0, false, multisample)));
 	framebuffer = makeFramebuffer(vk, device, *renderPass, 0, DE_NULL, renderSize.x(), renderSize.y());
 
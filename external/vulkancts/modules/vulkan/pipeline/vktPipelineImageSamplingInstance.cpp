@@ -25,6 +25,7 @@
 #include "vktPipelineImageSamplingInstance.hpp"
 #include "vktPipelineClearUtil.hpp"
 #include "vktPipelineReferenceRenderer.hpp"
+#include "vktTransferService.hpp"
 #include "vkBuilderUtil.hpp"
 #include "vkImageUtil.hpp"
 #include "vkPrograms.hpp"
@@ -152,7 +153,6 @@ ImageSamplingInstance::ImageSamplingInstance (Context&							context,
 {
 	const DeviceInterface&		vk						= context.getDeviceInterface();
 	const VkDevice				vkDevice				= context.getDevice();
-	const VkQueue				queue					= context.getUniversalQueue();
 	const deUint32				queueFamilyIndex		= context.getUniversalQueueFamilyIndex();
 	SimpleAllocator				memAlloc				(vk, vkDevice, getPhysicalDeviceMemoryProperties(context.getInstanceInterface(), context.getPhysicalDevice()));
 	const VkComponentMapping	componentMappingRGBA	= { VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A };
@@ -249,7 +249,7 @@ ImageSamplingInstance::ImageSamplingInstance (Context&							context,
 			VK_CHECK(vk.bindImageMemory(vkDevice, **m_images[imgNdx], (*m_imageAllocs[imgNdx])->getMemory(), (*m_imageAllocs[imgNdx])->getOffset()));
 
 			// Upload texture data
-			uploadTestTexture(vk, vkDevice, queue, queueFamilyIndex, memAlloc, *m_texture, **m_images[imgNdx]);
+			recordTestTextureUpload(context.getTransferService(), *m_texture, **m_images[imgNdx]);
 
 			// Create image view and sampler
 			const VkImageViewCreateInfo imageViewParams =
@@ -267,6 +267,9 @@ ImageSamplingInstance::ImageSamplingInstance (Context&							context,
 			m_imageViews[imgNdx] = SharedImageViewPtr(new UniqueImageView(createImageView(vk, vkDevice, &imageViewParams)));
 		}
 
+		// Uploads to all images are executed in one submission
+		context.getTransferService().submit();
+
 		m_sampler	= createSampler(vk, vkDevice, &m_samplerParams);
 	}
 
@@ -663,7 +666,7 @@ ImageSamplingInstance::ImageSamplingInstance (Context&							context,
 			0u													// deInt32											basePipelineIndex;
 		};
 
-		m_graphicsPipeline	= createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
+		m_graphicsPipeline	= createGraphicsPipeline(vk, vkDevice, m_context.getPipelineCache(), &graphicsPipelineParams);
 	}
 
 	// Create vertex buffer
@@ -1399,11 +1402,7 @@ tcu::TestStatus ImageSamplingInstance::verifyImage (void)
 		for (int imgNdx = 0; imgNdx < m_imageCount; ++imgNdx)
 		{
 			// Read back result image
-			UniquePtr<tcu::TextureLevel>		result			(readColorAttachment(m_context.getDeviceInterface(),
-																					 m_context.getDevice(),
-																					 m_context.getUniversalQueue(),
-																					 m_context.getUniversalQueueFamilyIndex(),
-																					 m_context.getDefaultAllocator(),
+			UniquePtr<tcu::TextureLevel>		result			(readColorAttachment(m_context.getTransferService(),
 																					 **m_colorImages[imgNdx],
 																					 m_colorFormat,
 																					 m_renderSize));
@@ -23,6 +23,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "vktPipelineImageUtil.hpp"
+#include "vktTransferService.hpp"
 #include "vkImageUtil.hpp"
 #include "vkMemUtil.hpp"
 #include "vkQueryUtil.hpp"
@@ -209,41 +210,23 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	v
 													vk::VkFormat				format,
 													const tcu::UVec2&			renderSize)
 {
-	Move<VkBuffer>					buffer;
-	de::MovePtr<Allocation>			bufferAlloc;
-	Move<VkCommandPool>				cmdPool;
-	Move<VkCommandBuffer>			cmdBuffer;
-	Move<VkFence>					fence;
+	TransferService transfer (vk, device, queue, queueFamilyIndex, allocator);
+
+	return readColorAttachment(transfer, image, format, renderSize);
+}
+
+de::MovePtr<tcu::TextureLevel> readColorAttachment (TransferService&	transfer,
+													vk::VkImage			image,
+													vk::VkFormat		format,
+													const tcu::UVec2&	renderSize)
+{
+	const DeviceInterface&			vk				= transfer.getDeviceInterface();
 	const tcu::TextureFormat		tcuFormat		= mapVkFormat(format);
 	const VkDeviceSize				pixelDataSize	= renderSize.x() * renderSize.y() * tcuFormat.getPixelSize();
+	const StagingRegion				staging			= transfer.allocateStaging(pixelDataSize, 4u * tcuFormat.getPixelSize());
+	const VkCommandBuffer			cmdBuffer		= transfer.getCommandBuffer();
 	de::MovePtr<tcu::TextureLevel>	resultLevel		(new tcu::TextureLevel(tcuFormat, renderSize.x(), renderSize.y()));
 
-	// Create destination buffer
-	{
-		const VkBufferCreateInfo bufferParams =
-		{
-			VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,		// VkStructureType		sType;
-			DE_NULL,									// const void*			pNext;
-			0u,											// VkBufferCreateFlags	flags;
-			pixelDataSize,								// VkDeviceSize			size;
-			VK_BUFFER_USAGE_TRANSFER_DST_BIT,			// VkBufferUsageFlags	usage;
-			VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode		sharingMode;
-			0u,											// deUint32				queueFamilyIndexCount;
-			DE_NULL										// const deUint32*		pQueueFamilyIndices;
-		};
-
-		buffer		= createBuffer(vk, device, &bufferParams);
-		bufferAlloc = allocator.allocate(getBufferMemoryRequirements(vk, device, *buffer), MemoryRequirement::HostVisible);
-		VK_CHECK(vk.bindBufferMemory(device, *buffer, bufferAlloc->getMemory(), bufferAlloc->getOffset()));
-	}
-
-	// Create command pool and buffer
-	cmdPool		= createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, queueFamilyIndex);
-	cmdBuffer	= allocateCommandBuffer(vk, device, *cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
-
-	// Create fence
-	fence = createFence(vk, device);
-
 	// Barriers for copying image to buffer
 
 	const VkImageMemoryBarrier imageBarrier =
@@ -266,32 +249,11 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	v
 		}
 	};
 
-	const VkBufferMemoryBarrier bufferBarrier =
-	{
-		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,	// VkStructureType	sType;
-		DE_NULL,									// const void*		pNext;
-		VK_ACCESS_TRANSFER_WRITE_BIT,				// VkAccessFlags	srcAccessMask;
-		VK_ACCESS_HOST_READ_BIT,					// VkAccessFlags	dstAccessMask;
-		VK_QUEUE_FAMILY_IGNORED,					// deUint32			srcQueueFamilyIndex;
-		VK_QUEUE_FAMILY_IGNORED,					// deUint32			dstQueueFamilyIndex;
-		*buffer,									// VkBuffer			buffer;
-		0u,											// VkDeviceSize		offset;
-		pixelDataSize								// VkDeviceSize		size;
-	};
-
-	const VkCommandBufferBeginInfo cmdBufferBeginInfo =
-	{
-		VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,			// VkStructureType					sType;
-		DE_NULL,												// const void*						pNext;
-		VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,			// VkCommandBufferUsageFlags		flags;
-		(const VkCommandBufferInheritanceInfo*)DE_NULL,
-	};
-
 	// Copy image to buffer
 
 	const VkBufferImageCopy copyRegion =
 	{
-		0u,												// VkDeviceSize				bufferOffset;
+		staging.offset,									// VkDeviceSize				bufferOffset;
 		(deUint32)renderSize.x(),						// deUint32					bufferRowLength;
 		(deUint32)renderSize.y(),						// deUint32					bufferImageHeight;
 		{ VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u },		// VkImageSubresourceLayers	imageSubresource;
@@ -299,31 +261,14 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	v
 		{ renderSize.x(), renderSize.y(), 1u }			// VkExtent3D				imageExtent;
 	};
 
-	VK_CHECK(vk.beginCommandBuffer(*cmdBuffer, &cmdBufferBeginInfo));
-	vk.cmdPipelineBarrier(*cmdBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, (VkDependencyFlags)0, 0, (const VkMemoryBarrier*)DE_NULL, 0, (const VkBufferMemoryBarrier*)DE_NULL, 1, &imageBarrier);
-	vk.cmdCopyImageToBuffer(*cmdBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, *buffer, 1, &copyRegion);
-	vk.cmdPipelineBarrier(*cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (VkDependencyFlags)0, 0, (const VkMemoryBarrier*)DE_NULL, 1, &bufferBarrier, 0, (const VkImageMemoryBarrier*)DE_NULL);
-	VK_CHECK(vk.endCommandBuffer(*cmdBuffer));
-
-	const VkSubmitInfo submitInfo =
-	{
-		VK_STRUCTURE_TYPE_SUBMIT_INFO,	// VkStructureType			sType;
-		DE_NULL,						// const void*				pNext;
-		0u,								// deUint32					waitSemaphoreCount;
-		DE_NULL,						// const VkSemaphore*		pWaitSemaphores;
-		DE_NULL,
-		1u,								// deUint32					commandBufferCount;
-		&cmdBuffer.get(),				// const VkCommandBuffer*	pCommandBuffers;
-		0u,								// deUint32					signalSemaphoreCount;
-		DE_NULL							// const VkSemaphore*		pSignalSemaphores;
-	};
+	// \note Host read barrier for staging memory is added by TransferService::submit()
+	vk.cmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, (VkDependencyFlags)0, 0, (const VkMemoryBarrier*)DE_NULL, 0, (const VkBufferMemoryBarrier*)DE_NULL, 1, &imageBarrier);
+	vk.cmdCopyImageToBuffer(cmdBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, staging.buffer, 1, &copyRegion);
 
-	VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *fence));
-	VK_CHECK(vk.waitForFences(device, 1, &fence.get(), 0, ~(0ull) /* infinity */));
+	transfer.submit();
 
 	// Read buffer data
-	invalidateMappedMemoryRange(vk, device, bufferAlloc->getMemory(), bufferAlloc->getOffset(), VK_WHOLE_SIZE);
-	tcu::copy(*resultLevel, tcu::ConstPixelBufferAccess(resultLevel->getFormat(), resultLevel->getSize(), bufferAlloc->getHostPtr()));
+	tcu::copy(*resultLevel, tcu::ConstPixelBufferAccess(resultLevel->getFormat(), resultLevel->getSize(), staging.hostPtr));
 
 	return resultLevel;
 }
@@ -349,22 +294,14 @@ VkImageAspectFlags getImageAspectFlags (const tcu::TextureFormat textureFormat)
 
 } // anonymous
 
-void uploadTestTextureInternal (const DeviceInterface&			vk,
-								VkDevice						device,
-								VkQueue							queue,
-								deUint32						queueFamilyIndex,
-								Allocator&						allocator,
-								const TestTexture&				srcTexture,
-								const TestTexture*				srcStencilTexture,
-								tcu::TextureFormat				format,
-								VkImage							destImage)
+void recordTestTextureUploadInternal (TransferService&			transfer,
+									  const TestTexture&		srcTexture,
+									  const TestTexture*		srcStencilTexture,
+									  tcu::TextureFormat		format,
+									  VkImage					destImage)
 {
+	const DeviceInterface&			vk					= transfer.getDeviceInterface();
 	deUint32						bufferSize;
-	Move<VkBuffer>					buffer;
-	de::MovePtr<Allocation>			bufferAlloc;
-	Move<VkCommandPool>				cmdPool;
-	Move<VkCommandBuffer>			cmdBuffer;
-	Move<VkFence>					fence;
 	const VkImageAspectFlags		imageAspectFlags	= getImageAspectFlags(format);
 	deUint32						stencilOffset		= 0u;
 
@@ -380,31 +317,10 @@ void uploadTestTextureInternal (const DeviceInterface&			vk,
 		bufferSize		= stencilOffset + srcStencilTexture->getSize();
 	}
 
-	// Create source buffer
-	{
-		const VkBufferCreateInfo bufferParams =
-		{
-			VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,		// VkStructureType		sType;
-			DE_NULL,									// const void*			pNext;
-			0u,											// VkBufferCreateFlags	flags;
-			bufferSize,									// VkDeviceSize			size;
-			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,			// VkBufferUsageFlags	usage;
-			VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode		sharingMode;
-			0u,											// deUint32				queueFamilyIndexCount;
-			DE_NULL,									// const deUint32*		pQueueFamilyIndices;
-		};
-
-		buffer		= createBuffer(vk, device, &bufferParams);
-		bufferAlloc = allocator.allocate(getBufferMemoryRequirements(vk, device, *buffer), MemoryRequirement::HostVisible);
-		VK_CHECK(vk.bindBufferMemory(device, *buffer, bufferAlloc->getMemory(), bufferAlloc->getOffset()));
-	}
-
-	// Create command pool and buffer
-	cmdPool		= createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, queueFamilyIndex);
-	cmdBuffer	= allocateCommandBuffer(vk, device, *cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
-
-	// Create fence
-	fence = createFence(vk, device);
+	// Copy region offsets are relative to staging region start, which must be aligned to texel (or block) size and 4
+	const VkDeviceSize				stagingAlignment	= srcTexture.isCompressed() ? 16u : 4u * srcTexture.getTextureFormat().getPixelSize();
+	const StagingRegion				staging				= transfer.allocateStaging(bufferSize, stagingAlignment);
+	const VkCommandBuffer			cmdBuffer			= transfer.getCommandBuffer();
 
 	// Barriers for copying buffer to image
 	const VkBufferMemoryBarrier preBufferBarrier =
@@ -415,8 +331,8 @@ void uploadTestTextureInternal (const DeviceInterface&			vk,
 		VK_ACCESS_TRANSFER_READ_BIT,				// VkAccessFlags	dstAccessMask;
 		VK_QUEUE_FAMILY_IGNORED,					// deUint32			srcQueueFamilyIndex;
 		VK_QUEUE_FAMILY_IGNORED,					// deUint32			dstQueueFamilyIndex;
-		*buffer,									// VkBuffer			buffer;
-		0u,											// VkDeviceSize		offset;
+		staging.buffer,								// VkBuffer			buffer;
+		staging.offset,								// VkDeviceSize		offset;
 		bufferSize									// VkDeviceSize		size;
 	};
 
@@ -460,24 +376,16 @@ void uploadTestTextureInternal (const DeviceInterface&			vk,
 		}
 	};
 
-	const VkCommandBufferBeginInfo cmdBufferBeginInfo =
-	{
-		VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,	// VkStructureType					sType;
-		DE_NULL,										// const void*						pNext;
-		VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,	// VkCommandBufferUsageFlags		flags;
-		(const VkCommandBufferInheritanceInfo*)DE_NULL,
-	};
-
 	std::vector<VkBufferImageCopy>	copyRegions		= srcTexture.getBufferCopyRegions();
 
 	// Write buffer data
-	srcTexture.write(reinterpret_cast<deUint8*>(bufferAlloc->getHostPtr()));
+	srcTexture.write(reinterpret_cast<deUint8*>(staging.hostPtr));
 
 	if (srcStencilTexture != DE_NULL)
 	{
 		DE_ASSERT(stencilOffset != 0u);
 
-		srcStencilTexture->write(reinterpret_cast<deUint8*>(bufferAlloc->getHostPtr()) + stencilOffset);
+		srcStencilTexture->write(reinterpret_cast<deUint8*>(staging.hostPtr) + stencilOffset);
 
 		std::vector<VkBufferImageCopy>	stencilCopyRegions = srcStencilTexture->getBufferCopyRegions();
 		for (size_t regionIdx = 0; regionIdx < stencilCopyRegions.size(); regionIdx++)
@@ -489,40 +397,18 @@ void uploadTestTextureInternal (const DeviceInterface&			vk,
 		}
 	}
 
-	flushMappedMemoryRange(vk, device, bufferAlloc->getMemory(), bufferAlloc->getOffset(), VK_WHOLE_SIZE);
-
-	// Copy buffer to image
-	VK_CHECK(vk.beginCommandBuffer(*cmdBuffer, &cmdBufferBeginInfo));
-	vk.cmdPipelineBarrier(*cmdBuffer, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, (VkDependencyFlags)0, 0, (const VkMemoryBarrier*)DE_NULL, 1, &preBufferBarrier, 1, &preImageBarrier);
-	vk.cmdCopyBufferToImage(*cmdBuffer, *buffer, destImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (deUint32)copyRegions.size(), copyRegions.data());
-	vk.cmdPipelineBarrier(*cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (VkDependencyFlags)0, 0, (const VkMemoryBarrier*)DE_NULL, 0, (const VkBufferMemoryBarrier*)DE_NULL, 1, &postImageBarrier);
-
-	VK_CHECK(vk.endCommandBuffer(*cmdBuffer));
-
-	const VkSubmitInfo submitInfo =
-	{
-		VK_STRUCTURE_TYPE_SUBMIT_INFO,	// VkStructureType			sType;
-		DE_NULL,						// const void*				pNext;
-		0u,								// deUint32					waitSemaphoreCount;
-		DE_NULL,						// const VkSemaphore*		pWaitSemaphores;
-		DE_NULL,
-		1u,								// deUint32					commandBufferCount;
-		&cmdBuffer.get(),				// const VkCommandBuffer*	pCommandBuffers;
-		0u,								// deUint32					signalSemaphoreCount;
-		DE_NULL							// const VkSemaphore*		pSignalSemaphores;
-	};
+	for (size_t regionIdx = 0; regionIdx < copyRegions.size(); regionIdx++)
+		copyRegions[regionIdx].bufferOffset += staging.offset;
 
-	VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *fence));
-	VK_CHECK(vk.waitForFences(device, 1, &fence.get(), true, ~(0ull) /* infinity */));
+	// Copy buffer to image; staging memory is flushed by TransferService::submit()
+	vk.cmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, (VkDependencyFlags)0, 0, (const VkMemoryBarrier*)DE_NULL, 1, &preBufferBarrier, 1, &preImageBarrier);
+	vk.cmdCopyBufferToImage(cmdBuffer, staging.buffer, destImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (deUint32)copyRegions.size(), copyRegions.data());
+	vk.cmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (VkDependencyFlags)0, 0, (const VkMemoryBarrier*)DE_NULL, 0, (const VkBufferMemoryBarrier*)DE_NULL, 1, &postImageBarrier);
 }
 
-void uploadTestTexture (const DeviceInterface&			vk,
-						VkDevice						device,
-						VkQueue							queue,
-						deUint32						queueFamilyIndex,
-						Allocator&						allocator,
-						const TestTexture&				srcTexture,
-						VkImage							destImage)
+void recordTestTextureUpload (TransferService&		transfer,
+							  const TestTexture&	srcTexture,
+							  VkImage				destImage)
 {
 	if (tcu::isCombinedDepthStencilType(srcTexture.getTextureFormat().type))
 	{
@@ -552,10 +438,31 @@ void uploadTestTexture (const DeviceInterface&			vk,
 		if (tcu::hasStencilComponent(srcTexture.getTextureFormat().order))
 			srcStencilTexture = srcTexture.copy(tcu::getEffectiveDepthStencilTextureFormat(srcTexture.getTextureFormat(), tcu::Sampler::MODE_STENCIL));
 
-		uploadTestTextureInternal(vk, device, queue, queueFamilyIndex, allocator, *srcDepthTexture, srcStencilTexture.get(), srcTexture.getTextureFormat(), destImage);
+		recordTestTextureUploadInternal(transfer, *srcDepthTexture, srcStencilTexture.get(), srcTexture.getTextureFormat(), destImage);
 	}
 	else
-		uploadTestTextureInternal(vk, device, queue, queueFamilyIndex, allocator, srcTexture, DE_NULL, srcTexture.getTextureFormat(), destImage);
+		recordTestTextureUploadInternal(transfer, srcTexture, DE_NULL, srcTexture.getTextureFormat(), destImage);
+}
+
+void uploadTestTexture (TransferService&	transfer,
+						const TestTexture&	srcTexture,
+						VkImage				destImage)
+{
+	recordTestTextureUpload(transfer, srcTexture, destImage);
+	transfer.submit();
+}
+
+void uploadTestTexture (const DeviceInterface&			vk,
+						VkDevice						device,
+						VkQueue							queue,
+						deUint32						queueFamilyIndex,
+						Allocator&						allocator,
+						const TestTexture&				srcTexture,
+						VkImage							destImage)
+{
+	TransferService transfer (vk, device, queue, queueFamilyIndex, allocator);
+
+	uploadTestTexture(transfer, srcTexture, destImage);
 }
 
 // Utilities for test textures
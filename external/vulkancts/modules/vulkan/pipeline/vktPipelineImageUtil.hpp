@@ -35,6 +35,9 @@
 
 namespace vkt
 {
+
+class TransferService;
+
 namespace pipeline
 {
 
@@ -79,6 +82,11 @@ de::MovePtr<tcu::TextureLevel>	readColorAttachment			 (const vk::DeviceInterface
 															  vk::VkFormat					format,
 															  const tcu::UVec2&				renderSize);
 
+de::MovePtr<tcu::TextureLevel>	readColorAttachment			 (TransferService&				transfer,
+															  vk::VkImage					image,
+															  vk::VkFormat					format,
+															  const tcu::UVec2&				renderSize);
+
 /*--------------------------------------------------------------------*//*!
  * Uploads data from a test texture to a destination VK image.
  *
@@ -93,6 +101,20 @@ void							uploadTestTexture			(const vk::DeviceInterface&		vk,
 															 const TestTexture&				testTexture,
 															 vk::VkImage					destImage);
 
+void							uploadTestTexture			(TransferService&				transfer,
+															 const TestTexture&				testTexture,
+															 vk::VkImage					destImage);
+
+/*--------------------------------------------------------------------*//*!
+ * Records upload of test texture without submitting it, so that
+ * uploads to multiple images can share a single submission.
+ *
+ * Copy is executed on next TransferService::submit().
+ *//*--------------------------------------------------------------------*/
+void							recordTestTextureUpload		(TransferService&				transfer,
+															 const TestTexture&				testTexture,
+															 vk::VkImage					destImage);
+
 class TestTexture
 {
 public:
@@ -174,7 +174,8 @@ Move<VkPipeline> makeComputePipeline (const DeviceInterface&		vk,
 									  const VkDevice				device,
 									  const VkPipelineLayout		pipelineLayout,
 									  const VkShaderModule			shaderModule,
-									  const VkSpecializationInfo*	specInfo)
+									  const VkSpecializationInfo*	specInfo,
+									  const VkPipelineCache			pipelineCache)
 {
 	const VkPipelineShaderStageCreateInfo shaderStageInfo =
 	{
@@ -196,7 +197,7 @@ Move<VkPipeline> makeComputePipeline (const DeviceInterface&		vk,
 		DE_NULL,											// VkPipeline						basePipelineHandle;
 		0,													// deInt32							basePipelineIndex;
 	};
-	return createComputePipeline(vk, device, DE_NULL , &pipelineInfo);
+	return createComputePipeline(vk, device, pipelineCache, &pipelineInfo);
 }
 
 Move<VkImageView> makeImageView (const DeviceInterface&			vk,
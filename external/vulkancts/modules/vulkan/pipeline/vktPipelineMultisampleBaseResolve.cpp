@@ -393,7 +393,7 @@ tcu::TestStatus MSInstanceBaseResolve::iterate (void)
 	};
 
 	// Create graphics pipeline
-	const Unique<VkPipeline> graphicsPipeline(createGraphicsPipeline(deviceInterface, device, DE_NULL, &graphicsPipelineInfo));
+	const Unique<VkPipeline> graphicsPipeline(createGraphicsPipeline(deviceInterface, device, m_context.getPipelineCache(), &graphicsPipelineInfo));
 
 	// Create command buffer for compute and transfer oparations
 	const Unique<VkCommandPool>	  commandPool(createCommandPool(deviceInterface, device, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,  queueFamilyIndex));
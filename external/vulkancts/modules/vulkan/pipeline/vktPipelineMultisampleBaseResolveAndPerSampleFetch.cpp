@@ -550,7 +550,7 @@ tcu::TestStatus MSInstanceBaseResolveAndPerSampleFetch::iterate (void)
 		0u,																// deInt32											basePipelineIndex;
 	};
 
-	const Unique<VkPipeline> graphicsPipelineMSPass(createGraphicsPipeline(deviceInterface, device, DE_NULL, &graphicsPipelineInfoMSPass));
+	const Unique<VkPipeline> graphicsPipelineMSPass(createGraphicsPipeline(deviceInterface, device, m_context.getPipelineCache(), &graphicsPipelineInfoMSPass));
 
 	typedef de::SharedPtr<Unique<VkPipeline> > VkPipelineSp;
 	std::vector<VkPipelineSp> graphicsPipelinesPerSampleFetch(numSamples);
@@ -684,7 +684,7 @@ tcu::TestStatus MSInstanceBaseResolveAndPerSampleFetch::iterate (void)
 				0u,																// deInt32											basePipelineIndex;
 			};
 
-			graphicsPipelinesPerSampleFetch[sampleNdx] = makeVkSharedPtr(createGraphicsPipeline(deviceInterface, device, DE_NULL, &graphicsPipelineInfo));
+			graphicsPipelinesPerSampleFetch[sampleNdx] = makeVkSharedPtr(createGraphicsPipeline(deviceInterface, device, m_context.getPipelineCache(), &graphicsPipelineInfo));
 		}
 	}
 
@@ -1915,7 +1915,7 @@ void MultisampleRenderer::initialize (Context&									context,
 		for (deUint32 i = 0u; i < numTopologies; ++i)
 		{
 			inputAssemblyStateParams.topology = pTopology[i];
-			m_graphicsPipelines.push_back(VkPipelineSp(new Unique<VkPipeline>(createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams))));
+			m_graphicsPipelines.push_back(VkPipelineSp(new Unique<VkPipeline>(createGraphicsPipeline(vk, vkDevice, m_context.getPipelineCache(), &graphicsPipelineParams))));
 		}
 	}
 
@@ -2075,8 +2075,6 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render (void)
 	const DeviceInterface&		vk					= m_context.getDeviceInterface();
 	const VkDevice				vkDevice			= m_context.getDevice();
 	const VkQueue				queue				= m_context.getUniversalQueue();
-	const deUint32				queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
-	SimpleAllocator				allocator			(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
 	const VkSubmitInfo			submitInfo	=
 	{
 		VK_STRUCTURE_TYPE_SUBMIT_INFO,	// VkStructureType			sType;
@@ -2094,7 +2092,7 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render (void)
 	VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *m_fence));
 	VK_CHECK(vk.waitForFences(vkDevice, 1, &m_fence.get(), true, ~(0ull) /* infinity*/));
 
-	return readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_resolveImage, m_colorFormat, m_renderSize.cast<deUint32>());
+	return readColorAttachment(m_context.getTransferService(), *m_resolveImage, m_colorFormat, m_renderSize.cast<deUint32>());
 }
 
 } // anonymous
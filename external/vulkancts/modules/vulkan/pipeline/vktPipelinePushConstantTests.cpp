@@ -1040,7 +1040,7 @@ PushConstantGraphicsTestInstance::PushConstantGraphicsTestInstance (Context&
 			0u													// deInt32											basePipelineIndex;
 		};
 
-		m_graphicsPipelines = createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
+		m_graphicsPipelines = createGraphicsPipeline(vk, vkDevice, m_context.getPipelineCache(), &graphicsPipelineParams);
 	}
 
 	// Create vertex buffer
@@ -1282,12 +1282,7 @@ tcu::TestStatus PushConstantGraphicsTestInstance::verifyImage (void)
 
 	// Compare result with reference image
 	{
-		const DeviceInterface&			vk					= m_context.getDeviceInterface();
-		const VkDevice					vkDevice			= m_context.getDevice();
-		const VkQueue					queue				= m_context.getUniversalQueue();
-		const deUint32					queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
-		SimpleAllocator					allocator			(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize);
+		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(m_context.getTransferService(), *m_colorImage, m_colorFormat, m_renderSize);
 
 		compareOk = tcu::intThresholdPositionDeviationCompare(m_context.getTestContext().getLog(),
 															  "IntImageCompare",
@@ -1487,7 +1482,7 @@ PushConstantComputeTestInstance::PushConstantComputeTestInstance (Context&					c
 			0u,														// int32_t                                     basePipelineIndex;
 		};
 
-		m_computePipelines = createComputePipeline(vk, vkDevice, (vk::VkPipelineCache)0u, &createInfo);
+		m_computePipelines = createComputePipeline(vk, vkDevice, m_context.getPipelineCache(), &createInfo);
 	}
 
 	// Create command pool
@@ -26,6 +26,8 @@
 #include "vktPipelineClearUtil.hpp"
 #include "rrShadingContext.hpp"
 #include "rrVertexAttrib.hpp"
+#include "deMutex.hpp"
+#include "deParallel.hpp"
 
 namespace vkt
 {
@@ -34,6 +36,91 @@ namespace pipeline
 
 using namespace vk;
 
+namespace
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Pool of reference render target buffers
+ *
+ * Pipeline test groups create a reference renderer of the same size and
+ * format for case after case. Released buffers are kept for reuse
+ * instead of being freed and reallocated.
+ *//*--------------------------------------------------------------------*/
+class TextureLevelPool
+{
+public:
+									TextureLevelPool	(void) {}
+									~TextureLevelPool	(void);
+
+	de::MovePtr<tcu::TextureLevel>	acquire				(const tcu::TextureFormat& format, int width, int height, int depth);
+	void							release				(de::MovePtr<tcu::TextureLevel> level);
+
+private:
+	enum
+	{
+		MAX_POOLED_LEVELS	= 16
+	};
+
+									TextureLevelPool	(const TextureLevelPool&);	// not allowed!
+	TextureLevelPool&				operator=			(const TextureLevelPool&);	// not allowed!
+
+	de::Mutex						m_lock;
+	std::vector<tcu::TextureLevel*>	m_levels;			//!< Most recently released last.
+};
+
+TextureLevelPool::~TextureLevelPool (void)
+{
+	for (size_t ndx = 0; ndx < m_levels.size(); ndx++)
+		delete m_levels[ndx];
+}
+
+de::MovePtr<tcu::TextureLevel> TextureLevelPool::acquire (const tcu::TextureFormat& format, int width, int height, int depth)
+{
+	{
+		const de::ScopedLock lock (m_lock);
+
+		for (size_t ndx = m_levels.size(); ndx-- > 0;)
+		{
+			tcu::TextureLevel* const level = m_levels[ndx];
+
+			if (level->getFormat() == format && level->getSize() == tcu::IVec3(width, height, depth))
+			{
+				m_levels.erase(m_levels.begin() + ndx);
+				return de::MovePtr<tcu::TextureLevel>(level);
+			}
+		}
+	}
+
+	return de::MovePtr<tcu::TextureLevel>(new tcu::TextureLevel(format, width, height, depth));
+}
+
+void TextureLevelPool::release (de::MovePtr<tcu::TextureLevel> level)
+{
+	tcu::TextureLevel* evicted = DE_NULL;
+
+	if (!level)
+		return;
+
+	{
+		const de::ScopedLock lock (m_lock);
+
+		m_levels.push_back(level.get());
+		level.release();
+
+		if (m_levels.size() > MAX_POOLED_LEVELS)
+		{
+			evicted = m_levels.front();
+			m_levels.erase(m_levels.begin());
+		}
+	}
+
+	delete evicted;
+}
+
+TextureLevelPool s_textureLevelPool;
+
+} // anonymous
+
 rr::BlendFunc mapVkBlendFactor (VkBlendFactor blend)
 {
 	switch (blend)
@@ -160,6 +247,75 @@ tcu::Vec4 swizzle (const tcu::Vec4& color, const tcu::UVec4& swizzle)
 					 channelValues[swizzle.w()]);
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Renders recorded draws to a range of render target rows
+ *
+ * Rasterization is limited to the rows by scissoring, so bands touch
+ * disjoint pixels and can be rendered concurrently.
+ *//*--------------------------------------------------------------------*/
+class ReferenceRenderer::BandRenderer : public de::RangeTask
+{
+public:
+	BandRenderer (const std::vector<DrawCall>& drawCalls, const rr::RenderTarget& renderTarget, const rr::Program& program, int surfaceWidth)
+		: m_drawCalls		(drawCalls)
+		, m_renderTarget	(renderTarget)
+		, m_program			(program)
+		, m_surfaceWidth	(surfaceWidth)
+	{
+	}
+
+	void execute (int begin, int end)
+	{
+		const rr::Renderer renderer;
+
+		for (size_t drawNdx = 0; drawNdx < m_drawCalls.size(); drawNdx++)
+		{
+			const DrawCall&			drawCall		= m_drawCalls[drawNdx];
+			const rr::PrimitiveList	primitives		(drawCall.primitive, (int)drawCall.positions.size(), 0);
+			rr::RenderState			renderState		= drawCall.renderState;
+			rr::WindowRectangle&	scissor			= renderState.fragOps.scissorRectangle;
+			rr::VertexAttrib		vertexAttribs[2];
+
+			if (renderState.fragOps.scissorTestEnabled)
+			{
+				const int bottom	= de::max(scissor.bottom, begin);
+				const int top		= de::min(scissor.bottom + scissor.height, end);
+
+				if (bottom >= top)
+					continue;
+
+				scissor.bottom	= bottom;
+				scissor.height	= top - bottom;
+			}
+			else
+			{
+				renderState.fragOps.scissorTestEnabled	= true;
+				scissor									= rr::WindowRectangle(0, begin, m_surfaceWidth, end - begin);
+			}
+
+			// \note Reference shaders don't use derivatives, so quad alignment doesn't matter.
+			renderState.rasterization.clipToScissor = true;
+
+			// Position attribute
+			vertexAttribs[0].type		= rr::VERTEXATTRIBTYPE_FLOAT;
+			vertexAttribs[0].size		= 4;
+			vertexAttribs[0].pointer	= drawCall.positions.data();
+			// Color or UV attribute
+			vertexAttribs[1].type		= rr::VERTEXATTRIBTYPE_FLOAT;
+			vertexAttribs[1].size		= 4;
+			vertexAttribs[1].pointer	= drawCall.attributes.data();
+
+			renderer.draw(rr::DrawCommand(renderState, m_renderTarget, m_program, 2, vertexAttribs, primitives));
+		}
+	}
+
+private:
+	const std::vector<DrawCall>&	m_drawCalls;
+	const rr::RenderTarget&			m_renderTarget;
+	const rr::Program&				m_program;
+	const int						m_surfaceWidth;
+};
+
 ReferenceRenderer::ReferenceRenderer(int						surfaceWidth,
 									 int						surfaceHeight,
 									 int						numSamples,
@@ -171,6 +327,7 @@ ReferenceRenderer::ReferenceRenderer(int						surfaceWidth,
 	, m_numSamples			(numSamples)
 	, m_colorFormat			(colorFormat)
 	, m_depthStencilFormat	(depthStencilFormat)
+	, m_renderTarget		(DE_NULL)
 	, m_program				(program)
 {
 	const tcu::TextureChannelClass	formatClass				= tcu::getTextureChannelClass(colorFormat.type);
@@ -179,18 +336,18 @@ ReferenceRenderer::ReferenceRenderer(int						surfaceWidth,
 	const bool						hasStencilBufferOnly	= (m_depthStencilFormat.order == tcu::TextureFormat::S);
 	const int						actualSamples			= (formatClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER || formatClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER)? 1: m_numSamples;
 
-	m_colorBuffer.setStorage(m_colorFormat, actualSamples, m_surfaceWidth, m_surfaceHeight);
-	m_resolveColorBuffer.setStorage(m_colorFormat, m_surfaceWidth, m_surfaceHeight);
+	m_colorBuffer			= s_textureLevelPool.acquire(m_colorFormat, actualSamples, m_surfaceWidth, m_surfaceHeight);
+	m_resolveColorBuffer	= s_textureLevelPool.acquire(m_colorFormat, m_surfaceWidth, m_surfaceHeight, 1);
 
 	if (formatClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER)
 	{
-		tcu::clear(m_colorBuffer.getAccess(), defaultClearColorInt(m_colorFormat));
-		tcu::clear(m_resolveColorBuffer.getAccess(), defaultClearColorInt(m_colorFormat));
+		tcu::clear(m_colorBuffer->getAccess(), defaultClearColorInt(m_colorFormat));
+		tcu::clear(m_resolveColorBuffer->getAccess(), defaultClearColorInt(m_colorFormat));
 	}
 	else if (formatClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER)
 	{
-		tcu::clear(m_colorBuffer.getAccess(), defaultClearColorUint(m_colorFormat));
-		tcu::clear(m_resolveColorBuffer.getAccess(), defaultClearColorUint(m_colorFormat));
+		tcu::clear(m_colorBuffer->getAccess(), defaultClearColorUint(m_colorFormat));
+		tcu::clear(m_resolveColorBuffer->getAccess(), defaultClearColorUint(m_colorFormat));
 	}
 	else
 	{
@@ -199,128 +356,132 @@ ReferenceRenderer::ReferenceRenderer(int						surfaceWidth,
 		if (isSRGB(m_colorFormat))
 			clearColor = tcu::linearToSRGB(clearColor);
 
-		tcu::clear(m_colorBuffer.getAccess(), clearColor);
-		tcu::clear(m_resolveColorBuffer.getAccess(), clearColor);
+		tcu::clear(m_colorBuffer->getAccess(), clearColor);
+		tcu::clear(m_resolveColorBuffer->getAccess(), clearColor);
 	}
 
 	if (hasDepthStencil)
 	{
+		m_depthStencilBuffer = s_textureLevelPool.acquire(m_depthStencilFormat, actualSamples, surfaceWidth, surfaceHeight);
+
 		if (hasDepthBufferOnly)
 		{
-			m_depthStencilBuffer.setStorage(m_depthStencilFormat, actualSamples, surfaceWidth, surfaceHeight);
-			tcu::clearDepth(m_depthStencilBuffer.getAccess(), defaultClearDepth());
+			tcu::clearDepth(m_depthStencilBuffer->getAccess(), defaultClearDepth());
 
-			m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer.getAccess()),
-												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer.getAccess()));
+			m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer->getAccess()),
+												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer->getAccess()));
 		}
 		else if (hasStencilBufferOnly)
 		{
-			m_depthStencilBuffer.setStorage(m_depthStencilFormat, actualSamples, surfaceWidth, surfaceHeight);
-			tcu::clearStencil(m_depthStencilBuffer.getAccess(), defaultClearStencil());
+			tcu::clearStencil(m_depthStencilBuffer->getAccess(), defaultClearStencil());
 
-			m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer.getAccess()),
+			m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer->getAccess()),
 												  rr::MultisamplePixelBufferAccess(),
-												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer.getAccess()));
+												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer->getAccess()));
 		}
 		else
 		{
-			m_depthStencilBuffer.setStorage(m_depthStencilFormat, actualSamples, surfaceWidth, surfaceHeight);
+			tcu::clearDepth(m_depthStencilBuffer->getAccess(), defaultClearDepth());
+			tcu::clearStencil(m_depthStencilBuffer->getAccess(), defaultClearStencil());
 
-			tcu::clearDepth(m_depthStencilBuffer.getAccess(), defaultClearDepth());
-			tcu::clearStencil(m_depthStencilBuffer.getAccess(), defaultClearStencil());
-
-			m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer.getAccess()),
-												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer.getAccess()),
-												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer.getAccess()));
+			m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer->getAccess()),
+												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer->getAccess()),
+												  rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencilBuffer->getAccess()));
 		}
 	}
 	else
 	{
-		m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer.getAccess()));
+		m_renderTarget = new rr::RenderTarget(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_colorBuffer->getAccess()));
 	}
 }
 
 ReferenceRenderer::~ReferenceRenderer (void)
 {
 	delete m_renderTarget;
+
+	s_textureLevelPool.release(m_colorBuffer);
+	s_textureLevelPool.release(m_resolveColorBuffer);
+	s_textureLevelPool.release(m_depthStencilBuffer);
 }
 
 void ReferenceRenderer::colorClear(const tcu::Vec4& color)
 {
-	tcu::clear(m_colorBuffer.getAccess(), color);
-	tcu::clear(m_resolveColorBuffer.getAccess(), color);
+	flush();
+
+	tcu::clear(m_colorBuffer->getAccess(), color);
+	tcu::clear(m_resolveColorBuffer->getAccess(), color);
 }
 
 void ReferenceRenderer::draw (const rr::RenderState&			renderState,
 							  const rr::PrimitiveType			primitive,
 							  const std::vector<Vertex4RGBA>&	vertexBuffer)
 {
-	const rr::PrimitiveList primitives(primitive, (int)vertexBuffer.size(), 0);
-
-	std::vector<tcu::Vec4> positions;
-	std::vector<tcu::Vec4> colors;
+	m_drawCalls.push_back(DrawCall(renderState, primitive));
 
-	for (size_t vertexNdx = 0; vertexNdx < vertexBuffer.size(); vertexNdx++)
 	{
-		const Vertex4RGBA& v = vertexBuffer[vertexNdx];
-		positions.push_back(v.position);
-		colors.push_back(v.color);
-	}
-
-	rr::VertexAttrib vertexAttribs[2];
-
-	// Position attribute
-	vertexAttribs[0].type		= rr::VERTEXATTRIBTYPE_FLOAT;
-	vertexAttribs[0].size		= 4;
-	vertexAttribs[0].pointer	= positions.data();
-	// UV attribute
-	vertexAttribs[1].type		= rr::VERTEXATTRIBTYPE_FLOAT;
-	vertexAttribs[1].size		= 4;
-	vertexAttribs[1].pointer	= colors.data();
+		DrawCall& drawCall = m_drawCalls.back();
 
-	rr::DrawCommand drawQuadCommand(renderState, *m_renderTarget, *m_program, 2, vertexAttribs, primitives);
+		drawCall.positions.resize(vertexBuffer.size());
+		drawCall.attributes.resize(vertexBuffer.size());
 
-	m_renderer.draw(drawQuadCommand);
+		for (size_t vertexNdx = 0; vertexNdx < vertexBuffer.size(); vertexNdx++)
+		{
+			const Vertex4RGBA& v = vertexBuffer[vertexNdx];
+			drawCall.positions[vertexNdx]	= v.position;
+			drawCall.attributes[vertexNdx]	= v.color;
+		}
+	}
 }
 
 void ReferenceRenderer::draw (const rr::RenderState&			renderState,
 							  const rr::PrimitiveType			primitive,
 							  const std::vector<Vertex4Tex4>&	vertexBuffer)
 {
-	const rr::PrimitiveList primitives(primitive, (int)vertexBuffer.size(), 0);
-
-	std::vector<tcu::Vec4> positions;
-	std::vector<tcu::Vec4> texCoords;
+	m_drawCalls.push_back(DrawCall(renderState, primitive));
 
-	for (size_t vertexNdx = 0; vertexNdx < vertexBuffer.size(); vertexNdx++)
 	{
-		const Vertex4Tex4& v = vertexBuffer[vertexNdx];
-		positions.push_back(v.position);
-		texCoords.push_back(v.texCoord);
+		DrawCall& drawCall = m_drawCalls.back();
+
+		drawCall.positions.resize(vertexBuffer.size());
+		drawCall.attributes.resize(vertexBuffer.size());
+
+		for (size_t vertexNdx = 0; vertexNdx < vertexBuffer.size(); vertexNdx++)
+		{
+			const Vertex4Tex4& v = vertexBuffer[vertexNdx];
+			drawCall.positions[vertexNdx]	= v.position;
+			drawCall.attributes[vertexNdx]	= v.texCoord;
+		}
 	}
+}
 
-	rr::VertexAttrib vertexAttribs[2];
+void ReferenceRenderer::flush (void)
+{
+	// Aim for at least ~64k sample writes per thread, smaller jobs are faster to render serially.
+	const int		minSamplesPerThread	= 64*1024;
+	const int		rowCost				= de::max(m_surfaceWidth * m_renderTarget->getNumSamples() * (int)m_drawCalls.size(), 1);
 
-	// Position attribute
-	vertexAttribs[0].type		= rr::VERTEXATTRIBTYPE_FLOAT;
-	vertexAttribs[0].size		= 4;
-	vertexAttribs[0].pointer	= positions.data();
-	// UV attribute
-	vertexAttribs[1].type		= rr::VERTEXATTRIBTYPE_FLOAT;
-	vertexAttribs[1].size		= 4;
-	vertexAttribs[1].pointer	= texCoords.data();
+	if (m_drawCalls.empty())
+		return;
 
-	rr::DrawCommand drawQuadCommand(renderState, *m_renderTarget, *m_program, 2, vertexAttribs, primitives);
+	{
+		BandRenderer bandRenderer (m_drawCalls, *m_renderTarget, *m_program, m_surfaceWidth);
 
-	m_renderer.draw(drawQuadCommand);
+		de::parallelFor(m_surfaceHeight, de::max(minSamplesPerThread / rowCost, 1), bandRenderer);
+	}
+
+	m_drawCalls.clear();
 }
 
 tcu::PixelBufferAccess ReferenceRenderer::getAccess (void)
 {
-	rr::MultisampleConstPixelBufferAccess multiSampleAccess = rr::MultisampleConstPixelBufferAccess::fromMultisampleAccess(m_colorBuffer.getAccess());
-	rr::resolveMultisampleColorBuffer(m_resolveColorBuffer.getAccess(), multiSampleAccess);
+	flush();
+
+	{
+		rr::MultisampleConstPixelBufferAccess multiSampleAccess = rr::MultisampleConstPixelBufferAccess::fromMultisampleAccess(m_colorBuffer->getAccess());
+		rr::resolveMultisampleColorBuffer(m_resolveColorBuffer->getAccess(), multiSampleAccess);
+	}
 
-	return m_resolveColorBuffer.getAccess();
+	return m_resolveColorBuffer->getAccess();
 }
 
 const rr::ViewportState ReferenceRenderer::getViewportState (void) const
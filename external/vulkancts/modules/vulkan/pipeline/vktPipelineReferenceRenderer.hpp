@@ -32,6 +32,8 @@
 #include "tcuTextureUtil.hpp"
 #include "rrRenderState.hpp"
 #include "rrRenderer.hpp"
+#include "rrVertexAttrib.hpp"
+#include "deUniquePtr.hpp"
 #include <cstring>
 
 namespace vkt
@@ -60,20 +62,9 @@ public:
 								rr::VertexPacket* const*	packets,
 								const int					numPackets) const
 	{
-		tcu::Vec4 position;
-		tcu::Vec4 color;
-
-		for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
-		{
-			rr::VertexPacket* const packet	= packets[packetNdx];
-
-			readVertexAttrib(position, inputs[0], packet->instanceNdx, packet->vertexNdx);
-			readVertexAttrib(color, inputs[1], packet->instanceNdx, packet->vertexNdx);
-
-			packet->outputs[0]	= position;
-			packet->outputs[1]	= color;
-			packet->position	= position;
-		}
+		rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+		rr::readVertexAttribsToOutput(inputs[0], 0, packets, numPackets);
+		rr::readVertexAttribsToOutput(inputs[1], 1, packets, numPackets);
 	}
 };
 
@@ -95,20 +86,9 @@ public:
 								rr::VertexPacket* const*	packets,
 								const int					numPackets) const
 	{
-		tcu::Vec4 position;
-		tcu::Vec4 texCoord;
-
-		for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
-		{
-			rr::VertexPacket* const packet	= packets[packetNdx];
-
-			readVertexAttrib(position, inputs[0], packet->instanceNdx, packet->vertexNdx);
-			readVertexAttrib(texCoord, inputs[1], packet->instanceNdx, packet->vertexNdx);
-
-			packet->outputs[0]	= position;
-			packet->outputs[1]	= texCoord;
-			packet->position	= position;
-		}
+		rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+		rr::readVertexAttribsToOutput(inputs[0], 0, packets, numPackets);
+		rr::readVertexAttribsToOutput(inputs[1], 1, packets, numPackets);
 	}
 };
 
@@ -220,6 +200,19 @@ public:
 	}
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Reference renderer for pipeline tests
+ *
+ * Draw calls are recorded and rendered only when the result is needed,
+ * i.e. on colorClear() or getAccess(). Recorded draws are rendered in
+ * horizontal bands of the render target on multiple threads. Each band
+ * renders all draws in order, so results are identical to rendering
+ * the draws one at a time.
+ *
+ * Color and depth-stencil buffers are taken from a process-wide pool
+ * and returned to it on destruction, so buffers of the same format and
+ * size are reused across test cases.
+ *//*--------------------------------------------------------------------*/
 class ReferenceRenderer
 {
 public:
@@ -246,21 +239,42 @@ public:
 	const rr::ViewportState		getViewportState		(void) const;
 
 private:
-	rr::Renderer				m_renderer;
+	struct DrawCall
+	{
+		rr::RenderState			renderState;
+		rr::PrimitiveType		primitive;
+		std::vector<tcu::Vec4>	positions;
+		std::vector<tcu::Vec4>	attributes;		//!< Color or texture coordinate.
+
+		DrawCall (const rr::RenderState& renderState_, rr::PrimitiveType primitive_)
+			: renderState	(renderState_)
+			, primitive		(primitive_)
+		{
+		}
+	};
 
-	const int					m_surfaceWidth;
-	const int					m_surfaceHeight;
-	const int					m_numSamples;
+	class BandRenderer;
+
+									ReferenceRenderer		(const ReferenceRenderer&);	// not allowed!
+	ReferenceRenderer&				operator=				(const ReferenceRenderer&);	// not allowed!
+
+	void							flush					(void);
+
+	const int						m_surfaceWidth;
+	const int						m_surfaceHeight;
+	const int						m_numSamples;
+
+	const tcu::TextureFormat		m_colorFormat;
+	const tcu::TextureFormat		m_depthStencilFormat;
 
-	const tcu::TextureFormat	m_colorFormat;
-	const tcu::TextureFormat	m_depthStencilFormat;
+	de::MovePtr<tcu::TextureLevel>	m_colorBuffer;
+	de::MovePtr<tcu::TextureLevel>	m_resolveColorBuffer;
+	de::MovePtr<tcu::TextureLevel>	m_depthStencilBuffer;
 
-	tcu::TextureLevel			m_colorBuffer;
-	tcu::TextureLevel			m_resolveColorBuffer;
-	tcu::TextureLevel			m_depthStencilBuffer;
+	rr::RenderTarget*				m_renderTarget;
+	const rr::Program*				m_program;
 
-	rr::RenderTarget*			m_renderTarget;
-	const rr::Program*			m_program;
+	std::vector<DrawCall>			m_drawCalls;			//!< Draws not yet rendered.
 };
 
 rr::TestFunc					mapVkCompareOp				(vk::VkCompareOp compareFunc);
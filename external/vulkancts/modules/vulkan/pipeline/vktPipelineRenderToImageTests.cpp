@@ -162,6 +162,7 @@ inline int maxLayersOrDepth (const IVec4& size)
 // This is very test specific, so be careful if you want to reuse this code.
 Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&		vk,
 									   const VkDevice				device,
+									   const VkPipelineCache		pipelineCache,
 									   const VkPipeline				basePipeline,		// for derivatives
 									   const VkPipelineLayout		pipelineLayout,
 									   const VkRenderPass			renderPass,
@@ -367,7 +368,7 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&		vk,
 		-1,													// deInt32											basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &graphicsPipelineInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &graphicsPipelineInfo);
 }
 
 //! Make a render pass with one subpass per color attachment and depth/stencil attachment (if used).
@@ -914,7 +915,7 @@ tcu::TestStatus testWithSizeReduction (Context& context, const CaseDef& caseDef,
 
 			// We also have to create pipelines for each subpass
 			pipelines.push_back(makeSharedPtr(makeGraphicsPipeline(
-				vk, device, basePipeline, *pipelineLayout, *renderPass, *vertexModule, *fragmentModule, imageSize.swizzle(0, 1), VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
+				vk, device, context.getPipelineCache(), basePipeline, *pipelineLayout, *renderPass, *vertexModule, *fragmentModule, imageSize.swizzle(0, 1), VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
 				static_cast<deUint32>(subpassNdx), useDepth, useStencil)));
 
 			basePipeline = **pipelines.front();
@@ -1169,7 +1170,7 @@ void drawToMipLevel (const Context&				context,
 
 			// We also have to create pipelines for each subpass
 			pipelines.push_back(makeSharedPtr(makeGraphicsPipeline(
-				vk, device, basePipeline, pipelineLayout, *renderPass, vertexModule, fragmentModule, mipSize.swizzle(0, 1), VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
+				vk, device, context.getPipelineCache(), basePipeline, pipelineLayout, *renderPass, vertexModule, fragmentModule, mipSize.swizzle(0, 1), VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
 				static_cast<deUint32>(subpassNdx), useDepth, useStencil)));
 
 			basePipeline = **pipelines.front();
@@ -95,7 +95,8 @@ GraphicsPipelineBuilder& GraphicsPipelineBuilder::setShader (const DeviceInterfa
 Move<VkPipeline> GraphicsPipelineBuilder::build (const DeviceInterface&	vk,
 												 const VkDevice			device,
 												 const VkPipelineLayout	pipelineLayout,
-												 const VkRenderPass		renderPass)
+												 const VkRenderPass		renderPass,
+												 const VkPipelineCache	pipelineCache)
 {
 	const VkVertexInputBindingDescription vertexInputBindingDescription =
 	{
@@ -265,7 +266,7 @@ Move<VkPipeline> GraphicsPipelineBuilder::build (const DeviceInterface&	vk,
 		0,													// deInt32											basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &graphicsPipelineInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &graphicsPipelineInfo);
 }
 
 Move<VkRenderPass> makeRenderPass (const DeviceInterface&	vk,
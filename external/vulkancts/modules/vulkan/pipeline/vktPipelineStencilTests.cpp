@@ -737,7 +737,7 @@ StencilTestInstance::StencilTestInstance (Context&					context,
 			back.writeMask		= config.backWriteMask;
 			back.reference		= config.backRef;
 
-			m_graphicsPipelines[quadNdx] = createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
+			m_graphicsPipelines[quadNdx] = createGraphicsPipeline(vk, vkDevice, m_context.getPipelineCache(), &graphicsPipelineParams);
 		}
 	}
 
@@ -960,12 +960,7 @@ tcu::TestStatus StencilTestInstance::verifyImage (void)
 
 	// Compare result with reference image
 	{
-		const DeviceInterface&				vk					= m_context.getDeviceInterface();
-		const VkDevice						vkDevice			= m_context.getDevice();
-		const VkQueue						queue				= m_context.getUniversalQueue();
-		const deUint32						queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
-		SimpleAllocator						allocator			(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::UniquePtr<tcu::TextureLevel>	result				(readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize).release());
+		de::UniquePtr<tcu::TextureLevel>	result				(readColorAttachment(m_context.getTransferService(), *m_colorImage, m_colorFormat, m_renderSize).release());
 
 		compareOk = tcu::intThresholdPositionDeviationCompare(m_context.getTestContext().getLog(),
 															  "IntImageCompare",
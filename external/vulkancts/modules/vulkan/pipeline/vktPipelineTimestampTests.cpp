@@ -582,7 +582,7 @@ Move<VkPipeline> SimpleGraphicsPipelineBuilder::buildPipeline(tcu::UVec2 renderS
 		0,                                                  // deInt32                                          basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
+	return createGraphicsPipeline(vk, vkDevice, m_context.getPipelineCache(), &graphicsPipelineParams);
 }
 
 void SimpleGraphicsPipelineBuilder::enableTessellationStage(deUint32 patchControlPoints)
@@ -1742,7 +1742,7 @@ BasicComputeTestInstance::BasicComputeTestInstance(Context&              context
 		0u,                                                  // deInt32                         basePipelineIndex;
 	};
 
-	m_computePipelines = createComputePipeline(vk, vkDevice, (VkPipelineCache)0u, &pipelineCreateInfo);
+	m_computePipelines = createComputePipeline(vk, vkDevice, m_context.getPipelineCache(), &pipelineCreateInfo);
 
 }
 
@@ -563,6 +563,7 @@ Move<VkPipelineLayout> createRenderPipelineLayout (const DeviceInterface&	vkd,
 
 Move<VkPipeline> createRenderPipeline (const DeviceInterface&							vkd,
 									   VkDevice											device,
+									   VkPipelineCache									pipelineCache,
 									   VkRenderPass										renderPass,
 									   VkPipelineLayout									pipelineLayout,
 									   const vk::ProgramCollection<vk::ProgramBinary>&	binaryCollection,
@@ -765,7 +766,7 @@ Move<VkPipeline> createRenderPipeline (const DeviceInterface&							vkd,
 		0u
 	};
 
-	return createGraphicsPipeline(vkd, device, DE_NULL, &createInfo);
+	return createGraphicsPipeline(vkd, device, pipelineCache, &createInfo);
 }
 
 struct TestConfig
@@ -840,7 +841,7 @@ MultisampleRenderPassTestInstance::MultisampleRenderPassTestInstance (Context& c
 	, m_framebuffer				(createFramebuffer(context.getDeviceInterface(), context.getDevice(), *m_renderPass, m_multisampleImageViews, m_singlesampleImageViews, m_width, m_height))
 
 	, m_renderPipelineLayout	(createRenderPipelineLayout(context.getDeviceInterface(), context.getDevice()))
-	, m_renderPipeline			(createRenderPipeline(context.getDeviceInterface(), context.getDevice(), *m_renderPass, *m_renderPipelineLayout, context.getBinaryCollection(), m_width, m_height, m_sampleCount))
+	, m_renderPipeline			(createRenderPipeline(context.getDeviceInterface(), context.getDevice(), context.getPipelineCache(), *m_renderPass, *m_renderPipelineLayout, context.getBinaryCollection(), m_width, m_height, m_sampleCount))
 
 	, m_buffers					(createBuffers(context.getDeviceInterface(), context.getDevice(), m_format, m_width, m_height))
 	, m_bufferMemory			(createBufferMemory(context.getDeviceInterface(), context.getDevice(), context.getDefaultAllocator(), m_buffers))
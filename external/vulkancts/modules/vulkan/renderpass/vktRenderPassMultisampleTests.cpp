@@ -711,6 +711,7 @@ Move<VkPipelineLayout> createRenderPipelineLayout (const DeviceInterface&	vkd,
 
 Move<VkPipeline> createRenderPipeline (const DeviceInterface&							vkd,
 									   VkDevice											device,
+									   VkPipelineCache									pipelineCache,
 									   VkRenderPass										renderPass,
 									   VkPipelineLayout									pipelineLayout,
 									   const vk::ProgramCollection<vk::ProgramBinary>&	binaryCollection,
@@ -906,7 +907,7 @@ Move<VkPipeline> createRenderPipeline (const DeviceInterface&							vkd,
 		0u
 	};
 
-	return createGraphicsPipeline(vkd, device, DE_NULL, &createInfo);
+	return createGraphicsPipeline(vkd, device, pipelineCache, &createInfo);
 }
 
 Move<VkDescriptorSetLayout> createSplitDescriptorSetLayout (const DeviceInterface&	vkd,
@@ -974,6 +975,7 @@ Move<VkPipelineLayout> createSplitPipelineLayout (const DeviceInterface&	vkd,
 
 Move<VkPipeline> createSplitPipeline (const DeviceInterface&							vkd,
 									  VkDevice											device,
+									  VkPipelineCache									pipelineCache,
 									  VkRenderPass										renderPass,
 									  deUint32											subpassIndex,
 									  VkPipelineLayout									pipelineLayout,
@@ -1173,11 +1175,12 @@ Move<VkPipeline> createSplitPipeline (const DeviceInterface&							vkd,
 		0u
 	};
 
-	return createGraphicsPipeline(vkd, device, DE_NULL, &createInfo);
+	return createGraphicsPipeline(vkd, device, pipelineCache, &createInfo);
 }
 
 vector<VkPipeline> createSplitPipelines (const DeviceInterface&								vkd,
 										 VkDevice											device,
+										 VkPipelineCache									pipelineCache,
 										 VkRenderPass										renderPass,
 										 VkPipelineLayout									pipelineLayout,
 										 const vk::ProgramCollection<vk::ProgramBinary>&	binaryCollection,
@@ -1190,7 +1193,7 @@ vector<VkPipeline> createSplitPipelines (const DeviceInterface&								vkd,
 	try
 	{
 		for (size_t ndx = 0; ndx < pipelines.size(); ndx++)
-			pipelines[ndx] = createSplitPipeline(vkd, device, renderPass, (deUint32)(ndx + 1), pipelineLayout, binaryCollection, width, height, sampleCount).disown();
+			pipelines[ndx] = createSplitPipeline(vkd, device, pipelineCache, renderPass, (deUint32)(ndx + 1), pipelineLayout, binaryCollection, width, height, sampleCount).disown();
 	}
 	catch (...)
 	{
@@ -1416,11 +1419,11 @@ MultisampleRenderPassTestInstance::MultisampleRenderPassTestInstance (Context& c
 	, m_framebuffer					(createFramebuffer(context.getDeviceInterface(), context.getDevice(), *m_renderPass, *m_srcImageView, m_dstMultisampleImageViews, m_dstSinglesampleImageViews, m_width, m_height))
 
 	, m_renderPipelineLayout		(createRenderPipelineLayout(context.getDeviceInterface(), context.getDevice()))
-	, m_renderPipeline				(createRenderPipeline(context.getDeviceInterface(), context.getDevice(), *m_renderPass, *m_renderPipelineLayout, context.getBinaryCollection(), m_width, m_height, m_sampleCount))
+	, m_renderPipeline				(createRenderPipeline(context.getDeviceInterface(), context.getDevice(), context.getPipelineCache(), *m_renderPass, *m_renderPipelineLayout, context.getBinaryCollection(), m_width, m_height, m_sampleCount))
 
 	, m_splitDescriptorSetLayout	(createSplitDescriptorSetLayout(context.getDeviceInterface(), context.getDevice(), m_srcFormat))
 	, m_splitPipelineLayout			(createSplitPipelineLayout(context.getDeviceInterface(), context.getDevice(), *m_splitDescriptorSetLayout))
-	, m_splitPipelines				(createSplitPipelines(context.getDeviceInterface(), context.getDevice(), *m_renderPass, *m_splitPipelineLayout, context.getBinaryCollection(), m_width, m_height, m_sampleCount))
+	, m_splitPipelines				(createSplitPipelines(context.getDeviceInterface(), context.getDevice(), context.getPipelineCache(), *m_renderPass, *m_splitPipelineLayout, context.getBinaryCollection(), m_width, m_height, m_sampleCount))
 	, m_splitDescriptorPool			(createSplitDescriptorPool(context.getDeviceInterface(), context.getDevice()))
 	, m_splitDescriptorSet			(createSplitDescriptorSet(context.getDeviceInterface(), context.getDevice(), *m_splitDescriptorPool, *m_splitDescriptorSetLayout, *m_srcPrimaryInputImageView, *m_srcSecondaryInputImageView))
 	, m_commandPool					(createCommandPool(context.getDeviceInterface(), context.getDevice(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, context.getUniversalQueueFamilyIndex()))
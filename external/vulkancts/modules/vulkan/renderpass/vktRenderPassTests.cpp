@@ -1543,6 +1543,7 @@ private:
 
 Move<VkPipeline> createSubpassPipeline (const DeviceInterface&		vk,
 										VkDevice					device,
+										VkPipelineCache				pipelineCache,
 										VkRenderPass				renderPass,
 										VkShaderModule				vertexShaderModule,
 										VkShaderModule				fragmentShaderModule,
@@ -1768,7 +1769,7 @@ Move<VkPipeline> createSubpassPipeline (const DeviceInterface&		vk,
 		0u													// basePipelineIndex
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &createInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &createInfo);
 }
 
 class SubpassRenderer
@@ -1857,7 +1858,7 @@ public:
 			m_vertexShaderModule	= createShaderModule(vk, device, context.getBinaryCollection().get(de::toString(subpassIndex) + "-vert"), 0u);
 			m_fragmentShaderModule	= createShaderModule(vk, device, context.getBinaryCollection().get(de::toString(subpassIndex) + "-frag"), 0u);
 			m_pipelineLayout		= createPipelineLayout(vk, device, &pipelineLayoutParams);
-			m_pipeline				= createSubpassPipeline(vk, device, renderPass, *m_vertexShaderModule, *m_fragmentShaderModule, *m_pipelineLayout, m_renderInfo);
+			m_pipeline				= createSubpassPipeline(vk, device, context.getPipelineCache(), renderPass, *m_vertexShaderModule, *m_fragmentShaderModule, *m_pipelineLayout, m_renderInfo);
 
 			m_vertexBuffer			= createBuffer(vk, device, 0u, (VkDeviceSize)renderQuad.getVertexDataSize(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE, 1u, &queueFamilyIndex);
 			m_vertexBufferMemory	= allocator.allocate(getBufferMemoryRequirements(vk, device, *m_vertexBuffer), MemoryRequirement::HostVisible);
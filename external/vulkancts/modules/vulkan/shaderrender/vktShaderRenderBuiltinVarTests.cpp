@@ -69,12 +69,7 @@ public:
 
 	void shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 	{
-		for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-		{
-			packets[packetNdx]->position = rr::readVertexAttribFloat(inputs[0],
-																	 packets[packetNdx]->instanceNdx,
-																	 packets[packetNdx]->vertexNdx);
-		}
+		rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
 	}
 };
 
@@ -29,6 +29,8 @@
 #include "deMath.h"
 #include "tcuCompressedTexture.hpp"
 #include "tcuImageIO.hpp"
+#include "tcuInstrumentation.hpp"
+#include "tcuResourceCache.hpp"
 #include "tcuStringTemplate.hpp"
 #include "tcuTestLog.hpp"
 #include "vkBuilderUtil.hpp"
@@ -299,9 +301,10 @@ TextureBinding::TextureBinding (Context& context, const TestTextureSp& textureDa
 
 void TextureBinding::updateTextureData (const TestTextureSp& textureData, const TextureBinding::Type textureType)
 {
+	const tcu::InstrumentationScope scope ("vkt::texture::util::TextureBinding::updateTextureData");
+
 	const DeviceInterface&						vkd						= m_context.getDeviceInterface();
 	const VkDevice								vkDevice				= m_context.getDevice();
-	const VkQueue								queue					= m_context.getUniversalQueue();
 	const deUint32								queueFamilyIndex		= m_context.getUniversalQueueFamilyIndex();
 	Allocator&									allocator				= m_context.getDefaultAllocator();
 
@@ -371,7 +374,7 @@ void TextureBinding::updateTextureData (const TestTextureSp& textureData, const
 
 	updateTextureViewMipLevels(0, mipLevels - 1);
 
-	pipeline::uploadTestTexture(vkd, vkDevice, queue, queueFamilyIndex, allocator, *m_textureData, *m_textureImage);
+	pipeline::uploadTestTexture(m_context.getTransferService(), *m_textureData, *m_textureImage);
 }
 
 void TextureBinding::updateTextureViewMipLevels (deUint32 baseLevel, deUint32 maxLevel)
@@ -961,6 +964,8 @@ void TextureRenderer::renderQuad (tcu::Surface&									result,
 								  const glu::TextureTestUtil::ReferenceParams&	params,
 								  const float									maxAnisotropy)
 {
+	const tcu::InstrumentationScope scope ("vkt::texture::util::TextureRenderer::renderQuad");
+
 	const DeviceInterface&		vkd						= m_context.getDeviceInterface();
 	const VkDevice				vkDevice				= m_context.getDevice();
 	const VkQueue				queue					= m_context.getUniversalQueue();
@@ -1649,6 +1654,8 @@ TestTexture2DSp loadTexture2D (const tcu::Archive& archive, const std::vector<st
 
 	if (ext == "png")
 	{
+		// Decode all images in background while they are copied in order.
+		tcu::ResourceCache::getInstance().prefetchImages(archive, filenames);
 
 		for (size_t fileIndex = 0; fileIndex < filenames.size(); ++fileIndex)
 		{
@@ -1710,6 +1717,8 @@ TestTextureCubeSp loadTextureCube (const tcu::Archive& archive, const std::vecto
 
 	if (ext == "png")
 	{
+		// Decode all images in background while they are copied in order.
+		tcu::ResourceCache::getInstance().prefetchImages(archive, filenames);
 
 		for (size_t fileIndex = 0; fileIndex < filenames.size(); ++fileIndex)
 		{
@@ -691,7 +691,7 @@ VulkanDrawContext::VulkanDrawContext (  Context&				context,
 			0,																		// deInt32											basePipelineIndex;
 		};
 
-		m_pipeline = createGraphicsPipeline(vk, device, DE_NULL, &graphicsPipelineInfo);
+		m_pipeline = createGraphicsPipeline(vk, device, m_context.getPipelineCache(), &graphicsPipelineInfo);
 	}
 
 	// Record commands
@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "vktTestCase.hpp"
+#include "vktTransferService.hpp"
 
 #include "vkRef.hpp"
 #include "vkRefUtil.hpp"
@@ -34,6 +35,11 @@
 #include "tcuCommandLine.hpp"
 
 #include "deMemory.h"
+#include "deProcess.h"
+#include "deStringUtil.hpp"
+
+#include <fstream>
+#include <cstdio>
 
 namespace vkt
 {
@@ -192,6 +198,101 @@ Move<VkDevice> createDefaultDevice (const InstanceInterface&		vki,
 	return createDevice(vki, physicalDevice, &deviceInfo);
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Device driver that counts pipelines created with shared cache
+ *
+ * Only counts creations; cache data size is queried by caller once per
+ * case, never per pipeline.
+ *//*--------------------------------------------------------------------*/
+class PipelineCacheDeviceDriver : public DeviceDriver
+{
+public:
+								PipelineCacheDeviceDriver	(const InstanceInterface& vki, VkDevice device)
+									: DeviceDriver		(vki, device)
+									, m_sharedCache		((VkPipelineCache)0)
+									, m_numPipelines	(0)
+								{
+								}
+
+	void						setSharedPipelineCache		(VkPipelineCache cache)	{ m_sharedCache = cache;	}
+	int							getNumPipelines				(void) const			{ return m_numPipelines;	}
+
+	VkResult					createGraphicsPipelines		(VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+	{
+		recordCreation(pipelineCache, createInfoCount);
+		return DeviceDriver::createGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	}
+
+	VkResult					createComputePipelines		(VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+	{
+		recordCreation(pipelineCache, createInfoCount);
+		return DeviceDriver::createComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	}
+
+private:
+	void						recordCreation				(VkPipelineCache pipelineCache, deUint32 numPipelines) const
+	{
+		if (pipelineCache != (VkPipelineCache)0 && pipelineCache == m_sharedCache)
+			m_numPipelines += (int)numPipelines;
+	}
+
+	VkPipelineCache				m_sharedCache;
+	mutable int					m_numPipelines;
+};
+
+vector<deUint8> readPipelineCacheFile (const char* filename)
+{
+	std::ifstream	in		(filename, std::ios_base::binary);
+	vector<deUint8>	data;
+
+	if (!in.is_open())
+		return data;
+
+	in.seekg(0, std::ios_base::end);
+	data.resize((size_t)in.tellg());
+	in.seekg(0, std::ios_base::beg);
+
+	if (!data.empty() && !in.read((char*)&data[0], (std::streamsize)data.size()))
+		data.clear();
+
+	return data;
+}
+
+void writePipelineCacheFile (const char* filename, const vector<deUint8>& data)
+{
+	// Written under per-process temporary name first so that concurrent runs never see partial
+	// files nor write to same file.
+	const string	tmpFilename	= string(filename) + "." + de::toString(deProcess_getCurrentId()) + ".tmp";
+	bool			ok;
+
+	{
+		std::ofstream out (tmpFilename.c_str(), std::ios_base::binary);
+
+		out.write((const char*)&data[0], (std::streamsize)data.size());
+		out.close();
+		ok = !out.fail();
+	}
+
+	if (!ok || std::rename(tmpFilename.c_str(), filename) != 0)
+		std::remove(tmpFilename.c_str());
+}
+
+Move<VkPipelineCache> createSharedPipelineCache (const DeviceInterface& vkd, VkDevice device, const char* cacheFile)
+{
+	// \note Implementations must ignore initial data from other devices or driver versions.
+	const vector<deUint8>			initialData	= readPipelineCacheFile(cacheFile);
+	const VkPipelineCacheCreateInfo	createInfo	=
+	{
+		VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// VkStructureType				sType;
+		DE_NULL,										// const void*					pNext;
+		(VkPipelineCacheCreateFlags)0u,					// VkPipelineCacheCreateFlags	flags;
+		initialData.size(),								// deUintptr					initialDataSize;
+		initialData.empty() ? DE_NULL : &initialData[0]	// const void*					pInitialData;
+	};
+
+	return createPipelineCache(vkd, device, &createInfo);
+}
+
 class DefaultDevice
 {
 public:
@@ -212,6 +313,9 @@ public:
 	deUint32							getUniversalQueueFamilyIndex	(void) const	{ return m_universalQueueFamilyIndex;	}
 	VkQueue								getUniversalQueue				(void) const;
 
+	VkPipelineCache						getPipelineCache				(void) const	{ return *m_pipelineCache;				}
+	PipelineCacheStatistics				getPipelineCacheStatistics		(void) const;
+
 private:
 	static VkPhysicalDeviceFeatures		filterDefaultDeviceFeatures		(const VkPhysicalDeviceFeatures& deviceFeatures);
 
@@ -227,7 +331,10 @@ private:
 	const vector<string>				m_deviceExtensions;
 
 	const Unique<VkDevice>				m_device;
-	const DeviceDriver					m_deviceInterface;
+	PipelineCacheDeviceDriver			m_deviceInterface;
+
+	const string						m_pipelineCacheFile;
+	const Unique<VkPipelineCache>		m_pipelineCache;
 };
 
 DefaultDevice::DefaultDevice (const PlatformInterface& vkPlatform, const tcu::CommandLine& cmdLine)
@@ -241,11 +348,37 @@ DefaultDevice::DefaultDevice (const PlatformInterface& vkPlatform, const tcu::Co
 	, m_deviceExtensions			(filterExtensions(enumerateDeviceExtensionProperties(m_instanceInterface, m_physicalDevice, DE_NULL)))
 	, m_device						(createDefaultDevice(m_instanceInterface, m_physicalDevice, m_universalQueueFamilyIndex, m_deviceFeatures, m_deviceExtensions, cmdLine))
 	, m_deviceInterface				(m_instanceInterface, *m_device)
+	, m_pipelineCacheFile			(cmdLine.getPipelineCacheFile() ? cmdLine.getPipelineCacheFile() : "")
+	, m_pipelineCache				(m_pipelineCacheFile.empty() ? Move<VkPipelineCache>() : createSharedPipelineCache(m_deviceInterface, *m_device, m_pipelineCacheFile.c_str()))
 {
+	m_deviceInterface.setSharedPipelineCache(*m_pipelineCache);
 }
 
 DefaultDevice::~DefaultDevice (void)
 {
+	if (m_pipelineCacheFile.empty())
+		return;
+
+	// Persisting cache is best-effort, failures are ignored
+	try
+	{
+		deUintptr		dataSize	= 0;
+		vector<deUint8>	data;
+
+		VK_CHECK(m_deviceInterface.getPipelineCacheData(*m_device, *m_pipelineCache, &dataSize, DE_NULL));
+
+		if (dataSize == 0)
+			return;
+
+		data.resize((size_t)dataSize);
+		VK_CHECK(m_deviceInterface.getPipelineCacheData(*m_device, *m_pipelineCache, &dataSize, &data[0]));
+		data.resize((size_t)dataSize);
+
+		writePipelineCacheFile(m_pipelineCacheFile.c_str(), data);
+	}
+	catch (const std::exception&)
+	{
+	}
 }
 
 VkQueue DefaultDevice::getUniversalQueue (void) const
@@ -253,6 +386,18 @@ VkQueue DefaultDevice::getUniversalQueue (void) const
 	return getDeviceQueue(m_deviceInterface, *m_device, m_universalQueueFamilyIndex, 0);
 }
 
+PipelineCacheStatistics DefaultDevice::getPipelineCacheStatistics (void) const
+{
+	PipelineCacheStatistics stats;
+
+	stats.numPipelines = m_deviceInterface.getNumPipelines();
+
+	if (*m_pipelineCache != (VkPipelineCache)0)
+		VK_CHECK(m_deviceInterface.getPipelineCacheData(*m_device, *m_pipelineCache, &stats.dataSize, DE_NULL));
+
+	return stats;
+}
+
 VkPhysicalDeviceFeatures DefaultDevice::filterDefaultDeviceFeatures (const VkPhysicalDeviceFeatures& deviceFeatures)
 {
 	VkPhysicalDeviceFeatures enabledDeviceFeatures = deviceFeatures;
@@ -283,6 +428,7 @@ Context::Context (tcu::TestContext&							testCtx,
 	, m_progCollection		(progCollection)
 	, m_device				(new DefaultDevice(m_platformInterface, testCtx.getCommandLine()))
 	, m_allocator			(createAllocator(m_device.get()))
+	, m_transferService		(new TransferService(m_device->getDeviceInterface(), m_device->getDevice(), m_device->getUniversalQueue(), m_device->getUniversalQueueFamilyIndex(), *m_allocator))
 {
 }
 
@@ -302,6 +448,9 @@ const vk::DeviceInterface&				Context::getDeviceInterface				(void) const { retu
 deUint32								Context::getUniversalQueueFamilyIndex	(void) const { return m_device->getUniversalQueueFamilyIndex();	}
 vk::VkQueue								Context::getUniversalQueue				(void) const { return m_device->getUniversalQueue();			}
 vk::Allocator&							Context::getDefaultAllocator			(void) const { return *m_allocator;								}
+vk::VkPipelineCache						Context::getPipelineCache				(void) const { return m_device->getPipelineCache();				}
+PipelineCacheStatistics					Context::getPipelineCacheStatistics		(void) const { return m_device->getPipelineCacheStatistics();	}
+TransferService&						Context::getTransferService				(void) const { return *m_transferService;						}
 
 // TestCase
 
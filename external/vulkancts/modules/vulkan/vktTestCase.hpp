@@ -46,6 +46,15 @@ namespace vkt
 {
 
 class DefaultDevice;
+class TransferService;
+
+struct PipelineCacheStatistics
+{
+	int			numPipelines;	//!< Pipelines created with shared pipeline cache so far.
+	deUintptr	dataSize;		//!< Current size of shared pipeline cache data.
+
+	PipelineCacheStatistics (void) : numPipelines(0), dataSize(0) {}
+};
 
 class Context
 {
@@ -74,6 +83,14 @@ public:
 
 	vk::Allocator&								getDefaultAllocator				(void) const;
 
+	// Pipeline cache shared by all cases on default device, persisted with --deqp-pipeline-cache-file.
+	// Null handle if the option is not set.
+	vk::VkPipelineCache							getPipelineCache				(void) const;
+	PipelineCacheStatistics						getPipelineCacheStatistics		(void) const;
+
+	// Pooled staging memory and command buffer for uploads and readbacks on universal queue
+	TransferService&							getTransferService				(void) const;
+
 protected:
 	tcu::TestContext&							m_testCtx;
 	const vk::PlatformInterface&				m_platformInterface;
@@ -81,6 +98,7 @@ protected:
 
 	const de::UniquePtr<DefaultDevice>			m_device;
 	const de::UniquePtr<vk::Allocator>			m_allocator;
+	const de::UniquePtr<TransferService>		m_transferService;
 
 private:
 												Context							(const Context&); // Not allowed
@@ -32,12 +32,15 @@
 #include "vkPrograms.hpp"
 #include "vkBinaryRegistry.hpp"
 #include "vkGlslToSpirV.hpp"
+#include "vkProgramCompileService.hpp"
 #include "vkDebugReportUtil.hpp"
 #include "vkQueryUtil.hpp"
 
 #include "deUniquePtr.hpp"
+#include "deThread.h"
 
 #include "vktTestGroupUtil.hpp"
+#include "vktTransferService.hpp"
 #include "vktApiTests.hpp"
 #include "vktPipelineTests.hpp"
 #include "vktBindingModelTests.hpp"
@@ -80,16 +83,17 @@
 
 #include <vector>
 #include <sstream>
+#include <algorithm>
 
 namespace // compilation
 {
 
-vk::ProgramBinary* compileProgram (const glu::ProgramSources& source, glu::ShaderProgramInfo* buildInfo)
+vk::ProgramBinary* compileProgram (vk::ProgramCompileService& compileService, const glu::ProgramSources& source, glu::ShaderProgramInfo* buildInfo)
 {
-	return vk::buildProgram(source, vk::PROGRAM_FORMAT_SPIRV, buildInfo);
+	return compileService.build(source, buildInfo);
 }
 
-vk::ProgramBinary* compileProgram (const vk::SpirVAsmSource& source, vk::SpirVProgramInfo* buildInfo)
+vk::ProgramBinary* compileProgram (vk::ProgramCompileService&, const vk::SpirVAsmSource& source, vk::SpirVProgramInfo* buildInfo)
 {
 	return vk::assembleProgram(source, buildInfo);
 }
@@ -97,6 +101,7 @@ vk::ProgramBinary* compileProgram (const vk::SpirVAsmSource& source, vk::SpirVPr
 template <typename InfoType, typename IteratorType>
 vk::ProgramBinary* buildProgram (const std::string&					casePath,
 								 IteratorType						iter,
+								 vk::ProgramCompileService&			compileService,
 								 const vk::BinaryRegistryReader&	prebuiltBinRegistry,
 								 tcu::TestLog&						log,
 								 vk::BinaryCollection*				progCollection)
@@ -108,7 +113,7 @@ vk::ProgramBinary* buildProgram (const std::string&					casePath,
 
 	try
 	{
-		binProg	= de::MovePtr<vk::ProgramBinary>(compileProgram(iter.getProgram(), &buildInfo));
+		binProg	= de::MovePtr<vk::ProgramBinary>(compileProgram(compileService, iter.getProgram(), &buildInfo));
 		log << buildInfo;
 	}
 	catch (const tcu::NotSupportedError& err)
@@ -174,9 +179,20 @@ public:
 
 	virtual tcu::TestNode::IterateResult		iterate				(tcu::TestCase* testCase);
 
+	virtual int									getNumPrefetchCases	(void) const;
+	virtual void								prefetch			(const std::vector<tcu::TestCase*>& upcomingCases);
+
 private:
+	enum
+	{
+		MAX_COMPILE_THREADS	= 4,	//!< Background threads compiling programs of upcoming cases.
+		NUM_PREFETCH_CASES	= 8		//!< Number of upcoming cases to compile programs for.
+	};
+
 	vk::BinaryCollection						m_progCollection;
 	vk::BinaryRegistryReader					m_prebuiltBinRegistry;
+	vk::ProgramCompileService					m_compileService;
+	std::vector<tcu::TestCase*>					m_prefetchedCases;	//!< Cases passed to last prefetch() call.
 
 	const UniquePtr<vk::Library>				m_library;
 	Context										m_context;
@@ -184,6 +200,7 @@ private:
 	const UniquePtr<vk::DebugReportRecorder>	m_debugReportRecorder;
 
 	TestInstance*								m_instance;			//!< Current test case instance
+	PipelineCacheStatistics						m_pipelineCacheStatsAtInit;
 };
 
 static MovePtr<vk::Library> createLibrary (tcu::TestContext& testCtx)
@@ -193,6 +210,7 @@ static MovePtr<vk::Library> createLibrary (tcu::TestContext& testCtx)
 
 TestCaseExecutor::TestCaseExecutor (tcu::TestContext& testCtx)
 	: m_prebuiltBinRegistry	(testCtx.getArchive(), "vulkan/prebuilt")
+	, m_compileService		(de::clamp((int)deGetNumAvailableLogicalCores() - 1, 1, (int)MAX_COMPILE_THREADS))
 	, m_library				(createLibrary(testCtx))
 	, m_context				(testCtx, m_library->getPlatformInterface(), m_progCollection)
 	, m_debugReportRecorder	(testCtx.getCommandLine().isValidationEnabled()
@@ -225,7 +243,7 @@ void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePat
 
 	for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin(); progIter != sourceProgs.glslSources.end(); ++progIter)
 	{
-		vk::ProgramBinary* binProg = buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, progIter, m_prebuiltBinRegistry, log, &m_progCollection);
+		vk::ProgramBinary* binProg = buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, progIter, m_compileService, m_prebuiltBinRegistry, log, &m_progCollection);
 
 		try
 		{
@@ -243,9 +261,12 @@ void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePat
 
 	for (vk::SpirVAsmCollection::Iterator asmIterator = sourceProgs.spirvAsmSources.begin(); asmIterator != sourceProgs.spirvAsmSources.end(); ++asmIterator)
 	{
-		buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, m_prebuiltBinRegistry, log, &m_progCollection);
+		buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, m_compileService, m_prebuiltBinRegistry, log, &m_progCollection);
 	}
 
+	if (m_context.getPipelineCache() != (vk::VkPipelineCache)0)
+		m_pipelineCacheStatsAtInit = m_context.getPipelineCacheStatistics();
+
 	DE_ASSERT(!m_instance);
 	m_instance = vktCase->createInstance(m_context);
 }
@@ -255,6 +276,29 @@ void TestCaseExecutor::deinit (tcu::TestCase*)
 	delete m_instance;
 	m_instance = DE_NULL;
 
+	m_context.getTransferService().trim();
+
+	// Report use of shared pipeline cache. Vulkan doesn't report cache hits, but if no cache
+	// data was added during case, all pipelines were found in cache.
+	if (m_context.getPipelineCache() != (vk::VkPipelineCache)0)
+	{
+		const PipelineCacheStatistics	stats			= m_context.getPipelineCacheStatistics();
+		const int						numPipelines	= stats.numPipelines - m_pipelineCacheStatsAtInit.numPipelines;
+		const deInt64					dataGrowth		= (deInt64)stats.dataSize - (deInt64)m_pipelineCacheStatsAtInit.dataSize;
+
+		if (numPipelines > 0)
+		{
+			tcu::TestLog&				log				= m_context.getTestContext().getLog();
+			const tcu::ScopedLogSection	section			(log, "PipelineCache", "Shared pipeline cache");
+
+			log << tcu::TestLog::Integer("NumPipelines", "Pipelines created with shared cache", "", QP_KEY_TAG_NONE, numPipelines)
+				<< tcu::TestLog::Integer("CacheGrowth", "Growth of cache data", "bytes", QP_KEY_TAG_NONE, dataGrowth)
+				<< tcu::TestLog::Message
+				<< (dataGrowth == 0 ? "All pipelines were found in cache" : "Some pipelines were not found in cache")
+				<< tcu::TestLog::EndMessage;
+		}
+	}
+
 	// Collect and report any debug messages
 	if (m_debugReportRecorder)
 	{
@@ -291,6 +335,40 @@ void TestCaseExecutor::deinit (tcu::TestCase*)
 	}
 }
 
+int TestCaseExecutor::getNumPrefetchCases (void) const
+{
+	// No point in prefetching if programs can't be built from source
+	return m_compileService.isCompileSupported() ? (int)NUM_PREFETCH_CASES : 0;
+}
+
+void TestCaseExecutor::prefetch (const std::vector<tcu::TestCase*>& upcomingCases)
+{
+	for (size_t caseNdx = 0; caseNdx < upcomingCases.size(); caseNdx++)
+	{
+		const TestCase* const vktCase = dynamic_cast<const TestCase*>(upcomingCases[caseNdx]);
+
+		// Programs of cases seen in last call are already queued
+		if (!vktCase || std::find(m_prefetchedCases.begin(), m_prefetchedCases.end(), upcomingCases[caseNdx]) != m_prefetchedCases.end())
+			continue;
+
+		try
+		{
+			vk::SourceCollections sourceProgs;
+
+			vktCase->initPrograms(sourceProgs);
+
+			for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin(); progIter != sourceProgs.glslSources.end(); ++progIter)
+				m_compileService.prefetch(progIter.getProgram());
+		}
+		catch (const std::exception&)
+		{
+			// Errors are reported when the case is executed
+		}
+	}
+
+	m_prefetchedCases = upcomingCases;
+}
+
 tcu::TestNode::IterateResult TestCaseExecutor::iterate (tcu::TestCase*)
 {
 	DE_ASSERT(m_instance);
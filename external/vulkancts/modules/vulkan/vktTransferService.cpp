@@ -0,0 +1,244 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Staging buffer and command buffer pool for uploads and readbacks.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktTransferService.hpp"
+#include "vkRefUtil.hpp"
+#include "vkQueryUtil.hpp"
+#include "tcuInstrumentation.hpp"
+
+namespace vkt
+{
+
+using namespace vk;
+
+TransferService::TransferService (const DeviceInterface&	vk,
+								  VkDevice					device,
+								  VkQueue					queue,
+								  deUint32					queueFamilyIndex,
+								  Allocator&				allocator)
+	: m_vk				(vk)
+	, m_device			(device)
+	, m_queue			(queue)
+	, m_allocator		(allocator)
+	, m_cmdPool			(createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT|VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, queueFamilyIndex))
+	, m_cmdBuffer		(allocateCommandBuffer(vk, device, *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))
+	, m_fence			(createFence(vk, device))
+	, m_curBlockNdx		(0)
+	, m_curOffset		(0)
+	, m_numUsedBlocks	(0)
+	, m_batchDone		(false)
+	, m_recording		(false)
+	, m_numSubmits		(0)
+{
+}
+
+TransferService::~TransferService (void)
+{
+}
+
+TransferService::StagingBlockSp TransferService::createBlock (VkDeviceSize size) const
+{
+	const VkBufferCreateInfo	bufferParams	=
+	{
+		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,								// VkStructureType		sType;
+		DE_NULL,															// const void*			pNext;
+		0u,																	// VkBufferCreateFlags	flags;
+		size,																// VkDeviceSize			size;
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT|VK_BUFFER_USAGE_TRANSFER_DST_BIT,	// VkBufferUsageFlags	usage;
+		VK_SHARING_MODE_EXCLUSIVE,											// VkSharingMode		sharingMode;
+		0u,																	// deUint32				queueFamilyIndexCount;
+		DE_NULL,															// const deUint32*		pQueueFamilyIndices;
+	};
+	const StagingBlockSp		block			(new StagingBlock());
+
+	block->buffer		= createBuffer(m_vk, m_device, &bufferParams);
+	block->allocation	= m_allocator.allocate(getBufferMemoryRequirements(m_vk, m_device, *block->buffer), MemoryRequirement::HostVisible);
+	block->size			= size;
+
+	VK_CHECK(m_vk.bindBufferMemory(m_device, *block->buffer, block->allocation->getMemory(), block->allocation->getOffset()));
+
+	return block;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Allocate staging memory for current batch
+ *
+ * First allocation after submit() starts a new batch and recycles all
+ * staging memory used by previous batches.
+ *
+ * \param size		Size of region in bytes
+ * \param alignment	Required offset alignment, for example texel size
+ *					for buffer-image copies. Doesn't need to be a power
+ *					of two.
+ *//*--------------------------------------------------------------------*/
+StagingRegion TransferService::allocateStaging (VkDeviceSize size, VkDeviceSize alignment)
+{
+	DE_ASSERT(alignment > 0);
+
+	if (m_batchDone)
+	{
+		m_curBlockNdx	= 0;
+		m_curOffset		= 0;
+		m_numUsedBlocks	= 0;
+		m_batchDone		= false;
+	}
+
+	for (;;)
+	{
+		const VkDeviceSize	alignedOffset	= ((m_curOffset + alignment - 1) / alignment) * alignment;
+
+		if (m_curBlockNdx == m_blocks.size())
+			m_blocks.push_back(createBlock(de::max(size, (VkDeviceSize)DEFAULT_BLOCK_SIZE)));
+
+		if (alignedOffset + size <= m_blocks[m_curBlockNdx]->size)
+		{
+			const StagingBlock&	block	= *m_blocks[m_curBlockNdx];
+			StagingRegion		region;
+
+			region.buffer	= *block.buffer;
+			region.offset	= alignedOffset;
+			region.size		= size;
+			region.hostPtr	= (deUint8*)block.allocation->getHostPtr() + alignedOffset;
+
+			m_curOffset		= alignedOffset + size;
+			m_numUsedBlocks	= de::max(m_numUsedBlocks, m_curBlockNdx + 1);
+
+			return region;
+		}
+
+		m_curBlockNdx	+= 1;
+		m_curOffset		 = 0;
+	}
+}
+
+//! Get command buffer for recording transfer commands. Recording is begun if needed.
+VkCommandBuffer TransferService::getCommandBuffer (void)
+{
+	if (!m_recording)
+	{
+		const VkCommandBufferBeginInfo beginInfo =
+		{
+			VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,	// VkStructureType							sType;
+			DE_NULL,										// const void*								pNext;
+			VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,	// VkCommandBufferUsageFlags				flags;
+			(const VkCommandBufferInheritanceInfo*)DE_NULL,	// const VkCommandBufferInheritanceInfo*	pInheritanceInfo;
+		};
+
+		VK_CHECK(m_vk.beginCommandBuffer(*m_cmdBuffer, &beginInfo));
+		m_recording = true;
+	}
+
+	return *m_cmdBuffer;
+}
+
+//! Submit recorded commands and wait for them to complete.
+void TransferService::submit (void)
+{
+	const tcu::InstrumentationScope scope ("vkt::TransferService::submit");
+
+	for (size_t blockNdx = 0; blockNdx < m_numUsedBlocks; blockNdx++)
+		flushMappedMemoryRange(m_vk, m_device, m_blocks[blockNdx]->allocation->getMemory(), m_blocks[blockNdx]->allocation->getOffset(), VK_WHOLE_SIZE);
+
+	if (m_recording)
+	{
+		const VkMemoryBarrier	hostReadBarrier	=
+		{
+			VK_STRUCTURE_TYPE_MEMORY_BARRIER,	// VkStructureType	sType;
+			DE_NULL,							// const void*		pNext;
+			VK_ACCESS_TRANSFER_WRITE_BIT,		// VkAccessFlags	srcAccessMask;
+			VK_ACCESS_HOST_READ_BIT,			// VkAccessFlags	dstAccessMask;
+		};
+		const VkSubmitInfo		submitInfo		=
+		{
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,		// VkStructureType				sType;
+			DE_NULL,							// const void*					pNext;
+			0u,									// deUint32						waitSemaphoreCount;
+			DE_NULL,							// const VkSemaphore*			pWaitSemaphores;
+			DE_NULL,							// const VkPipelineStageFlags*	pWaitDstStageMask;
+			1u,									// deUint32						commandBufferCount;
+			&m_cmdBuffer.get(),					// const VkCommandBuffer*		pCommandBuffers;
+			0u,									// deUint32						signalSemaphoreCount;
+			DE_NULL								// const VkSemaphore*			pSignalSemaphores;
+		};
+
+		m_vk.cmdPipelineBarrier(*m_cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, (VkDependencyFlags)0, 1, &hostReadBarrier, 0, (const VkBufferMemoryBarrier*)DE_NULL, 0, (const VkImageMemoryBarrier*)DE_NULL);
+		VK_CHECK(m_vk.endCommandBuffer(*m_cmdBuffer));
+		m_recording = false;
+
+		VK_CHECK(m_vk.queueSubmit(m_queue, 1, &submitInfo, *m_fence));
+		VK_CHECK(m_vk.waitForFences(m_device, 1, &m_fence.get(), VK_TRUE, ~(0ull) /* infinity */));
+		VK_CHECK(m_vk.resetFences(m_device, 1, &m_fence.get()));
+		VK_CHECK(m_vk.resetCommandBuffer(*m_cmdBuffer, (VkCommandBufferResetFlags)0));
+
+		m_numSubmits += 1;
+	}
+
+	for (size_t blockNdx = 0; blockNdx < m_numUsedBlocks; blockNdx++)
+		invalidateMappedMemoryRange(m_vk, m_device, m_blocks[blockNdx]->allocation->getMemory(), m_blocks[blockNdx]->allocation->getOffset(), VK_WHOLE_SIZE);
+
+	m_batchDone = true;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Drop unsubmitted commands and excess staging memory
+ *
+ * Called between test cases so that a single large upload doesn't keep
+ * memory allocated for the rest of the run.
+ *//*--------------------------------------------------------------------*/
+void TransferService::trim (void)
+{
+	VkDeviceSize	retainedSize	= 0;
+	size_t			numRetained		= 0;
+
+	if (m_recording)
+	{
+		VK_CHECK(m_vk.endCommandBuffer(*m_cmdBuffer));
+		VK_CHECK(m_vk.resetCommandBuffer(*m_cmdBuffer, (VkCommandBufferResetFlags)0));
+		m_recording = false;
+	}
+
+	while (numRetained < m_blocks.size() && retainedSize + m_blocks[numRetained]->size <= (VkDeviceSize)DEFAULT_MAX_RETAINED_SIZE)
+	{
+		retainedSize	+= m_blocks[numRetained]->size;
+		numRetained		+= 1;
+	}
+
+	m_blocks.resize(numRetained);
+
+	m_curBlockNdx	= 0;
+	m_curOffset		= 0;
+	m_numUsedBlocks	= 0;
+	m_batchDone		= false;
+}
+
+VkDeviceSize TransferService::getStagingSize (void) const
+{
+	VkDeviceSize size = 0;
+
+	for (size_t blockNdx = 0; blockNdx < m_blocks.size(); blockNdx++)
+		size += m_blocks[blockNdx]->size;
+
+	return size;
+}
+
+} // vkt
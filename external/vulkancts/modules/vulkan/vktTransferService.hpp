@@ -0,0 +1,129 @@
+#ifndef _VKTTRANSFERSERVICE_HPP
+#define _VKTTRANSFERSERVICE_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2016 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Staging buffer and command buffer pool for uploads and readbacks.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkRef.hpp"
+#include "vkMemUtil.hpp"
+#include "deSharedPtr.hpp"
+
+#include <vector>
+
+namespace vkt
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Staging memory range allocated from TransferService
+ *//*--------------------------------------------------------------------*/
+struct StagingRegion
+{
+	vk::VkBuffer		buffer;		//!< Buffer to use in copy commands.
+	vk::VkDeviceSize	offset;		//!< Offset of region in buffer.
+	vk::VkDeviceSize	size;
+	void*				hostPtr;	//!< Persistently mapped pointer to region start.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Pooled staging memory and command buffer for transfers
+ *
+ * Copies are recorded into a single recycled command buffer and
+ * submitted in one batch with submit(), which waits for completion.
+ * Staging regions are sub-allocated from persistently mapped,
+ * host-visible blocks that are reused by subsequent batches.
+ *
+ * Host writes to staging regions are flushed by submit() and device
+ * writes are invalidated after the batch completes. Regions allocated
+ * for a batch stay valid until the first allocateStaging() call after
+ * submit(), so readback results can be read right after submit().
+ *
+ * Commands recorded by the caller must include the barriers needed
+ * for the copies; the service only adds a host read barrier at the
+ * end of the batch.
+ *//*--------------------------------------------------------------------*/
+class TransferService
+{
+public:
+	enum
+	{
+		DEFAULT_BLOCK_SIZE			= 1024*1024,		//!< Minimum size of staging block.
+		DEFAULT_MAX_RETAINED_SIZE	= 4*1024*1024		//!< Staging memory kept by trim().
+	};
+
+										TransferService		(const vk::DeviceInterface&	vk,
+															 vk::VkDevice				device,
+															 vk::VkQueue				queue,
+															 deUint32					queueFamilyIndex,
+															 vk::Allocator&				allocator);
+										~TransferService	(void);
+
+	StagingRegion						allocateStaging		(vk::VkDeviceSize size, vk::VkDeviceSize alignment = 16u);
+	vk::VkCommandBuffer					getCommandBuffer	(void);
+	void								submit				(void);
+
+	//! Release staging blocks beyond DEFAULT_MAX_RETAINED_SIZE.
+	void								trim				(void);
+
+	const vk::DeviceInterface&			getDeviceInterface	(void) const	{ return m_vk;			}
+	vk::VkDevice						getDevice			(void) const	{ return m_device;		}
+
+	bool								isRecording			(void) const	{ return m_recording;	}
+	int									getNumSubmits		(void) const	{ return m_numSubmits;	}
+	vk::VkDeviceSize					getStagingSize		(void) const;
+
+private:
+										TransferService		(const TransferService&);
+	TransferService&					operator=			(const TransferService&);
+
+	struct StagingBlock
+	{
+		vk::Move<vk::VkBuffer>				buffer;
+		de::MovePtr<vk::Allocation>			allocation;
+		vk::VkDeviceSize					size;
+	};
+
+	typedef de::SharedPtr<StagingBlock>	StagingBlockSp;
+
+	StagingBlockSp						createBlock			(vk::VkDeviceSize size) const;
+
+	const vk::DeviceInterface&			m_vk;
+	const vk::VkDevice					m_device;
+	const vk::VkQueue					m_queue;
+	vk::Allocator&						m_allocator;
+
+	const vk::Unique<vk::VkCommandPool>	m_cmdPool;
+	const vk::Unique<vk::VkCommandBuffer>	m_cmdBuffer;
+	const vk::Unique<vk::VkFence>		m_fence;
+
+	std::vector<StagingBlockSp>			m_blocks;
+	size_t								m_curBlockNdx;		//!< Block currently sub-allocated from.
+	vk::VkDeviceSize					m_curOffset;
+	size_t								m_numUsedBlocks;	//!< Blocks touched by current or last batch.
+	bool								m_batchDone;		//!< Last batch submitted, regions still readable.
+	bool								m_recording;
+	int									m_numSubmits;
+};
+
+} // vkt
+
+#endif // _VKTTRANSFERSERVICE_HPP
@@ -34,42 +34,11 @@
 
 #include "deMath.h"
 
-#include <iostream>
-
 namespace tcu
 {
 
 using std::string;
 
-/*--------------------------------------------------------------------*//*!
- *  Writes all packages found stdout without any
- *  separations. Recommended to be used with a single package
- *  only. It's possible to use test selectors for limiting the export
- *  to one package in a multipackage binary.
- *//*--------------------------------------------------------------------*/
-static void writeCaselistsToStdout (TestPackageRoot& root, TestContext& testCtx)
-{
-	DefaultHierarchyInflater			inflater		(testCtx);
-	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
-	TestHierarchyIterator				iter			(root, inflater, *caseListFilter);
-
-	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
-	{
-		iter.next();
-
-		while (iter.getNode()->getNodeType() != NODETYPE_PACKAGE)
-		{
-			if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
-				std::cout << (isTestNodeTypeExecutable(iter.getNode()->getNodeType()) ? "TEST" : "GROUP") << ": " << iter.getNodePath() << "\n";
-			iter.next();
-		}
-
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
-				  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
-		iter.next();
-	}
-}
-
 /*--------------------------------------------------------------------*//*!
  * \brief Construct test application
  *
@@ -115,11 +84,13 @@ App::App (Platform& platform, Archive& archive, TestLog& log, const CommandLine&
 		if (runMode == RUNMODE_EXECUTE)
 			m_testExecutor = new TestSessionExecutor(*m_testRoot, *m_testCtx);
 		else if (runMode == RUNMODE_DUMP_STDOUT_CASELIST)
-			writeCaselistsToStdout(*m_testRoot, *m_testCtx);
+			writeCaselistsToStdout(*m_testRoot, *m_testCtx, cmdLine);
 		else if (runMode == RUNMODE_DUMP_XML_CASELIST)
 			writeXmlCaselistsToFiles(*m_testRoot, *m_testCtx, cmdLine);
 		else if (runMode == RUNMODE_DUMP_TEXT_CASELIST)
 			writeTxtCaselistsToFiles(*m_testRoot, *m_testCtx, cmdLine);
+		else if (runMode == RUNMODE_DUMP_HIERARCHY_INDEX)
+			writeHierarchyIndexToFile(*m_testRoot, *m_testCtx, cmdLine);
 		else
 			DE_ASSERT(false);
 	}
@@ -88,6 +88,13 @@ DE_DECLARE_COMMAND_LINE_OPT(TestOOM,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(VKDeviceID,					int);
 DE_DECLARE_COMMAND_LINE_OPT(LogFlush,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(Validation,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(ShaderLibraryCacheDir,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(ProgramBinaryCacheDir,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(PipelineCacheFile,			std::string);
+DE_DECLARE_COMMAND_LINE_OPT(HierarchyIndexFile,			std::string);
+DE_DECLARE_COMMAND_LINE_OPT(Instrumentation,			tcu::InstrumentationMode);
+DE_DECLARE_COMMAND_LINE_OPT(InstrumentationFile,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(GLCallTrace,				bool);
 
 static void parseIntList (const char* src, std::vector<int>* dst)
 {
@@ -117,7 +124,8 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "execute",		RUNMODE_EXECUTE				},
 		{ "xml-caselist",	RUNMODE_DUMP_XML_CASELIST	},
 		{ "txt-caselist",	RUNMODE_DUMP_TEXT_CASELIST	},
-		{ "stdout-caselist",RUNMODE_DUMP_STDOUT_CASELIST}
+		{ "stdout-caselist",RUNMODE_DUMP_STDOUT_CASELIST},
+		{ "hierarchy-index",RUNMODE_DUMP_HIERARCHY_INDEX}
 	};
 	static const NamedValue<WindowVisibility> s_visibilites[] =
 	{
@@ -132,6 +140,12 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "pbuffer",		SURFACETYPE_OFFSCREEN_GENERIC	},
 		{ "fbo",			SURFACETYPE_FBO					}
 	};
+	static const NamedValue<tcu::InstrumentationMode> s_instrumentationModes[] =
+	{
+		{ "disable",		INSTRUMENTATION_DISABLE	},
+		{ "log",			INSTRUMENTATION_LOG		},
+		{ "trace",			INSTRUMENTATION_TRACE	}
+	};
 	static const NamedValue<tcu::ScreenRotation> s_screenRotations[] =
 	{
 		{ "unspecified",	SCREENROTATION_UNSPECIFIED	},
@@ -175,7 +189,14 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<LogShaderSources>		(DE_NULL,	"deqp-log-shader-sources",		"Enable or disable logging of shader sources",		s_enableNames,		"enable")
 		<< Option<TestOOM>				(DE_NULL,	"deqp-test-oom",				"Run tests that exhaust memory on purpose",			s_enableNames,		TEST_OOM_DEFAULT)
 		<< Option<LogFlush>				(DE_NULL,	"deqp-log-flush",				"Enable or disable log file fflush",				s_enableNames,		"enable")
-		<< Option<Validation>			(DE_NULL,	"deqp-validation",				"Enable or disable test case validation",			s_enableNames,		"disable");
+		<< Option<Validation>			(DE_NULL,	"deqp-validation",				"Enable or disable test case validation",			s_enableNames,		"disable")
+		<< Option<ShaderLibraryCacheDir>(DE_NULL,	"deqp-shader-library-cache-dir",	"Directory for caching parsed shader library (.test) files")
+		<< Option<ProgramBinaryCacheDir>(DE_NULL,	"deqp-program-binary-cache-dir",	"Directory for caching GL program binaries")
+		<< Option<PipelineCacheFile>	(DE_NULL,	"deqp-pipeline-cache-file",		"File for persisting Vulkan pipeline cache between runs")
+		<< Option<HierarchyIndexFile>	(DE_NULL,	"deqp-hierarchy-index",			"Test hierarchy index file, written in hierarchy-index run mode and used for case enumeration otherwise")
+		<< Option<Instrumentation>		(DE_NULL,	"deqp-instrumentation",			"Record timing of instrumented framework scopes to test log or trace file",	s_instrumentationModes,	"disable")
+		<< Option<InstrumentationFile>	(DE_NULL,	"deqp-instrumentation-file",	"Write instrumentation trace to given file in Chrome trace event format",	"TestResults.trace.json")
+		<< Option<GLCallTrace>			(DE_NULL,	"deqp-gl-call-trace",			"Record binary trace of GL calls and write it to log if case doesn't pass",	s_enableNames,	"disable");
 }
 
 void registerLegacyOptions (de::cmdline::Parser& parser)
@@ -788,6 +809,41 @@ const std::vector<int>&	CommandLine::getCLDeviceIds				(void) const	{ return m_c
 int						CommandLine::getVKDeviceId				(void) const	{ return m_cmdLine.getOption<opt::VKDeviceID>();					}
 bool					CommandLine::isValidationEnabled		(void) const	{ return m_cmdLine.getOption<opt::Validation>();					}
 bool					CommandLine::isOutOfMemoryTestEnabled	(void) const	{ return m_cmdLine.getOption<opt::TestOOM>();						}
+InstrumentationMode		CommandLine::getInstrumentationMode		(void) const	{ return m_cmdLine.getOption<opt::Instrumentation>();				}
+const char*				CommandLine::getInstrumentationFile		(void) const	{ return m_cmdLine.getOption<opt::InstrumentationFile>().c_str();	}
+bool					CommandLine::isGLCallTraceEnabled		(void) const	{ return m_cmdLine.getOption<opt::GLCallTrace>();					}
+
+const char* CommandLine::getShaderLibraryCacheDir (void) const
+{
+	if (m_cmdLine.hasOption<opt::ShaderLibraryCacheDir>())
+		return m_cmdLine.getOption<opt::ShaderLibraryCacheDir>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getProgramBinaryCacheDir (void) const
+{
+	if (m_cmdLine.hasOption<opt::ProgramBinaryCacheDir>())
+		return m_cmdLine.getOption<opt::ProgramBinaryCacheDir>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getPipelineCacheFile (void) const
+{
+	if (m_cmdLine.hasOption<opt::PipelineCacheFile>())
+		return m_cmdLine.getOption<opt::PipelineCacheFile>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getHierarchyIndexFile (void) const
+{
+	if (m_cmdLine.hasOption<opt::HierarchyIndexFile>())
+		return m_cmdLine.getOption<opt::HierarchyIndexFile>().c_str();
+	else
+		return DE_NULL;
+}
 
 const char* CommandLine::getGLContextType (void) const
 {
@@ -44,6 +44,7 @@ enum RunMode
 	RUNMODE_DUMP_XML_CASELIST,		//! Test program dumps the list of contained test cases in XML format.
 	RUNMODE_DUMP_TEXT_CASELIST,		//! Test program dumps the list of contained test cases in plain-text format.
 	RUNMODE_DUMP_STDOUT_CASELIST,	//! Test program dumps the list of contained test cases in plain-text format into stdout.
+	RUNMODE_DUMP_HIERARCHY_INDEX,	//! Test program writes test hierarchy index for fast case enumeration.
 
 	RUNMODE_LAST
 };
@@ -73,6 +74,18 @@ enum SurfaceType
 	SURFACETYPE_LAST
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Where timing instrumentation results are written.
+ *//*--------------------------------------------------------------------*/
+enum InstrumentationMode
+{
+	INSTRUMENTATION_DISABLE = 0,	//!< Don't record instrumentation events.
+	INSTRUMENTATION_LOG,			//!< Write per-case scope statistics to test log.
+	INSTRUMENTATION_TRACE,			//!< Write events to Chrome trace file.
+
+	INSTRUMENTATION_LAST
+};
+
 /*--------------------------------------------------------------------*//*!
  * \brief Screen rotation, always to clockwise direction.
  *//*--------------------------------------------------------------------*/
@@ -208,6 +221,27 @@ public:
 	//! Should we run tests that exhaust memory (--deqp-test-oom)
 	bool							isOutOfMemoryTestEnabled	(void) const;
 
+	//! Get shader library parse cache directory (--deqp-shader-library-cache-dir)
+	const char*						getShaderLibraryCacheDir	(void) const;
+
+	//! Get GL program binary cache directory (--deqp-program-binary-cache-dir)
+	const char*						getProgramBinaryCacheDir	(void) const;
+
+	//! Get Vulkan pipeline cache file (--deqp-pipeline-cache-file)
+	const char*						getPipelineCacheFile		(void) const;
+
+	//! Get test hierarchy index file (--deqp-hierarchy-index)
+	const char*						getHierarchyIndexFile		(void) const;
+
+	//! Get timing instrumentation mode (--deqp-instrumentation)
+	InstrumentationMode				getInstrumentationMode		(void) const;
+
+	//! Get instrumentation trace file (--deqp-instrumentation-file)
+	const char*						getInstrumentationFile		(void) const;
+
+	//! Is binary GL call trace enabled (--deqp-gl-call-trace)
+	bool							isGLCallTraceEnabled		(void) const;
+
 	/*--------------------------------------------------------------------*//*!
 	 * \brief Creates case list filter
 	 * \param archive Resources
@@ -27,6 +27,7 @@
 
 #include "deStringUtil.hpp"
 #include "deFloat16.h"
+#include "deParallel.hpp"
 
 #include <algorithm>
 
@@ -369,6 +370,41 @@ inline deInt16 extend11To16WithSign (deInt16 src)
 		return (deInt16)extend11To16(src);
 }
 
+static const int etcModifierTable[8][4] =
+{
+//	  00   01   10    11
+	{  2,   8,  -2,   -8 },
+	{  5,  17,  -5,  -17 },
+	{  9,  29,  -9,  -29 },
+	{ 13,  42, -13,  -42 },
+	{ 18,  60, -18,  -60 },
+	{ 24,  80, -24,  -80 },
+	{ 33, 106, -33, -106 },
+	{ 47, 183, -47, -183 }
+};
+
+static const int etcDistTable[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+static const int eacModifierTable[16][8] =
+{
+	{-3,  -6,  -9, -15,  2,  5,  8, 14},
+	{-3,  -7, -10, -13,  2,  6,  9, 12},
+	{-2,  -5,  -8, -13,  1,  4,  7, 12},
+	{-2,  -4,  -6, -13,  1,  3,  5, 12},
+	{-3,  -6,  -8, -12,  2,  5,  7, 11},
+	{-3,  -7,  -9, -11,  2,  6,  8, 10},
+	{-4,  -7,  -8, -11,  3,  6,  7, 10},
+	{-3,  -5,  -8, -11,  2,  4,  7, 10},
+	{-2,  -6,  -8, -10,  1,  5,  7,  9},
+	{-2,  -5,  -8, -10,  1,  4,  7,  9},
+	{-2,  -4,  -8, -10,  1,  3,  7,  9},
+	{-2,  -5,  -7, -10,  1,  4,  6,  9},
+	{-3,  -4,  -7, -10,  2,  3,  6,  9},
+	{-1,  -2,  -3, -10,  0,  1,  2,  9},
+	{-4,  -6,  -8,  -9,  3,  5,  7,  8},
+	{-3,  -5,  -7,  -9,  2,  4,  6,  8}
+};
+
 void decompressETC1Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint64 src)
 {
 	const int		diffBit		= (int)getBit(src, 33);
@@ -407,19 +443,6 @@ void decompressETC1Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 		baseB[1] = extend5Delta3To8(bB, dB);
 	}
 
-	static const int modifierTable[8][4] =
-	{
-	//	  00   01   10    11
-		{  2,   8,  -2,   -8 },
-		{  5,  17,  -5,  -17 },
-		{  9,  29,  -9,  -29 },
-		{ 13,  42, -13,  -42 },
-		{ 18,  60, -18,  -60 },
-		{ 24,  80, -24,  -80 },
-		{ 33, 106, -33, -106 },
-		{ 47, 183, -47, -183 }
-	};
-
 	// Write final pixels.
 	for (int pixelNdx = 0; pixelNdx < ETC2_BLOCK_HEIGHT*ETC2_BLOCK_WIDTH; pixelNdx++)
 	{
@@ -429,7 +452,7 @@ void decompressETC1Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 		const int		subBlock		= ((flipBit ? y : x) >= 2) ? 1 : 0;
 		const deUint32	tableNdx		= table[subBlock];
 		const deUint32	modifierNdx		= (getBit(src, 16+pixelNdx) << 1) | getBit(src, pixelNdx);
-		const int		modifier		= modifierTable[tableNdx][modifierNdx];
+		const int		modifier		= etcModifierTable[tableNdx][modifierNdx];
 
 		dst[dstOffset+0] = (deUint8)deClamp32((int)baseR[subBlock] + modifier, 0, 255);
 		dst[dstOffset+1] = (deUint8)deClamp32((int)baseG[subBlock] + modifier, 0, 255);
@@ -474,19 +497,6 @@ void decompressETC2Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 	if (mode == MODE_INDIVIDUAL || mode == MODE_DIFFERENTIAL)
 	{
 		// Individual and differential modes have some steps in common, handle them here.
-		static const int modifierTable[8][4] =
-		{
-		//	  00   01   10    11
-			{  2,   8,  -2,   -8 },
-			{  5,  17,  -5,  -17 },
-			{  9,  29,  -9,  -29 },
-			{ 13,  42, -13,  -42 },
-			{ 18,  60, -18,  -60 },
-			{ 24,  80, -24,  -80 },
-			{ 33, 106, -33, -106 },
-			{ 47, 183, -47, -183 }
-		};
-
 		const int		flipBit		= (int)getBit(src, 32);
 		const deUint32	table[2]	= { getBits(src, 37, 39), getBits(src, 34, 36) };
 		deUint8			baseR[2];
@@ -542,7 +552,7 @@ void decompressETC2Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 				if (alphaMode && diffOpaqueBit == 0 && (modifierNdx == 0 || modifierNdx == 2))
 					modifier = 0;
 				else
-					modifier = modifierTable[tableNdx][modifierNdx];
+					modifier = etcModifierTable[tableNdx][modifierNdx];
 
 				dst[dstOffset+0] = (deUint8)deClamp32((int)baseR[subBlock] + modifier, 0, 255);
 				dst[dstOffset+1] = (deUint8)deClamp32((int)baseG[subBlock] + modifier, 0, 255);
@@ -556,8 +566,6 @@ void decompressETC2Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 	else if (mode == MODE_T || mode == MODE_H)
 	{
 		// T and H modes have some steps in common, handle them here.
-		static const int distTable[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
-
 		deUint8 paintR[4];
 		deUint8 paintG[4];
 		deUint8 paintB[4];
@@ -573,7 +581,7 @@ void decompressETC2Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 			const deUint8	G2			= (deUint8)getBits(src, 40, 43);
 			const deUint8	B2			= (deUint8)getBits(src, 36, 39);
 			const deUint32	distNdx		= (getBits(src, 34, 35) << 1) | getBit(src, 32);
-			const int		dist		= distTable[distNdx];
+			const int		dist		= etcDistTable[distNdx];
 
 			paintR[0] = extend4To8((deUint8)((R1a << 2) | R1b));
 			paintG[0] = extend4To8(G1);
@@ -615,7 +623,7 @@ void decompressETC2Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 			baseValue[0]	= (((deUint32)baseR[0]) << 16) | (((deUint32)baseG[0]) << 8) | baseB[0];
 			baseValue[1]	= (((deUint32)baseR[1]) << 16) | (((deUint32)baseG[1]) << 8) | baseB[1];
 			distNdx			= (getBit(src, 34) << 2) | (getBit(src, 32) << 1) | (deUint32)(baseValue[0] >= baseValue[1]);
-			dist			= distTable[distNdx];
+			dist			= etcDistTable[distNdx];
 
 			paintR[0]		= (deUint8)deClamp32((int)baseR[0] + dist, 0, 255);
 			paintG[0]		= (deUint8)deClamp32((int)baseG[0] + dist, 0, 255);
@@ -702,26 +710,6 @@ void decompressETC2Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGB8], deUint
 
 void decompressEAC8Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_A8], deUint64 src)
 {
-	static const int modifierTable[16][8] =
-	{
-		{-3,  -6,  -9, -15,  2,  5,  8, 14},
-		{-3,  -7, -10, -13,  2,  6,  9, 12},
-		{-2,  -5,  -8, -13,  1,  4,  7, 12},
-		{-2,  -4,  -6, -13,  1,  3,  5, 12},
-		{-3,  -6,  -8, -12,  2,  5,  7, 11},
-		{-3,  -7,  -9, -11,  2,  6,  8, 10},
-		{-4,  -7,  -8, -11,  3,  6,  7, 10},
-		{-3,  -5,  -8, -11,  2,  4,  7, 10},
-		{-2,  -6,  -8, -10,  1,  5,  7,  9},
-		{-2,  -5,  -8, -10,  1,  4,  7,  9},
-		{-2,  -4,  -8, -10,  1,  3,  7,  9},
-		{-2,  -5,  -7, -10,  1,  4,  6,  9},
-		{-3,  -4,  -7, -10,  2,  3,  6,  9},
-		{-1,  -2,  -3, -10,  0,  1,  2,  9},
-		{-4,  -6,  -8,  -9,  3,  5,  7,  8},
-		{-3,  -5,  -7,  -9,  2,  4,  6,  8}
-	};
-
 	const deUint8	baseCodeword	= (deUint8)getBits(src, 56, 63);
 	const deUint8	multiplier		= (deUint8)getBits(src, 52, 55);
 	const deUint32	tableNdx		= getBits(src, 48, 51);
@@ -733,7 +721,7 @@ void decompressEAC8Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_A8], deUint64
 		const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_A8;
 		const int		pixelBitNdx		= 45 - 3*pixelNdx;
 		const deUint32	modifierNdx		= (getBit(src, pixelBitNdx + 2) << 2) | (getBit(src, pixelBitNdx + 1) << 1) | getBit(src, pixelBitNdx);
-		const int		modifier		= modifierTable[tableNdx][modifierNdx];
+		const int		modifier		= eacModifierTable[tableNdx][modifierNdx];
 
 		dst[dstOffset] = (deUint8)deClamp32((int)baseCodeword + (int)multiplier*modifier, 0, 255);
 	}
@@ -741,26 +729,6 @@ void decompressEAC8Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_A8], deUint64
 
 void decompressEAC11Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_R11], deUint64 src, bool signedMode)
 {
-	static const int modifierTable[16][8] =
-	{
-		{-3,  -6,  -9, -15,  2,  5,  8, 14},
-		{-3,  -7, -10, -13,  2,  6,  9, 12},
-		{-2,  -5,  -8, -13,  1,  4,  7, 12},
-		{-2,  -4,  -6, -13,  1,  3,  5, 12},
-		{-3,  -6,  -8, -12,  2,  5,  7, 11},
-		{-3,  -7,  -9, -11,  2,  6,  8, 10},
-		{-4,  -7,  -8, -11,  3,  6,  7, 10},
-		{-3,  -5,  -8, -11,  2,  4,  7, 10},
-		{-2,  -6,  -8, -10,  1,  5,  7,  9},
-		{-2,  -5,  -8, -10,  1,  4,  7,  9},
-		{-2,  -4,  -8, -10,  1,  3,  7,  9},
-		{-2,  -5,  -7, -10,  1,  4,  6,  9},
-		{-3,  -4,  -7, -10,  2,  3,  6,  9},
-		{-1,  -2,  -3, -10,  0,  1,  2,  9},
-		{-4,  -6,  -8,  -9,  3,  5,  7,  8},
-		{-3,  -5,  -7,  -9,  2,  4,  6,  8}
-	};
-
 	const deInt32 multiplier	= (deInt32)getBits(src, 52, 55);
 	const deInt32 tableNdx		= (deInt32)getBits(src, 48, 51);
 	deInt32 baseCodeword		= (deInt32)getBits(src, 56, 63);
@@ -780,7 +748,7 @@ void decompressEAC11Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_R11], deUint
 		const int		dstOffset		= (y*ETC2_BLOCK_WIDTH + x)*ETC2_UNCOMPRESSED_PIXEL_SIZE_R11;
 		const int		pixelBitNdx		= 45 - 3*pixelNdx;
 		const deUint32	modifierNdx		= (getBit(src, pixelBitNdx + 2) << 2) | (getBit(src, pixelBitNdx + 1) << 1) | getBit(src, pixelBitNdx);
-		const int		modifier		= modifierTable[tableNdx][modifierNdx];
+		const int		modifier		= eacModifierTable[tableNdx][modifierNdx];
 
 		if (signedMode)
 		{
@@ -807,6 +775,340 @@ void decompressEAC11Block (deUint8 dst[ETC2_UNCOMPRESSED_BLOCK_SIZE_R11], deUint
 	}
 }
 
+// Table-driven decoders used for decompressing whole images. Instead of
+// evaluating every texel through the bit-level helpers, each block is first
+// reduced to a small palette of final texel values, which is then indexed
+// with the per-texel selectors. Output is written in destination pixel
+// layout (row-major, dstPixelSize bytes per texel) and is bit-exact with
+// decompressETC1Block(), decompressETC2Block(), decompressEAC8Block() and
+// decompressEAC11Block().
+
+inline deUint32 getEtcSelector (deUint64 src, int x, int y)
+{
+	// Selector bits are stored in column-major order, MSBs in bits [16, 31].
+	const int pixelNdx = x*ETC2_BLOCK_HEIGHT + y;
+	return (((deUint32)(src >> (16+pixelNdx)) & 1u) << 1) | ((deUint32)(src >> pixelNdx) & 1u);
+}
+
+inline deUint32 getEacSelector (deUint64 src, int x, int y)
+{
+	const int pixelNdx = x*ETC2_BLOCK_HEIGHT + y;
+	return (deUint32)(src >> (45 - 3*pixelNdx)) & 0x7u;
+}
+
+inline void setPaletteColor (deUint8 dst[4], int r, int g, int b, deUint8 a)
+{
+	dst[0] = (deUint8)deClamp32(r, 0, 255);
+	dst[1] = (deUint8)deClamp32(g, 0, 255);
+	dst[2] = (deUint8)deClamp32(b, 0, 255);
+	dst[3] = a;
+}
+
+// Decode ETC1 or ETC2 RGB8 / RGB8_PUNCHTHROUGH_ALPHA1 block. Alpha is written only if dstPixelSize is 4.
+void decodeEtcColorBlockFast (deUint8* dst, int dstPixelSize, deUint64 src, bool etc1Mode, bool alphaMode)
+{
+	const int		diffOpaqueBit		= (int)getBit(src, 33);
+	const bool		punchthrough		= alphaMode && diffOpaqueBit == 0;
+	const deInt8	selBR				= (deInt8)getBits(src, 59, 63);
+	const deInt8	selBG				= (deInt8)getBits(src, 51, 55);
+	const deInt8	selBB				= (deInt8)getBits(src, 43, 47);
+	const deInt8	selDR				= extendSigned3To8((deUint8)getBits(src, 56, 58));
+	const deInt8	selDG				= extendSigned3To8((deUint8)getBits(src, 48, 50));
+	const deInt8	selDB				= extendSigned3To8((deUint8)getBits(src, 40, 42));
+	const bool		individualMode		= !alphaMode && diffOpaqueBit == 0;
+
+	DE_ASSERT(dstPixelSize == 3 || dstPixelSize == 4);
+	DE_ASSERT(!(etc1Mode && alphaMode));
+
+	if (individualMode || etc1Mode || (de::inRange(selBR + selDR, 0, 31) && de::inRange(selBG + selDG, 0, 31) && de::inRange(selBB + selDB, 0, 31)))
+	{
+		// Individual and differential modes: palette of 4 colors per sub-block.
+		const int		flipBit		= (int)getBit(src, 32);
+		const deUint32	table[2]	= { getBits(src, 37, 39), getBits(src, 34, 36) };
+		deUint8			baseR[2];
+		deUint8			baseG[2];
+		deUint8			baseB[2];
+		deUint8			palette[2][4][4];
+
+		if (individualMode)
+		{
+			baseR[0] = extend4To8((deUint8)getBits(src, 60, 63));
+			baseR[1] = extend4To8((deUint8)getBits(src, 56, 59));
+			baseG[0] = extend4To8((deUint8)getBits(src, 52, 55));
+			baseG[1] = extend4To8((deUint8)getBits(src, 48, 51));
+			baseB[0] = extend4To8((deUint8)getBits(src, 44, 47));
+			baseB[1] = extend4To8((deUint8)getBits(src, 40, 43));
+		}
+		else
+		{
+			baseR[0] = extend5To8((deUint8)selBR);
+			baseG[0] = extend5To8((deUint8)selBG);
+			baseB[0] = extend5To8((deUint8)selBB);
+
+			if (etc1Mode)
+			{
+				baseR[1] = extend5Delta3To8((deUint8)selBR, (deUint8)getBits(src, 56, 58));
+				baseG[1] = extend5Delta3To8((deUint8)selBG, (deUint8)getBits(src, 48, 50));
+				baseB[1] = extend5Delta3To8((deUint8)selBB, (deUint8)getBits(src, 40, 42));
+			}
+			else
+			{
+				baseR[1] = extend5To8((deUint8)(selBR + selDR));
+				baseG[1] = extend5To8((deUint8)(selBG + selDG));
+				baseB[1] = extend5To8((deUint8)(selBB + selDB));
+			}
+		}
+
+		for (int subBlock = 0; subBlock < 2; subBlock++)
+		for (int modifierNdx = 0; modifierNdx < 4; modifierNdx++)
+		{
+			const int modifier = (punchthrough && (modifierNdx == 0 || modifierNdx == 2)) ? 0 : etcModifierTable[table[subBlock]][modifierNdx];
+
+			if (punchthrough && modifierNdx == 2)
+				setPaletteColor(palette[subBlock][modifierNdx], 0, 0, 0, 0);
+			else
+				setPaletteColor(palette[subBlock][modifierNdx], (int)baseR[subBlock] + modifier, (int)baseG[subBlock] + modifier, (int)baseB[subBlock] + modifier, 255);
+		}
+
+		for (int y = 0; y < ETC2_BLOCK_HEIGHT; y++)
+		for (int x = 0; x < ETC2_BLOCK_WIDTH; x++)
+		{
+			const int				subBlock	= ((flipBit ? y : x) >= 2) ? 1 : 0;
+			const deUint8* const	color		= palette[subBlock][getEtcSelector(src, x, y)];
+
+			deMemcpy(dst + (y*ETC2_BLOCK_WIDTH + x)*dstPixelSize, color, dstPixelSize);
+		}
+	}
+	else if (!de::inRange(selBR + selDR, 0, 31) || !de::inRange(selBG + selDG, 0, 31))
+	{
+		// T and H modes: single palette of 4 paint colors.
+		deUint8 palette[4][4];
+
+		if (!de::inRange(selBR + selDR, 0, 31))
+		{
+			// T mode.
+			const int	paintR0		= extend4To8((deUint8)((getBits(src, 59, 60) << 2) | getBits(src, 56, 57)));
+			const int	paintG0		= extend4To8((deUint8)getBits(src, 52, 55));
+			const int	paintB0		= extend4To8((deUint8)getBits(src, 48, 51));
+			const int	paintR2		= extend4To8((deUint8)getBits(src, 44, 47));
+			const int	paintG2		= extend4To8((deUint8)getBits(src, 40, 43));
+			const int	paintB2		= extend4To8((deUint8)getBits(src, 36, 39));
+			const int	dist		= etcDistTable[(getBits(src, 34, 35) << 1) | getBit(src, 32)];
+
+			setPaletteColor(palette[0], paintR0, paintG0, paintB0, 255);
+			setPaletteColor(palette[1], paintR2 + dist, paintG2 + dist, paintB2 + dist, 255);
+			setPaletteColor(palette[2], paintR2, paintG2, paintB2, 255);
+			setPaletteColor(palette[3], paintR2 - dist, paintG2 - dist, paintB2 - dist, 255);
+		}
+		else
+		{
+			// H mode.
+			const int		baseR0		= extend4To8((deUint8)getBits(src, 59, 62));
+			const int		baseG0		= extend4To8((deUint8)((getBits(src, 56, 58) << 1) | getBit(src, 52)));
+			const int		baseB0		= extend4To8((deUint8)((getBit(src, 51) << 3) | getBits(src, 47, 49)));
+			const int		baseR1		= extend4To8((deUint8)getBits(src, 43, 46));
+			const int		baseG1		= extend4To8((deUint8)getBits(src, 39, 42));
+			const int		baseB1		= extend4To8((deUint8)getBits(src, 35, 38));
+			const deUint32	baseValue0	= ((deUint32)baseR0 << 16) | ((deUint32)baseG0 << 8) | (deUint32)baseB0;
+			const deUint32	baseValue1	= ((deUint32)baseR1 << 16) | ((deUint32)baseG1 << 8) | (deUint32)baseB1;
+			const int		dist		= etcDistTable[(getBit(src, 34) << 2) | (getBit(src, 32) << 1) | (deUint32)(baseValue0 >= baseValue1)];
+
+			setPaletteColor(palette[0], baseR0 + dist, baseG0 + dist, baseB0 + dist, 255);
+			setPaletteColor(palette[1], baseR0 - dist, baseG0 - dist, baseB0 - dist, 255);
+			setPaletteColor(palette[2], baseR1 + dist, baseG1 + dist, baseB1 + dist, 255);
+			setPaletteColor(palette[3], baseR1 - dist, baseG1 - dist, baseB1 - dist, 255);
+		}
+
+		if (punchthrough)
+			setPaletteColor(palette[2], 0, 0, 0, 0);
+
+		for (int y = 0; y < ETC2_BLOCK_HEIGHT; y++)
+		for (int x = 0; x < ETC2_BLOCK_WIDTH; x++)
+			deMemcpy(dst + (y*ETC2_BLOCK_WIDTH + x)*dstPixelSize, palette[getEtcSelector(src, x, y)], dstPixelSize);
+	}
+	else
+	{
+		// Planar mode: colors are interpolated incrementally from origin, horizontal and vertical endpoints.
+		const int	RO		= extend6To8((deUint8)getBits(src, 57, 62));
+		const int	GO		= extend7To8((deUint8)((getBit(src, 56) << 6) | getBits(src, 49, 54)));
+		const int	BO		= extend6To8((deUint8)((getBit(src, 48) << 5) | (getBits(src, 43, 44) << 3) | getBits(src, 39, 41)));
+		const int	RH		= extend6To8((deUint8)((getBits(src, 34, 38) << 1) | getBit(src, 32)));
+		const int	GH		= extend7To8((deUint8)getBits(src, 25, 31));
+		const int	BH		= extend6To8((deUint8)getBits(src, 19, 24));
+		const int	RV		= extend6To8((deUint8)getBits(src, 13, 18));
+		const int	GV		= extend7To8((deUint8)getBits(src, 6, 12));
+		const int	BV		= extend6To8((deUint8)getBits(src, 0, 5));
+
+		for (int y = 0; y < ETC2_BLOCK_HEIGHT; y++)
+		{
+			int r = y*(RV-RO) + 4*RO + 2;
+			int g = y*(GV-GO) + 4*GO + 2;
+			int b = y*(BV-BO) + 4*BO + 2;
+
+			for (int x = 0; x < ETC2_BLOCK_WIDTH; x++)
+			{
+				deUint8 color[4];
+
+				setPaletteColor(color, r >> 2, g >> 2, b >> 2, 255);
+				deMemcpy(dst + (y*ETC2_BLOCK_WIDTH + x)*dstPixelSize, color, dstPixelSize);
+
+				r += RH-RO;
+				g += GH-GO;
+				b += BH-BO;
+			}
+		}
+	}
+}
+
+// Decode EAC 8-bit alpha block into first byte of each dstPixelSize-sized texel.
+void decodeEAC8BlockFast (deUint8* dst, int dstPixelSize, deUint64 src)
+{
+	const int		baseCodeword	= (int)getBits(src, 56, 63);
+	const int		multiplier		= (int)getBits(src, 52, 55);
+	const int* const modifiers		= eacModifierTable[getBits(src, 48, 51)];
+	deUint8			palette[8];
+
+	for (int ndx = 0; ndx < 8; ndx++)
+		palette[ndx] = (deUint8)deClamp32(baseCodeword + multiplier*modifiers[ndx], 0, 255);
+
+	for (int y = 0; y < ETC2_BLOCK_HEIGHT; y++)
+	for (int x = 0; x < ETC2_BLOCK_WIDTH; x++)
+		dst[(y*ETC2_BLOCK_WIDTH + x)*dstPixelSize] = palette[getEacSelector(src, x, y)];
+}
+
+// Decode EAC 11-bit block into first two bytes of each dstPixelSize-sized texel. Values are extended to 16 bits.
+void decodeEAC11BlockFast (deUint8* dst, int dstPixelSize, deUint64 src, bool signedMode)
+{
+	const deInt32		multiplier		= (deInt32)getBits(src, 52, 55);
+	const int* const	modifiers		= eacModifierTable[getBits(src, 48, 51)];
+	deInt32				baseCodeword	= (deInt32)getBits(src, 56, 63);
+	deUint16			palette[8];
+
+	if (signedMode)
+	{
+		if (baseCodeword > 127)
+			baseCodeword -= 256;
+		if (baseCodeword == -128)
+			baseCodeword = -127;
+	}
+
+	for (int ndx = 0; ndx < 8; ndx++)
+	{
+		const int modifier = (multiplier != 0) ? multiplier*modifiers[ndx]*8 : modifiers[ndx];
+
+		if (signedMode)
+			palette[ndx] = (deUint16)extend11To16WithSign((deInt16)deClamp32(baseCodeword*8 + modifier, -1023, 1023));
+		else
+			palette[ndx] = extend11To16((deUint16)deClamp32(baseCodeword*8 + 4 + modifier, 0, 2047));
+	}
+
+	for (int y = 0; y < ETC2_BLOCK_HEIGHT; y++)
+	for (int x = 0; x < ETC2_BLOCK_WIDTH; x++)
+		deMemcpy(dst + (y*ETC2_BLOCK_WIDTH + x)*dstPixelSize, &palette[getEacSelector(src, x, y)], sizeof(deUint16));
+}
+
+// Decode single block in uncompressed format layout, rows tightly packed.
+void decodeEtcBlockFast (CompressedTexFormat format, deUint8* dst, const deUint8* src)
+{
+	switch (format)
+	{
+		case COMPRESSEDTEXFORMAT_ETC1_RGB8:
+			decodeEtcColorBlockFast(dst, ETC2_UNCOMPRESSED_PIXEL_SIZE_RGB8, get64BitBlock(src, 0), true, false);
+			break;
+
+		case COMPRESSEDTEXFORMAT_ETC2_RGB8:
+		case COMPRESSEDTEXFORMAT_ETC2_SRGB8:
+			decodeEtcColorBlockFast(dst, ETC2_UNCOMPRESSED_PIXEL_SIZE_RGB8, get64BitBlock(src, 0), false, false);
+			break;
+
+		case COMPRESSEDTEXFORMAT_ETC2_RGB8_PUNCHTHROUGH_ALPHA1:
+		case COMPRESSEDTEXFORMAT_ETC2_SRGB8_PUNCHTHROUGH_ALPHA1:
+			decodeEtcColorBlockFast(dst, ETC2_UNCOMPRESSED_PIXEL_SIZE_RGBA8, get64BitBlock(src, 0), false, true);
+			break;
+
+		case COMPRESSEDTEXFORMAT_ETC2_EAC_RGBA8:
+		case COMPRESSEDTEXFORMAT_ETC2_EAC_SRGB8_ALPHA8:
+			decodeEtcColorBlockFast(dst, ETC2_UNCOMPRESSED_PIXEL_SIZE_RGBA8, get128BitBlockEnd(src, 0), false, false);
+			decodeEAC8BlockFast(dst + 3, ETC2_UNCOMPRESSED_PIXEL_SIZE_RGBA8, get128BitBlockStart(src, 0));
+			break;
+
+		case COMPRESSEDTEXFORMAT_EAC_R11:
+		case COMPRESSEDTEXFORMAT_EAC_SIGNED_R11:
+			decodeEAC11BlockFast(dst, ETC2_UNCOMPRESSED_PIXEL_SIZE_R11, get64BitBlock(src, 0), format == COMPRESSEDTEXFORMAT_EAC_SIGNED_R11);
+			break;
+
+		case COMPRESSEDTEXFORMAT_EAC_RG11:
+		case COMPRESSEDTEXFORMAT_EAC_SIGNED_RG11:
+			decodeEAC11BlockFast(dst,		ETC2_UNCOMPRESSED_PIXEL_SIZE_RG11, get128BitBlockStart(src, 0),	format == COMPRESSEDTEXFORMAT_EAC_SIGNED_RG11);
+			decodeEAC11BlockFast(dst + 2,	ETC2_UNCOMPRESSED_PIXEL_SIZE_RG11, get128BitBlockEnd(src, 0),	format == COMPRESSEDTEXFORMAT_EAC_SIGNED_RG11);
+			break;
+
+		default:
+			DE_ASSERT(false);
+	}
+}
+
+// Decodes rows of blocks (block row index spans all slices) directly into destination.
+class EtcBlockRowDecoder : public de::RangeTask
+{
+public:
+	EtcBlockRowDecoder (const PixelBufferAccess& dst, CompressedTexFormat format, const deUint8* src)
+		: m_dst				(dst)
+		, m_format			(format)
+		, m_src				(src)
+		, m_blockSize		(getBlockSize(format))
+		, m_pixelSize		(dst.getFormat().getPixelSize())
+		, m_numBlocksX		(deDivRoundUp32(dst.getWidth(), ETC2_BLOCK_WIDTH))
+		, m_numBlocksY		(deDivRoundUp32(dst.getHeight(), ETC2_BLOCK_HEIGHT))
+	{
+		DE_ASSERT(m_pixelSize*ETC2_BLOCK_WIDTH*ETC2_BLOCK_HEIGHT <= ETC2_UNCOMPRESSED_BLOCK_SIZE_RGBA8);
+	}
+
+	int getNumBlockRows (void) const { return m_numBlocksY*m_dst.getDepth(); }
+	int getNumBlocksX	(void) const { return m_numBlocksX; }
+
+	void execute (int beginRow, int endRow)
+	{
+		deUint8 block[ETC2_UNCOMPRESSED_BLOCK_SIZE_RGBA8];
+
+		for (int blockRowNdx = beginRow; blockRowNdx < endRow; blockRowNdx++)
+		{
+			const int		z			= blockRowNdx / m_numBlocksY;
+			const int		blockY		= blockRowNdx % m_numBlocksY;
+			const int		copyHeight	= de::min((int)ETC2_BLOCK_HEIGHT, m_dst.getHeight() - blockY*ETC2_BLOCK_HEIGHT);
+			const deUint8*	rowSrc		= m_src + (size_t)blockRowNdx*m_numBlocksX*m_blockSize;
+
+			for (int blockX = 0; blockX < m_numBlocksX; blockX++)
+			{
+				const int	copyWidth	= de::min((int)ETC2_BLOCK_WIDTH, m_dst.getWidth() - blockX*ETC2_BLOCK_WIDTH);
+
+				decodeEtcBlockFast(m_format, block, rowSrc + blockX*m_blockSize);
+
+				for (int y = 0; y < copyHeight; y++)
+					deMemcpy(m_dst.getPixelPtr(blockX*ETC2_BLOCK_WIDTH, blockY*ETC2_BLOCK_HEIGHT + y, z), &block[y*ETC2_BLOCK_WIDTH*m_pixelSize], copyWidth*m_pixelSize);
+			}
+		}
+	}
+
+private:
+	const PixelBufferAccess		m_dst;
+	const CompressedTexFormat	m_format;
+	const deUint8* const		m_src;
+	const int					m_blockSize;
+	const int					m_pixelSize;
+	const int					m_numBlocksX;
+	const int					m_numBlocksY;
+};
+
+void decompressEtcImage (const PixelBufferAccess& dst, CompressedTexFormat format, const deUint8* src)
+{
+	// Aim for at least ~4k blocks per thread; thread launch overhead dominates for smaller images.
+	const int			minBlocksPerThread	= 4096;
+	EtcBlockRowDecoder	decoder				(dst, format, src);
+
+	de::parallelFor(decoder.getNumBlockRows(), deMax32(minBlocksPerThread / decoder.getNumBlocksX(), 1), decoder);
+}
+
 } // EtcDecompressInternal
 
 void decompressETC1 (const PixelBufferAccess& dst, const deUint8* src)
@@ -1045,7 +1347,7 @@ int componentSum (const IVec3& vec)
 
 } // anonymous
 
-void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+void decompressReference (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
 {
 	const int				blockSize			= getBlockSize(fmt);
 	const IVec3				blockPixelSize		(getBlockPixelSize(fmt));
@@ -1076,6 +1378,17 @@ void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const de
 	}
 }
 
+void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+{
+	DE_ASSERT(dst.getFormat() == getUncompressedFormat(fmt));
+
+	// ETC formats are decoded with table-driven decoders directly into destination, in parallel
+	if (isEtcFormat(fmt) && dst.getPixelPitch() == dst.getFormat().getPixelSize())
+		EtcDecompressInternal::decompressEtcImage(dst, fmt, src);
+	else
+		decompressReference(dst, fmt, src, params);
+}
+
 CompressedTexture::CompressedTexture (void)
 	: m_format	(COMPRESSEDTEXFORMAT_LAST)
 	, m_width	(0)
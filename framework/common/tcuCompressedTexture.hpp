@@ -137,6 +137,9 @@ private:
 
 void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params = TexDecompressionParams());
 
+//! Block-by-block reference decoder. Slow, but independent of format-specific fast paths used by decompress().
+void decompressReference (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params = TexDecompressionParams());
+
 } // tcu
 
 #endif // _TCUCOMPRESSEDTEXTURE_HPP
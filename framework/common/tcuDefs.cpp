@@ -23,6 +23,7 @@
 
 #include "tcuDefs.hpp"
 #include "deFilePath.hpp"
+#include "deParallel.hpp"
 #include "qpDebugOut.h"
 
 #include <sstream>
@@ -129,4 +130,33 @@ NotSupportedError::NotSupportedError (const std::string& message)
 {
 }
 
+namespace
+{
+
+//! Keeps type of tcu exceptions thrown from de::parallelFor() workers.
+de::CapturedException* captureTcuException (void)
+{
+	try
+	{
+		throw;
+	}
+	catch (const NotSupportedError& e)	{ return new de::CapturedExceptionT<NotSupportedError>(e);	}
+	catch (const ResourceError& e)		{ return new de::CapturedExceptionT<ResourceError>(e);		}
+	catch (const InternalError& e)		{ return new de::CapturedExceptionT<InternalError>(e);		}
+	catch (const TestError& e)			{ return new de::CapturedExceptionT<TestError>(e);			}
+	catch (const TestException& e)		{ return new de::CapturedExceptionT<TestException>(e);		}
+	catch (const Exception& e)			{ return new de::CapturedExceptionT<Exception>(e);			}
+	catch (...)							{ return DE_NULL;											}
+}
+
+class ExceptionCaptureRegistration
+{
+public:
+	ExceptionCaptureRegistration (void) { de::registerExceptionCapture(captureTcuException); }
+};
+
+const ExceptionCaptureRegistration s_exceptionCaptureRegistration;
+
+} // anonymous
+
 } // namespace tcu
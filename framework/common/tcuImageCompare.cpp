@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "tcuImageCompare.hpp"
+#include "tcuInstrumentation.hpp"
 #include "tcuSurface.hpp"
 #include "tcuFuzzyImageCompare.hpp"
 #include "tcuBilinearImageCompare.hpp"
@@ -32,8 +33,10 @@
 #include "tcuTexture.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuFloat.hpp"
+#include "deParallel.hpp"
 
 #include <string.h>
+#include <vector>
 
 namespace tcu
 {
@@ -88,96 +91,402 @@ void computeScaleAndBias (const ConstPixelBufferAccess& reference, const ConstPi
 	}
 }
 
-static int findNumPositionDeviationFailingPixels (const PixelBufferAccess& errorMask, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue)
+inline bool isPixelWithinThreshold (const IVec4& a, const IVec4& b, const UVec4& threshold)
 {
-	const tcu::IVec4	okColor				(0, 255, 0, 255);
-	const tcu::IVec4	errorColor			(255, 0, 0, 255);
-	const int			width				= reference.getWidth();
-	const int			height				= reference.getHeight();
-	const int			depth				= reference.getDepth();
-	int					numFailingPixels	= 0;
+	// \note Difference computed in 32-bit integers to match ConstPixelBufferAccess::getPixelInt() based comparison
+	return (deUint32)de::abs(a.x() - b.x()) <= threshold.x() &&
+		   (deUint32)de::abs(a.y() - b.y()) <= threshold.y() &&
+		   (deUint32)de::abs(a.z() - b.z()) <= threshold.z() &&
+		   (deUint32)de::abs(a.w() - b.w()) <= threshold.w();
+}
 
-	// Accept pixels "sampling" over the image bounds pixels since "taps" could be anything
-	const int			beginX				= (acceptOutOfBoundsAsAnyValue) ? (maxPositionDeviation.x()) : (0);
-	const int			beginY				= (acceptOutOfBoundsAsAnyValue) ? (maxPositionDeviation.y()) : (0);
-	const int			beginZ				= (acceptOutOfBoundsAsAnyValue) ? (maxPositionDeviation.z()) : (0);
-	const int			endX				= (acceptOutOfBoundsAsAnyValue) ? (width  - maxPositionDeviation.x()) : (width);
-	const int			endY				= (acceptOutOfBoundsAsAnyValue) ? (height - maxPositionDeviation.y()) : (height);
-	const int			endZ				= (acceptOutOfBoundsAsAnyValue) ? (depth  - maxPositionDeviation.z()) : (depth);
+/*--------------------------------------------------------------------*//*!
+ * \brief Full-width rows of integer image unpacked into IVec4 array
+ *
+ * Holds rows [origin.y, origin.y+size.y) of slices [origin.z, origin.z+size.z).
+ * Pixels are addressed with image coordinates.
+ *//*--------------------------------------------------------------------*/
+class UnpackedIntRows
+{
+public:
+	UnpackedIntRows (void)
+		: m_origin	(0)
+		, m_size	(0)
+	{
+	}
 
-	TCU_CHECK_INTERNAL(result.getWidth() == width && result.getHeight() == height && result.getDepth() == depth);
-	DE_ASSERT(endX > 0 && endY > 0 && endZ > 0);	// most likely a bug
+	void setRegion (const IVec3& origin, const IVec3& size)
+	{
+		DE_ASSERT(origin.x() == 0);
 
-	tcu::clear(errorMask, okColor);
+		m_origin	= origin;
+		m_size		= size;
+		m_pixels.resize((size_t)size.x()*(size_t)size.y()*(size_t)size.z());
+	}
 
-	for (int z = beginZ; z < endZ; z++)
+	const IVec3&	getOrigin		(void) const				{ return m_origin;													}
+	const IVec3&	getSize			(void) const				{ return m_size;													}
+	IVec4&			getPixel		(int x, int y, int z)		{ return getRowPtr(y, z)[x];										}
+	const IVec4&	getPixel		(int x, int y, int z) const	{ return getRowPtr(y, z)[x];										}
+	IVec4*			getRowPtr		(int y, int z)				{ return &m_pixels[getRowOffset(y, z)];								}
+	const IVec4*	getRowPtr		(int y, int z) const		{ return &m_pixels[getRowOffset(y, z)];								}
+	int*			getDataPtr		(void)						{ return m_pixels.empty() ? DE_NULL : m_pixels[0].getPtr();		}
+	const int*		getDataPtr		(void) const				{ return m_pixels.empty() ? DE_NULL : m_pixels[0].getPtr();		}
+	size_t			getNumPixels	(void) const				{ return m_pixels.size();											}
+
+	void unpack (const ConstPixelBufferAccess& src, int y, int z)
 	{
-		for (int y = beginY; y < endY; y++)
+		IVec4* const row = getRowPtr(y, z);
+
+		for (int x = 0; x < m_size.x(); x++)
+			row[x] = src.getPixelInt(x, y, z);
+	}
+
+private:
+	size_t getRowOffset (int y, int z) const
+	{
+		DE_ASSERT(de::inRange(y - m_origin.y(), 0, m_size.y() - 1) && de::inRange(z - m_origin.z(), 0, m_size.z() - 1));
+		return (size_t)(((z - m_origin.z())*m_size.y() + (y - m_origin.y()))*m_size.x());
+	}
+
+	IVec3				m_origin;
+	IVec3				m_size;
+	std::vector<IVec4>	m_pixels;
+};
+
+//! Min/max filter along one axis. Neighborhood is clamped to region bounds.
+void minMaxFilterAxis (const UnpackedIntRows& srcMin, const UnpackedIntRows& srcMax, UnpackedIntRows& dstMin, UnpackedIntRows& dstMax, int axis, int radius)
+{
+	const IVec3			size		= srcMin.getSize();
+	const IVec3			stride		(1, size.x(), size.x()*size.y());
+	const int			axisSize	= size[axis];
+	const int			axisStride	= 4*stride[axis];
+	const int* const	srcMinPtr	= srcMin.getDataPtr();
+	const int* const	srcMaxPtr	= srcMax.getDataPtr();
+	int* const			dstMinPtr	= dstMin.getDataPtr();
+	int* const			dstMaxPtr	= dstMax.getDataPtr();
+
+	for (int z = 0; z < size.z(); z++)
+	for (int y = 0; y < size.y(); y++)
+	for (int x = 0; x < size.x(); x++)
+	{
+		const int	coord		= IVec3(x, y, z)[axis];
+		const int	offset		= 4*(z*stride.z() + y*stride.y() + x);
+		const int	firstOffset	= offset + (de::max(0, coord - radius) - coord)*axisStride;
+		const int	lastOffset	= offset + (de::min(axisSize - 1, coord + radius) - coord)*axisStride;
+
+		for (int c = 0; c < 4; c++)
 		{
-			for (int x = beginX; x < endX; x++)
+			int minVal = srcMinPtr[firstOffset + c];
+			int maxVal = srcMaxPtr[firstOffset + c];
+
+			for (int srcOffset = firstOffset + axisStride; srcOffset <= lastOffset; srcOffset += axisStride)
 			{
-				const IVec4	refPix = reference.getPixelInt(x, y, z);
-				const IVec4	cmpPix = result.getPixelInt(x, y, z);
+				minVal = de::min(minVal, srcMinPtr[srcOffset + c]);
+				maxVal = de::max(maxVal, srcMaxPtr[srcOffset + c]);
+			}
 
-				// Exact match
-				{
-					const UVec4	diff = abs(refPix - cmpPix).cast<deUint32>();
-					const bool	isOk = boolAll(lessThanEqual(diff, threshold));
+			dstMinPtr[offset + c] = minVal;
+			dstMaxPtr[offset + c] = maxVal;
+		}
+	}
+}
 
-					if (isOk)
-						continue;
-				}
+/*--------------------------------------------------------------------*//*!
+ * \brief Compute per-channel min and max over box neighborhood
+ *
+ * Region of src must contain neighborhood of the rows that results are
+ * used for, clamped to image bounds. Results for other rows are clamped
+ * to region bounds and not valid.
+ *//*--------------------------------------------------------------------*/
+void computeNeighborhoodMinMax (const UnpackedIntRows& src, const IVec3& radius, UnpackedIntRows& minDst, UnpackedIntRows& maxDst, UnpackedIntRows& tmpMin, UnpackedIntRows& tmpMax)
+{
+	minDst.setRegion(src.getOrigin(), src.getSize());
+	maxDst.setRegion(src.getOrigin(), src.getSize());
+	tmpMin.setRegion(src.getOrigin(), src.getSize());
+	tmpMax.setRegion(src.getOrigin(), src.getSize());
+
+	minMaxFilterAxis(src,		src,		minDst,	maxDst,	0, radius.x());
+	minMaxFilterAxis(minDst,	maxDst,		tmpMin,	tmpMax,	1, radius.y());
+	minMaxFilterAxis(tmpMin,	tmpMax,		minDst,	maxDst,	2, radius.z());
+}
 
-				// Find matching pixels for both result and reference pixel
+//! Returns true if no pixel within [minVal, maxVal] can be within threshold of value.
+inline bool isOutsideNeighborhoodRange (const IVec4& value, const IVec4& minVal, const IVec4& maxVal, const UVec4& threshold)
+{
+	for (int c = 0; c < 4; c++)
+	{
+		if ((deInt64)value[c] - (deInt64)maxVal[c] > (deInt64)threshold[c] ||
+			(deInt64)minVal[c] - (deInt64)value[c] > (deInt64)threshold[c])
+			return true;
+	}
+	return false;
+}
 
-				{
-					bool pixelFoundForReference = false;
+bool isWithinSafeRange (const UnpackedIntRows& image)
+{
+	// Neighborhood range rejection is exact only if 32-bit pixel differences can't overflow.
+	const int			limit		= 1 << 30;
+	const size_t		numValues	= 4*image.getNumPixels();
+	const int* const	values		= image.getDataPtr();
 
-					// Find deviated result pixel for reference
+	for (size_t ndx = 0; ndx < numValues; ndx++)
+	{
+		if (values[ndx] < -limit || values[ndx] > limit)
+			return false;
+	}
 
-					for (int sz = de::max(0, z - maxPositionDeviation.z()); sz <= de::min(depth  - 1, z + maxPositionDeviation.z()) && !pixelFoundForReference; ++sz)
-					for (int sy = de::max(0, y - maxPositionDeviation.y()); sy <= de::min(height - 1, y + maxPositionDeviation.y()) && !pixelFoundForReference; ++sy)
-					for (int sx = de::max(0, x - maxPositionDeviation.x()); sx <= de::min(width  - 1, x + maxPositionDeviation.x()) && !pixelFoundForReference; ++sx)
-					{
-						const IVec4	deviatedCmpPix	= result.getPixelInt(sx, sy, sz);
-						const UVec4	diff			= abs(refPix - deviatedCmpPix).cast<deUint32>();
-						const bool	isOk			= boolAll(lessThanEqual(diff, threshold));
+	return true;
+}
 
-						pixelFoundForReference		= isOk;
-					}
+class PositionDeviationSearch
+{
+public:
+	PositionDeviationSearch (const IVec3& imageSize, const UnpackedIntRows& reference, const UnpackedIntRows& result, const UVec4& threshold, const IVec3& maxPositionDeviation)
+		: m_imageSize				(imageSize)
+		, m_reference				(reference)
+		, m_result					(result)
+		, m_threshold				(threshold)
+		, m_maxPositionDeviation	(maxPositionDeviation)
+		, m_refMin					(DE_NULL)
+		, m_refMax					(DE_NULL)
+		, m_resMin					(DE_NULL)
+		, m_resMax					(DE_NULL)
+	{
+	}
 
-					if (!pixelFoundForReference)
-					{
-						errorMask.setPixel(errorColor, x, y, z);
-						++numFailingPixels;
-						continue;
-					}
-				}
-				{
-					bool pixelFoundForResult = false;
+	void setNeighborhoodRanges (const UnpackedIntRows* refMin, const UnpackedIntRows* refMax, const UnpackedIntRows* resMin, const UnpackedIntRows* resMax)
+	{
+		m_refMin = refMin;
+		m_refMax = refMax;
+		m_resMin = resMin;
+		m_resMax = resMax;
+	}
 
-					// Find deviated reference pixel for result
+	bool isPixelOk (int x, int y, int z) const
+	{
+		const IVec4&	refPix	= m_reference.getPixel(x, y, z);
+		const IVec4&	cmpPix	= m_result.getPixel(x, y, z);
 
-					for (int sz = de::max(0, z - maxPositionDeviation.z()); sz <= de::min(depth  - 1, z + maxPositionDeviation.z()) && !pixelFoundForResult; ++sz)
-					for (int sy = de::max(0, y - maxPositionDeviation.y()); sy <= de::min(height - 1, y + maxPositionDeviation.y()) && !pixelFoundForResult; ++sy)
-					for (int sx = de::max(0, x - maxPositionDeviation.x()); sx <= de::min(width  - 1, x + maxPositionDeviation.x()) && !pixelFoundForResult; ++sx)
-					{
-						const IVec4	deviatedRefPix	= reference.getPixelInt(sx, sy, sz);
-						const UVec4	diff			= abs(cmpPix - deviatedRefPix).cast<deUint32>();
-						const bool	isOk			= boolAll(lessThanEqual(diff, threshold));
+		// Both searches must succeed. Neighborhood ranges allow rejecting without searching.
+		if (m_resMin && isOutsideNeighborhoodRange(refPix, m_resMin->getPixel(x, y, z), m_resMax->getPixel(x, y, z), m_threshold))
+			return false;
 
-						pixelFoundForResult			= isOk;
-					}
+		if (m_refMin && isOutsideNeighborhoodRange(cmpPix, m_refMin->getPixel(x, y, z), m_refMax->getPixel(x, y, z), m_threshold))
+			return false;
+
+		return findMatch(m_result, refPix, x, y, z) && findMatch(m_reference, cmpPix, x, y, z);
+	}
 
-					if (!pixelFoundForResult)
+private:
+	bool findMatch (const UnpackedIntRows& image, const IVec4& value, int x, int y, int z) const
+	{
+		const int	x0	= de::max(0, x - m_maxPositionDeviation.x());
+		const int	x1	= de::min(m_imageSize.x() - 1, x + m_maxPositionDeviation.x());
+		const int	y0	= de::max(0, y - m_maxPositionDeviation.y());
+		const int	y1	= de::min(m_imageSize.y() - 1, y + m_maxPositionDeviation.y());
+		const int	z0	= de::max(0, z - m_maxPositionDeviation.z());
+		const int	z1	= de::min(m_imageSize.z() - 1, z + m_maxPositionDeviation.z());
+
+		for (int sz = z0; sz <= z1; ++sz)
+		for (int sy = y0; sy <= y1; ++sy)
+		{
+			const IVec4* const row = image.getRowPtr(sy, sz);
+
+			for (int sx = x0; sx <= x1; ++sx)
+			{
+				if (isPixelWithinThreshold(value, row[sx], m_threshold))
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	const IVec3					m_imageSize;
+	const UnpackedIntRows&		m_reference;
+	const UnpackedIntRows&		m_result;
+	const UVec4					m_threshold;
+	const IVec3					m_maxPositionDeviation;
+
+	const UnpackedIntRows*		m_refMin;
+	const UnpackedIntRows*		m_refMax;
+	const UnpackedIntRows*		m_resMin;
+	const UnpackedIntRows*		m_resMax;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Classifies pixels in bands of rows
+ *
+ * Each band unpacks only its own rows and the rows within search distance
+ * of them, so memory use depends on band size rather than image size.
+ * Rows of the band are first checked for exact matches, and neighborhood
+ * is unpacked and searched only if some pixels don't match.
+ *//*--------------------------------------------------------------------*/
+class PositionDeviationBandTask : public de::RangeTask
+{
+public:
+	PositionDeviationBandTask (const PixelBufferAccess& errorMask, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const IVec3& maxPositionDeviation, const IVec3& begin, const IVec3& end, int bandHeight, std::vector<int>& numFailingPerBand)
+		: m_errorMask				(errorMask)
+		, m_reference				(reference)
+		, m_result					(result)
+		, m_threshold				(threshold)
+		, m_maxPositionDeviation	(maxPositionDeviation)
+		, m_begin					(begin)
+		, m_end						(end)
+		, m_bandHeight				(bandHeight)
+		, m_numBandsPerSlice		(deDivRoundUp32(end.y() - begin.y(), bandHeight))
+		, m_numFailingPerBand		(numFailingPerBand)
+	{
+	}
+
+	int getNumBands (void) const { return m_numBandsPerSlice*(m_end.z() - m_begin.z()); }
+
+	void execute (int begin, int end)
+	{
+		// Buffers are reused for all bands executed by this call
+		Workspace workspace;
+
+		for (int bandNdx = begin; bandNdx < end; bandNdx++)
+			m_numFailingPerBand[bandNdx] = processBand(workspace, bandNdx);
+	}
+
+private:
+	struct Workspace
+	{
+		UnpackedIntRows	ref;
+		UnpackedIntRows	res;
+		UnpackedIntRows	refMin;
+		UnpackedIntRows	refMax;
+		UnpackedIntRows	resMin;
+		UnpackedIntRows	resMax;
+		UnpackedIntRows	tmpMin;
+		UnpackedIntRows	tmpMax;
+	};
+
+	int processBand (Workspace& workspace, int bandNdx) const
+	{
+		const tcu::IVec4	errorColor		(255, 0, 0, 255);
+		const IVec3			imageSize		(m_reference.getWidth(), m_reference.getHeight(), m_reference.getDepth());
+		const int			z				= m_begin.z() + bandNdx / m_numBandsPerSlice;
+		const int			y0				= m_begin.y() + (bandNdx % m_numBandsPerSlice)*m_bandHeight;
+		const int			y1				= de::min(y0 + m_bandHeight, m_end.y());
+		const IVec3			regionBegin		(0, de::max(0, y0 - m_maxPositionDeviation.y()), de::max(0, z - m_maxPositionDeviation.z()));
+		const IVec3			regionEnd		(imageSize.x(), de::min(imageSize.y(), y1 + m_maxPositionDeviation.y()), de::min(imageSize.z(), z + m_maxPositionDeviation.z() + 1));
+		int					numMismatches	= 0;
+		int					numFailing		= 0;
+
+		workspace.ref.setRegion(regionBegin, regionEnd - regionBegin);
+		workspace.res.setRegion(regionBegin, regionEnd - regionBegin);
+
+		// Pixels that match need no search
+		for (int y = y0; y < y1; y++)
+		{
+			workspace.ref.unpack(m_reference, y, z);
+			workspace.res.unpack(m_result, y, z);
+
+			{
+				const IVec4* const	refRow	= workspace.ref.getRowPtr(y, z);
+				const IVec4* const	resRow	= workspace.res.getRowPtr(y, z);
+
+				for (int x = m_begin.x(); x < m_end.x(); x++)
+					numMismatches += isPixelWithinThreshold(refRow[x], resRow[x], m_threshold) ? 0 : 1;
+			}
+		}
+
+		if (numMismatches == 0)
+			return 0;
+
+		for (int sz = regionBegin.z(); sz < regionEnd.z(); sz++)
+		for (int sy = regionBegin.y(); sy < regionEnd.y(); sy++)
+		{
+			if (sz == z && de::inRange(sy, y0, y1 - 1))
+				continue;
+
+			workspace.ref.unpack(m_reference, sy, sz);
+			workspace.res.unpack(m_result, sy, sz);
+		}
+
+		{
+			// Min/max range tables allow O(1) rejection but cost two separable filter passes over
+			// both regions. Build them only if the worst-case search over mismatching pixels is
+			// more expensive.
+			const IVec3				window		= 2*m_maxPositionDeviation + IVec3(1);
+			const IVec3				regionSize	= regionEnd - regionBegin;
+			const deInt64			searchCost	= (deInt64)numMismatches * (deInt64)(window.x()*window.y()*window.z());
+			const deInt64			filterCost	= (deInt64)regionSize.x() * (deInt64)(regionSize.y()*regionSize.z()) * (deInt64)(window.x() + window.y() + window.z()) * 2;
+			const bool				useRanges	= searchCost > filterCost && isWithinSafeRange(workspace.ref) && isWithinSafeRange(workspace.res);
+			PositionDeviationSearch	search		(imageSize, workspace.ref, workspace.res, m_threshold, m_maxPositionDeviation);
+
+			if (useRanges)
+			{
+				computeNeighborhoodMinMax(workspace.ref, m_maxPositionDeviation, workspace.refMin, workspace.refMax, workspace.tmpMin, workspace.tmpMax);
+				computeNeighborhoodMinMax(workspace.res, m_maxPositionDeviation, workspace.resMin, workspace.resMax, workspace.tmpMin, workspace.tmpMax);
+
+				search.setNeighborhoodRanges(&workspace.refMin, &workspace.refMax, &workspace.resMin, &workspace.resMax);
+			}
+
+			for (int y = y0; y < y1; y++)
+			{
+				const IVec4* const	refRow	= workspace.ref.getRowPtr(y, z);
+				const IVec4* const	resRow	= workspace.res.getRowPtr(y, z);
+
+				for (int x = m_begin.x(); x < m_end.x(); x++)
+				{
+					if (!isPixelWithinThreshold(refRow[x], resRow[x], m_threshold) && !search.isPixelOk(x, y, z))
 					{
-						errorMask.setPixel(errorColor, x, y, z);
-						++numFailingPixels;
-						continue;
+						m_errorMask.setPixel(errorColor, x, y, z);
+						++numFailing;
 					}
 				}
 			}
 		}
+
+		return numFailing;
+	}
+
+	const PixelBufferAccess&		m_errorMask;
+	const ConstPixelBufferAccess&	m_reference;
+	const ConstPixelBufferAccess&	m_result;
+	const UVec4						m_threshold;
+	const IVec3						m_maxPositionDeviation;
+	const IVec3						m_begin;
+	const IVec3						m_end;
+	const int						m_bandHeight;
+	const int						m_numBandsPerSlice;
+	std::vector<int>&				m_numFailingPerBand;
+};
+
+static int findNumPositionDeviationFailingPixels (const PixelBufferAccess& errorMask, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue)
+{
+	const tcu::IVec4	okColor				(0, 255, 0, 255);
+	const int			width				= reference.getWidth();
+	const int			height				= reference.getHeight();
+	const int			depth				= reference.getDepth();
+	const int			bandHeight			= de::max(1, 16384 / de::max(width, 1));
+	int					numFailingPixels	= 0;
+
+	// Accept pixels "sampling" over the image bounds pixels since "taps" could be anything
+	const IVec3			begin				= (acceptOutOfBoundsAsAnyValue) ? (maxPositionDeviation) : (IVec3(0));
+	const IVec3			end					= (acceptOutOfBoundsAsAnyValue) ? (IVec3(width, height, depth) - maxPositionDeviation) : (IVec3(width, height, depth));
+
+	TCU_CHECK_INTERNAL(result.getWidth() == width && result.getHeight() == height && result.getDepth() == depth);
+	DE_ASSERT(end.x() > 0 && end.y() > 0 && end.z() > 0);	// most likely a bug
+
+	tcu::clear(errorMask, okColor);
+
+	if (!boolAll(lessThan(begin, end)))
+		return 0;
+
+	{
+		std::vector<int>			bandCounts;
+		PositionDeviationBandTask	task		(errorMask, reference, result, threshold, maxPositionDeviation, begin, end, bandHeight, bandCounts);
+
+		bandCounts.resize((size_t)task.getNumBands());
+		de::parallelFor(task.getNumBands(), 1, task);
+
+		for (size_t bandNdx = 0; bandNdx < bandCounts.size(); bandNdx++)
+			numFailingPixels += bandCounts[bandNdx];
 	}
 
 	return numFailingPixels;
@@ -216,6 +525,8 @@ static int findNumPositionDeviationFailingPixels (const PixelBufferAccess& error
  *//*--------------------------------------------------------------------*/
 bool fuzzyCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, float threshold, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::fuzzyCompare");
+
 	FuzzyCompareParams	params;		// Use defaults.
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	float				difference		= fuzzyCompare(params, reference, result, errorMask.getAccess());
@@ -487,6 +798,8 @@ static tcu::UVec4 computeFlushRelaxedULPDiff (const tcu::Vec4& a, const tcu::Vec
  *//*--------------------------------------------------------------------*/
 bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::floatUlpThresholdCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -573,6 +886,8 @@ bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const cha
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::floatThresholdCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -660,6 +975,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const Vec4& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::floatThresholdCompare");
+
 	const int			width				= result.getWidth();
 	const int			height				= result.getHeight();
 	const int			depth				= result.getDepth();
@@ -742,6 +1059,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::intThresholdCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -837,6 +1156,8 @@ bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* im
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::intThresholdPositionDeviationCompare");
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -916,6 +1237,8 @@ bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetNam
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationErrorThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, int maxAllowedFailingPixels, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::intThresholdPositionDeviationErrorThresholdCompare");
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -1006,6 +1329,8 @@ bool pixelThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool bilinearCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const RGBA threshold, CompareLogMode logMode)
 {
+	const InstrumentationScope scope ("tcu::bilinearCompare");
+
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	bool				isOk			= bilinearCompare(reference, result, errorMask, threshold);
 	Vec4				pixelBias		(0.0f, 0.0f, 0.0f, 0.0f);
@@ -23,10 +23,12 @@
 
 #include "tcuImageIO.hpp"
 #include "tcuResource.hpp"
+#include "tcuResourceCache.hpp"
 #include "tcuSurface.hpp"
 #include "tcuCompressedTexture.hpp"
 #include "deFilePath.hpp"
 #include "deUniquePtr.hpp"
+#include "deMemory.h"
 
 #include <string>
 #include <vector>
@@ -62,18 +64,36 @@ void loadImage (TextureLevel& dst, const tcu::Archive& archive, const char* file
 		throw InternalError("Unrecognized image file extension", fileName, __FILE__, __LINE__);
 }
 
+namespace
+{
+
+struct PngMemoryReader
+{
+	const deUint8*	data;
+	size_t			size;
+	size_t			pos;
+};
+
+} // anonymous
+
 DE_BEGIN_EXTERN_C
-static void pngReadResource (png_structp png_ptr, png_bytep data, png_size_t length)
+static void pngReadMemory (png_structp png_ptr, png_bytep data, png_size_t length)
 {
-	tcu::Resource* resource = (tcu::Resource*)png_get_io_ptr(png_ptr);
-	resource->read(data, (int)length);
+	PngMemoryReader* reader = (PngMemoryReader*)png_get_io_ptr(png_ptr);
+
+	if (reader->size - reader->pos < (size_t)length)
+		png_error(png_ptr, "Unexpected end of data");
+
+	deMemcpy(data, reader->data + reader->pos, (size_t)length);
+	reader->pos += (size_t)length;
 }
 DE_END_EXTERN_C
 
 /*--------------------------------------------------------------------*//*!
  * \brief Load PNG image from resource
  *
- * TextureLevel storage is set to match image data.
+ * TextureLevel storage is set to match image data. Decoded images are
+ * shared through the process-wide ResourceCache.
  *
  * \param dst		Destination pixel container
  * \param archive	Resource archive
@@ -81,12 +101,29 @@ DE_END_EXTERN_C
  *//*--------------------------------------------------------------------*/
 void loadPNG (TextureLevel& dst, const tcu::Archive& archive, const char* fileName)
 {
-	de::UniquePtr<Resource> resource(archive.getResource(fileName));
+	ResourceCache::getInstance().loadImage(dst, archive, fileName);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Decode PNG image from memory
+ *
+ * TextureLevel storage is set to match image data.
+ *
+ * \param dst		Destination pixel container
+ * \param data		PNG file data
+ * \param size		PNG file data size in bytes
+ * \param name		Image name for error messages
+ *//*--------------------------------------------------------------------*/
+void decodePNG (TextureLevel& dst, const deUint8* data, size_t size, const char* name)
+{
+	PngMemoryReader reader;
+	reader.data	= data;
+	reader.size	= size;
+	reader.pos	= 0;
 
 	// Verify header.
-	deUint8 header[8];
-	resource->read(header, sizeof(header));
-	TCU_CHECK(png_sig_cmp((png_bytep)&header[0], 0, DE_LENGTH_OF_ARRAY(header)) == 0);
+	TCU_CHECK(size >= 8 && png_sig_cmp((png_bytep)data, 0, 8) == 0);
+	reader.pos = 8;
 
 	png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, DE_NULL, DE_NULL, DE_NULL);
 	TCU_CHECK(png_ptr);
@@ -95,9 +132,9 @@ void loadPNG (TextureLevel& dst, const tcu::Archive& archive, const char* fileNa
 	TCU_CHECK(info_ptr);
 
 	if (setjmp(png_jmpbuf(png_ptr)))
-		throw InternalError("An error occured when loading PNG", fileName, __FILE__, __LINE__);
+		throw InternalError("An error occured when loading PNG", name, __FILE__, __LINE__);
 
-	png_set_read_fn(png_ptr, resource.get(), pngReadResource);
+	png_set_read_fn(png_ptr, &reader, pngReadMemory);
 	png_set_sig_bytes(png_ptr, 8);
 
 	png_read_info(png_ptr, info_ptr);
@@ -115,7 +152,7 @@ void loadPNG (TextureLevel& dst, const tcu::Archive& archive, const char* fileNa
 		else if (colorType == PNG_COLOR_TYPE_RGBA && bitDepth == 8)
 			textureFormat = TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8);
 		else
-			throw InternalError("Unsupported PNG depth or color type", fileName, __FILE__, __LINE__);
+			throw InternalError("Unsupported PNG depth or color type", name, __FILE__, __LINE__);
 	}
 
 	// Resize destination texture.
@@ -210,11 +247,9 @@ enum PkmImageFormat
 	ETC1_RGBA_MIPMAPS		= 3
 };
 
-static inline deUint16 readBigEndianShort (tcu::Resource* resource)
+static inline deUint16 readBigEndianShort (const deUint8* src)
 {
-	deUint16 val;
-	resource->read((deUint8*)&val, sizeof(val));
-	return (deUint16)(((val >> 8) & 0xFF) | ((val << 8) & 0xFF00));
+	return (deUint16)((src[0] << 8) | src[1]);
 }
 
 /*--------------------------------------------------------------------*//*!
@@ -227,29 +262,35 @@ static inline deUint16 readBigEndianShort (tcu::Resource* resource)
  *//*--------------------------------------------------------------------*/
 void loadPKM (CompressedTexture& dst, const tcu::Archive& archive, const char* fileName)
 {
-	de::UniquePtr<Resource> resource(archive.getResource(fileName));
+	de::UniquePtr<Resource>	resource	(archive.getResource(fileName));
+	const ResourceData		data		(*resource);
+	const deUint8* const	header		= data.getData();
+	const size_t			headerSize	= 16;
+
+	if (data.getSize() < headerSize)
+		throw InternalError("PKM file is truncated", resource->getName().c_str(), __FILE__, __LINE__);
 
 	// Check magic and version.
 	deUint8 refMagic[] = {'P', 'K', 'M', ' ', '1', '0'};
-	deUint8 magic[6];
-	resource->read(magic, DE_LENGTH_OF_ARRAY(magic));
 
-	if (memcmp(refMagic, magic, sizeof(magic)) != 0)
+	if (memcmp(refMagic, header, sizeof(refMagic)) != 0)
 		throw InternalError("Signature doesn't match PKM signature", resource->getName().c_str(), __FILE__, __LINE__);
 
-	deUint16 type = readBigEndianShort(resource.get());
+	deUint16 type = readBigEndianShort(header + 6);
 	if (type != ETC1_RGB_NO_MIPMAPS)
 		throw InternalError("Unsupported PKM type", resource->getName().c_str(), __FILE__, __LINE__);
 
-	deUint16	width			= readBigEndianShort(resource.get());
-	deUint16	height			= readBigEndianShort(resource.get());
-	deUint16	activeWidth		= readBigEndianShort(resource.get());
-	deUint16	activeHeight	= readBigEndianShort(resource.get());
+	deUint16	width			= readBigEndianShort(header + 8);
+	deUint16	height			= readBigEndianShort(header + 10);
+	deUint16	activeWidth		= readBigEndianShort(header + 12);
+	deUint16	activeHeight	= readBigEndianShort(header + 14);
 
     DE_UNREF(width && height);
 
 	dst.setStorage(COMPRESSEDTEXFORMAT_ETC1_RGB8, (int)activeWidth, (int)activeHeight);
-	resource->read((deUint8*)dst.getData(), dst.getDataSize());
+
+	TCU_CHECK(data.getSize() - headerSize >= (size_t)dst.getDataSize());
+	deMemcpy(dst.getData(), header + headerSize, dst.getDataSize());
 }
 
 } // ImageIO
@@ -39,6 +39,7 @@ namespace ImageIO
 void				loadImage				(TextureLevel& dst, const tcu::Archive& archive, const char* fileName);
 
 void				loadPNG					(TextureLevel& dst, const tcu::Archive& archive, const char* fileName);
+void				decodePNG				(TextureLevel& dst, const deUint8* data, size_t size, const char* name);
 void				savePNG					(const ConstPixelBufferAccess& src, const char* fileName);
 
 void				loadPKM					(CompressedTexture& dst, const tcu::Archive& archive, const char* fileName);
@@ -0,0 +1,545 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Timing instrumentation.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuInstrumentation.hpp"
+#include "tcuTestLog.hpp"
+#include "deMutex.hpp"
+#include "deThreadLocal.hpp"
+#include "deStringUtil.hpp"
+#include "deAtomic.h"
+#include "deThread.h"
+#include "deString.h"
+
+#include <algorithm>
+#include <map>
+
+namespace tcu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Per-track event buffer
+ *
+ * Buffer is bound to one thread at a time. Events are appended by the
+ * bound thread to a chain of chunks, newest chunk first. Collector takes
+ * the whole chain by swapping it out with an atomic compare-exchange and
+ * then waits until a possibly ongoing append has finished. Appending never
+ * locks.
+ *
+ * Binding is a single word holding a generation number, increased on
+ * every bind, and a state. Bound thread moves it between idle and active
+ * when entering and leaving its outermost scope, and collector may unbind
+ * an idle buffer, both with compare-exchange. Thread remembers generation
+ * of its binding, so it can't take back a buffer that has meanwhile been
+ * bound to another thread.
+ *//*--------------------------------------------------------------------*/
+class Instrumentation::ThreadBuffer
+{
+public:
+	explicit			ThreadBuffer	(deUint32 trackNdx);
+						~ThreadBuffer	(void);
+
+	deUint32			getTrackNdx		(void) const	{ return m_trackNdx;	}
+	deUint32&			getDepth		(void)			{ return m_depth;		}
+
+	//! Bind to calling thread in active state and return generation of binding.
+	deUint32			bind			(void);
+	bool				isActive		(deUint32 generation) const	{ return m_binding == makeBinding(generation, STATE_ACTIVE);	}
+	//! Enter outermost scope. Fails if buffer is no longer bound with given generation.
+	bool				activate		(deUint32 generation);
+	//! Leave outermost scope.
+	void				deactivate		(void);
+	//! Unbind if bound thread is not inside any scope.
+	bool				unbind			(void);
+
+	void				append			(const InstrumentationEvent& event);
+	void				collect			(std::vector<InstrumentationEvent>& dst);
+
+private:
+	enum
+	{
+		CHUNK_SIZE			= 256
+	};
+
+	enum
+	{
+		STATE_FREE			= 0,
+		STATE_IDLE			= 1,
+		STATE_ACTIVE		= 2,
+		STATE_MASK			= 3,
+
+		GENERATION_SHIFT	= 2
+	};
+
+	struct Chunk
+	{
+		InstrumentationEvent	events[CHUNK_SIZE];
+		int						numEvents;
+		Chunk*					older;
+	};
+
+						ThreadBuffer	(const ThreadBuffer&);	// not allowed!
+	ThreadBuffer&		operator=		(const ThreadBuffer&);	// not allowed!
+
+	static void			deleteChain		(Chunk* chunk);
+	static deUint32		makeBinding		(deUint32 generation, deUint32 state) { return (generation << GENERATION_SHIFT) | state; }
+
+	const deUint32		m_trackNdx;
+	deUint32			m_depth;			//!< Only accessed by bound thread.
+	volatile deUint32	m_binding;
+
+	void* volatile		m_chunks;			//!< Newest chunk, or null.
+	volatile deUint32	m_isAppending;
+};
+
+Instrumentation::ThreadBuffer::ThreadBuffer (deUint32 trackNdx)
+	: m_trackNdx	(trackNdx)
+	, m_depth		(0)
+	, m_binding		(makeBinding(0, STATE_FREE))
+	, m_chunks		(DE_NULL)
+	, m_isAppending	(0)
+{
+}
+
+Instrumentation::ThreadBuffer::~ThreadBuffer (void)
+{
+	deleteChain((Chunk*)m_chunks);
+}
+
+void Instrumentation::ThreadBuffer::deleteChain (Chunk* chunk)
+{
+	while (chunk)
+	{
+		Chunk* const older = chunk->older;
+		delete chunk;
+		chunk = older;
+	}
+}
+
+deUint32 Instrumentation::ThreadBuffer::bind (void)
+{
+	const deUint32 generation = (m_binding >> GENERATION_SHIFT) + 1;
+
+	DE_ASSERT((m_binding & STATE_MASK) == STATE_FREE);
+
+	m_depth		= 0;
+	m_binding	= makeBinding(generation, STATE_ACTIVE);
+	deMemoryReadWriteFence();
+
+	return generation & (~0u >> GENERATION_SHIFT);
+}
+
+bool Instrumentation::ThreadBuffer::activate (deUint32 generation)
+{
+	return deAtomicCompareExchangeUint32(&m_binding, makeBinding(generation, STATE_IDLE), makeBinding(generation, STATE_ACTIVE)) == makeBinding(generation, STATE_IDLE);
+}
+
+void Instrumentation::ThreadBuffer::deactivate (void)
+{
+	// Collector only unbinds idle buffers, so there is no race while active.
+	DE_ASSERT((m_binding & STATE_MASK) == STATE_ACTIVE);
+	deMemoryReadWriteFence();
+	m_binding = (m_binding & ~(deUint32)STATE_MASK) | STATE_IDLE;
+	deMemoryReadWriteFence();
+}
+
+bool Instrumentation::ThreadBuffer::unbind (void)
+{
+	const deUint32 binding = m_binding;
+
+	if ((binding & STATE_MASK) != STATE_IDLE)
+		return false;
+
+	return deAtomicCompareExchangeUint32(&m_binding, binding, (binding & ~(deUint32)STATE_MASK) | STATE_FREE) == binding;
+}
+
+void Instrumentation::ThreadBuffer::append (const InstrumentationEvent& event)
+{
+	m_isAppending = 1;
+	deMemoryReadWriteFence();
+
+	{
+		Chunk* chunk = (Chunk*)m_chunks;
+
+		if (!chunk || chunk->numEvents == CHUNK_SIZE)
+		{
+			Chunk* const newChunk = new Chunk();
+
+			newChunk->numEvents	= 0;
+			newChunk->older		= chunk;
+
+			// Collector may have taken the chain, in which case new chunk starts a new one.
+			if (deAtomicCompareExchangePtr(&m_chunks, chunk, newChunk) != chunk)
+			{
+				DE_ASSERT(m_chunks == DE_NULL);
+				newChunk->older	= DE_NULL;
+				m_chunks		= newChunk;
+			}
+
+			chunk = newChunk;
+		}
+
+		chunk->events[chunk->numEvents] = event;
+		chunk->numEvents += 1;
+	}
+
+	deMemoryReadWriteFence();
+	m_isAppending = 0;
+}
+
+void Instrumentation::ThreadBuffer::collect (std::vector<InstrumentationEvent>& dst)
+{
+	Chunk* chain;
+
+	for (;;)
+	{
+		chain = (Chunk*)m_chunks;
+
+		if (!chain || deAtomicCompareExchangePtr(&m_chunks, chain, DE_NULL) == chain)
+			break;
+	}
+
+	if (!chain)
+		return;
+
+	// Owning thread may still be writing to the newest chunk.
+	deMemoryReadWriteFence();
+	while (m_isAppending)
+		deYield();
+	deMemoryReadWriteFence();
+
+	{
+		std::vector<Chunk*> chunks;
+
+		for (Chunk* chunk = chain; chunk; chunk = chunk->older)
+			chunks.push_back(chunk);
+
+		for (size_t ndx = chunks.size(); ndx-- > 0;)
+			dst.insert(dst.end(), chunks[ndx]->events, chunks[ndx]->events + chunks[ndx]->numEvents);
+	}
+
+	deleteChain(chain);
+}
+
+namespace
+{
+
+class ThreadBufferRegistry
+{
+public:
+	ThreadBufferRegistry (void)
+	{
+	}
+
+	~ThreadBufferRegistry (void)
+	{
+		for (size_t ndx = 0; ndx < m_buffers.size(); ndx++)
+			delete m_buffers[ndx];
+	}
+
+	//! Get buffer bound to calling thread and enter scope. Locks only if thread has no bound buffer.
+	Instrumentation::ThreadBuffer* enterScope (void)
+	{
+		Instrumentation::ThreadBuffer*	buffer		= (Instrumentation::ThreadBuffer*)m_current.get();
+		const deUint32					generation	= (deUint32)(deUintptr)m_generation.get();
+
+		if (buffer && buffer->isActive(generation))
+			buffer->getDepth() += 1;
+		else if (buffer && buffer->activate(generation))
+			buffer->getDepth() = 1;
+		else
+		{
+			buffer = bindBuffer();
+			buffer->getDepth() = 1;
+		}
+
+		return buffer;
+	}
+
+	deUint32 getThreadContext (void) const
+	{
+		return (deUint32)(deUintptr)m_threadContext.get();
+	}
+
+	void setThreadContext (deUint32 contextId)
+	{
+		m_threadContext.set((void*)(deUintptr)contextId);
+	}
+
+	//! Collect events from all buffers and unbind buffers of threads that are not inside any scope.
+	void collect (std::vector<InstrumentationEvent>& dst)
+	{
+		const de::ScopedLock lock (m_lock);
+
+		for (size_t ndx = 0; ndx < m_buffers.size(); ndx++)
+		{
+			m_buffers[ndx]->collect(dst);
+
+			if (m_buffers[ndx]->unbind())
+				m_freeBuffers.push_back(m_buffers[ndx]);
+		}
+	}
+
+private:
+	Instrumentation::ThreadBuffer* bindBuffer (void)
+	{
+		const de::ScopedLock			lock	(m_lock);
+		Instrumentation::ThreadBuffer*	buffer;
+
+		if (!m_freeBuffers.empty())
+		{
+			buffer = m_freeBuffers.back();
+			m_freeBuffers.pop_back();
+		}
+		else
+		{
+			buffer = new Instrumentation::ThreadBuffer((deUint32)m_buffers.size());
+			m_buffers.push_back(buffer);
+		}
+
+		m_generation.set((void*)(deUintptr)buffer->bind());
+		m_current.set(buffer);
+
+		return buffer;
+	}
+
+	de::Mutex										m_lock;				//!< Taken by collector, and by threads binding a buffer.
+	de::ThreadLocal									m_current;			//!< Buffer last bound to calling thread.
+	de::ThreadLocal									m_generation;		//!< Generation of that binding.
+	de::ThreadLocal									m_threadContext;
+	std::vector<Instrumentation::ThreadBuffer*>		m_buffers;
+	std::vector<Instrumentation::ThreadBuffer*>		m_freeBuffers;		//!< Buffers not bound to any thread.
+};
+
+ThreadBufferRegistry s_registry;
+
+bool compareEventBegin (const InstrumentationEvent& a, const InstrumentationEvent& b)
+{
+	if (a.beginNs != b.beginNs)
+		return a.beginNs < b.beginNs;
+	else
+		return a.depth < b.depth;
+}
+
+struct ScopeStats
+{
+	deInt64	numCalls;
+	deInt64	totalNs;
+	deInt64	maxNs;
+
+	ScopeStats (void) : numCalls(0), totalNs(0), maxNs(0) {}
+};
+
+std::string escapeJsonString (const char* str)
+{
+	std::string escaped;
+
+	for (const char* ptr = str; *ptr; ptr++)
+	{
+		const char c = *ptr;
+
+		if (c == '"' || c == '\\')
+		{
+			escaped += '\\';
+			escaped += c;
+		}
+		else if ((unsigned char)c < 0x20)
+		{
+			char buf[8];
+			deSprintf(buf, sizeof(buf), "\\u%04x", (int)c);
+			escaped += buf;
+		}
+		else
+			escaped += c;
+	}
+
+	return escaped;
+}
+
+} // anonymous
+
+volatile deInt32	Instrumentation::s_isEnabled		= 0;
+volatile deUint32	Instrumentation::s_activeContext	= 0;
+
+void Instrumentation::setEnabled (bool enabled)
+{
+	s_isEnabled = enabled ? 1 : 0;
+	deMemoryReadWriteFence();
+}
+
+void Instrumentation::setActiveContext (deUint32 contextId)
+{
+	s_activeContext = contextId;
+	deMemoryReadWriteFence();
+}
+
+deUint32 Instrumentation::getCurrentContext (void)
+{
+	const deUint32 threadContext = s_registry.getThreadContext();
+
+	return threadContext != 0 ? threadContext : s_activeContext;
+}
+
+deUint32 Instrumentation::setThreadContext (deUint32 contextId)
+{
+	const deUint32 prevContext = s_registry.getThreadContext();
+
+	s_registry.setThreadContext(contextId);
+
+	return prevContext;
+}
+
+Instrumentation::ThreadBuffer* Instrumentation::beginScope (void)
+{
+	return s_registry.enterScope();
+}
+
+void Instrumentation::endScope (ThreadBuffer* buffer, const char* name, deUint32 contextId, deUint64 beginNs, deUint64 endNs)
+{
+	InstrumentationEvent event;
+
+	DE_ASSERT(buffer->getDepth() > 0);
+	buffer->getDepth() -= 1;
+
+	event.name		= name;
+	event.beginNs	= beginNs;
+	event.endNs		= endNs;
+	event.trackNdx	= buffer->getTrackNdx();
+	event.depth		= buffer->getDepth();
+	event.contextId	= contextId;
+
+	buffer->append(event);
+
+	if (buffer->getDepth() == 0)
+		buffer->deactivate();
+}
+
+void Instrumentation::collectEvents (std::vector<InstrumentationEvent>& dst)
+{
+	const size_t firstNew = dst.size();
+
+	s_registry.collect(dst);
+
+	std::stable_sort(dst.begin() + firstNew, dst.end(), compareEventBegin);
+}
+
+void logInstrumentationEvents (TestLog& log, const std::vector<InstrumentationEvent>& events)
+{
+	std::map<std::string, ScopeStats> stats;
+
+	if (events.empty())
+		return;
+
+	for (size_t ndx = 0; ndx < events.size(); ndx++)
+	{
+		const InstrumentationEvent&	event		= events[ndx];
+		const deInt64				durationNs	= (deInt64)(event.endNs - event.beginNs);
+		ScopeStats&					scope		= stats[event.name];
+
+		scope.numCalls	+= 1;
+		scope.totalNs	+= durationNs;
+		scope.maxNs		 = de::max(scope.maxNs, durationNs);
+	}
+
+	log << TestLog::Section("Instrumentation", "Time spent in instrumented scopes");
+
+	for (std::map<std::string, ScopeStats>::const_iterator iter = stats.begin(); iter != stats.end(); ++iter)
+	{
+		log << TestLog::Section(iter->first, iter->first)
+			<< TestLog::Integer("NumCalls",		"Number of calls",		"",		QP_KEY_TAG_NONE,	iter->second.numCalls)
+			<< TestLog::Integer("TotalTime",	"Total time",			"ns",	QP_KEY_TAG_TIME,	iter->second.totalNs)
+			<< TestLog::Integer("MaxTime",		"Longest call",			"ns",	QP_KEY_TAG_TIME,	iter->second.maxNs)
+			<< TestLog::EndSection;
+	}
+
+	log << TestLog::EndSection;
+}
+
+InstrumentationTraceWriter::InstrumentationTraceWriter (const char* filename)
+	: m_file			(fopen(filename, "wb"))
+	, m_baseNs			(0)
+	, m_isFirstEvent	(true)
+	, m_numTracks		(0)
+{
+	if (!m_file)
+		throw ResourceError(std::string("Failed to open instrumentation trace file ") + filename);
+
+	fprintf(m_file, "{\"traceEvents\":[\n");
+	writeThreadName(0, "Test cases");
+}
+
+InstrumentationTraceWriter::~InstrumentationTraceWriter (void)
+{
+	fprintf(m_file, "\n]}\n");
+	fclose(m_file);
+}
+
+void InstrumentationTraceWriter::writeThreadName (deUint32 tid, const char* name)
+{
+	fprintf(m_file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+			m_isFirstEvent ? "" : ",\n", tid, escapeJsonString(name).c_str());
+	m_isFirstEvent = false;
+}
+
+void InstrumentationTraceWriter::writeEvent (const char* name, const char* category, deUint32 contextId, deUint64 beginNs, deUint64 endNs, deUint32 tid)
+{
+	const double	beginUs		= (double)(deInt64)(beginNs - m_baseNs) / 1000.0;
+	const double	durationUs	= (double)(endNs - beginNs) / 1000.0;
+
+	fprintf(m_file, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"case\":%u}}",
+			m_isFirstEvent ? "" : ",\n", escapeJsonString(name).c_str(), category, tid, beginUs, durationUs, contextId);
+	m_isFirstEvent = false;
+}
+
+void InstrumentationTraceWriter::writeCase (const std::string& casePath, deUint32 contextId, deUint64 beginNs, deUint64 endNs)
+{
+	if (m_baseNs == 0)
+		m_baseNs = beginNs;
+
+	writeEvent(casePath.c_str(), "case", contextId, beginNs, endNs, 0);
+	fflush(m_file);
+}
+
+void InstrumentationTraceWriter::writeEvents (const std::vector<InstrumentationEvent>& events)
+{
+	if (m_baseNs == 0 && !events.empty())
+		m_baseNs = events.front().beginNs;
+
+	for (size_t ndx = 0; ndx < events.size(); ndx++)
+	{
+		const InstrumentationEvent&	event	= events[ndx];
+		const deUint32				tid		= event.trackNdx + 1;
+
+		// Recording tracks are 1.., track 0 is for test cases
+		while (m_numTracks < tid)
+		{
+			m_numTracks += 1;
+			writeThreadName(m_numTracks, (std::string("Track ") + de::toString(m_numTracks - 1)).c_str());
+		}
+
+		writeEvent(event.name, "scope", event.contextId, event.beginNs, event.endNs, tid);
+	}
+
+	fflush(m_file);
+}
+
+} // tcu
@@ -0,0 +1,196 @@
+#ifndef _TCUINSTRUMENTATION_HPP
+#define _TCUINSTRUMENTATION_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Timing instrumentation.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "deClock.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+
+class TestLog;
+
+//! Time span recorded by InstrumentationScope.
+struct InstrumentationEvent
+{
+	const char*		name;			//!< Scope name, must have static storage duration.
+	deUint64		beginNs;		//!< Begin time as returned by deGetNanoseconds().
+	deUint64		endNs;			//!< End time as returned by deGetNanoseconds().
+	deUint32		trackNdx;		//!< Recording track, see Instrumentation.
+	deUint32		depth;			//!< Number of enclosing scopes on recording thread.
+	deUint32		contextId;		//!< Context, such as test case, that issued the work, or 0 if none.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Instrumentation event recording
+ *
+ * Events are recorded to per-track buffers without any locking. A thread
+ * binds a track on its first scope and keeps it, so concurrently
+ * recording threads use different tracks. collectEvents() moves recorded
+ * events from all tracks to the caller, and may be called while other
+ * threads are recording. It also unbinds tracks of threads that are not
+ * inside any scope, including threads that have exited, so the number of
+ * tracks is bounded by the number of threads recording between
+ * collections, not by the number of threads ever started.
+ *
+ * Each event is tagged with the calling thread's context when the scope
+ * was entered. By default that is the active context, i.e. the running
+ * test case. Threads that do work on behalf of another context, such as
+ * background workers serving requests queued by an earlier case, set it
+ * with InstrumentationContextScope.
+ *
+ * Recording is disabled by default, in which case InstrumentationScope
+ * costs only a check of a global flag.
+ *//*--------------------------------------------------------------------*/
+class Instrumentation
+{
+public:
+	class ThreadBuffer;
+
+	static bool				isEnabled		(void) { return s_isEnabled != 0; }
+	static void				setEnabled		(bool enabled);
+
+	//! Append events recorded since last call to dst, ordered by begin time.
+	static void				collectEvents	(std::vector<InstrumentationEvent>& dst);
+
+	//! Set context of threads that have no context of their own. 0 for none.
+	static void				setActiveContext	(deUint32 contextId);
+	//! Get calling thread's context, or active context if thread has none.
+	static deUint32			getCurrentContext	(void);
+	//! Set calling thread's own context and return previous one. 0 to follow active context.
+	static deUint32			setThreadContext	(deUint32 contextId);
+
+	//! Get calling thread's track buffer and increase its scope depth.
+	static ThreadBuffer*	beginScope		(void);
+	//! Record event and decrease scope depth.
+	static void				endScope		(ThreadBuffer* buffer, const char* name, deUint32 contextId, deUint64 beginNs, deUint64 endNs);
+
+private:
+	static volatile deInt32		s_isEnabled;
+	static volatile deUint32	s_activeContext;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Named timing scope
+ *
+ * Records time between construction and destruction when
+ * instrumentation is enabled. Name must be a string literal or
+ * otherwise outlive the recorded events.
+ *
+ * const tcu::InstrumentationScope scope ("glu::Shader::compile");
+ *//*--------------------------------------------------------------------*/
+class InstrumentationScope
+{
+public:
+	explicit InstrumentationScope (const char* name)
+		: m_name		(name)
+		, m_buffer		(Instrumentation::isEnabled() ? Instrumentation::beginScope() : DE_NULL)
+		, m_contextId	(m_buffer ? Instrumentation::getCurrentContext() : 0u)
+		, m_beginNs		(m_buffer ? deGetNanoseconds() : 0)
+	{
+	}
+
+	~InstrumentationScope (void)
+	{
+		if (m_buffer)
+			Instrumentation::endScope(m_buffer, m_name, m_contextId, m_beginNs, deGetNanoseconds());
+	}
+
+private:
+									InstrumentationScope	(const InstrumentationScope&);	// not allowed!
+	InstrumentationScope&			operator=				(const InstrumentationScope&);	// not allowed!
+
+	const char* const				m_name;
+	Instrumentation::ThreadBuffer*	m_buffer;
+	const deUint32					m_contextId;
+	const deUint64					m_beginNs;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Calling thread's instrumentation context
+ *
+ * Tags events recorded by the calling thread with given context until
+ * destroyed, for example with the test case that queued the work.
+ *//*--------------------------------------------------------------------*/
+class InstrumentationContextScope
+{
+public:
+	explicit InstrumentationContextScope (deUint32 contextId)
+		: m_prevContextId (Instrumentation::setThreadContext(contextId))
+	{
+	}
+
+	~InstrumentationContextScope (void)
+	{
+		Instrumentation::setThreadContext(m_prevContextId);
+	}
+
+private:
+									InstrumentationContextScope	(const InstrumentationContextScope&);	// not allowed!
+	InstrumentationContextScope&	operator=					(const InstrumentationContextScope&);	// not allowed!
+
+	const deUint32					m_prevContextId;
+};
+
+//! Write per-scope call counts and total times as a section in test log.
+void	logInstrumentationEvents		(TestLog& log, const std::vector<InstrumentationEvent>& events);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Chrome trace event file writer
+ *
+ * Writes events in the trace event JSON format understood by
+ * chrome://tracing and compatible viewers. Test cases are written as
+ * events on a separate track above the recording tracks. All events
+ * carry the id of their context, i.e. test case, as an argument, as
+ * work issued by one case may complete while another one runs.
+ *//*--------------------------------------------------------------------*/
+class InstrumentationTraceWriter
+{
+public:
+	explicit				InstrumentationTraceWriter	(const char* filename);
+							~InstrumentationTraceWriter	(void);
+
+	void					writeCase					(const std::string& casePath, deUint32 contextId, deUint64 beginNs, deUint64 endNs);
+	void					writeEvents					(const std::vector<InstrumentationEvent>& events);
+
+private:
+							InstrumentationTraceWriter	(const InstrumentationTraceWriter&);	// not allowed!
+	InstrumentationTraceWriter&	operator=				(const InstrumentationTraceWriter&);	// not allowed!
+
+	void					writeThreadName				(deUint32 tid, const char* name);
+	void					writeEvent					(const char* name, const char* category, deUint32 contextId, deUint64 beginNs, deUint64 endNs, deUint32 tid);
+
+	FILE*					m_file;
+	deUint64				m_baseNs;			//!< Trace timestamps are relative to the first written event.
+	bool					m_isFirstEvent;
+	deUint32				m_numTracks;		//!< Number of recording tracks named so far.
+};
+
+} // tcu
+
+#endif // _TCUINSTRUMENTATION_HPP
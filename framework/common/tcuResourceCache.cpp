@@ -0,0 +1,453 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process-wide resource cache.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuResourceCache.hpp"
+#include "tcuResource.hpp"
+#include "tcuTexture.hpp"
+#include "tcuImageIO.hpp"
+#include "deThread.hpp"
+#include "deUniquePtr.hpp"
+#include "deMemory.h"
+
+#if (DE_OS == DE_OS_UNIX || DE_OS == DE_OS_OSX || DE_OS == DE_OS_ANDROID || DE_OS == DE_OS_QNX)
+#	define TCU_USE_MMAP
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+namespace tcu
+{
+
+using std::string;
+using std::vector;
+
+// ResourceData
+
+#if defined(TCU_USE_MMAP)
+
+static void* mapFile (const char* filename, size_t* size)
+{
+	const int	fd		= open(filename, O_RDONLY);
+	void*		ptr		= DE_NULL;
+	struct stat	info;
+
+	if (fd < 0)
+		return DE_NULL;
+
+	if (fstat(fd, &info) == 0 && info.st_size > 0)
+	{
+		ptr = mmap(DE_NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (ptr == MAP_FAILED)
+			ptr = DE_NULL;
+		else
+			*size = (size_t)info.st_size;
+	}
+
+	close(fd);
+	return ptr;
+}
+
+#endif // TCU_USE_MMAP
+
+ResourceData::ResourceData (Resource& resource)
+	: m_data	(DE_NULL)
+	, m_size	(0)
+	, m_mapping	(DE_NULL)
+{
+#if defined(TCU_USE_MMAP)
+	// \note FileResource name is the file path.
+	if (dynamic_cast<FileResource*>(&resource))
+		m_mapping = mapFile(resource.getName().c_str(), &m_size);
+#endif
+
+	if (m_mapping)
+		m_data = (const deUint8*)m_mapping;
+	else
+	{
+		m_buffer.resize((size_t)resource.getSize());
+		resource.setPosition(0);
+
+		if (!m_buffer.empty())
+		{
+			resource.read(&m_buffer[0], (int)m_buffer.size());
+			m_data = &m_buffer[0];
+		}
+
+		m_size = m_buffer.size();
+	}
+}
+
+ResourceData::~ResourceData (void)
+{
+#if defined(TCU_USE_MMAP)
+	if (m_mapping)
+		munmap(m_mapping, m_size);
+#endif
+}
+
+// ImagePrefetchThread
+
+class ImagePrefetchThread : public de::Thread
+{
+public:
+						ImagePrefetchThread		(ResourceCache& cache) : m_cache(cache) {}
+
+	void				run						(void) { m_cache.processPrefetchJobs(); }
+
+private:
+	ResourceCache&		m_cache;
+};
+
+// ResourceCache
+
+static size_t getImageDataSize (const TextureLevel& image)
+{
+	return (size_t)image.getWidth()*(size_t)image.getHeight()*(size_t)image.getDepth()*(size_t)image.getFormat().getPixelSize();
+}
+
+static void decodeImage (TextureLevel& dst, Resource& resource)
+{
+	const ResourceData data(resource);
+	ImageIO::decodePNG(dst, data.getData(), data.getSize(), resource.getName().c_str());
+}
+
+static void copyImage (TextureLevel& dst, const TextureLevel& src)
+{
+	dst.setStorage(src.getFormat(), src.getWidth(), src.getHeight(), src.getDepth());
+	deMemcpy(dst.getAccess().getDataPtr(), src.getAccess().getDataPtr(), getImageDataSize(src));
+}
+
+ResourceCache& ResourceCache::getInstance (void)
+{
+	static ResourceCache s_instance;
+	return s_instance;
+}
+
+ResourceCache::ResourceCache (void)
+	: m_maxCacheSize	(DEFAULT_MAX_IMAGE_CACHE_SIZE)
+	, m_cacheSize		(0)
+	, m_jobSem			(0)
+	, m_stopPrefetch	(false)
+	, m_prefetchThread	(DE_NULL)
+{
+}
+
+ResourceCache::~ResourceCache (void)
+{
+	clear();
+}
+
+void ResourceCache::setMaxImageCacheSize (size_t maxSize)
+{
+	if (maxSize == 0)
+		stopPrefetchThread();
+
+	de::ScopedLock lock(m_lock);
+	m_maxCacheSize = maxSize;
+	evictImages();
+}
+
+size_t ResourceCache::getMaxImageCacheSize (void) const
+{
+	de::ScopedLock lock(m_lock);
+	return m_maxCacheSize;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Load PNG image through cache
+ *
+ * If the image is cached, cached pixels are copied to dst. If a prefetch
+ * of the image is in flight, waits for it to finish. Otherwise image is
+ * decoded on the calling thread and added to the cache.
+ *
+ * \param dst		Destination pixel container
+ * \param archive	Resource archive
+ * \param fileName	Resource file name
+ *//*--------------------------------------------------------------------*/
+void ResourceCache::loadImage (TextureLevel& dst, const Archive& archive, const char* fileName)
+{
+	de::UniquePtr<Resource>	resource	(archive.getResource(fileName));
+	const string			name		= resource->getName();
+	ImageSp					image;
+	PendingImageSp			pending;
+
+	{
+		de::ScopedLock lock(m_lock);
+
+		if (m_maxCacheSize == 0)
+		{
+			// Caching disabled.
+		}
+		else if (m_imageMap.find(name) != m_imageMap.end())
+		{
+			const ImageList::iterator entry = m_imageMap[name];
+
+			m_images.splice(m_images.begin(), m_images, entry);
+			image = entry->image;
+			m_statistics.numHits += 1;
+		}
+		else if (m_pending.find(name) != m_pending.end())
+			pending = m_pending[name];
+	}
+
+	if (pending)
+	{
+		// Pass signal on to other waiters.
+		pending->done.decrement();
+		pending->done.increment();
+
+		image = pending->image;
+
+		if (image)
+		{
+			de::ScopedLock lock(m_lock);
+			m_statistics.numHits += 1;
+		}
+	}
+
+	if (image)
+	{
+		copyImage(dst, *image);
+		return;
+	}
+
+	// Not cached or prefetch failed; decoding here also reports errors to caller.
+	decodeImage(dst, *resource);
+
+	{
+		size_t maxCacheSize;
+
+		{
+			de::ScopedLock lock(m_lock);
+			m_statistics.numMisses += 1;
+			maxCacheSize = m_maxCacheSize;
+		}
+
+		if (maxCacheSize == 0 || getImageDataSize(dst) > maxCacheSize)
+			return;
+	}
+
+	{
+		const ImageSp cached (new TextureLevel());
+
+		copyImage(*cached, dst);
+
+		{
+			de::ScopedLock lock(m_lock);
+			insertImage(name, cached);
+		}
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Start decoding PNG images on background thread
+ *
+ * Resources are opened on the calling thread. Missing resources are
+ * ignored here and reported when the image is actually loaded.
+ *
+ * \param archive	Resource archive
+ * \param fileNames	Resource file names
+ *//*--------------------------------------------------------------------*/
+void ResourceCache::prefetchImages (const Archive& archive, const vector<string>& fileNames)
+{
+	if (getMaxImageCacheSize() == 0)
+		return;
+
+	for (vector<string>::const_iterator fileName = fileNames.begin(); fileName != fileNames.end(); ++fileName)
+	{
+		de::MovePtr<Resource> resource;
+
+		try
+		{
+			resource = de::MovePtr<Resource>(archive.getResource(fileName->c_str()));
+		}
+		catch (const ResourceError&)
+		{
+			continue;
+		}
+
+		{
+			de::ScopedLock	lock	(m_lock);
+			const string&	name	= resource->getName();
+
+			if (m_imageMap.find(name) != m_imageMap.end() || m_pending.find(name) != m_pending.end())
+				continue;
+
+			if (!m_prefetchThread)
+			{
+				m_prefetchThread = new ImagePrefetchThread(*this);
+				m_prefetchThread->start();
+			}
+
+			PrefetchJob job;
+			job.pending		= PendingImageSp(new PendingImage());
+			job.resource	= resource.get();
+
+			m_pending[name] = job.pending;
+			m_jobs.push_back(job);
+			resource.release();
+		}
+
+		m_jobSem.increment();
+	}
+}
+
+void ResourceCache::clear (void)
+{
+	stopPrefetchThread();
+
+	de::ScopedLock lock(m_lock);
+	m_images.clear();
+	m_imageMap.clear();
+	m_cacheSize		= 0;
+	m_statistics	= ImageCacheStatistics();
+}
+
+ImageCacheStatistics ResourceCache::getImageCacheStatistics (void) const
+{
+	de::ScopedLock lock(m_lock);
+	return m_statistics;
+}
+
+void ResourceCache::processPrefetchJobs (void)
+{
+	for (;;)
+	{
+		PrefetchJob	job;
+		string		name;
+		ImageSp		image;
+
+		m_jobSem.decrement();
+
+		{
+			de::ScopedLock lock(m_lock);
+
+			if (m_jobs.empty())
+			{
+				if (m_stopPrefetch)
+					break;
+				else
+					continue;
+			}
+
+			job = m_jobs.front();
+			m_jobs.pop_front();
+		}
+
+		name = job.resource->getName();
+
+		try
+		{
+			image = ImageSp(new TextureLevel());
+			decodeImage(*image, *job.resource);
+		}
+		catch (const std::exception&)
+		{
+			image.clear();
+		}
+
+		delete job.resource;
+
+		{
+			de::ScopedLock lock(m_lock);
+
+			m_pending.erase(name);
+
+			if (image)
+				m_statistics.numPrefetches += 1;
+
+			if (image && getImageDataSize(*image) <= m_maxCacheSize)
+				insertImage(name, image);
+		}
+
+		job.pending->image = image;
+		job.pending->done.increment();
+	}
+}
+
+void ResourceCache::stopPrefetchThread (void)
+{
+	{
+		de::ScopedLock lock(m_lock);
+
+		if (!m_prefetchThread)
+			return;
+
+		// Cancel queued jobs; waiters will decode images themselves.
+		for (std::deque<PrefetchJob>::iterator job = m_jobs.begin(); job != m_jobs.end(); ++job)
+		{
+			m_pending.erase(job->resource->getName());
+			delete job->resource;
+			job->pending->done.increment();
+		}
+
+		m_jobs.clear();
+		m_stopPrefetch = true;
+	}
+
+	m_jobSem.increment();
+	m_prefetchThread->join();
+
+	{
+		de::ScopedLock lock(m_lock);
+
+		delete m_prefetchThread;
+		m_prefetchThread	= DE_NULL;
+		m_stopPrefetch		= false;
+	}
+}
+
+void ResourceCache::insertImage (const string& name, const ImageSp& image)
+{
+	if (m_imageMap.find(name) != m_imageMap.end())
+		return; // Decoded concurrently by another thread.
+
+	CachedImage entry;
+	entry.name	= name;
+	entry.image	= image;
+	entry.size	= getImageDataSize(*image);
+
+	m_images.push_front(entry);
+	m_imageMap[name]	 = m_images.begin();
+	m_cacheSize			+= entry.size;
+
+	evictImages();
+}
+
+void ResourceCache::evictImages (void)
+{
+	while (m_cacheSize > m_maxCacheSize)
+	{
+		DE_ASSERT(!m_images.empty());
+
+		m_cacheSize -= m_images.back().size;
+		m_imageMap.erase(m_images.back().name);
+		m_images.pop_back();
+		m_statistics.numEvictions += 1;
+	}
+}
+
+} // tcu
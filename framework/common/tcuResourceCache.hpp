@@ -0,0 +1,173 @@
+#ifndef _TCURESOURCECACHE_HPP
+#define _TCURESOURCECACHE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process-wide resource cache.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "deMutex.hpp"
+#include "deSemaphore.hpp"
+#include "deSharedPtr.hpp"
+
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <deque>
+
+namespace tcu
+{
+
+class Archive;
+class Resource;
+class TextureLevel;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read-only view to complete resource contents
+ *
+ * Files in directory archives are mapped into memory where supported.
+ * Other resources are read into a buffer.
+ *//*--------------------------------------------------------------------*/
+class ResourceData
+{
+public:
+								ResourceData		(Resource& resource);
+								~ResourceData		(void);
+
+	const deUint8*				getData				(void) const	{ return m_data;	}
+	size_t						getSize				(void) const	{ return m_size;	}
+
+private:
+								ResourceData		(const ResourceData& other);
+	ResourceData&				operator=			(const ResourceData& other);
+
+	const deUint8*				m_data;
+	size_t						m_size;
+	void*						m_mapping;
+	std::vector<deUint8>		m_buffer;
+};
+
+class ImagePrefetchThread;
+
+struct ImageCacheStatistics
+{
+	int		numHits;		//!< Loads served from cache or by finished prefetch.
+	int		numMisses;		//!< Loads decoded on calling thread.
+	int		numPrefetches;	//!< Images decoded on prefetch thread.
+	int		numEvictions;	//!< Images dropped to stay within maximum cache size.
+
+	ImageCacheStatistics (void) : numHits(0), numMisses(0), numPrefetches(0), numEvictions(0) {}
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Cache for decoded resource images
+ *
+ * Decoded images are kept in a LRU cache keyed by the full resource
+ * name, so that images shared by multiple cases and packages are
+ * decoded only once per process. Images can be prefetched, in which case
+ * they are decoded on a background thread and loadImage() waits for
+ * the pending decode instead of starting a new one.
+ *
+ * Cache is process-wide and can be accessed from any thread.
+ *//*--------------------------------------------------------------------*/
+class ResourceCache
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_IMAGE_CACHE_SIZE	= 64*1024*1024	//!< Default image cache size in bytes.
+	};
+
+	static ResourceCache&		getInstance			(void);
+
+	//! Set maximum size of decoded image data in bytes. 0 disables caching and prefetching.
+	void						setMaxImageCacheSize(size_t maxSize);
+	size_t						getMaxImageCacheSize(void) const;
+
+	void						loadImage			(TextureLevel& dst, const Archive& archive, const char* fileName);
+	void						prefetchImages		(const Archive& archive, const std::vector<std::string>& fileNames);
+
+	//! Get statistics accumulated since construction or last clear().
+	ImageCacheStatistics		getImageCacheStatistics	(void) const;
+
+	//! Cancel pending prefetches, drop all cached images and reset statistics.
+	void						clear				(void);
+
+								ResourceCache		(void);
+								~ResourceCache		(void);
+
+private:
+								ResourceCache		(const ResourceCache& other);
+	ResourceCache&				operator=			(const ResourceCache& other);
+
+	typedef de::SharedPtr<TextureLevel> ImageSp;
+
+	struct CachedImage
+	{
+		std::string				name;
+		ImageSp					image;
+		size_t					size;
+	};
+
+	struct PendingImage
+	{
+		de::Semaphore			done;
+		ImageSp					image;				//!< Null if decoding failed.
+
+								PendingImage		(void) : done(0) {}
+	};
+
+	typedef de::SharedPtr<PendingImage>					PendingImageSp;
+	typedef std::list<CachedImage>						ImageList;
+	typedef std::map<std::string, ImageList::iterator>	ImageMap;
+	typedef std::map<std::string, PendingImageSp>		PendingMap;
+
+	struct PrefetchJob
+	{
+		Resource*				resource;
+		PendingImageSp			pending;
+	};
+
+	friend class ImagePrefetchThread;
+
+	void						processPrefetchJobs	(void);
+	void						stopPrefetchThread	(void);
+	void						insertImage			(const std::string& name, const ImageSp& image);
+	void						evictImages			(void);
+
+	mutable de::Mutex			m_lock;
+	size_t						m_maxCacheSize;
+	size_t						m_cacheSize;
+	ImageList					m_images;			//!< Most recently used first.
+	ImageMap					m_imageMap;
+	PendingMap					m_pending;
+	ImageCacheStatistics		m_statistics;
+
+	std::deque<PrefetchJob>		m_jobs;
+	de::Semaphore				m_jobSem;
+	bool						m_stopPrefetch;
+	ImagePrefetchThread*		m_prefetchThread;
+};
+
+} // tcu
+
+#endif // _TCURESOURCECACHE_HPP
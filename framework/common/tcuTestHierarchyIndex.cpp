@@ -0,0 +1,529 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Serialized test hierarchy index.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuTestHierarchyIndex.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuResource.hpp"
+#include "tcuResourceCache.hpp"
+#include "qpInfo.h"
+#include "deSha1.h"
+
+#include <map>
+#include <algorithm>
+#include <sstream>
+
+#if (DE_OS == DE_OS_UNIX || DE_OS == DE_OS_ANDROID)
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#endif
+
+namespace tcu
+{
+
+using std::string;
+using std::vector;
+
+// Index layout:
+//
+//  Header:		magic, version, number of nodes, string table size,
+//				binary fingerprint (SHA-1), hierarchy hash (SHA-1)
+//  Nodes:		name offset, description offset, node type, parent index, sub-tree end
+//  Strings:	null-terminated strings
+//
+// All values are little-endian deUint32s.
+
+enum
+{
+	INDEX_MAGIC				= 0x58494864,	//!< "dHIX"
+	INDEX_VERSION			= 2,
+
+	HASH_NUM_FIELDS			= 5,	//!< deSha1
+
+	HEADER_FIELD_MAGIC		= 0,
+	HEADER_FIELD_VERSION,
+	HEADER_FIELD_NUM_NODES,
+	HEADER_FIELD_STRINGS_SIZE,
+	HEADER_FIELD_FINGERPRINT,
+	HEADER_FIELD_HIERARCHY_HASH	= HEADER_FIELD_FINGERPRINT + HASH_NUM_FIELDS,
+
+	HEADER_NUM_FIELDS		= HEADER_FIELD_HIERARCHY_HASH + HASH_NUM_FIELDS,
+
+	NODE_FIELD_NAME			= 0,
+	NODE_FIELD_DESCRIPTION,
+	NODE_FIELD_TYPE,
+	NODE_FIELD_PARENT,
+	NODE_FIELD_SUBTREE_END,
+
+	NODE_NUM_FIELDS
+};
+
+static const deUint32 NO_PARENT = ~0u;
+
+static deUint32 readUint32 (const deUint8* ptr)
+{
+	return (deUint32)ptr[0] | ((deUint32)ptr[1] << 8) | ((deUint32)ptr[2] << 16) | ((deUint32)ptr[3] << 24);
+}
+
+static void writeUint32 (deUint8* ptr, deUint32 value)
+{
+	ptr[0] = (deUint8)(value & 0xffu);
+	ptr[1] = (deUint8)((value >> 8) & 0xffu);
+	ptr[2] = (deUint8)((value >> 16) & 0xffu);
+	ptr[3] = (deUint8)((value >> 24) & 0xffu);
+}
+
+static deUint32 addString (vector<char>& table, std::map<string, deUint32>& offsets, const string& str)
+{
+	const std::map<string, deUint32>::const_iterator existing = offsets.find(str);
+
+	if (existing != offsets.end())
+		return existing->second;
+	else
+	{
+		const deUint32 offset = (deUint32)table.size();
+
+		table.insert(table.end(), str.begin(), str.end());
+		table.push_back(0);
+		offsets[str] = offset;
+
+		return offset;
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Compute fingerprint of the test binary
+ *
+ * Fingerprint covers release info, top-level nodes of the hierarchy and,
+ * where available, size and modification time of the executable. Group
+ * contents are not included as that would require inflating them.
+ *//*--------------------------------------------------------------------*/
+static deSha1 computeBinaryFingerprint (TestPackageRoot& root)
+{
+	std::ostringstream		str;
+	vector<TestNode*>		children;
+	deSha1					hash;
+
+	str << qpGetReleaseName() << '\0' << qpGetReleaseId() << '\0';
+
+	root.getChildren(children);
+
+	for (size_t ndx = 0; ndx < children.size(); ndx++)
+		str << children[ndx]->getName() << '\0' << children[ndx]->getDescription() << '\0' << (int)children[ndx]->getNodeType() << '\0';
+
+#if (DE_OS == DE_OS_UNIX || DE_OS == DE_OS_ANDROID)
+	{
+		struct stat info;
+
+		if (stat("/proc/self/exe", &info) == 0)
+			str << (deInt64)info.st_size << '\0' << (deInt64)info.st_mtime << '\0';
+	}
+#endif
+
+	{
+		const string data = str.str();
+		deSha1_compute(&hash, data.size(), data.c_str());
+	}
+
+	return hash;
+}
+
+static void readHash (deSha1& dst, const deUint8* ptr)
+{
+	for (int ndx = 0; ndx < HASH_NUM_FIELDS; ndx++)
+		dst.hash[ndx] = readUint32(ptr + ndx*sizeof(deUint32));
+}
+
+static void writeHash (deUint8* ptr, const deSha1& hash)
+{
+	for (int ndx = 0; ndx < HASH_NUM_FIELDS; ndx++)
+		writeUint32(ptr + ndx*sizeof(deUint32), hash.hash[ndx]);
+}
+
+// TestHierarchyIndex
+
+TestHierarchyIndex::TestHierarchyIndex (const char* filename)
+	: m_data		(DE_NULL)
+	, m_size		(0)
+	, m_numNodes	(0)
+	, m_strings		(DE_NULL)
+{
+	{
+		FileResource resource (filename);
+
+		m_file = de::MovePtr<ResourceData>(new ResourceData(resource));
+	}
+
+	m_data	= m_file->getData();
+	m_size	= m_file->getSize();
+
+	init();
+}
+
+TestHierarchyIndex::TestHierarchyIndex (const deUint8* data, size_t size)
+	: m_data		(data)
+	, m_size		(size)
+	, m_numNodes	(0)
+	, m_strings		(DE_NULL)
+{
+	init();
+}
+
+TestHierarchyIndex::~TestHierarchyIndex (void)
+{
+}
+
+void TestHierarchyIndex::init (void)
+{
+	const size_t	headerSize	= HEADER_NUM_FIELDS*sizeof(deUint32);
+	const size_t	nodeSize	= NODE_NUM_FIELDS*sizeof(deUint32);
+
+	if (m_size < headerSize || readUint32(m_data + HEADER_FIELD_MAGIC*sizeof(deUint32)) != INDEX_MAGIC)
+		throw Exception("Invalid test hierarchy index");
+
+	if (readUint32(m_data + HEADER_FIELD_VERSION*sizeof(deUint32)) != INDEX_VERSION)
+		throw Exception("Unsupported test hierarchy index version, rebuild the index with --deqp-runmode=hierarchy-index");
+
+	{
+		const deUint32	numNodes		= readUint32(m_data + HEADER_FIELD_NUM_NODES*sizeof(deUint32));
+		const deUint32	stringsSize		= readUint32(m_data + HEADER_FIELD_STRINGS_SIZE*sizeof(deUint32));
+
+		if (numNodes == 0 || stringsSize == 0 ||
+			(deUint64)headerSize + (deUint64)numNodes*nodeSize + stringsSize != (deUint64)m_size)
+			throw Exception("Test hierarchy index is truncated or corrupt");
+
+		{
+			deSha1	storedHash;
+			deSha1	actualHash;
+
+			readHash(storedHash, m_data + HEADER_FIELD_HIERARCHY_HASH*sizeof(deUint32));
+			deSha1_compute(&actualHash, m_size - headerSize, m_data + headerSize);
+
+			if (!deSha1_equal(&storedHash, &actualHash))
+				throw Exception("Test hierarchy index is corrupt, hash mismatch");
+		}
+
+		m_numNodes	= (int)numNodes;
+		m_strings	= (const char*)(m_data + headerSize + numNodes*nodeSize);
+
+		// Last string must be terminated so that all lookups stay within the table.
+		if (m_strings[stringsSize-1] != 0)
+			throw Exception("Test hierarchy index string table is corrupt");
+
+		for (int nodeNdx = 0; nodeNdx < m_numNodes; nodeNdx++)
+		{
+			const deUint32	parentNdx	= getNodeField(nodeNdx, NODE_FIELD_PARENT);
+			const deUint32	subtreeEnd	= getNodeField(nodeNdx, NODE_FIELD_SUBTREE_END);
+			const deUint32	nodeType	= getNodeField(nodeNdx, NODE_FIELD_TYPE);
+
+			if (getNodeField(nodeNdx, NODE_FIELD_NAME) >= stringsSize ||
+				getNodeField(nodeNdx, NODE_FIELD_DESCRIPTION) >= stringsSize ||
+				nodeType > (deUint32)NODETYPE_ACCURACY ||
+				((nodeNdx == 0) != (nodeType == (deUint32)NODETYPE_ROOT)) ||
+				(nodeNdx == 0 ? parentNdx != NO_PARENT : parentNdx >= (deUint32)nodeNdx) ||
+				subtreeEnd <= (deUint32)nodeNdx || subtreeEnd > numNodes)
+				throw Exception("Test hierarchy index node data is corrupt");
+		}
+	}
+}
+
+deUint32 TestHierarchyIndex::getNodeField (int nodeNdx, int fieldNdx) const
+{
+	DE_ASSERT(de::inBounds(nodeNdx, 0, m_numNodes));
+	return readUint32(m_data + (HEADER_NUM_FIELDS + nodeNdx*NODE_NUM_FIELDS + fieldNdx)*sizeof(deUint32));
+}
+
+const char* TestHierarchyIndex::getNodeName (int nodeNdx) const
+{
+	return m_strings + getNodeField(nodeNdx, NODE_FIELD_NAME);
+}
+
+const char* TestHierarchyIndex::getNodeDescription (int nodeNdx) const
+{
+	return m_strings + getNodeField(nodeNdx, NODE_FIELD_DESCRIPTION);
+}
+
+TestNodeType TestHierarchyIndex::getNodeType (int nodeNdx) const
+{
+	return (TestNodeType)getNodeField(nodeNdx, NODE_FIELD_TYPE);
+}
+
+int TestHierarchyIndex::getParentNdx (int nodeNdx) const
+{
+	const deUint32 parentNdx = getNodeField(nodeNdx, NODE_FIELD_PARENT);
+	return parentNdx == NO_PARENT ? -1 : (int)parentNdx;
+}
+
+int TestHierarchyIndex::getSubtreeEnd (int nodeNdx) const
+{
+	return (int)getNodeField(nodeNdx, NODE_FIELD_SUBTREE_END);
+}
+
+int TestHierarchyIndex::findNode (const string& path) const
+{
+	int		curNodeNdx	= 0;
+	size_t	compStart	= 0;
+
+	if (path.empty())
+		return 0;
+
+	for (;;)
+	{
+		const size_t	compEnd		= path.find('.', compStart);
+		const size_t	compLen		= (compEnd == string::npos ? path.size() : compEnd) - compStart;
+		const int		subtreeEnd	= getSubtreeEnd(curNodeNdx);
+		int				childNdx	= curNodeNdx+1;
+
+		while (childNdx < subtreeEnd && path.compare(compStart, compLen, getNodeName(childNdx)) != 0)
+			childNdx = getSubtreeEnd(childNdx);
+
+		if (childNdx >= subtreeEnd)
+			return -1;
+
+		curNodeNdx = childNdx;
+
+		if (compEnd == string::npos)
+			return curNodeNdx;
+
+		compStart = compEnd+1;
+	}
+}
+
+string TestHierarchyIndex::getNodePath (int nodeNdx) const
+{
+	string path;
+
+	for (int curNdx = nodeNdx; curNdx > 0; curNdx = getParentNdx(curNdx))
+		path = (path.empty() ? string(getNodeName(curNdx)) : string(getNodeName(curNdx)) + "." + path);
+
+	return path;
+}
+
+void TestHierarchyIndex::build (vector<deUint8>& dst, TestPackageRoot& root, TestHierarchyInflater& inflater)
+{
+	const CaseListFilter		allCases;
+	TestHierarchyIterator		iter			(root, inflater, allCases);
+	vector<deUint32>			nodeData;
+	vector<char>				strings;
+	std::map<string, deUint32>	stringOffsets;
+	vector<deUint32>			nodeStack;
+
+	// Root node is not reported by the iterator.
+	nodeData.resize(NODE_NUM_FIELDS, 0u);
+	nodeData[NODE_FIELD_NAME]			= addString(strings, stringOffsets, "");
+	nodeData[NODE_FIELD_DESCRIPTION]	= nodeData[NODE_FIELD_NAME];
+	nodeData[NODE_FIELD_TYPE]			= (deUint32)NODETYPE_ROOT;
+	nodeData[NODE_FIELD_PARENT]			= NO_PARENT;
+	nodeStack.push_back(0u);
+
+	for (; iter.getState() != TestHierarchyIterator::STATE_FINISHED; iter.next())
+	{
+		const TestNode* const	node		= iter.getNode();
+		const deUint32			numNodes	= (deUint32)(nodeData.size() / NODE_NUM_FIELDS);
+
+		if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
+		{
+			const size_t nodeOffset = nodeData.size();
+
+			nodeData.resize(nodeOffset + NODE_NUM_FIELDS, 0u);
+			nodeData[nodeOffset + NODE_FIELD_NAME]			= addString(strings, stringOffsets, node->getName());
+			nodeData[nodeOffset + NODE_FIELD_DESCRIPTION]	= addString(strings, stringOffsets, node->getDescription());
+			nodeData[nodeOffset + NODE_FIELD_TYPE]			= (deUint32)node->getNodeType();
+			nodeData[nodeOffset + NODE_FIELD_PARENT]		= nodeStack.back();
+			nodeStack.push_back(numNodes);
+		}
+		else
+		{
+			nodeData[nodeStack.back()*NODE_NUM_FIELDS + NODE_FIELD_SUBTREE_END] = numNodes;
+			nodeStack.pop_back();
+		}
+	}
+
+	DE_ASSERT(nodeStack.size() == 1);
+	nodeData[NODE_FIELD_SUBTREE_END] = (deUint32)(nodeData.size() / NODE_NUM_FIELDS);
+
+	{
+		const size_t	headerSize	= HEADER_NUM_FIELDS*sizeof(deUint32);
+		deSha1			hierarchyHash;
+
+		dst.resize(headerSize + nodeData.size()*sizeof(deUint32) + strings.size());
+
+		for (size_t ndx = 0; ndx < nodeData.size(); ndx++)
+			writeUint32(&dst[headerSize + ndx*sizeof(deUint32)], nodeData[ndx]);
+
+		std::copy(strings.begin(), strings.end(), dst.begin() + headerSize + nodeData.size()*sizeof(deUint32));
+
+		deSha1_compute(&hierarchyHash, dst.size() - headerSize, &dst[headerSize]);
+
+		writeUint32(&dst[HEADER_FIELD_MAGIC*sizeof(deUint32)],			(deUint32)INDEX_MAGIC);
+		writeUint32(&dst[HEADER_FIELD_VERSION*sizeof(deUint32)],		(deUint32)INDEX_VERSION);
+		writeUint32(&dst[HEADER_FIELD_NUM_NODES*sizeof(deUint32)],		(deUint32)(nodeData.size() / NODE_NUM_FIELDS));
+		writeUint32(&dst[HEADER_FIELD_STRINGS_SIZE*sizeof(deUint32)],	(deUint32)strings.size());
+		writeHash(&dst[HEADER_FIELD_FINGERPRINT*sizeof(deUint32)],		computeBinaryFingerprint(root));
+		writeHash(&dst[HEADER_FIELD_HIERARCHY_HASH*sizeof(deUint32)],	hierarchyHash);
+	}
+}
+
+bool TestHierarchyIndex::isCompatible (TestPackageRoot& root) const
+{
+	const deSha1	expected	= computeBinaryFingerprint(root);
+	deSha1			stored;
+
+	readHash(stored, m_data + HEADER_FIELD_FINGERPRINT*sizeof(deUint32));
+
+	return deSha1_equal(&stored, &expected) == DE_TRUE;
+}
+
+de::MovePtr<TestHierarchyIndex> TestHierarchyIndex::load (const char* filename, TestPackageRoot& root)
+{
+	de::MovePtr<TestHierarchyIndex> index (new TestHierarchyIndex(filename));
+
+	if (!index->isCompatible(root))
+	{
+		print("WARNING: Test hierarchy index '%s' was not generated by this binary, ignoring it\n", filename);
+		index.clear();
+	}
+
+	return index;
+}
+
+de::MovePtr<TestHierarchyIndex> TestHierarchyIndex::loadForPackage (TestPackageRoot& root, const CommandLine& cmdLine)
+{
+	if (cmdLine.getHierarchyIndexFile())
+		return load(cmdLine.getHierarchyIndexFile(), root);
+	else
+		return de::MovePtr<TestHierarchyIndex>();
+}
+
+// TestHierarchyIndexIterator
+
+TestHierarchyIndexIterator::TestHierarchyIndexIterator (const TestHierarchyIndex& index, const CaseListFilter& caseListFilter)
+	: m_index			(index)
+	, m_caseListFilter	(caseListFilter)
+{
+	// Root is never reported.
+	pushNode(0);
+	m_stack.back().isEntered = true;
+	next();
+}
+
+TestHierarchyIndexIterator::~TestHierarchyIndexIterator (void)
+{
+}
+
+TestHierarchyIterator::State TestHierarchyIndexIterator::getState (void) const
+{
+	if (!m_stack.empty())
+		return m_stack.back().isLeaving ? TestHierarchyIterator::STATE_LEAVE_NODE : TestHierarchyIterator::STATE_ENTER_NODE;
+	else
+		return TestHierarchyIterator::STATE_FINISHED;
+}
+
+int TestHierarchyIndexIterator::getNodeNdx (void) const
+{
+	DE_ASSERT(getState() != TestHierarchyIterator::STATE_FINISHED);
+	return m_stack.back().nodeNdx;
+}
+
+const string& TestHierarchyIndexIterator::getNodePath (void) const
+{
+	DE_ASSERT(getState() != TestHierarchyIterator::STATE_FINISHED);
+	return m_nodePath;
+}
+
+void TestHierarchyIndexIterator::pushNode (int nodeNdx)
+{
+	NodeIter iter;
+
+	iter.nodeNdx		= nodeNdx;
+	iter.nextChildNdx	= nodeNdx+1;
+	iter.isEntered		= false;
+	iter.isLeaving		= false;
+
+	m_stack.push_back(iter);
+}
+
+void TestHierarchyIndexIterator::updateNodePath (void)
+{
+	m_nodePath.clear();
+
+	for (size_t ndx = 1; ndx < m_stack.size(); ndx++)
+	{
+		if (ndx > 1)
+			m_nodePath += ".";
+		m_nodePath += m_index.getNodeName(m_stack[ndx].nodeNdx);
+	}
+}
+
+void TestHierarchyIndexIterator::next (void)
+{
+	// Pop node that reported leave event.
+	if (!m_stack.empty() && m_stack.back().isLeaving)
+	{
+		m_stack.pop_back();
+		updateNodePath();
+	}
+
+	while (!m_stack.empty())
+	{
+		NodeIter&			iter		= m_stack.back();
+		const TestNodeType	nodeType	= m_index.getNodeType(iter.nodeNdx);
+		const bool			isLeaf		= isTestNodeTypeExecutable(nodeType);
+
+		if (!iter.isEntered)
+		{
+			updateNodePath();
+
+			if (!(isLeaf ? m_caseListFilter.checkTestCaseName(m_nodePath.c_str()) : m_caseListFilter.checkTestGroupName(m_nodePath.c_str())))
+			{
+				m_stack.pop_back();
+				updateNodePath();
+				continue;
+			}
+
+			iter.isEntered = true;
+			return; // Yield enter event
+		}
+		else if (isLeaf || iter.nextChildNdx >= m_index.getSubtreeEnd(iter.nodeNdx))
+		{
+			if (nodeType == NODETYPE_ROOT)
+			{
+				m_stack.pop_back();
+				continue;
+			}
+
+			iter.isLeaving = true;
+			return; // Yield leave event
+		}
+		else
+		{
+			const int childNdx = iter.nextChildNdx;
+
+			iter.nextChildNdx = m_index.getSubtreeEnd(childNdx);
+			pushNode(childNdx);
+		}
+	}
+
+	DE_ASSERT(getState() == TestHierarchyIterator::STATE_FINISHED);
+}
+
+} // tcu
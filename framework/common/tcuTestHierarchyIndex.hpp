@@ -0,0 +1,149 @@
+#ifndef _TCUTESTHIERARCHYINDEX_HPP
+#define _TCUTESTHIERARCHYINDEX_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Serialized test hierarchy index.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestCase.hpp"
+#include "tcuTestHierarchyIterator.hpp"
+#include "deUniquePtr.hpp"
+
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+
+class CaseListFilter;
+class CommandLine;
+class ResourceData;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read-only view to serialized test hierarchy
+ *
+ * Index contains name, description and type of every node in the test
+ * hierarchy, including the root node, in depth-first pre-order. Each
+ * node stores index of its parent and end of its sub-tree, so children
+ * of node N are found by starting from N+1 and skipping over sub-trees.
+ *
+ * Index data consists of fixed-size little-endian records followed by
+ * a string table and is accessed in-place, so index files are mapped
+ * into memory where supported.
+ *
+ * Index must be generated by the same test binary that uses it, as
+ * nodes not present in the index are assumed not to exist. Header
+ * stores a fingerprint of the binary, checked with isCompatible(), and
+ * a hash of the node data that is verified when the index is opened.
+ *//*--------------------------------------------------------------------*/
+class TestHierarchyIndex
+{
+public:
+	explicit				TestHierarchyIndex		(const char* filename);
+							TestHierarchyIndex		(const deUint8* data, size_t size);	//!< Data must outlive the index.
+							~TestHierarchyIndex		(void);
+
+	int						getNumNodes				(void) const { return m_numNodes; }
+
+	const char*				getNodeName				(int nodeNdx) const;
+	const char*				getNodeDescription		(int nodeNdx) const;
+	TestNodeType			getNodeType				(int nodeNdx) const;
+	int						getParentNdx			(int nodeNdx) const;	//!< -1 for root node.
+	int						getSubtreeEnd			(int nodeNdx) const;	//!< One past the last descendant.
+
+	//! Find node by full path (e.g. dEQP-GLES2.info.vendor). Returns -1 if not found.
+	int						findNode				(const std::string& path) const;
+	std::string				getNodePath				(int nodeNdx) const;
+
+	//! Check that index was built from the given hierarchy by this binary.
+	bool					isCompatible			(TestPackageRoot& root) const;
+
+	static void				build					(std::vector<deUint8>& dst, TestPackageRoot& root, TestHierarchyInflater& inflater);
+
+	//! Open index file. Returns null index, with a warning, if index is not compatible with root.
+	static de::MovePtr<TestHierarchyIndex>	load	(const char* filename, TestPackageRoot& root);
+
+	//! Open index file given on command line, if any. Returns null index if no file is given or index is not compatible.
+	static de::MovePtr<TestHierarchyIndex>	loadForPackage	(TestPackageRoot& root, const CommandLine& cmdLine);
+
+private:
+							TestHierarchyIndex		(const TestHierarchyIndex&);	// not allowed!
+	TestHierarchyIndex&		operator=				(const TestHierarchyIndex&);	// not allowed!
+
+	void					init					(void);
+	deUint32				getNodeField			(int nodeNdx, int fieldNdx) const;
+
+	de::MovePtr<ResourceData>	m_file;
+	const deUint8*			m_data;
+	size_t					m_size;
+	int						m_numNodes;
+	const char*				m_strings;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Test hierarchy index iterator
+ *
+ * Walks indexed test hierarchy in the same order, and with the same
+ * filtering, as TestHierarchyIterator walks the inflated hierarchy.
+ * No test nodes are constructed.
+ *//*--------------------------------------------------------------------*/
+class TestHierarchyIndexIterator
+{
+public:
+								TestHierarchyIndexIterator	(const TestHierarchyIndex& index, const CaseListFilter& caseListFilter);
+								~TestHierarchyIndexIterator	(void);
+
+	TestHierarchyIterator::State	getState				(void) const;
+
+	int							getNodeNdx					(void) const;
+	TestNodeType				getNodeType					(void) const { return m_index.getNodeType(getNodeNdx());			}
+	const char*					getNodeName					(void) const { return m_index.getNodeName(getNodeNdx());			}
+	const char*					getNodeDescription			(void) const { return m_index.getNodeDescription(getNodeNdx());	}
+	const std::string&			getNodePath					(void) const;
+
+	void						next						(void);
+
+private:
+	struct NodeIter
+	{
+		int		nodeNdx;
+		int		nextChildNdx;
+		bool	isEntered;		//!< Enter event has been reported.
+		bool	isLeaving;		//!< All children have been visited.
+	};
+
+								TestHierarchyIndexIterator	(const TestHierarchyIndexIterator&);	// not allowed!
+	TestHierarchyIndexIterator&	operator=					(const TestHierarchyIndexIterator&);	// not allowed!
+
+	void						pushNode					(int nodeNdx);
+	void						updateNodePath				(void);
+
+	const TestHierarchyIndex&	m_index;
+	const CaseListFilter&		m_caseListFilter;
+
+	std::vector<NodeIter>		m_stack;
+	std::string					m_nodePath;
+};
+
+} // tcu
+
+#endif // _TCUTESTHIERARCHYINDEX_HPP
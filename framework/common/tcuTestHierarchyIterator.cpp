@@ -22,7 +22,9 @@
  *//*--------------------------------------------------------------------*/
 
 #include "tcuTestHierarchyIterator.hpp"
+#include "tcuTestHierarchyIndex.hpp"
 #include "tcuCommandLine.hpp"
+#include "deString.h"
 
 namespace tcu
 {
@@ -87,10 +89,27 @@ void DefaultHierarchyInflater::leaveGroupNode (TestCaseGroup* testGroup)
 
 TestHierarchyIterator::TestHierarchyIterator (TestPackageRoot&			rootNode,
 											  TestHierarchyInflater&	inflater,
-											  const CaseListFilter&		caseListFilter)
+											  const CaseListFilter&		caseListFilter,
+											  const TestHierarchyIndex*	hierarchyIndex)
 	: m_inflater		(inflater)
 	, m_caseListFilter	(caseListFilter)
+	, m_hierarchyIndex	(hierarchyIndex && hierarchyIndex->isCompatible(rootNode) ? hierarchyIndex : DE_NULL)
 {
+	if (m_hierarchyIndex)
+	{
+		// Mark selected cases and all their ancestors.
+		m_selectedNodes.resize(m_hierarchyIndex->getNumNodes(), false);
+
+		for (TestHierarchyIndexIterator indexIter (*m_hierarchyIndex, caseListFilter); indexIter.getState() != STATE_FINISHED; indexIter.next())
+		{
+			if (indexIter.getState() == STATE_ENTER_NODE && isTestNodeTypeExecutable(indexIter.getNodeType()))
+			{
+				for (int nodeNdx = indexIter.getNodeNdx(); nodeNdx >= 0 && !m_selectedNodes[nodeNdx]; nodeNdx = m_hierarchyIndex->getParentNdx(nodeNdx))
+					m_selectedNodes[nodeNdx] = true;
+			}
+		}
+	}
+
 	// Init traverse state and "seek" to first reportable node.
 	NodeIter iter(&rootNode);
 	iter.setState(NodeIter::STATE_ENTER); // Root is never reported
@@ -144,6 +163,18 @@ const std::string& TestHierarchyIterator::getNodePath (void) const
 	return m_nodePath;
 }
 
+bool TestHierarchyIterator::hasSelectedCases (const std::string& groupPath) const
+{
+	if (m_hierarchyIndex)
+	{
+		const int nodeNdx = m_hierarchyIndex->findNode(groupPath);
+
+		return nodeNdx < 0 || m_selectedNodes[nodeNdx];
+	}
+	else
+		return true;
+}
+
 std::string TestHierarchyIterator::buildNodePath (const vector<NodeIter>& nodeStack)
 {
 	string nodePath;
@@ -172,7 +203,7 @@ void TestHierarchyIterator::next (void)
 				const std::string nodePath = buildNodePath(m_sessionStack);
 
 				// Return to parent if name doesn't match filter.
-				if (!(isLeaf ? m_caseListFilter.checkTestCaseName(nodePath.c_str()) : m_caseListFilter.checkTestGroupName(nodePath.c_str())))
+				if (!(isLeaf ? m_caseListFilter.checkTestCaseName(nodePath.c_str()) : (m_caseListFilter.checkTestGroupName(nodePath.c_str()) && hasSelectedCases(nodePath))))
 				{
 					m_sessionStack.pop_back();
 					break;
@@ -256,4 +287,29 @@ void TestHierarchyIterator::next (void)
 	DE_ASSERT(m_sessionStack.empty() && getState() == STATE_FINISHED);
 }
 
+void TestHierarchyIterator::getUpcomingCases (int maxCases, std::vector<TestCase*>& dst) const
+{
+	dst.clear();
+
+	DE_ASSERT(getState() != STATE_FINISHED && isTestNodeTypeExecutable(getNode()->getNodeType()));
+
+	if (m_sessionStack.size() < 2)
+		return;
+
+	{
+		const NodeIter&		parent		= m_sessionStack[m_sessionStack.size()-2];
+		const std::string	parentPath	= m_nodePath.substr(0, m_nodePath.size() - deStrnlen(getNode()->getName(), m_nodePath.size()));
+
+		DE_ASSERT(parent.getState() == NodeIter::STATE_TRAVERSE_CHILDREN);
+
+		for (int childNdx = parent.curChildNdx+1; childNdx < (int)parent.children.size() && (int)dst.size() < maxCases; childNdx++)
+		{
+			TestNode* const child = parent.children[childNdx];
+
+			if (isTestNodeTypeExecutable(child->getNodeType()) && m_caseListFilter.checkTestCaseName((parentPath + child->getName()).c_str()))
+				dst.push_back(static_cast<TestCase*>(child));
+		}
+	}
+}
+
 } // tcu
@@ -34,6 +34,7 @@ namespace tcu
 {
 
 class CaseListFilter;
+class TestHierarchyIndex;
 
 /*--------------------------------------------------------------------*//*!
  * \brief Test hierarchy inflater
@@ -103,11 +104,16 @@ protected:
  * Upon exiting a group node, before STATE_LEAVE_NODE is called, inflater
  * is asked to clean up any resources by calling leaveGroupNode() or
  * leaveTestPackage() depending on the type of the node.
+ *
+ * If a hierarchy index is given, groups that the index shows to contain
+ * no cases matching the filter are skipped without inflating them.
+ * Groups missing from the index are always entered. Index that was not
+ * built from rootNode by this binary is ignored.
  *//*--------------------------------------------------------------------*/
 class TestHierarchyIterator
 {
 public:
-							TestHierarchyIterator	(TestPackageRoot& rootNode, TestHierarchyInflater& inflater, const CaseListFilter& caseListFilter);
+							TestHierarchyIterator	(TestPackageRoot& rootNode, TestHierarchyInflater& inflater, const CaseListFilter& caseListFilter, const TestHierarchyIndex* hierarchyIndex = DE_NULL);
 							~TestHierarchyIterator	(void);
 
 	enum State
@@ -126,6 +132,10 @@ public:
 
 	void					next					(void);
 
+	//! Get up to maxCases selected cases that follow current case in its group.
+	//! Cases in other groups are not included, as they may not be created yet.
+	void					getUpcomingCases		(int maxCases, std::vector<TestCase*>& dst) const;
+
 private:
 	struct NodeIter
 	{
@@ -186,15 +196,18 @@ private:
 
 	bool					matchFolderName			(const std::string& folderName) const;
 	bool					matchCaseName			(const std::string& caseName) const;
+	bool					hasSelectedCases		(const std::string& groupPath) const;
 
 	static std::string		buildNodePath			(const std::vector<NodeIter>& nodeStack);
 
-	TestHierarchyInflater&	m_inflater;
-	const CaseListFilter&	m_caseListFilter;
+	TestHierarchyInflater&		m_inflater;
+	const CaseListFilter&		m_caseListFilter;
+	const TestHierarchyIndex*	m_hierarchyIndex;
+	std::vector<bool>			m_selectedNodes;		//!< Index nodes that are, or contain, cases matching the filter.
 
 	// Current session state.
-	std::vector<NodeIter>	m_sessionStack;
-	std::string				m_nodePath;
+	std::vector<NodeIter>		m_sessionStack;
+	std::string					m_nodePath;
 };
 
 } // tcu
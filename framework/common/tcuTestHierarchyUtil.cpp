@@ -23,11 +23,13 @@
 
 #include "tcuTestHierarchyUtil.hpp"
 #include "tcuStringTemplate.hpp"
+#include "tcuTestHierarchyIndex.hpp"
 #include "tcuCommandLine.hpp"
 
 #include "qpXmlWriter.h"
 
 #include <fstream>
+#include <iostream>
 
 namespace tcu
 {
@@ -59,17 +61,39 @@ static std::string makePackageFilename (const std::string& pattern, const std::s
 	return StringTemplate(pattern).specialize(args);
 }
 
-static void writeXmlCaselist (TestHierarchyIterator& iter, qpXmlWriter* writer)
+/*--------------------------------------------------------------------*//*!
+ * \brief Adapter giving TestHierarchyIterator the node query interface of
+ *		  TestHierarchyIndexIterator, so that caselist writers can walk
+ *		  both inflated and indexed hierarchies.
+ *//*--------------------------------------------------------------------*/
+class InflatedHierarchyIterator
+{
+public:
+									InflatedHierarchyIterator	(TestHierarchyIterator& iter) : m_iter(iter) {}
+
+	TestHierarchyIterator::State	getState					(void) const { return m_iter.getState();						}
+	TestNodeType					getNodeType					(void) const { return m_iter.getNode()->getNodeType();			}
+	const char*						getNodeName					(void) const { return m_iter.getNode()->getName();				}
+	const char*						getNodeDescription			(void) const { return m_iter.getNode()->getDescription();		}
+	const string&					getNodePath					(void) const { return m_iter.getNodePath();					}
+
+	void							next						(void) { m_iter.next(); }
+
+private:
+	TestHierarchyIterator&			m_iter;
+};
+
+template<typename Iterator>
+static void writeXmlCaselist (Iterator& iter, qpXmlWriter* writer)
 {
 	DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-			  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
+			  iter.getNodeType() == NODETYPE_PACKAGE);
 
 	{
-		const TestNode* node		= iter.getNode();
 		qpXmlAttribute	attribs[2];
 		int				numAttribs	= 0;
-		attribs[numAttribs++] = qpSetStringAttrib("PackageName", node->getName());
-		attribs[numAttribs++] = qpSetStringAttrib("Description", node->getDescription());
+		attribs[numAttribs++] = qpSetStringAttrib("PackageName", iter.getNodeName());
+		attribs[numAttribs++] = qpSetStringAttrib("Description", iter.getNodeDescription());
 		DE_ASSERT(numAttribs <= DE_LENGTH_OF_ARRAY(attribs));
 
 		if (!qpXmlWriter_startDocument(writer) ||
@@ -79,10 +103,9 @@ static void writeXmlCaselist (TestHierarchyIterator& iter, qpXmlWriter* writer)
 
 	iter.next();
 
-	while (iter.getNode()->getNodeType() != NODETYPE_PACKAGE)
+	while (iter.getNodeType() != NODETYPE_PACKAGE)
 	{
-		const TestNode* const	node		= iter.getNode();
-		const TestNodeType		nodeType	= node->getNodeType();
+		const TestNodeType		nodeType	= iter.getNodeType();
 		const bool				isEnter		= iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE;
 
 		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE ||
@@ -90,8 +113,8 @@ static void writeXmlCaselist (TestHierarchyIterator& iter, qpXmlWriter* writer)
 		{
 			if (isEnter)
 			{
-				const string	caseName	= node->getName();
-				const string	description	= node->getDescription();
+				const string	caseName	= iter.getNodeName();
+				const string	description	= iter.getNodeDescription();
 				qpXmlAttribute	attribs[3];
 				int				numAttribs = 0;
 
@@ -119,25 +142,18 @@ static void writeXmlCaselist (TestHierarchyIterator& iter, qpXmlWriter* writer)
 		throw Exception("Failed to terminate XML document");
 }
 
-/*--------------------------------------------------------------------*//*!
- * \brief Export the test list of each package into a separate XML file.
- *//*--------------------------------------------------------------------*/
-void writeXmlCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+template<typename Iterator>
+static void writeXmlCaselistsToFiles (Iterator& iter, const CommandLine& cmdLine)
 {
-	DefaultHierarchyInflater			inflater		(testCtx);
-	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
-
-	TestHierarchyIterator				iter			(root, inflater, *caseListFilter);
-	const char* const					filenamePattern = cmdLine.getCaseListExportFile();
+	const char* const filenamePattern = cmdLine.getCaseListExportFile();
 
 	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
 	{
-		const TestNode* node		= iter.getNode();
-		const char*		pkgName		= node->getName();
+		const char*		pkgName		= iter.getNodeName();
 		const string	filename	= makePackageFilename(filenamePattern, pkgName, "xml");
 
 		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-				  node->getNodeType() == NODETYPE_PACKAGE);
+				  iter.getNodeType() == NODETYPE_PACKAGE);
 
 		FILE*			file	= DE_NULL;
 		qpXmlWriter*	writer	= DE_NULL;
@@ -172,49 +188,173 @@ void writeXmlCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, cons
 		}
 
 		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
-				  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
+				  iter.getNodeType() == NODETYPE_PACKAGE);
 		iter.next();
 	}
 }
 
-/*--------------------------------------------------------------------*//*!
- * \brief Export the test list of each package into a separate ascii file.
- *//*--------------------------------------------------------------------*/
-void writeTxtCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+template<typename Iterator>
+static void writeTxtCaselist (Iterator& iter, std::ostream& out)
 {
-	DefaultHierarchyInflater			inflater		(testCtx);
-	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+	DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
+			  iter.getNodeType() == NODETYPE_PACKAGE);
+
+	iter.next();
+
+	while (iter.getNodeType() != NODETYPE_PACKAGE)
+	{
+		if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
+			out << (isTestNodeTypeExecutable(iter.getNodeType()) ? "TEST" : "GROUP") << ": " << iter.getNodePath() << "\n";
+		iter.next();
+	}
+
+	DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
+			  iter.getNodeType() == NODETYPE_PACKAGE);
+	iter.next();
+}
 
-	TestHierarchyIterator				iter			(root, inflater, *caseListFilter);
-	const char* const					filenamePattern = cmdLine.getCaseListExportFile();
+template<typename Iterator>
+static void writeTxtCaselistsToFiles (Iterator& iter, const CommandLine& cmdLine)
+{
+	const char* const filenamePattern = cmdLine.getCaseListExportFile();
 
 	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
 	{
-		const TestNode* node		= iter.getNode();
-		const char*		pkgName		= node->getName();
+		const char*		pkgName		= iter.getNodeName();
 		const string	filename	= makePackageFilename(filenamePattern, pkgName, "txt");
 
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-				  node->getNodeType() == NODETYPE_PACKAGE);
-
 		std::ofstream out(filename.c_str(), std::ios_base::binary);
 		if (!out.is_open() || !out.good())
 			throw Exception("Failed to open " + filename);
 
 		print("Writing test cases from '%s' to file '%s'..\n", pkgName, filename.c_str());
 
-		iter.next();
+		writeTxtCaselist(iter, out);
+	}
+}
 
-		while (iter.getNode()->getNodeType() != NODETYPE_PACKAGE)
-		{
-			if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
-				out << (isTestNodeTypeExecutable(iter.getNode()->getNodeType()) ? "TEST" : "GROUP") << ": " << iter.getNodePath() << "\n";
-			iter.next();
-		}
+template<typename Iterator>
+static void writeCaselistsToStdout (Iterator& iter)
+{
+	while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
+		writeTxtCaselist(iter, std::cout);
+}
 
-		DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
-				  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
-		iter.next();
+/*--------------------------------------------------------------------*//*!
+ * \brief Export the test list of each package into a separate XML file.
+ *
+ * If a hierarchy index built by this binary is given on command line,
+ * the test list is read from the index and the test hierarchy is not
+ * inflated.
+ *//*--------------------------------------------------------------------*/
+void writeXmlCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+
+	de::MovePtr<TestHierarchyIndex>		index			(TestHierarchyIndex::loadForPackage(root, cmdLine));
+
+	if (index)
+	{
+		TestHierarchyIndexIterator	iter		(*index, *caseListFilter);
+
+		writeXmlCaselistsToFiles(iter, cmdLine);
+	}
+	else
+	{
+		DefaultHierarchyInflater	inflater	(testCtx);
+		TestHierarchyIterator		iter		(root, inflater, *caseListFilter);
+		InflatedHierarchyIterator	adapter		(iter);
+
+		writeXmlCaselistsToFiles(adapter, cmdLine);
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Export the test list of each package into a separate ascii file.
+ *
+ * If a hierarchy index built by this binary is given on command line,
+ * the test list is read from the index and the test hierarchy is not
+ * inflated.
+ *//*--------------------------------------------------------------------*/
+void writeTxtCaselistsToFiles (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+
+	de::MovePtr<TestHierarchyIndex>		index			(TestHierarchyIndex::loadForPackage(root, cmdLine));
+
+	if (index)
+	{
+		TestHierarchyIndexIterator	iter		(*index, *caseListFilter);
+
+		writeTxtCaselistsToFiles(iter, cmdLine);
+	}
+	else
+	{
+		DefaultHierarchyInflater	inflater	(testCtx);
+		TestHierarchyIterator		iter		(root, inflater, *caseListFilter);
+		InflatedHierarchyIterator	adapter		(iter);
+
+		writeTxtCaselistsToFiles(adapter, cmdLine);
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Write all packages found to stdout without any separations.
+ *
+ * Recommended to be used with a single package only. It's possible to use
+ * test selectors for limiting the export to one package in a multipackage
+ * binary.
+ *//*--------------------------------------------------------------------*/
+void writeCaselistsToStdout (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	de::MovePtr<const CaseListFilter>	caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+
+	de::MovePtr<TestHierarchyIndex>		index			(TestHierarchyIndex::loadForPackage(root, cmdLine));
+
+	if (index)
+	{
+		TestHierarchyIndexIterator	iter		(*index, *caseListFilter);
+
+		writeCaselistsToStdout(iter);
+	}
+	else
+	{
+		DefaultHierarchyInflater	inflater	(testCtx);
+		TestHierarchyIterator		iter		(root, inflater, *caseListFilter);
+		InflatedHierarchyIterator	adapter		(iter);
+
+		writeCaselistsToStdout(adapter);
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Write index of the complete test hierarchy into a file.
+ *
+ * Case filters are ignored, index always contains all test nodes.
+ *//*--------------------------------------------------------------------*/
+void writeHierarchyIndexToFile (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	const char* const			filename	= cmdLine.getHierarchyIndexFile();
+	DefaultHierarchyInflater	inflater	(testCtx);
+	std::vector<deUint8>		data;
+
+	if (!filename)
+		throw Exception("Hierarchy index file must be specified with --deqp-hierarchy-index");
+
+	TestHierarchyIndex::build(data, root, inflater);
+
+	print("Writing test hierarchy index to file '%s'..\n", filename);
+
+	{
+		std::ofstream out(filename, std::ios_base::binary);
+
+		if (!out.is_open() || !out.good())
+			throw Exception(string("Failed to open ") + filename);
+
+		out.write((const char*)&data[0], (std::streamsize)data.size());
+
+		if (!out.good())
+			throw Exception(string("Failed to write ") + filename);
 	}
 }
 
@@ -58,6 +58,13 @@ public:
 	virtual void						init				(TestCase* testCase, const std::string& path) = 0;
 	virtual void						deinit				(TestCase* testCase) = 0;
 	virtual TestNode::IterateResult		iterate				(TestCase* testCase) = 0;
+
+	//! Number of upcoming cases executor wants to see in prefetch(). 0 disables prefetching.
+	virtual int							getNumPrefetchCases	(void) const { return 0; }
+
+	//! Called before init() with cases that follow in the current group, in execution order.
+	//! Executor may start preparing them in background. Must not throw.
+	virtual void						prefetch			(const std::vector<TestCase*>& upcomingCases) { DE_UNREF(upcomingCases); }
 };
 
 /*--------------------------------------------------------------------*//*!
@@ -46,20 +46,37 @@ static qpTestCaseType nodeTypeToTestCaseType (TestNodeType nodeType)
 	}
 }
 
+static de::MovePtr<InstrumentationTraceWriter> createTraceWriter (const CommandLine& cmdLine)
+{
+	if (cmdLine.getInstrumentationMode() == INSTRUMENTATION_TRACE)
+		return de::MovePtr<InstrumentationTraceWriter>(new InstrumentationTraceWriter(cmdLine.getInstrumentationFile()));
+	else
+		return de::MovePtr<InstrumentationTraceWriter>();
+}
+
 TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& testCtx)
-	: m_testCtx			(testCtx)
-	, m_inflater		(testCtx)
-	, m_caseListFilter	(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()))
-	, m_iterator		(root, m_inflater, *m_caseListFilter)
-	, m_state			(STATE_TRAVERSE_HIERARCHY)
-	, m_abortSession	(false)
-	, m_isInTestCase	(false)
-	, m_testStartTime	(0)
+	: m_testCtx						(testCtx)
+	, m_inflater					(testCtx)
+	, m_caseListFilter				(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()))
+	, m_hierarchyIndex				(TestHierarchyIndex::loadForPackage(root, testCtx.getCommandLine()))
+	, m_iterator					(root, m_inflater, *m_caseListFilter, m_hierarchyIndex.get())
+	, m_state						(STATE_TRAVERSE_HIERARCHY)
+	, m_abortSession				(false)
+	, m_isInTestCase				(false)
+	, m_testStartTime				(0)
+	, m_isInstrumentationEnabled	(testCtx.getCommandLine().getInstrumentationMode() != INSTRUMENTATION_DISABLE)
+	, m_traceWriter					(createTraceWriter(testCtx.getCommandLine()))
+	, m_testStartTimeNs				(0)
+	, m_testContextId				(0)
 {
+	if (m_isInstrumentationEnabled)
+		Instrumentation::setEnabled(true);
 }
 
 TestSessionExecutor::~TestSessionExecutor (void)
 {
+	if (m_isInstrumentationEnabled)
+		Instrumentation::setEnabled(false);
 }
 
 bool TestSessionExecutor::iterate (void)
@@ -177,6 +194,27 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 	m_isInTestCase	= true;
 	m_testStartTime	= deGetMicroseconds();
 
+	if (m_isInstrumentationEnabled)
+	{
+		// Flush events recorded since previous case
+		collectInstrumentation();
+
+		m_testContextId		+= 1;
+		m_testStartTimeNs	= deGetNanoseconds();
+		Instrumentation::setActiveContext(m_testContextId);
+	}
+
+	// Let executor prepare following cases while this one runs
+	if (m_caseExecutor->getNumPrefetchCases() > 0)
+	{
+		std::vector<TestCase*> upcomingCases;
+
+		m_iterator.getUpcomingCases(m_caseExecutor->getNumPrefetchCases(), upcomingCases);
+
+		if (!upcomingCases.empty())
+			m_caseExecutor->prefetch(upcomingCases);
+	}
+
 	try
 	{
 		m_caseExecutor->init(testCase, casePath);
@@ -223,6 +261,9 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 		m_testCtx.setTerminateAfter(true);
 	}
 
+	if (m_isInstrumentationEnabled)
+		writeInstrumentation();
+
 	{
 		const deInt64 duration = deGetMicroseconds()-m_testStartTime;
 		m_testStartTime = 0;
@@ -260,6 +301,59 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 		qpWatchDog_reset(m_testCtx.getWatchDog());
 }
 
+//! Remove events not issued by given context. If contextId is 0, remove only events without context.
+static void filterEventsByContext (std::vector<InstrumentationEvent>& events, deUint32 contextId)
+{
+	size_t numKept = 0;
+
+	for (size_t ndx = 0; ndx < events.size(); ndx++)
+	{
+		if (contextId != 0 ? events[ndx].contextId == contextId : events[ndx].contextId != 0)
+			events[numKept++] = events[ndx];
+	}
+
+	events.resize(numKept);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Collect recorded events and write them to trace file
+ *
+ * Events issued by any case are written, including those of earlier
+ * cases that completed on background threads while another case ran.
+ * Events recorded outside cases are discarded. Collected events are left
+ * in m_instrumentationEvents.
+ *//*--------------------------------------------------------------------*/
+void TestSessionExecutor::collectInstrumentation (void)
+{
+	m_instrumentationEvents.clear();
+	Instrumentation::collectEvents(m_instrumentationEvents);
+
+	if (m_traceWriter)
+	{
+		filterEventsByContext(m_instrumentationEvents, 0);
+		m_traceWriter->writeEvents(m_instrumentationEvents);
+	}
+}
+
+void TestSessionExecutor::writeInstrumentation (void)
+{
+	const deUint64 testEndTimeNs = deGetNanoseconds();
+
+	Instrumentation::setActiveContext(0);
+
+	if (m_traceWriter)
+		m_traceWriter->writeCase(m_iterator.getNodePath(), m_testContextId, m_testStartTimeNs, testEndTimeNs);
+
+	collectInstrumentation();
+
+	// Only events issued by this case go to its log
+	if (!m_traceWriter)
+	{
+		filterEventsByContext(m_instrumentationEvents, m_testContextId);
+		logInstrumentationEvents(m_testCtx.getLog(), m_instrumentationEvents);
+	}
+}
+
 TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase)
 {
 	TestLog&				log				= m_testCtx.getLog();
@@ -28,6 +28,8 @@
 #include "tcuTestCase.hpp"
 #include "tcuTestPackage.hpp"
 #include "tcuTestHierarchyIterator.hpp"
+#include "tcuTestHierarchyIndex.hpp"
+#include "tcuInstrumentation.hpp"
 #include "deUniquePtr.hpp"
 
 namespace tcu
@@ -76,6 +78,9 @@ private:
 	TestCase::IterateResult			iterateTestCase		(TestCase* testCase);
 	void							leaveTestCase		(TestCase* testCase);
 
+	void							collectInstrumentation	(void);
+	void							writeInstrumentation	(void);
+
 	enum State
 	{
 		STATE_TRAVERSE_HIERARCHY = 0,
@@ -88,6 +93,7 @@ private:
 
 	DefaultHierarchyInflater		m_inflater;
 	de::MovePtr<CaseListFilter>		m_caseListFilter;
+	de::MovePtr<TestHierarchyIndex>	m_hierarchyIndex;
 	TestHierarchyIterator			m_iterator;
 
 	de::MovePtr<TestCaseExecutor>	m_caseExecutor;
@@ -96,6 +102,13 @@ private:
 	bool							m_abortSession;
 	bool							m_isInTestCase;
 	deUint64						m_testStartTime;
+
+	// Timing instrumentation, see --deqp-instrumentation
+	const bool									m_isInstrumentationEnabled;
+	de::MovePtr<InstrumentationTraceWriter>		m_traceWriter;				//!< Null unless writing trace file.
+	std::vector<InstrumentationEvent>			m_instrumentationEvents;
+	deUint64									m_testStartTimeNs;
+	deUint32									m_testContextId;			//!< Instrumentation context of current case, cases are numbered from 1.
 };
 
 } // tcu
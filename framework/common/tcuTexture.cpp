@@ -3210,6 +3210,198 @@ void Texture2D::allocLevel (int levelNdx)
 	TextureLevelPyramid::allocLevel(levelNdx, width, height, 1);
 }
 
+// Texture2DSampler
+
+namespace
+{
+
+template<int NumChannels>
+inline Vec4 readUnormInt8Texel (const deUint8* ptr);
+
+template<>
+inline Vec4 readUnormInt8Texel<4> (const deUint8* ptr) { return readRGBA8888Float(ptr); }
+
+template<>
+inline Vec4 readUnormInt8Texel<3> (const deUint8* ptr) { return readRGB888Float(ptr); }
+
+// \note Must match sampleNearest2D() and sampleLinear2D() exactly, including order of floating-point operations.
+template<int NumChannels, Sampler::WrapMode WrapS, Sampler::WrapMode WrapT>
+Vec4 sampleNearest2DUnormInt8 (const ConstPixelBufferAccess& level, float u, float v)
+{
+	const int	i	= wrap(WrapS, deFloorFloatToInt32(u), level.getWidth());
+	const int	j	= wrap(WrapT, deFloorFloatToInt32(v), level.getHeight());
+
+	return readUnormInt8Texel<NumChannels>((const deUint8*)level.getPixelPtr(i, j));
+}
+
+template<int NumChannels, Sampler::WrapMode WrapS, Sampler::WrapMode WrapT>
+Vec4 sampleLinear2DUnormInt8 (const ConstPixelBufferAccess& level, float u, float v)
+{
+	const int		w	= level.getWidth();
+	const int		h	= level.getHeight();
+
+	const int		x0	= deFloorFloatToInt32(u-0.5f);
+	const int		y0	= deFloorFloatToInt32(v-0.5f);
+
+	const int		i0	= wrap(WrapS, x0, w);
+	const int		i1	= wrap(WrapS, x0+1, w);
+	const int		j0	= wrap(WrapT, y0, h);
+	const int		j1	= wrap(WrapT, y0+1, h);
+
+	const float		a	= deFloatFrac(u-0.5f);
+	const float		b	= deFloatFrac(v-0.5f);
+
+	const Vec4		p00	= readUnormInt8Texel<NumChannels>((const deUint8*)level.getPixelPtr(i0, j0));
+	const Vec4		p10	= readUnormInt8Texel<NumChannels>((const deUint8*)level.getPixelPtr(i1, j0));
+	const Vec4		p01	= readUnormInt8Texel<NumChannels>((const deUint8*)level.getPixelPtr(i0, j1));
+	const Vec4		p11	= readUnormInt8Texel<NumChannels>((const deUint8*)level.getPixelPtr(i1, j1));
+
+	return (p00*(1.0f-a)*(1.0f-b)) +
+		   (p10*(     a)*(1.0f-b)) +
+		   (p01*(1.0f-a)*(     b)) +
+		   (p11*(     a)*(     b));
+}
+
+typedef Texture2DSampler::LevelSampleFunc LevelSampleFunc;
+
+template<int NumChannels, Sampler::WrapMode WrapS>
+void selectUnormInt8SampleFuncs (Sampler::WrapMode wrapT, LevelSampleFunc& nearestFunc, LevelSampleFunc& linearFunc)
+{
+	switch (wrapT)
+	{
+		case Sampler::CLAMP_TO_EDGE:
+			nearestFunc	= sampleNearest2DUnormInt8<NumChannels, WrapS, Sampler::CLAMP_TO_EDGE>;
+			linearFunc	= sampleLinear2DUnormInt8<NumChannels, WrapS, Sampler::CLAMP_TO_EDGE>;
+			break;
+
+		case Sampler::REPEAT_GL:
+			nearestFunc	= sampleNearest2DUnormInt8<NumChannels, WrapS, Sampler::REPEAT_GL>;
+			linearFunc	= sampleLinear2DUnormInt8<NumChannels, WrapS, Sampler::REPEAT_GL>;
+			break;
+
+		case Sampler::MIRRORED_REPEAT_GL:
+			nearestFunc	= sampleNearest2DUnormInt8<NumChannels, WrapS, Sampler::MIRRORED_REPEAT_GL>;
+			linearFunc	= sampleLinear2DUnormInt8<NumChannels, WrapS, Sampler::MIRRORED_REPEAT_GL>;
+			break;
+
+		default:
+			break;
+	}
+}
+
+template<int NumChannels>
+void selectUnormInt8SampleFuncs (Sampler::WrapMode wrapS, Sampler::WrapMode wrapT, LevelSampleFunc& nearestFunc, LevelSampleFunc& linearFunc)
+{
+	switch (wrapS)
+	{
+		case Sampler::CLAMP_TO_EDGE:		selectUnormInt8SampleFuncs<NumChannels, Sampler::CLAMP_TO_EDGE>		(wrapT, nearestFunc, linearFunc);	break;
+		case Sampler::REPEAT_GL:			selectUnormInt8SampleFuncs<NumChannels, Sampler::REPEAT_GL>			(wrapT, nearestFunc, linearFunc);	break;
+		case Sampler::MIRRORED_REPEAT_GL:	selectUnormInt8SampleFuncs<NumChannels, Sampler::MIRRORED_REPEAT_GL>	(wrapT, nearestFunc, linearFunc);	break;
+		default:
+			break;
+	}
+}
+
+} // anonymous
+
+Texture2DSampler::Texture2DSampler (const Texture2DView& view, const Sampler& sampler)
+	: m_view		(view)
+	, m_sampler		(sampler)
+	, m_nearestFunc	(DE_NULL)
+	, m_linearFunc	(DE_NULL)
+{
+	if (view.getNumLevels() == 0)
+		return;
+
+	const TextureFormat&	format		= view.getLevel(0).getFormat();
+	int						numChannels	= 0;
+
+	if (format == TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8))
+		numChannels = 4;
+	else if (format == TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8))
+		numChannels = 3;
+	else
+		return;
+
+	// Specialized routines read texels directly and assume tightly packed pixels
+	for (int levelNdx = 0; levelNdx < view.getNumLevels(); levelNdx++)
+	{
+		const ConstPixelBufferAccess& level = view.getLevel(levelNdx);
+
+		if (level.getFormat() != format || level.getPixelPitch() != numChannels)
+			return;
+	}
+
+	if (numChannels == 4)
+		selectUnormInt8SampleFuncs<4>(sampler.wrapS, sampler.wrapT, m_nearestFunc, m_linearFunc);
+	else
+		selectUnormInt8SampleFuncs<3>(sampler.wrapS, sampler.wrapT, m_nearestFunc, m_linearFunc);
+}
+
+inline Vec4 Texture2DSampler::sampleLevel (int levelNdx, Sampler::FilterMode filter, float s, float t) const
+{
+	const ConstPixelBufferAccess&	level	= m_view.getLevel(levelNdx);
+	const LevelSampleFunc			func	= (filter == Sampler::LINEAR) ? m_linearFunc : m_nearestFunc;
+
+	DE_ASSERT(filter == Sampler::NEAREST || filter == Sampler::LINEAR);
+
+	// \note Specialized wrap modes all use ordinary unnormalization
+	if (m_sampler.normalizedCoords)
+		return func(level, (float)level.getWidth()*s, (float)level.getHeight()*t);
+	else
+		return func(level, s, t);
+}
+
+Vec4 Texture2DSampler::sample (float s, float t, float lod) const
+{
+	if (!isSpecialized())
+		return m_view.sample(m_sampler, s, t, lod);
+
+	// Level selection must match sampleLevelArray2DOffset()
+	const bool					magnified	= lod <= m_sampler.lodThreshold;
+	const Sampler::FilterMode	filterMode	= magnified ? m_sampler.magFilter : m_sampler.minFilter;
+	const int					maxLevel	= m_view.getNumLevels()-1;
+
+	switch (filterMode)
+	{
+		case Sampler::NEAREST:
+		case Sampler::LINEAR:
+			return sampleLevel(0, filterMode, s, t);
+
+		case Sampler::NEAREST_MIPMAP_NEAREST:
+		case Sampler::LINEAR_MIPMAP_NEAREST:
+		{
+			const int					level		= deClamp32((int)deFloatCeil(lod + 0.5f) - 1, 0, maxLevel);
+			const Sampler::FilterMode	levelFilter	= (filterMode == Sampler::LINEAR_MIPMAP_NEAREST) ? Sampler::LINEAR : Sampler::NEAREST;
+
+			return sampleLevel(level, levelFilter, s, t);
+		}
+
+		case Sampler::NEAREST_MIPMAP_LINEAR:
+		case Sampler::LINEAR_MIPMAP_LINEAR:
+		{
+			const int					level0		= deClamp32((int)deFloatFloor(lod), 0, maxLevel);
+			const int					level1		= de::min(maxLevel, level0 + 1);
+			const Sampler::FilterMode	levelFilter	= (filterMode == Sampler::LINEAR_MIPMAP_LINEAR) ? Sampler::LINEAR : Sampler::NEAREST;
+			const float					f			= deFloatFrac(lod);
+			const Vec4					t0			= sampleLevel(level0, levelFilter, s, t);
+			const Vec4					t1			= sampleLevel(level1, levelFilter, s, t);
+
+			return t0*(1.0f - f) + t1*f;
+		}
+
+		default:
+			DE_ASSERT(DE_FALSE);
+			return Vec4(0.0f);
+	}
+}
+
+void Texture2DSampler::sample4 (Vec4 (&dst)[4], const Vec2 (&coords)[4], const float (&lod)[4]) const
+{
+	for (int fragNdx = 0; fragNdx < 4; fragNdx++)
+		dst[fragNdx] = sample(coords[fragNdx].x(), coords[fragNdx].y(), lod[fragNdx]);
+}
+
 // TextureCubeView
 
 TextureCubeView::TextureCubeView (void)
@@ -596,6 +596,37 @@ inline Vec4 Texture2DView::gatherOffsetsCompare (const Sampler& sampler, float r
 	return gatherArray2DOffsetsCompare(m_levels[0], sampler, ref, s, t, 0, offsets);
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Specialized 2D texture sampler
+ *
+ * Selects a level sampling routine specialized for the level format, wrap
+ * modes and filters once at construction, avoiding per-texel format and
+ * wrap mode dispatch. Views and samplers without a specialized routine
+ * use the generic path. Results are identical to Texture2DView::sample().
+ *
+ * \note View levels and sampler are referenced, not copied.
+ *//*--------------------------------------------------------------------*/
+class Texture2DSampler
+{
+public:
+	typedef Vec4					(*LevelSampleFunc)	(const ConstPixelBufferAccess& level, float u, float v);
+
+									Texture2DSampler	(const Texture2DView& view, const Sampler& sampler);
+
+	bool							isSpecialized		(void) const	{ return m_nearestFunc != DE_NULL;	}
+
+	Vec4							sample				(float s, float t, float lod) const;
+	void							sample4				(Vec4 (&dst)[4], const Vec2 (&coords)[4], const float (&lod)[4]) const;
+
+private:
+	Vec4							sampleLevel			(int levelNdx, Sampler::FilterMode filter, float s, float t) const;
+
+	const Texture2DView&			m_view;
+	const Sampler&					m_sampler;
+	LevelSampleFunc					m_nearestFunc;		//!< Specialized NEAREST level sampling or DE_NULL
+	LevelSampleFunc					m_linearFunc;		//!< Specialized LINEAR level sampling or DE_NULL
+};
+
 /*--------------------------------------------------------------------*//*!
  * \brief Base class for textures that have single mip-map pyramid
  *//*--------------------------------------------------------------------*/
@@ -26,8 +26,11 @@
 #include "deRandom.hpp"
 #include "deMath.h"
 #include "deMemory.h"
+#include "deParallel.hpp"
 
 #include <limits>
+#include <vector>
+#include <algorithm>
 
 namespace tcu
 {
@@ -672,6 +675,46 @@ enum
 	CLEAR_OPTIMIZE_MAX_PIXEL_SIZE	= 8
 };
 
+enum
+{
+	// Rows are split across threads only when each thread gets at least this much work;
+	// thread launch overhead dominates for smaller images.
+	PARALLEL_MIN_PIXELS_PER_THREAD	= 1<<16,	//!< For per-pixel format conversion.
+	PARALLEL_MIN_BYTES_PER_THREAD	= 1<<20		//!< For row memcpy and fill.
+};
+
+//! Calls func(y, z) for rows of access (row index spans all slices) in given range.
+template<typename RowFunc>
+class RowRangeTask : public de::RangeTask
+{
+public:
+	RowRangeTask (const RowFunc& func, int height)
+		: m_func	(func)
+		, m_height	(height)
+	{
+	}
+
+	void execute (int begin, int end)
+	{
+		for (int rowNdx = begin; rowNdx < end; rowNdx++)
+			m_func(rowNdx % m_height, rowNdx / m_height);
+	}
+
+private:
+	const RowFunc	m_func;
+	const int		m_height;
+};
+
+template<typename RowFunc>
+static void forEachRow (const ConstPixelBufferAccess& access, int minPixelsPerThread, const RowFunc& func)
+{
+	const int				numRows		= access.getHeight()*access.getDepth();
+	RowRangeTask<RowFunc>	task		(func, access.getHeight());
+
+	if (numRows > 0)
+		de::parallelFor(numRows, de::max(1, minPixelsPerThread / de::max(1, access.getWidth())), task);
+}
+
 inline void fillRow (const PixelBufferAccess& dst, int y, int z, int pixelSize, const deUint8* pixel)
 {
 	DE_ASSERT(dst.getPixelPitch() == pixelSize); // only tightly packed
@@ -703,38 +746,52 @@ inline void fillRow (const PixelBufferAccess& dst, int y, int z, int pixelSize,
 	}
 }
 
-void clear (const PixelBufferAccess& access, const Vec4& color)
+class FillRowFunc
 {
-	const int	pixelSize				= access.getFormat().getPixelSize();
-	const int	pixelPitch				= access.getPixelPitch();
-	const bool	rowPixelsTightlyPacked	= (pixelSize == pixelPitch);
+public:
+	FillRowFunc (const PixelBufferAccess& dst, int pixelSize, const deUint8* pixel)
+		: m_dst			(dst)
+		, m_pixelSize	(pixelSize)
+	{
+		DE_ASSERT(pixelSize <= CLEAR_OPTIMIZE_MAX_PIXEL_SIZE);
+		deMemcpy(&m_pixel.u8[0], pixel, pixelSize);
+	}
 
-	if (access.getWidth()*access.getHeight()*access.getDepth() >= CLEAR_OPTIMIZE_THRESHOLD &&
-		pixelSize < CLEAR_OPTIMIZE_MAX_PIXEL_SIZE && rowPixelsTightlyPacked)
+	void operator() (int y, int z) const { fillRow(m_dst, y, z, m_pixelSize, &m_pixel.u8[0]); }
+
+private:
+	const PixelBufferAccess		m_dst;
+	const int					m_pixelSize;
+	union
 	{
-		// Convert to destination format.
-		union
-		{
-			deUint8		u8[CLEAR_OPTIMIZE_MAX_PIXEL_SIZE];
-			deUint64	u64; // Forces 64-bit alignment.
-		} pixel;
-		DE_STATIC_ASSERT(sizeof(pixel) == CLEAR_OPTIMIZE_MAX_PIXEL_SIZE);
-		PixelBufferAccess(access.getFormat(), 1, 1, 1, 0, 0, &pixel.u8[0]).setPixel(color, 0, 0);
+		deUint8		u8[CLEAR_OPTIMIZE_MAX_PIXEL_SIZE];
+		deUint64	u64; // Forces 64-bit alignment.
+	}							m_pixel;
+};
 
-		for (int z = 0; z < access.getDepth(); z++)
-			for (int y = 0; y < access.getHeight(); y++)
-				fillRow(access, y, z, pixelSize, &pixel.u8[0]);
+template<typename ColorType>
+class SetPixelRowFunc
+{
+public:
+	SetPixelRowFunc (const PixelBufferAccess& dst, const ColorType& color)
+		: m_dst		(dst)
+		, m_color	(color)
+	{
 	}
-	else
+
+	void operator() (int y, int z) const
 	{
-		for (int z = 0; z < access.getDepth(); z++)
-			for (int y = 0; y < access.getHeight(); y++)
-				for (int x = 0; x < access.getWidth(); x++)
-					access.setPixel(color, x, y, z);
+		for (int x = 0; x < m_dst.getWidth(); x++)
+			m_dst.setPixel(m_color, x, y, z);
 	}
-}
 
-void clear (const PixelBufferAccess& access, const IVec4& color)
+private:
+	const PixelBufferAccess		m_dst;
+	const ColorType				m_color;
+};
+
+template<typename ColorType>
+static void clearImpl (const PixelBufferAccess& access, const ColorType& color)
 {
 	const int	pixelSize				= access.getFormat().getPixelSize();
 	const int	pixelPitch				= access.getPixelPitch();
@@ -752,17 +809,20 @@ void clear (const PixelBufferAccess& access, const IVec4& color)
 		DE_STATIC_ASSERT(sizeof(pixel) == CLEAR_OPTIMIZE_MAX_PIXEL_SIZE);
 		PixelBufferAccess(access.getFormat(), 1, 1, 1, 0, 0, &pixel.u8[0]).setPixel(color, 0, 0);
 
-		for (int z = 0; z < access.getDepth(); z++)
-			for (int y = 0; y < access.getHeight(); y++)
-				fillRow(access, y, z, pixelSize, &pixel.u8[0]);
+		forEachRow(access, PARALLEL_MIN_BYTES_PER_THREAD / pixelSize, FillRowFunc(access, pixelSize, &pixel.u8[0]));
 	}
 	else
-	{
-		for (int z = 0; z < access.getDepth(); z++)
-			for (int y = 0; y < access.getHeight(); y++)
-				for (int x = 0; x < access.getWidth(); x++)
-					access.setPixel(color, x, y, z);
-	}
+		forEachRow(access, PARALLEL_MIN_PIXELS_PER_THREAD, SetPixelRowFunc<ColorType>(access, color));
+}
+
+void clear (const PixelBufferAccess& access, const Vec4& color)
+{
+	clearImpl(access, color);
+}
+
+void clear (const PixelBufferAccess& access, const IVec4& color)
+{
+	clearImpl(access, color);
 }
 
 void clear (const PixelBufferAccess& access, const UVec4& color)
@@ -800,10 +860,25 @@ static void fillWithComponentGradients1D (const PixelBufferAccess& access, const
 	}
 }
 
-static void fillWithComponentGradients2D (const PixelBufferAccess& access, const Vec4& minVal, const Vec4& maxVal)
+class ComponentGradient2DRowFunc
 {
-	for (int y = 0; y < access.getHeight(); y++)
+public:
+	ComponentGradient2DRowFunc (const PixelBufferAccess& access, const Vec4& minVal, const Vec4& maxVal)
+		: m_access	(access)
+		, m_minVal	(minVal)
+		, m_maxVal	(maxVal)
 	{
+	}
+
+	void operator() (int y, int z) const
+	{
+		DE_ASSERT(z == 0);
+		DE_UNREF(z);
+
+		const PixelBufferAccess&	access	= m_access;
+		const Vec4&					minVal	= m_minVal;
+		const Vec4&					maxVal	= m_maxVal;
+
 		for (int x = 0; x < access.getWidth(); x++)
 		{
 			float s = ((float)x + 0.5f) / (float)access.getWidth();
@@ -817,30 +892,49 @@ static void fillWithComponentGradients2D (const PixelBufferAccess& access, const
 			access.setPixel(tcu::Vec4(r, g, b, a), x, y);
 		}
 	}
-}
 
-static void fillWithComponentGradients3D (const PixelBufferAccess& dst, const Vec4& minVal, const Vec4& maxVal)
+private:
+	const PixelBufferAccess		m_access;
+	const Vec4					m_minVal;
+	const Vec4					m_maxVal;
+};
+
+class ComponentGradient3DRowFunc
 {
-	for (int z = 0; z < dst.getDepth(); z++)
+public:
+	ComponentGradient3DRowFunc (const PixelBufferAccess& dst, const Vec4& minVal, const Vec4& maxVal)
+		: m_dst		(dst)
+		, m_minVal	(minVal)
+		, m_maxVal	(maxVal)
 	{
-		for (int y = 0; y < dst.getHeight(); y++)
+	}
+
+	void operator() (int y, int z) const
+	{
+		const PixelBufferAccess&	dst		= m_dst;
+		const Vec4&					minVal	= m_minVal;
+		const Vec4&					maxVal	= m_maxVal;
+
+		for (int x = 0; x < dst.getWidth(); x++)
 		{
-			for (int x = 0; x < dst.getWidth(); x++)
-			{
-				float s = ((float)x + 0.5f) / (float)dst.getWidth();
-				float t = ((float)y + 0.5f) / (float)dst.getHeight();
-				float p = ((float)z + 0.5f) / (float)dst.getDepth();
+			float s = ((float)x + 0.5f) / (float)dst.getWidth();
+			float t = ((float)y + 0.5f) / (float)dst.getHeight();
+			float p = ((float)z + 0.5f) / (float)dst.getDepth();
 
-				float r = linearInterpolate(s,						minVal.x(), maxVal.x());
-				float g = linearInterpolate(t,						minVal.y(), maxVal.y());
-				float b = linearInterpolate(p,						minVal.z(), maxVal.z());
-				float a = linearInterpolate(1.0f - (s+t+p)/3.0f,	minVal.w(), maxVal.w());
+			float r = linearInterpolate(s,						minVal.x(), maxVal.x());
+			float g = linearInterpolate(t,						minVal.y(), maxVal.y());
+			float b = linearInterpolate(p,						minVal.z(), maxVal.z());
+			float a = linearInterpolate(1.0f - (s+t+p)/3.0f,	minVal.w(), maxVal.w());
 
-				dst.setPixel(tcu::Vec4(r, g, b, a), x, y, z);
-			}
+			dst.setPixel(tcu::Vec4(r, g, b, a), x, y, z);
 		}
 	}
-}
+
+private:
+	const PixelBufferAccess		m_dst;
+	const Vec4					m_minVal;
+	const Vec4					m_maxVal;
+};
 
 void fillWithComponentGradients (const PixelBufferAccess& access, const Vec4& minVal, const Vec4& maxVal)
 {
@@ -862,62 +956,46 @@ void fillWithComponentGradients (const PixelBufferAccess& access, const Vec4& mi
 		if (access.getHeight() == 1 && access.getDepth() == 1)
 			fillWithComponentGradients1D(access, minVal, maxVal);
 		else if (access.getDepth() == 1)
-			fillWithComponentGradients2D(access, minVal, maxVal);
+			forEachRow(access, PARALLEL_MIN_PIXELS_PER_THREAD, ComponentGradient2DRowFunc(access, minVal, maxVal));
 		else
-			fillWithComponentGradients3D(access, minVal, maxVal);
+			forEachRow(access, PARALLEL_MIN_PIXELS_PER_THREAD, ComponentGradient3DRowFunc(access, minVal, maxVal));
 	}
 }
 
-static void fillWithGrid1D (const PixelBufferAccess& access, int cellSize, const Vec4& colorA, const Vec4& colorB)
+//! Grid row for 1D, 2D and 3D accesses; cell index along unused dimensions is always 0.
+class GridRowFunc
 {
-	for (int x = 0; x < access.getWidth(); x++)
+public:
+	GridRowFunc (const PixelBufferAccess& access, int cellSize, const Vec4& colorA, const Vec4& colorB)
+		: m_access		(access)
+		, m_cellSize	(cellSize)
+		, m_colorA		(colorA)
+		, m_colorB		(colorB)
 	{
-		int mx = (x / cellSize) % 2;
-
-		if (mx)
-			access.setPixel(colorB, x, 0);
-		else
-			access.setPixel(colorA, x, 0);
 	}
-}
 
-static void fillWithGrid2D (const PixelBufferAccess& access, int cellSize, const Vec4& colorA, const Vec4& colorB)
-{
-	for (int y = 0; y < access.getHeight(); y++)
+	void operator() (int y, int z) const
 	{
-		for (int x = 0; x < access.getWidth(); x++)
+		const int my = (y / m_cellSize) % 2;
+		const int mz = (z / m_cellSize) % 2;
+
+		for (int x = 0; x < m_access.getWidth(); x++)
 		{
-			int mx = (x / cellSize) % 2;
-			int my = (y / cellSize) % 2;
+			int mx = (x / m_cellSize) % 2;
 
-			if (mx ^ my)
-				access.setPixel(colorB, x, y);
+			if (mx ^ my ^ mz)
+				m_access.setPixel(m_colorB, x, y, z);
 			else
-				access.setPixel(colorA, x, y);
+				m_access.setPixel(m_colorA, x, y, z);
 		}
 	}
-}
 
-static void fillWithGrid3D (const PixelBufferAccess& access, int cellSize, const Vec4& colorA, const Vec4& colorB)
-{
-	for (int z = 0; z < access.getDepth(); z++)
-	{
-		for (int y = 0; y < access.getHeight(); y++)
-		{
-			for (int x = 0; x < access.getWidth(); x++)
-			{
-				int mx = (x / cellSize) % 2;
-				int my = (y / cellSize) % 2;
-				int mz = (z / cellSize) % 2;
-
-				if (mx ^ my ^ mz)
-					access.setPixel(colorB, x, y, z);
-				else
-					access.setPixel(colorA, x, y, z);
-			}
-		}
-	}
-}
+private:
+	const PixelBufferAccess		m_access;
+	const int					m_cellSize;
+	const Vec4					m_colorA;
+	const Vec4					m_colorB;
+};
 
 void fillWithGrid (const PixelBufferAccess& access, int cellSize, const Vec4& colorA, const Vec4& colorB)
 {
@@ -936,12 +1014,7 @@ void fillWithGrid (const PixelBufferAccess& access, int cellSize, const Vec4& co
 	}
 	else
 	{
-		if (access.getHeight() == 1 && access.getDepth() == 1)
-			fillWithGrid1D(access, cellSize, colorA, colorB);
-		else if (access.getDepth() == 1)
-			fillWithGrid2D(access, cellSize, colorA, colorB);
-		else
-			fillWithGrid3D(access, cellSize, colorA, colorB);
+		forEachRow(access, PARALLEL_MIN_PIXELS_PER_THREAD, GridRowFunc(access, cellSize, colorA, colorB));
 	}
 }
 
@@ -1009,14 +1082,80 @@ void fillWithMetaballs (const PixelBufferAccess& dst, int numBalls, deUint32 see
 	}
 }
 
+class CopyRowFunc
+{
+public:
+	enum Mode
+	{
+		MODE_MEMCPY_ROW = 0,	//!< Matching formats, tightly packed rows.
+		MODE_MEMCPY_PIXEL,		//!< Matching formats.
+		MODE_DEPTH,
+		MODE_STENCIL,
+		MODE_INT,
+		MODE_FLOAT,
+
+		MODE_LAST
+	};
+
+	CopyRowFunc (Mode mode, const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
+		: m_mode	(mode)
+		, m_dst		(dst)
+		, m_src		(src)
+	{
+	}
+
+	void operator() (int y, int z) const
+	{
+		const PixelBufferAccess&		dst		= m_dst;
+		const ConstPixelBufferAccess&	src		= m_src;
+		const int						width	= dst.getWidth();
+
+		switch (m_mode)
+		{
+			case MODE_MEMCPY_ROW:
+				deMemcpy(dst.getPixelPtr(0, y, z), src.getPixelPtr(0, y, z), src.getFormat().getPixelSize()*width);
+				break;
+
+			case MODE_MEMCPY_PIXEL:
+				for (int x = 0; x < width; x++)
+					deMemcpy(dst.getPixelPtr(x, y, z), src.getPixelPtr(x, y, z), src.getFormat().getPixelSize());
+				break;
+
+			case MODE_DEPTH:
+				for (int x = 0; x < width; x++)
+					dst.setPixDepth(src.getPixDepth(x, y, z), x, y, z);
+				break;
+
+			case MODE_STENCIL:
+				for (int x = 0; x < width; x++)
+					dst.setPixStencil(src.getPixStencil(x, y, z), x, y, z);
+				break;
+
+			case MODE_INT:
+				for (int x = 0; x < width; x++)
+					dst.setPixel(src.getPixelInt(x, y, z), x, y, z);
+				break;
+
+			case MODE_FLOAT:
+				for (int x = 0; x < width; x++)
+					dst.setPixel(src.getPixel(x, y, z), x, y, z);
+				break;
+
+			default:
+				DE_ASSERT(false);
+		}
+	}
+
+private:
+	const Mode						m_mode;
+	const PixelBufferAccess			m_dst;
+	const ConstPixelBufferAccess	m_src;
+};
+
 void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 {
 	DE_ASSERT(src.getSize() == dst.getSize());
 
-	const int	width				= dst.getWidth();
-	const int	height				= dst.getHeight();
-	const int	depth				= dst.getDepth();
-
 	const int	srcPixelSize		= src.getFormat().getPixelSize();
 	const int	dstPixelSize		= dst.getFormat().getPixelSize();
 	const int	srcPixelPitch		= src.getPixelPitch();
@@ -1032,17 +1171,12 @@ void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 	if (src.getFormat() == dst.getFormat() && srcTightlyPacked && dstTightlyPacked)
 	{
 		// Fast-path for matching formats.
-		for (int z = 0; z < depth; z++)
-		for (int y = 0; y < height; y++)
-			deMemcpy(dst.getPixelPtr(0, y, z), src.getPixelPtr(0, y, z), srcPixelSize*width);
+		forEachRow(dst, PARALLEL_MIN_BYTES_PER_THREAD / srcPixelSize, CopyRowFunc(CopyRowFunc::MODE_MEMCPY_ROW, dst, src));
 	}
 	else if (src.getFormat() == dst.getFormat())
 	{
 		// Bit-exact copy for matching formats.
-		for (int z = 0; z < depth; z++)
-		for (int y = 0; y < height; y++)
-		for (int x = 0; x < width; x++)
-			deMemcpy(dst.getPixelPtr(x, y, z), src.getPixelPtr(x, y, z), srcPixelSize);
+		forEachRow(dst, PARALLEL_MIN_PIXELS_PER_THREAD, CopyRowFunc(CopyRowFunc::MODE_MEMCPY_PIXEL, dst, src));
 	}
 	else if (srcHasDepth || srcHasStencil || dstHasDepth || dstHasStencil)
 	{
@@ -1050,10 +1184,7 @@ void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 
 		if (dstHasDepth && srcHasDepth)
 		{
-			for (int z = 0; z < depth; z++)
-			for (int y = 0; y < height; y++)
-			for (int x = 0; x < width; x++)
-				dst.setPixDepth(src.getPixDepth(x, y, z), x, y, z);
+			forEachRow(dst, PARALLEL_MIN_PIXELS_PER_THREAD, CopyRowFunc(CopyRowFunc::MODE_DEPTH, dst, src));
 		}
 		else if (dstHasDepth && !srcHasDepth)
 		{
@@ -1063,10 +1194,7 @@ void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 
 		if (dstHasStencil && srcHasStencil)
 		{
-			for (int z = 0; z < depth; z++)
-			for (int y = 0; y < height; y++)
-			for (int x = 0; x < width; x++)
-				dst.setPixStencil(src.getPixStencil(x, y, z), x, y, z);
+			forEachRow(dst, PARALLEL_MIN_PIXELS_PER_THREAD, CopyRowFunc(CopyRowFunc::MODE_STENCIL, dst, src));
 		}
 		else if (dstHasStencil && !srcHasStencil)
 		{
@@ -1081,20 +1209,7 @@ void copy (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
 		bool					srcIsInt	= srcClass == TEXTURECHANNELCLASS_SIGNED_INTEGER || srcClass == TEXTURECHANNELCLASS_UNSIGNED_INTEGER;
 		bool					dstIsInt	= dstClass == TEXTURECHANNELCLASS_SIGNED_INTEGER || dstClass == TEXTURECHANNELCLASS_UNSIGNED_INTEGER;
 
-		if (srcIsInt && dstIsInt)
-		{
-			for (int z = 0; z < depth; z++)
-			for (int y = 0; y < height; y++)
-			for (int x = 0; x < width; x++)
-				dst.setPixel(src.getPixelInt(x, y, z), x, y, z);
-		}
-		else
-		{
-			for (int z = 0; z < depth; z++)
-			for (int y = 0; y < height; y++)
-			for (int x = 0; x < width; x++)
-				dst.setPixel(src.getPixel(x, y, z), x, y, z);
-		}
+		forEachRow(dst, PARALLEL_MIN_PIXELS_PER_THREAD, CopyRowFunc((srcIsInt && dstIsInt) ? CopyRowFunc::MODE_INT : CopyRowFunc::MODE_FLOAT, dst, src));
 	}
 }
 
@@ -1124,6 +1239,124 @@ void scale (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src, Sam
 	}
 }
 
+//! Box filters rows of dst (row index spans all slices) from src.
+class BoxFilterTask : public de::RangeTask
+{
+public:
+	BoxFilterTask (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
+		: m_dst		(dst)
+		, m_src		(src)
+		, m_isSRGB	(isSRGB(src.getFormat()))
+	{
+	}
+
+	void execute (int begin, int end)
+	{
+		const int			srcWidth	= m_src.getWidth();
+		std::vector<Vec4>	columnSums	((size_t)srcWidth);
+
+		for (int rowNdx = begin; rowNdx < end; rowNdx++)
+		{
+			const int	y			= rowNdx % m_dst.getHeight();
+			const int	z			= rowNdx / m_dst.getHeight();
+			const int	srcY0		= getFootprintBegin(y,		m_src.getHeight(),	m_dst.getHeight());
+			const int	srcY1		= getFootprintBegin(y+1,	m_src.getHeight(),	m_dst.getHeight());
+			const int	srcZ0		= getFootprintBegin(z,		m_src.getDepth(),	m_dst.getDepth());
+			const int	srcZ1		= getFootprintBegin(z+1,	m_src.getDepth(),	m_dst.getDepth());
+			const int	numRows		= (srcY1-srcY0)*(srcZ1-srcZ0);
+
+			std::fill(columnSums.begin(), columnSums.end(), Vec4(0.0f));
+
+			for (int srcZ = srcZ0; srcZ < srcZ1; srcZ++)
+			for (int srcY = srcY0; srcY < srcY1; srcY++)
+			{
+				for (int srcX = 0; srcX < srcWidth; srcX++)
+				{
+					const Vec4 color = m_src.getPixel(srcX, srcY, srcZ);
+					columnSums[srcX] += m_isSRGB ? sRGBToLinear(color) : color;
+				}
+			}
+
+			for (int x = 0; x < m_dst.getWidth(); x++)
+			{
+				const int	srcX0	= getFootprintBegin(x,		srcWidth, m_dst.getWidth());
+				const int	srcX1	= getFootprintBegin(x+1,	srcWidth, m_dst.getWidth());
+				Vec4		sum		(0.0f);
+
+				for (int srcX = srcX0; srcX < srcX1; srcX++)
+					sum += columnSums[srcX];
+
+				m_dst.setPixel(linearToSRGBIfNeeded(m_dst.getFormat(), sum / (float)(numRows*(srcX1-srcX0))), x, y, z);
+			}
+		}
+	}
+
+private:
+	//! First source texel covered by destination texel dstNdx.
+	static int getFootprintBegin (int dstNdx, int srcSize, int dstSize)
+	{
+		return (int)(((deInt64)dstNdx*srcSize) / dstSize);
+	}
+
+	const PixelBufferAccess			m_dst;
+	const ConstPixelBufferAccess	m_src;
+	const bool						m_isSRGB;
+};
+
+void boxFilter (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src)
+{
+	const TextureChannelClass	channelClass		= getTextureChannelClass(src.getFormat().type);
+	const int					numDstRows			= dst.getHeight()*dst.getDepth();
+	BoxFilterTask				task				(dst, src);
+
+	TCU_CHECK_INTERNAL(channelClass != TEXTURECHANNELCLASS_SIGNED_INTEGER && channelClass != TEXTURECHANNELCLASS_UNSIGNED_INTEGER);
+	TCU_CHECK_INTERNAL(!isCombinedDepthStencilType(src.getFormat().type) && !isCombinedDepthStencilType(dst.getFormat().type));
+	DE_ASSERT(de::inRange(dst.getWidth(), 1, src.getWidth()) && de::inRange(dst.getHeight(), 1, src.getHeight()) && de::inRange(dst.getDepth(), 1, src.getDepth()));
+
+	{
+		const int srcPixelsPerDstRow = de::max(1, src.getWidth()*src.getHeight()*src.getDepth() / numDstRows);
+
+		de::parallelFor(numDstRows, de::max(1, PARALLEL_MIN_PIXELS_PER_THREAD / srcPixelsPerDstRow), task);
+	}
+}
+
+template<typename TextureType>
+static void generateMipmapsImpl (TextureType& texture)
+{
+	DE_ASSERT(!texture.isLevelEmpty(0));
+
+	for (int levelNdx = 1; levelNdx < texture.getNumLevels(); levelNdx++)
+	{
+		if (texture.isLevelEmpty(levelNdx))
+			texture.allocLevel(levelNdx);
+
+		boxFilter(texture.getLevel(levelNdx), texture.getLevel(levelNdx-1));
+	}
+}
+
+void generateMipmaps (Texture1D& texture)			{ generateMipmapsImpl(texture); }
+void generateMipmaps (Texture2D& texture)			{ generateMipmapsImpl(texture); }
+void generateMipmaps (Texture3D& texture)			{ generateMipmapsImpl(texture); }
+void generateMipmaps (Texture1DArray& texture)		{ generateMipmapsImpl(texture); }
+void generateMipmaps (Texture2DArray& texture)		{ generateMipmapsImpl(texture); }
+void generateMipmaps (TextureCubeArray& texture)	{ generateMipmapsImpl(texture); }
+
+void generateMipmaps (TextureCube& texture)
+{
+	DE_ASSERT(!texture.isLevelEmpty(CUBEFACE_NEGATIVE_X, 0));
+
+	for (int face = 0; face < CUBEFACE_LAST; face++)
+	{
+		for (int levelNdx = 1; levelNdx < texture.getNumLevels(); levelNdx++)
+		{
+			if (texture.isLevelEmpty((CubeFace)face, levelNdx))
+				texture.allocLevel((CubeFace)face, levelNdx);
+
+			boxFilter(texture.getLevelFace(levelNdx, (CubeFace)face), texture.getLevelFace(levelNdx-1, (CubeFace)face));
+		}
+	}
+}
+
 void estimatePixelValueRange (const ConstPixelBufferAccess& access, Vec4& minVal, Vec4& maxVal)
 {
 	const TextureFormat& format = access.getFormat();
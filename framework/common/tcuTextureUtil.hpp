@@ -126,6 +126,20 @@ void	copy							(const PixelBufferAccess& dst, const ConstPixelBufferAccess& src
 
 void	scale							(const PixelBufferAccess& dst, const ConstPixelBufferAccess& src, Sampler::FilterMode filter);
 
+//! Box filters src into smaller dst. Each dst texel is the average of the src texels its footprint covers;
+//! sRGB values are averaged in linear space. Dimensions of equal size are not filtered, so array layers
+//! are filtered independently.
+void	boxFilter						(const PixelBufferAccess& dst, const ConstPixelBufferAccess& src);
+
+//! Allocates all levels and fills them by box filtering the previous level, starting from level 0.
+void	generateMipmaps					(Texture1D& texture);
+void	generateMipmaps					(Texture2D& texture);
+void	generateMipmaps					(Texture3D& texture);
+void	generateMipmaps					(TextureCube& texture);
+void	generateMipmaps					(Texture1DArray& texture);
+void	generateMipmaps					(Texture2DArray& texture);
+void	generateMipmaps					(TextureCubeArray& texture);
+
 void	estimatePixelValueRange			(const ConstPixelBufferAccess& access, Vec4& minVal, Vec4& maxVal);
 void	computePixelScaleBias			(const ConstPixelBufferAccess& access, Vec4& scale, Vec4& bias);
 
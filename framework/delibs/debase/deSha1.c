@@ -172,7 +172,11 @@ void deSha1Stream_finalize (deSha1Stream* stream, deSha1* hash)
 		if (spaceLeftInChunk >= 1 + sizeof(lengthData))
 			deSha1Stream_process(stream, (size_t)(spaceLeftInChunk - sizeof(lengthData)), padding);
 		else
-			deSha1Stream_process(stream, (size_t)(CHUNK_BYTE_SIZE - (sizeof(lengthData)) - spaceLeftInChunk), padding);
+		{
+			/* \note Length doesn't fit in current chunk, pad to end of the next chunk. */
+			deSha1Stream_process(stream, (size_t)spaceLeftInChunk, padding);
+			deSha1Stream_process(stream, (size_t)(CHUNK_BYTE_SIZE - sizeof(lengthData)), padding + 1);
+		}
 	}
 
 	deSha1Stream_process(stream, sizeof(lengthData), lengthData);
@@ -273,6 +277,9 @@ void deSha1_selfTest (void)
 		{ "aaf4c61ddcc5e8a2dabede0f3b482cd9aea9434d", "hello" },
 		{ "ec1919e856540f42bd0e6f6c1ffe2fbd73419975",
 			"Cherry is a browser-based GUI for controlling deqp test runs and analysing the test results."
+		},
+		{ "da6d3742a259adfdb1b9e9c17e610ec40441da7f",
+			"Test strings of 56 to 63 bytes need an extra padding chunk."
 		}
 	};
 
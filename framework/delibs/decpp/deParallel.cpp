@@ -0,0 +1,557 @@
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Data-parallel range execution.
+ *//*--------------------------------------------------------------------*/
+
+#include "deParallel.hpp"
+#include "deThread.hpp"
+#include "deMutex.hpp"
+#include "deSemaphore.hpp"
+#include "deUniquePtr.hpp"
+#include "deAtomic.h"
+#include "deInt32.h"
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <new>
+#include <exception>
+#include <stdexcept>
+
+namespace de
+{
+
+namespace
+{
+
+enum
+{
+	MAX_CAPTURE_FUNCS	= 8
+};
+
+static volatile deInt32		s_maxParallelThreads					= 0;
+static ExceptionCaptureFunc	s_captureFuncs[MAX_CAPTURE_FUNCS];
+static int					s_numCaptureFuncs						= 0;
+
+//! Must be called inside catch block.
+CapturedException* captureCurrentException (void)
+{
+	for (int funcNdx = s_numCaptureFuncs-1; funcNdx >= 0; funcNdx--)
+	{
+		CapturedException* const captured = s_captureFuncs[funcNdx]();
+
+		if (captured)
+			return captured;
+	}
+
+	try
+	{
+		throw;
+	}
+	catch (const std::bad_alloc& e)
+	{
+		return new CapturedExceptionT<std::bad_alloc>(e);
+	}
+	catch (const std::logic_error& e)
+	{
+		return new CapturedExceptionT<std::logic_error>(e);
+	}
+	catch (const std::runtime_error& e)
+	{
+		return new CapturedExceptionT<std::runtime_error>(e);
+	}
+	catch (const std::exception& e)
+	{
+		return new CapturedExceptionT<std::runtime_error>(std::runtime_error(e.what()));
+	}
+	catch (...)
+	{
+		return new CapturedExceptionT<std::runtime_error>(std::runtime_error("Unknown exception in parallelFor() worker"));
+	}
+}
+
+//! State of single parallelFor() call.
+class RangeJobGroup
+{
+public:
+	RangeJobGroup (int numChunks)
+		: m_doneSem		(0)
+		, m_errorNdx	(numChunks)
+		, m_error		(DE_NULL)
+	{
+	}
+
+	~RangeJobGroup (void)
+	{
+		delete m_error;
+	}
+
+	void finishChunk (int chunkNdx, CapturedException* error)
+	{
+		if (error)
+		{
+			const ScopedLock lock (m_lock);
+
+			// Keep exception from first chunk for deterministic results
+			if (chunkNdx < m_errorNdx)
+			{
+				delete m_error;
+				m_error		= error;
+				m_errorNdx	= chunkNdx;
+			}
+			else
+				delete error;
+		}
+
+		m_doneSem.increment();
+	}
+
+	Semaphore&					getDoneSemaphore	(void)			{ return m_doneSem;	}
+	const CapturedException*	getError			(void) const	{ return m_error;	}
+
+private:
+	Mutex						m_lock;
+	Semaphore					m_doneSem;		//!< Incremented once per finished chunk.
+	int							m_errorNdx;
+	CapturedException*			m_error;
+};
+
+struct RangeJob
+{
+	RangeTask*		task;
+	int				begin;
+	int				end;
+	int				chunkNdx;
+	RangeJobGroup*	group;
+};
+
+void executeJob (const RangeJob& job)
+{
+	CapturedException* error = DE_NULL;
+
+	try
+	{
+		job.task->execute(job.begin, job.end);
+	}
+	catch (...)
+	{
+		try
+		{
+			error = captureCurrentException();
+		}
+		catch (const std::bad_alloc& e)
+		{
+			error = new CapturedExceptionT<std::bad_alloc>(e);
+		}
+	}
+
+	job.group->finishChunk(job.chunkNdx, error);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Persistent pool of worker threads
+ *
+ * Threads are created on demand and kept until process exit. Queued jobs
+ * are executed by pool threads, or by threads waiting in parallelFor().
+ *//*--------------------------------------------------------------------*/
+class WorkerPool
+{
+public:
+							WorkerPool			(void);
+							~WorkerPool			(void);
+
+	//! Start more threads if pool has less than numThreads. Returns number of threads in pool.
+	int						reserveThreads		(int numThreads);
+
+	void					submit				(const RangeJob& job);
+
+	//! Execute one queued job on calling thread. Returns false if queue is empty.
+	bool					tryExecuteJob		(void);
+
+private:
+	class WorkerThread : public Thread
+	{
+	public:
+						WorkerThread	(WorkerPool& pool) : m_pool(pool) {}
+		void			run				(void) { m_pool.processJobs(); }
+
+	private:
+		WorkerPool&		m_pool;
+	};
+
+							WorkerPool			(const WorkerPool&);	// not allowed!
+	WorkerPool&				operator=			(const WorkerPool&);	// not allowed!
+
+	bool					popJob				(RangeJob& dst);
+	void					processJobs			(void);
+
+	Mutex					m_lock;
+	Semaphore				m_jobSem;			//!< Number of submitted jobs, plus one per thread on shutdown.
+	std::deque<RangeJob>	m_jobs;
+	std::vector<Thread*>	m_threads;
+	bool					m_isShutdown;
+};
+
+WorkerPool::WorkerPool (void)
+	: m_jobSem		(0)
+	, m_isShutdown	(false)
+{
+}
+
+WorkerPool::~WorkerPool (void)
+{
+	{
+		const ScopedLock lock (m_lock);
+		m_isShutdown = true;
+	}
+
+	for (size_t threadNdx = 0; threadNdx < m_threads.size(); threadNdx++)
+		m_jobSem.increment();
+
+	for (size_t threadNdx = 0; threadNdx < m_threads.size(); threadNdx++)
+	{
+		m_threads[threadNdx]->join();
+		delete m_threads[threadNdx];
+	}
+}
+
+int WorkerPool::reserveThreads (int numThreads)
+{
+	const ScopedLock lock (m_lock);
+
+	while ((int)m_threads.size() < numThreads)
+	{
+		try
+		{
+			MovePtr<Thread> thread (new WorkerThread(*this));
+
+			m_threads.reserve(m_threads.size()+1);
+			thread->start();
+			m_threads.push_back(thread.release());
+		}
+		catch (const std::exception&)
+		{
+			// Continue with existing threads, remaining jobs are executed by waiting callers
+			break;
+		}
+	}
+
+	return (int)m_threads.size();
+}
+
+void WorkerPool::submit (const RangeJob& job)
+{
+	{
+		const ScopedLock lock (m_lock);
+		m_jobs.push_back(job);
+	}
+
+	m_jobSem.increment();
+}
+
+bool WorkerPool::popJob (RangeJob& dst)
+{
+	const ScopedLock lock (m_lock);
+
+	if (m_jobs.empty())
+		return false;
+
+	dst = m_jobs.front();
+	m_jobs.pop_front();
+
+	return true;
+}
+
+bool WorkerPool::tryExecuteJob (void)
+{
+	RangeJob job;
+
+	if (!popJob(job))
+		return false;
+
+	executeJob(job);
+	return true;
+}
+
+void WorkerPool::processJobs (void)
+{
+	for (;;)
+	{
+		RangeJob job;
+
+		m_jobSem.decrement();
+
+		{
+			const ScopedLock lock (m_lock);
+
+			if (m_isShutdown)
+				return;
+		}
+
+		// Queue may be empty if job was taken by waiting caller
+		if (popJob(job))
+			executeJob(job);
+	}
+}
+
+static WorkerPool s_workerPool;
+
+} // anonymous
+
+void registerExceptionCapture (ExceptionCaptureFunc func)
+{
+	DE_ASSERT(func);
+
+	if (s_numCaptureFuncs >= MAX_CAPTURE_FUNCS)
+		throw std::logic_error("Too many exception capture functions");
+
+	s_captureFuncs[s_numCaptureFuncs++] = func;
+}
+
+int getMaxParallelThreads (void)
+{
+	const int maxThreads = s_maxParallelThreads;
+
+	if (maxThreads > 0)
+		return maxThreads;
+	else
+		return (int)deGetNumAvailableLogicalCores();
+}
+
+void setMaxParallelThreads (int maxThreads)
+{
+	DE_ASSERT(maxThreads >= 0);
+	s_maxParallelThreads = maxThreads;
+	deMemoryReadWriteFence();
+}
+
+void parallelFor (int numItems, int minItemsPerThread, RangeTask& task)
+{
+	DE_ASSERT(numItems >= 0 && minItemsPerThread > 0);
+
+	const int	maxThreads	= deMax32(getMaxParallelThreads(), 1);
+	const int	numChunks	= deMax32(deMin32(maxThreads, numItems / minItemsPerThread), 1);
+
+	if (numItems == 0)
+		return;
+
+	if (numChunks == 1)
+	{
+		task.execute(0, numItems);
+		return;
+	}
+
+	{
+		RangeJobGroup	group		(numChunks);
+		const int		chunkSize	= numItems / numChunks;
+		const int		remainder	= numItems % numChunks;
+
+		s_workerPool.reserveThreads(numChunks-1);
+
+		// Chunk 0 is executed on calling thread, remainder is distributed over first chunks
+		for (int chunkNdx = numChunks-1; chunkNdx >= 0; chunkNdx--)
+		{
+			RangeJob job;
+
+			job.task		= &task;
+			job.begin		= chunkNdx*chunkSize + deMin32(chunkNdx, remainder);
+			job.end			= job.begin + chunkSize + (chunkNdx < remainder ? 1 : 0);
+			job.chunkNdx	= chunkNdx;
+			job.group		= &group;
+
+			if (chunkNdx == 0)
+				executeJob(job);
+			else
+				s_workerPool.submit(job);
+		}
+
+		// Help with queued jobs instead of blocking, so that nested calls can't deadlock
+		for (int numFinished = 0; numFinished < numChunks; numFinished++)
+		{
+			while (!group.getDoneSemaphore().tryDecrement())
+			{
+				if (!s_workerPool.tryExecuteJob())
+				{
+					group.getDoneSemaphore().decrement();
+					break;
+				}
+			}
+		}
+
+		if (group.getError())
+			group.getError()->rethrow();
+	}
+}
+
+namespace
+{
+
+class FillRangeTask : public RangeTask
+{
+public:
+	FillRangeTask (std::vector<deUint32>& dst)
+		: m_dst(dst)
+	{
+	}
+
+	void execute (int begin, int end)
+	{
+		for (int ndx = begin; ndx < end; ndx++)
+			m_dst[ndx] += (deUint32)ndx + 1u;
+	}
+
+private:
+	std::vector<deUint32>&	m_dst;
+};
+
+class NestedRangeTask : public RangeTask
+{
+public:
+	NestedRangeTask (std::vector<deUint32>& dst, int rowSize)
+		: m_dst		(dst)
+		, m_rowSize	(rowSize)
+	{
+	}
+
+	void execute (int begin, int end)
+	{
+		for (int rowNdx = begin; rowNdx < end; rowNdx++)
+		{
+			std::vector<deUint32>	row		(m_rowSize, 0u);
+			FillRangeTask			task	(row);
+
+			parallelFor(m_rowSize, 1, task);
+
+			for (int ndx = 0; ndx < m_rowSize; ndx++)
+				m_dst[rowNdx*m_rowSize + ndx] = row[ndx];
+		}
+	}
+
+private:
+	std::vector<deUint32>&	m_dst;
+	const int				m_rowSize;
+};
+
+class ThrowingRangeTask : public RangeTask
+{
+public:
+	void execute (int begin, int end)
+	{
+		if (begin <= 7 && 7 < end)
+			throw std::runtime_error("fail");
+		if (begin <= 90 && 90 < end)
+			throw std::out_of_range("later failure");
+	}
+};
+
+class LogicErrorRangeTask : public RangeTask
+{
+public:
+	void execute (int begin, int end)
+	{
+		if (begin <= 90 && 90 < end)
+			throw std::out_of_range("fail");
+	}
+};
+
+void testFillRange (int numItems, int minItemsPerThread)
+{
+	std::vector<deUint32>	data	(numItems, 0u);
+	FillRangeTask			task	(data);
+
+	parallelFor(numItems, minItemsPerThread, task);
+
+	for (int ndx = 0; ndx < numItems; ndx++)
+		DE_TEST_ASSERT(data[ndx] == (deUint32)ndx + 1u);
+}
+
+} // anonymous
+
+void Parallel_selfTest (void)
+{
+	const int origMaxThreads = s_maxParallelThreads;
+
+	testFillRange(0, 1);
+	testFillRange(1, 1);
+	testFillRange(7, 1);
+	testFillRange(1000, 1);
+	testFillRange(1000, 64);
+	testFillRange(1001, 1000);
+	testFillRange(4097, 3);
+
+	setMaxParallelThreads(1);
+	testFillRange(1000, 1);
+
+	setMaxParallelThreads(3);
+	DE_TEST_ASSERT(getMaxParallelThreads() == 3);
+	testFillRange(1000, 1);
+
+	// Nested calls
+	{
+		const int				numRows		= 16;
+		const int				rowSize		= 100;
+		std::vector<deUint32>	data		(numRows*rowSize, 0u);
+		NestedRangeTask			task		(data, rowSize);
+
+		parallelFor(numRows, 1, task);
+
+		for (int ndx = 0; ndx < numRows*rowSize; ndx++)
+			DE_TEST_ASSERT(data[ndx] == (deUint32)(ndx % rowSize) + 1u);
+	}
+
+	// Exception from first failing chunk is rethrown
+	{
+		ThrowingRangeTask	task;
+		bool				caught	= false;
+
+		try
+		{
+			parallelFor(100, 1, task);
+		}
+		catch (const std::runtime_error& e)
+		{
+			caught = std::string(e.what()) == "fail";
+		}
+
+		DE_TEST_ASSERT(caught);
+	}
+
+	// Exception type is preserved
+	{
+		LogicErrorRangeTask	task;
+		bool				caught	= false;
+
+		try
+		{
+			parallelFor(100, 1, task);
+		}
+		catch (const std::logic_error&)
+		{
+			caught = true;
+		}
+
+		DE_TEST_ASSERT(caught);
+	}
+
+	setMaxParallelThreads(origMaxThreads);
+}
+
+} // de
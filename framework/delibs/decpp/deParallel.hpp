@@ -0,0 +1,101 @@
+#ifndef _DEPARALLEL_HPP
+#define _DEPARALLEL_HPP
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Data-parallel range execution.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+
+namespace de
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Work item range task
+ *
+ * execute() is called with disjoint [begin, end) sub-ranges, possibly
+ * concurrently from multiple threads. Implementations must only touch
+ * data owned by the given sub-range.
+ *//*--------------------------------------------------------------------*/
+class RangeTask
+{
+public:
+	virtual			~RangeTask		(void) {}
+	virtual void	execute			(int begin, int end) = 0;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Exception transported from worker thread to calling thread
+ *//*--------------------------------------------------------------------*/
+class CapturedException
+{
+public:
+	virtual			~CapturedException	(void) {}
+	virtual void	rethrow				(void) const = 0;
+};
+
+template<typename T>
+class CapturedExceptionT : public CapturedException
+{
+public:
+	explicit		CapturedExceptionT	(const T& exception) : m_exception(exception) {}
+	void			rethrow				(void) const { throw m_exception; }
+
+private:
+	const T			m_exception;
+};
+
+//! Called inside catch block. Returns DE_NULL if type of current exception is not known to the function.
+typedef CapturedException* (*ExceptionCaptureFunc) (void);
+
+//! Register capture function for exception types defined outside de.
+//! Functions registered later are tried first. Must be called before
+//! parallelFor() is used from multiple threads, e.g. from static initializers.
+void	registerExceptionCapture	(ExceptionCaptureFunc func);
+
+//! Get maximum number of threads used by parallelFor().
+int		getMaxParallelThreads		(void);
+
+//! Limit number of threads used by parallelFor(). 1 forces serial execution,
+//! 0 restores default (number of available logical cores).
+void	setMaxParallelThreads		(int maxThreads);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Execute task over range [0, numItems)
+ *
+ * Splits range into contiguous chunks of at least minItemsPerThread
+ * items and executes them on a persistent pool of worker threads.
+ * Calling thread executes the first chunk, and while waiting executes
+ * queued chunks, so parallelFor() may be called from within a task.
+ * Small ranges are executed directly on the calling thread.
+ *
+ * If any chunk throws, exception from the first failing chunk is
+ * rethrown once all chunks have finished. Standard exception types and
+ * types known to registered capture functions keep their type, other
+ * exceptions are rethrown as std::runtime_error.
+ *//*--------------------------------------------------------------------*/
+void	parallelFor					(int numItems, int minItemsPerThread, RangeTask& task);
+
+void	Parallel_selfTest			(void);
+
+} // de
+
+#endif // _DEPARALLEL_HPP
@@ -44,6 +44,16 @@ Sha1 Sha1::compute (size_t size, const void* data)
 	return Sha1(hash);
 }
 
+std::string Sha1::toString (void) const
+{
+	char buffer[41];
+
+	deSha1_render(&m_hash, buffer);
+	buffer[40] = '\0';
+
+	return std::string(buffer);
+}
+
 Sha1Stream::Sha1Stream (void)
 {
 	deSha1Stream_init(&m_stream);
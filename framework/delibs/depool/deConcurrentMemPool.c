@@ -0,0 +1,538 @@
+/*-------------------------------------------------------------------------
+ * drawElements Memory Pool Library
+ * --------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Thread-safe memory pool.
+ *//*--------------------------------------------------------------------*/
+
+#include "deConcurrentMemPool.h"
+#include "deMemory.h"
+#include "deInt32.h"
+#include "deAtomic.h"
+
+#include <string.h>
+
+enum
+{
+	CACHE_INITIAL_PAGE_SIZE		= 1024,			/*!< Size for the first page allocated by a cache.		*/
+	CACHE_MAX_PAGE_SIZE			= 65536,		/*!< Maximum size for a cache memory page.				*/
+	CACHE_PAGE_BASE_ALIGN		= 4,			/*!< Base alignment guarantee for page data ptr.		*/
+	CACHE_MAX_ALLOC_SIZE		= 0x3fffffff	/*!< Page capacity is stored as int.					*/
+};
+
+typedef struct CachePage_s CachePage;
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Memory page header.
+ *//*--------------------------------------------------------------------*/
+struct CachePage_s
+{
+	int			capacity;
+	int			bytesAllocated;
+
+	CachePage*	nextPage;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Page cache.
+ *
+ * Only the thread that has acquired the cache touches currentPage. The
+ * inUse flag is updated with CAS which also acts as the memory barrier
+ * that publishes page list changes to the next owner.
+ *//*--------------------------------------------------------------------*/
+struct deMemPoolCache_s
+{
+	deConcurrentMemPool*	pool;			/*!< Pool that owns the cache.								*/
+	deMemPoolCache*			nextCache;		/*!< Next cache in pool's list (immutable once published).	*/
+	volatile deUint32		inUse;			/*!< Non-zero if cache is currently acquired.				*/
+	CachePage*				currentPage;	/*!< Current page, head of page list.						*/
+};
+
+struct deConcurrentMemPool_s
+{
+	deBool						hasUtil;		/*!< Is util valid?						*/
+	deMemPoolUtil				util;			/*!< Utilities (callbacks etc.).		*/
+	deMemPoolCache* volatile	firstCache;		/*!< Lock-free list of all caches.		*/
+	volatile deUint32			numCaches;		/*!< Number of caches in list.			*/
+};
+
+static CachePage* CachePage_create (size_t capacity)
+{
+	CachePage* page = (CachePage*)deMalloc(sizeof(CachePage) + capacity);
+	if (!page)
+		return DE_NULL;
+
+	DE_ASSERT(deIsAlignedPtr(page+1, CACHE_PAGE_BASE_ALIGN));
+
+	memset(page, 0, sizeof(CachePage));
+#if defined(DE_DEBUG)
+	memset(page + 1, 0xCD, capacity);
+#endif
+	page->capacity = (int)capacity;
+
+	return page;
+}
+
+static void CachePage_destroy (CachePage* page)
+{
+#if defined(DE_DEBUG)
+	/* Fill with garbage to hopefully catch dangling pointer bugs easier. */
+	memset(page + 1, 0xCD, (size_t)page->capacity);
+#endif
+	deFree(page);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a new thread-safe memory pool.
+ * \param util	Utilities (may be null).
+ * \return The created memory pool (or null on failure).
+ *//*--------------------------------------------------------------------*/
+deConcurrentMemPool* deConcurrentMemPool_create (const deMemPoolUtil* util)
+{
+	deConcurrentMemPool* pool = DE_NEW(deConcurrentMemPool);
+	if (!pool)
+		return DE_NULL;
+
+	memset(pool, 0, sizeof(deConcurrentMemPool));
+
+	if (util)
+	{
+		DE_ASSERT(util->allocFailCallback);
+		pool->hasUtil	= DE_TRUE;
+		pool->util		= *util;
+	}
+
+	return pool;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Destroy a thread-safe memory pool.
+ * \param pool	Pool to be destroyed.
+ *
+ * Frees all memory allocated from the pool. Must not be called while
+ * other threads are still using the pool, and all caches should have
+ * been released.
+ *//*--------------------------------------------------------------------*/
+void deConcurrentMemPool_destroy (deConcurrentMemPool* pool)
+{
+	deMemPoolCache* cache;
+
+	DE_ASSERT(pool);
+
+	cache = pool->firstCache;
+	while (cache)
+	{
+		deMemPoolCache*	nextCache	= cache->nextCache;
+		CachePage*		page		= cache->currentPage;
+
+		DE_ASSERT(!cache->inUse);
+
+		while (page)
+		{
+			CachePage* nextPage = page->nextPage;
+			CachePage_destroy(page);
+			page = nextPage;
+		}
+
+		deFree(cache);
+		cache = nextCache;
+	}
+
+	deFree(pool);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Acquire page cache for exclusive use by calling thread.
+ * \param pool	Memory pool.
+ * \return Page cache (or null on failure).
+ *
+ * Returns a previously released cache if one is available, otherwise
+ * a new cache is created. The cache must be released with
+ * deConcurrentMemPool_releaseCache() before it can be used by another
+ * thread. Memory allocated from the cache remains valid until the pool
+ * is destroyed.
+ *//*--------------------------------------------------------------------*/
+deMemPoolCache* deConcurrentMemPool_acquireCache (deConcurrentMemPool* pool)
+{
+	deMemPoolCache* cache;
+
+	DE_ASSERT(pool);
+
+	/* Try to claim released cache. Caches are never removed from list so traversal is safe. */
+	for (cache = (deMemPoolCache*)deAtomicCompareExchangePtr((void* volatile*)&pool->firstCache, DE_NULL, DE_NULL); cache; cache = cache->nextCache)
+	{
+		if (!cache->inUse && deAtomicCompareExchangeUint32(&cache->inUse, 0u, 1u) == 0u)
+			return cache;
+	}
+
+	cache = DE_NEW(deMemPoolCache);
+	if (!cache)
+	{
+		if (pool->hasUtil)
+			pool->util.allocFailCallback(pool->util.userPointer);
+		return DE_NULL;
+	}
+
+	cache->pool			= pool;
+	cache->inUse		= 1u;
+	cache->currentPage	= DE_NULL;
+
+	/* Push to list head. */
+	for (;;)
+	{
+		deMemPoolCache* const head = pool->firstCache;
+
+		cache->nextCache = head;
+
+		if (deAtomicCompareExchangePtr((void* volatile*)&pool->firstCache, head, cache) == head)
+			break;
+	}
+
+	deAtomicIncrementUint32(&pool->numCaches);
+
+	return cache;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Release page cache.
+ * \param pool	Memory pool.
+ * \param cache	Page cache acquired from pool.
+ *//*--------------------------------------------------------------------*/
+void deConcurrentMemPool_releaseCache (deConcurrentMemPool* pool, deMemPoolCache* cache)
+{
+	deUint32 prevState;
+
+	DE_ASSERT(pool && cache);
+	DE_UNREF(pool);
+
+	prevState = deAtomicCompareExchangeUint32(&cache->inUse, 1u, 0u);
+	DE_ASSERT(prevState == 1u);
+	DE_UNREF(prevState);
+}
+
+DE_INLINE void* deMemPoolCache_allocInternal (deMemPoolCache* cache, size_t numBytes, deUint32 alignBytes)
+{
+	CachePage* curPage = cache->currentPage;
+
+	DE_ASSERT(cache->inUse);
+	DE_ASSERT(deIsPowerOfTwo32((int)alignBytes));
+
+	if (numBytes > (size_t)CACHE_MAX_ALLOC_SIZE || alignBytes > (deUint32)CACHE_MAX_ALLOC_SIZE)
+		return DE_NULL;
+
+	if (curPage)
+	{
+		void*	curPagePtr		= (void*)((deUint8*)(curPage + 1) + curPage->bytesAllocated);
+		void*	alignedPtr		= deAlignPtr(curPagePtr, alignBytes);
+		size_t	alignPadding	= (size_t)((deUintptr)alignedPtr - (deUintptr)curPagePtr);
+
+		if (numBytes + alignPadding <= (size_t)(curPage->capacity - curPage->bytesAllocated))
+		{
+			curPage->bytesAllocated += (int)(numBytes + alignPadding);
+			return alignedPtr;
+		}
+	}
+
+	/* Does not fit to current page. */
+	{
+		const int	prevCapacity		= curPage ? curPage->capacity : CACHE_INITIAL_PAGE_SIZE/2;
+		const int	maxAlignPadding		= deMax32(0, ((int)alignBytes)-CACHE_PAGE_BASE_ALIGN);
+		const int	newPageCapacity		= deMax32(deMin32(2*prevCapacity, CACHE_MAX_PAGE_SIZE), ((int)numBytes)+maxAlignPadding);
+		CachePage*	newPage				= CachePage_create((size_t)newPageCapacity);
+		void*		alignedPtr;
+
+		if (!newPage)
+			return DE_NULL;
+
+		alignedPtr = deAlignPtr((void*)(newPage + 1), alignBytes);
+
+		newPage->bytesAllocated	= (int)(numBytes + (size_t)((deUintptr)alignedPtr - (deUintptr)(newPage + 1)));
+		DE_ASSERT(newPage->bytesAllocated <= newPage->capacity);
+
+		/* Keep allocating from larger of the pages; oversized single allocations don't replace current page. */
+		if (curPage && (curPage->capacity - curPage->bytesAllocated) > (newPage->capacity - newPage->bytesAllocated))
+		{
+			newPage->nextPage	= curPage->nextPage;
+			curPage->nextPage	= newPage;
+		}
+		else
+		{
+			newPage->nextPage	= curPage;
+			cache->currentPage	= newPage;
+		}
+
+		return alignedPtr;
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Allocate memory from a page cache.
+ * \param cache		Page cache acquired by calling thread.
+ * \param numBytes	Number of bytes to allocate.
+ * \return Pointer to the allocated memory (or null on failure).
+ *//*--------------------------------------------------------------------*/
+void* deMemPoolCache_alloc (deMemPoolCache* cache, size_t numBytes)
+{
+	void* ptr;
+	DE_ASSERT(cache);
+	DE_ASSERT(numBytes > 0);
+	ptr = deMemPoolCache_allocInternal(cache, numBytes, DE_POOL_DEFAULT_ALLOC_ALIGNMENT);
+	if (!ptr && cache->pool->hasUtil)
+		cache->pool->util.allocFailCallback(cache->pool->util.userPointer);
+	return ptr;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Allocate aligned memory from a page cache.
+ * \param cache			Page cache acquired by calling thread.
+ * \param numBytes		Number of bytes to allocate.
+ * \param alignBytes	Required alignment in bytes, must be power of two.
+ * \return Pointer to the allocated memory (or null on failure).
+ *//*--------------------------------------------------------------------*/
+void* deMemPoolCache_alignedAlloc (deMemPoolCache* cache, size_t numBytes, deUint32 alignBytes)
+{
+	void* ptr;
+	DE_ASSERT(cache);
+	DE_ASSERT(numBytes > 0);
+	ptr = deMemPoolCache_allocInternal(cache, numBytes, alignBytes);
+	DE_ASSERT(deIsAlignedPtr(ptr, alignBytes));
+	if (!ptr && cache->pool->hasUtil)
+		cache->pool->util.allocFailCallback(cache->pool->util.userPointer);
+	return ptr;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Allocate aligned memory from a thread-safe pool.
+ * \param pool			Memory pool to allocate from.
+ * \param numBytes		Number of bytes to allocate.
+ * \param alignBytes	Required alignment in bytes, must be power of two.
+ * \return Pointer to the allocated memory (or null on failure).
+ *
+ * Acquires a cache for the duration of the allocation. Threads making
+ * many allocations should acquire a cache once and allocate from it
+ * directly instead.
+ *//*--------------------------------------------------------------------*/
+void* deConcurrentMemPool_alignedAlloc (deConcurrentMemPool* pool, size_t numBytes, deUint32 alignBytes)
+{
+	deMemPoolCache*	cache	= deConcurrentMemPool_acquireCache(pool);
+	void*			ptr;
+
+	if (!cache)
+		return DE_NULL;
+
+	/* Failure callback is called by cache. */
+	ptr = deMemPoolCache_alignedAlloc(cache, numBytes, alignBytes);
+	deConcurrentMemPool_releaseCache(pool, cache);
+
+	return ptr;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Allocate memory from a thread-safe pool.
+ * \param pool		Memory pool to allocate from.
+ * \param numBytes	Number of bytes to allocate.
+ * \return Pointer to the allocated memory (or null on failure).
+ *//*--------------------------------------------------------------------*/
+void* deConcurrentMemPool_alloc (deConcurrentMemPool* pool, size_t numBytes)
+{
+	return deConcurrentMemPool_alignedAlloc(pool, numBytes, DE_POOL_DEFAULT_ALLOC_ALIGNMENT);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get number of page caches created for pool.
+ *//*--------------------------------------------------------------------*/
+int deConcurrentMemPool_getNumCaches (const deConcurrentMemPool* pool)
+{
+	DE_ASSERT(pool);
+	return (int)pool->numCaches;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get total number of bytes allocated from pool.
+ *
+ * Must not be called while allocations are made from the pool.
+ *//*--------------------------------------------------------------------*/
+int deConcurrentMemPool_getNumAllocatedBytes (const deConcurrentMemPool* pool)
+{
+	const deMemPoolCache*	cache;
+	int						numAllocatedBytes	= 0;
+
+	DE_ASSERT(pool);
+
+	for (cache = pool->firstCache; cache; cache = cache->nextCache)
+	{
+		const CachePage* page;
+		for (page = cache->currentPage; page; page = page->nextPage)
+			numAllocatedBytes += page->bytesAllocated;
+	}
+
+	return numAllocatedBytes;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get total capacity of pages allocated by pool.
+ *
+ * Must not be called while allocations are made from the pool.
+ *//*--------------------------------------------------------------------*/
+int deConcurrentMemPool_getCapacity (const deConcurrentMemPool* pool)
+{
+	const deMemPoolCache*	cache;
+	int						numCapacityBytes	= 0;
+
+	DE_ASSERT(pool);
+
+	for (cache = pool->firstCache; cache; cache = cache->nextCache)
+	{
+		const CachePage* page;
+		for (page = cache->currentPage; page; page = page->nextPage)
+			numCapacityBytes += page->capacity;
+	}
+
+	return numCapacityBytes;
+}
+
+/* Self-test. */
+
+static void fillAndCheck (deUint8* ptr, size_t numBytes, deUint8 value)
+{
+	size_t ndx;
+
+	for (ndx = 0; ndx < numBytes; ndx++)
+		ptr[ndx] = value;
+
+	for (ndx = 0; ndx < numBytes; ndx++)
+		DE_TEST_ASSERT(ptr[ndx] == value);
+}
+
+static void countAllocFail (void* userPtr)
+{
+	*(int*)userPtr += 1;
+}
+
+void deConcurrentMemPool_selfTest (void)
+{
+	/* Cache reuse. */
+	{
+		deConcurrentMemPool*	pool	= deConcurrentMemPool_create(DE_NULL);
+		deMemPoolCache*			cacheA;
+		deMemPoolCache*			cacheB;
+
+		DE_TEST_ASSERT(pool);
+		DE_TEST_ASSERT(deConcurrentMemPool_getNumCaches(pool) == 0);
+		DE_TEST_ASSERT(deConcurrentMemPool_getCapacity(pool) == 0);
+
+		cacheA	= deConcurrentMemPool_acquireCache(pool);
+		cacheB	= deConcurrentMemPool_acquireCache(pool);
+
+		DE_TEST_ASSERT(cacheA && cacheB && cacheA != cacheB);
+		DE_TEST_ASSERT(deConcurrentMemPool_getNumCaches(pool) == 2);
+
+		deConcurrentMemPool_releaseCache(pool, cacheA);
+		DE_TEST_ASSERT(deConcurrentMemPool_acquireCache(pool) == cacheA);
+
+		deConcurrentMemPool_releaseCache(pool, cacheB);
+		DE_TEST_ASSERT(deConcurrentMemPool_alloc(pool, 16) != DE_NULL);
+		DE_TEST_ASSERT(deConcurrentMemPool_getNumCaches(pool) == 2);
+
+		deConcurrentMemPool_releaseCache(pool, cacheA);
+		deConcurrentMemPool_destroy(pool);
+	}
+
+	/* Allocation failures are reported through pool utilities. */
+	{
+		int						numFails	= 0;
+		deMemPoolUtil			util;
+		deConcurrentMemPool*	pool;
+		deMemPoolCache*			cache;
+
+		util.allocFailCallback	= countAllocFail;
+		util.userPointer		= &numFails;
+
+		pool	= deConcurrentMemPool_create(&util);
+		DE_TEST_ASSERT(pool);
+		cache	= deConcurrentMemPool_acquireCache(pool);
+		DE_TEST_ASSERT(cache);
+
+		DE_TEST_ASSERT(deMemPoolCache_alloc(cache, (size_t)CACHE_MAX_ALLOC_SIZE + 1) == DE_NULL);
+		DE_TEST_ASSERT(numFails == 1);
+		DE_TEST_ASSERT(deMemPoolCache_alignedAlloc(cache, (size_t)CACHE_MAX_ALLOC_SIZE + 1, 16) == DE_NULL);
+		DE_TEST_ASSERT(numFails == 2);
+		DE_TEST_ASSERT(deMemPoolCache_alloc(cache, 16) != DE_NULL);
+		DE_TEST_ASSERT(numFails == 2);
+
+		deConcurrentMemPool_releaseCache(pool, cache);
+
+		DE_TEST_ASSERT(deConcurrentMemPool_alloc(pool, (size_t)CACHE_MAX_ALLOC_SIZE + 1) == DE_NULL);
+		DE_TEST_ASSERT(numFails == 3);
+
+		deConcurrentMemPool_destroy(pool);
+	}
+
+	/* Interleaved allocations from multiple caches must not overlap. */
+	{
+		enum { NUM_CACHES = 3, NUM_ALLOCS = 300 };
+
+		deConcurrentMemPool*	pool			= deConcurrentMemPool_create(DE_NULL);
+		deMemPoolCache*			caches[NUM_CACHES];
+		deUint8*				ptrs[NUM_ALLOCS];
+		size_t					sizes[NUM_ALLOCS];
+		int						totalBytes		= 0;
+		int						ndx;
+
+		DE_TEST_ASSERT(pool);
+
+		for (ndx = 0; ndx < NUM_CACHES; ndx++)
+			caches[ndx] = deConcurrentMemPool_acquireCache(pool);
+
+		for (ndx = 0; ndx < NUM_ALLOCS; ndx++)
+		{
+			const deUint32	alignBytes	= 1u << (ndx % 7);
+			deMemPoolCache*	cache		= caches[ndx % NUM_CACHES];
+
+			/* Mix in allocations that exceed maximum page size. */
+			sizes[ndx]	= (ndx % 61 == 0) ? (size_t)(CACHE_MAX_PAGE_SIZE + ndx) : (size_t)(1 + (ndx * 37) % 200);
+			ptrs[ndx]	= (deUint8*)deMemPoolCache_alignedAlloc(cache, sizes[ndx], alignBytes);
+
+			DE_TEST_ASSERT(ptrs[ndx]);
+			DE_TEST_ASSERT(deIsAlignedPtr(ptrs[ndx], alignBytes));
+
+			memset(ptrs[ndx], (deUint8)ndx, sizes[ndx]);
+			totalBytes += (int)sizes[ndx];
+		}
+
+		for (ndx = 0; ndx < NUM_ALLOCS; ndx++)
+		{
+			size_t byteNdx;
+			for (byteNdx = 0; byteNdx < sizes[ndx]; byteNdx++)
+				DE_TEST_ASSERT(ptrs[ndx][byteNdx] == (deUint8)ndx);
+		}
+
+		fillAndCheck((deUint8*)deMemPoolCache_alloc(caches[0], 4096), 4096, 0xAA);
+
+		DE_TEST_ASSERT(deConcurrentMemPool_getNumAllocatedBytes(pool) >= totalBytes + 4096);
+		DE_TEST_ASSERT(deConcurrentMemPool_getCapacity(pool) >= deConcurrentMemPool_getNumAllocatedBytes(pool));
+
+		for (ndx = 0; ndx < NUM_CACHES; ndx++)
+			deConcurrentMemPool_releaseCache(pool, caches[ndx]);
+
+		deConcurrentMemPool_destroy(pool);
+	}
+}
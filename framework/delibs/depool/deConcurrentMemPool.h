@@ -0,0 +1,67 @@
+#ifndef _DECONCURRENTMEMPOOL_H
+#define _DECONCURRENTMEMPOOL_H
+/*-------------------------------------------------------------------------
+ * drawElements Memory Pool Library
+ * --------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Thread-safe memory pool.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+#include "deMemPool.h"
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Thread-safe memory pool.
+ *
+ * Allocations are made from page caches. Each cache is owned by at most
+ * one thread at a time and allocates from its own page list without any
+ * synchronization. Caches are acquired and released with lock-free
+ * operations and released caches are reused by subsequently acquiring
+ * threads, so a pool can be shared by a set of worker threads without
+ * growing the number of caches beyond the peak number of concurrent users.
+ *
+ * As with deMemPool, individual allocations are never freed. All memory
+ * is released at once when the pool is destroyed.
+ *//*--------------------------------------------------------------------*/
+typedef struct deConcurrentMemPool_s	deConcurrentMemPool;
+typedef struct deMemPoolCache_s			deMemPoolCache;
+
+DE_BEGIN_EXTERN_C
+
+deConcurrentMemPool*	deConcurrentMemPool_create					(const deMemPoolUtil* util);
+void					deConcurrentMemPool_destroy					(deConcurrentMemPool* pool);
+
+deMemPoolCache*			deConcurrentMemPool_acquireCache			(deConcurrentMemPool* pool);
+void					deConcurrentMemPool_releaseCache			(deConcurrentMemPool* pool, deMemPoolCache* cache);
+
+void*					deConcurrentMemPool_alloc					(deConcurrentMemPool* pool, size_t numBytes);
+void*					deConcurrentMemPool_alignedAlloc			(deConcurrentMemPool* pool, size_t numBytes, deUint32 alignBytes);
+
+int						deConcurrentMemPool_getNumCaches			(const deConcurrentMemPool* pool);
+int						deConcurrentMemPool_getNumAllocatedBytes	(const deConcurrentMemPool* pool);
+int						deConcurrentMemPool_getCapacity				(const deConcurrentMemPool* pool);
+
+void*					deMemPoolCache_alloc						(deMemPoolCache* cache, size_t numBytes);
+void*					deMemPoolCache_alignedAlloc					(deMemPoolCache* cache, size_t numBytes, deUint32 alignBytes);
+
+void					deConcurrentMemPool_selfTest				(void);
+
+DE_END_EXTERN_C
+
+#endif /* _DECONCURRENTMEMPOOL_H */
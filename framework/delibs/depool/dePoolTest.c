@@ -29,6 +29,9 @@
 #include "dePoolHashSet.h"
 #include "dePoolHashArray.h"
 #include "dePoolMultiSet.h"
+#include "deConcurrentMemPool.h"
+#include "deMemory.h"
+#include "deInt32.h"
 
 void	dePool_selfTest		(void)
 {
@@ -40,3 +43,125 @@ void	dePool_selfTest		(void)
 	dePoolHashArray_selfTest();
 	dePoolMultiSet_selfTest();
 }
+
+const char* dePool_getBenchmarkAllocatorName (dePoolBenchmarkAllocator allocator)
+{
+	switch (allocator)
+	{
+		case DE_POOL_BENCHMARK_ALLOCATOR_MEM_POOL:						return "deMemPool";
+		case DE_POOL_BENCHMARK_ALLOCATOR_CONCURRENT_MEM_POOL:			return "deConcurrentMemPool (cache)";
+		case DE_POOL_BENCHMARK_ALLOCATOR_CONCURRENT_MEM_POOL_SHARED:	return "deConcurrentMemPool (shared)";
+		case DE_POOL_BENCHMARK_ALLOCATOR_SYSTEM:						return "deMalloc";
+		default:
+			DE_ASSERT(DE_FALSE);
+			return DE_NULL;
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Run allocation throughput benchmark workload
+ * \param allocator	Allocator to benchmark
+ * \param numAllocs	Number of allocations to make
+ * \return Checksum over touched memory (to keep workload from being optimized out)
+ *
+ * Makes numAllocs allocations of 8 to 256 bytes and releases all of them
+ * at the end. Pools are released with a single destroy call, deMalloc()
+ * allocations are freed individually. Caller is responsible for timing.
+ *//*--------------------------------------------------------------------*/
+deUint32 dePool_runAllocBenchmark (dePoolBenchmarkAllocator allocator, int numAllocs)
+{
+	deUint32	checksum	= 0;
+	deUint32	state		= 0x12345678u;
+	int			ndx;
+
+#define NEXT_ALLOC_SIZE() (state = state*1664525u + 1013904223u, (size_t)(8u + ((state >> 16) & 0xf8u)))
+
+	DE_ASSERT(numAllocs >= 0);
+
+	switch (allocator)
+	{
+		case DE_POOL_BENCHMARK_ALLOCATOR_MEM_POOL:
+		{
+			deMemPool* pool = deMemPool_createRoot(DE_NULL, 0);
+			DE_TEST_ASSERT(pool);
+
+			for (ndx = 0; ndx < numAllocs; ndx++)
+			{
+				deUint8* ptr = (deUint8*)deMemPool_alloc(pool, NEXT_ALLOC_SIZE());
+				DE_TEST_ASSERT(ptr);
+				*ptr = (deUint8)ndx;
+				checksum += *ptr;
+			}
+
+			deMemPool_destroy(pool);
+			break;
+		}
+
+		case DE_POOL_BENCHMARK_ALLOCATOR_CONCURRENT_MEM_POOL:
+		{
+			deConcurrentMemPool*	pool	= deConcurrentMemPool_create(DE_NULL);
+			deMemPoolCache*			cache;
+
+			DE_TEST_ASSERT(pool);
+			cache = deConcurrentMemPool_acquireCache(pool);
+			DE_TEST_ASSERT(cache);
+
+			for (ndx = 0; ndx < numAllocs; ndx++)
+			{
+				deUint8* ptr = (deUint8*)deMemPoolCache_alloc(cache, NEXT_ALLOC_SIZE());
+				DE_TEST_ASSERT(ptr);
+				*ptr = (deUint8)ndx;
+				checksum += *ptr;
+			}
+
+			deConcurrentMemPool_releaseCache(pool, cache);
+			deConcurrentMemPool_destroy(pool);
+			break;
+		}
+
+		case DE_POOL_BENCHMARK_ALLOCATOR_CONCURRENT_MEM_POOL_SHARED:
+		{
+			deConcurrentMemPool* pool = deConcurrentMemPool_create(DE_NULL);
+			DE_TEST_ASSERT(pool);
+
+			for (ndx = 0; ndx < numAllocs; ndx++)
+			{
+				deUint8* ptr = (deUint8*)deConcurrentMemPool_alloc(pool, NEXT_ALLOC_SIZE());
+				DE_TEST_ASSERT(ptr);
+				*ptr = (deUint8)ndx;
+				checksum += *ptr;
+			}
+
+			deConcurrentMemPool_destroy(pool);
+			break;
+		}
+
+		case DE_POOL_BENCHMARK_ALLOCATOR_SYSTEM:
+		{
+			deUint8** ptrs = (deUint8**)deMalloc(sizeof(deUint8*) * (size_t)deMax32(numAllocs, 1));
+			DE_TEST_ASSERT(ptrs);
+
+			for (ndx = 0; ndx < numAllocs; ndx++)
+			{
+				deUint8* ptr = (deUint8*)deMalloc(NEXT_ALLOC_SIZE());
+				DE_TEST_ASSERT(ptr);
+				*ptr = (deUint8)ndx;
+				checksum += *ptr;
+				ptrs[ndx] = ptr;
+			}
+
+			for (ndx = 0; ndx < numAllocs; ndx++)
+				deFree(ptrs[ndx]);
+
+			deFree(ptrs);
+			break;
+		}
+
+		default:
+			DE_ASSERT(DE_FALSE);
+	}
+
+#undef NEXT_ALLOC_SIZE
+
+	return checksum;
+}
@@ -25,6 +25,23 @@
 
 #include "deDefs.h"
 
-void	dePool_selfTest		(void);
+typedef enum dePoolBenchmarkAllocator_e
+{
+	DE_POOL_BENCHMARK_ALLOCATOR_MEM_POOL = 0,				/*!< deMemPool_alloc()									*/
+	DE_POOL_BENCHMARK_ALLOCATOR_CONCURRENT_MEM_POOL,		/*!< deMemPoolCache_alloc() from single acquired cache	*/
+	DE_POOL_BENCHMARK_ALLOCATOR_CONCURRENT_MEM_POOL_SHARED,	/*!< deConcurrentMemPool_alloc()						*/
+	DE_POOL_BENCHMARK_ALLOCATOR_SYSTEM,						/*!< deMalloc() and deFree()							*/
+
+	DE_POOL_BENCHMARK_ALLOCATOR_LAST
+} dePoolBenchmarkAllocator;
+
+DE_BEGIN_EXTERN_C
+
+void		dePool_selfTest						(void);
+
+const char*	dePool_getBenchmarkAllocatorName	(dePoolBenchmarkAllocator allocator);
+deUint32	dePool_runAllocBenchmark			(dePoolBenchmarkAllocator allocator, int numAllocs);
+
+DE_END_EXTERN_C
 
 #endif /* _DEPOOLTEST_H */
@@ -31,6 +31,7 @@
 #include "deThreadLocal.h"
 #include "deSingleton.h"
 #include "deMemPool.h"
+#include "deConcurrentMemPool.h"
 #include "dePoolArray.h"
 
 static void threadTestThr1 (void* arg)
@@ -577,6 +578,98 @@ void deAtomic_selfTest (void)
 	/* \todo [2012-10-26 pyry] Implement multi-threaded tests. */
 }
 
+/* Concurrent memory pool self-test. */
+
+enum
+{
+	CONCURRENT_POOL_TEST_NUM_THREADS	= 4,
+	CONCURRENT_POOL_TEST_NUM_ROUNDS		= 4,
+	CONCURRENT_POOL_TEST_ALLOCS			= 2000
+};
+
+typedef struct ConcurrentPoolTestThread_s
+{
+	deConcurrentMemPool*	pool;
+	deUint32				threadNdx;
+	deUint32*				ptrs[CONCURRENT_POOL_TEST_NUM_ROUNDS*CONCURRENT_POOL_TEST_ALLOCS];
+} ConcurrentPoolTestThread;
+
+static void concurrentPoolTestThread (void* arg)
+{
+	ConcurrentPoolTestThread*	data	= (ConcurrentPoolTestThread*)arg;
+	int							round;
+
+	for (round = 0; round < CONCURRENT_POOL_TEST_NUM_ROUNDS; round++)
+	{
+		/* Release and re-acquire cache between rounds to exercise cache sharing. */
+		deMemPoolCache*	cache	= deConcurrentMemPool_acquireCache(data->pool);
+		int				ndx;
+
+		DE_TEST_ASSERT(cache);
+
+		for (ndx = 0; ndx < CONCURRENT_POOL_TEST_ALLOCS; ndx++)
+		{
+			const int		allocNdx	= round*CONCURRENT_POOL_TEST_ALLOCS + ndx;
+			const size_t	size		= sizeof(deUint32) * (size_t)(2 + allocNdx % 13);
+			deUint32*		ptr			= (round % 2 == 0) ? (deUint32*)deMemPoolCache_alloc(cache, size)
+														   : (deUint32*)deConcurrentMemPool_alloc(data->pool, size);
+
+			DE_TEST_ASSERT(ptr);
+
+			ptr[0]	= data->threadNdx;
+			ptr[1]	= (deUint32)allocNdx;
+
+			data->ptrs[allocNdx] = ptr;
+		}
+
+		deConcurrentMemPool_releaseCache(data->pool, cache);
+		deYield();
+	}
+}
+
+void deConcurrentMemPool_threadedSelfTest (void)
+{
+	deConcurrentMemPool*		pool			= deConcurrentMemPool_create(DE_NULL);
+	ConcurrentPoolTestThread*	threadData		= (ConcurrentPoolTestThread*)deCalloc(sizeof(ConcurrentPoolTestThread) * CONCURRENT_POOL_TEST_NUM_THREADS);
+	deThread					threads[CONCURRENT_POOL_TEST_NUM_THREADS];
+	int							threadNdx;
+
+	DE_TEST_ASSERT(pool && threadData);
+
+	for (threadNdx = 0; threadNdx < CONCURRENT_POOL_TEST_NUM_THREADS; threadNdx++)
+	{
+		threadData[threadNdx].pool		= pool;
+		threadData[threadNdx].threadNdx	= (deUint32)threadNdx;
+
+		threads[threadNdx] = deThread_create(concurrentPoolTestThread, &threadData[threadNdx], DE_NULL);
+		DE_TEST_ASSERT(threads[threadNdx]);
+	}
+
+	for (threadNdx = 0; threadNdx < CONCURRENT_POOL_TEST_NUM_THREADS; threadNdx++)
+	{
+		DE_TEST_ASSERT(deThread_join(threads[threadNdx]));
+		deThread_destroy(threads[threadNdx]);
+	}
+
+	/* Overlapping allocations would have clobbered each other's tags. */
+	for (threadNdx = 0; threadNdx < CONCURRENT_POOL_TEST_NUM_THREADS; threadNdx++)
+	{
+		int allocNdx;
+		for (allocNdx = 0; allocNdx < CONCURRENT_POOL_TEST_NUM_ROUNDS*CONCURRENT_POOL_TEST_ALLOCS; allocNdx++)
+		{
+			const deUint32* ptr = threadData[threadNdx].ptrs[allocNdx];
+			DE_TEST_ASSERT(ptr[0] == (deUint32)threadNdx);
+			DE_TEST_ASSERT(ptr[1] == (deUint32)allocNdx);
+		}
+	}
+
+	/* Each thread holds at most one cache directly and one through deConcurrentMemPool_alloc(). */
+	DE_TEST_ASSERT(deConcurrentMemPool_getNumCaches(pool) <= 2*CONCURRENT_POOL_TEST_NUM_THREADS);
+
+	deFree(threadData);
+	deConcurrentMemPool_destroy(pool);
+}
+
 /* Singleton self-test. */
 
 DE_DECLARE_POOL_ARRAY(deThreadArray, deThread);
@@ -33,6 +33,8 @@ void	deSemaphore_selfTest	(void);
 void	deAtomic_selfTest		(void);
 void	deSingleton_selfTest	(void);
 
+void	deConcurrentMemPool_threadedSelfTest	(void);
+
 DE_END_EXTERN_C
 
 #endif /* _DETHREADTEST_H */
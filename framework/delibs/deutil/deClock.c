@@ -77,6 +77,36 @@ deUint64 deGetMicroseconds (void)
 #endif
 }
 
+deUint64 deGetNanoseconds (void)
+{
+#if (DE_OS == DE_OS_WIN32)
+	LARGE_INTEGER freq;
+	LARGE_INTEGER count;
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	DE_ASSERT(freq.QuadPart != 0);
+
+	/* Split to whole seconds and remainder to avoid overflow. */
+	return (deUint64)(count.QuadPart / freq.QuadPart) * 1000000000 + (deUint64)(count.QuadPart % freq.QuadPart) * 1000000000 / (deUint64)freq.QuadPart;
+
+#elif (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+	struct timespec currTime;
+	clock_gettime(CLOCK_MONOTONIC, &currTime);
+	return (deUint64)currTime.tv_sec*1000000000 + (deUint64)currTime.tv_nsec;
+
+#elif  (DE_OS == DE_OS_SYMBIAN)
+	struct timespec currTime;
+	clock_gettime(CLOCK_REALTIME, &currTime);
+	return (deUint64)currTime.tv_sec*1000000000 + (deUint64)currTime.tv_nsec;
+
+#elif (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS)
+	return deGetMicroseconds() * 1000;
+
+#else
+#   error "Not implemented for target OS"
+#endif
+}
+
 deUint64 deGetTime (void)
 {
 	return (deUint64)time(DE_NULL);
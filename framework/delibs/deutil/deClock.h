@@ -37,6 +37,15 @@ DE_BEGIN_EXTERN_C
  *//*--------------------------------------------------------------------*/
 deUint64		deGetMicroseconds		(void);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Get time in nanoseconds.
+ * \return Current time in nanoseconds.
+ *
+ * \note Same reference point and clock as deGetMicroseconds(). Actual
+ *       resolution depends on platform.
+ *//*--------------------------------------------------------------------*/
+deUint64		deGetNanoseconds		(void);
+
 /*--------------------------------------------------------------------*//*!
  * \brief Get time in seconds since the epoch.
  * \return Current time in seconds since the epoch.
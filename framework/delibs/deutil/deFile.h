@@ -74,6 +74,7 @@ deFile*			deFile_createFromHandle	(deUintptr handle);
 void			deFile_destroy			(deFile* file);
 
 deBool			deFile_setFlags			(deFile* file, deUint32 flags);
+deUintptr		deFile_getHandle		(const deFile* file);
 
 deInt64			deFile_getPosition		(const deFile* file);
 deBool			deFile_seek				(deFile* file, deFilePosition base, deInt64 offset);
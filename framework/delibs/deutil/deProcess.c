@@ -500,6 +500,11 @@ deBool deProcess_closeStdErr (deProcess* process)
 		return DE_FALSE;
 }
 
+deUint32 deProcess_getCurrentId (void)
+{
+	return (deUint32)getpid();
+}
+
 #elif (DE_OS == DE_OS_WIN32)
 
 #define VC_EXTRALEAN
@@ -855,6 +860,11 @@ deBool deProcess_closeStdErr (deProcess* process)
 		return DE_FALSE;
 }
 
+deUint32 deProcess_getCurrentId (void)
+{
+	return (deUint32)GetCurrentProcessId();
+}
+
 #else
 #	error Implement deProcess for your OS.
 #endif
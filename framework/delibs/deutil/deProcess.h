@@ -54,6 +54,9 @@ deBool			deProcess_closeStdIn		(deProcess* process);
 deBool			deProcess_closeStdOut		(deProcess* process);
 deBool			deProcess_closeStdErr		(deProcess* process);
 
+/* Id of the calling process. */
+deUint32		deProcess_getCurrentId		(void);
+
 DE_END_EXTERN_C
 
 #endif /* _DEPROCESS_H */
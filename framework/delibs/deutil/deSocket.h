@@ -120,6 +120,7 @@ void				deSocket_destroy			(deSocket* socket);
 
 deSocketState		deSocket_getState			(const deSocket* socket);
 deUint32			deSocket_getOpenChannels	(const deSocket* socket);
+deUintptr			deSocket_getHandle			(const deSocket* socket);
 
 deBool				deSocket_setFlags			(deSocket* socket, deUint32 flags);
 
@@ -26,6 +26,8 @@
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
 
+#include <sstream>
+
 using tcu::TestLog;
 using tcu::toHex;
 
@@ -33,9 +35,10 @@ namespace glu
 {
 
 CallLogWrapper::CallLogWrapper (const glw::Functions& gl, tcu::TestLog& log)
-	: m_gl			(gl)
-	, m_log			(log)
-	, m_enableLog	(false)
+	: m_gl				(gl)
+	, m_log				(log)
+	, m_enableLog		(false)
+	, m_enableCallTrace	(false)
 {
 }
 
@@ -43,6 +46,55 @@ CallLogWrapper::~CallLogWrapper (void)
 {
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Enable or disable binary call trace
+ *
+ * Disabling trace keeps recorded calls so that they can still be written
+ * out. Re-enabling with different capacity drops recorded calls.
+ *
+ * \param enable	Enable trace
+ * \param capacity	Number of most recent calls to keep
+ *//*--------------------------------------------------------------------*/
+void CallLogWrapper::enableCallTrace (bool enable, size_t capacity)
+{
+	if (enable && (!m_callTrace || m_callTrace->getCapacity() != capacity))
+		m_callTrace = de::SharedPtr<CallTraceBuffer>(new CallTraceBuffer(capacity));
+
+	m_enableCallTrace = enable;
+}
+
+void CallLogWrapper::logCallTrace (void)
+{
+	if (!m_callTrace)
+		return;
+
+	const tcu::ScopedLogSection section (m_log, "CallTrace", "GL call trace");
+
+	if (m_callTrace->getNumDroppedRecords() > 0)
+		m_log << TestLog::Message << "// " << m_callTrace->getNumDroppedRecords() << " earlier calls not recorded" << TestLog::EndMessage;
+
+	for (size_t ndx = 0; ndx < m_callTrace->getNumRecords(); ndx++)
+	{
+		std::ostringstream	callStr;
+		std::ostringstream	returnStr;
+
+		decodeCallTraceRecord(m_callTrace->getRecord(ndx), callStr, returnStr);
+
+		m_log << TestLog::Message << callStr.str() << TestLog::EndMessage;
+
+		if (!returnStr.str().empty())
+			m_log << TestLog::Message << returnStr.str() << TestLog::EndMessage;
+	}
+}
+
+void CallLogWrapper::writeCallTrace (const char* filename) const
+{
+	if (!m_callTrace)
+		throw tcu::InternalError("Call trace has not been enabled");
+
+	writeCallTraceFile(filename, *m_callTrace);
+}
+
 template <typename T>
 inline tcu::Format::ArrayPointer<T> getPointerStr (const T* arr, deUint32 size)
 {
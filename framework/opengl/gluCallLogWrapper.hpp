@@ -24,8 +24,10 @@
  *//*--------------------------------------------------------------------*/
 
 #include "gluDefs.hpp"
+#include "gluCallTrace.hpp"
 #include "tcuTestLog.hpp"
 #include "glwDefs.hpp"
+#include "deSharedPtr.hpp"
 
 namespace glw
 {
@@ -48,10 +50,42 @@ public:
 	bool					isLoggingEnabled		(void)			{ return m_enableLog; }
 	tcu::TestLog&			getLog					(void)			{ return m_log; }
 
+	// Binary call trace is much cheaper than logging and can be left on
+	// for whole cases. Most recent calls are kept in a ring buffer that can
+	// be written to log on failure or to a file for decode-gl-call-trace.
+	void					enableCallTrace			(bool enable, size_t capacity = CallTraceBuffer::DEFAULT_CAPACITY);
+	bool					isCallTraceEnabled		(void) const	{ return m_enableCallTrace; }
+	const CallTraceBuffer*	getCallTrace			(void) const	{ return m_callTrace.get(); }
+	void					discardCallTrace		(void)			{ m_enableCallTrace = false; m_callTrace.clear(); }
+	void					logCallTrace			(void);
+	void					writeCallTrace			(const char* filename) const;
+
 private:
-	const glw::Functions&	m_gl;
-	tcu::TestLog&			m_log;
-	bool					m_enableLog;
+	CallTraceRecord*		beginCallTrace			(CallTraceFunction function)
+	{
+		return m_enableCallTrace ? m_callTrace->beginCall(function) : DE_NULL;
+	}
+
+	void					endCallTrace			(CallTraceRecord* record)
+	{
+		if (record)
+			m_callTrace->endCall(record);
+	}
+
+	void					endCallTrace			(CallTraceRecord* record, deUint64 returnValue)
+	{
+		if (record)
+		{
+			record->returnValue = returnValue;
+			m_callTrace->endCall(record);
+		}
+	}
+
+	const glw::Functions&			m_gl;
+	tcu::TestLog&					m_log;
+	bool							m_enableLog;
+	bool							m_enableCallTrace;
+	de::SharedPtr<CallTraceBuffer>	m_callTrace;		//!< Shared by copies of wrapper.
 } DE_WARN_UNUSED_TYPE;
 
 } // glu
@@ -8,329 +8,699 @@ void CallLogWrapper::glActiveShaderProgram (glw::GLuint pipeline, glw::GLuint pr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveShaderProgram(" << pipeline << ", " << program << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glActiveShaderProgram);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pipeline);
+		traceRecord->args[1] = encodeCallTraceArg(program);
+	}
 	m_gl.activeShaderProgram(pipeline, program);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glActiveTexture (glw::GLenum texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveTexture(" << getTextureUnitStr(texture) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glActiveTexture);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(texture);
 	m_gl.activeTexture(texture);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glAttachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glAttachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glAttachShader);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shader);
+	}
 	m_gl.attachShader(program, shader);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBeginConditionalRender (glw::GLuint id, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginConditionalRender(" << id << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBeginConditionalRender);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(mode);
+	}
 	m_gl.beginConditionalRender(id, mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBeginQuery (glw::GLenum target, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQuery(" << getQueryTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBeginQuery);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(id);
+	}
 	m_gl.beginQuery(target, id);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBeginQueryIndexed (glw::GLenum target, glw::GLuint index, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQueryIndexed(" << toHex(target) << ", " << index << ", " << id << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBeginQueryIndexed);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(id);
+	}
 	m_gl.beginQueryIndexed(target, index, id);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBeginTransformFeedback (glw::GLenum primitiveMode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginTransformFeedback(" << getPrimitiveTypeStr(primitiveMode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBeginTransformFeedback);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(primitiveMode);
 	m_gl.beginTransformFeedback(primitiveMode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindAttribLocation (glw::GLuint program, glw::GLuint index, const glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindAttribLocation(" << program << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindAttribLocation);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(name);
+	}
 	m_gl.bindAttribLocation(program, index, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindBuffer (glw::GLenum target, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffer(" << getBufferTargetStr(target) << ", " << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+	}
 	m_gl.bindBuffer(target, buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindBufferBase (glw::GLenum target, glw::GLuint index, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferBase(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindBufferBase);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+	}
 	m_gl.bindBufferBase(target, index, buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindBufferRange (glw::GLenum target, glw::GLuint index, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferRange(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+	}
 	m_gl.bindBufferRange(target, index, buffer, offset, size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindBuffersBase (glw::GLenum target, glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersBase(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindBuffersBase);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(first);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(buffers);
+	}
 	m_gl.bindBuffersBase(target, first, count, buffers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindBuffersRange (glw::GLenum target, glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers, const glw::GLintptr *offsets, const glw::GLsizeiptr *sizes)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersRange(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindBuffersRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(first);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(buffers);
+		traceRecord->args[4] = encodeCallTraceArg(offsets);
+		traceRecord->args[5] = encodeCallTraceArg(sizes);
+	}
 	m_gl.bindBuffersRange(target, first, count, buffers, offsets, sizes);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindFragDataLocation (glw::GLuint program, glw::GLuint color, const glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocation(" << program << ", " << color << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindFragDataLocation);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(color);
+		traceRecord->args[2] = encodeCallTraceArg(name);
+	}
 	m_gl.bindFragDataLocation(program, color, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindFragDataLocationIndexed (glw::GLuint program, glw::GLuint colorNumber, glw::GLuint index, const glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocationIndexed(" << program << ", " << colorNumber << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindFragDataLocationIndexed);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(colorNumber);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(name);
+	}
 	m_gl.bindFragDataLocationIndexed(program, colorNumber, index, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindFramebuffer (glw::GLenum target, glw::GLuint framebuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFramebuffer(" << getFramebufferTargetStr(target) << ", " << framebuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindFramebuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(framebuffer);
+	}
 	m_gl.bindFramebuffer(target, framebuffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindImageTexture (glw::GLuint unit, glw::GLuint texture, glw::GLint level, glw::GLboolean layered, glw::GLint layer, glw::GLenum access, glw::GLenum format)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTexture(" << unit << ", " << texture << ", " << level << ", " << getBooleanStr(layered) << ", " << layer << ", " << getImageAccessStr(access) << ", " << getUncompressedTextureFormatStr(format) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindImageTexture);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(unit);
+		traceRecord->args[1] = encodeCallTraceArg(texture);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(layered);
+		traceRecord->args[4] = encodeCallTraceArg(layer);
+		traceRecord->args[5] = encodeCallTraceArg(access);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+	}
 	m_gl.bindImageTexture(unit, texture, level, layered, layer, access, format);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindImageTextures (glw::GLuint first, glw::GLsizei count, const glw::GLuint *textures)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindImageTextures);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(textures);
+	}
 	m_gl.bindImageTextures(first, count, textures);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindMultiTextureEXT (glw::GLenum texunit, glw::GLenum target, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindMultiTextureEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << texture << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindMultiTextureEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(texture);
+	}
 	m_gl.bindMultiTextureEXT(texunit, target, texture);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindProgramPipeline);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(pipeline);
 	m_gl.bindProgramPipeline(pipeline);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindRenderbuffer (glw::GLenum target, glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindRenderbuffer(" << getFramebufferTargetStr(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindRenderbuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(renderbuffer);
+	}
 	m_gl.bindRenderbuffer(target, renderbuffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindSampler (glw::GLuint unit, glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSampler(" << unit << ", " << sampler << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindSampler);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(unit);
+		traceRecord->args[1] = encodeCallTraceArg(sampler);
+	}
 	m_gl.bindSampler(unit, sampler);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindSamplers (glw::GLuint first, glw::GLsizei count, const glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSamplers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindSamplers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(samplers);
+	}
 	m_gl.bindSamplers(first, count, samplers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindTexture (glw::GLenum target, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTexture(" << getTextureTargetStr(target) << ", " << texture << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindTexture);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(texture);
+	}
 	m_gl.bindTexture(target, texture);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindTextureUnit (glw::GLuint unit, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextureUnit(" << unit << ", " << texture << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindTextureUnit);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(unit);
+		traceRecord->args[1] = encodeCallTraceArg(texture);
+	}
 	m_gl.bindTextureUnit(unit, texture);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindTextures (glw::GLuint first, glw::GLsizei count, const glw::GLuint *textures)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindTextures);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(textures);
+	}
 	m_gl.bindTextures(first, count, textures);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindTransformFeedback (glw::GLenum target, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTransformFeedback(" << getTransformFeedbackTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindTransformFeedback);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(id);
+	}
 	m_gl.bindTransformFeedback(target, id);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexArray(" << array << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindVertexArray);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(array);
 	m_gl.bindVertexArray(array);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindVertexBuffer (glw::GLuint bindingindex, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizei stride)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffer(" << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindVertexBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(bindingindex);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(offset);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+	}
 	m_gl.bindVertexBuffer(bindingindex, buffer, offset, stride);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBindVertexBuffers (glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers, const glw::GLintptr *offsets, const glw::GLsizei *strides)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBindVertexBuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(buffers);
+		traceRecord->args[3] = encodeCallTraceArg(offsets);
+		traceRecord->args[4] = encodeCallTraceArg(strides);
+	}
 	m_gl.bindVertexBuffers(first, count, buffers, offsets, strides);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendBarrier (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendBarrier(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendBarrier);
 	m_gl.blendBarrier();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendColor (glw::GLfloat red, glw::GLfloat green, glw::GLfloat blue, glw::GLfloat alpha)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendColor);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(red);
+		traceRecord->args[1] = encodeCallTraceArg(green);
+		traceRecord->args[2] = encodeCallTraceArg(blue);
+		traceRecord->args[3] = encodeCallTraceArg(alpha);
+	}
 	m_gl.blendColor(red, green, blue, alpha);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendEquation (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquation(" << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendEquation);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mode);
 	m_gl.blendEquation(mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendEquationSeparate (glw::GLenum modeRGB, glw::GLenum modeAlpha)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparate(" << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendEquationSeparate);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(modeRGB);
+		traceRecord->args[1] = encodeCallTraceArg(modeAlpha);
+	}
 	m_gl.blendEquationSeparate(modeRGB, modeAlpha);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendEquationSeparatei (glw::GLuint buf, glw::GLenum modeRGB, glw::GLenum modeAlpha)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparatei(" << buf << ", " << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendEquationSeparatei);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buf);
+		traceRecord->args[1] = encodeCallTraceArg(modeRGB);
+		traceRecord->args[2] = encodeCallTraceArg(modeAlpha);
+	}
 	m_gl.blendEquationSeparatei(buf, modeRGB, modeAlpha);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendEquationi (glw::GLuint buf, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationi(" << buf << ", " << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendEquationi);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buf);
+		traceRecord->args[1] = encodeCallTraceArg(mode);
+	}
 	m_gl.blendEquationi(buf, mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendFunc (glw::GLenum sfactor, glw::GLenum dfactor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunc(" << getBlendFactorStr(sfactor) << ", " << getBlendFactorStr(dfactor) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendFunc);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sfactor);
+		traceRecord->args[1] = encodeCallTraceArg(dfactor);
+	}
 	m_gl.blendFunc(sfactor, dfactor);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendFuncSeparate (glw::GLenum sfactorRGB, glw::GLenum dfactorRGB, glw::GLenum sfactorAlpha, glw::GLenum dfactorAlpha)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparate(" << getBlendFactorStr(sfactorRGB) << ", " << getBlendFactorStr(dfactorRGB) << ", " << getBlendFactorStr(sfactorAlpha) << ", " << getBlendFactorStr(dfactorAlpha) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendFuncSeparate);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sfactorRGB);
+		traceRecord->args[1] = encodeCallTraceArg(dfactorRGB);
+		traceRecord->args[2] = encodeCallTraceArg(sfactorAlpha);
+		traceRecord->args[3] = encodeCallTraceArg(dfactorAlpha);
+	}
 	m_gl.blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendFuncSeparatei (glw::GLuint buf, glw::GLenum srcRGB, glw::GLenum dstRGB, glw::GLenum srcAlpha, glw::GLenum dstAlpha)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparatei(" << buf << ", " << toHex(srcRGB) << ", " << toHex(dstRGB) << ", " << toHex(srcAlpha) << ", " << toHex(dstAlpha) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendFuncSeparatei);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buf);
+		traceRecord->args[1] = encodeCallTraceArg(srcRGB);
+		traceRecord->args[2] = encodeCallTraceArg(dstRGB);
+		traceRecord->args[3] = encodeCallTraceArg(srcAlpha);
+		traceRecord->args[4] = encodeCallTraceArg(dstAlpha);
+	}
 	m_gl.blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlendFunci (glw::GLuint buf, glw::GLenum src, glw::GLenum dst)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunci(" << buf << ", " << toHex(src) << ", " << toHex(dst) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlendFunci);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buf);
+		traceRecord->args[1] = encodeCallTraceArg(src);
+		traceRecord->args[2] = encodeCallTraceArg(dst);
+	}
 	m_gl.blendFunci(buf, src, dst);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlitFramebuffer (glw::GLint srcX0, glw::GLint srcY0, glw::GLint srcX1, glw::GLint srcY1, glw::GLint dstX0, glw::GLint dstY0, glw::GLint dstX1, glw::GLint dstY1, glw::GLbitfield mask, glw::GLenum filter)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitFramebuffer(" << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << getBufferMaskStr(mask) << ", " << getTextureFilterStr(filter) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlitFramebuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(srcX0);
+		traceRecord->args[1] = encodeCallTraceArg(srcY0);
+		traceRecord->args[2] = encodeCallTraceArg(srcX1);
+		traceRecord->args[3] = encodeCallTraceArg(srcY1);
+		traceRecord->args[4] = encodeCallTraceArg(dstX0);
+		traceRecord->args[5] = encodeCallTraceArg(dstY0);
+		traceRecord->args[6] = encodeCallTraceArg(dstX1);
+		traceRecord->args[7] = encodeCallTraceArg(dstY1);
+		traceRecord->args[8] = encodeCallTraceArg(mask);
+		traceRecord->args[9] = encodeCallTraceArg(filter);
+	}
 	m_gl.blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBlitNamedFramebuffer (glw::GLuint readFramebuffer, glw::GLuint drawFramebuffer, glw::GLint srcX0, glw::GLint srcY0, glw::GLint srcX1, glw::GLint srcY1, glw::GLint dstX0, glw::GLint dstY0, glw::GLint dstX1, glw::GLint dstY1, glw::GLbitfield mask, glw::GLenum filter)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitNamedFramebuffer(" << readFramebuffer << ", " << drawFramebuffer << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBlitNamedFramebuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(readFramebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(drawFramebuffer);
+		traceRecord->args[2] = encodeCallTraceArg(srcX0);
+		traceRecord->args[3] = encodeCallTraceArg(srcY0);
+		traceRecord->args[4] = encodeCallTraceArg(srcX1);
+		traceRecord->args[5] = encodeCallTraceArg(srcY1);
+		traceRecord->args[6] = encodeCallTraceArg(dstX0);
+		traceRecord->args[7] = encodeCallTraceArg(dstY0);
+		traceRecord->args[8] = encodeCallTraceArg(dstX1);
+		traceRecord->args[9] = encodeCallTraceArg(dstY1);
+		traceRecord->args[10] = encodeCallTraceArg(mask);
+		traceRecord->args[11] = encodeCallTraceArg(filter);
+	}
 	m_gl.blitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBufferData (glw::GLenum target, glw::GLsizeiptr size, const void *data, glw::GLenum usage)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferData(" << getBufferTargetStr(target) << ", " << size << ", " << data << ", " << getUsageStr(usage) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBufferData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+		traceRecord->args[3] = encodeCallTraceArg(usage);
+	}
 	m_gl.bufferData(target, size, data, usage);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBufferPageCommitmentARB (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLboolean commit)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferPageCommitmentARB(" << toHex(target) << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBufferPageCommitmentARB);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(commit);
+	}
 	m_gl.bufferPageCommitmentARB(target, offset, size, commit);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBufferStorage (glw::GLenum target, glw::GLsizeiptr size, const void *data, glw::GLbitfield flags)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferStorage(" << toHex(target) << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBufferStorage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+		traceRecord->args[3] = encodeCallTraceArg(flags);
+	}
 	m_gl.bufferStorage(target, size, data, flags);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glBufferSubData (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr size, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferSubData(" << getBufferTargetStr(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(data);
+	}
 	m_gl.bufferSubData(target, offset, size, data);
+	endCallTrace(traceRecord);
 }
 
 glw::GLenum CallLogWrapper::glCheckFramebufferStatus (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckFramebufferStatus(" << getFramebufferTargetStr(target) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCheckFramebufferStatus);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(target);
 	glw::GLenum returnValue = m_gl.checkFramebufferStatus(target);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getFramebufferStatusStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -340,7 +710,14 @@ glw::GLenum CallLogWrapper::glCheckNamedFramebufferStatus (glw::GLuint framebuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckNamedFramebufferStatus(" << framebuffer << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCheckNamedFramebufferStatus);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+	}
 	glw::GLenum returnValue = m_gl.checkNamedFramebufferStatus(framebuffer, target);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -350,154 +727,338 @@ void CallLogWrapper::glClampColor (glw::GLenum target, glw::GLenum clamp)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClampColor(" << toHex(target) << ", " << toHex(clamp) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClampColor);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(clamp);
+	}
 	m_gl.clampColor(target, clamp);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClear (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClear(" << getBufferMaskStr(mask) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClear);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mask);
 	m_gl.clear(mask);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearBufferData (glw::GLenum target, glw::GLenum internalformat, glw::GLenum format, glw::GLenum type, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferData(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearBufferData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(format);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(data);
+	}
 	m_gl.clearBufferData(target, internalformat, format, type, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearBufferSubData (glw::GLenum target, glw::GLenum internalformat, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLenum format, glw::GLenum type, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferSubData(" << toHex(target) << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(offset);
+		traceRecord->args[3] = encodeCallTraceArg(size);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(data);
+	}
 	m_gl.clearBufferSubData(target, internalformat, offset, size, format, type, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearBufferfi (glw::GLenum buffer, glw::GLint drawbuffer, glw::GLfloat depth, glw::GLint stencil)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfi(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearBufferfi);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[2] = encodeCallTraceArg(depth);
+		traceRecord->args[3] = encodeCallTraceArg(stencil);
+	}
 	m_gl.clearBufferfi(buffer, drawbuffer, depth, stencil);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearBufferfv (glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearBufferfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.clearBufferfv(buffer, drawbuffer, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearBufferiv (glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearBufferiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.clearBufferiv(buffer, drawbuffer, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearBufferuiv (glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferuiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearBufferuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.clearBufferuiv(buffer, drawbuffer, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearColor (glw::GLfloat red, glw::GLfloat green, glw::GLfloat blue, glw::GLfloat alpha)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearColor);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(red);
+		traceRecord->args[1] = encodeCallTraceArg(green);
+		traceRecord->args[2] = encodeCallTraceArg(blue);
+		traceRecord->args[3] = encodeCallTraceArg(alpha);
+	}
 	m_gl.clearColor(red, green, blue, alpha);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearDepth (glw::GLdouble depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepth(" << depth << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearDepth);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(depth);
 	m_gl.clearDepth(depth);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearDepthf (glw::GLfloat d)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepthf(" << d << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearDepthf);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(d);
 	m_gl.clearDepthf(d);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearNamedBufferData (glw::GLuint buffer, glw::GLenum internalformat, glw::GLenum format, glw::GLenum type, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferData(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearNamedBufferData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(format);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(data);
+	}
 	m_gl.clearNamedBufferData(buffer, internalformat, format, type, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearNamedBufferSubData (glw::GLuint buffer, glw::GLenum internalformat, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLenum format, glw::GLenum type, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferSubData(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearNamedBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(offset);
+		traceRecord->args[3] = encodeCallTraceArg(size);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(data);
+	}
 	m_gl.clearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearNamedFramebufferfi (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, glw::GLfloat depth, glw::GLint stencil)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfi(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearNamedFramebufferfi);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[3] = encodeCallTraceArg(depth);
+		traceRecord->args[4] = encodeCallTraceArg(stencil);
+	}
 	m_gl.clearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearNamedFramebufferfv (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearNamedFramebufferfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.clearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearNamedFramebufferiv (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearNamedFramebufferiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.clearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearNamedFramebufferuiv (glw::GLuint framebuffer, glw::GLenum buffer, glw::GLint drawbuffer, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferuiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearNamedFramebufferuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(drawbuffer);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.clearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearStencil (glw::GLint s)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearStencil(" << s << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearStencil);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(s);
 	m_gl.clearStencil(s);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearTexImage (glw::GLuint texture, glw::GLint level, glw::GLenum format, glw::GLenum type, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearTexImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(format);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(data);
+	}
 	m_gl.clearTexImage(texture, level, format, type, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClearTexSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClearTexSubImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(type);
+		traceRecord->args[10] = encodeCallTraceArg(data);
+	}
 	m_gl.clearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glClientAttribDefaultEXT (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClientAttribDefaultEXT);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mask);
 	m_gl.clientAttribDefaultEXT(mask);
+	endCallTrace(traceRecord);
 }
 
 glw::GLenum CallLogWrapper::glClientWaitSync (glw::GLsync sync, glw::GLbitfield flags, glw::GLuint64 timeout)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClientWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClientWaitSync);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sync);
+		traceRecord->args[1] = encodeCallTraceArg(flags);
+		traceRecord->args[2] = encodeCallTraceArg(timeout);
+	}
 	glw::GLenum returnValue = m_gl.clientWaitSync(sync, flags, timeout);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -507,364 +1068,1028 @@ void CallLogWrapper::glClipControl (glw::GLenum origin, glw::GLenum depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClipControl(" << toHex(origin) << ", " << toHex(depth) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glClipControl);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(origin);
+		traceRecord->args[1] = encodeCallTraceArg(depth);
+	}
 	m_gl.clipControl(origin, depth);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glColorMask (glw::GLboolean red, glw::GLboolean green, glw::GLboolean blue, glw::GLboolean alpha)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMask(" << getBooleanStr(red) << ", " << getBooleanStr(green) << ", " << getBooleanStr(blue) << ", " << getBooleanStr(alpha) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glColorMask);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(red);
+		traceRecord->args[1] = encodeCallTraceArg(green);
+		traceRecord->args[2] = encodeCallTraceArg(blue);
+		traceRecord->args[3] = encodeCallTraceArg(alpha);
+	}
 	m_gl.colorMask(red, green, blue, alpha);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glColorMaski (glw::GLuint index, glw::GLboolean r, glw::GLboolean g, glw::GLboolean b, glw::GLboolean a)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMaski(" << index << ", " << getBooleanStr(r) << ", " << getBooleanStr(g) << ", " << getBooleanStr(b) << ", " << getBooleanStr(a) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glColorMaski);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(r);
+		traceRecord->args[2] = encodeCallTraceArg(g);
+		traceRecord->args[3] = encodeCallTraceArg(b);
+		traceRecord->args[4] = encodeCallTraceArg(a);
+	}
 	m_gl.colorMaski(index, r, g, b, a);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompileShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompileShader(" << shader << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompileShader);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(shader);
 	m_gl.compileShader(shader);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedMultiTexImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(border);
+		traceRecord->args[6] = encodeCallTraceArg(imageSize);
+		traceRecord->args[7] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedMultiTexImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(imageSize);
+		traceRecord->args[8] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedMultiTexImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedMultiTexImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(depth);
+		traceRecord->args[7] = encodeCallTraceArg(border);
+		traceRecord->args[8] = encodeCallTraceArg(imageSize);
+		traceRecord->args[9] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedMultiTexSubImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(format);
+		traceRecord->args[6] = encodeCallTraceArg(imageSize);
+		traceRecord->args[7] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedMultiTexSubImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(imageSize);
+		traceRecord->args[9] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedMultiTexSubImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+		traceRecord->args[8] = encodeCallTraceArg(depth);
+		traceRecord->args[9] = encodeCallTraceArg(format);
+		traceRecord->args[10] = encodeCallTraceArg(imageSize);
+		traceRecord->args[11] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexImage1D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage1D(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(border);
+		traceRecord->args[5] = encodeCallTraceArg(imageSize);
+		traceRecord->args[6] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexImage2D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(border);
+		traceRecord->args[6] = encodeCallTraceArg(imageSize);
+		traceRecord->args[7] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexImage3D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(imageSize);
+		traceRecord->args[8] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexImage3DOES (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexImage3DOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(imageSize);
+		traceRecord->args[8] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexImage3DOES(target, level, internalformat, width, height, depth, border, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexSubImage1D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexSubImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(imageSize);
+		traceRecord->args[6] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexSubImage2D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexSubImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+		traceRecord->args[7] = encodeCallTraceArg(imageSize);
+		traceRecord->args[8] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexSubImage3D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexSubImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(imageSize);
+		traceRecord->args[10] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTexSubImage3DOES (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTexSubImage3DOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(imageSize);
+		traceRecord->args[10] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(border);
+		traceRecord->args[6] = encodeCallTraceArg(imageSize);
+		traceRecord->args[7] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedTextureImage1DEXT(texture, target, level, internalformat, width, border, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(imageSize);
+		traceRecord->args[8] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedTextureImage2DEXT(texture, target, level, internalformat, width, height, border, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(depth);
+		traceRecord->args[7] = encodeCallTraceArg(border);
+		traceRecord->args[8] = encodeCallTraceArg(imageSize);
+		traceRecord->args[9] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureSubImage1D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureSubImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(imageSize);
+		traceRecord->args[6] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureSubImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(format);
+		traceRecord->args[6] = encodeCallTraceArg(imageSize);
+		traceRecord->args[7] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedTextureSubImage1DEXT(texture, target, level, xoffset, width, format, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureSubImage2D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureSubImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+		traceRecord->args[7] = encodeCallTraceArg(imageSize);
+		traceRecord->args[8] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureSubImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(imageSize);
+		traceRecord->args[9] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureSubImage3D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureSubImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(imageSize);
+		traceRecord->args[10] = encodeCallTraceArg(data);
+	}
 	m_gl.compressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCompressedTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLsizei imageSize, const void *bits)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCompressedTextureSubImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+		traceRecord->args[8] = encodeCallTraceArg(depth);
+		traceRecord->args[9] = encodeCallTraceArg(format);
+		traceRecord->args[10] = encodeCallTraceArg(imageSize);
+		traceRecord->args[11] = encodeCallTraceArg(bits);
+	}
 	m_gl.compressedTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyBufferSubData (glw::GLenum readTarget, glw::GLenum writeTarget, glw::GLintptr readOffset, glw::GLintptr writeOffset, glw::GLsizeiptr size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyBufferSubData(" << toHex(readTarget) << ", " << toHex(writeTarget) << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(readTarget);
+		traceRecord->args[1] = encodeCallTraceArg(writeTarget);
+		traceRecord->args[2] = encodeCallTraceArg(readOffset);
+		traceRecord->args[3] = encodeCallTraceArg(writeOffset);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+	}
 	m_gl.copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyImageSubData (glw::GLuint srcName, glw::GLenum srcTarget, glw::GLint srcLevel, glw::GLint srcX, glw::GLint srcY, glw::GLint srcZ, glw::GLuint dstName, glw::GLenum dstTarget, glw::GLint dstLevel, glw::GLint dstX, glw::GLint dstY, glw::GLint dstZ, glw::GLsizei srcWidth, glw::GLsizei srcHeight, glw::GLsizei srcDepth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyImageSubData(" << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyImageSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(srcName);
+		traceRecord->args[1] = encodeCallTraceArg(srcTarget);
+		traceRecord->args[2] = encodeCallTraceArg(srcLevel);
+		traceRecord->args[3] = encodeCallTraceArg(srcX);
+		traceRecord->args[4] = encodeCallTraceArg(srcY);
+		traceRecord->args[5] = encodeCallTraceArg(srcZ);
+		traceRecord->args[6] = encodeCallTraceArg(dstName);
+		traceRecord->args[7] = encodeCallTraceArg(dstTarget);
+		traceRecord->args[8] = encodeCallTraceArg(dstLevel);
+		traceRecord->args[9] = encodeCallTraceArg(dstX);
+		traceRecord->args[10] = encodeCallTraceArg(dstY);
+		traceRecord->args[11] = encodeCallTraceArg(dstZ);
+		traceRecord->args[12] = encodeCallTraceArg(srcWidth);
+		traceRecord->args[13] = encodeCallTraceArg(srcHeight);
+		traceRecord->args[14] = encodeCallTraceArg(srcDepth);
+	}
 	m_gl.copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLint border)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyMultiTexImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(border);
+	}
 	m_gl.copyMultiTexImage1DEXT(texunit, target, level, internalformat, x, y, width, border);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLint border)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyMultiTexImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+		traceRecord->args[8] = encodeCallTraceArg(border);
+	}
 	m_gl.copyMultiTexImage2DEXT(texunit, target, level, internalformat, x, y, width, height, border);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyMultiTexSubImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+	}
 	m_gl.copyMultiTexSubImage1DEXT(texunit, target, level, xoffset, x, y, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyMultiTexSubImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(x);
+		traceRecord->args[6] = encodeCallTraceArg(y);
+		traceRecord->args[7] = encodeCallTraceArg(width);
+		traceRecord->args[8] = encodeCallTraceArg(height);
+	}
 	m_gl.copyMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyMultiTexSubImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+		traceRecord->args[6] = encodeCallTraceArg(x);
+		traceRecord->args[7] = encodeCallTraceArg(y);
+		traceRecord->args[8] = encodeCallTraceArg(width);
+		traceRecord->args[9] = encodeCallTraceArg(height);
+	}
 	m_gl.copyMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyNamedBufferSubData (glw::GLuint readBuffer, glw::GLuint writeBuffer, glw::GLintptr readOffset, glw::GLintptr writeOffset, glw::GLsizeiptr size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyNamedBufferSubData(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyNamedBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(readBuffer);
+		traceRecord->args[1] = encodeCallTraceArg(writeBuffer);
+		traceRecord->args[2] = encodeCallTraceArg(readOffset);
+		traceRecord->args[3] = encodeCallTraceArg(writeOffset);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+	}
 	m_gl.copyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTexImage1D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLint border)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTexImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+	}
 	m_gl.copyTexImage1D(target, level, internalformat, x, y, width, border);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTexImage2D (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLint border)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTexImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(border);
+	}
 	m_gl.copyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTexSubImage1D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTexSubImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+	}
 	m_gl.copyTexSubImage1D(target, level, xoffset, x, y, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTexSubImage2D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage2D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTexSubImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+	}
 	m_gl.copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTexSubImage3D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage3D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTexSubImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(x);
+		traceRecord->args[6] = encodeCallTraceArg(y);
+		traceRecord->args[7] = encodeCallTraceArg(width);
+		traceRecord->args[8] = encodeCallTraceArg(height);
+	}
 	m_gl.copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTexSubImage3DOES (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTexSubImage3DOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(x);
+		traceRecord->args[6] = encodeCallTraceArg(y);
+		traceRecord->args[7] = encodeCallTraceArg(width);
+		traceRecord->args[8] = encodeCallTraceArg(height);
+	}
 	m_gl.copyTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLint border)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(border);
+	}
 	m_gl.copyTextureImage1DEXT(texture, target, level, internalformat, x, y, width, border);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLint border)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+		traceRecord->args[8] = encodeCallTraceArg(border);
+	}
 	m_gl.copyTextureImage2DEXT(texture, target, level, internalformat, x, y, width, height, border);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureSubImage1D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureSubImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+	}
 	m_gl.copyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint x, glw::GLint y, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureSubImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+	}
 	m_gl.copyTextureSubImage1DEXT(texture, target, level, xoffset, x, y, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureSubImage2D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureSubImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(x);
+		traceRecord->args[5] = encodeCallTraceArg(y);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+	}
 	m_gl.copyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureSubImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(x);
+		traceRecord->args[6] = encodeCallTraceArg(y);
+		traceRecord->args[7] = encodeCallTraceArg(width);
+		traceRecord->args[8] = encodeCallTraceArg(height);
+	}
 	m_gl.copyTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureSubImage3D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureSubImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(x);
+		traceRecord->args[6] = encodeCallTraceArg(y);
+		traceRecord->args[7] = encodeCallTraceArg(width);
+		traceRecord->args[8] = encodeCallTraceArg(height);
+	}
 	m_gl.copyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCopyTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCopyTextureSubImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+		traceRecord->args[6] = encodeCallTraceArg(x);
+		traceRecord->args[7] = encodeCallTraceArg(y);
+		traceRecord->args[8] = encodeCallTraceArg(width);
+		traceRecord->args[9] = encodeCallTraceArg(height);
+	}
 	m_gl.copyTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCreateBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateBuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(buffers);
+	}
 	m_gl.createBuffers(n, buffers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCreateFramebuffers (glw::GLsizei n, glw::GLuint *framebuffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateFramebuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(framebuffers);
+	}
 	m_gl.createFramebuffers(n, framebuffers);
+	endCallTrace(traceRecord);
 }
 
 glw::GLuint CallLogWrapper::glCreateProgram (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgram(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateProgram);
 	glw::GLuint returnValue = m_gl.createProgram();
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -874,35 +2099,68 @@ void CallLogWrapper::glCreateProgramPipelines (glw::GLsizei n, glw::GLuint *pipe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateProgramPipelines);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(pipelines);
+	}
 	m_gl.createProgramPipelines(n, pipelines);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCreateQueries (glw::GLenum target, glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateQueries(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateQueries);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(n);
+		traceRecord->args[2] = encodeCallTraceArg(ids);
+	}
 	m_gl.createQueries(target, n, ids);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCreateRenderbuffers (glw::GLsizei n, glw::GLuint *renderbuffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateRenderbuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(renderbuffers);
+	}
 	m_gl.createRenderbuffers(n, renderbuffers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCreateSamplers (glw::GLsizei n, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateSamplers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateSamplers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(samplers);
+	}
 	m_gl.createSamplers(n, samplers);
+	endCallTrace(traceRecord);
 }
 
 glw::GLuint CallLogWrapper::glCreateShader (glw::GLenum type)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShader(" << getShaderTypeStr(type) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateShader);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(type);
 	glw::GLuint returnValue = m_gl.createShader(type);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -912,7 +2170,15 @@ glw::GLuint CallLogWrapper::glCreateShaderProgramv (glw::GLenum type, glw::GLsiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShaderProgramv(" << toHex(type) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strings))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateShaderProgramv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(type);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(strings);
+	}
 	glw::GLuint returnValue = m_gl.createShaderProgramv(type, count, strings);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -922,511 +2188,1028 @@ void CallLogWrapper::glCreateTextures (glw::GLenum target, glw::GLsizei n, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTextures(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateTextures);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(n);
+		traceRecord->args[2] = encodeCallTraceArg(textures);
+	}
 	m_gl.createTextures(target, n, textures);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCreateTransformFeedbacks (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateTransformFeedbacks);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(ids);
+	}
 	m_gl.createTransformFeedbacks(n, ids);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCreateVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCreateVertexArrays);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(arrays);
+	}
 	m_gl.createVertexArrays(n, arrays);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glCullFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCullFace(" << getFaceStr(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glCullFace);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mode);
 	m_gl.cullFace(mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDebugMessageCallback (glw::GLDEBUGPROC callback, const void *userParam)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageCallback(" << toHex(reinterpret_cast<deUintptr>(callback)) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDebugMessageCallback);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(callback);
+		traceRecord->args[1] = encodeCallTraceArg(userParam);
+	}
 	m_gl.debugMessageCallback(callback, userParam);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDebugMessageControl (glw::GLenum source, glw::GLenum type, glw::GLenum severity, glw::GLsizei count, const glw::GLuint *ids, glw::GLboolean enabled)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageControl(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << getDebugMessageSeverityStr(severity) << ", " << count << ", " << getPointerStr(ids, (count)) << ", " << getBooleanStr(enabled) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDebugMessageControl);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(source);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(severity);
+		traceRecord->args[3] = encodeCallTraceArg(count);
+		traceRecord->args[4] = encodeCallTraceArg(ids);
+		traceRecord->args[5] = encodeCallTraceArg(enabled);
+	}
 	m_gl.debugMessageControl(source, type, severity, count, ids, enabled);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDebugMessageInsert (glw::GLenum source, glw::GLenum type, glw::GLuint id, glw::GLenum severity, glw::GLsizei length, const glw::GLchar *buf)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageInsert(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << id << ", " << getDebugMessageSeverityStr(severity) << ", " << length << ", " << getStringStr(buf) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDebugMessageInsert);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(source);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(id);
+		traceRecord->args[3] = encodeCallTraceArg(severity);
+		traceRecord->args[4] = encodeCallTraceArg(length);
+		traceRecord->args[5] = encodeCallTraceArg(buf);
+	}
 	m_gl.debugMessageInsert(source, type, id, severity, length, buf);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteBuffers (glw::GLsizei n, const glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteBuffers(" << n << ", " << getPointerStr(buffers, n) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteBuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(buffers);
+	}
 	m_gl.deleteBuffers(n, buffers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteFramebuffers (glw::GLsizei n, const glw::GLuint *framebuffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteFramebuffers(" << n << ", " << getPointerStr(framebuffers, n) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteFramebuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(framebuffers);
+	}
 	m_gl.deleteFramebuffers(n, framebuffers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgram(" << program << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteProgram);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(program);
 	m_gl.deleteProgram(program);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteProgramPipelines (glw::GLsizei n, const glw::GLuint *pipelines)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgramPipelines(" << n << ", " << getPointerStr(pipelines, n) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteProgramPipelines);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(pipelines);
+	}
 	m_gl.deleteProgramPipelines(n, pipelines);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteQueries (glw::GLsizei n, const glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteQueries(" << n << ", " << getPointerStr(ids, n) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteQueries);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(ids);
+	}
 	m_gl.deleteQueries(n, ids);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteRenderbuffers (glw::GLsizei n, const glw::GLuint *renderbuffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteRenderbuffers(" << n << ", " << getPointerStr(renderbuffers, n) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteRenderbuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(renderbuffers);
+	}
 	m_gl.deleteRenderbuffers(n, renderbuffers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteSamplers (glw::GLsizei count, const glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteSamplers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(count);
+		traceRecord->args[1] = encodeCallTraceArg(samplers);
+	}
 	m_gl.deleteSamplers(count, samplers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteShader(" << shader << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteShader);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(shader);
 	m_gl.deleteShader(shader);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSync(" << sync << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteSync);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(sync);
 	m_gl.deleteSync(sync);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteTextures (glw::GLsizei n, const glw::GLuint *textures)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTextures(" << n << ", " << getPointerStr(textures, n) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteTextures);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(textures);
+	}
 	m_gl.deleteTextures(n, textures);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteTransformFeedbacks (glw::GLsizei n, const glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteTransformFeedbacks);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(ids);
+	}
 	m_gl.deleteTransformFeedbacks(n, ids);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDeleteVertexArrays (glw::GLsizei n, const glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteVertexArrays(" << n << ", " << getPointerStr(arrays, n) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDeleteVertexArrays);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(arrays);
+	}
 	m_gl.deleteVertexArrays(n, arrays);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthBoundsEXT (glw::GLclampd zmin, glw::GLclampd zmax)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthBoundsEXT(" << zmin << ", " << zmax << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthBoundsEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(zmin);
+		traceRecord->args[1] = encodeCallTraceArg(zmax);
+	}
 	m_gl.depthBoundsEXT(zmin, zmax);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthFunc (glw::GLenum func)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthFunc(" << getCompareFuncStr(func) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthFunc);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(func);
 	m_gl.depthFunc(func);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthMask (glw::GLboolean flag)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthMask(" << getBooleanStr(flag) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthMask);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(flag);
 	m_gl.depthMask(flag);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthRange (glw::GLdouble near, glw::GLdouble far)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRange(" << near << ", " << far << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(near);
+		traceRecord->args[1] = encodeCallTraceArg(far);
+	}
 	m_gl.depthRange(near, far);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthRangeArrayfvOES (glw::GLuint first, glw::GLsizei count, const glw::GLfloat *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeArrayfvOES(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthRangeArrayfvOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(v);
+	}
 	m_gl.depthRangeArrayfvOES(first, count, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthRangeArrayv (glw::GLuint first, glw::GLsizei count, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthRangeArrayv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(v);
+	}
 	m_gl.depthRangeArrayv(first, count, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthRangeIndexed (glw::GLuint index, glw::GLdouble n, glw::GLdouble f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeIndexed(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthRangeIndexed);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(n);
+		traceRecord->args[2] = encodeCallTraceArg(f);
+	}
 	m_gl.depthRangeIndexed(index, n, f);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthRangeIndexedfOES (glw::GLuint index, glw::GLfloat n, glw::GLfloat f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeIndexedfOES(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthRangeIndexedfOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(n);
+		traceRecord->args[2] = encodeCallTraceArg(f);
+	}
 	m_gl.depthRangeIndexedfOES(index, n, f);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDepthRangef (glw::GLfloat n, glw::GLfloat f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangef(" << n << ", " << f << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDepthRangef);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(f);
+	}
 	m_gl.depthRangef(n, f);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDetachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDetachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDetachShader);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shader);
+	}
 	m_gl.detachShader(program, shader);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisable);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(cap);
 	m_gl.disable(cap);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisableClientStateIndexedEXT (glw::GLenum array, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisableClientStateIndexedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(array);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.disableClientStateIndexedEXT(array, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisableClientStateiEXT (glw::GLenum array, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisableClientStateiEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(array);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.disableClientStateiEXT(array, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisableIndexedEXT (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableIndexedEXT(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisableIndexedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.disableIndexedEXT(target, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisableVertexArrayAttrib);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.disableVertexArrayAttrib(vaobj, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisableVertexArrayEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(array);
+	}
 	m_gl.disableVertexArrayEXT(vaobj, array);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisableVertexAttribArray);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(index);
 	m_gl.disableVertexAttribArray(index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDisablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDisablei);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.disablei(target, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDispatchCompute (glw::GLuint num_groups_x, glw::GLuint num_groups_y, glw::GLuint num_groups_z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchCompute(" << num_groups_x << ", " << num_groups_y << ", " << num_groups_z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDispatchCompute);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(num_groups_x);
+		traceRecord->args[1] = encodeCallTraceArg(num_groups_y);
+		traceRecord->args[2] = encodeCallTraceArg(num_groups_z);
+	}
 	m_gl.dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDispatchComputeIndirect (glw::GLintptr indirect)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchComputeIndirect(" << indirect << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDispatchComputeIndirect);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(indirect);
 	m_gl.dispatchComputeIndirect(indirect);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawArrays (glw::GLenum mode, glw::GLint first, glw::GLsizei count)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawArrays);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(first);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+	}
 	m_gl.drawArrays(mode, first, count);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawArraysIndirect (glw::GLenum mode, const void *indirect)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysIndirect(" << getPrimitiveTypeStr(mode) << ", " << indirect << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawArraysIndirect);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(indirect);
+	}
 	m_gl.drawArraysIndirect(mode, indirect);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawArraysInstanced (glw::GLenum mode, glw::GLint first, glw::GLsizei count, glw::GLsizei instancecount)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstanced(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ", " << instancecount << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawArraysInstanced);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(first);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(instancecount);
+	}
 	m_gl.drawArraysInstanced(mode, first, count, instancecount);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawArraysInstancedBaseInstance (glw::GLenum mode, glw::GLint first, glw::GLsizei count, glw::GLsizei instancecount, glw::GLuint baseinstance)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstancedBaseInstance(" << toHex(mode) << ", " << first << ", " << count << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawArraysInstancedBaseInstance);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(first);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(instancecount);
+		traceRecord->args[4] = encodeCallTraceArg(baseinstance);
+	}
 	m_gl.drawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawBuffer (glw::GLenum buf)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffer(" << toHex(buf) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawBuffer);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(buf);
 	m_gl.drawBuffer(buf);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawBuffers (glw::GLsizei n, const glw::GLenum *bufs)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffers(" << n << ", " << getEnumPointerStr(bufs, n, getDrawReadBufferName) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawBuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(bufs);
+	}
 	m_gl.drawBuffers(n, bufs);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawElements (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElements(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawElements);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+	}
 	m_gl.drawElements(mode, count, type, indices);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawElementsBaseVertex (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLint basevertex)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawElementsBaseVertex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+		traceRecord->args[4] = encodeCallTraceArg(basevertex);
+	}
 	m_gl.drawElementsBaseVertex(mode, count, type, indices, basevertex);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawElementsIndirect (glw::GLenum mode, glw::GLenum type, const void *indirect)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsIndirect(" << getPrimitiveTypeStr(mode) << ", " << getTypeStr(type) << ", " << indirect << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawElementsIndirect);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(indirect);
+	}
 	m_gl.drawElementsIndirect(mode, type, indirect);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawElementsInstanced (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstanced(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawElementsInstanced);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+		traceRecord->args[4] = encodeCallTraceArg(instancecount);
+	}
 	m_gl.drawElementsInstanced(mode, count, type, indices, instancecount);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawElementsInstancedBaseInstance (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount, glw::GLuint baseinstance)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawElementsInstancedBaseInstance);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+		traceRecord->args[4] = encodeCallTraceArg(instancecount);
+		traceRecord->args[5] = encodeCallTraceArg(baseinstance);
+	}
 	m_gl.drawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawElementsInstancedBaseVertex (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount, glw::GLint basevertex)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawElementsInstancedBaseVertex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+		traceRecord->args[4] = encodeCallTraceArg(instancecount);
+		traceRecord->args[5] = encodeCallTraceArg(basevertex);
+	}
 	m_gl.drawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawElementsInstancedBaseVertexBaseInstance (glw::GLenum mode, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLsizei instancecount, glw::GLint basevertex, glw::GLuint baseinstance)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertexBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ", " << baseinstance << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawElementsInstancedBaseVertexBaseInstance);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+		traceRecord->args[4] = encodeCallTraceArg(instancecount);
+		traceRecord->args[5] = encodeCallTraceArg(basevertex);
+		traceRecord->args[6] = encodeCallTraceArg(baseinstance);
+	}
 	m_gl.drawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawRangeElements (glw::GLenum mode, glw::GLuint start, glw::GLuint end, glw::GLsizei count, glw::GLenum type, const void *indices)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElements(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawRangeElements);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(start);
+		traceRecord->args[2] = encodeCallTraceArg(end);
+		traceRecord->args[3] = encodeCallTraceArg(count);
+		traceRecord->args[4] = encodeCallTraceArg(type);
+		traceRecord->args[5] = encodeCallTraceArg(indices);
+	}
 	m_gl.drawRangeElements(mode, start, end, count, type, indices);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawRangeElementsBaseVertex (glw::GLenum mode, glw::GLuint start, glw::GLuint end, glw::GLsizei count, glw::GLenum type, const void *indices, glw::GLint basevertex)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawRangeElementsBaseVertex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(start);
+		traceRecord->args[2] = encodeCallTraceArg(end);
+		traceRecord->args[3] = encodeCallTraceArg(count);
+		traceRecord->args[4] = encodeCallTraceArg(type);
+		traceRecord->args[5] = encodeCallTraceArg(indices);
+		traceRecord->args[6] = encodeCallTraceArg(basevertex);
+	}
 	m_gl.drawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawTransformFeedback (glw::GLenum mode, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedback(" << toHex(mode) << ", " << id << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawTransformFeedback);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(id);
+	}
 	m_gl.drawTransformFeedback(mode, id);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawTransformFeedbackInstanced (glw::GLenum mode, glw::GLuint id, glw::GLsizei instancecount)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackInstanced(" << toHex(mode) << ", " << id << ", " << instancecount << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawTransformFeedbackInstanced);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(id);
+		traceRecord->args[2] = encodeCallTraceArg(instancecount);
+	}
 	m_gl.drawTransformFeedbackInstanced(mode, id, instancecount);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawTransformFeedbackStream (glw::GLenum mode, glw::GLuint id, glw::GLuint stream)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStream(" << toHex(mode) << ", " << id << ", " << stream << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawTransformFeedbackStream);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(id);
+		traceRecord->args[2] = encodeCallTraceArg(stream);
+	}
 	m_gl.drawTransformFeedbackStream(mode, id, stream);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glDrawTransformFeedbackStreamInstanced (glw::GLenum mode, glw::GLuint id, glw::GLuint stream, glw::GLsizei instancecount)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStreamInstanced(" << toHex(mode) << ", " << id << ", " << stream << ", " << instancecount << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glDrawTransformFeedbackStreamInstanced);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(id);
+		traceRecord->args[2] = encodeCallTraceArg(stream);
+		traceRecord->args[3] = encodeCallTraceArg(instancecount);
+	}
 	m_gl.drawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEGLImageTargetRenderbufferStorageOES (glw::GLenum target, glw::GLeglImageOES image)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetRenderbufferStorageOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEGLImageTargetRenderbufferStorageOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(image);
+	}
 	m_gl.eglImageTargetRenderbufferStorageOES(target, image);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEGLImageTargetTexture2DOES (glw::GLenum target, glw::GLeglImageOES image)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetTexture2DOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEGLImageTargetTexture2DOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(image);
+	}
 	m_gl.eglImageTargetTexture2DOES(target, image);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnable);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(cap);
 	m_gl.enable(cap);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnableClientStateIndexedEXT (glw::GLenum array, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnableClientStateIndexedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(array);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.enableClientStateIndexedEXT(array, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnableClientStateiEXT (glw::GLenum array, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnableClientStateiEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(array);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.enableClientStateiEXT(array, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnableIndexedEXT (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableIndexedEXT(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnableIndexedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.enableIndexedEXT(target, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnableVertexArrayAttrib);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.enableVertexArrayAttrib(vaobj, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnableVertexArrayEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(array);
+	}
 	m_gl.enableVertexArrayEXT(vaobj, array);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnableVertexAttribArray);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(index);
 	m_gl.enableVertexAttribArray(index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEnablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEnablei);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.enablei(target, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEndConditionalRender (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndConditionalRender(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEndConditionalRender);
 	m_gl.endConditionalRender();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEndQuery (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQuery(" << getQueryTargetStr(target) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEndQuery);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(target);
 	m_gl.endQuery(target);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEndQueryIndexed (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQueryIndexed(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEndQueryIndexed);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	m_gl.endQueryIndexed(target, index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glEndTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndTransformFeedback(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glEndTransformFeedback);
 	m_gl.endTransformFeedback();
+	endCallTrace(traceRecord);
 }
 
 glw::GLsync CallLogWrapper::glFenceSync (glw::GLenum condition, glw::GLbitfield flags)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFenceSync(" << toHex(condition) << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFenceSync);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(condition);
+		traceRecord->args[1] = encodeCallTraceArg(flags);
+	}
 	glw::GLsync returnValue = m_gl.fenceSync(condition, flags);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -1436,119 +3219,250 @@ void CallLogWrapper::glFinish (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFinish(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFinish);
 	m_gl.finish();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFlush (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlush(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFlush);
 	m_gl.flush();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFlushMappedBufferRange (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr length)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFlushMappedBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+	}
 	m_gl.flushMappedBufferRange(target, offset, length);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFlushMappedNamedBufferRange (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr length)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedNamedBufferRange(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFlushMappedNamedBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+	}
 	m_gl.flushMappedNamedBufferRange(buffer, offset, length);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferDrawBufferEXT (glw::GLuint framebuffer, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferDrawBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferDrawBufferEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(mode);
+	}
 	m_gl.framebufferDrawBufferEXT(framebuffer, mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferDrawBuffersEXT (glw::GLuint framebuffer, glw::GLsizei n, const glw::GLenum *bufs)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferDrawBuffersEXT(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferDrawBuffersEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(n);
+		traceRecord->args[2] = encodeCallTraceArg(bufs);
+	}
 	m_gl.framebufferDrawBuffersEXT(framebuffer, n, bufs);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferParameteri (glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferParameteri(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.framebufferParameteri(target, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferReadBufferEXT (glw::GLuint framebuffer, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferReadBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferReadBufferEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(mode);
+	}
 	m_gl.framebufferReadBufferEXT(framebuffer, mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferRenderbuffer (glw::GLenum target, glw::GLenum attachment, glw::GLenum renderbuffertarget, glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferRenderbuffer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferTargetStr(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferRenderbuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(renderbuffertarget);
+		traceRecord->args[3] = encodeCallTraceArg(renderbuffer);
+	}
 	m_gl.framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferTexture (glw::GLenum target, glw::GLenum attachment, glw::GLuint texture, glw::GLint level)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferTexture);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(texture);
+		traceRecord->args[3] = encodeCallTraceArg(level);
+	}
 	m_gl.framebufferTexture(target, attachment, texture, level);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferTexture1D (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture1D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferTexture1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(textarget);
+		traceRecord->args[3] = encodeCallTraceArg(texture);
+		traceRecord->args[4] = encodeCallTraceArg(level);
+	}
 	m_gl.framebufferTexture1D(target, attachment, textarget, texture, level);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferTexture2D (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture2D(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getTextureTargetStr(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferTexture2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(textarget);
+		traceRecord->args[3] = encodeCallTraceArg(texture);
+		traceRecord->args[4] = encodeCallTraceArg(level);
+	}
 	m_gl.framebufferTexture2D(target, attachment, textarget, texture, level);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferTexture3D (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level, glw::GLint zoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture3D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferTexture3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(textarget);
+		traceRecord->args[3] = encodeCallTraceArg(texture);
+		traceRecord->args[4] = encodeCallTraceArg(level);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+	}
 	m_gl.framebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferTexture3DOES (glw::GLenum target, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level, glw::GLint zoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture3DOES(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferTexture3DOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(textarget);
+		traceRecord->args[3] = encodeCallTraceArg(texture);
+		traceRecord->args[4] = encodeCallTraceArg(level);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+	}
 	m_gl.framebufferTexture3DOES(target, attachment, textarget, texture, level, zoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFramebufferTextureLayer (glw::GLenum target, glw::GLenum attachment, glw::GLuint texture, glw::GLint level, glw::GLint layer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureLayer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFramebufferTextureLayer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(texture);
+		traceRecord->args[3] = encodeCallTraceArg(level);
+		traceRecord->args[4] = encodeCallTraceArg(layer);
+	}
 	m_gl.framebufferTextureLayer(target, attachment, texture, level, layer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glFrontFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFrontFace(" << getWindingStr(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glFrontFace);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mode);
 	m_gl.frontFace(mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGenBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenBuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(buffers);
+	}
 	m_gl.genBuffers(n, buffers);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// buffers = " << getPointerStr(buffers, n) << TestLog::EndMessage;
 }
@@ -1557,7 +3471,14 @@ void CallLogWrapper::glGenFramebuffers (glw::GLsizei n, glw::GLuint *framebuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenFramebuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(framebuffers);
+	}
 	m_gl.genFramebuffers(n, framebuffers);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// framebuffers = " << getPointerStr(framebuffers, n) << TestLog::EndMessage;
 }
@@ -1566,7 +3487,14 @@ void CallLogWrapper::glGenProgramPipelines (glw::GLsizei n, glw::GLuint *pipelin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenProgramPipelines);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(pipelines);
+	}
 	m_gl.genProgramPipelines(n, pipelines);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// pipelines = " << getPointerStr(pipelines, n) << TestLog::EndMessage;
 }
@@ -1575,7 +3503,14 @@ void CallLogWrapper::glGenQueries (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenQueries);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(ids);
+	}
 	m_gl.genQueries(n, ids);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
 }
@@ -1584,7 +3519,14 @@ void CallLogWrapper::glGenRenderbuffers (glw::GLsizei n, glw::GLuint *renderbuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenRenderbuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(renderbuffers);
+	}
 	m_gl.genRenderbuffers(n, renderbuffers);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// renderbuffers = " << getPointerStr(renderbuffers, n) << TestLog::EndMessage;
 }
@@ -1593,14 +3535,28 @@ void CallLogWrapper::glGenSamplers (glw::GLsizei count, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenSamplers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(count);
+		traceRecord->args[1] = encodeCallTraceArg(samplers);
+	}
 	m_gl.genSamplers(count, samplers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGenTextures (glw::GLsizei n, glw::GLuint *textures)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenTextures);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(textures);
+	}
 	m_gl.genTextures(n, textures);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// textures = " << getPointerStr(textures, n) << TestLog::EndMessage;
 }
@@ -1609,7 +3565,14 @@ void CallLogWrapper::glGenTransformFeedbacks (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenTransformFeedbacks);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(ids);
+	}
 	m_gl.genTransformFeedbacks(n, ids);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
 }
@@ -1618,7 +3581,14 @@ void CallLogWrapper::glGenVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenVertexArrays);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(n);
+		traceRecord->args[1] = encodeCallTraceArg(arrays);
+	}
 	m_gl.genVertexArrays(n, arrays);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// arrays = " << getPointerStr(arrays, n) << TestLog::EndMessage;
 }
@@ -1627,63 +3597,143 @@ void CallLogWrapper::glGenerateMipmap (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateMipmap(" << getTextureTargetStr(target) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenerateMipmap);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(target);
 	m_gl.generateMipmap(target);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGenerateMultiTexMipmapEXT (glw::GLenum texunit, glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateMultiTexMipmapEXT(" << toHex(texunit) << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenerateMultiTexMipmapEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+	}
 	m_gl.generateMultiTexMipmapEXT(texunit, target);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGenerateTextureMipmap (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateTextureMipmap(" << texture << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGenerateTextureMipmap);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(texture);
 	m_gl.generateTextureMipmap(texture);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveAtomicCounterBufferiv (glw::GLuint program, glw::GLuint bufferIndex, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAtomicCounterBufferiv(" << program << ", " << bufferIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveAtomicCounterBufferiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(bufferIndex);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveAttrib (glw::GLuint program, glw::GLuint index, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLint *size, glw::GLenum *type, glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAttrib(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveAttrib);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(name);
+	}
 	m_gl.getActiveAttrib(program, index, bufSize, length, size, type, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveSubroutineName (glw::GLuint program, glw::GLenum shadertype, glw::GLuint index, glw::GLsizei bufsize, glw::GLsizei *length, glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveSubroutineName);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shadertype);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(bufsize);
+		traceRecord->args[4] = encodeCallTraceArg(length);
+		traceRecord->args[5] = encodeCallTraceArg(name);
+	}
 	m_gl.getActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveSubroutineUniformName (glw::GLuint program, glw::GLenum shadertype, glw::GLuint index, glw::GLsizei bufsize, glw::GLsizei *length, glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveSubroutineUniformName);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shadertype);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(bufsize);
+		traceRecord->args[4] = encodeCallTraceArg(length);
+		traceRecord->args[5] = encodeCallTraceArg(name);
+	}
 	m_gl.getActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveSubroutineUniformiv (glw::GLuint program, glw::GLenum shadertype, glw::GLuint index, glw::GLenum pname, glw::GLint *values)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformiv(" << program << ", " << toHex(shadertype) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveSubroutineUniformiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shadertype);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(pname);
+		traceRecord->args[4] = encodeCallTraceArg(values);
+	}
 	m_gl.getActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveUniform (glw::GLuint program, glw::GLuint index, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLint *size, glw::GLenum *type, glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniform(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveUniform);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(name);
+	}
 	m_gl.getActiveUniform(program, index, bufSize, length, size, type, name);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 	{
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -1697,28 +3747,67 @@ void CallLogWrapper::glGetActiveUniformBlockName (glw::GLuint program, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockName(" << program << ", " << uniformBlockIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveUniformBlockName);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(uniformBlockIndex);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+		traceRecord->args[4] = encodeCallTraceArg(uniformBlockName);
+	}
 	m_gl.getActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveUniformBlockiv (glw::GLuint program, glw::GLuint uniformBlockIndex, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockiv(" << program << ", " << uniformBlockIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveUniformBlockiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(uniformBlockIndex);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveUniformName (glw::GLuint program, glw::GLuint uniformIndex, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *uniformName)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformName(" << program << ", " << uniformIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveUniformName);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(uniformIndex);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+		traceRecord->args[4] = encodeCallTraceArg(uniformName);
+	}
 	m_gl.getActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetActiveUniformsiv (glw::GLuint program, glw::GLsizei uniformCount, const glw::GLuint *uniformIndices, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformsiv(" << program << ", " << uniformCount << ", " << getPointerStr(uniformIndices, uniformCount) << ", " << getUniformParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetActiveUniformsiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(uniformCount);
+		traceRecord->args[2] = encodeCallTraceArg(uniformIndices);
+		traceRecord->args[3] = encodeCallTraceArg(pname);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.getActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, uniformCount) << TestLog::EndMessage;
 }
@@ -1727,14 +3816,30 @@ void CallLogWrapper::glGetAttachedShaders (glw::GLuint program, glw::GLsizei max
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttachedShaders(" << program << ", " << maxCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetAttachedShaders);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(maxCount);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(shaders);
+	}
 	m_gl.getAttachedShaders(program, maxCount, count, shaders);
+	endCallTrace(traceRecord);
 }
 
 glw::GLint CallLogWrapper::glGetAttribLocation (glw::GLuint program, const glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttribLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetAttribLocation);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getAttribLocation(program, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -1744,14 +3849,30 @@ void CallLogWrapper::glGetBooleanIndexedvEXT (glw::GLenum target, glw::GLuint in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleanIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetBooleanIndexedvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getBooleanIndexedvEXT(target, index, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetBooleani_v (glw::GLenum target, glw::GLuint index, glw::GLboolean *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleani_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetBooleani_v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getBooleani_v(target, index, data);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
 }
@@ -1760,7 +3881,14 @@ void CallLogWrapper::glGetBooleanv (glw::GLenum pname, glw::GLboolean *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleanv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetBooleanv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(data);
+	}
 	m_gl.getBooleanv(pname, data);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -1769,63 +3897,150 @@ void CallLogWrapper::glGetBufferParameteri64v (glw::GLenum target, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteri64v(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetBufferParameteri64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getBufferParameteri64v(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetBufferParameteriv (glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteriv(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetBufferParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getBufferParameteriv(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetBufferPointerv (glw::GLenum target, glw::GLenum pname, void **params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferPointerv(" << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetBufferPointerv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getBufferPointerv(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetBufferSubData (glw::GLenum target, glw::GLintptr offset, glw::GLsizeiptr size, void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferSubData(" << toHex(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(data);
+	}
 	m_gl.getBufferSubData(target, offset, size, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetCompressedMultiTexImageEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint lod, void *img)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << lod << ", " << img << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetCompressedMultiTexImageEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(lod);
+		traceRecord->args[3] = encodeCallTraceArg(img);
+	}
 	m_gl.getCompressedMultiTexImageEXT(texunit, target, lod, img);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetCompressedTexImage (glw::GLenum target, glw::GLint level, void *img)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTexImage(" << toHex(target) << ", " << level << ", " << img << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetCompressedTexImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(img);
+	}
 	m_gl.getCompressedTexImage(target, level, img);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetCompressedTextureImage (glw::GLuint texture, glw::GLint level, glw::GLsizei bufSize, void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureImage(" << texture << ", " << level << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetCompressedTextureImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getCompressedTextureImage(texture, level, bufSize, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetCompressedTextureSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLsizei bufSize, void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetCompressedTextureSubImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(bufSize);
+		traceRecord->args[9] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	endCallTrace(traceRecord);
 }
 
 glw::GLuint CallLogWrapper::glGetDebugMessageLog (glw::GLuint count, glw::GLsizei bufSize, glw::GLenum *sources, glw::GLenum *types, glw::GLuint *ids, glw::GLenum *severities, glw::GLsizei *lengths, glw::GLchar *messageLog)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDebugMessageLog(" << count << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(types))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetDebugMessageLog);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(count);
+		traceRecord->args[1] = encodeCallTraceArg(bufSize);
+		traceRecord->args[2] = encodeCallTraceArg(sources);
+		traceRecord->args[3] = encodeCallTraceArg(types);
+		traceRecord->args[4] = encodeCallTraceArg(ids);
+		traceRecord->args[5] = encodeCallTraceArg(severities);
+		traceRecord->args[6] = encodeCallTraceArg(lengths);
+		traceRecord->args[7] = encodeCallTraceArg(messageLog);
+	}
 	glw::GLuint returnValue = m_gl.getDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -1835,28 +4050,53 @@ void CallLogWrapper::glGetDoubleIndexedvEXT (glw::GLenum target, glw::GLuint ind
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoubleIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetDoubleIndexedvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getDoubleIndexedvEXT(target, index, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetDoublei_v (glw::GLenum target, glw::GLuint index, glw::GLdouble *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublei_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetDoublei_v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getDoublei_v(target, index, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetDoublev (glw::GLenum pname, glw::GLdouble *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublev(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetDoublev);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(data);
+	}
 	m_gl.getDoublev(pname, data);
+	endCallTrace(traceRecord);
 }
 
 glw::GLenum CallLogWrapper::glGetError (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetError(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetError);
 	glw::GLenum returnValue = m_gl.getError();
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getErrorStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -1866,21 +4106,44 @@ void CallLogWrapper::glGetFloatIndexedvEXT (glw::GLenum target, glw::GLuint inde
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloatIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetFloatIndexedvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getFloatIndexedvEXT(target, index, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetFloati_v (glw::GLenum target, glw::GLuint index, glw::GLfloat *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloati_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetFloati_v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getFloati_v(target, index, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetFloatv (glw::GLenum pname, glw::GLfloat *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloatv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetFloatv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(data);
+	}
 	m_gl.getFloatv(pname, data);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -1889,7 +4152,14 @@ glw::GLint CallLogWrapper::glGetFragDataIndex (glw::GLuint program, const glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataIndex(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetFragDataIndex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getFragDataIndex(program, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -1899,7 +4169,14 @@ glw::GLint CallLogWrapper::glGetFragDataLocation (glw::GLuint program, const glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetFragDataLocation);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getFragDataLocation(program, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -1909,7 +4186,16 @@ void CallLogWrapper::glGetFramebufferAttachmentParameteriv (glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferAttachmentParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferAttachmentParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetFramebufferAttachmentParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getFramebufferAttachmentParameterValueStr(pname, params) << TestLog::EndMessage;
 }
@@ -1918,7 +4204,15 @@ void CallLogWrapper::glGetFramebufferParameteriv (glw::GLenum target, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetFramebufferParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getFramebufferParameteriv(target, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -1927,7 +4221,9 @@ glw::GLenum CallLogWrapper::glGetGraphicsResetStatus (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetGraphicsResetStatus(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetGraphicsResetStatus);
 	glw::GLenum returnValue = m_gl.getGraphicsResetStatus();
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -1937,7 +4233,15 @@ void CallLogWrapper::glGetInteger64i_v (glw::GLenum target, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64i_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetInteger64i_v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getInteger64i_v(target, index, data);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
 }
@@ -1946,7 +4250,14 @@ void CallLogWrapper::glGetInteger64v (glw::GLenum pname, glw::GLint64 *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64v(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetInteger64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(data);
+	}
 	m_gl.getInteger64v(pname, data);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -1955,14 +4266,30 @@ void CallLogWrapper::glGetIntegerIndexedvEXT (glw::GLenum target, glw::GLuint in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetIntegerIndexedvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getIntegerIndexedvEXT(target, index, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetIntegeri_v (glw::GLenum target, glw::GLuint index, glw::GLint *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegeri_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetIntegeri_v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getIntegeri_v(target, index, data);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
 }
@@ -1971,7 +4298,14 @@ void CallLogWrapper::glGetIntegerv (glw::GLenum pname, glw::GLint *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegerv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetIntegerv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(data);
+	}
 	m_gl.getIntegerv(pname, data);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -1980,21 +4314,52 @@ void CallLogWrapper::glGetInternalformatSampleivNV (glw::GLenum target, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformatSampleivNV(" << toHex(target) << ", " << toHex(internalformat) << ", " << samples << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetInternalformatSampleivNV);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(samples);
+		traceRecord->args[3] = encodeCallTraceArg(pname);
+		traceRecord->args[4] = encodeCallTraceArg(bufSize);
+		traceRecord->args[5] = encodeCallTraceArg(params);
+	}
 	m_gl.getInternalformatSampleivNV(target, internalformat, samples, pname, bufSize, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetInternalformati64v (glw::GLenum target, glw::GLenum internalformat, glw::GLenum pname, glw::GLsizei bufSize, glw::GLint64 *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformati64v(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetInternalformati64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(bufSize);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.getInternalformati64v(target, internalformat, pname, bufSize, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetInternalformativ (glw::GLenum target, glw::GLenum internalformat, glw::GLenum pname, glw::GLsizei bufSize, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformativ(" << getInternalFormatTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << getInternalFormatParameterStr(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetInternalformativ);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(bufSize);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.getInternalformativ(target, internalformat, pname, bufSize, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, bufSize) << TestLog::EndMessage;
 }
@@ -2003,91 +4368,211 @@ void CallLogWrapper::glGetMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexEnvfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexEnvfvEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexEnvivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexEnvivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLdouble *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexGendvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexGendvEXT(texunit, coord, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexGenfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexGenfvEXT(texunit, coord, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexGenivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexGenivEXT(texunit, coord, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexImageEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum format, glw::GLenum type, void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexImageEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(format);
+		traceRecord->args[4] = encodeCallTraceArg(type);
+		traceRecord->args[5] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getMultiTexImageEXT(texunit, target, level, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexLevelParameterfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum pname, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexLevelParameterfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(pname);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexLevelParameterfvEXT(texunit, target, level, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexLevelParameterivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexLevelParameterivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(pname);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexLevelParameterivEXT(texunit, target, level, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexParameterIivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexParameterIivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexParameterIuivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexParameterIuivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexParameterfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexParameterfvEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultiTexParameterivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultiTexParameterivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getMultiTexParameterivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetMultisamplefv (glw::GLenum pname, glw::GLuint index, glw::GLfloat *val)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultisamplefv(" << getMultisampleParameterStr(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(val))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetMultisamplefv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(val);
+	}
 	m_gl.getMultisamplefv(pname, index, val);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// val = " << getPointerStr(val, 2) << TestLog::EndMessage;
 }
@@ -2096,126 +4581,280 @@ void CallLogWrapper::glGetNamedBufferParameteri64v (glw::GLuint buffer, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteri64v(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedBufferParameteri64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedBufferParameteri64v(buffer, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedBufferParameteriv (glw::GLuint buffer, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteriv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedBufferParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedBufferParameteriv(buffer, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedBufferPointerv (glw::GLuint buffer, glw::GLenum pname, void **params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferPointerv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedBufferPointerv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedBufferPointerv(buffer, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedBufferSubData (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(data);
+	}
 	m_gl.getNamedBufferSubData(buffer, offset, size, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedFramebufferAttachmentParameteriv (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferAttachmentParameteriv(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedFramebufferAttachmentParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedFramebufferParameteriv (glw::GLuint framebuffer, glw::GLenum pname, glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferParameteriv(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedFramebufferParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.getNamedFramebufferParameteriv(framebuffer, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterIivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedProgramLocalParameterIivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedProgramLocalParameterIivEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterIuivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIuivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedProgramLocalParameterIuivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedProgramLocalParameterIuivEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterdvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLdouble *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterdvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedProgramLocalParameterdvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedProgramLocalParameterdvEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedProgramLocalParameterfvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterfvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedProgramLocalParameterfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedProgramLocalParameterfvEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedProgramStringEXT (glw::GLuint program, glw::GLenum target, glw::GLenum pname, void *string)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << string << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedProgramStringEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(string);
+	}
 	m_gl.getNamedProgramStringEXT(program, target, pname, string);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedProgramivEXT (glw::GLuint program, glw::GLenum target, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramivEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedProgramivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedProgramivEXT(program, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetNamedRenderbufferParameteriv (glw::GLuint renderbuffer, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedRenderbufferParameteriv(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetNamedRenderbufferParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(renderbuffer);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetObjectLabel (glw::GLenum identifier, glw::GLuint name, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *label)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectLabel(" << toHex(identifier) << ", " << name << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetObjectLabel);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(identifier);
+		traceRecord->args[1] = encodeCallTraceArg(name);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+		traceRecord->args[4] = encodeCallTraceArg(label);
+	}
 	m_gl.getObjectLabel(identifier, name, bufSize, length, label);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetObjectPtrLabel (const void *ptr, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *label)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectPtrLabel(" << ptr << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetObjectPtrLabel);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(ptr);
+		traceRecord->args[1] = encodeCallTraceArg(bufSize);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(label);
+	}
 	m_gl.getObjectPtrLabel(ptr, bufSize, length, label);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetPointerIndexedvEXT (glw::GLenum target, glw::GLuint index, void **data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetPointerIndexedvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+	}
 	m_gl.getPointerIndexedvEXT(target, index, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetPointeri_vEXT (glw::GLenum pname, glw::GLuint index, void **params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointeri_vEXT(" << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetPointeri_vEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getPointeri_vEXT(pname, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetPointerv (glw::GLenum pname, void **params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointerv(" << getPointerStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetPointerv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(params);
+	}
 	m_gl.getPointerv(pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2224,14 +4863,33 @@ void CallLogWrapper::glGetProgramBinary (glw::GLuint program, glw::GLsizei bufSi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramBinary(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))) << ", " << binary << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramBinary);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(bufSize);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(binaryFormat);
+		traceRecord->args[4] = encodeCallTraceArg(binary);
+	}
 	m_gl.getProgramBinary(program, bufSize, length, binaryFormat, binary);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetProgramInfoLog (glw::GLuint program, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *infoLog)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInfoLog(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramInfoLog);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(bufSize);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(infoLog);
+	}
 	m_gl.getProgramInfoLog(program, bufSize, length, infoLog);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
 }
@@ -2240,14 +4898,32 @@ void CallLogWrapper::glGetProgramInterfaceiv (glw::GLuint program, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInterfaceiv(" << program << ", " << toHex(programInterface) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramInterfaceiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(programInterface);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getProgramInterfaceiv(program, programInterface, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetProgramPipelineInfoLog (glw::GLuint pipeline, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *infoLog)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineInfoLog(" << pipeline << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramPipelineInfoLog);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pipeline);
+		traceRecord->args[1] = encodeCallTraceArg(bufSize);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(infoLog);
+	}
 	m_gl.getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
 }
@@ -2256,7 +4932,15 @@ void CallLogWrapper::glGetProgramPipelineiv (glw::GLuint pipeline, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineiv(" << pipeline << ", " << getPipelineParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramPipelineiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pipeline);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getProgramPipelineiv(pipeline, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2265,7 +4949,15 @@ glw::GLuint CallLogWrapper::glGetProgramResourceIndex (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceIndex(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramResourceIndex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(programInterface);
+		traceRecord->args[2] = encodeCallTraceArg(name);
+	}
 	glw::GLuint returnValue = m_gl.getProgramResourceIndex(program, programInterface, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2275,7 +4967,15 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocation (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocation(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramResourceLocation);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(programInterface);
+		traceRecord->args[2] = encodeCallTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getProgramResourceLocation(program, programInterface, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2285,7 +4985,15 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocationIndex (glw::GLuint progra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocationIndex(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramResourceLocationIndex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(programInterface);
+		traceRecord->args[2] = encodeCallTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getProgramResourceLocationIndex(program, programInterface, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2295,14 +5003,38 @@ void CallLogWrapper::glGetProgramResourceName (glw::GLuint program, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceName(" << program << ", " << toHex(programInterface) << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramResourceName);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(programInterface);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(bufSize);
+		traceRecord->args[4] = encodeCallTraceArg(length);
+		traceRecord->args[5] = encodeCallTraceArg(name);
+	}
 	m_gl.getProgramResourceName(program, programInterface, index, bufSize, length, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetProgramResourceiv (glw::GLuint program, glw::GLenum programInterface, glw::GLuint index, glw::GLsizei propCount, const glw::GLenum *props, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceiv(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << index << ", " << propCount << ", " << getEnumPointerStr(props, propCount, getProgramResourcePropertyName) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramResourceiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(programInterface);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(propCount);
+		traceRecord->args[4] = encodeCallTraceArg(props);
+		traceRecord->args[5] = encodeCallTraceArg(bufSize);
+		traceRecord->args[6] = encodeCallTraceArg(length);
+		traceRecord->args[7] = encodeCallTraceArg(params);
+	}
 	m_gl.getProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 	{
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -2314,14 +5046,31 @@ void CallLogWrapper::glGetProgramStageiv (glw::GLuint program, glw::GLenum shade
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramStageiv(" << program << ", " << toHex(shadertype) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramStageiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shadertype);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(values);
+	}
 	m_gl.getProgramStageiv(program, shadertype, pname, values);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetProgramiv (glw::GLuint program, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramiv(" << program << ", " << getProgramParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetProgramiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getProgramiv(program, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getProgramQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2330,42 +5079,95 @@ void CallLogWrapper::glGetQueryBufferObjecti64v (glw::GLuint id, glw::GLuint buf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjecti64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryBufferObjecti64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjecti64v(id, buffer, pname, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetQueryBufferObjectiv (glw::GLuint id, glw::GLuint buffer, glw::GLenum pname, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryBufferObjectiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjectiv(id, buffer, pname, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetQueryBufferObjectui64v (glw::GLuint id, glw::GLuint buffer, glw::GLenum pname, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectui64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryBufferObjectui64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjectui64v(id, buffer, pname, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetQueryBufferObjectuiv (glw::GLuint id, glw::GLuint buffer, glw::GLenum pname, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectuiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryBufferObjectuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjectuiv(id, buffer, pname, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetQueryIndexediv (glw::GLenum target, glw::GLuint index, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryIndexediv(" << toHex(target) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryIndexediv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getQueryIndexediv(target, index, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetQueryObjecti64v (glw::GLuint id, glw::GLenum pname, glw::GLint64 *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjecti64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryObjecti64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getQueryObjecti64v(id, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2374,7 +5176,15 @@ void CallLogWrapper::glGetQueryObjectiv (glw::GLuint id, glw::GLenum pname, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryObjectiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getQueryObjectiv(id, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2383,7 +5193,15 @@ void CallLogWrapper::glGetQueryObjectui64v (glw::GLuint id, glw::GLenum pname, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectui64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryObjectui64v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getQueryObjectui64v(id, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2392,7 +5210,15 @@ void CallLogWrapper::glGetQueryObjectuiv (glw::GLuint id, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectuiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryObjectuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getQueryObjectuiv(id, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2401,7 +5227,15 @@ void CallLogWrapper::glGetQueryiv (glw::GLenum target, glw::GLenum pname, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryiv(" << getQueryTargetStr(target) << ", " << getQueryParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetQueryiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getQueryiv(target, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2410,14 +5244,30 @@ void CallLogWrapper::glGetRenderbufferParameteriv (glw::GLenum target, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetRenderbufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getRenderbufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetRenderbufferParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getRenderbufferParameteriv(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetSamplerParameterIiv (glw::GLuint sampler, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetSamplerParameterIiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getSamplerParameterIiv(sampler, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2426,7 +5276,15 @@ void CallLogWrapper::glGetSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetSamplerParameterIuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getSamplerParameterIuiv(sampler, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2435,7 +5293,15 @@ void CallLogWrapper::glGetSamplerParameterfv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetSamplerParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getSamplerParameterfv(sampler, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2444,7 +5310,15 @@ void CallLogWrapper::glGetSamplerParameteriv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetSamplerParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getSamplerParameteriv(sampler, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2453,7 +5327,16 @@ void CallLogWrapper::glGetShaderInfoLog (glw::GLuint shader, glw::GLsizei bufSiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderInfoLog(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetShaderInfoLog);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(shader);
+		traceRecord->args[1] = encodeCallTraceArg(bufSize);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(infoLog);
+	}
 	m_gl.getShaderInfoLog(shader, bufSize, length, infoLog);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
 }
@@ -2462,21 +5345,47 @@ void CallLogWrapper::glGetShaderPrecisionFormat (glw::GLenum shadertype, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderPrecisionFormat(" << getShaderTypeStr(shadertype) << ", " << getPrecisionFormatTypeStr(precisiontype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(range))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(precision))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetShaderPrecisionFormat);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(shadertype);
+		traceRecord->args[1] = encodeCallTraceArg(precisiontype);
+		traceRecord->args[2] = encodeCallTraceArg(range);
+		traceRecord->args[3] = encodeCallTraceArg(precision);
+	}
 	m_gl.getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetShaderSource (glw::GLuint shader, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLchar *source)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderSource(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(source))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetShaderSource);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(shader);
+		traceRecord->args[1] = encodeCallTraceArg(bufSize);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(source);
+	}
 	m_gl.getShaderSource(shader, bufSize, length, source);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetShaderiv (glw::GLuint shader, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderiv(" << shader << ", " << getShaderParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetShaderiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(shader);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getShaderiv(shader, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2485,7 +5394,11 @@ const glw::GLubyte * CallLogWrapper::glGetString (glw::GLenum name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetString(" << getGettableStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetString);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(name);
 	const glw::GLubyte * returnValue = m_gl.getString(name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2495,7 +5408,14 @@ const glw::GLubyte * CallLogWrapper::glGetStringi (glw::GLenum name, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetStringi(" << getGettableStringStr(name) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetStringi);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(name);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	const glw::GLubyte * returnValue = m_gl.getStringi(name, index);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2505,7 +5425,15 @@ glw::GLuint CallLogWrapper::glGetSubroutineIndex (glw::GLuint program, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineIndex(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetSubroutineIndex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shadertype);
+		traceRecord->args[2] = encodeCallTraceArg(name);
+	}
 	glw::GLuint returnValue = m_gl.getSubroutineIndex(program, shadertype, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2515,7 +5443,15 @@ glw::GLint CallLogWrapper::glGetSubroutineUniformLocation (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineUniformLocation(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetSubroutineUniformLocation);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(shadertype);
+		traceRecord->args[2] = encodeCallTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getSubroutineUniformLocation(program, shadertype, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2525,21 +5461,50 @@ void CallLogWrapper::glGetSynciv (glw::GLsync sync, glw::GLenum pname, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSynciv(" << sync << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetSynciv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sync);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+		traceRecord->args[4] = encodeCallTraceArg(values);
+	}
 	m_gl.getSynciv(sync, pname, bufSize, length, values);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTexImage (glw::GLenum target, glw::GLint level, glw::GLenum format, glw::GLenum type, void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTexImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(format);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getTexImage(target, level, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTexLevelParameterfv (glw::GLenum target, glw::GLint level, glw::GLenum pname, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameterfv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTexLevelParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getTexLevelParameterfv(target, level, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2548,7 +5513,16 @@ void CallLogWrapper::glGetTexLevelParameteriv (glw::GLenum target, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameteriv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTexLevelParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getTexLevelParameteriv(target, level, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
 }
@@ -2557,7 +5531,15 @@ void CallLogWrapper::glGetTexParameterIiv (glw::GLenum target, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTexParameterIiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTexParameterIiv(target, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2566,7 +5548,15 @@ void CallLogWrapper::glGetTexParameterIuiv (glw::GLenum target, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTexParameterIuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTexParameterIuiv(target, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2575,7 +5565,15 @@ void CallLogWrapper::glGetTexParameterfv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTexParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTexParameterfv(target, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2584,7 +5582,15 @@ void CallLogWrapper::glGetTexParameteriv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTexParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTexParameteriv(target, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2593,91 +5599,214 @@ void CallLogWrapper::glGetTextureImage (glw::GLuint texture, glw::GLint level, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(format);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(bufSize);
+		traceRecord->args[5] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getTextureImage(texture, level, format, type, bufSize, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTextureLevelParameterfv (glw::GLuint texture, glw::GLint level, glw::GLenum pname, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterfv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureLevelParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getTextureLevelParameterfv(texture, level, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTextureLevelParameteriv (glw::GLuint texture, glw::GLint level, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameteriv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureLevelParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getTextureLevelParameteriv(texture, level, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTextureParameterIiv (glw::GLuint texture, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureParameterIiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTextureParameterIiv(texture, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTextureParameterIuiv (glw::GLuint texture, glw::GLenum pname, glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureParameterIuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTextureParameterIuiv(texture, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTextureParameterfv (glw::GLuint texture, glw::GLenum pname, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTextureParameterfv(texture, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTextureParameteriv (glw::GLuint texture, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getTextureParameteriv(texture, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTextureSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, glw::GLsizei bufSize, void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTextureSubImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(type);
+		traceRecord->args[10] = encodeCallTraceArg(bufSize);
+		traceRecord->args[11] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTransformFeedbackVarying (glw::GLuint program, glw::GLuint index, glw::GLsizei bufSize, glw::GLsizei *length, glw::GLsizei *size, glw::GLenum *type, glw::GLchar *name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackVarying(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTransformFeedbackVarying);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(name);
+	}
 	m_gl.getTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTransformFeedbacki64_v (glw::GLuint xfb, glw::GLenum pname, glw::GLuint index, glw::GLint64 *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki64_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTransformFeedbacki64_v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(xfb);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.getTransformFeedbacki64_v(xfb, pname, index, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTransformFeedbacki_v (glw::GLuint xfb, glw::GLenum pname, glw::GLuint index, glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTransformFeedbacki_v);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(xfb);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.getTransformFeedbacki_v(xfb, pname, index, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetTransformFeedbackiv (glw::GLuint xfb, glw::GLenum pname, glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackiv(" << xfb << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetTransformFeedbackiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(xfb);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.getTransformFeedbackiv(xfb, pname, param);
+	endCallTrace(traceRecord);
 }
 
 glw::GLuint CallLogWrapper::glGetUniformBlockIndex (glw::GLuint program, const glw::GLchar *uniformBlockName)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformBlockIndex(" << program << ", " << getStringStr(uniformBlockName) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformBlockIndex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(uniformBlockName);
+	}
 	glw::GLuint returnValue = m_gl.getUniformBlockIndex(program, uniformBlockName);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2687,7 +5816,16 @@ void CallLogWrapper::glGetUniformIndices (glw::GLuint program, glw::GLsizei unif
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformIndices(" << program << ", " << uniformCount << ", " << getPointerStr(uniformNames, uniformCount) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformIndices);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(uniformCount);
+		traceRecord->args[2] = encodeCallTraceArg(uniformNames);
+		traceRecord->args[3] = encodeCallTraceArg(uniformIndices);
+	}
 	m_gl.getUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// uniformIndices = " << getPointerStr(uniformIndices, uniformCount) << TestLog::EndMessage;
 }
@@ -2696,7 +5834,14 @@ glw::GLint CallLogWrapper::glGetUniformLocation (glw::GLuint program, const glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformLocation);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getUniformLocation(program, name);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2706,91 +5851,199 @@ void CallLogWrapper::glGetUniformSubroutineuiv (glw::GLenum shadertype, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformSubroutineuiv(" << toHex(shadertype) << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformSubroutineuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(shadertype);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getUniformSubroutineuiv(shadertype, location, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetUniformdv (glw::GLuint program, glw::GLint location, glw::GLdouble *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformdv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformdv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getUniformdv(program, location, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetUniformfv (glw::GLuint program, glw::GLint location, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformfv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getUniformfv(program, location, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetUniformiv (glw::GLuint program, glw::GLint location, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getUniformiv(program, location, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetUniformuiv (glw::GLuint program, glw::GLint location, glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformuiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetUniformuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getUniformuiv(program, location, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexArrayIndexed64iv (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, glw::GLint64 *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexed64iv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexArrayIndexed64iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.getVertexArrayIndexed64iv(vaobj, index, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexArrayIndexediv (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexediv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexArrayIndexediv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.getVertexArrayIndexediv(vaobj, index, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexArrayIntegeri_vEXT (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIntegeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexArrayIntegeri_vEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.getVertexArrayIntegeri_vEXT(vaobj, index, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexArrayIntegervEXT (glw::GLuint vaobj, glw::GLenum pname, glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIntegervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexArrayIntegervEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.getVertexArrayIntegervEXT(vaobj, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexArrayPointeri_vEXT (glw::GLuint vaobj, glw::GLuint index, glw::GLenum pname, void **param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayPointeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexArrayPointeri_vEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.getVertexArrayPointeri_vEXT(vaobj, index, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexArrayPointervEXT (glw::GLuint vaobj, glw::GLenum pname, void **param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayPointervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexArrayPointervEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.getVertexArrayPointervEXT(vaobj, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexArrayiv (glw::GLuint vaobj, glw::GLenum pname, glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayiv(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexArrayiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.getVertexArrayiv(vaobj, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexAttribIiv (glw::GLuint index, glw::GLenum pname, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexAttribIiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getVertexAttribIiv(index, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2799,7 +6052,15 @@ void CallLogWrapper::glGetVertexAttribIuiv (glw::GLuint index, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIuiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexAttribIuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getVertexAttribIuiv(index, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2808,28 +6069,60 @@ void CallLogWrapper::glGetVertexAttribLdv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribLdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexAttribLdv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getVertexAttribLdv(index, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexAttribPointerv (glw::GLuint index, glw::GLenum pname, void **pointer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribPointerv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexAttribPointerv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(pointer);
+	}
 	m_gl.getVertexAttribPointerv(index, pname, pointer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexAttribdv (glw::GLuint index, glw::GLenum pname, glw::GLdouble *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexAttribdv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getVertexAttribdv(index, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetVertexAttribfv (glw::GLuint index, glw::GLenum pname, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribfv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexAttribfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getVertexAttribfv(index, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2838,7 +6131,15 @@ void CallLogWrapper::glGetVertexAttribiv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetVertexAttribiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.getVertexAttribiv(index, pname, params);
+	endCallTrace(traceRecord);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
 }
@@ -2847,119 +6148,265 @@ void CallLogWrapper::glGetnCompressedTexImage (glw::GLenum target, glw::GLint lo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnCompressedTexImage(" << toHex(target) << ", " << lod << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetnCompressedTexImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(lod);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getnCompressedTexImage(target, lod, bufSize, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetnTexImage (glw::GLenum target, glw::GLint level, glw::GLenum format, glw::GLenum type, glw::GLsizei bufSize, void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetnTexImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(format);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(bufSize);
+		traceRecord->args[5] = encodeCallTraceArg(pixels);
+	}
 	m_gl.getnTexImage(target, level, format, type, bufSize, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetnUniformdv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLdouble *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformdv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetnUniformdv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getnUniformdv(program, location, bufSize, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetnUniformfv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformfv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetnUniformfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getnUniformfv(program, location, bufSize, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetnUniformiv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetnUniformiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getnUniformiv(program, location, bufSize, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glGetnUniformuiv (glw::GLuint program, glw::GLint location, glw::GLsizei bufSize, glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformuiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glGetnUniformuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(bufSize);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.getnUniformuiv(program, location, bufSize, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glHint (glw::GLenum target, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glHint(" << getHintStr(target) << ", " << getHintModeStr(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glHint);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(mode);
+	}
 	m_gl.hint(target, mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInsertEventMarkerEXT (glw::GLsizei length, const glw::GLchar *marker)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInsertEventMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInsertEventMarkerEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(length);
+		traceRecord->args[1] = encodeCallTraceArg(marker);
+	}
 	m_gl.insertEventMarkerEXT(length, marker);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateBufferData (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferData(" << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateBufferData);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
 	m_gl.invalidateBufferData(buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateBufferSubData (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr length)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferSubData(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+	}
 	m_gl.invalidateBufferSubData(buffer, offset, length);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateFramebuffer (glw::GLenum target, glw::GLsizei numAttachments, const glw::GLenum *attachments)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateFramebuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(numAttachments);
+		traceRecord->args[2] = encodeCallTraceArg(attachments);
+	}
 	m_gl.invalidateFramebuffer(target, numAttachments, attachments);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateNamedFramebufferData (glw::GLuint framebuffer, glw::GLsizei numAttachments, const glw::GLenum *attachments)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateNamedFramebufferData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(numAttachments);
+		traceRecord->args[2] = encodeCallTraceArg(attachments);
+	}
 	m_gl.invalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateNamedFramebufferSubData (glw::GLuint framebuffer, glw::GLsizei numAttachments, const glw::GLenum *attachments, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferSubData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateNamedFramebufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(numAttachments);
+		traceRecord->args[2] = encodeCallTraceArg(attachments);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+	}
 	m_gl.invalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateSubFramebuffer (glw::GLenum target, glw::GLsizei numAttachments, const glw::GLenum *attachments, glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateSubFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateSubFramebuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(numAttachments);
+		traceRecord->args[2] = encodeCallTraceArg(attachments);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+	}
 	m_gl.invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateTexImage (glw::GLuint texture, glw::GLint level)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexImage(" << texture << ", " << level << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateTexImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+	}
 	m_gl.invalidateTexImage(texture, level);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glInvalidateTexSubImage (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glInvalidateTexSubImage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+	}
 	m_gl.invalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	endCallTrace(traceRecord);
 }
 
 glw::GLboolean CallLogWrapper::glIsBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsBuffer(" << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsBuffer);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
 	glw::GLboolean returnValue = m_gl.isBuffer(buffer);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2969,7 +6416,11 @@ glw::GLboolean CallLogWrapper::glIsEnabled (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabled(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsEnabled);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(cap);
 	glw::GLboolean returnValue = m_gl.isEnabled(cap);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2979,7 +6430,14 @@ glw::GLboolean CallLogWrapper::glIsEnabledIndexedEXT (glw::GLenum target, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabledIndexedEXT(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsEnabledIndexedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	glw::GLboolean returnValue = m_gl.isEnabledIndexedEXT(target, index);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2989,7 +6447,14 @@ glw::GLboolean CallLogWrapper::glIsEnabledi (glw::GLenum target, glw::GLuint ind
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabledi(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsEnabledi);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+	}
 	glw::GLboolean returnValue = m_gl.isEnabledi(target, index);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -2999,7 +6464,11 @@ glw::GLboolean CallLogWrapper::glIsFramebuffer (glw::GLuint framebuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsFramebuffer(" << framebuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsFramebuffer);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
 	glw::GLboolean returnValue = m_gl.isFramebuffer(framebuffer);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3009,7 +6478,11 @@ glw::GLboolean CallLogWrapper::glIsProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgram(" << program << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsProgram);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(program);
 	glw::GLboolean returnValue = m_gl.isProgram(program);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3019,7 +6492,11 @@ glw::GLboolean CallLogWrapper::glIsProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsProgramPipeline);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(pipeline);
 	glw::GLboolean returnValue = m_gl.isProgramPipeline(pipeline);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3029,7 +6506,11 @@ glw::GLboolean CallLogWrapper::glIsQuery (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsQuery(" << id << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsQuery);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(id);
 	glw::GLboolean returnValue = m_gl.isQuery(id);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3039,7 +6520,11 @@ glw::GLboolean CallLogWrapper::glIsRenderbuffer (glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsRenderbuffer(" << renderbuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsRenderbuffer);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(renderbuffer);
 	glw::GLboolean returnValue = m_gl.isRenderbuffer(renderbuffer);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3049,7 +6534,11 @@ glw::GLboolean CallLogWrapper::glIsSampler (glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSampler(" << sampler << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsSampler);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
 	glw::GLboolean returnValue = m_gl.isSampler(sampler);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3059,7 +6548,11 @@ glw::GLboolean CallLogWrapper::glIsShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsShader(" << shader << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsShader);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(shader);
 	glw::GLboolean returnValue = m_gl.isShader(shader);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3069,7 +6562,11 @@ glw::GLboolean CallLogWrapper::glIsSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSync(" << sync << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsSync);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(sync);
 	glw::GLboolean returnValue = m_gl.isSync(sync);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3079,7 +6576,11 @@ glw::GLboolean CallLogWrapper::glIsTexture (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTexture(" << texture << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsTexture);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(texture);
 	glw::GLboolean returnValue = m_gl.isTexture(texture);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3089,7 +6590,11 @@ glw::GLboolean CallLogWrapper::glIsTransformFeedback (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTransformFeedback(" << id << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsTransformFeedback);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(id);
 	glw::GLboolean returnValue = m_gl.isTransformFeedback(id);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3099,7 +6604,11 @@ glw::GLboolean CallLogWrapper::glIsVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsVertexArray(" << array << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glIsVertexArray);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(array);
 	glw::GLboolean returnValue = m_gl.isVertexArray(array);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3109,28 +6618,47 @@ void CallLogWrapper::glLineWidth (glw::GLfloat width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLineWidth(" << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glLineWidth);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(width);
 	m_gl.lineWidth(width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glLinkProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLinkProgram(" << program << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glLinkProgram);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(program);
 	m_gl.linkProgram(program);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glLogicOp (glw::GLenum opcode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLogicOp(" << toHex(opcode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glLogicOp);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(opcode);
 	m_gl.logicOp(opcode);
+	endCallTrace(traceRecord);
 }
 
 void * CallLogWrapper::glMapBuffer (glw::GLenum target, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBuffer(" << toHex(target) << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMapBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(access);
+	}
 	void * returnValue = m_gl.mapBuffer(target, access);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3140,7 +6668,16 @@ void * CallLogWrapper::glMapBufferRange (glw::GLenum target, glw::GLintptr offse
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ", " << getBufferMapFlagsStr(access) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMapBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(access);
+	}
 	void * returnValue = m_gl.mapBufferRange(target, offset, length, access);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3150,7 +6687,14 @@ void * CallLogWrapper::glMapNamedBuffer (glw::GLuint buffer, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBuffer(" << buffer << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMapNamedBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(access);
+	}
 	void * returnValue = m_gl.mapNamedBuffer(buffer, access);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3160,7 +6704,16 @@ void * CallLogWrapper::glMapNamedBufferRange (glw::GLuint buffer, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferRange(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMapNamedBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(access);
+	}
 	void * returnValue = m_gl.mapNamedBufferRange(buffer, offset, length, access);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -3170,2114 +6723,4870 @@ void CallLogWrapper::glMatrixFrustumEXT (glw::GLenum mode, glw::GLdouble left, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixFrustumEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixFrustumEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(left);
+		traceRecord->args[2] = encodeCallTraceArg(right);
+		traceRecord->args[3] = encodeCallTraceArg(bottom);
+		traceRecord->args[4] = encodeCallTraceArg(top);
+		traceRecord->args[5] = encodeCallTraceArg(zNear);
+		traceRecord->args[6] = encodeCallTraceArg(zFar);
+	}
 	m_gl.matrixFrustumEXT(mode, left, right, bottom, top, zNear, zFar);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixLoadIdentityEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadIdentityEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixLoadIdentityEXT);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mode);
 	m_gl.matrixLoadIdentityEXT(mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixLoadTransposedEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixLoadTransposedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixLoadTransposedEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixLoadTransposefEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixLoadTransposefEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixLoadTransposefEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixLoaddEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoaddEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixLoaddEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixLoaddEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixLoadfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixLoadfEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixLoadfEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixMultTransposedEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixMultTransposedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixMultTransposedEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixMultTransposefEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixMultTransposefEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixMultTransposefEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixMultdEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultdEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixMultdEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixMultdEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixMultfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixMultfEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(m);
+	}
 	m_gl.matrixMultfEXT(mode, m);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixOrthoEXT (glw::GLenum mode, glw::GLdouble left, glw::GLdouble right, glw::GLdouble bottom, glw::GLdouble top, glw::GLdouble zNear, glw::GLdouble zFar)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixOrthoEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixOrthoEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(left);
+		traceRecord->args[2] = encodeCallTraceArg(right);
+		traceRecord->args[3] = encodeCallTraceArg(bottom);
+		traceRecord->args[4] = encodeCallTraceArg(top);
+		traceRecord->args[5] = encodeCallTraceArg(zNear);
+		traceRecord->args[6] = encodeCallTraceArg(zFar);
+	}
 	m_gl.matrixOrthoEXT(mode, left, right, bottom, top, zNear, zFar);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixPopEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixPopEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixPopEXT);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mode);
 	m_gl.matrixPopEXT(mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixPushEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixPushEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixPushEXT);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mode);
 	m_gl.matrixPushEXT(mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixRotatedEXT (glw::GLenum mode, glw::GLdouble angle, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixRotatedEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixRotatedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(angle);
+		traceRecord->args[2] = encodeCallTraceArg(x);
+		traceRecord->args[3] = encodeCallTraceArg(y);
+		traceRecord->args[4] = encodeCallTraceArg(z);
+	}
 	m_gl.matrixRotatedEXT(mode, angle, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixRotatefEXT (glw::GLenum mode, glw::GLfloat angle, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixRotatefEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixRotatefEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(angle);
+		traceRecord->args[2] = encodeCallTraceArg(x);
+		traceRecord->args[3] = encodeCallTraceArg(y);
+		traceRecord->args[4] = encodeCallTraceArg(z);
+	}
 	m_gl.matrixRotatefEXT(mode, angle, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixScaledEXT (glw::GLenum mode, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixScaledEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixScaledEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.matrixScaledEXT(mode, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixScalefEXT (glw::GLenum mode, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixScalefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixScalefEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.matrixScalefEXT(mode, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixTranslatedEXT (glw::GLenum mode, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixTranslatedEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixTranslatedEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.matrixTranslatedEXT(mode, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMatrixTranslatefEXT (glw::GLenum mode, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixTranslatefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMatrixTranslatefEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.matrixTranslatefEXT(mode, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMaxShaderCompilerThreadsARB (glw::GLuint count)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMaxShaderCompilerThreadsARB(" << count << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMaxShaderCompilerThreadsARB);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(count);
 	m_gl.maxShaderCompilerThreadsARB(count);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMemoryBarrier (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrier(" << getMemoryBarrierFlagsStr(barriers) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMemoryBarrier);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(barriers);
 	m_gl.memoryBarrier(barriers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMemoryBarrierByRegion (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrierByRegion(" << toHex(barriers) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMemoryBarrierByRegion);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(barriers);
 	m_gl.memoryBarrierByRegion(barriers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMinSampleShading (glw::GLfloat value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMinSampleShading(" << value << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMinSampleShading);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(value);
 	m_gl.minSampleShading(value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiDrawArrays (glw::GLenum mode, const glw::GLint *first, const glw::GLsizei *count, glw::GLsizei drawcount)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(first))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiDrawArrays);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(first);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(drawcount);
+	}
 	m_gl.multiDrawArrays(mode, first, count, drawcount);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiDrawArraysIndirect (glw::GLenum mode, const void *indirect, glw::GLsizei drawcount, glw::GLsizei stride)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirect(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiDrawArraysIndirect);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(indirect);
+		traceRecord->args[2] = encodeCallTraceArg(drawcount);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+	}
 	m_gl.multiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiDrawArraysIndirectCountARB (glw::GLenum mode, glw::GLintptr indirect, glw::GLintptr drawcount, glw::GLsizei maxdrawcount, glw::GLsizei stride)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirectCountARB(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiDrawArraysIndirectCountARB);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(indirect);
+		traceRecord->args[2] = encodeCallTraceArg(drawcount);
+		traceRecord->args[3] = encodeCallTraceArg(maxdrawcount);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+	}
 	m_gl.multiDrawArraysIndirectCountARB(mode, indirect, drawcount, maxdrawcount, stride);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiDrawElements (glw::GLenum mode, const glw::GLsizei *count, glw::GLenum type, const void *const*indices, glw::GLsizei drawcount)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElements(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiDrawElements);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+		traceRecord->args[4] = encodeCallTraceArg(drawcount);
+	}
 	m_gl.multiDrawElements(mode, count, type, indices, drawcount);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiDrawElementsBaseVertex (glw::GLenum mode, const glw::GLsizei *count, glw::GLenum type, const void *const*indices, glw::GLsizei drawcount, const glw::GLint *basevertex)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiDrawElementsBaseVertex);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(indices);
+		traceRecord->args[4] = encodeCallTraceArg(drawcount);
+		traceRecord->args[5] = encodeCallTraceArg(basevertex);
+	}
 	m_gl.multiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiDrawElementsIndirect (glw::GLenum mode, glw::GLenum type, const void *indirect, glw::GLsizei drawcount, glw::GLsizei stride)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirect(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiDrawElementsIndirect);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(indirect);
+		traceRecord->args[3] = encodeCallTraceArg(drawcount);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+	}
 	m_gl.multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiDrawElementsIndirectCountARB (glw::GLenum mode, glw::GLenum type, glw::GLintptr indirect, glw::GLintptr drawcount, glw::GLsizei maxdrawcount, glw::GLsizei stride)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirectCountARB(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiDrawElementsIndirectCountARB);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(mode);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(indirect);
+		traceRecord->args[3] = encodeCallTraceArg(drawcount);
+		traceRecord->args[4] = encodeCallTraceArg(maxdrawcount);
+		traceRecord->args[5] = encodeCallTraceArg(stride);
+	}
 	m_gl.multiDrawElementsIndirectCountARB(mode, type, indirect, drawcount, maxdrawcount, stride);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexBufferEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum internalformat, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexBufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexBufferEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(buffer);
+	}
 	m_gl.multiTexBufferEXT(texunit, target, internalformat, buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexCoordPointerEXT (glw::GLenum texunit, glw::GLint size, glw::GLenum type, glw::GLsizei stride, const void *pointer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexCoordPointerEXT(" << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexCoordPointerEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+		traceRecord->args[4] = encodeCallTraceArg(pointer);
+	}
 	m_gl.multiTexCoordPointerEXT(texunit, size, type, stride, pointer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexEnvfEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexEnvfEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.multiTexEnvfEXT(texunit, target, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexEnvfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexEnvfvEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexEnviEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnviEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexEnviEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.multiTexEnviEXT(texunit, target, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexEnvivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexEnvivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexGendEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLdouble param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGendEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexGendEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.multiTexGendEXT(texunit, coord, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, const glw::GLdouble *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexGendvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexGendvEXT(texunit, coord, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexGenfEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenfEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexGenfEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.multiTexGenfEXT(texunit, coord, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, const glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexGenfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexGenfvEXT(texunit, coord, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexGeniEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGeniEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexGeniEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.multiTexGeniEXT(texunit, coord, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coord, glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexGenivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(coord);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexGenivEXT(texunit, coord, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(border);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+		traceRecord->args[7] = encodeCallTraceArg(type);
+		traceRecord->args[8] = encodeCallTraceArg(pixels);
+	}
 	m_gl.multiTexImage1DEXT(texunit, target, level, internalformat, width, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(type);
+		traceRecord->args[9] = encodeCallTraceArg(pixels);
+	}
 	m_gl.multiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(depth);
+		traceRecord->args[7] = encodeCallTraceArg(border);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(type);
+		traceRecord->args[10] = encodeCallTraceArg(pixels);
+	}
 	m_gl.multiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexParameterIivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexParameterIivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexParameterIuivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexParameterIuivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexParameterfEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexParameterfEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.multiTexParameterfEXT(texunit, target, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexParameterfvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexParameterfvEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexParameteriEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameteriEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexParameteriEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(param);
+	}
 	m_gl.multiTexParameteriEXT(texunit, target, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexParameterivEXT (glw::GLenum texunit, glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexParameterivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(pname);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.multiTexParameterivEXT(texunit, target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexRenderbufferEXT (glw::GLenum texunit, glw::GLenum target, glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexRenderbufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexRenderbufferEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(renderbuffer);
+	}
 	m_gl.multiTexRenderbufferEXT(texunit, target, renderbuffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexSubImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(format);
+		traceRecord->args[6] = encodeCallTraceArg(type);
+		traceRecord->args[7] = encodeCallTraceArg(pixels);
+	}
 	m_gl.multiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexSubImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(type);
+		traceRecord->args[9] = encodeCallTraceArg(pixels);
+	}
 	m_gl.multiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glMultiTexSubImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texunit);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+		traceRecord->args[8] = encodeCallTraceArg(depth);
+		traceRecord->args[9] = encodeCallTraceArg(format);
+		traceRecord->args[10] = encodeCallTraceArg(type);
+		traceRecord->args[11] = encodeCallTraceArg(pixels);
+	}
 	m_gl.multiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedBufferData (glw::GLuint buffer, glw::GLsizeiptr size, const void *data, glw::GLenum usage)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferData(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedBufferData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+		traceRecord->args[3] = encodeCallTraceArg(usage);
+	}
 	m_gl.namedBufferData(buffer, size, data, usage);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedBufferPageCommitmentARB (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLboolean commit)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentARB(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedBufferPageCommitmentARB);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(commit);
+	}
 	m_gl.namedBufferPageCommitmentARB(buffer, offset, size, commit);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedBufferPageCommitmentEXT (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, glw::GLboolean commit)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentEXT(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedBufferPageCommitmentEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(commit);
+	}
 	m_gl.namedBufferPageCommitmentEXT(buffer, offset, size, commit);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedBufferStorage (glw::GLuint buffer, glw::GLsizeiptr size, const void *data, glw::GLbitfield flags)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferStorage(" << buffer << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedBufferStorage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(data);
+		traceRecord->args[3] = encodeCallTraceArg(flags);
+	}
 	m_gl.namedBufferStorage(buffer, size, data, flags);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedBufferSubData (glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size, const void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedBufferSubData);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
+		traceRecord->args[1] = encodeCallTraceArg(offset);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(data);
+	}
 	m_gl.namedBufferSubData(buffer, offset, size, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedCopyBufferSubDataEXT (glw::GLuint readBuffer, glw::GLuint writeBuffer, glw::GLintptr readOffset, glw::GLintptr writeOffset, glw::GLsizeiptr size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedCopyBufferSubDataEXT(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedCopyBufferSubDataEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(readBuffer);
+		traceRecord->args[1] = encodeCallTraceArg(writeBuffer);
+		traceRecord->args[2] = encodeCallTraceArg(readOffset);
+		traceRecord->args[3] = encodeCallTraceArg(writeOffset);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+	}
 	m_gl.namedCopyBufferSubDataEXT(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferDrawBuffer (glw::GLuint framebuffer, glw::GLenum buf)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffer(" << framebuffer << ", " << toHex(buf) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferDrawBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(buf);
+	}
 	m_gl.namedFramebufferDrawBuffer(framebuffer, buf);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferDrawBuffers (glw::GLuint framebuffer, glw::GLsizei n, const glw::GLenum *bufs)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffers(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferDrawBuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(n);
+		traceRecord->args[2] = encodeCallTraceArg(bufs);
+	}
 	m_gl.namedFramebufferDrawBuffers(framebuffer, n, bufs);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferParameteri (glw::GLuint framebuffer, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferParameteri(" << framebuffer << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.namedFramebufferParameteri(framebuffer, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferReadBuffer (glw::GLuint framebuffer, glw::GLenum src)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferReadBuffer(" << framebuffer << ", " << toHex(src) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferReadBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(src);
+	}
 	m_gl.namedFramebufferReadBuffer(framebuffer, src);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferRenderbuffer (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum renderbuffertarget, glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferRenderbuffer(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferRenderbuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(renderbuffertarget);
+		traceRecord->args[3] = encodeCallTraceArg(renderbuffer);
+	}
 	m_gl.namedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferTexture (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLuint texture, glw::GLint level)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferTexture);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(texture);
+		traceRecord->args[3] = encodeCallTraceArg(level);
+	}
 	m_gl.namedFramebufferTexture(framebuffer, attachment, texture, level);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferTexture1DEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture1DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferTexture1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(textarget);
+		traceRecord->args[3] = encodeCallTraceArg(texture);
+		traceRecord->args[4] = encodeCallTraceArg(level);
+	}
 	m_gl.namedFramebufferTexture1DEXT(framebuffer, attachment, textarget, texture, level);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferTexture2DEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture2DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferTexture2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(textarget);
+		traceRecord->args[3] = encodeCallTraceArg(texture);
+		traceRecord->args[4] = encodeCallTraceArg(level);
+	}
 	m_gl.namedFramebufferTexture2DEXT(framebuffer, attachment, textarget, texture, level);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferTexture3DEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLenum textarget, glw::GLuint texture, glw::GLint level, glw::GLint zoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture3DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferTexture3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(textarget);
+		traceRecord->args[3] = encodeCallTraceArg(texture);
+		traceRecord->args[4] = encodeCallTraceArg(level);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+	}
 	m_gl.namedFramebufferTexture3DEXT(framebuffer, attachment, textarget, texture, level, zoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferTextureFaceEXT (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLuint texture, glw::GLint level, glw::GLenum face)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureFaceEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << toHex(face) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferTextureFaceEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(texture);
+		traceRecord->args[3] = encodeCallTraceArg(level);
+		traceRecord->args[4] = encodeCallTraceArg(face);
+	}
 	m_gl.namedFramebufferTextureFaceEXT(framebuffer, attachment, texture, level, face);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedFramebufferTextureLayer (glw::GLuint framebuffer, glw::GLenum attachment, glw::GLuint texture, glw::GLint level, glw::GLint layer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureLayer(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedFramebufferTextureLayer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(framebuffer);
+		traceRecord->args[1] = encodeCallTraceArg(attachment);
+		traceRecord->args[2] = encodeCallTraceArg(texture);
+		traceRecord->args[3] = encodeCallTraceArg(level);
+		traceRecord->args[4] = encodeCallTraceArg(layer);
+	}
 	m_gl.namedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4dEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameter4dEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(z);
+		traceRecord->args[6] = encodeCallTraceArg(w);
+	}
 	m_gl.namedProgramLocalParameter4dEXT(program, target, index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4dvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLdouble *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameter4dvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.namedProgramLocalParameter4dvEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4fEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z, glw::GLfloat w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameter4fEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(z);
+		traceRecord->args[6] = encodeCallTraceArg(w);
+	}
 	m_gl.namedProgramLocalParameter4fEXT(program, target, index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameter4fvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameter4fvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.namedProgramLocalParameter4fvEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4iEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLint x, glw::GLint y, glw::GLint z, glw::GLint w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4iEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameterI4iEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(z);
+		traceRecord->args[6] = encodeCallTraceArg(w);
+	}
 	m_gl.namedProgramLocalParameterI4iEXT(program, target, index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4ivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameterI4ivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.namedProgramLocalParameterI4ivEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4uiEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLuint x, glw::GLuint y, glw::GLuint z, glw::GLuint w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uiEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameterI4uiEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(x);
+		traceRecord->args[4] = encodeCallTraceArg(y);
+		traceRecord->args[5] = encodeCallTraceArg(z);
+		traceRecord->args[6] = encodeCallTraceArg(w);
+	}
 	m_gl.namedProgramLocalParameterI4uiEXT(program, target, index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameterI4uivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, const glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameterI4uivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(params);
+	}
 	m_gl.namedProgramLocalParameterI4uivEXT(program, target, index, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParameters4fvEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLsizei count, const glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameters4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParameters4fvEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(count);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.namedProgramLocalParameters4fvEXT(program, target, index, count, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParametersI4ivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLsizei count, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParametersI4ivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(count);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.namedProgramLocalParametersI4ivEXT(program, target, index, count, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramLocalParametersI4uivEXT (glw::GLuint program, glw::GLenum target, glw::GLuint index, glw::GLsizei count, const glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramLocalParametersI4uivEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(count);
+		traceRecord->args[4] = encodeCallTraceArg(params);
+	}
 	m_gl.namedProgramLocalParametersI4uivEXT(program, target, index, count, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedProgramStringEXT (glw::GLuint program, glw::GLenum target, glw::GLenum format, glw::GLsizei len, const void *string)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(format) << ", " << len << ", " << string << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedProgramStringEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(format);
+		traceRecord->args[3] = encodeCallTraceArg(len);
+		traceRecord->args[4] = encodeCallTraceArg(string);
+	}
 	m_gl.namedProgramStringEXT(program, target, format, len, string);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedRenderbufferStorage (glw::GLuint renderbuffer, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorage(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedRenderbufferStorage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(renderbuffer);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(width);
+		traceRecord->args[3] = encodeCallTraceArg(height);
+	}
 	m_gl.namedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedRenderbufferStorageMultisample (glw::GLuint renderbuffer, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisample(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedRenderbufferStorageMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(renderbuffer);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+	}
 	m_gl.namedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glNamedRenderbufferStorageMultisampleCoverageEXT (glw::GLuint renderbuffer, glw::GLsizei coverageSamples, glw::GLsizei colorSamples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisampleCoverageEXT(" << renderbuffer << ", " << coverageSamples << ", " << colorSamples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glNamedRenderbufferStorageMultisampleCoverageEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(renderbuffer);
+		traceRecord->args[1] = encodeCallTraceArg(coverageSamples);
+		traceRecord->args[2] = encodeCallTraceArg(colorSamples);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+	}
 	m_gl.namedRenderbufferStorageMultisampleCoverageEXT(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glObjectLabel (glw::GLenum identifier, glw::GLuint name, glw::GLsizei length, const glw::GLchar *label)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectLabel(" << toHex(identifier) << ", " << name << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glObjectLabel);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(identifier);
+		traceRecord->args[1] = encodeCallTraceArg(name);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(label);
+	}
 	m_gl.objectLabel(identifier, name, length, label);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glObjectPtrLabel (const void *ptr, glw::GLsizei length, const glw::GLchar *label)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectPtrLabel(" << ptr << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glObjectPtrLabel);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(ptr);
+		traceRecord->args[1] = encodeCallTraceArg(length);
+		traceRecord->args[2] = encodeCallTraceArg(label);
+	}
 	m_gl.objectPtrLabel(ptr, length, label);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPatchParameterfv (glw::GLenum pname, const glw::GLfloat *values)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPatchParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(values);
+	}
 	m_gl.patchParameterfv(pname, values);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPatchParameteri (glw::GLenum pname, glw::GLint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameteri(" << getPatchParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPatchParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(value);
+	}
 	m_gl.patchParameteri(pname, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPauseTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPauseTransformFeedback(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPauseTransformFeedback);
 	m_gl.pauseTransformFeedback();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPixelStoref (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStoref(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPixelStoref);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(param);
+	}
 	m_gl.pixelStoref(pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPixelStorei (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStorei(" << getPixelStoreParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPixelStorei);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(param);
+	}
 	m_gl.pixelStorei(pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPointParameterf (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterf(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPointParameterf);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(param);
+	}
 	m_gl.pointParameterf(pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPointParameterfv (glw::GLenum pname, const glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPointParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(params);
+	}
 	m_gl.pointParameterfv(pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPointParameteri (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteri(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPointParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(param);
+	}
 	m_gl.pointParameteri(pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPointParameteriv (glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteriv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPointParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pname);
+		traceRecord->args[1] = encodeCallTraceArg(params);
+	}
 	m_gl.pointParameteriv(pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPointSize (glw::GLfloat size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointSize(" << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPointSize);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(size);
 	m_gl.pointSize(size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPolygonMode (glw::GLenum face, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonMode(" << toHex(face) << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPolygonMode);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(face);
+		traceRecord->args[1] = encodeCallTraceArg(mode);
+	}
 	m_gl.polygonMode(face, mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPolygonOffset (glw::GLfloat factor, glw::GLfloat units)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonOffset(" << factor << ", " << units << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPolygonOffset);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(factor);
+		traceRecord->args[1] = encodeCallTraceArg(units);
+	}
 	m_gl.polygonOffset(factor, units);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPopDebugGroup (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopDebugGroup(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPopDebugGroup);
 	m_gl.popDebugGroup();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPopGroupMarkerEXT (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopGroupMarkerEXT(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPopGroupMarkerEXT);
 	m_gl.popGroupMarkerEXT();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPrimitiveBoundingBox (glw::GLfloat minX, glw::GLfloat minY, glw::GLfloat minZ, glw::GLfloat minW, glw::GLfloat maxX, glw::GLfloat maxY, glw::GLfloat maxZ, glw::GLfloat maxW)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveBoundingBox(" << minX << ", " << minY << ", " << minZ << ", " << minW << ", " << maxX << ", " << maxY << ", " << maxZ << ", " << maxW << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPrimitiveBoundingBox);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(minX);
+		traceRecord->args[1] = encodeCallTraceArg(minY);
+		traceRecord->args[2] = encodeCallTraceArg(minZ);
+		traceRecord->args[3] = encodeCallTraceArg(minW);
+		traceRecord->args[4] = encodeCallTraceArg(maxX);
+		traceRecord->args[5] = encodeCallTraceArg(maxY);
+		traceRecord->args[6] = encodeCallTraceArg(maxZ);
+		traceRecord->args[7] = encodeCallTraceArg(maxW);
+	}
 	m_gl.primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPrimitiveRestartIndex (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveRestartIndex(" << index << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPrimitiveRestartIndex);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(index);
 	m_gl.primitiveRestartIndex(index);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramBinary (glw::GLuint program, glw::GLenum binaryFormat, const void *binary, glw::GLsizei length)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramBinary(" << program << ", " << toHex(binaryFormat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramBinary);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(binaryFormat);
+		traceRecord->args[2] = encodeCallTraceArg(binary);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+	}
 	m_gl.programBinary(program, binaryFormat, binary, length);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramParameteri (glw::GLuint program, glw::GLenum pname, glw::GLint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramParameteri(" << program << ", " << getProgramParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.programParameteri(program, pname, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1d (glw::GLuint program, glw::GLint location, glw::GLdouble v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1d(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+	}
 	m_gl.programUniform1d(program, location, v0);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform1dv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1f (glw::GLuint program, glw::GLint location, glw::GLfloat v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1f(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+	}
 	m_gl.programUniform1f(program, location, v0);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform1fv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1i (glw::GLuint program, glw::GLint location, glw::GLint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1i(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+	}
 	m_gl.programUniform1i(program, location, v0);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform1iv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1ui (glw::GLuint program, glw::GLint location, glw::GLuint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1ui(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+	}
 	m_gl.programUniform1ui(program, location, v0);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform1uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform1uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform1uiv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2d (glw::GLuint program, glw::GLint location, glw::GLdouble v0, glw::GLdouble v1)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2d(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+	}
 	m_gl.programUniform2d(program, location, v0, v1);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform2dv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2f (glw::GLuint program, glw::GLint location, glw::GLfloat v0, glw::GLfloat v1)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2f(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+	}
 	m_gl.programUniform2f(program, location, v0, v1);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform2fv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2i (glw::GLuint program, glw::GLint location, glw::GLint v0, glw::GLint v1)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2i(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+	}
 	m_gl.programUniform2i(program, location, v0, v1);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform2iv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2ui (glw::GLuint program, glw::GLint location, glw::GLuint v0, glw::GLuint v1)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+	}
 	m_gl.programUniform2ui(program, location, v0, v1);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform2uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform2uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform2uiv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3d (glw::GLuint program, glw::GLint location, glw::GLdouble v0, glw::GLdouble v1, glw::GLdouble v2)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+	}
 	m_gl.programUniform3d(program, location, v0, v1, v2);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform3dv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3f (glw::GLuint program, glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+	}
 	m_gl.programUniform3f(program, location, v0, v1, v2);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform3fv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3i (glw::GLuint program, glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+	}
 	m_gl.programUniform3i(program, location, v0, v1, v2);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform3iv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3ui (glw::GLuint program, glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+	}
 	m_gl.programUniform3ui(program, location, v0, v1, v2);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform3uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform3uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform3uiv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4d (glw::GLuint program, glw::GLint location, glw::GLdouble v0, glw::GLdouble v1, glw::GLdouble v2, glw::GLdouble v3)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+		traceRecord->args[5] = encodeCallTraceArg(v3);
+	}
 	m_gl.programUniform4d(program, location, v0, v1, v2, v3);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform4dv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4f (glw::GLuint program, glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2, glw::GLfloat v3)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+		traceRecord->args[5] = encodeCallTraceArg(v3);
+	}
 	m_gl.programUniform4f(program, location, v0, v1, v2, v3);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform4fv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4i (glw::GLuint program, glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2, glw::GLint v3)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+		traceRecord->args[5] = encodeCallTraceArg(v3);
+	}
 	m_gl.programUniform4i(program, location, v0, v1, v2, v3);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4iv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform4iv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4ui (glw::GLuint program, glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2, glw::GLuint v3)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(v0);
+		traceRecord->args[3] = encodeCallTraceArg(v1);
+		traceRecord->args[4] = encodeCallTraceArg(v2);
+		traceRecord->args[5] = encodeCallTraceArg(v3);
+	}
 	m_gl.programUniform4ui(program, location, v0, v1, v2, v3);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniform4uiv (glw::GLuint program, glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniform4uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniform4uiv(program, location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix2dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix2fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix2x3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x3dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix2x3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x3fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix2x4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x4dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix2x4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix2x4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x4fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix3dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix3fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix3x2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x2dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix3x2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x2fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix3x4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x4dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix3x4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix3x4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x4fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix4dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix4dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix4fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix4fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x2dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix4x2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x2dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x2fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix4x2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x2fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x3dv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix4x3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x3dv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProgramUniformMatrix4x3fv (glw::GLuint program, glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProgramUniformMatrix4x3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(location);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(transpose);
+		traceRecord->args[4] = encodeCallTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x3fv(program, location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glProvokingVertex (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProvokingVertex(" << getProvokingVertexStr(mode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glProvokingVertex);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mode);
 	m_gl.provokingVertex(mode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPushClientAttribDefaultEXT (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPushClientAttribDefaultEXT);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mask);
 	m_gl.pushClientAttribDefaultEXT(mask);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPushDebugGroup (glw::GLenum source, glw::GLuint id, glw::GLsizei length, const glw::GLchar *message)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushDebugGroup(" << getDebugMessageSourceStr(source) << ", " << id << ", " << length << ", " << getStringStr(message) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPushDebugGroup);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(source);
+		traceRecord->args[1] = encodeCallTraceArg(id);
+		traceRecord->args[2] = encodeCallTraceArg(length);
+		traceRecord->args[3] = encodeCallTraceArg(message);
+	}
 	m_gl.pushDebugGroup(source, id, length, message);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glPushGroupMarkerEXT (glw::GLsizei length, const glw::GLchar *marker)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushGroupMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glPushGroupMarkerEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(length);
+		traceRecord->args[1] = encodeCallTraceArg(marker);
+	}
 	m_gl.pushGroupMarkerEXT(length, marker);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glQueryCounter (glw::GLuint id, glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glQueryCounter(" << id << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glQueryCounter);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(id);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+	}
 	m_gl.queryCounter(id, target);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glReadBuffer (glw::GLenum src)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadBuffer(" << getDrawReadBufferStr(src) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glReadBuffer);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(src);
 	m_gl.readBuffer(src);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glReadPixels (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glReadPixels);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(x);
+		traceRecord->args[1] = encodeCallTraceArg(y);
+		traceRecord->args[2] = encodeCallTraceArg(width);
+		traceRecord->args[3] = encodeCallTraceArg(height);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(pixels);
+	}
 	m_gl.readPixels(x, y, width, height, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glReadnPixels (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, glw::GLsizei bufSize, void *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadnPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << data << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glReadnPixels);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(x);
+		traceRecord->args[1] = encodeCallTraceArg(y);
+		traceRecord->args[2] = encodeCallTraceArg(width);
+		traceRecord->args[3] = encodeCallTraceArg(height);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(bufSize);
+		traceRecord->args[7] = encodeCallTraceArg(data);
+	}
 	m_gl.readnPixels(x, y, width, height, format, type, bufSize, data);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glReleaseShaderCompiler (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReleaseShaderCompiler(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glReleaseShaderCompiler);
 	m_gl.releaseShaderCompiler();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glRenderbufferStorage (glw::GLenum target, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorage(" << getFramebufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glRenderbufferStorage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(width);
+		traceRecord->args[3] = encodeCallTraceArg(height);
+	}
 	m_gl.renderbufferStorage(target, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glRenderbufferStorageMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorageMultisample(" << getFramebufferTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glRenderbufferStorageMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+	}
 	m_gl.renderbufferStorageMultisample(target, samples, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glResumeTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glResumeTransformFeedback(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glResumeTransformFeedback);
 	m_gl.resumeTransformFeedback();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSampleCoverage (glw::GLfloat value, glw::GLboolean invert)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleCoverage(" << value << ", " << getBooleanStr(invert) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSampleCoverage);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(value);
+		traceRecord->args[1] = encodeCallTraceArg(invert);
+	}
 	m_gl.sampleCoverage(value, invert);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSampleMaski (glw::GLuint maskNumber, glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleMaski(" << maskNumber << ", " << toHex(mask) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSampleMaski);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(maskNumber);
+		traceRecord->args[1] = encodeCallTraceArg(mask);
+	}
 	m_gl.sampleMaski(maskNumber, mask);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSamplerParameterIiv (glw::GLuint sampler, glw::GLenum pname, const glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSamplerParameterIiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.samplerParameterIiv(sampler, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum pname, const glw::GLuint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSamplerParameterIuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.samplerParameterIuiv(sampler, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSamplerParameterf (glw::GLuint sampler, glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterf(" << sampler << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSamplerParameterf);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.samplerParameterf(sampler, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSamplerParameterfv (glw::GLuint sampler, glw::GLenum pname, const glw::GLfloat *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSamplerParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.samplerParameterfv(sampler, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSamplerParameteri (glw::GLuint sampler, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteri(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSamplerParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.samplerParameteri(sampler, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glSamplerParameteriv (glw::GLuint sampler, glw::GLenum pname, const glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glSamplerParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sampler);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.samplerParameteriv(sampler, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glScissor (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissor(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glScissor);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(x);
+		traceRecord->args[1] = encodeCallTraceArg(y);
+		traceRecord->args[2] = encodeCallTraceArg(width);
+		traceRecord->args[3] = encodeCallTraceArg(height);
+	}
 	m_gl.scissor(x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glScissorArrayv (glw::GLuint first, glw::GLsizei count, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glScissorArrayv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(v);
+	}
 	m_gl.scissorArrayv(first, count, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glScissorIndexed (glw::GLuint index, glw::GLint left, glw::GLint bottom, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexed(" << index << ", " << left << ", " << bottom << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glScissorIndexed);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(left);
+		traceRecord->args[2] = encodeCallTraceArg(bottom);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+	}
 	m_gl.scissorIndexed(index, left, bottom, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glScissorIndexedv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexedv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glScissorIndexedv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.scissorIndexedv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glShaderBinary (glw::GLsizei count, const glw::GLuint *shaders, glw::GLenum binaryformat, const void *binary, glw::GLsizei length)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderBinary(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ", " << toHex(binaryformat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glShaderBinary);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(count);
+		traceRecord->args[1] = encodeCallTraceArg(shaders);
+		traceRecord->args[2] = encodeCallTraceArg(binaryformat);
+		traceRecord->args[3] = encodeCallTraceArg(binary);
+		traceRecord->args[4] = encodeCallTraceArg(length);
+	}
 	m_gl.shaderBinary(count, shaders, binaryformat, binary, length);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glShaderSource (glw::GLuint shader, glw::GLsizei count, const glw::GLchar *const*string, const glw::GLint *length)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderSource(" << shader << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glShaderSource);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(shader);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(string);
+		traceRecord->args[3] = encodeCallTraceArg(length);
+	}
 	m_gl.shaderSource(shader, count, string, length);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glShaderStorageBlockBinding (glw::GLuint program, glw::GLuint storageBlockIndex, glw::GLuint storageBlockBinding)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderStorageBlockBinding(" << program << ", " << storageBlockIndex << ", " << storageBlockBinding << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glShaderStorageBlockBinding);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(storageBlockIndex);
+		traceRecord->args[2] = encodeCallTraceArg(storageBlockBinding);
+	}
 	m_gl.shaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glStencilFunc (glw::GLenum func, glw::GLint ref, glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFunc(" << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glStencilFunc);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(func);
+		traceRecord->args[1] = encodeCallTraceArg(ref);
+		traceRecord->args[2] = encodeCallTraceArg(mask);
+	}
 	m_gl.stencilFunc(func, ref, mask);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glStencilFuncSeparate (glw::GLenum face, glw::GLenum func, glw::GLint ref, glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFuncSeparate(" << getFaceStr(face) << ", " << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glStencilFuncSeparate);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(face);
+		traceRecord->args[1] = encodeCallTraceArg(func);
+		traceRecord->args[2] = encodeCallTraceArg(ref);
+		traceRecord->args[3] = encodeCallTraceArg(mask);
+	}
 	m_gl.stencilFuncSeparate(face, func, ref, mask);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glStencilMask (glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMask(" << mask << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glStencilMask);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(mask);
 	m_gl.stencilMask(mask);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glStencilMaskSeparate (glw::GLenum face, glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMaskSeparate(" << getFaceStr(face) << ", " << mask << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glStencilMaskSeparate);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(face);
+		traceRecord->args[1] = encodeCallTraceArg(mask);
+	}
 	m_gl.stencilMaskSeparate(face, mask);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glStencilOp (glw::GLenum fail, glw::GLenum zfail, glw::GLenum zpass)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOp(" << getStencilOpStr(fail) << ", " << getStencilOpStr(zfail) << ", " << getStencilOpStr(zpass) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glStencilOp);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(fail);
+		traceRecord->args[1] = encodeCallTraceArg(zfail);
+		traceRecord->args[2] = encodeCallTraceArg(zpass);
+	}
 	m_gl.stencilOp(fail, zfail, zpass);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glStencilOpSeparate (glw::GLenum face, glw::GLenum sfail, glw::GLenum dpfail, glw::GLenum dppass)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOpSeparate(" << getFaceStr(face) << ", " << getStencilOpStr(sfail) << ", " << getStencilOpStr(dpfail) << ", " << getStencilOpStr(dppass) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glStencilOpSeparate);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(face);
+		traceRecord->args[1] = encodeCallTraceArg(sfail);
+		traceRecord->args[2] = encodeCallTraceArg(dpfail);
+		traceRecord->args[3] = encodeCallTraceArg(dppass);
+	}
 	m_gl.stencilOpSeparate(face, sfail, dpfail, dppass);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexBuffer (glw::GLenum target, glw::GLenum internalformat, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBuffer(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+	}
 	m_gl.texBuffer(target, internalformat, buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexBufferRange (glw::GLenum target, glw::GLenum internalformat, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBufferRange(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+	}
 	m_gl.texBufferRange(target, internalformat, buffer, offset, size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexImage1D (glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(border);
+		traceRecord->args[5] = encodeCallTraceArg(format);
+		traceRecord->args[6] = encodeCallTraceArg(type);
+		traceRecord->args[7] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texImage1D(target, level, internalformat, width, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexImage2D (glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(border);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+		traceRecord->args[7] = encodeCallTraceArg(type);
+		traceRecord->args[8] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexImage2DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLboolean fixedsamplelocations)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexImage2DMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(fixedsamplelocations);
+	}
 	m_gl.texImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexImage3D (glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(type);
+		traceRecord->args[9] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexImage3DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean fixedsamplelocations)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3DMultisample(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexImage3DMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+		traceRecord->args[6] = encodeCallTraceArg(fixedsamplelocations);
+	}
 	m_gl.texImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexImage3DOES (glw::GLenum target, glw::GLint level, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexImage3DOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(type);
+		traceRecord->args[9] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texImage3DOES(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexPageCommitmentARB (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean commit)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexPageCommitmentARB(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexPageCommitmentARB);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(commit);
+	}
 	m_gl.texPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexParameterIiv (glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexParameterIiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.texParameterIiv(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexParameterIuiv (glw::GLenum target, glw::GLenum pname, const glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexParameterIuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.texParameterIuiv(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexParameterf (glw::GLenum target, glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterf(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexParameterf);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.texParameterf(target, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexParameterfv (glw::GLenum target, glw::GLenum pname, const glw::GLfloat *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.texParameterfv(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexParameteri (glw::GLenum target, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteri(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.texParameteri(target, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexParameteriv (glw::GLenum target, glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.texParameteriv(target, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage1D (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage1D(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+	}
 	m_gl.texStorage1D(target, levels, internalformat, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage1DEXT (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage1DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+	}
 	m_gl.texStorage1DEXT(target, levels, internalformat, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage2D (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+	}
 	m_gl.texStorage2D(target, levels, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage2DEXT (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+	}
 	m_gl.texStorage2DEXT(target, levels, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage2DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLboolean fixedsamplelocations)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage2DMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(fixedsamplelocations);
+	}
 	m_gl.texStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage3D (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+	}
 	m_gl.texStorage3D(target, levels, internalformat, width, height, depth);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage3DEXT (glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+	}
 	m_gl.texStorage3DEXT(target, levels, internalformat, width, height, depth);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexStorage3DMultisample (glw::GLenum target, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean fixedsamplelocations)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexStorage3DMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+		traceRecord->args[6] = encodeCallTraceArg(fixedsamplelocations);
+	}
 	m_gl.texStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexSubImage1D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << width << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexSubImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texSubImage1D(target, level, xoffset, width, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexSubImage2D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexSubImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+		traceRecord->args[7] = encodeCallTraceArg(type);
+		traceRecord->args[8] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexSubImage3D (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexSubImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(type);
+		traceRecord->args[10] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexSubImage3DOES (glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexSubImage3DOES);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(target);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(type);
+		traceRecord->args[10] = encodeCallTraceArg(pixels);
+	}
 	m_gl.texSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureBarrier (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBarrier(" << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureBarrier);
 	m_gl.textureBarrier();
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureBuffer (glw::GLuint texture, glw::GLenum internalformat, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBuffer(" << texture << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+	}
 	m_gl.textureBuffer(texture, internalformat, buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureBufferRange (glw::GLuint texture, glw::GLenum internalformat, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferRange(" << texture << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(internalformat);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+	}
 	m_gl.textureBufferRange(texture, internalformat, buffer, offset, size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(border);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+		traceRecord->args[7] = encodeCallTraceArg(type);
+		traceRecord->args[8] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureImage1DEXT(texture, target, level, internalformat, width, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(border);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(type);
+		traceRecord->args[9] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureImage2DEXT(texture, target, level, internalformat, width, height, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLint border, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(depth);
+		traceRecord->args[7] = encodeCallTraceArg(border);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(type);
+		traceRecord->args[10] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTexturePageCommitmentEXT (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean commit)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexturePageCommitmentEXT(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTexturePageCommitmentEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(commit);
+	}
 	m_gl.texturePageCommitmentEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureParameterIiv (glw::GLuint texture, glw::GLenum pname, const glw::GLint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureParameterIiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.textureParameterIiv(texture, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureParameterIuiv (glw::GLuint texture, glw::GLenum pname, const glw::GLuint *params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureParameterIuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(params);
+	}
 	m_gl.textureParameterIuiv(texture, pname, params);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureParameterf (glw::GLuint texture, glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterf(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureParameterf);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.textureParameterf(texture, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureParameterfv (glw::GLuint texture, glw::GLenum pname, const glw::GLfloat *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureParameterfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.textureParameterfv(texture, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureParameteri (glw::GLuint texture, glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteri(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureParameteri);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.textureParameteri(texture, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureParameteriv (glw::GLuint texture, glw::GLenum pname, const glw::GLint *param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureParameteriv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(pname);
+		traceRecord->args[2] = encodeCallTraceArg(param);
+	}
 	m_gl.textureParameteriv(texture, pname, param);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureRenderbufferEXT (glw::GLuint texture, glw::GLenum target, glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureRenderbufferEXT(" << texture << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureRenderbufferEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(renderbuffer);
+	}
 	m_gl.textureRenderbufferEXT(texture, target, renderbuffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage1D (glw::GLuint texture, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage1D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+	}
 	m_gl.textureStorage1D(texture, levels, internalformat, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage1DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(levels);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+	}
 	m_gl.textureStorage1DEXT(texture, target, levels, internalformat, width);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage2D (glw::GLuint texture, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+	}
 	m_gl.textureStorage2D(texture, levels, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(levels);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+	}
 	m_gl.textureStorage2DEXT(texture, target, levels, internalformat, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage2DMultisample (glw::GLuint texture, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLboolean fixedsamplelocations)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage2DMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(fixedsamplelocations);
+	}
 	m_gl.textureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage3D (glw::GLuint texture, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(levels);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+	}
 	m_gl.textureStorage3D(texture, levels, internalformat, width, height, depth);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLsizei levels, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(levels);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(depth);
+	}
 	m_gl.textureStorage3DEXT(texture, target, levels, internalformat, width, height, depth);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureStorage3DMultisample (glw::GLuint texture, glw::GLsizei samples, glw::GLenum internalformat, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLboolean fixedsamplelocations)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureStorage3DMultisample);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(samples);
+		traceRecord->args[2] = encodeCallTraceArg(internalformat);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(height);
+		traceRecord->args[5] = encodeCallTraceArg(depth);
+		traceRecord->args[6] = encodeCallTraceArg(fixedsamplelocations);
+	}
 	m_gl.textureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureSubImage1D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureSubImage1D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(width);
+		traceRecord->args[4] = encodeCallTraceArg(format);
+		traceRecord->args[5] = encodeCallTraceArg(type);
+		traceRecord->args[6] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLsizei width, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureSubImage1DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(format);
+		traceRecord->args[6] = encodeCallTraceArg(type);
+		traceRecord->args[7] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureSubImage1DEXT(texture, target, level, xoffset, width, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureSubImage2D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureSubImage2D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(width);
+		traceRecord->args[5] = encodeCallTraceArg(height);
+		traceRecord->args[6] = encodeCallTraceArg(format);
+		traceRecord->args[7] = encodeCallTraceArg(type);
+		traceRecord->args[8] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLsizei width, glw::GLsizei height, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureSubImage2DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(format);
+		traceRecord->args[8] = encodeCallTraceArg(type);
+		traceRecord->args[9] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureSubImage3D (glw::GLuint texture, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureSubImage3D);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(level);
+		traceRecord->args[2] = encodeCallTraceArg(xoffset);
+		traceRecord->args[3] = encodeCallTraceArg(yoffset);
+		traceRecord->args[4] = encodeCallTraceArg(zoffset);
+		traceRecord->args[5] = encodeCallTraceArg(width);
+		traceRecord->args[6] = encodeCallTraceArg(height);
+		traceRecord->args[7] = encodeCallTraceArg(depth);
+		traceRecord->args[8] = encodeCallTraceArg(format);
+		traceRecord->args[9] = encodeCallTraceArg(type);
+		traceRecord->args[10] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum target, glw::GLint level, glw::GLint xoffset, glw::GLint yoffset, glw::GLint zoffset, glw::GLsizei width, glw::GLsizei height, glw::GLsizei depth, glw::GLenum format, glw::GLenum type, const void *pixels)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureSubImage3DEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(level);
+		traceRecord->args[3] = encodeCallTraceArg(xoffset);
+		traceRecord->args[4] = encodeCallTraceArg(yoffset);
+		traceRecord->args[5] = encodeCallTraceArg(zoffset);
+		traceRecord->args[6] = encodeCallTraceArg(width);
+		traceRecord->args[7] = encodeCallTraceArg(height);
+		traceRecord->args[8] = encodeCallTraceArg(depth);
+		traceRecord->args[9] = encodeCallTraceArg(format);
+		traceRecord->args[10] = encodeCallTraceArg(type);
+		traceRecord->args[11] = encodeCallTraceArg(pixels);
+	}
 	m_gl.textureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTextureView (glw::GLuint texture, glw::GLenum target, glw::GLuint origtexture, glw::GLenum internalformat, glw::GLuint minlevel, glw::GLuint numlevels, glw::GLuint minlayer, glw::GLuint numlayers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureView(" << texture << ", " << toHex(target) << ", " << origtexture << ", " << toHex(internalformat) << ", " << minlevel << ", " << numlevels << ", " << minlayer << ", " << numlayers << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTextureView);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(texture);
+		traceRecord->args[1] = encodeCallTraceArg(target);
+		traceRecord->args[2] = encodeCallTraceArg(origtexture);
+		traceRecord->args[3] = encodeCallTraceArg(internalformat);
+		traceRecord->args[4] = encodeCallTraceArg(minlevel);
+		traceRecord->args[5] = encodeCallTraceArg(numlevels);
+		traceRecord->args[6] = encodeCallTraceArg(minlayer);
+		traceRecord->args[7] = encodeCallTraceArg(numlayers);
+	}
 	m_gl.textureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTransformFeedbackBufferBase (glw::GLuint xfb, glw::GLuint index, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferBase(" << xfb << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTransformFeedbackBufferBase);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(xfb);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+	}
 	m_gl.transformFeedbackBufferBase(xfb, index, buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTransformFeedbackBufferRange (glw::GLuint xfb, glw::GLuint index, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizeiptr size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferRange(" << xfb << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTransformFeedbackBufferRange);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(xfb);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+		traceRecord->args[4] = encodeCallTraceArg(size);
+	}
 	m_gl.transformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glTransformFeedbackVaryings (glw::GLuint program, glw::GLsizei count, const glw::GLchar *const*varyings, glw::GLenum bufferMode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glTransformFeedbackVaryings);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(varyings);
+		traceRecord->args[3] = encodeCallTraceArg(bufferMode);
+	}
 	m_gl.transformFeedbackVaryings(program, count, varyings, bufferMode);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1d (glw::GLint location, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1d(" << location << ", " << x << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+	}
 	m_gl.uniform1d(location, x);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform1dv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1f (glw::GLint location, glw::GLfloat v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1f(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+	}
 	m_gl.uniform1f(location, v0);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform1fv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1i (glw::GLint location, glw::GLint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1i(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+	}
 	m_gl.uniform1i(location, v0);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform1iv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1ui (glw::GLint location, glw::GLuint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1ui(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+	}
 	m_gl.uniform1ui(location, v0);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform1uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform1uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform1uiv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2d (glw::GLint location, glw::GLdouble x, glw::GLdouble y)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2d(" << location << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+	}
 	m_gl.uniform2d(location, x, y);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform2dv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2f (glw::GLint location, glw::GLfloat v0, glw::GLfloat v1)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2f(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+	}
 	m_gl.uniform2f(location, v0, v1);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform2fv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2i (glw::GLint location, glw::GLint v0, glw::GLint v1)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2i(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+	}
 	m_gl.uniform2i(location, v0, v1);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform2iv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2ui (glw::GLint location, glw::GLuint v0, glw::GLuint v1)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2ui(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+	}
 	m_gl.uniform2ui(location, v0, v1);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform2uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform2uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform2uiv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3d (glw::GLint location, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3d(" << location << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.uniform3d(location, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform3dv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3f (glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+		traceRecord->args[3] = encodeCallTraceArg(v2);
+	}
 	m_gl.uniform3f(location, v0, v1, v2);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform3fv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3i (glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+		traceRecord->args[3] = encodeCallTraceArg(v2);
+	}
 	m_gl.uniform3i(location, v0, v1, v2);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform3iv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3ui (glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+		traceRecord->args[3] = encodeCallTraceArg(v2);
+	}
 	m_gl.uniform3ui(location, v0, v1, v2);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform3uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform3uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform3uiv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4d (glw::GLint location, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4d(" << location << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.uniform4d(location, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4dv (glw::GLint location, glw::GLsizei count, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform4dv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4f (glw::GLint location, glw::GLfloat v0, glw::GLfloat v1, glw::GLfloat v2, glw::GLfloat v3)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+		traceRecord->args[3] = encodeCallTraceArg(v2);
+		traceRecord->args[4] = encodeCallTraceArg(v3);
+	}
 	m_gl.uniform4f(location, v0, v1, v2, v3);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4fv (glw::GLint location, glw::GLsizei count, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform4fv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4i (glw::GLint location, glw::GLint v0, glw::GLint v1, glw::GLint v2, glw::GLint v3)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+		traceRecord->args[3] = encodeCallTraceArg(v2);
+		traceRecord->args[4] = encodeCallTraceArg(v3);
+	}
 	m_gl.uniform4i(location, v0, v1, v2, v3);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4iv (glw::GLint location, glw::GLsizei count, const glw::GLint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform4iv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4ui (glw::GLint location, glw::GLuint v0, glw::GLuint v1, glw::GLuint v2, glw::GLuint v3)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(v0);
+		traceRecord->args[2] = encodeCallTraceArg(v1);
+		traceRecord->args[3] = encodeCallTraceArg(v2);
+		traceRecord->args[4] = encodeCallTraceArg(v3);
+	}
 	m_gl.uniform4ui(location, v0, v1, v2, v3);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniform4uiv (glw::GLint location, glw::GLsizei count, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniform4uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(value);
+	}
 	m_gl.uniform4uiv(location, count, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformBlockBinding (glw::GLuint program, glw::GLuint uniformBlockIndex, glw::GLuint uniformBlockBinding)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformBlockBinding(" << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformBlockBinding);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(program);
+		traceRecord->args[1] = encodeCallTraceArg(uniformBlockIndex);
+		traceRecord->args[2] = encodeCallTraceArg(uniformBlockBinding);
+	}
 	m_gl.uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix2dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix2dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix2fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix2fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix2x3dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix2x3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix2x3dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix2x3fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix2x3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix2x3fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix2x4dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix2x4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix2x4dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix2x4fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix2x4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix2x4fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix3dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix3dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix3fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix3fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix3x2dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix3x2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix3x2dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix3x2fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix3x2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix3x2fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix3x4dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix3x4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix3x4dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix3x4fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix3x4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix3x4fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix4dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix4dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix4fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix4fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix4x2dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix4x2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix4x2dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix4x2fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix4x2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix4x2fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix4x3dv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLdouble *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix4x3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix4x3dv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformMatrix4x3fv (glw::GLint location, glw::GLsizei count, glw::GLboolean transpose, const glw::GLfloat *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformMatrix4x3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(location);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(transpose);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.uniformMatrix4x3fv(location, count, transpose, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUniformSubroutinesuiv (glw::GLenum shadertype, glw::GLsizei count, const glw::GLuint *indices)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformSubroutinesuiv(" << toHex(shadertype) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUniformSubroutinesuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(shadertype);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(indices);
+	}
 	m_gl.uniformSubroutinesuiv(shadertype, count, indices);
+	endCallTrace(traceRecord);
 }
 
 glw::GLboolean CallLogWrapper::glUnmapBuffer (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapBuffer(" << getBufferTargetStr(target) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUnmapBuffer);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(target);
 	glw::GLboolean returnValue = m_gl.unmapBuffer(target);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -5287,7 +11596,11 @@ glw::GLboolean CallLogWrapper::glUnmapNamedBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapNamedBuffer(" << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUnmapNamedBuffer);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(buffer);
 	glw::GLboolean returnValue = m_gl.unmapNamedBuffer(buffer);
+	endCallTrace(traceRecord, encodeCallTraceArg(returnValue));
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
 	return returnValue;
@@ -5297,817 +11610,1790 @@ void CallLogWrapper::glUseProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgram(" << program << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUseProgram);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(program);
 	m_gl.useProgram(program);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glUseProgramStages (glw::GLuint pipeline, glw::GLbitfield stages, glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgramStages(" << pipeline << ", " << getShaderTypeMaskStr(stages) << ", " << program << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glUseProgramStages);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(pipeline);
+		traceRecord->args[1] = encodeCallTraceArg(stages);
+		traceRecord->args[2] = encodeCallTraceArg(program);
+	}
 	m_gl.useProgramStages(pipeline, stages, program);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glValidateProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgram(" << program << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glValidateProgram);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(program);
 	m_gl.validateProgram(program);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glValidateProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glValidateProgramPipeline);
+	if (traceRecord)
+		traceRecord->args[0] = encodeCallTraceArg(pipeline);
 	m_gl.validateProgramPipeline(pipeline);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayAttribBinding (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLuint bindingindex)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribBinding(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayAttribBinding);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(bindingindex);
+	}
 	m_gl.vertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayAttribFormat (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayAttribFormat);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(normalized);
+		traceRecord->args[5] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayAttribIFormat (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribIFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayAttribIFormat);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayAttribLFormat (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribLFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayAttribLFormat);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayBindVertexBufferEXT (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizei stride)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayBindVertexBufferEXT(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayBindVertexBufferEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(bindingindex);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+	}
 	m_gl.vertexArrayBindVertexBufferEXT(vaobj, bindingindex, buffer, offset, stride);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayBindingDivisor (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint divisor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayBindingDivisor(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayBindingDivisor);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(bindingindex);
+		traceRecord->args[2] = encodeCallTraceArg(divisor);
+	}
 	m_gl.vertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayColorOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayColorOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+		traceRecord->args[5] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayEdgeFlagOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayEdgeFlagOffsetEXT(" << vaobj << ", " << buffer << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayEdgeFlagOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(stride);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayEdgeFlagOffsetEXT(vaobj, buffer, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayElementBuffer (glw::GLuint vaobj, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayElementBuffer(" << vaobj << ", " << buffer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayElementBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+	}
 	m_gl.vertexArrayElementBuffer(vaobj, buffer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayFogCoordOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayFogCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayFogCoordOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+		traceRecord->args[4] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayFogCoordOffsetEXT(vaobj, buffer, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayIndexOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayIndexOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayIndexOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+		traceRecord->args[4] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayIndexOffsetEXT(vaobj, buffer, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayMultiTexCoordOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum texunit, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayMultiTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayMultiTexCoordOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(texunit);
+		traceRecord->args[3] = encodeCallTraceArg(size);
+		traceRecord->args[4] = encodeCallTraceArg(type);
+		traceRecord->args[5] = encodeCallTraceArg(stride);
+		traceRecord->args[6] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayMultiTexCoordOffsetEXT(vaobj, buffer, texunit, size, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayNormalOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayNormalOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayNormalOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+		traceRecord->args[4] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayNormalOffsetEXT(vaobj, buffer, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArraySecondaryColorOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArraySecondaryColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArraySecondaryColorOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+		traceRecord->args[5] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArraySecondaryColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayTexCoordOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayTexCoordOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+		traceRecord->args[5] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayTexCoordOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribBindingEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLuint bindingindex)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribBindingEXT(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribBindingEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(bindingindex);
+	}
 	m_gl.vertexArrayVertexAttribBindingEXT(vaobj, attribindex, bindingindex);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribDivisorEXT (glw::GLuint vaobj, glw::GLuint index, glw::GLuint divisor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribDivisorEXT(" << vaobj << ", " << index << ", " << divisor << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribDivisorEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(index);
+		traceRecord->args[2] = encodeCallTraceArg(divisor);
+	}
 	m_gl.vertexArrayVertexAttribDivisorEXT(vaobj, index, divisor);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribFormatEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribFormatEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(normalized);
+		traceRecord->args[5] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayVertexAttribFormatEXT(vaobj, attribindex, size, type, normalized, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribIFormatEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribIFormatEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayVertexAttribIFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribIOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribIOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(size);
+		traceRecord->args[4] = encodeCallTraceArg(type);
+		traceRecord->args[5] = encodeCallTraceArg(stride);
+		traceRecord->args[6] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayVertexAttribIOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribLFormatEXT (glw::GLuint vaobj, glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribLFormatEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(attribindex);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayVertexAttribLFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribLOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribLOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(size);
+		traceRecord->args[4] = encodeCallTraceArg(type);
+		traceRecord->args[5] = encodeCallTraceArg(stride);
+		traceRecord->args[6] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayVertexAttribLOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexAttribOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexAttribOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(index);
+		traceRecord->args[3] = encodeCallTraceArg(size);
+		traceRecord->args[4] = encodeCallTraceArg(type);
+		traceRecord->args[5] = encodeCallTraceArg(normalized);
+		traceRecord->args[6] = encodeCallTraceArg(stride);
+		traceRecord->args[7] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayVertexAttribOffsetEXT(vaobj, buffer, index, size, type, normalized, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexBindingDivisorEXT (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint divisor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBindingDivisorEXT(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexBindingDivisorEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(bindingindex);
+		traceRecord->args[2] = encodeCallTraceArg(divisor);
+	}
 	m_gl.vertexArrayVertexBindingDivisorEXT(vaobj, bindingindex, divisor);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexBuffer (glw::GLuint vaobj, glw::GLuint bindingindex, glw::GLuint buffer, glw::GLintptr offset, glw::GLsizei stride)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffer(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexBuffer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(bindingindex);
+		traceRecord->args[2] = encodeCallTraceArg(buffer);
+		traceRecord->args[3] = encodeCallTraceArg(offset);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+	}
 	m_gl.vertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexBuffers (glw::GLuint vaobj, glw::GLuint first, glw::GLsizei count, const glw::GLuint *buffers, const glw::GLintptr *offsets, const glw::GLsizei *strides)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffers(" << vaobj << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexBuffers);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(first);
+		traceRecord->args[2] = encodeCallTraceArg(count);
+		traceRecord->args[3] = encodeCallTraceArg(buffers);
+		traceRecord->args[4] = encodeCallTraceArg(offsets);
+		traceRecord->args[5] = encodeCallTraceArg(strides);
+	}
 	m_gl.vertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexArrayVertexOffsetEXT (glw::GLuint vaobj, glw::GLuint buffer, glw::GLint size, glw::GLenum type, glw::GLsizei stride, glw::GLintptr offset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexArrayVertexOffsetEXT);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(vaobj);
+		traceRecord->args[1] = encodeCallTraceArg(buffer);
+		traceRecord->args[2] = encodeCallTraceArg(size);
+		traceRecord->args[3] = encodeCallTraceArg(type);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+		traceRecord->args[5] = encodeCallTraceArg(offset);
+	}
 	m_gl.vertexArrayVertexOffsetEXT(vaobj, buffer, size, type, stride, offset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib1d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+	}
 	m_gl.vertexAttrib1d(index, x);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib1dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1dv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib1dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib1dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib1f (glw::GLuint index, glw::GLfloat x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1f(" << index << ", " << x << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib1f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+	}
 	m_gl.vertexAttrib1f(index, x);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib1fv (glw::GLuint index, const glw::GLfloat *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1fv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib1fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib1fv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib1s (glw::GLuint index, glw::GLshort x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1s(" << index << ", " << x << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib1s);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+	}
 	m_gl.vertexAttrib1s(index, x);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib1sv (glw::GLuint index, const glw::GLshort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1sv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib1sv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib1sv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib2d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib2d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+	}
 	m_gl.vertexAttrib2d(index, x, y);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib2dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2dv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib2dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib2f (glw::GLuint index, glw::GLfloat x, glw::GLfloat y)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2f(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib2f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+	}
 	m_gl.vertexAttrib2f(index, x, y);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib2fv (glw::GLuint index, const glw::GLfloat *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2fv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib2fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib2fv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib2s (glw::GLuint index, glw::GLshort x, glw::GLshort y)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2s(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib2s);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+	}
 	m_gl.vertexAttrib2s(index, x, y);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib2sv (glw::GLuint index, const glw::GLshort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2sv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib2sv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib2sv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib3d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib3d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.vertexAttrib3d(index, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib3dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3dv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib3dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib3f (glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3f(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib3f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.vertexAttrib3f(index, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib3fv (glw::GLuint index, const glw::GLfloat *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3fv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib3fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib3fv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib3s (glw::GLuint index, glw::GLshort x, glw::GLshort y, glw::GLshort z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3s(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib3s);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.vertexAttrib3s(index, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib3sv (glw::GLuint index, const glw::GLshort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3sv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib3sv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib3sv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4Nbv (glw::GLuint index, const glw::GLbyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nbv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4Nbv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nbv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4Niv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Niv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4Niv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4Niv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4Nsv (glw::GLuint index, const glw::GLshort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nsv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4Nsv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nsv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4Nub (glw::GLuint index, glw::GLubyte x, glw::GLubyte y, glw::GLubyte z, glw::GLubyte w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nub(" << index << ", " << toHex(x) << ", " << toHex(y) << ", " << toHex(z) << ", " << toHex(w) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4Nub);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.vertexAttrib4Nub(index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4Nubv (glw::GLuint index, const glw::GLubyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4Nubv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nubv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4Nuiv (glw::GLuint index, const glw::GLuint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nuiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4Nuiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nuiv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4Nusv (glw::GLuint index, const glw::GLushort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nusv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4Nusv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nusv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4bv (glw::GLuint index, const glw::GLbyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4bv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4bv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.vertexAttrib4d(index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4dv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4f (glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat z, glw::GLfloat w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4f(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4f);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.vertexAttrib4f(index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4fv (glw::GLuint index, const glw::GLfloat *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4fv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4fv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4fv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4iv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4s (glw::GLuint index, glw::GLshort x, glw::GLshort y, glw::GLshort z, glw::GLshort w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4s(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4s);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.vertexAttrib4s(index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4sv (glw::GLuint index, const glw::GLshort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4sv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4sv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4ubv (glw::GLuint index, const glw::GLubyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4ubv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4ubv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4uiv (glw::GLuint index, const glw::GLuint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4uiv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttrib4usv (glw::GLuint index, const glw::GLushort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttrib4usv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttrib4usv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribBinding (glw::GLuint attribindex, glw::GLuint bindingindex)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribBinding(" << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribBinding);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(attribindex);
+		traceRecord->args[1] = encodeCallTraceArg(bindingindex);
+	}
 	m_gl.vertexAttribBinding(attribindex, bindingindex);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribDivisor (glw::GLuint index, glw::GLuint divisor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribDivisor(" << index << ", " << divisor << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribDivisor);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(divisor);
+	}
 	m_gl.vertexAttribDivisor(index, divisor);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribFormat (glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribFormat);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(attribindex);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(normalized);
+		traceRecord->args[4] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI1i (glw::GLuint index, glw::GLint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1i(" << index << ", " << x << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI1i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+	}
 	m_gl.vertexAttribI1i(index, x);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI1iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1iv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI1iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI1iv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI1ui (glw::GLuint index, glw::GLuint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1ui(" << index << ", " << x << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI1ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+	}
 	m_gl.vertexAttribI1ui(index, x);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI1uiv (glw::GLuint index, const glw::GLuint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1uiv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI1uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI1uiv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI2i (glw::GLuint index, glw::GLint x, glw::GLint y)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2i(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI2i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+	}
 	m_gl.vertexAttribI2i(index, x, y);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI2iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2iv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI2iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI2iv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI2ui (glw::GLuint index, glw::GLuint x, glw::GLuint y)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2ui(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI2ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+	}
 	m_gl.vertexAttribI2ui(index, x, y);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI2uiv (glw::GLuint index, const glw::GLuint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2uiv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI2uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI2uiv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI3i (glw::GLuint index, glw::GLint x, glw::GLint y, glw::GLint z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3i(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI3i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.vertexAttribI3i(index, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI3iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3iv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI3iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI3iv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI3ui (glw::GLuint index, glw::GLuint x, glw::GLuint y, glw::GLuint z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3ui(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI3ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.vertexAttribI3ui(index, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI3uiv (glw::GLuint index, const glw::GLuint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3uiv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI3uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI3uiv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4bv (glw::GLuint index, const glw::GLbyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4bv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI4bv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4i (glw::GLuint index, glw::GLint x, glw::GLint y, glw::GLint z, glw::GLint w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4i(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4i);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.vertexAttribI4i(index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4iv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI4iv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4sv (glw::GLuint index, const glw::GLshort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4sv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI4sv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4ubv (glw::GLuint index, const glw::GLubyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4ubv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI4ubv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4ui (glw::GLuint index, glw::GLuint x, glw::GLuint y, glw::GLuint z, glw::GLuint w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ui(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.vertexAttribI4ui(index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4uiv (glw::GLuint index, const glw::GLuint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI4uiv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribI4usv (glw::GLuint index, const glw::GLushort *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribI4usv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribI4usv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribIFormat (glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribIFormat);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(attribindex);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexAttribIFormat(attribindex, size, type, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribIPointer (glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, const void *pointer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribIPointer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+		traceRecord->args[4] = encodeCallTraceArg(pointer);
+	}
 	m_gl.vertexAttribIPointer(index, size, type, stride, pointer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL1d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+	}
 	m_gl.vertexAttribL1d(index, x);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL1dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL1dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribL1dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL2d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL2d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+	}
 	m_gl.vertexAttribL2d(index, x, y);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL2dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL2dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribL2dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL3d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL3d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+	}
 	m_gl.vertexAttribL3d(index, x, y, z);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL3dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL3dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribL3dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL4d (glw::GLuint index, glw::GLdouble x, glw::GLdouble y, glw::GLdouble z, glw::GLdouble w)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL4d);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(z);
+		traceRecord->args[4] = encodeCallTraceArg(w);
+	}
 	m_gl.vertexAttribL4d(index, x, y, z, w);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribL4dv (glw::GLuint index, const glw::GLdouble *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribL4dv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.vertexAttribL4dv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribLFormat (glw::GLuint attribindex, glw::GLint size, glw::GLenum type, glw::GLuint relativeoffset)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLFormat(" << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribLFormat);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(attribindex);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(relativeoffset);
+	}
 	m_gl.vertexAttribLFormat(attribindex, size, type, relativeoffset);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribLPointer (glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLsizei stride, const void *pointer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLPointer(" << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribLPointer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(stride);
+		traceRecord->args[4] = encodeCallTraceArg(pointer);
+	}
 	m_gl.vertexAttribLPointer(index, size, type, stride, pointer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP1ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP1ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP1ui(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP1uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP1uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP1uiv(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP2ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP2ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP2ui(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP2uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP2uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP2uiv(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP3ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP3ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP3ui(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP3uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP3uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP3uiv(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP4ui (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, glw::GLuint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP4ui);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP4ui(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribP4uiv (glw::GLuint index, glw::GLenum type, glw::GLboolean normalized, const glw::GLuint *value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribP4uiv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(type);
+		traceRecord->args[2] = encodeCallTraceArg(normalized);
+		traceRecord->args[3] = encodeCallTraceArg(value);
+	}
 	m_gl.vertexAttribP4uiv(index, type, normalized, value);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexAttribPointer (glw::GLuint index, glw::GLint size, glw::GLenum type, glw::GLboolean normalized, glw::GLsizei stride, const void *pointer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexAttribPointer);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(size);
+		traceRecord->args[2] = encodeCallTraceArg(type);
+		traceRecord->args[3] = encodeCallTraceArg(normalized);
+		traceRecord->args[4] = encodeCallTraceArg(stride);
+		traceRecord->args[5] = encodeCallTraceArg(pointer);
+	}
 	m_gl.vertexAttribPointer(index, size, type, normalized, stride, pointer);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glVertexBindingDivisor (glw::GLuint bindingindex, glw::GLuint divisor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexBindingDivisor(" << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glVertexBindingDivisor);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(bindingindex);
+		traceRecord->args[1] = encodeCallTraceArg(divisor);
+	}
 	m_gl.vertexBindingDivisor(bindingindex, divisor);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glViewport (glw::GLint x, glw::GLint y, glw::GLsizei width, glw::GLsizei height)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewport(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glViewport);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(x);
+		traceRecord->args[1] = encodeCallTraceArg(y);
+		traceRecord->args[2] = encodeCallTraceArg(width);
+		traceRecord->args[3] = encodeCallTraceArg(height);
+	}
 	m_gl.viewport(x, y, width, height);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glViewportArrayv (glw::GLuint first, glw::GLsizei count, const glw::GLfloat *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glViewportArrayv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(first);
+		traceRecord->args[1] = encodeCallTraceArg(count);
+		traceRecord->args[2] = encodeCallTraceArg(v);
+	}
 	m_gl.viewportArrayv(first, count, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glViewportIndexedf (glw::GLuint index, glw::GLfloat x, glw::GLfloat y, glw::GLfloat w, glw::GLfloat h)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedf(" << index << ", " << x << ", " << y << ", " << w << ", " << h << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glViewportIndexedf);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(x);
+		traceRecord->args[2] = encodeCallTraceArg(y);
+		traceRecord->args[3] = encodeCallTraceArg(w);
+		traceRecord->args[4] = encodeCallTraceArg(h);
+	}
 	m_gl.viewportIndexedf(index, x, y, w, h);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glViewportIndexedfv (glw::GLuint index, const glw::GLfloat *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedfv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glViewportIndexedfv);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(index);
+		traceRecord->args[1] = encodeCallTraceArg(v);
+	}
 	m_gl.viewportIndexedfv(index, v);
+	endCallTrace(traceRecord);
 }
 
 void CallLogWrapper::glWaitSync (glw::GLsync sync, glw::GLbitfield flags, glw::GLuint64 timeout)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	CallTraceRecord* const traceRecord = beginCallTrace(CALLTRACEFUNC_glWaitSync);
+	if (traceRecord)
+	{
+		traceRecord->args[0] = encodeCallTraceArg(sync);
+		traceRecord->args[1] = encodeCallTraceArg(flags);
+		traceRecord->args[2] = encodeCallTraceArg(timeout);
+	}
 	m_gl.waitSync(sync, flags, timeout);
+	endCallTrace(traceRecord);
 }
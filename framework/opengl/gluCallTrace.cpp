@@ -0,0 +1,174 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary GL call trace.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluCallTrace.hpp"
+#include "gluStrUtil.hpp"
+#include "tcuFormatUtil.hpp"
+#include "glwDefs.hpp"
+#include "glwEnums.hpp"
+
+#include <fstream>
+
+namespace glu
+{
+
+using tcu::toHex;
+
+namespace
+{
+
+enum
+{
+	TRACE_FILE_MAGIC	= 0x54434764,	//!< "dGCT"
+	TRACE_FILE_VERSION	= 1
+};
+
+struct TraceFileHeader
+{
+	deUint32	magic;
+	deUint32	version;
+	deUint32	recordSize;
+	deUint32	numFunctions;	//!< Function ids are only valid with matching function table.
+	deUint64	numRecords;
+};
+
+static const char* const s_functionNames[] =
+{
+#include "gluCallTraceFunctionNames.inl"
+};
+
+DE_STATIC_ASSERT(DE_LENGTH_OF_ARRAY(s_functionNames) == CALLTRACEFUNC_LAST);
+
+} // anonymous
+
+// CallTraceBuffer
+
+CallTraceBuffer::CallTraceBuffer (size_t capacity)
+	: m_records		(de::max<size_t>(capacity, 1))
+	, m_next		(0)
+	, m_numCalls	(0)
+{
+}
+
+size_t CallTraceBuffer::getNumRecords (void) const
+{
+	return (size_t)de::min<deUint64>(m_numCalls, (deUint64)m_records.size());
+}
+
+deUint64 CallTraceBuffer::getNumDroppedRecords (void) const
+{
+	return m_numCalls - (deUint64)getNumRecords();
+}
+
+const CallTraceRecord& CallTraceBuffer::getRecord (size_t ndx) const
+{
+	DE_ASSERT(ndx < getNumRecords());
+
+	// Oldest record is at write position once buffer has wrapped around.
+	if (getNumRecords() == m_records.size())
+		return m_records[(m_next + ndx) % m_records.size()];
+	else
+		return m_records[ndx];
+}
+
+void CallTraceBuffer::clear (void)
+{
+	m_next		= 0;
+	m_numCalls	= 0;
+}
+
+// Decoding
+
+const char* getCallTraceFunctionName (deUint32 function)
+{
+	return function < (deUint32)CALLTRACEFUNC_LAST ? s_functionNames[function] : DE_NULL;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Format traced call as it would appear in call log
+ *
+ * Call is written to callStr and return value, if any, to returnStr.
+ * Arguments are formatted the same way as in CallLogWrapper, except that
+ * pointer arguments are printed as addresses since the data they point
+ * to was not captured.
+ *//*--------------------------------------------------------------------*/
+void decodeCallTraceRecord (const CallTraceRecord& traceRecord, std::ostream& callStr, std::ostream& returnStr)
+{
+	switch (traceRecord.function)
+	{
+#include "gluCallTraceDecoder.inl"
+
+		default:
+			callStr << "// Unknown function " << traceRecord.function;
+			break;
+	}
+}
+
+// Trace files
+
+void writeCallTraceFile (const char* filename, const CallTraceBuffer& buffer)
+{
+	std::ofstream	out		(filename, std::ios_base::binary);
+	TraceFileHeader	header;
+
+	if (!out.is_open())
+		throw tcu::ResourceError(std::string("Failed to open ") + filename);
+
+	header.magic		= TRACE_FILE_MAGIC;
+	header.version		= TRACE_FILE_VERSION;
+	header.recordSize	= (deUint32)sizeof(CallTraceRecord);
+	header.numFunctions	= (deUint32)CALLTRACEFUNC_LAST;
+	header.numRecords	= (deUint64)buffer.getNumRecords();
+
+	out.write((const char*)&header, sizeof(header));
+
+	for (size_t ndx = 0; ndx < buffer.getNumRecords(); ndx++)
+		out.write((const char*)&buffer.getRecord(ndx), sizeof(CallTraceRecord));
+
+	out.close();
+
+	if (out.fail())
+		throw tcu::ResourceError(std::string("Failed to write ") + filename);
+}
+
+void readCallTraceFile (const char* filename, std::vector<CallTraceRecord>& dst)
+{
+	std::ifstream	in		(filename, std::ios_base::binary);
+	TraceFileHeader	header;
+
+	if (!in.is_open())
+		throw tcu::ResourceError(std::string("Failed to open ") + filename);
+
+	if (!in.read((char*)&header, sizeof(header)) || header.magic != TRACE_FILE_MAGIC)
+		throw tcu::ResourceError(std::string(filename) + " is not a GL call trace file");
+
+	if (header.version != TRACE_FILE_VERSION || header.recordSize != (deUint32)sizeof(CallTraceRecord) || header.numFunctions != (deUint32)CALLTRACEFUNC_LAST)
+		throw tcu::ResourceError(std::string(filename) + " was written by incompatible version");
+
+	dst.resize((size_t)header.numRecords);
+
+	if (!dst.empty() && !in.read((char*)&dst[0], (std::streamsize)(dst.size()*sizeof(CallTraceRecord))))
+		throw tcu::ResourceError(std::string(filename) + " is truncated");
+}
+
+} // glu
@@ -0,0 +1,162 @@
+#ifndef _GLUCALLTRACE_HPP
+#define _GLUCALLTRACE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary GL call trace.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluDefs.hpp"
+#include "deClock.h"
+#include "deMemory.h"
+
+#include <vector>
+#include <ostream>
+
+namespace glu
+{
+
+enum CallTraceFunction
+{
+#include "gluCallTraceFunctions.inl"
+
+	CALLTRACEFUNC_LAST
+};
+
+enum
+{
+	MAX_CALL_TRACE_ARGS		= 16	//!< Maximum number of arguments in any GL entry point.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Single traced GL call
+ *
+ * Arguments and return value are stored as raw 64-bit values. Only
+ * pointer values are recorded, not the data they point to.
+ *//*--------------------------------------------------------------------*/
+struct CallTraceRecord
+{
+	deUint64				timestamp;						//!< Call start time in microseconds.
+	deUint32				duration;						//!< Call duration in microseconds.
+	deUint32				function;						//!< CallTraceFunction.
+	deUint64				returnValue;
+	deUint64				args[MAX_CALL_TRACE_ARGS];
+};
+
+template <typename T>
+struct CallTraceArgCodec
+{
+	static deUint64			encode					(T value)			{ return (deUint64)value;	}
+	static T				decode					(deUint64 value)	{ return (T)value;			}
+};
+
+template <typename T>
+struct CallTraceArgCodec<T*>
+{
+	static deUint64			encode					(T* value)			{ return (deUint64)reinterpret_cast<deUintptr>(value);	}
+	static T*				decode					(deUint64 value)	{ return reinterpret_cast<T*>((deUintptr)value);		}
+};
+
+template <>
+struct CallTraceArgCodec<float>
+{
+	static deUint64			encode					(float value)		{ deUint32 bits; deMemcpy(&bits, &value, sizeof(bits)); return bits;	}
+	static float			decode					(deUint64 value)	{ const deUint32 bits = (deUint32)value; float f; deMemcpy(&f, &bits, sizeof(f)); return f;	}
+};
+
+template <>
+struct CallTraceArgCodec<double>
+{
+	static deUint64			encode					(double value)		{ deUint64 bits; deMemcpy(&bits, &value, sizeof(bits)); return bits;	}
+	static double			decode					(deUint64 value)	{ double d; deMemcpy(&d, &value, sizeof(d)); return d;	}
+};
+
+template <typename T>
+inline deUint64 encodeCallTraceArg (T value)
+{
+	return CallTraceArgCodec<T>::encode(value);
+}
+
+template <typename T>
+inline T decodeCallTraceArg (deUint64 value)
+{
+	return CallTraceArgCodec<T>::decode(value);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Ring buffer of traced GL calls
+ *
+ * Buffer keeps the most recent calls. Buffer is not synchronized and
+ * must be used only from a single thread, which is the case for GL
+ * contexts.
+ *//*--------------------------------------------------------------------*/
+class CallTraceBuffer
+{
+public:
+	enum
+	{
+		DEFAULT_CAPACITY	= 16*1024	//!< Default number of records kept.
+	};
+
+								CallTraceBuffer			(size_t capacity = DEFAULT_CAPACITY);
+
+	CallTraceRecord*			beginCall				(CallTraceFunction function)
+	{
+		CallTraceRecord* const record = &m_records[m_next];
+
+		record->function	= (deUint32)function;
+		record->returnValue	= 0;
+		record->timestamp	= deGetMicroseconds();
+
+		return record;
+	}
+
+	void						endCall					(CallTraceRecord* record)
+	{
+		const deUint64 duration = deGetMicroseconds() - record->timestamp;
+
+		record->duration = (deUint32)(duration > 0xffffffffu ? 0xffffffffu : duration);
+
+		m_next = (m_next + 1 == m_records.size()) ? 0 : m_next + 1;
+		m_numCalls += 1;
+	}
+
+	size_t						getCapacity				(void) const	{ return m_records.size(); }
+	size_t						getNumRecords			(void) const;
+	deUint64					getNumDroppedRecords	(void) const;
+	const CallTraceRecord&		getRecord				(size_t ndx) const;		//!< Records are ordered oldest first.
+
+	void						clear					(void);
+
+private:
+	std::vector<CallTraceRecord>	m_records;
+	size_t							m_next;
+	deUint64						m_numCalls;
+};
+
+const char*	getCallTraceFunctionName	(deUint32 function);
+void		decodeCallTraceRecord		(const CallTraceRecord& traceRecord, std::ostream& callStr, std::ostream& returnStr);
+
+void		writeCallTraceFile			(const char* filename, const CallTraceBuffer& buffer);
+void		readCallTraceFile			(const char* filename, std::vector<CallTraceRecord>& dst);
+
+} // glu
+
+#endif // _GLUCALLTRACE_HPP
@@ -0,0 +1,7549 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ *
+ * Generated from Khronos GL API description (gl.xml) revision 9302c6a6963864cba6c43d7eee0f4afcdcec2084.
+ */
+case CALLTRACEFUNC_glActiveShaderProgram:
+{
+	glw::GLuint pipeline = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glActiveShaderProgram(" << pipeline << ", " << program << ");";
+	break;
+}
+case CALLTRACEFUNC_glActiveTexture:
+{
+	glw::GLenum texture = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glActiveTexture(" << getTextureUnitStr(texture) << ");";
+	break;
+}
+case CALLTRACEFUNC_glAttachShader:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glAttachShader(" << program << ", " << shader << ");";
+	break;
+}
+case CALLTRACEFUNC_glBeginConditionalRender:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glBeginConditionalRender(" << id << ", " << toHex(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBeginQuery:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBeginQuery(" << getQueryTargetStr(target) << ", " << id << ");";
+	break;
+}
+case CALLTRACEFUNC_glBeginQueryIndexed:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glBeginQueryIndexed(" << toHex(target) << ", " << index << ", " << id << ");";
+	break;
+}
+case CALLTRACEFUNC_glBeginTransformFeedback:
+{
+	glw::GLenum primitiveMode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glBeginTransformFeedback(" << getPrimitiveTypeStr(primitiveMode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindAttribLocation:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glBindAttribLocation(" << program << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindBuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBindBuffer(" << getBufferTargetStr(target) << ", " << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindBufferBase:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glBindBufferBase(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindBufferRange:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[4]);
+	callStr << "glBindBufferRange(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindBuffersBase:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLuint *buffers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glBindBuffersBase(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindBuffersRange:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLuint *buffers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	const glw::GLintptr *offsets = decodeCallTraceArg<const glw::GLintptr *>(traceRecord.args[4]);
+	const glw::GLsizeiptr *sizes = decodeCallTraceArg<const glw::GLsizeiptr *>(traceRecord.args[5]);
+	callStr << "glBindBuffersRange(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindFragDataLocation:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint color = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glBindFragDataLocation(" << program << ", " << color << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindFragDataLocationIndexed:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint colorNumber = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glBindFragDataLocationIndexed(" << program << ", " << colorNumber << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindFramebuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBindFramebuffer(" << getFramebufferTargetStr(target) << ", " << framebuffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindImageTexture:
+{
+	glw::GLuint unit = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLboolean layered = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	glw::GLint layer = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLenum access = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	callStr << "glBindImageTexture(" << unit << ", " << texture << ", " << level << ", " << getBooleanStr(layered) << ", " << layer << ", " << getImageAccessStr(access) << ", " << getUncompressedTextureFormatStr(format) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindImageTextures:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *textures = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glBindImageTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindMultiTextureEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glBindMultiTextureEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << texture << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindProgramPipeline:
+{
+	glw::GLuint pipeline = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glBindProgramPipeline(" << pipeline << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindRenderbuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBindRenderbuffer(" << getFramebufferTargetStr(target) << ", " << renderbuffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindSampler:
+{
+	glw::GLuint unit = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBindSampler(" << unit << ", " << sampler << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindSamplers:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *samplers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glBindSamplers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindTexture:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBindTexture(" << getTextureTargetStr(target) << ", " << texture << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindTextureUnit:
+{
+	glw::GLuint unit = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBindTextureUnit(" << unit << ", " << texture << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindTextures:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *textures = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glBindTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindTransformFeedback:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glBindTransformFeedback(" << getTransformFeedbackTargetStr(target) << ", " << id << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindVertexArray:
+{
+	glw::GLuint array = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glBindVertexArray(" << array << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindVertexBuffer:
+{
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glBindVertexBuffer(" << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");";
+	break;
+}
+case CALLTRACEFUNC_glBindVertexBuffers:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *buffers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	const glw::GLintptr *offsets = decodeCallTraceArg<const glw::GLintptr *>(traceRecord.args[3]);
+	const glw::GLsizei *strides = decodeCallTraceArg<const glw::GLsizei *>(traceRecord.args[4]);
+	callStr << "glBindVertexBuffers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendBarrier:
+{
+	callStr << "glBlendBarrier(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendColor:
+{
+	glw::GLfloat red = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	glw::GLfloat green = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat blue = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat alpha = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glBlendColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendEquation:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glBlendEquation(" << getBlendEquationStr(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendEquationSeparate:
+{
+	glw::GLenum modeRGB = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum modeAlpha = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glBlendEquationSeparate(" << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendEquationSeparatei:
+{
+	glw::GLuint buf = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum modeRGB = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum modeAlpha = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	callStr << "glBlendEquationSeparatei(" << buf << ", " << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendEquationi:
+{
+	glw::GLuint buf = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glBlendEquationi(" << buf << ", " << getBlendEquationStr(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendFunc:
+{
+	glw::GLenum sfactor = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum dfactor = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glBlendFunc(" << getBlendFactorStr(sfactor) << ", " << getBlendFactorStr(dfactor) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendFuncSeparate:
+{
+	glw::GLenum sfactorRGB = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum dfactorRGB = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum sfactorAlpha = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum dfactorAlpha = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	callStr << "glBlendFuncSeparate(" << getBlendFactorStr(sfactorRGB) << ", " << getBlendFactorStr(dfactorRGB) << ", " << getBlendFactorStr(sfactorAlpha) << ", " << getBlendFactorStr(dfactorAlpha) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendFuncSeparatei:
+{
+	glw::GLuint buf = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum srcRGB = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum dstRGB = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum srcAlpha = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLenum dstAlpha = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	callStr << "glBlendFuncSeparatei(" << buf << ", " << toHex(srcRGB) << ", " << toHex(dstRGB) << ", " << toHex(srcAlpha) << ", " << toHex(dstAlpha) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlendFunci:
+{
+	glw::GLuint buf = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum src = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum dst = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	callStr << "glBlendFunci(" << buf << ", " << toHex(src) << ", " << toHex(dst) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlitFramebuffer:
+{
+	glw::GLint srcX0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint srcY0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint srcX1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint srcY1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint dstX0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint dstY0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint dstX1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLint dstY1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLbitfield mask = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[8]);
+	glw::GLenum filter = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	callStr << "glBlitFramebuffer(" << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << getBufferMaskStr(mask) << ", " << getTextureFilterStr(filter) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBlitNamedFramebuffer:
+{
+	glw::GLuint readFramebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint drawFramebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint srcX0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint srcY0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint srcX1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint srcY1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint dstX0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLint dstY0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLint dstX1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[8]);
+	glw::GLint dstY1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[9]);
+	glw::GLbitfield mask = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[10]);
+	glw::GLenum filter = decodeCallTraceArg<glw::GLenum>(traceRecord.args[11]);
+	callStr << "glBlitNamedFramebuffer(" << readFramebuffer << ", " << drawFramebuffer << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBufferData:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[1]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[2]);
+	glw::GLenum usage = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	callStr << "glBufferData(" << getBufferTargetStr(target) << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ", " << getUsageStr(usage) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBufferPageCommitmentARB:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	glw::GLboolean commit = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	callStr << "glBufferPageCommitmentARB(" << toHex(target) << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBufferStorage:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[1]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[2]);
+	glw::GLbitfield flags = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[3]);
+	callStr << "glBufferStorage(" << toHex(target) << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ", " << toHex(flags) << ");";
+	break;
+}
+case CALLTRACEFUNC_glBufferSubData:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	callStr << "glBufferSubData(" << getBufferTargetStr(target) << ", " << offset << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCheckFramebufferStatus:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glCheckFramebufferStatus(" << getFramebufferTargetStr(target) << ");";
+	glw::GLenum returnValue = decodeCallTraceArg<glw::GLenum>(traceRecord.returnValue);
+	returnStr << "// " << getFramebufferStatusStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glCheckNamedFramebufferStatus:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glCheckNamedFramebufferStatus(" << framebuffer << ", " << toHex(target) << ");";
+	glw::GLenum returnValue = decodeCallTraceArg<glw::GLenum>(traceRecord.returnValue);
+	returnStr << "// " << toHex(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glClampColor:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum clamp = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glClampColor(" << toHex(target) << ", " << toHex(clamp) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClear:
+{
+	glw::GLbitfield mask = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[0]);
+	callStr << "glClear(" << getBufferMaskStr(mask) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearBufferData:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[4]);
+	callStr << "glClearBufferData(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearBufferSubData:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[6]);
+	callStr << "glClearBufferSubData(" << toHex(target) << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearBufferfi:
+{
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLfloat depth = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLint stencil = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glClearBufferfi(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearBufferfv:
+{
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glClearBufferfv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearBufferiv:
+{
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glClearBufferiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearBufferuiv:
+{
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glClearBufferuiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearColor:
+{
+	glw::GLfloat red = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	glw::GLfloat green = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat blue = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat alpha = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glClearColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearDepth:
+{
+	glw::GLdouble depth = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[0]);
+	callStr << "glClearDepth(" << depth << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearDepthf:
+{
+	glw::GLfloat d = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	callStr << "glClearDepthf(" << d << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearNamedBufferData:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[4]);
+	callStr << "glClearNamedBufferData(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearNamedBufferSubData:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[6]);
+	callStr << "glClearNamedBufferSubData(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearNamedFramebufferfi:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLfloat depth = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLint stencil = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glClearNamedFramebufferfi(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearNamedFramebufferfv:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glClearNamedFramebufferfv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearNamedFramebufferiv:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glClearNamedFramebufferiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearNamedFramebufferuiv:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum buffer = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint drawbuffer = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glClearNamedFramebufferuiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearStencil:
+{
+	glw::GLint s = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	callStr << "glClearStencil(" << s << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearTexImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[4]);
+	callStr << "glClearTexImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClearTexSubImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glClearTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClientAttribDefaultEXT:
+{
+	glw::GLbitfield mask = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[0]);
+	callStr << "glClientAttribDefaultEXT(" << toHex(mask) << ");";
+	break;
+}
+case CALLTRACEFUNC_glClientWaitSync:
+{
+	glw::GLsync sync = decodeCallTraceArg<glw::GLsync>(traceRecord.args[0]);
+	glw::GLbitfield flags = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[1]);
+	glw::GLuint64 timeout = decodeCallTraceArg<glw::GLuint64>(traceRecord.args[2]);
+	callStr << "glClientWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");";
+	glw::GLenum returnValue = decodeCallTraceArg<glw::GLenum>(traceRecord.returnValue);
+	returnStr << "// " << toHex(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glClipControl:
+{
+	glw::GLenum origin = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum depth = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glClipControl(" << toHex(origin) << ", " << toHex(depth) << ");";
+	break;
+}
+case CALLTRACEFUNC_glColorMask:
+{
+	glw::GLboolean red = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[0]);
+	glw::GLboolean green = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[1]);
+	glw::GLboolean blue = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	glw::GLboolean alpha = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	callStr << "glColorMask(" << getBooleanStr(red) << ", " << getBooleanStr(green) << ", " << getBooleanStr(blue) << ", " << getBooleanStr(alpha) << ");";
+	break;
+}
+case CALLTRACEFUNC_glColorMaski:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLboolean r = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[1]);
+	glw::GLboolean g = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	glw::GLboolean b = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	glw::GLboolean a = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[4]);
+	callStr << "glColorMaski(" << index << ", " << getBooleanStr(r) << ", " << getBooleanStr(g) << ", " << getBooleanStr(b) << ", " << getBooleanStr(a) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompileShader:
+{
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glCompileShader(" << shader << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedMultiTexImage1DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glCompressedMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedMultiTexImage2DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glCompressedMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedMultiTexImage3DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glCompressedMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedMultiTexSubImage1DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glCompressedMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedMultiTexSubImage2DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glCompressedMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedMultiTexSubImage3DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[10]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[11]);
+	callStr << "glCompressedMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexImage1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[6]);
+	callStr << "glCompressedTexImage1D(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexImage2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glCompressedTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexImage3D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glCompressedTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexImage3DOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glCompressedTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexSubImage1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[6]);
+	callStr << "glCompressedTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexSubImage2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glCompressedTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexSubImage3D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[9]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glCompressedTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTexSubImage3DOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[9]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glCompressedTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureImage1DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glCompressedTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureImage2DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glCompressedTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureImage3DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glCompressedTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureSubImage1D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[6]);
+	callStr << "glCompressedTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureSubImage1DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glCompressedTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureSubImage2D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glCompressedTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureSubImage2DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glCompressedTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureSubImage3D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[9]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glCompressedTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCompressedTextureSubImage3DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	glw::GLsizei imageSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[10]);
+	const void *bits = decodeCallTraceArg<const void *>(traceRecord.args[11]);
+	callStr << "glCompressedTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bits))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyBufferSubData:
+{
+	glw::GLenum readTarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum writeTarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLintptr readOffset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLintptr writeOffset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[4]);
+	callStr << "glCopyBufferSubData(" << toHex(readTarget) << ", " << toHex(writeTarget) << ", " << readOffset << ", " << writeOffset << ", " << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyImageSubData:
+{
+	glw::GLuint srcName = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum srcTarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint srcLevel = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint srcX = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint srcY = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint srcZ = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLuint dstName = decodeCallTraceArg<glw::GLuint>(traceRecord.args[6]);
+	glw::GLenum dstTarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLint dstLevel = decodeCallTraceArg<glw::GLint>(traceRecord.args[8]);
+	glw::GLint dstX = decodeCallTraceArg<glw::GLint>(traceRecord.args[9]);
+	glw::GLint dstY = decodeCallTraceArg<glw::GLint>(traceRecord.args[10]);
+	glw::GLint dstZ = decodeCallTraceArg<glw::GLint>(traceRecord.args[11]);
+	glw::GLsizei srcWidth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[12]);
+	glw::GLsizei srcHeight = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[13]);
+	glw::GLsizei srcDepth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[14]);
+	callStr << "glCopyImageSubData(" << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyMultiTexImage1DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	callStr << "glCopyMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyMultiTexImage2DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[8]);
+	callStr << "glCopyMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyMultiTexSubImage1DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	callStr << "glCopyMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyMultiTexSubImage2DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	callStr << "glCopyMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyMultiTexSubImage3DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[9]);
+	callStr << "glCopyMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyNamedBufferSubData:
+{
+	glw::GLuint readBuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint writeBuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLintptr readOffset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLintptr writeOffset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[4]);
+	callStr << "glCopyNamedBufferSubData(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTexImage1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	callStr << "glCopyTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTexImage2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	callStr << "glCopyTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTexSubImage1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glCopyTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTexSubImage2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	callStr << "glCopyTexSubImage2D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTexSubImage3D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	callStr << "glCopyTexSubImage3D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTexSubImage3DOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	callStr << "glCopyTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureImage1DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	callStr << "glCopyTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureImage2DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[8]);
+	callStr << "glCopyTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureSubImage1D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glCopyTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureSubImage1DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	callStr << "glCopyTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureSubImage2D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	callStr << "glCopyTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureSubImage2DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	callStr << "glCopyTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureSubImage3D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	callStr << "glCopyTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCopyTextureSubImage3DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[9]);
+	callStr << "glCopyTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateBuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *buffers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glCreateBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateFramebuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *framebuffers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glCreateFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateProgram:
+{
+	callStr << "glCreateProgram(" << ");";
+	glw::GLuint returnValue = decodeCallTraceArg<glw::GLuint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glCreateProgramPipelines:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *pipelines = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glCreateProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateQueries:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLuint *ids = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glCreateQueries(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateRenderbuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *renderbuffers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glCreateRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateSamplers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *samplers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glCreateSamplers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateShader:
+{
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glCreateShader(" << getShaderTypeStr(type) << ");";
+	glw::GLuint returnValue = decodeCallTraceArg<glw::GLuint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glCreateShaderProgramv:
+{
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLchar *const*strings = decodeCallTraceArg<const glw::GLchar *const*>(traceRecord.args[2]);
+	callStr << "glCreateShaderProgramv(" << toHex(type) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strings))) << ");";
+	glw::GLuint returnValue = decodeCallTraceArg<glw::GLuint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glCreateTextures:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLuint *textures = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glCreateTextures(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateTransformFeedbacks:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *ids = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glCreateTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCreateVertexArrays:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *arrays = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glCreateVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glCullFace:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glCullFace(" << getFaceStr(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDebugMessageCallback:
+{
+	glw::GLDEBUGPROC callback = decodeCallTraceArg<glw::GLDEBUGPROC>(traceRecord.args[0]);
+	const void *userParam = decodeCallTraceArg<const void *>(traceRecord.args[1]);
+	callStr << "glDebugMessageCallback(" << toHex(reinterpret_cast<deUintptr>(callback)) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDebugMessageControl:
+{
+	glw::GLenum source = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum severity = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const glw::GLuint *ids = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[4]);
+	glw::GLboolean enabled = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[5]);
+	callStr << "glDebugMessageControl(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << getDebugMessageSeverityStr(severity) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << getBooleanStr(enabled) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDebugMessageInsert:
+{
+	glw::GLenum source = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLenum severity = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	const glw::GLchar *buf = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[5]);
+	callStr << "glDebugMessageInsert(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << id << ", " << getDebugMessageSeverityStr(severity) << ", " << length << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buf))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteBuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *buffers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteFramebuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *framebuffers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteProgram:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glDeleteProgram(" << program << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteProgramPipelines:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *pipelines = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteQueries:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *ids = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteRenderbuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *renderbuffers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteSamplers:
+{
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *samplers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteShader:
+{
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glDeleteShader(" << shader << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteSync:
+{
+	glw::GLsync sync = decodeCallTraceArg<glw::GLsync>(traceRecord.args[0]);
+	callStr << "glDeleteSync(" << sync << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteTextures:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *textures = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteTransformFeedbacks:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *ids = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDeleteVertexArrays:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *arrays = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glDeleteVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthBoundsEXT:
+{
+	glw::GLclampd zmin = decodeCallTraceArg<glw::GLclampd>(traceRecord.args[0]);
+	glw::GLclampd zmax = decodeCallTraceArg<glw::GLclampd>(traceRecord.args[1]);
+	callStr << "glDepthBoundsEXT(" << zmin << ", " << zmax << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthFunc:
+{
+	glw::GLenum func = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glDepthFunc(" << getCompareFuncStr(func) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthMask:
+{
+	glw::GLboolean flag = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[0]);
+	callStr << "glDepthMask(" << getBooleanStr(flag) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthRange:
+{
+	glw::GLdouble near = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[0]);
+	glw::GLdouble far = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	callStr << "glDepthRange(" << near << ", " << far << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthRangeArrayfvOES:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLfloat *v = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glDepthRangeArrayfvOES(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthRangeArrayv:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glDepthRangeArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthRangeIndexed:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble n = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble f = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	callStr << "glDepthRangeIndexed(" << index << ", " << n << ", " << f << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthRangeIndexedfOES:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLfloat n = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat f = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	callStr << "glDepthRangeIndexedfOES(" << index << ", " << n << ", " << f << ");";
+	break;
+}
+case CALLTRACEFUNC_glDepthRangef:
+{
+	glw::GLfloat n = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	glw::GLfloat f = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	callStr << "glDepthRangef(" << n << ", " << f << ");";
+	break;
+}
+case CALLTRACEFUNC_glDetachShader:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glDetachShader(" << program << ", " << shader << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisable:
+{
+	glw::GLenum cap = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glDisable(" << getEnableCapStr(cap) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisableClientStateIndexedEXT:
+{
+	glw::GLenum array = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glDisableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisableClientStateiEXT:
+{
+	glw::GLenum array = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glDisableClientStateiEXT(" << toHex(array) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisableIndexedEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glDisableIndexedEXT(" << toHex(target) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisableVertexArrayAttrib:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glDisableVertexArrayAttrib(" << vaobj << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisableVertexArrayEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum array = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glDisableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisableVertexAttribArray:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glDisableVertexAttribArray(" << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glDisablei:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glDisablei(" << getIndexedEnableCapStr(target) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glDispatchCompute:
+{
+	glw::GLuint num_groups_x = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint num_groups_y = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint num_groups_z = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glDispatchCompute(" << num_groups_x << ", " << num_groups_y << ", " << num_groups_z << ");";
+	break;
+}
+case CALLTRACEFUNC_glDispatchComputeIndirect:
+{
+	glw::GLintptr indirect = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[0]);
+	callStr << "glDispatchComputeIndirect(" << indirect << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawArrays:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint first = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	callStr << "glDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawArraysIndirect:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const void *indirect = decodeCallTraceArg<const void *>(traceRecord.args[1]);
+	callStr << "glDrawArraysIndirect(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawArraysInstanced:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint first = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glDrawArraysInstanced(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ", " << instancecount << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawArraysInstancedBaseInstance:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint first = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLuint baseinstance = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glDrawArraysInstancedBaseInstance(" << toHex(mode) << ", " << first << ", " << count << ", " << instancecount << ", " << baseinstance << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawBuffer:
+{
+	glw::GLenum buf = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glDrawBuffer(" << toHex(buf) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawBuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLenum *bufs = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[1]);
+	callStr << "glDrawBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawElements:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	callStr << "glDrawElements(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawElementsBaseVertex:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	glw::GLint basevertex = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << basevertex << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawElementsIndirect:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const void *indirect = decodeCallTraceArg<const void *>(traceRecord.args[2]);
+	callStr << "glDrawElementsIndirect(" << getPrimitiveTypeStr(mode) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawElementsInstanced:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glDrawElementsInstanced(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << instancecount << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawElementsInstancedBaseInstance:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLuint baseinstance = decodeCallTraceArg<glw::GLuint>(traceRecord.args[5]);
+	callStr << "glDrawElementsInstancedBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << instancecount << ", " << baseinstance << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawElementsInstancedBaseVertex:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint basevertex = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	callStr << "glDrawElementsInstancedBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << instancecount << ", " << basevertex << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawElementsInstancedBaseVertexBaseInstance:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint basevertex = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLuint baseinstance = decodeCallTraceArg<glw::GLuint>(traceRecord.args[6]);
+	callStr << "glDrawElementsInstancedBaseVertexBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << instancecount << ", " << basevertex << ", " << baseinstance << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawRangeElements:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint start = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint end = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[5]);
+	callStr << "glDrawRangeElements(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawRangeElementsBaseVertex:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint start = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint end = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	const void *indices = decodeCallTraceArg<const void *>(traceRecord.args[5]);
+	glw::GLint basevertex = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	callStr << "glDrawRangeElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << basevertex << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawTransformFeedback:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glDrawTransformFeedback(" << toHex(mode) << ", " << id << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawTransformFeedbackInstanced:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	callStr << "glDrawTransformFeedbackInstanced(" << toHex(mode) << ", " << id << ", " << instancecount << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawTransformFeedbackStream:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint stream = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glDrawTransformFeedbackStream(" << toHex(mode) << ", " << id << ", " << stream << ");";
+	break;
+}
+case CALLTRACEFUNC_glDrawTransformFeedbackStreamInstanced:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint stream = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei instancecount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glDrawTransformFeedbackStreamInstanced(" << toHex(mode) << ", " << id << ", " << stream << ", " << instancecount << ");";
+	break;
+}
+case CALLTRACEFUNC_glEGLImageTargetRenderbufferStorageOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLeglImageOES image = decodeCallTraceArg<glw::GLeglImageOES>(traceRecord.args[1]);
+	callStr << "glEGLImageTargetRenderbufferStorageOES(" << toHex(target) << ", " << image << ");";
+	break;
+}
+case CALLTRACEFUNC_glEGLImageTargetTexture2DOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLeglImageOES image = decodeCallTraceArg<glw::GLeglImageOES>(traceRecord.args[1]);
+	callStr << "glEGLImageTargetTexture2DOES(" << toHex(target) << ", " << image << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnable:
+{
+	glw::GLenum cap = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glEnable(" << getEnableCapStr(cap) << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnableClientStateIndexedEXT:
+{
+	glw::GLenum array = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glEnableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnableClientStateiEXT:
+{
+	glw::GLenum array = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glEnableClientStateiEXT(" << toHex(array) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnableIndexedEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glEnableIndexedEXT(" << toHex(target) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnableVertexArrayAttrib:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glEnableVertexArrayAttrib(" << vaobj << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnableVertexArrayEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum array = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glEnableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnableVertexAttribArray:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glEnableVertexAttribArray(" << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glEnablei:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glEnablei(" << getIndexedEnableCapStr(target) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glEndConditionalRender:
+{
+	callStr << "glEndConditionalRender(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glEndQuery:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glEndQuery(" << getQueryTargetStr(target) << ");";
+	break;
+}
+case CALLTRACEFUNC_glEndQueryIndexed:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glEndQueryIndexed(" << toHex(target) << ", " << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glEndTransformFeedback:
+{
+	callStr << "glEndTransformFeedback(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glFenceSync:
+{
+	glw::GLenum condition = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLbitfield flags = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[1]);
+	callStr << "glFenceSync(" << toHex(condition) << ", " << toHex(flags) << ");";
+	glw::GLsync returnValue = decodeCallTraceArg<glw::GLsync>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glFinish:
+{
+	callStr << "glFinish(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glFlush:
+{
+	callStr << "glFlush(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glFlushMappedBufferRange:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr length = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	callStr << "glFlushMappedBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ");";
+	break;
+}
+case CALLTRACEFUNC_glFlushMappedNamedBufferRange:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr length = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	callStr << "glFlushMappedNamedBufferRange(" << buffer << ", " << offset << ", " << length << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferDrawBufferEXT:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glFramebufferDrawBufferEXT(" << framebuffer << ", " << toHex(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferDrawBuffersEXT:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLenum *bufs = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[2]);
+	callStr << "glFramebufferDrawBuffersEXT(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferParameteri:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glFramebufferParameteri(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferReadBufferEXT:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glFramebufferReadBufferEXT(" << framebuffer << ", " << toHex(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferRenderbuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum renderbuffertarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glFramebufferRenderbuffer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferTargetStr(renderbuffertarget) << ", " << renderbuffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferTexture:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glFramebufferTexture(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferTexture1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum textarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glFramebufferTexture1D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferTexture2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum textarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glFramebufferTexture2D(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getTextureTargetStr(textarget) << ", " << texture << ", " << level << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferTexture3D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum textarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	callStr << "glFramebufferTexture3D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferTexture3DOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum textarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	callStr << "glFramebufferTexture3DOES(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glFramebufferTextureLayer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint layer = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glFramebufferTextureLayer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ", " << layer << ");";
+	break;
+}
+case CALLTRACEFUNC_glFrontFace:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glFrontFace(" << getWindingStr(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenBuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *buffers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenFramebuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *framebuffers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenProgramPipelines:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *pipelines = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenQueries:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *ids = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenRenderbuffers:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *renderbuffers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenSamplers:
+{
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *samplers = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenTextures:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *textures = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenTransformFeedbacks:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *ids = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenVertexArrays:
+{
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	glw::GLuint *arrays = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glGenVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenerateMipmap:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glGenerateMipmap(" << getTextureTargetStr(target) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenerateMultiTexMipmapEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glGenerateMultiTexMipmapEXT(" << toHex(texunit) << ", " << toHex(target) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGenerateTextureMipmap:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glGenerateTextureMipmap(" << texture << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveAtomicCounterBufferiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint bufferIndex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetActiveAtomicCounterBufferiv(" << program << ", " << bufferIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveAttrib:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[3]);
+	glw::GLint *size = decodeCallTraceArg<glw::GLint *>(traceRecord.args[4]);
+	glw::GLenum *type = decodeCallTraceArg<glw::GLenum *>(traceRecord.args[5]);
+	glw::GLchar *name = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[6]);
+	callStr << "glGetActiveAttrib(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveSubroutineName:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei bufsize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[4]);
+	glw::GLchar *name = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[5]);
+	callStr << "glGetActiveSubroutineName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveSubroutineUniformName:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei bufsize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[4]);
+	glw::GLchar *name = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[5]);
+	callStr << "glGetActiveSubroutineUniformName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveSubroutineUniformiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLint *values = decodeCallTraceArg<glw::GLint *>(traceRecord.args[4]);
+	callStr << "glGetActiveSubroutineUniformiv(" << program << ", " << toHex(shadertype) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveUniform:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[3]);
+	glw::GLint *size = decodeCallTraceArg<glw::GLint *>(traceRecord.args[4]);
+	glw::GLenum *type = decodeCallTraceArg<glw::GLenum *>(traceRecord.args[5]);
+	glw::GLchar *name = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[6]);
+	callStr << "glGetActiveUniform(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveUniformBlockName:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint uniformBlockIndex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[3]);
+	glw::GLchar *uniformBlockName = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[4]);
+	callStr << "glGetActiveUniformBlockName(" << program << ", " << uniformBlockIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveUniformBlockiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint uniformBlockIndex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetActiveUniformBlockiv(" << program << ", " << uniformBlockIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveUniformName:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint uniformIndex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[3]);
+	glw::GLchar *uniformName = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[4]);
+	callStr << "glGetActiveUniformName(" << program << ", " << uniformIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetActiveUniformsiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei uniformCount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *uniformIndices = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[4]);
+	callStr << "glGetActiveUniformsiv(" << program << ", " << uniformCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ", " << getUniformParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetAttachedShaders:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei maxCount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei *count = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLuint *shaders = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glGetAttachedShaders(" << program << ", " << maxCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetAttribLocation:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[1]);
+	callStr << "glGetAttribLocation(" << program << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLint returnValue = decodeCallTraceArg<glw::GLint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetBooleanIndexedvEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLboolean *data = decodeCallTraceArg<glw::GLboolean *>(traceRecord.args[2]);
+	callStr << "glGetBooleanIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetBooleani_v:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLboolean *data = decodeCallTraceArg<glw::GLboolean *>(traceRecord.args[2]);
+	callStr << "glGetBooleani_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetBooleanv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLboolean *data = decodeCallTraceArg<glw::GLboolean *>(traceRecord.args[1]);
+	callStr << "glGetBooleanv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetBufferParameteri64v:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint64 *params = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[2]);
+	callStr << "glGetBufferParameteri64v(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetBufferParameteriv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetBufferParameteriv(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetBufferPointerv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	void **params = decodeCallTraceArg<void **>(traceRecord.args[2]);
+	callStr << "glGetBufferPointerv(" << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetBufferSubData:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	void *data = decodeCallTraceArg<void *>(traceRecord.args[3]);
+	callStr << "glGetBufferSubData(" << toHex(target) << ", " << offset << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetCompressedMultiTexImageEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint lod = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	void *img = decodeCallTraceArg<void *>(traceRecord.args[3]);
+	callStr << "glGetCompressedMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << lod << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(img))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetCompressedTexImage:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	void *img = decodeCallTraceArg<void *>(traceRecord.args[2]);
+	callStr << "glGetCompressedTexImage(" << toHex(target) << ", " << level << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(img))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetCompressedTextureImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[3]);
+	callStr << "glGetCompressedTextureImage(" << texture << ", " << level << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetCompressedTextureSubImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[9]);
+	callStr << "glGetCompressedTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetDebugMessageLog:
+{
+	glw::GLuint count = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum *sources = decodeCallTraceArg<glw::GLenum *>(traceRecord.args[2]);
+	glw::GLenum *types = decodeCallTraceArg<glw::GLenum *>(traceRecord.args[3]);
+	glw::GLuint *ids = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[4]);
+	glw::GLenum *severities = decodeCallTraceArg<glw::GLenum *>(traceRecord.args[5]);
+	glw::GLsizei *lengths = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[6]);
+	glw::GLchar *messageLog = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[7]);
+	callStr << "glGetDebugMessageLog(" << count << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(types))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog))) << ");";
+	glw::GLuint returnValue = decodeCallTraceArg<glw::GLuint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetDoubleIndexedvEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLdouble *data = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glGetDoubleIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetDoublei_v:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLdouble *data = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glGetDoublei_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetDoublev:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLdouble *data = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glGetDoublev(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetError:
+{
+	callStr << "glGetError(" << ");";
+	glw::GLenum returnValue = decodeCallTraceArg<glw::GLenum>(traceRecord.returnValue);
+	returnStr << "// " << getErrorStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetFloatIndexedvEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLfloat *data = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetFloatIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetFloati_v:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLfloat *data = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetFloati_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetFloatv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLfloat *data = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glGetFloatv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetFragDataIndex:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[1]);
+	callStr << "glGetFragDataIndex(" << program << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLint returnValue = decodeCallTraceArg<glw::GLint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetFragDataLocation:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[1]);
+	callStr << "glGetFragDataLocation(" << program << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLint returnValue = decodeCallTraceArg<glw::GLint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetFramebufferAttachmentParameteriv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetFramebufferAttachmentParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferAttachmentParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetFramebufferParameteriv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetFramebufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetGraphicsResetStatus:
+{
+	callStr << "glGetGraphicsResetStatus(" << ");";
+	glw::GLenum returnValue = decodeCallTraceArg<glw::GLenum>(traceRecord.returnValue);
+	returnStr << "// " << toHex(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetInteger64i_v:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint64 *data = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[2]);
+	callStr << "glGetInteger64i_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetInteger64v:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint64 *data = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[1]);
+	callStr << "glGetInteger64v(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetIntegerIndexedvEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint *data = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetIntegerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetIntegeri_v:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint *data = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetIntegeri_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetIntegerv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint *data = decodeCallTraceArg<glw::GLint *>(traceRecord.args[1]);
+	callStr << "glGetIntegerv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetInternalformatSampleivNV:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[5]);
+	callStr << "glGetInternalformatSampleivNV(" << toHex(target) << ", " << toHex(internalformat) << ", " << samples << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetInternalformati64v:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLint64 *params = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[4]);
+	callStr << "glGetInternalformati64v(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetInternalformativ:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[4]);
+	callStr << "glGetInternalformativ(" << getInternalFormatTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << getInternalFormatParameterStr(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexEnvfvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexEnvivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexGendvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLdouble *params = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexGenfvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexGenivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexImageEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[5]);
+	callStr << "glGetMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexLevelParameterfvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glGetMultiTexLevelParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexLevelParameterivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[4]);
+	callStr << "glGetMultiTexLevelParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexParameterIivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexParameterIuivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexParameterfvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultiTexParameterivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetMultisamplefv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLfloat *val = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetMultisamplefv(" << getMultisampleParameterStr(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(val))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedBufferParameteri64v:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint64 *params = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[2]);
+	callStr << "glGetNamedBufferParameteri64v(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedBufferParameteriv:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetNamedBufferParameteriv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedBufferPointerv:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	void **params = decodeCallTraceArg<void **>(traceRecord.args[2]);
+	callStr << "glGetNamedBufferPointerv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedBufferSubData:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	void *data = decodeCallTraceArg<void *>(traceRecord.args[3]);
+	callStr << "glGetNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedFramebufferAttachmentParameteriv:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetNamedFramebufferAttachmentParameteriv(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedFramebufferParameteriv:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *param = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetNamedFramebufferParameteriv(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedProgramLocalParameterIivEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetNamedProgramLocalParameterIivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedProgramLocalParameterIuivEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glGetNamedProgramLocalParameterIuivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedProgramLocalParameterdvEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLdouble *params = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glGetNamedProgramLocalParameterdvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedProgramLocalParameterfvEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glGetNamedProgramLocalParameterfvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedProgramStringEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	void *string = decodeCallTraceArg<void *>(traceRecord.args[3]);
+	callStr << "glGetNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedProgramivEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetNamedProgramivEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetNamedRenderbufferParameteriv:
+{
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetNamedRenderbufferParameteriv(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetObjectLabel:
+{
+	glw::GLenum identifier = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint name = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[3]);
+	glw::GLchar *label = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[4]);
+	callStr << "glGetObjectLabel(" << toHex(identifier) << ", " << name << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetObjectPtrLabel:
+{
+	const void *ptr = decodeCallTraceArg<const void *>(traceRecord.args[0]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLchar *label = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glGetObjectPtrLabel(" << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ptr))) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetPointerIndexedvEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	void **data = decodeCallTraceArg<void **>(traceRecord.args[2]);
+	callStr << "glGetPointerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetPointeri_vEXT:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	void **params = decodeCallTraceArg<void **>(traceRecord.args[2]);
+	callStr << "glGetPointeri_vEXT(" << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetPointerv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	void **params = decodeCallTraceArg<void **>(traceRecord.args[1]);
+	callStr << "glGetPointerv(" << getPointerStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramBinary:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLenum *binaryFormat = decodeCallTraceArg<glw::GLenum *>(traceRecord.args[3]);
+	void *binary = decodeCallTraceArg<void *>(traceRecord.args[4]);
+	callStr << "glGetProgramBinary(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binary))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramInfoLog:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLchar *infoLog = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glGetProgramInfoLog(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramInterfaceiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum programInterface = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetProgramInterfaceiv(" << program << ", " << toHex(programInterface) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramPipelineInfoLog:
+{
+	glw::GLuint pipeline = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLchar *infoLog = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glGetProgramPipelineInfoLog(" << pipeline << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramPipelineiv:
+{
+	glw::GLuint pipeline = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetProgramPipelineiv(" << pipeline << ", " << getPipelineParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramResourceIndex:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum programInterface = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glGetProgramResourceIndex(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLuint returnValue = decodeCallTraceArg<glw::GLuint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramResourceLocation:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum programInterface = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glGetProgramResourceLocation(" << program << ", " << toHex(programInterface) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLint returnValue = decodeCallTraceArg<glw::GLint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramResourceLocationIndex:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum programInterface = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glGetProgramResourceLocationIndex(" << program << ", " << toHex(programInterface) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLint returnValue = decodeCallTraceArg<glw::GLint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramResourceName:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum programInterface = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[4]);
+	glw::GLchar *name = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[5]);
+	callStr << "glGetProgramResourceName(" << program << ", " << toHex(programInterface) << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramResourceiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum programInterface = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei propCount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const glw::GLenum *props = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[4]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[6]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[7]);
+	callStr << "glGetProgramResourceiv(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << index << ", " << propCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(props))) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramStageiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *values = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetProgramStageiv(" << program << ", " << toHex(shadertype) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetProgramiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetProgramiv(" << program << ", " << getProgramParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryBufferObjecti64v:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	callStr << "glGetQueryBufferObjecti64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryBufferObjectiv:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	callStr << "glGetQueryBufferObjectiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryBufferObjectui64v:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	callStr << "glGetQueryBufferObjectui64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryBufferObjectuiv:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	callStr << "glGetQueryBufferObjectuiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryIndexediv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetQueryIndexediv(" << toHex(target) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryObjecti64v:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint64 *params = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[2]);
+	callStr << "glGetQueryObjecti64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryObjectiv:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetQueryObjectiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryObjectui64v:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint64 *params = decodeCallTraceArg<glw::GLuint64 *>(traceRecord.args[2]);
+	callStr << "glGetQueryObjectui64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryObjectuiv:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glGetQueryObjectuiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetQueryiv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetQueryiv(" << getQueryTargetStr(target) << ", " << getQueryParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetRenderbufferParameteriv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetRenderbufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getRenderbufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetSamplerParameterIiv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetSamplerParameterIuiv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glGetSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetSamplerParameterfv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetSamplerParameteriv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetShaderInfoLog:
+{
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLchar *infoLog = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glGetShaderInfoLog(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetShaderPrecisionFormat:
+{
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum precisiontype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *range = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	glw::GLint *precision = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetShaderPrecisionFormat(" << getShaderTypeStr(shadertype) << ", " << getPrecisionFormatTypeStr(precisiontype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(range))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(precision))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetShaderSource:
+{
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLchar *source = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glGetShaderSource(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(source))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetShaderiv:
+{
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetShaderiv(" << shader << ", " << getShaderParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetString:
+{
+	glw::GLenum name = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glGetString(" << getGettableStringStr(name) << ");";
+	const glw::GLubyte * returnValue = decodeCallTraceArg<const glw::GLubyte *>(traceRecord.returnValue);
+	returnStr << "// " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(returnValue))) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetStringi:
+{
+	glw::GLenum name = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glGetStringi(" << getGettableStringStr(name) << ", " << index << ");";
+	const glw::GLubyte * returnValue = decodeCallTraceArg<const glw::GLubyte *>(traceRecord.returnValue);
+	returnStr << "// " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(returnValue))) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetSubroutineIndex:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glGetSubroutineIndex(" << program << ", " << toHex(shadertype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLuint returnValue = decodeCallTraceArg<glw::GLuint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetSubroutineUniformLocation:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glGetSubroutineUniformLocation(" << program << ", " << toHex(shadertype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLint returnValue = decodeCallTraceArg<glw::GLint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetSynciv:
+{
+	glw::GLsync sync = decodeCallTraceArg<glw::GLsync>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[3]);
+	glw::GLint *values = decodeCallTraceArg<glw::GLint *>(traceRecord.args[4]);
+	callStr << "glGetSynciv(" << sync << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTexImage:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[4]);
+	callStr << "glGetTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTexLevelParameterfv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glGetTexLevelParameterfv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTexLevelParameteriv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetTexLevelParameteriv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTexParameterIiv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTexParameterIuiv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glGetTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTexParameterfv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTexParameteriv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[5]);
+	callStr << "glGetTextureImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureLevelParameterfv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glGetTextureLevelParameterfv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureLevelParameteriv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetTextureLevelParameteriv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureParameterIiv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureParameterIuiv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glGetTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureParameterfv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureParameteriv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTextureSubImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[10]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[11]);
+	callStr << "glGetTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTransformFeedbackVarying:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei *length = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[3]);
+	glw::GLsizei *size = decodeCallTraceArg<glw::GLsizei *>(traceRecord.args[4]);
+	glw::GLenum *type = decodeCallTraceArg<glw::GLenum *>(traceRecord.args[5]);
+	glw::GLchar *name = decodeCallTraceArg<glw::GLchar *>(traceRecord.args[6]);
+	callStr << "glGetTransformFeedbackVarying(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTransformFeedbacki64_v:
+{
+	glw::GLuint xfb = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint64 *param = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[3]);
+	callStr << "glGetTransformFeedbacki64_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTransformFeedbacki_v:
+{
+	glw::GLuint xfb = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint *param = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetTransformFeedbacki_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetTransformFeedbackiv:
+{
+	glw::GLuint xfb = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *param = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetTransformFeedbackiv(" << xfb << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformBlockIndex:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLchar *uniformBlockName = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[1]);
+	callStr << "glGetUniformBlockIndex(" << program << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");";
+	glw::GLuint returnValue = decodeCallTraceArg<glw::GLuint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformIndices:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei uniformCount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLchar *const*uniformNames = decodeCallTraceArg<const glw::GLchar *const*>(traceRecord.args[2]);
+	glw::GLuint *uniformIndices = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glGetUniformIndices(" << program << ", " << uniformCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformNames))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformLocation:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLchar *name = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[1]);
+	callStr << "glGetUniformLocation(" << program << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");";
+	glw::GLint returnValue = decodeCallTraceArg<glw::GLint>(traceRecord.returnValue);
+	returnStr << "// " << returnValue << " returned";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformSubroutineuiv:
+{
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glGetUniformSubroutineuiv(" << toHex(shadertype) << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformdv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLdouble *params = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glGetUniformdv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformfv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetUniformfv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetUniformiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetUniformuiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glGetUniformuiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexArrayIndexed64iv:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint64 *param = decodeCallTraceArg<glw::GLint64 *>(traceRecord.args[3]);
+	callStr << "glGetVertexArrayIndexed64iv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexArrayIndexediv:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *param = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetVertexArrayIndexediv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexArrayIntegeri_vEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint *param = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetVertexArrayIntegeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexArrayIntegervEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *param = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetVertexArrayIntegervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexArrayPointeri_vEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	void **param = decodeCallTraceArg<void **>(traceRecord.args[3]);
+	callStr << "glGetVertexArrayPointeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexArrayPointervEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	void **param = decodeCallTraceArg<void **>(traceRecord.args[2]);
+	callStr << "glGetVertexArrayPointervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexArrayiv:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *param = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetVertexArrayiv(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexAttribIiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetVertexAttribIiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexAttribIuiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glGetVertexAttribIuiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexAttribLdv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLdouble *params = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glGetVertexAttribLdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexAttribPointerv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	void **pointer = decodeCallTraceArg<void **>(traceRecord.args[2]);
+	callStr << "glGetVertexAttribPointerv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexAttribdv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLdouble *params = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glGetVertexAttribdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexAttribfv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glGetVertexAttribfv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetVertexAttribiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[2]);
+	callStr << "glGetVertexAttribiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetnCompressedTexImage:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint lod = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[3]);
+	callStr << "glGetnCompressedTexImage(" << toHex(target) << ", " << lod << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetnTexImage:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[5]);
+	callStr << "glGetnTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetnUniformdv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLdouble *params = decodeCallTraceArg<glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glGetnUniformdv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetnUniformfv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLfloat *params = decodeCallTraceArg<glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glGetnUniformfv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetnUniformiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLint *params = decodeCallTraceArg<glw::GLint *>(traceRecord.args[3]);
+	callStr << "glGetnUniformiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glGetnUniformuiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLuint *params = decodeCallTraceArg<glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glGetnUniformuiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glHint:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glHint(" << getHintStr(target) << ", " << getHintModeStr(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glInsertEventMarkerEXT:
+{
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLchar *marker = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[1]);
+	callStr << "glInsertEventMarkerEXT(" << length << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(marker))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateBufferData:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glInvalidateBufferData(" << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateBufferSubData:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr length = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	callStr << "glInvalidateBufferSubData(" << buffer << ", " << offset << ", " << length << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateFramebuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei numAttachments = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLenum *attachments = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[2]);
+	callStr << "glInvalidateFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateNamedFramebufferData:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei numAttachments = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLenum *attachments = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[2]);
+	callStr << "glInvalidateNamedFramebufferData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateNamedFramebufferSubData:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei numAttachments = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLenum *attachments = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[2]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	callStr << "glInvalidateNamedFramebufferSubData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateSubFramebuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei numAttachments = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLenum *attachments = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[2]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	callStr << "glInvalidateSubFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateTexImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	callStr << "glInvalidateTexImage(" << texture << ", " << level << ");";
+	break;
+}
+case CALLTRACEFUNC_glInvalidateTexSubImage:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	callStr << "glInvalidateTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ");";
+	break;
+}
+case CALLTRACEFUNC_glIsBuffer:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsBuffer(" << buffer << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsEnabled:
+{
+	glw::GLenum cap = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glIsEnabled(" << getEnableCapStr(cap) << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsEnabledIndexedEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glIsEnabledIndexedEXT(" << toHex(target) << ", " << index << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsEnabledi:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glIsEnabledi(" << getIndexedEnableCapStr(target) << ", " << index << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsFramebuffer:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsFramebuffer(" << framebuffer << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsProgram:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsProgram(" << program << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsProgramPipeline:
+{
+	glw::GLuint pipeline = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsProgramPipeline(" << pipeline << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsQuery:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsQuery(" << id << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsRenderbuffer:
+{
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsRenderbuffer(" << renderbuffer << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsSampler:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsSampler(" << sampler << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsShader:
+{
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsShader(" << shader << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsSync:
+{
+	glw::GLsync sync = decodeCallTraceArg<glw::GLsync>(traceRecord.args[0]);
+	callStr << "glIsSync(" << sync << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsTexture:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsTexture(" << texture << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsTransformFeedback:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsTransformFeedback(" << id << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glIsVertexArray:
+{
+	glw::GLuint array = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glIsVertexArray(" << array << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glLineWidth:
+{
+	glw::GLfloat width = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	callStr << "glLineWidth(" << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glLinkProgram:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glLinkProgram(" << program << ");";
+	break;
+}
+case CALLTRACEFUNC_glLogicOp:
+{
+	glw::GLenum opcode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glLogicOp(" << toHex(opcode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMapBuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum access = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glMapBuffer(" << toHex(target) << ", " << toHex(access) << ");";
+	void * returnValue = decodeCallTraceArg<void *>(traceRecord.returnValue);
+	returnStr << "// " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(returnValue))) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glMapBufferRange:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr length = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	glw::GLbitfield access = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[3]);
+	callStr << "glMapBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ", " << getBufferMapFlagsStr(access) << ");";
+	void * returnValue = decodeCallTraceArg<void *>(traceRecord.returnValue);
+	returnStr << "// " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(returnValue))) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glMapNamedBuffer:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum access = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glMapNamedBuffer(" << buffer << ", " << toHex(access) << ");";
+	void * returnValue = decodeCallTraceArg<void *>(traceRecord.returnValue);
+	returnStr << "// " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(returnValue))) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glMapNamedBufferRange:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr length = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	glw::GLbitfield access = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[3]);
+	callStr << "glMapNamedBufferRange(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");";
+	void * returnValue = decodeCallTraceArg<void *>(traceRecord.returnValue);
+	returnStr << "// " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(returnValue))) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glMatrixFrustumEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLdouble left = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble right = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble bottom = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble top = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	glw::GLdouble zNear = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[5]);
+	glw::GLdouble zFar = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[6]);
+	callStr << "glMatrixFrustumEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixLoadIdentityEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glMatrixLoadIdentityEXT(" << toHex(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixLoadTransposedEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLdouble *m = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glMatrixLoadTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixLoadTransposefEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLfloat *m = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glMatrixLoadTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixLoaddEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLdouble *m = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glMatrixLoaddEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixLoadfEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLfloat *m = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glMatrixLoadfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixMultTransposedEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLdouble *m = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glMatrixMultTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixMultTransposefEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLfloat *m = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glMatrixMultTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixMultdEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLdouble *m = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glMatrixMultdEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixMultfEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLfloat *m = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glMatrixMultfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixOrthoEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLdouble left = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble right = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble bottom = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble top = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	glw::GLdouble zNear = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[5]);
+	glw::GLdouble zFar = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[6]);
+	callStr << "glMatrixOrthoEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixPopEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glMatrixPopEXT(" << toHex(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixPushEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glMatrixPushEXT(" << toHex(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixRotatedEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLdouble angle = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	callStr << "glMatrixRotatedEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixRotatefEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLfloat angle = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat z = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	callStr << "glMatrixRotatefEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixScaledEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	callStr << "glMatrixScaledEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixScalefEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat z = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glMatrixScalefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixTranslatedEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	callStr << "glMatrixTranslatedEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glMatrixTranslatefEXT:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat z = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glMatrixTranslatefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glMaxShaderCompilerThreadsARB:
+{
+	glw::GLuint count = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glMaxShaderCompilerThreadsARB(" << count << ");";
+	break;
+}
+case CALLTRACEFUNC_glMemoryBarrier:
+{
+	glw::GLbitfield barriers = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[0]);
+	callStr << "glMemoryBarrier(" << getMemoryBarrierFlagsStr(barriers) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMemoryBarrierByRegion:
+{
+	glw::GLbitfield barriers = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[0]);
+	callStr << "glMemoryBarrierByRegion(" << toHex(barriers) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMinSampleShading:
+{
+	glw::GLfloat value = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	callStr << "glMinSampleShading(" << value << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiDrawArrays:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLint *first = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	const glw::GLsizei *count = decodeCallTraceArg<const glw::GLsizei *>(traceRecord.args[2]);
+	glw::GLsizei drawcount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glMultiDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(first))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << drawcount << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiDrawArraysIndirect:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const void *indirect = decodeCallTraceArg<const void *>(traceRecord.args[1]);
+	glw::GLsizei drawcount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glMultiDrawArraysIndirect(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))) << ", " << drawcount << ", " << stride << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiDrawArraysIndirectCountARB:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLintptr indirect = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLintptr drawcount = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLsizei maxdrawcount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glMultiDrawArraysIndirectCountARB(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiDrawElements:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLsizei *count = decodeCallTraceArg<const glw::GLsizei *>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *const*indices = decodeCallTraceArg<const void *const*>(traceRecord.args[3]);
+	glw::GLsizei drawcount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glMultiDrawElements(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiDrawElementsBaseVertex:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLsizei *count = decodeCallTraceArg<const glw::GLsizei *>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *const*indices = decodeCallTraceArg<const void *const*>(traceRecord.args[3]);
+	glw::GLsizei drawcount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	const glw::GLint *basevertex = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[5]);
+	callStr << "glMultiDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiDrawElementsIndirect:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const void *indirect = decodeCallTraceArg<const void *>(traceRecord.args[2]);
+	glw::GLsizei drawcount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glMultiDrawElementsIndirect(" << toHex(mode) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))) << ", " << drawcount << ", " << stride << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiDrawElementsIndirectCountARB:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLintptr indirect = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLintptr drawcount = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizei maxdrawcount = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glMultiDrawElementsIndirectCountARB(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexBufferEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glMultiTexBufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexCoordPointerEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const void *pointer = decodeCallTraceArg<const void *>(traceRecord.args[4]);
+	callStr << "glMultiTexCoordPointerEXT(" << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexEnvfEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glMultiTexEnvfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexEnvfvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLfloat *params = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexEnviEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glMultiTexEnviEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexEnvivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexGendEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLdouble param = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	callStr << "glMultiTexGendEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexGendvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLdouble *params = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexGenfEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glMultiTexGenfEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexGenfvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLfloat *params = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexGeniEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glMultiTexGeniEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexGenivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum coord = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexImage1DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexImage2DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexImage3DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexParameterIivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexParameterIuivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLuint *params = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexParameterfEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glMultiTexParameterfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexParameterfvEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLfloat *params = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexParameteriEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glMultiTexParameteriEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexParameterivEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexRenderbufferEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glMultiTexRenderbufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << renderbuffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexSubImage1DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexSubImage2DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glMultiTexSubImage3DEXT:
+{
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[10]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[11]);
+	callStr << "glMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedBufferData:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[1]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[2]);
+	glw::GLenum usage = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	callStr << "glNamedBufferData(" << buffer << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ", " << toHex(usage) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedBufferPageCommitmentARB:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	glw::GLboolean commit = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	callStr << "glNamedBufferPageCommitmentARB(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedBufferPageCommitmentEXT:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	glw::GLboolean commit = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	callStr << "glNamedBufferPageCommitmentEXT(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedBufferStorage:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[1]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[2]);
+	glw::GLbitfield flags = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[3]);
+	callStr << "glNamedBufferStorage(" << buffer << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ", " << toHex(flags) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedBufferSubData:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[1]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[2]);
+	const void *data = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	callStr << "glNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedCopyBufferSubDataEXT:
+{
+	glw::GLuint readBuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint writeBuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLintptr readOffset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[2]);
+	glw::GLintptr writeOffset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[4]);
+	callStr << "glNamedCopyBufferSubDataEXT(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferDrawBuffer:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum buf = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glNamedFramebufferDrawBuffer(" << framebuffer << ", " << toHex(buf) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferDrawBuffers:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei n = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLenum *bufs = decodeCallTraceArg<const glw::GLenum *>(traceRecord.args[2]);
+	callStr << "glNamedFramebufferDrawBuffers(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferParameteri:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glNamedFramebufferParameteri(" << framebuffer << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferReadBuffer:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum src = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glNamedFramebufferReadBuffer(" << framebuffer << ", " << toHex(src) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferRenderbuffer:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum renderbuffertarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glNamedFramebufferRenderbuffer(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferTexture:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glNamedFramebufferTexture(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferTexture1DEXT:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum textarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glNamedFramebufferTexture1DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferTexture2DEXT:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum textarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glNamedFramebufferTexture2DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferTexture3DEXT:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum textarget = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	callStr << "glNamedFramebufferTexture3DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferTextureFaceEXT:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLenum face = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	callStr << "glNamedFramebufferTextureFaceEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << toHex(face) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedFramebufferTextureLayer:
+{
+	glw::GLuint framebuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum attachment = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint layer = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glNamedFramebufferTextureLayer(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameter4dEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[5]);
+	glw::GLdouble w = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[6]);
+	callStr << "glNamedProgramLocalParameter4dEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameter4dvEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	const glw::GLdouble *params = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glNamedProgramLocalParameter4dvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameter4fEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	glw::GLfloat z = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[5]);
+	glw::GLfloat w = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[6]);
+	callStr << "glNamedProgramLocalParameter4fEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameter4fvEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	const glw::GLfloat *params = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glNamedProgramLocalParameter4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameterI4iEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint z = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLint w = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	callStr << "glNamedProgramLocalParameterI4iEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameterI4ivEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glNamedProgramLocalParameterI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameterI4uiEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint x = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLuint y = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	glw::GLuint z = decodeCallTraceArg<glw::GLuint>(traceRecord.args[5]);
+	glw::GLuint w = decodeCallTraceArg<glw::GLuint>(traceRecord.args[6]);
+	callStr << "glNamedProgramLocalParameterI4uiEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameterI4uivEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	const glw::GLuint *params = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glNamedProgramLocalParameterI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParameters4fvEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const glw::GLfloat *params = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glNamedProgramLocalParameters4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParametersI4ivEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[4]);
+	callStr << "glNamedProgramLocalParametersI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramLocalParametersI4uivEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const glw::GLuint *params = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[4]);
+	callStr << "glNamedProgramLocalParametersI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedProgramStringEXT:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei len = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const void *string = decodeCallTraceArg<const void *>(traceRecord.args[4]);
+	callStr << "glNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(format) << ", " << len << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedRenderbufferStorage:
+{
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glNamedRenderbufferStorage(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedRenderbufferStorageMultisample:
+{
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glNamedRenderbufferStorageMultisample(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glNamedRenderbufferStorageMultisampleCoverageEXT:
+{
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei coverageSamples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLsizei colorSamples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glNamedRenderbufferStorageMultisampleCoverageEXT(" << renderbuffer << ", " << coverageSamples << ", " << colorSamples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glObjectLabel:
+{
+	glw::GLenum identifier = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint name = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLchar *label = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glObjectLabel(" << toHex(identifier) << ", " << name << ", " << length << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glObjectPtrLabel:
+{
+	const void *ptr = decodeCallTraceArg<const void *>(traceRecord.args[0]);
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLchar *label = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[2]);
+	callStr << "glObjectPtrLabel(" << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ptr))) << ", " << length << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPatchParameterfv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLfloat *values = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glPatchParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPatchParameteri:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint value = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	callStr << "glPatchParameteri(" << getPatchParamStr(pname) << ", " << value << ");";
+	break;
+}
+case CALLTRACEFUNC_glPauseTransformFeedback:
+{
+	callStr << "glPauseTransformFeedback(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glPixelStoref:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	callStr << "glPixelStoref(" << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glPixelStorei:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	callStr << "glPixelStorei(" << getPixelStoreParameterStr(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glPointParameterf:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	callStr << "glPointParameterf(" << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glPointParameterfv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLfloat *params = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glPointParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPointParameteri:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	callStr << "glPointParameteri(" << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glPointParameteriv:
+{
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glPointParameteriv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPointSize:
+{
+	glw::GLfloat size = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	callStr << "glPointSize(" << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glPolygonMode:
+{
+	glw::GLenum face = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glPolygonMode(" << toHex(face) << ", " << toHex(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPolygonOffset:
+{
+	glw::GLfloat factor = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	glw::GLfloat units = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	callStr << "glPolygonOffset(" << factor << ", " << units << ");";
+	break;
+}
+case CALLTRACEFUNC_glPopDebugGroup:
+{
+	callStr << "glPopDebugGroup(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glPopGroupMarkerEXT:
+{
+	callStr << "glPopGroupMarkerEXT(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glPrimitiveBoundingBox:
+{
+	glw::GLfloat minX = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	glw::GLfloat minY = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat minZ = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat minW = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat maxX = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	glw::GLfloat maxY = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[5]);
+	glw::GLfloat maxZ = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[6]);
+	glw::GLfloat maxW = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[7]);
+	callStr << "glPrimitiveBoundingBox(" << minX << ", " << minY << ", " << minZ << ", " << minW << ", " << maxX << ", " << maxY << ", " << maxZ << ", " << maxW << ");";
+	break;
+}
+case CALLTRACEFUNC_glPrimitiveRestartIndex:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glPrimitiveRestartIndex(" << index << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramBinary:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum binaryFormat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const void *binary = decodeCallTraceArg<const void *>(traceRecord.args[2]);
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glProgramBinary(" << program << ", " << toHex(binaryFormat) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binary))) << ", " << length << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramParameteri:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint value = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glProgramParameteri(" << program << ", " << getProgramParamStr(pname) << ", " << value << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1d:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLdouble v0 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	callStr << "glProgramUniform1d(" << program << ", " << location << ", " << v0 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glProgramUniform1dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1f:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	callStr << "glProgramUniform1f(" << program << ", " << location << ", " << v0 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glProgramUniform1fv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1i:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glProgramUniform1i(" << program << ", " << location << ", " << v0 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1iv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform1iv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1ui:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glProgramUniform1ui(" << program << ", " << location << ", " << v0 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform1uiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform1uiv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2d:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLdouble v0 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble v1 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	callStr << "glProgramUniform2d(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glProgramUniform2dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2f:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat v1 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glProgramUniform2f(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glProgramUniform2fv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2i:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint v1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glProgramUniform2i(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2iv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform2iv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2ui:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint v1 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glProgramUniform2ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform2uiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform2uiv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3d:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLdouble v0 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble v1 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble v2 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	callStr << "glProgramUniform3d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glProgramUniform3dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3f:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat v1 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat v2 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	callStr << "glProgramUniform3f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glProgramUniform3fv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3i:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint v1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint v2 = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glProgramUniform3i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3iv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform3iv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3ui:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint v1 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLuint v2 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glProgramUniform3ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform3uiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform3uiv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4d:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLdouble v0 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble v1 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble v2 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	glw::GLdouble v3 = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[5]);
+	callStr << "glProgramUniform4d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glProgramUniform4dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4f:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat v1 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat v2 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	glw::GLfloat v3 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[5]);
+	callStr << "glProgramUniform4f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glProgramUniform4fv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4i:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint v1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint v2 = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint v3 = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	callStr << "glProgramUniform4i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4iv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform4iv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4ui:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint v1 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLuint v2 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	glw::GLuint v3 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[5]);
+	callStr << "glProgramUniform4ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniform4uiv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glProgramUniform4uiv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix2dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix2fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix2x3dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix2x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix2x3fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix2x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix2x4dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix2x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix2x4fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix2x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix3dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix3fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix3x2dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix3x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix3x2fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix3x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix3x4dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix3x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix3x4fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix3x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix4dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix4fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix4x2dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix4x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix4x2fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix4x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix4x3dv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix4x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProgramUniformMatrix4x3fv:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[4]);
+	callStr << "glProgramUniformMatrix4x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glProvokingVertex:
+{
+	glw::GLenum mode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glProvokingVertex(" << getProvokingVertexStr(mode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPushClientAttribDefaultEXT:
+{
+	glw::GLbitfield mask = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[0]);
+	callStr << "glPushClientAttribDefaultEXT(" << toHex(mask) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPushDebugGroup:
+{
+	glw::GLenum source = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLchar *message = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[3]);
+	callStr << "glPushDebugGroup(" << getDebugMessageSourceStr(source) << ", " << id << ", " << length << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(message))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glPushGroupMarkerEXT:
+{
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLchar *marker = decodeCallTraceArg<const glw::GLchar *>(traceRecord.args[1]);
+	callStr << "glPushGroupMarkerEXT(" << length << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(marker))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glQueryCounter:
+{
+	glw::GLuint id = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	callStr << "glQueryCounter(" << id << ", " << toHex(target) << ");";
+	break;
+}
+case CALLTRACEFUNC_glReadBuffer:
+{
+	glw::GLenum src = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glReadBuffer(" << getDrawReadBufferStr(src) << ");";
+	break;
+}
+case CALLTRACEFUNC_glReadPixels:
+{
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	void *pixels = decodeCallTraceArg<void *>(traceRecord.args[6]);
+	callStr << "glReadPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glReadnPixels:
+{
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	glw::GLsizei bufSize = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	void *data = decodeCallTraceArg<void *>(traceRecord.args[7]);
+	callStr << "glReadnPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glReleaseShaderCompiler:
+{
+	callStr << "glReleaseShaderCompiler(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glRenderbufferStorage:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glRenderbufferStorage(" << getFramebufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glRenderbufferStorageMultisample:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glRenderbufferStorageMultisample(" << getFramebufferTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glResumeTransformFeedback:
+{
+	callStr << "glResumeTransformFeedback(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glSampleCoverage:
+{
+	glw::GLfloat value = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[0]);
+	glw::GLboolean invert = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[1]);
+	callStr << "glSampleCoverage(" << value << ", " << getBooleanStr(invert) << ");";
+	break;
+}
+case CALLTRACEFUNC_glSampleMaski:
+{
+	glw::GLuint maskNumber = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLbitfield mask = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[1]);
+	callStr << "glSampleMaski(" << maskNumber << ", " << toHex(mask) << ");";
+	break;
+}
+case CALLTRACEFUNC_glSamplerParameterIiv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLint *param = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glSamplerParameterIuiv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLuint *param = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glSamplerParameterf:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	callStr << "glSamplerParameterf(" << sampler << ", " << getTextureParameterStr(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glSamplerParameterfv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLfloat *param = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glSamplerParameteri:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glSamplerParameteri(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");";
+	break;
+}
+case CALLTRACEFUNC_glSamplerParameteriv:
+{
+	glw::GLuint sampler = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLint *param = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glScissor:
+{
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glScissor(" << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glScissorArrayv:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glScissorArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glScissorIndexed:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint left = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint bottom = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glScissorIndexed(" << index << ", " << left << ", " << bottom << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glScissorIndexedv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glScissorIndexedv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glShaderBinary:
+{
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[0]);
+	const glw::GLuint *shaders = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	glw::GLenum binaryformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	const void *binary = decodeCallTraceArg<const void *>(traceRecord.args[3]);
+	glw::GLsizei length = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glShaderBinary(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ", " << toHex(binaryformat) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binary))) << ", " << length << ");";
+	break;
+}
+case CALLTRACEFUNC_glShaderSource:
+{
+	glw::GLuint shader = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLchar *const*string = decodeCallTraceArg<const glw::GLchar *const*>(traceRecord.args[2]);
+	const glw::GLint *length = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[3]);
+	callStr << "glShaderSource(" << shader << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glShaderStorageBlockBinding:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint storageBlockIndex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint storageBlockBinding = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glShaderStorageBlockBinding(" << program << ", " << storageBlockIndex << ", " << storageBlockBinding << ");";
+	break;
+}
+case CALLTRACEFUNC_glStencilFunc:
+{
+	glw::GLenum func = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint ref = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLuint mask = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glStencilFunc(" << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");";
+	break;
+}
+case CALLTRACEFUNC_glStencilFuncSeparate:
+{
+	glw::GLenum face = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum func = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint ref = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLuint mask = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glStencilFuncSeparate(" << getFaceStr(face) << ", " << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");";
+	break;
+}
+case CALLTRACEFUNC_glStencilMask:
+{
+	glw::GLuint mask = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glStencilMask(" << mask << ");";
+	break;
+}
+case CALLTRACEFUNC_glStencilMaskSeparate:
+{
+	glw::GLenum face = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLuint mask = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glStencilMaskSeparate(" << getFaceStr(face) << ", " << mask << ");";
+	break;
+}
+case CALLTRACEFUNC_glStencilOp:
+{
+	glw::GLenum fail = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum zfail = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum zpass = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	callStr << "glStencilOp(" << getStencilOpStr(fail) << ", " << getStencilOpStr(zfail) << ", " << getStencilOpStr(zpass) << ");";
+	break;
+}
+case CALLTRACEFUNC_glStencilOpSeparate:
+{
+	glw::GLenum face = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum sfail = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLenum dpfail = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLenum dppass = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	callStr << "glStencilOpSeparate(" << getFaceStr(face) << ", " << getStencilOpStr(sfail) << ", " << getStencilOpStr(dpfail) << ", " << getStencilOpStr(dppass) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexBuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glTexBuffer(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexBufferRange:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[4]);
+	callStr << "glTexBufferRange(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexImage1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexImage2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexImage2DMultisample:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLboolean fixedsamplelocations = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[5]);
+	callStr << "glTexImage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexImage3D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexImage3DMultisample:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLboolean fixedsamplelocations = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[6]);
+	callStr << "glTexImage3DMultisample(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexImage3DOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexPageCommitmentARB:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLboolean commit = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[8]);
+	callStr << "glTexPageCommitmentARB(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexParameterIiv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexParameterIuiv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLuint *params = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexParameterf:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	callStr << "glTexParameterf(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexParameterfv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLfloat *params = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexParameteri:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glTexParameteri(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexParameteriv:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glTexStorage1D(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage1DEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glTexStorage1DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glTexStorage2D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage2DEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glTexStorage2DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage2DMultisample:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLboolean fixedsamplelocations = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[5]);
+	callStr << "glTexStorage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage3D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glTexStorage3D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage3DEXT:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glTexStorage3DEXT(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexStorage3DMultisample:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLboolean fixedsamplelocations = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[6]);
+	callStr << "glTexStorage3DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexSubImage1D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[6]);
+	callStr << "glTexSubImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << width << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexSubImage2D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexSubImage3D:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexSubImage3DOES:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureBarrier:
+{
+	callStr << "glTextureBarrier(" << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureBuffer:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glTextureBuffer(" << texture << ", " << toHex(internalformat) << ", " << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureBufferRange:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[4]);
+	callStr << "glTextureBufferRange(" << texture << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureImage1DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureImage2DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureImage3DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint internalformat = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLint border = decodeCallTraceArg<glw::GLint>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTexturePageCommitmentEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLboolean commit = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[8]);
+	callStr << "glTexturePageCommitmentEXT(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureParameterIiv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLint *params = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureParameterIuiv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLuint *params = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureParameterf:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLfloat param = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	callStr << "glTextureParameterf(" << texture << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureParameterfv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLfloat *param = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureParameteri:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint param = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glTextureParameteri(" << texture << ", " << toHex(pname) << ", " << param << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureParameteriv:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum pname = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	const glw::GLint *param = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureRenderbufferEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint renderbuffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glTextureRenderbufferEXT(" << texture << ", " << toHex(target) << ", " << renderbuffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage1D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glTextureStorage1D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage1DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glTextureStorage1DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage2D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glTextureStorage2D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage2DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glTextureStorage2DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage2DMultisample:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLboolean fixedsamplelocations = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[5]);
+	callStr << "glTextureStorage2DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage3D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	callStr << "glTextureStorage3D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage3DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLsizei levels = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	callStr << "glTextureStorage3DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureStorage3DMultisample:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei samples = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLboolean fixedsamplelocations = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[6]);
+	callStr << "glTextureStorage3DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureSubImage1D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[6]);
+	callStr << "glTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureSubImage1DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[5]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[7]);
+	callStr << "glTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureSubImage2D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[6]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[8]);
+	callStr << "glTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureSubImage2DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[7]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[9]);
+	callStr << "glTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureSubImage3D:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[8]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[10]);
+	callStr << "glTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureSubImage3DEXT:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLint level = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint xoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint yoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	glw::GLint zoffset = decodeCallTraceArg<glw::GLint>(traceRecord.args[5]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[7]);
+	glw::GLsizei depth = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[8]);
+	glw::GLenum format = decodeCallTraceArg<glw::GLenum>(traceRecord.args[9]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[10]);
+	const void *pixels = decodeCallTraceArg<const void *>(traceRecord.args[11]);
+	callStr << "glTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glTextureView:
+{
+	glw::GLuint texture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLuint origtexture = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLenum internalformat = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLuint minlevel = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	glw::GLuint numlevels = decodeCallTraceArg<glw::GLuint>(traceRecord.args[5]);
+	glw::GLuint minlayer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[6]);
+	glw::GLuint numlayers = decodeCallTraceArg<glw::GLuint>(traceRecord.args[7]);
+	callStr << "glTextureView(" << texture << ", " << toHex(target) << ", " << origtexture << ", " << toHex(internalformat) << ", " << minlevel << ", " << numlevels << ", " << minlayer << ", " << numlayers << ");";
+	break;
+}
+case CALLTRACEFUNC_glTransformFeedbackBufferBase:
+{
+	glw::GLuint xfb = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glTransformFeedbackBufferBase(" << xfb << ", " << index << ", " << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glTransformFeedbackBufferRange:
+{
+	glw::GLuint xfb = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizeiptr size = decodeCallTraceArg<glw::GLsizeiptr>(traceRecord.args[4]);
+	callStr << "glTransformFeedbackBufferRange(" << xfb << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");";
+	break;
+}
+case CALLTRACEFUNC_glTransformFeedbackVaryings:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLchar *const*varyings = decodeCallTraceArg<const glw::GLchar *const*>(traceRecord.args[2]);
+	glw::GLenum bufferMode = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	callStr << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1d:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	callStr << "glUniform1d(" << location << ", " << x << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glUniform1dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1f:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	callStr << "glUniform1f(" << location << ", " << v0 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glUniform1fv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1i:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	callStr << "glUniform1i(" << location << ", " << v0 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1iv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glUniform1iv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1ui:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glUniform1ui(" << location << ", " << v0 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform1uiv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glUniform1uiv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2d:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	callStr << "glUniform2d(" << location << ", " << x << ", " << y << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glUniform2dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2f:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat v1 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	callStr << "glUniform2f(" << location << ", " << v0 << ", " << v1 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glUniform2fv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2i:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint v1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glUniform2i(" << location << ", " << v0 << ", " << v1 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2iv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glUniform2iv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2ui:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint v1 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glUniform2ui(" << location << ", " << v0 << ", " << v1 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform2uiv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glUniform2uiv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3d:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	callStr << "glUniform3d(" << location << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glUniform3dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3f:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat v1 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat v2 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glUniform3f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glUniform3fv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3i:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint v1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint v2 = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glUniform3i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3iv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glUniform3iv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3ui:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint v1 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint v2 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glUniform3ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform3uiv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glUniform3uiv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4d:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble w = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	callStr << "glUniform4d(" << location << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[2]);
+	callStr << "glUniform4dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4f:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLfloat v0 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat v1 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat v2 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat v3 = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	callStr << "glUniform4f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glUniform4fv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4i:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint v0 = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint v1 = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint v2 = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint v3 = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glUniform4i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4iv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLint *value = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[2]);
+	callStr << "glUniform4iv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4ui:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLuint v0 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint v1 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint v2 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLuint v3 = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glUniform4ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniform4uiv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glUniform4uiv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformBlockBinding:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint uniformBlockIndex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint uniformBlockBinding = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glUniformBlockBinding(" << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix2dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix2fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix2x3dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix2x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix2x3fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix2x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix2x4dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix2x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix2x4fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix2x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix3dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix3fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix3x2dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix3x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix3x2fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix3x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix3x4dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix3x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix3x4fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix3x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix4dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix4fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix4x2dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix4x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix4x2fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix4x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix4x3dv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLdouble *value = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix4x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformMatrix4x3fv:
+{
+	glw::GLint location = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	glw::GLboolean transpose = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLfloat *value = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[3]);
+	callStr << "glUniformMatrix4x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUniformSubroutinesuiv:
+{
+	glw::GLenum shadertype = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLuint *indices = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[2]);
+	callStr << "glUniformSubroutinesuiv(" << toHex(shadertype) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glUnmapBuffer:
+{
+	glw::GLenum target = decodeCallTraceArg<glw::GLenum>(traceRecord.args[0]);
+	callStr << "glUnmapBuffer(" << getBufferTargetStr(target) << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glUnmapNamedBuffer:
+{
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glUnmapNamedBuffer(" << buffer << ");";
+	glw::GLboolean returnValue = decodeCallTraceArg<glw::GLboolean>(traceRecord.returnValue);
+	returnStr << "// " << getBooleanStr(returnValue) << " returned";
+	break;
+}
+case CALLTRACEFUNC_glUseProgram:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glUseProgram(" << program << ");";
+	break;
+}
+case CALLTRACEFUNC_glUseProgramStages:
+{
+	glw::GLuint pipeline = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLbitfield stages = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[1]);
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glUseProgramStages(" << pipeline << ", " << getShaderTypeMaskStr(stages) << ", " << program << ");";
+	break;
+}
+case CALLTRACEFUNC_glValidateProgram:
+{
+	glw::GLuint program = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glValidateProgram(" << program << ");";
+	break;
+}
+case CALLTRACEFUNC_glValidateProgramPipeline:
+{
+	glw::GLuint pipeline = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	callStr << "glValidateProgramPipeline(" << pipeline << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayAttribBinding:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glVertexArrayAttribBinding(" << vaobj << ", " << attribindex << ", " << bindingindex << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayAttribFormat:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[4]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[5]);
+	callStr << "glVertexArrayAttribFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayAttribIFormat:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glVertexArrayAttribIFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayAttribLFormat:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glVertexArrayAttribLFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayBindVertexBufferEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glVertexArrayBindVertexBufferEXT(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayBindingDivisor:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint divisor = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glVertexArrayBindingDivisor(" << vaobj << ", " << bindingindex << ", " << divisor << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayColorOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[5]);
+	callStr << "glVertexArrayColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayEdgeFlagOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	callStr << "glVertexArrayEdgeFlagOffsetEXT(" << vaobj << ", " << buffer << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayElementBuffer:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glVertexArrayElementBuffer(" << vaobj << ", " << buffer << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayFogCoordOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[4]);
+	callStr << "glVertexArrayFogCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayIndexOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[4]);
+	callStr << "glVertexArrayIndexOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayMultiTexCoordOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum texunit = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[6]);
+	callStr << "glVertexArrayMultiTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayNormalOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[4]);
+	callStr << "glVertexArrayNormalOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArraySecondaryColorOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[5]);
+	callStr << "glVertexArraySecondaryColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayTexCoordOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[5]);
+	callStr << "glVertexArrayTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribBindingEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glVertexArrayVertexAttribBindingEXT(" << vaobj << ", " << attribindex << ", " << bindingindex << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribDivisorEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint divisor = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glVertexArrayVertexAttribDivisorEXT(" << vaobj << ", " << index << ", " << divisor << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribFormatEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[4]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[5]);
+	callStr << "glVertexArrayVertexAttribFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribIFormatEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glVertexArrayVertexAttribIFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribIOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[6]);
+	callStr << "glVertexArrayVertexAttribIOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribLFormatEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glVertexArrayVertexAttribLFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribLOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[5]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[6]);
+	callStr << "glVertexArrayVertexAttribLOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexAttribOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[4]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[5]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[6]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[7]);
+	callStr << "glVertexArrayVertexAttribOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexBindingDivisorEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint divisor = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glVertexArrayVertexBindingDivisorEXT(" << vaobj << ", " << bindingindex << ", " << divisor << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexBuffer:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	callStr << "glVertexArrayVertexBuffer(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexBuffers:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	const glw::GLuint *buffers = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	const glw::GLintptr *offsets = decodeCallTraceArg<const glw::GLintptr *>(traceRecord.args[4]);
+	const glw::GLsizei *strides = decodeCallTraceArg<const glw::GLsizei *>(traceRecord.args[5]);
+	callStr << "glVertexArrayVertexBuffers(" << vaobj << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexArrayVertexOffsetEXT:
+{
+	glw::GLuint vaobj = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint buffer = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	glw::GLintptr offset = decodeCallTraceArg<glw::GLintptr>(traceRecord.args[5]);
+	callStr << "glVertexArrayVertexOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib1d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	callStr << "glVertexAttrib1d(" << index << ", " << x << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib1dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib1f:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	callStr << "glVertexAttrib1f(" << index << ", " << x << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib1fv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLfloat *v = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib1fv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib1s:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLshort x = decodeCallTraceArg<glw::GLshort>(traceRecord.args[1]);
+	callStr << "glVertexAttrib1s(" << index << ", " << x << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib1sv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLshort *v = decodeCallTraceArg<const glw::GLshort *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib1sv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib2d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	callStr << "glVertexAttrib2d(" << index << ", " << x << ", " << y << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib2dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib2f:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	callStr << "glVertexAttrib2f(" << index << ", " << x << ", " << y << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib2fv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLfloat *v = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib2fv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib2s:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLshort x = decodeCallTraceArg<glw::GLshort>(traceRecord.args[1]);
+	glw::GLshort y = decodeCallTraceArg<glw::GLshort>(traceRecord.args[2]);
+	callStr << "glVertexAttrib2s(" << index << ", " << x << ", " << y << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib2sv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLshort *v = decodeCallTraceArg<const glw::GLshort *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib2sv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib3d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	callStr << "glVertexAttrib3d(" << index << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib3dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib3f:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat z = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	callStr << "glVertexAttrib3f(" << index << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib3fv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLfloat *v = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib3fv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib3s:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLshort x = decodeCallTraceArg<glw::GLshort>(traceRecord.args[1]);
+	glw::GLshort y = decodeCallTraceArg<glw::GLshort>(traceRecord.args[2]);
+	glw::GLshort z = decodeCallTraceArg<glw::GLshort>(traceRecord.args[3]);
+	callStr << "glVertexAttrib3s(" << index << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib3sv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLshort *v = decodeCallTraceArg<const glw::GLshort *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib3sv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4Nbv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLbyte *v = decodeCallTraceArg<const glw::GLbyte *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4Nbv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4Niv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4Niv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4Nsv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLshort *v = decodeCallTraceArg<const glw::GLshort *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4Nsv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4Nub:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLubyte x = decodeCallTraceArg<glw::GLubyte>(traceRecord.args[1]);
+	glw::GLubyte y = decodeCallTraceArg<glw::GLubyte>(traceRecord.args[2]);
+	glw::GLubyte z = decodeCallTraceArg<glw::GLubyte>(traceRecord.args[3]);
+	glw::GLubyte w = decodeCallTraceArg<glw::GLubyte>(traceRecord.args[4]);
+	callStr << "glVertexAttrib4Nub(" << index << ", " << toHex(x) << ", " << toHex(y) << ", " << toHex(z) << ", " << toHex(w) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4Nubv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLubyte *v = decodeCallTraceArg<const glw::GLubyte *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4Nubv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4Nuiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLuint *v = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4Nuiv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4Nusv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLushort *v = decodeCallTraceArg<const glw::GLushort *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4Nusv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4bv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLbyte *v = decodeCallTraceArg<const glw::GLbyte *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4bv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble w = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	callStr << "glVertexAttrib4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4f:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat z = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat w = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	callStr << "glVertexAttrib4f(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4fv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLfloat *v = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4fv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4iv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4iv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4s:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLshort x = decodeCallTraceArg<glw::GLshort>(traceRecord.args[1]);
+	glw::GLshort y = decodeCallTraceArg<glw::GLshort>(traceRecord.args[2]);
+	glw::GLshort z = decodeCallTraceArg<glw::GLshort>(traceRecord.args[3]);
+	glw::GLshort w = decodeCallTraceArg<glw::GLshort>(traceRecord.args[4]);
+	callStr << "glVertexAttrib4s(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4sv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLshort *v = decodeCallTraceArg<const glw::GLshort *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4sv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4ubv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLubyte *v = decodeCallTraceArg<const glw::GLubyte *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4ubv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLuint *v = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4uiv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttrib4usv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLushort *v = decodeCallTraceArg<const glw::GLushort *>(traceRecord.args[1]);
+	callStr << "glVertexAttrib4usv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribBinding:
+{
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glVertexAttribBinding(" << attribindex << ", " << bindingindex << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribDivisor:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint divisor = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glVertexAttribDivisor(" << index << ", " << divisor << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribFormat:
+{
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glVertexAttribFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI1i:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	callStr << "glVertexAttribI1i(" << index << ", " << x << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI1iv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI1iv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI1ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint x = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glVertexAttribI1ui(" << index << ", " << x << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI1uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLuint *v = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI1uiv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI2i:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	callStr << "glVertexAttribI2i(" << index << ", " << x << ", " << y << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI2iv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI2iv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI2ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint x = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint y = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	callStr << "glVertexAttribI2ui(" << index << ", " << x << ", " << y << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI2uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLuint *v = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI2uiv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI3i:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint z = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	callStr << "glVertexAttribI3i(" << index << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI3iv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI3iv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI3ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint x = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint y = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint z = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glVertexAttribI3ui(" << index << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI3uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLuint *v = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI3uiv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4bv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLbyte *v = decodeCallTraceArg<const glw::GLbyte *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI4bv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4i:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[2]);
+	glw::GLint z = decodeCallTraceArg<glw::GLint>(traceRecord.args[3]);
+	glw::GLint w = decodeCallTraceArg<glw::GLint>(traceRecord.args[4]);
+	callStr << "glVertexAttribI4i(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4iv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLint *v = decodeCallTraceArg<const glw::GLint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI4iv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4sv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLshort *v = decodeCallTraceArg<const glw::GLshort *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI4sv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4ubv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLubyte *v = decodeCallTraceArg<const glw::GLubyte *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI4ubv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint x = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	glw::GLuint y = decodeCallTraceArg<glw::GLuint>(traceRecord.args[2]);
+	glw::GLuint z = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	glw::GLuint w = decodeCallTraceArg<glw::GLuint>(traceRecord.args[4]);
+	callStr << "glVertexAttribI4ui(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLuint *v = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI4uiv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribI4usv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLushort *v = decodeCallTraceArg<const glw::GLushort *>(traceRecord.args[1]);
+	callStr << "glVertexAttribI4usv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribIFormat:
+{
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glVertexAttribIFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribIPointer:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const void *pointer = decodeCallTraceArg<const void *>(traceRecord.args[4]);
+	callStr << "glVertexAttribIPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << stride << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL1d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	callStr << "glVertexAttribL1d(" << index << ", " << x << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL1dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttribL1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL2d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	callStr << "glVertexAttribL2d(" << index << ", " << x << ", " << y << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL2dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttribL2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL3d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	callStr << "glVertexAttribL3d(" << index << ", " << x << ", " << y << ", " << z << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL3dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttribL3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL4d:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLdouble x = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[1]);
+	glw::GLdouble y = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[2]);
+	glw::GLdouble z = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[3]);
+	glw::GLdouble w = decodeCallTraceArg<glw::GLdouble>(traceRecord.args[4]);
+	callStr << "glVertexAttribL4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribL4dv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLdouble *v = decodeCallTraceArg<const glw::GLdouble *>(traceRecord.args[1]);
+	callStr << "glVertexAttribL4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribLFormat:
+{
+	glw::GLuint attribindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLuint relativeoffset = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glVertexAttribLFormat(" << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribLPointer:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	const void *pointer = decodeCallTraceArg<const void *>(traceRecord.args[4]);
+	callStr << "glVertexAttribLPointer(" << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP1ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	glw::GLuint value = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glVertexAttribP1ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP1uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glVertexAttribP1uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP2ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	glw::GLuint value = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glVertexAttribP2ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP2uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glVertexAttribP2uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP3ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	glw::GLuint value = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glVertexAttribP3ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP3uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glVertexAttribP3uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP4ui:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	glw::GLuint value = decodeCallTraceArg<glw::GLuint>(traceRecord.args[3]);
+	callStr << "glVertexAttribP4ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribP4uiv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[1]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[2]);
+	const glw::GLuint *value = decodeCallTraceArg<const glw::GLuint *>(traceRecord.args[3]);
+	callStr << "glVertexAttribP4uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexAttribPointer:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLint size = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLenum type = decodeCallTraceArg<glw::GLenum>(traceRecord.args[2]);
+	glw::GLboolean normalized = decodeCallTraceArg<glw::GLboolean>(traceRecord.args[3]);
+	glw::GLsizei stride = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[4]);
+	const void *pointer = decodeCallTraceArg<const void *>(traceRecord.args[5]);
+	callStr << "glVertexAttribPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glVertexBindingDivisor:
+{
+	glw::GLuint bindingindex = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLuint divisor = decodeCallTraceArg<glw::GLuint>(traceRecord.args[1]);
+	callStr << "glVertexBindingDivisor(" << bindingindex << ", " << divisor << ");";
+	break;
+}
+case CALLTRACEFUNC_glViewport:
+{
+	glw::GLint x = decodeCallTraceArg<glw::GLint>(traceRecord.args[0]);
+	glw::GLint y = decodeCallTraceArg<glw::GLint>(traceRecord.args[1]);
+	glw::GLsizei width = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[2]);
+	glw::GLsizei height = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[3]);
+	callStr << "glViewport(" << x << ", " << y << ", " << width << ", " << height << ");";
+	break;
+}
+case CALLTRACEFUNC_glViewportArrayv:
+{
+	glw::GLuint first = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLsizei count = decodeCallTraceArg<glw::GLsizei>(traceRecord.args[1]);
+	const glw::GLfloat *v = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[2]);
+	callStr << "glViewportArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glViewportIndexedf:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	glw::GLfloat x = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[1]);
+	glw::GLfloat y = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[2]);
+	glw::GLfloat w = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[3]);
+	glw::GLfloat h = decodeCallTraceArg<glw::GLfloat>(traceRecord.args[4]);
+	callStr << "glViewportIndexedf(" << index << ", " << x << ", " << y << ", " << w << ", " << h << ");";
+	break;
+}
+case CALLTRACEFUNC_glViewportIndexedfv:
+{
+	glw::GLuint index = decodeCallTraceArg<glw::GLuint>(traceRecord.args[0]);
+	const glw::GLfloat *v = decodeCallTraceArg<const glw::GLfloat *>(traceRecord.args[1]);
+	callStr << "glViewportIndexedfv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");";
+	break;
+}
+case CALLTRACEFUNC_glWaitSync:
+{
+	glw::GLsync sync = decodeCallTraceArg<glw::GLsync>(traceRecord.args[0]);
+	glw::GLbitfield flags = decodeCallTraceArg<glw::GLbitfield>(traceRecord.args[1]);
+	glw::GLuint64 timeout = decodeCallTraceArg<glw::GLuint64>(traceRecord.args[2]);
+	callStr << "glWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");";
+	break;
+}
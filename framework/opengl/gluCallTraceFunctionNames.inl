@@ -0,0 +1,844 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ *
+ * Generated from Khronos GL API description (gl.xml) revision 9302c6a6963864cba6c43d7eee0f4afcdcec2084.
+ */
+"glActiveShaderProgram",
+"glActiveTexture",
+"glAttachShader",
+"glBeginConditionalRender",
+"glBeginQuery",
+"glBeginQueryIndexed",
+"glBeginTransformFeedback",
+"glBindAttribLocation",
+"glBindBuffer",
+"glBindBufferBase",
+"glBindBufferRange",
+"glBindBuffersBase",
+"glBindBuffersRange",
+"glBindFragDataLocation",
+"glBindFragDataLocationIndexed",
+"glBindFramebuffer",
+"glBindImageTexture",
+"glBindImageTextures",
+"glBindMultiTextureEXT",
+"glBindProgramPipeline",
+"glBindRenderbuffer",
+"glBindSampler",
+"glBindSamplers",
+"glBindTexture",
+"glBindTextureUnit",
+"glBindTextures",
+"glBindTransformFeedback",
+"glBindVertexArray",
+"glBindVertexBuffer",
+"glBindVertexBuffers",
+"glBlendBarrier",
+"glBlendColor",
+"glBlendEquation",
+"glBlendEquationSeparate",
+"glBlendEquationSeparatei",
+"glBlendEquationi",
+"glBlendFunc",
+"glBlendFuncSeparate",
+"glBlendFuncSeparatei",
+"glBlendFunci",
+"glBlitFramebuffer",
+"glBlitNamedFramebuffer",
+"glBufferData",
+"glBufferPageCommitmentARB",
+"glBufferStorage",
+"glBufferSubData",
+"glCheckFramebufferStatus",
+"glCheckNamedFramebufferStatus",
+"glClampColor",
+"glClear",
+"glClearBufferData",
+"glClearBufferSubData",
+"glClearBufferfi",
+"glClearBufferfv",
+"glClearBufferiv",
+"glClearBufferuiv",
+"glClearColor",
+"glClearDepth",
+"glClearDepthf",
+"glClearNamedBufferData",
+"glClearNamedBufferSubData",
+"glClearNamedFramebufferfi",
+"glClearNamedFramebufferfv",
+"glClearNamedFramebufferiv",
+"glClearNamedFramebufferuiv",
+"glClearStencil",
+"glClearTexImage",
+"glClearTexSubImage",
+"glClientAttribDefaultEXT",
+"glClientWaitSync",
+"glClipControl",
+"glColorMask",
+"glColorMaski",
+"glCompileShader",
+"glCompressedMultiTexImage1DEXT",
+"glCompressedMultiTexImage2DEXT",
+"glCompressedMultiTexImage3DEXT",
+"glCompressedMultiTexSubImage1DEXT",
+"glCompressedMultiTexSubImage2DEXT",
+"glCompressedMultiTexSubImage3DEXT",
+"glCompressedTexImage1D",
+"glCompressedTexImage2D",
+"glCompressedTexImage3D",
+"glCompressedTexImage3DOES",
+"glCompressedTexSubImage1D",
+"glCompressedTexSubImage2D",
+"glCompressedTexSubImage3D",
+"glCompressedTexSubImage3DOES",
+"glCompressedTextureImage1DEXT",
+"glCompressedTextureImage2DEXT",
+"glCompressedTextureImage3DEXT",
+"glCompressedTextureSubImage1D",
+"glCompressedTextureSubImage1DEXT",
+"glCompressedTextureSubImage2D",
+"glCompressedTextureSubImage2DEXT",
+"glCompressedTextureSubImage3D",
+"glCompressedTextureSubImage3DEXT",
+"glCopyBufferSubData",
+"glCopyImageSubData",
+"glCopyMultiTexImage1DEXT",
+"glCopyMultiTexImage2DEXT",
+"glCopyMultiTexSubImage1DEXT",
+"glCopyMultiTexSubImage2DEXT",
+"glCopyMultiTexSubImage3DEXT",
+"glCopyNamedBufferSubData",
+"glCopyTexImage1D",
+"glCopyTexImage2D",
+"glCopyTexSubImage1D",
+"glCopyTexSubImage2D",
+"glCopyTexSubImage3D",
+"glCopyTexSubImage3DOES",
+"glCopyTextureImage1DEXT",
+"glCopyTextureImage2DEXT",
+"glCopyTextureSubImage1D",
+"glCopyTextureSubImage1DEXT",
+"glCopyTextureSubImage2D",
+"glCopyTextureSubImage2DEXT",
+"glCopyTextureSubImage3D",
+"glCopyTextureSubImage3DEXT",
+"glCreateBuffers",
+"glCreateFramebuffers",
+"glCreateProgram",
+"glCreateProgramPipelines",
+"glCreateQueries",
+"glCreateRenderbuffers",
+"glCreateSamplers",
+"glCreateShader",
+"glCreateShaderProgramv",
+"glCreateTextures",
+"glCreateTransformFeedbacks",
+"glCreateVertexArrays",
+"glCullFace",
+"glDebugMessageCallback",
+"glDebugMessageControl",
+"glDebugMessageInsert",
+"glDeleteBuffers",
+"glDeleteFramebuffers",
+"glDeleteProgram",
+"glDeleteProgramPipelines",
+"glDeleteQueries",
+"glDeleteRenderbuffers",
+"glDeleteSamplers",
+"glDeleteShader",
+"glDeleteSync",
+"glDeleteTextures",
+"glDeleteTransformFeedbacks",
+"glDeleteVertexArrays",
+"glDepthBoundsEXT",
+"glDepthFunc",
+"glDepthMask",
+"glDepthRange",
+"glDepthRangeArrayfvOES",
+"glDepthRangeArrayv",
+"glDepthRangeIndexed",
+"glDepthRangeIndexedfOES",
+"glDepthRangef",
+"glDetachShader",
+"glDisable",
+"glDisableClientStateIndexedEXT",
+"glDisableClientStateiEXT",
+"glDisableIndexedEXT",
+"glDisableVertexArrayAttrib",
+"glDisableVertexArrayEXT",
+"glDisableVertexAttribArray",
+"glDisablei",
+"glDispatchCompute",
+"glDispatchComputeIndirect",
+"glDrawArrays",
+"glDrawArraysIndirect",
+"glDrawArraysInstanced",
+"glDrawArraysInstancedBaseInstance",
+"glDrawBuffer",
+"glDrawBuffers",
+"glDrawElements",
+"glDrawElementsBaseVertex",
+"glDrawElementsIndirect",
+"glDrawElementsInstanced",
+"glDrawElementsInstancedBaseInstance",
+"glDrawElementsInstancedBaseVertex",
+"glDrawElementsInstancedBaseVertexBaseInstance",
+"glDrawRangeElements",
+"glDrawRangeElementsBaseVertex",
+"glDrawTransformFeedback",
+"glDrawTransformFeedbackInstanced",
+"glDrawTransformFeedbackStream",
+"glDrawTransformFeedbackStreamInstanced",
+"glEGLImageTargetRenderbufferStorageOES",
+"glEGLImageTargetTexture2DOES",
+"glEnable",
+"glEnableClientStateIndexedEXT",
+"glEnableClientStateiEXT",
+"glEnableIndexedEXT",
+"glEnableVertexArrayAttrib",
+"glEnableVertexArrayEXT",
+"glEnableVertexAttribArray",
+"glEnablei",
+"glEndConditionalRender",
+"glEndQuery",
+"glEndQueryIndexed",
+"glEndTransformFeedback",
+"glFenceSync",
+"glFinish",
+"glFlush",
+"glFlushMappedBufferRange",
+"glFlushMappedNamedBufferRange",
+"glFramebufferDrawBufferEXT",
+"glFramebufferDrawBuffersEXT",
+"glFramebufferParameteri",
+"glFramebufferReadBufferEXT",
+"glFramebufferRenderbuffer",
+"glFramebufferTexture",
+"glFramebufferTexture1D",
+"glFramebufferTexture2D",
+"glFramebufferTexture3D",
+"glFramebufferTexture3DOES",
+"glFramebufferTextureLayer",
+"glFrontFace",
+"glGenBuffers",
+"glGenFramebuffers",
+"glGenProgramPipelines",
+"glGenQueries",
+"glGenRenderbuffers",
+"glGenSamplers",
+"glGenTextures",
+"glGenTransformFeedbacks",
+"glGenVertexArrays",
+"glGenerateMipmap",
+"glGenerateMultiTexMipmapEXT",
+"glGenerateTextureMipmap",
+"glGetActiveAtomicCounterBufferiv",
+"glGetActiveAttrib",
+"glGetActiveSubroutineName",
+"glGetActiveSubroutineUniformName",
+"glGetActiveSubroutineUniformiv",
+"glGetActiveUniform",
+"glGetActiveUniformBlockName",
+"glGetActiveUniformBlockiv",
+"glGetActiveUniformName",
+"glGetActiveUniformsiv",
+"glGetAttachedShaders",
+"glGetAttribLocation",
+"glGetBooleanIndexedvEXT",
+"glGetBooleani_v",
+"glGetBooleanv",
+"glGetBufferParameteri64v",
+"glGetBufferParameteriv",
+"glGetBufferPointerv",
+"glGetBufferSubData",
+"glGetCompressedMultiTexImageEXT",
+"glGetCompressedTexImage",
+"glGetCompressedTextureImage",
+"glGetCompressedTextureSubImage",
+"glGetDebugMessageLog",
+"glGetDoubleIndexedvEXT",
+"glGetDoublei_v",
+"glGetDoublev",
+"glGetError",
+"glGetFloatIndexedvEXT",
+"glGetFloati_v",
+"glGetFloatv",
+"glGetFragDataIndex",
+"glGetFragDataLocation",
+"glGetFramebufferAttachmentParameteriv",
+"glGetFramebufferParameteriv",
+"glGetGraphicsResetStatus",
+"glGetInteger64i_v",
+"glGetInteger64v",
+"glGetIntegerIndexedvEXT",
+"glGetIntegeri_v",
+"glGetIntegerv",
+"glGetInternalformatSampleivNV",
+"glGetInternalformati64v",
+"glGetInternalformativ",
+"glGetMultiTexEnvfvEXT",
+"glGetMultiTexEnvivEXT",
+"glGetMultiTexGendvEXT",
+"glGetMultiTexGenfvEXT",
+"glGetMultiTexGenivEXT",
+"glGetMultiTexImageEXT",
+"glGetMultiTexLevelParameterfvEXT",
+"glGetMultiTexLevelParameterivEXT",
+"glGetMultiTexParameterIivEXT",
+"glGetMultiTexParameterIuivEXT",
+"glGetMultiTexParameterfvEXT",
+"glGetMultiTexParameterivEXT",
+"glGetMultisamplefv",
+"glGetNamedBufferParameteri64v",
+"glGetNamedBufferParameteriv",
+"glGetNamedBufferPointerv",
+"glGetNamedBufferSubData",
+"glGetNamedFramebufferAttachmentParameteriv",
+"glGetNamedFramebufferParameteriv",
+"glGetNamedProgramLocalParameterIivEXT",
+"glGetNamedProgramLocalParameterIuivEXT",
+"glGetNamedProgramLocalParameterdvEXT",
+"glGetNamedProgramLocalParameterfvEXT",
+"glGetNamedProgramStringEXT",
+"glGetNamedProgramivEXT",
+"glGetNamedRenderbufferParameteriv",
+"glGetObjectLabel",
+"glGetObjectPtrLabel",
+"glGetPointerIndexedvEXT",
+"glGetPointeri_vEXT",
+"glGetPointerv",
+"glGetProgramBinary",
+"glGetProgramInfoLog",
+"glGetProgramInterfaceiv",
+"glGetProgramPipelineInfoLog",
+"glGetProgramPipelineiv",
+"glGetProgramResourceIndex",
+"glGetProgramResourceLocation",
+"glGetProgramResourceLocationIndex",
+"glGetProgramResourceName",
+"glGetProgramResourceiv",
+"glGetProgramStageiv",
+"glGetProgramiv",
+"glGetQueryBufferObjecti64v",
+"glGetQueryBufferObjectiv",
+"glGetQueryBufferObjectui64v",
+"glGetQueryBufferObjectuiv",
+"glGetQueryIndexediv",
+"glGetQueryObjecti64v",
+"glGetQueryObjectiv",
+"glGetQueryObjectui64v",
+"glGetQueryObjectuiv",
+"glGetQueryiv",
+"glGetRenderbufferParameteriv",
+"glGetSamplerParameterIiv",
+"glGetSamplerParameterIuiv",
+"glGetSamplerParameterfv",
+"glGetSamplerParameteriv",
+"glGetShaderInfoLog",
+"glGetShaderPrecisionFormat",
+"glGetShaderSource",
+"glGetShaderiv",
+"glGetString",
+"glGetStringi",
+"glGetSubroutineIndex",
+"glGetSubroutineUniformLocation",
+"glGetSynciv",
+"glGetTexImage",
+"glGetTexLevelParameterfv",
+"glGetTexLevelParameteriv",
+"glGetTexParameterIiv",
+"glGetTexParameterIuiv",
+"glGetTexParameterfv",
+"glGetTexParameteriv",
+"glGetTextureImage",
+"glGetTextureLevelParameterfv",
+"glGetTextureLevelParameteriv",
+"glGetTextureParameterIiv",
+"glGetTextureParameterIuiv",
+"glGetTextureParameterfv",
+"glGetTextureParameteriv",
+"glGetTextureSubImage",
+"glGetTransformFeedbackVarying",
+"glGetTransformFeedbacki64_v",
+"glGetTransformFeedbacki_v",
+"glGetTransformFeedbackiv",
+"glGetUniformBlockIndex",
+"glGetUniformIndices",
+"glGetUniformLocation",
+"glGetUniformSubroutineuiv",
+"glGetUniformdv",
+"glGetUniformfv",
+"glGetUniformiv",
+"glGetUniformuiv",
+"glGetVertexArrayIndexed64iv",
+"glGetVertexArrayIndexediv",
+"glGetVertexArrayIntegeri_vEXT",
+"glGetVertexArrayIntegervEXT",
+"glGetVertexArrayPointeri_vEXT",
+"glGetVertexArrayPointervEXT",
+"glGetVertexArrayiv",
+"glGetVertexAttribIiv",
+"glGetVertexAttribIuiv",
+"glGetVertexAttribLdv",
+"glGetVertexAttribPointerv",
+"glGetVertexAttribdv",
+"glGetVertexAttribfv",
+"glGetVertexAttribiv",
+"glGetnCompressedTexImage",
+"glGetnTexImage",
+"glGetnUniformdv",
+"glGetnUniformfv",
+"glGetnUniformiv",
+"glGetnUniformuiv",
+"glHint",
+"glInsertEventMarkerEXT",
+"glInvalidateBufferData",
+"glInvalidateBufferSubData",
+"glInvalidateFramebuffer",
+"glInvalidateNamedFramebufferData",
+"glInvalidateNamedFramebufferSubData",
+"glInvalidateSubFramebuffer",
+"glInvalidateTexImage",
+"glInvalidateTexSubImage",
+"glIsBuffer",
+"glIsEnabled",
+"glIsEnabledIndexedEXT",
+"glIsEnabledi",
+"glIsFramebuffer",
+"glIsProgram",
+"glIsProgramPipeline",
+"glIsQuery",
+"glIsRenderbuffer",
+"glIsSampler",
+"glIsShader",
+"glIsSync",
+"glIsTexture",
+"glIsTransformFeedback",
+"glIsVertexArray",
+"glLineWidth",
+"glLinkProgram",
+"glLogicOp",
+"glMapBuffer",
+"glMapBufferRange",
+"glMapNamedBuffer",
+"glMapNamedBufferRange",
+"glMatrixFrustumEXT",
+"glMatrixLoadIdentityEXT",
+"glMatrixLoadTransposedEXT",
+"glMatrixLoadTransposefEXT",
+"glMatrixLoaddEXT",
+"glMatrixLoadfEXT",
+"glMatrixMultTransposedEXT",
+"glMatrixMultTransposefEXT",
+"glMatrixMultdEXT",
+"glMatrixMultfEXT",
+"glMatrixOrthoEXT",
+"glMatrixPopEXT",
+"glMatrixPushEXT",
+"glMatrixRotatedEXT",
+"glMatrixRotatefEXT",
+"glMatrixScaledEXT",
+"glMatrixScalefEXT",
+"glMatrixTranslatedEXT",
+"glMatrixTranslatefEXT",
+"glMaxShaderCompilerThreadsARB",
+"glMemoryBarrier",
+"glMemoryBarrierByRegion",
+"glMinSampleShading",
+"glMultiDrawArrays",
+"glMultiDrawArraysIndirect",
+"glMultiDrawArraysIndirectCountARB",
+"glMultiDrawElements",
+"glMultiDrawElementsBaseVertex",
+"glMultiDrawElementsIndirect",
+"glMultiDrawElementsIndirectCountARB",
+"glMultiTexBufferEXT",
+"glMultiTexCoordPointerEXT",
+"glMultiTexEnvfEXT",
+"glMultiTexEnvfvEXT",
+"glMultiTexEnviEXT",
+"glMultiTexEnvivEXT",
+"glMultiTexGendEXT",
+"glMultiTexGendvEXT",
+"glMultiTexGenfEXT",
+"glMultiTexGenfvEXT",
+"glMultiTexGeniEXT",
+"glMultiTexGenivEXT",
+"glMultiTexImage1DEXT",
+"glMultiTexImage2DEXT",
+"glMultiTexImage3DEXT",
+"glMultiTexParameterIivEXT",
+"glMultiTexParameterIuivEXT",
+"glMultiTexParameterfEXT",
+"glMultiTexParameterfvEXT",
+"glMultiTexParameteriEXT",
+"glMultiTexParameterivEXT",
+"glMultiTexRenderbufferEXT",
+"glMultiTexSubImage1DEXT",
+"glMultiTexSubImage2DEXT",
+"glMultiTexSubImage3DEXT",
+"glNamedBufferData",
+"glNamedBufferPageCommitmentARB",
+"glNamedBufferPageCommitmentEXT",
+"glNamedBufferStorage",
+"glNamedBufferSubData",
+"glNamedCopyBufferSubDataEXT",
+"glNamedFramebufferDrawBuffer",
+"glNamedFramebufferDrawBuffers",
+"glNamedFramebufferParameteri",
+"glNamedFramebufferReadBuffer",
+"glNamedFramebufferRenderbuffer",
+"glNamedFramebufferTexture",
+"glNamedFramebufferTexture1DEXT",
+"glNamedFramebufferTexture2DEXT",
+"glNamedFramebufferTexture3DEXT",
+"glNamedFramebufferTextureFaceEXT",
+"glNamedFramebufferTextureLayer",
+"glNamedProgramLocalParameter4dEXT",
+"glNamedProgramLocalParameter4dvEXT",
+"glNamedProgramLocalParameter4fEXT",
+"glNamedProgramLocalParameter4fvEXT",
+"glNamedProgramLocalParameterI4iEXT",
+"glNamedProgramLocalParameterI4ivEXT",
+"glNamedProgramLocalParameterI4uiEXT",
+"glNamedProgramLocalParameterI4uivEXT",
+"glNamedProgramLocalParameters4fvEXT",
+"glNamedProgramLocalParametersI4ivEXT",
+"glNamedProgramLocalParametersI4uivEXT",
+"glNamedProgramStringEXT",
+"glNamedRenderbufferStorage",
+"glNamedRenderbufferStorageMultisample",
+"glNamedRenderbufferStorageMultisampleCoverageEXT",
+"glObjectLabel",
+"glObjectPtrLabel",
+"glPatchParameterfv",
+"glPatchParameteri",
+"glPauseTransformFeedback",
+"glPixelStoref",
+"glPixelStorei",
+"glPointParameterf",
+"glPointParameterfv",
+"glPointParameteri",
+"glPointParameteriv",
+"glPointSize",
+"glPolygonMode",
+"glPolygonOffset",
+"glPopDebugGroup",
+"glPopGroupMarkerEXT",
+"glPrimitiveBoundingBox",
+"glPrimitiveRestartIndex",
+"glProgramBinary",
+"glProgramParameteri",
+"glProgramUniform1d",
+"glProgramUniform1dv",
+"glProgramUniform1f",
+"glProgramUniform1fv",
+"glProgramUniform1i",
+"glProgramUniform1iv",
+"glProgramUniform1ui",
+"glProgramUniform1uiv",
+"glProgramUniform2d",
+"glProgramUniform2dv",
+"glProgramUniform2f",
+"glProgramUniform2fv",
+"glProgramUniform2i",
+"glProgramUniform2iv",
+"glProgramUniform2ui",
+"glProgramUniform2uiv",
+"glProgramUniform3d",
+"glProgramUniform3dv",
+"glProgramUniform3f",
+"glProgramUniform3fv",
+"glProgramUniform3i",
+"glProgramUniform3iv",
+"glProgramUniform3ui",
+"glProgramUniform3uiv",
+"glProgramUniform4d",
+"glProgramUniform4dv",
+"glProgramUniform4f",
+"glProgramUniform4fv",
+"glProgramUniform4i",
+"glProgramUniform4iv",
+"glProgramUniform4ui",
+"glProgramUniform4uiv",
+"glProgramUniformMatrix2dv",
+"glProgramUniformMatrix2fv",
+"glProgramUniformMatrix2x3dv",
+"glProgramUniformMatrix2x3fv",
+"glProgramUniformMatrix2x4dv",
+"glProgramUniformMatrix2x4fv",
+"glProgramUniformMatrix3dv",
+"glProgramUniformMatrix3fv",
+"glProgramUniformMatrix3x2dv",
+"glProgramUniformMatrix3x2fv",
+"glProgramUniformMatrix3x4dv",
+"glProgramUniformMatrix3x4fv",
+"glProgramUniformMatrix4dv",
+"glProgramUniformMatrix4fv",
+"glProgramUniformMatrix4x2dv",
+"glProgramUniformMatrix4x2fv",
+"glProgramUniformMatrix4x3dv",
+"glProgramUniformMatrix4x3fv",
+"glProvokingVertex",
+"glPushClientAttribDefaultEXT",
+"glPushDebugGroup",
+"glPushGroupMarkerEXT",
+"glQueryCounter",
+"glReadBuffer",
+"glReadPixels",
+"glReadnPixels",
+"glReleaseShaderCompiler",
+"glRenderbufferStorage",
+"glRenderbufferStorageMultisample",
+"glResumeTransformFeedback",
+"glSampleCoverage",
+"glSampleMaski",
+"glSamplerParameterIiv",
+"glSamplerParameterIuiv",
+"glSamplerParameterf",
+"glSamplerParameterfv",
+"glSamplerParameteri",
+"glSamplerParameteriv",
+"glScissor",
+"glScissorArrayv",
+"glScissorIndexed",
+"glScissorIndexedv",
+"glShaderBinary",
+"glShaderSource",
+"glShaderStorageBlockBinding",
+"glStencilFunc",
+"glStencilFuncSeparate",
+"glStencilMask",
+"glStencilMaskSeparate",
+"glStencilOp",
+"glStencilOpSeparate",
+"glTexBuffer",
+"glTexBufferRange",
+"glTexImage1D",
+"glTexImage2D",
+"glTexImage2DMultisample",
+"glTexImage3D",
+"glTexImage3DMultisample",
+"glTexImage3DOES",
+"glTexPageCommitmentARB",
+"glTexParameterIiv",
+"glTexParameterIuiv",
+"glTexParameterf",
+"glTexParameterfv",
+"glTexParameteri",
+"glTexParameteriv",
+"glTexStorage1D",
+"glTexStorage1DEXT",
+"glTexStorage2D",
+"glTexStorage2DEXT",
+"glTexStorage2DMultisample",
+"glTexStorage3D",
+"glTexStorage3DEXT",
+"glTexStorage3DMultisample",
+"glTexSubImage1D",
+"glTexSubImage2D",
+"glTexSubImage3D",
+"glTexSubImage3DOES",
+"glTextureBarrier",
+"glTextureBuffer",
+"glTextureBufferRange",
+"glTextureImage1DEXT",
+"glTextureImage2DEXT",
+"glTextureImage3DEXT",
+"glTexturePageCommitmentEXT",
+"glTextureParameterIiv",
+"glTextureParameterIuiv",
+"glTextureParameterf",
+"glTextureParameterfv",
+"glTextureParameteri",
+"glTextureParameteriv",
+"glTextureRenderbufferEXT",
+"glTextureStorage1D",
+"glTextureStorage1DEXT",
+"glTextureStorage2D",
+"glTextureStorage2DEXT",
+"glTextureStorage2DMultisample",
+"glTextureStorage3D",
+"glTextureStorage3DEXT",
+"glTextureStorage3DMultisample",
+"glTextureSubImage1D",
+"glTextureSubImage1DEXT",
+"glTextureSubImage2D",
+"glTextureSubImage2DEXT",
+"glTextureSubImage3D",
+"glTextureSubImage3DEXT",
+"glTextureView",
+"glTransformFeedbackBufferBase",
+"glTransformFeedbackBufferRange",
+"glTransformFeedbackVaryings",
+"glUniform1d",
+"glUniform1dv",
+"glUniform1f",
+"glUniform1fv",
+"glUniform1i",
+"glUniform1iv",
+"glUniform1ui",
+"glUniform1uiv",
+"glUniform2d",
+"glUniform2dv",
+"glUniform2f",
+"glUniform2fv",
+"glUniform2i",
+"glUniform2iv",
+"glUniform2ui",
+"glUniform2uiv",
+"glUniform3d",
+"glUniform3dv",
+"glUniform3f",
+"glUniform3fv",
+"glUniform3i",
+"glUniform3iv",
+"glUniform3ui",
+"glUniform3uiv",
+"glUniform4d",
+"glUniform4dv",
+"glUniform4f",
+"glUniform4fv",
+"glUniform4i",
+"glUniform4iv",
+"glUniform4ui",
+"glUniform4uiv",
+"glUniformBlockBinding",
+"glUniformMatrix2dv",
+"glUniformMatrix2fv",
+"glUniformMatrix2x3dv",
+"glUniformMatrix2x3fv",
+"glUniformMatrix2x4dv",
+"glUniformMatrix2x4fv",
+"glUniformMatrix3dv",
+"glUniformMatrix3fv",
+"glUniformMatrix3x2dv",
+"glUniformMatrix3x2fv",
+"glUniformMatrix3x4dv",
+"glUniformMatrix3x4fv",
+"glUniformMatrix4dv",
+"glUniformMatrix4fv",
+"glUniformMatrix4x2dv",
+"glUniformMatrix4x2fv",
+"glUniformMatrix4x3dv",
+"glUniformMatrix4x3fv",
+"glUniformSubroutinesuiv",
+"glUnmapBuffer",
+"glUnmapNamedBuffer",
+"glUseProgram",
+"glUseProgramStages",
+"glValidateProgram",
+"glValidateProgramPipeline",
+"glVertexArrayAttribBinding",
+"glVertexArrayAttribFormat",
+"glVertexArrayAttribIFormat",
+"glVertexArrayAttribLFormat",
+"glVertexArrayBindVertexBufferEXT",
+"glVertexArrayBindingDivisor",
+"glVertexArrayColorOffsetEXT",
+"glVertexArrayEdgeFlagOffsetEXT",
+"glVertexArrayElementBuffer",
+"glVertexArrayFogCoordOffsetEXT",
+"glVertexArrayIndexOffsetEXT",
+"glVertexArrayMultiTexCoordOffsetEXT",
+"glVertexArrayNormalOffsetEXT",
+"glVertexArraySecondaryColorOffsetEXT",
+"glVertexArrayTexCoordOffsetEXT",
+"glVertexArrayVertexAttribBindingEXT",
+"glVertexArrayVertexAttribDivisorEXT",
+"glVertexArrayVertexAttribFormatEXT",
+"glVertexArrayVertexAttribIFormatEXT",
+"glVertexArrayVertexAttribIOffsetEXT",
+"glVertexArrayVertexAttribLFormatEXT",
+"glVertexArrayVertexAttribLOffsetEXT",
+"glVertexArrayVertexAttribOffsetEXT",
+"glVertexArrayVertexBindingDivisorEXT",
+"glVertexArrayVertexBuffer",
+"glVertexArrayVertexBuffers",
+"glVertexArrayVertexOffsetEXT",
+"glVertexAttrib1d",
+"glVertexAttrib1dv",
+"glVertexAttrib1f",
+"glVertexAttrib1fv",
+"glVertexAttrib1s",
+"glVertexAttrib1sv",
+"glVertexAttrib2d",
+"glVertexAttrib2dv",
+"glVertexAttrib2f",
+"glVertexAttrib2fv",
+"glVertexAttrib2s",
+"glVertexAttrib2sv",
+"glVertexAttrib3d",
+"glVertexAttrib3dv",
+"glVertexAttrib3f",
+"glVertexAttrib3fv",
+"glVertexAttrib3s",
+"glVertexAttrib3sv",
+"glVertexAttrib4Nbv",
+"glVertexAttrib4Niv",
+"glVertexAttrib4Nsv",
+"glVertexAttrib4Nub",
+"glVertexAttrib4Nubv",
+"glVertexAttrib4Nuiv",
+"glVertexAttrib4Nusv",
+"glVertexAttrib4bv",
+"glVertexAttrib4d",
+"glVertexAttrib4dv",
+"glVertexAttrib4f",
+"glVertexAttrib4fv",
+"glVertexAttrib4iv",
+"glVertexAttrib4s",
+"glVertexAttrib4sv",
+"glVertexAttrib4ubv",
+"glVertexAttrib4uiv",
+"glVertexAttrib4usv",
+"glVertexAttribBinding",
+"glVertexAttribDivisor",
+"glVertexAttribFormat",
+"glVertexAttribI1i",
+"glVertexAttribI1iv",
+"glVertexAttribI1ui",
+"glVertexAttribI1uiv",
+"glVertexAttribI2i",
+"glVertexAttribI2iv",
+"glVertexAttribI2ui",
+"glVertexAttribI2uiv",
+"glVertexAttribI3i",
+"glVertexAttribI3iv",
+"glVertexAttribI3ui",
+"glVertexAttribI3uiv",
+"glVertexAttribI4bv",
+"glVertexAttribI4i",
+"glVertexAttribI4iv",
+"glVertexAttribI4sv",
+"glVertexAttribI4ubv",
+"glVertexAttribI4ui",
+"glVertexAttribI4uiv",
+"glVertexAttribI4usv",
+"glVertexAttribIFormat",
+"glVertexAttribIPointer",
+"glVertexAttribL1d",
+"glVertexAttribL1dv",
+"glVertexAttribL2d",
+"glVertexAttribL2dv",
+"glVertexAttribL3d",
+"glVertexAttribL3dv",
+"glVertexAttribL4d",
+"glVertexAttribL4dv",
+"glVertexAttribLFormat",
+"glVertexAttribLPointer",
+"glVertexAttribP1ui",
+"glVertexAttribP1uiv",
+"glVertexAttribP2ui",
+"glVertexAttribP2uiv",
+"glVertexAttribP3ui",
+"glVertexAttribP3uiv",
+"glVertexAttribP4ui",
+"glVertexAttribP4uiv",
+"glVertexAttribPointer",
+"glVertexBindingDivisor",
+"glViewport",
+"glViewportArrayv",
+"glViewportIndexedf",
+"glViewportIndexedfv",
+"glWaitSync",
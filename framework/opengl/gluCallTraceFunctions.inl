@@ -0,0 +1,844 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ *
+ * Generated from Khronos GL API description (gl.xml) revision 9302c6a6963864cba6c43d7eee0f4afcdcec2084.
+ */
+CALLTRACEFUNC_glActiveShaderProgram,
+CALLTRACEFUNC_glActiveTexture,
+CALLTRACEFUNC_glAttachShader,
+CALLTRACEFUNC_glBeginConditionalRender,
+CALLTRACEFUNC_glBeginQuery,
+CALLTRACEFUNC_glBeginQueryIndexed,
+CALLTRACEFUNC_glBeginTransformFeedback,
+CALLTRACEFUNC_glBindAttribLocation,
+CALLTRACEFUNC_glBindBuffer,
+CALLTRACEFUNC_glBindBufferBase,
+CALLTRACEFUNC_glBindBufferRange,
+CALLTRACEFUNC_glBindBuffersBase,
+CALLTRACEFUNC_glBindBuffersRange,
+CALLTRACEFUNC_glBindFragDataLocation,
+CALLTRACEFUNC_glBindFragDataLocationIndexed,
+CALLTRACEFUNC_glBindFramebuffer,
+CALLTRACEFUNC_glBindImageTexture,
+CALLTRACEFUNC_glBindImageTextures,
+CALLTRACEFUNC_glBindMultiTextureEXT,
+CALLTRACEFUNC_glBindProgramPipeline,
+CALLTRACEFUNC_glBindRenderbuffer,
+CALLTRACEFUNC_glBindSampler,
+CALLTRACEFUNC_glBindSamplers,
+CALLTRACEFUNC_glBindTexture,
+CALLTRACEFUNC_glBindTextureUnit,
+CALLTRACEFUNC_glBindTextures,
+CALLTRACEFUNC_glBindTransformFeedback,
+CALLTRACEFUNC_glBindVertexArray,
+CALLTRACEFUNC_glBindVertexBuffer,
+CALLTRACEFUNC_glBindVertexBuffers,
+CALLTRACEFUNC_glBlendBarrier,
+CALLTRACEFUNC_glBlendColor,
+CALLTRACEFUNC_glBlendEquation,
+CALLTRACEFUNC_glBlendEquationSeparate,
+CALLTRACEFUNC_glBlendEquationSeparatei,
+CALLTRACEFUNC_glBlendEquationi,
+CALLTRACEFUNC_glBlendFunc,
+CALLTRACEFUNC_glBlendFuncSeparate,
+CALLTRACEFUNC_glBlendFuncSeparatei,
+CALLTRACEFUNC_glBlendFunci,
+CALLTRACEFUNC_glBlitFramebuffer,
+CALLTRACEFUNC_glBlitNamedFramebuffer,
+CALLTRACEFUNC_glBufferData,
+CALLTRACEFUNC_glBufferPageCommitmentARB,
+CALLTRACEFUNC_glBufferStorage,
+CALLTRACEFUNC_glBufferSubData,
+CALLTRACEFUNC_glCheckFramebufferStatus,
+CALLTRACEFUNC_glCheckNamedFramebufferStatus,
+CALLTRACEFUNC_glClampColor,
+CALLTRACEFUNC_glClear,
+CALLTRACEFUNC_glClearBufferData,
+CALLTRACEFUNC_glClearBufferSubData,
+CALLTRACEFUNC_glClearBufferfi,
+CALLTRACEFUNC_glClearBufferfv,
+CALLTRACEFUNC_glClearBufferiv,
+CALLTRACEFUNC_glClearBufferuiv,
+CALLTRACEFUNC_glClearColor,
+CALLTRACEFUNC_glClearDepth,
+CALLTRACEFUNC_glClearDepthf,
+CALLTRACEFUNC_glClearNamedBufferData,
+CALLTRACEFUNC_glClearNamedBufferSubData,
+CALLTRACEFUNC_glClearNamedFramebufferfi,
+CALLTRACEFUNC_glClearNamedFramebufferfv,
+CALLTRACEFUNC_glClearNamedFramebufferiv,
+CALLTRACEFUNC_glClearNamedFramebufferuiv,
+CALLTRACEFUNC_glClearStencil,
+CALLTRACEFUNC_glClearTexImage,
+CALLTRACEFUNC_glClearTexSubImage,
+CALLTRACEFUNC_glClientAttribDefaultEXT,
+CALLTRACEFUNC_glClientWaitSync,
+CALLTRACEFUNC_glClipControl,
+CALLTRACEFUNC_glColorMask,
+CALLTRACEFUNC_glColorMaski,
+CALLTRACEFUNC_glCompileShader,
+CALLTRACEFUNC_glCompressedMultiTexImage1DEXT,
+CALLTRACEFUNC_glCompressedMultiTexImage2DEXT,
+CALLTRACEFUNC_glCompressedMultiTexImage3DEXT,
+CALLTRACEFUNC_glCompressedMultiTexSubImage1DEXT,
+CALLTRACEFUNC_glCompressedMultiTexSubImage2DEXT,
+CALLTRACEFUNC_glCompressedMultiTexSubImage3DEXT,
+CALLTRACEFUNC_glCompressedTexImage1D,
+CALLTRACEFUNC_glCompressedTexImage2D,
+CALLTRACEFUNC_glCompressedTexImage3D,
+CALLTRACEFUNC_glCompressedTexImage3DOES,
+CALLTRACEFUNC_glCompressedTexSubImage1D,
+CALLTRACEFUNC_glCompressedTexSubImage2D,
+CALLTRACEFUNC_glCompressedTexSubImage3D,
+CALLTRACEFUNC_glCompressedTexSubImage3DOES,
+CALLTRACEFUNC_glCompressedTextureImage1DEXT,
+CALLTRACEFUNC_glCompressedTextureImage2DEXT,
+CALLTRACEFUNC_glCompressedTextureImage3DEXT,
+CALLTRACEFUNC_glCompressedTextureSubImage1D,
+CALLTRACEFUNC_glCompressedTextureSubImage1DEXT,
+CALLTRACEFUNC_glCompressedTextureSubImage2D,
+CALLTRACEFUNC_glCompressedTextureSubImage2DEXT,
+CALLTRACEFUNC_glCompressedTextureSubImage3D,
+CALLTRACEFUNC_glCompressedTextureSubImage3DEXT,
+CALLTRACEFUNC_glCopyBufferSubData,
+CALLTRACEFUNC_glCopyImageSubData,
+CALLTRACEFUNC_glCopyMultiTexImage1DEXT,
+CALLTRACEFUNC_glCopyMultiTexImage2DEXT,
+CALLTRACEFUNC_glCopyMultiTexSubImage1DEXT,
+CALLTRACEFUNC_glCopyMultiTexSubImage2DEXT,
+CALLTRACEFUNC_glCopyMultiTexSubImage3DEXT,
+CALLTRACEFUNC_glCopyNamedBufferSubData,
+CALLTRACEFUNC_glCopyTexImage1D,
+CALLTRACEFUNC_glCopyTexImage2D,
+CALLTRACEFUNC_glCopyTexSubImage1D,
+CALLTRACEFUNC_glCopyTexSubImage2D,
+CALLTRACEFUNC_glCopyTexSubImage3D,
+CALLTRACEFUNC_glCopyTexSubImage3DOES,
+CALLTRACEFUNC_glCopyTextureImage1DEXT,
+CALLTRACEFUNC_glCopyTextureImage2DEXT,
+CALLTRACEFUNC_glCopyTextureSubImage1D,
+CALLTRACEFUNC_glCopyTextureSubImage1DEXT,
+CALLTRACEFUNC_glCopyTextureSubImage2D,
+CALLTRACEFUNC_glCopyTextureSubImage2DEXT,
+CALLTRACEFUNC_glCopyTextureSubImage3D,
+CALLTRACEFUNC_glCopyTextureSubImage3DEXT,
+CALLTRACEFUNC_glCreateBuffers,
+CALLTRACEFUNC_glCreateFramebuffers,
+CALLTRACEFUNC_glCreateProgram,
+CALLTRACEFUNC_glCreateProgramPipelines,
+CALLTRACEFUNC_glCreateQueries,
+CALLTRACEFUNC_glCreateRenderbuffers,
+CALLTRACEFUNC_glCreateSamplers,
+CALLTRACEFUNC_glCreateShader,
+CALLTRACEFUNC_glCreateShaderProgramv,
+CALLTRACEFUNC_glCreateTextures,
+CALLTRACEFUNC_glCreateTransformFeedbacks,
+CALLTRACEFUNC_glCreateVertexArrays,
+CALLTRACEFUNC_glCullFace,
+CALLTRACEFUNC_glDebugMessageCallback,
+CALLTRACEFUNC_glDebugMessageControl,
+CALLTRACEFUNC_glDebugMessageInsert,
+CALLTRACEFUNC_glDeleteBuffers,
+CALLTRACEFUNC_glDeleteFramebuffers,
+CALLTRACEFUNC_glDeleteProgram,
+CALLTRACEFUNC_glDeleteProgramPipelines,
+CALLTRACEFUNC_glDeleteQueries,
+CALLTRACEFUNC_glDeleteRenderbuffers,
+CALLTRACEFUNC_glDeleteSamplers,
+CALLTRACEFUNC_glDeleteShader,
+CALLTRACEFUNC_glDeleteSync,
+CALLTRACEFUNC_glDeleteTextures,
+CALLTRACEFUNC_glDeleteTransformFeedbacks,
+CALLTRACEFUNC_glDeleteVertexArrays,
+CALLTRACEFUNC_glDepthBoundsEXT,
+CALLTRACEFUNC_glDepthFunc,
+CALLTRACEFUNC_glDepthMask,
+CALLTRACEFUNC_glDepthRange,
+CALLTRACEFUNC_glDepthRangeArrayfvOES,
+CALLTRACEFUNC_glDepthRangeArrayv,
+CALLTRACEFUNC_glDepthRangeIndexed,
+CALLTRACEFUNC_glDepthRangeIndexedfOES,
+CALLTRACEFUNC_glDepthRangef,
+CALLTRACEFUNC_glDetachShader,
+CALLTRACEFUNC_glDisable,
+CALLTRACEFUNC_glDisableClientStateIndexedEXT,
+CALLTRACEFUNC_glDisableClientStateiEXT,
+CALLTRACEFUNC_glDisableIndexedEXT,
+CALLTRACEFUNC_glDisableVertexArrayAttrib,
+CALLTRACEFUNC_glDisableVertexArrayEXT,
+CALLTRACEFUNC_glDisableVertexAttribArray,
+CALLTRACEFUNC_glDisablei,
+CALLTRACEFUNC_glDispatchCompute,
+CALLTRACEFUNC_glDispatchComputeIndirect,
+CALLTRACEFUNC_glDrawArrays,
+CALLTRACEFUNC_glDrawArraysIndirect,
+CALLTRACEFUNC_glDrawArraysInstanced,
+CALLTRACEFUNC_glDrawArraysInstancedBaseInstance,
+CALLTRACEFUNC_glDrawBuffer,
+CALLTRACEFUNC_glDrawBuffers,
+CALLTRACEFUNC_glDrawElements,
+CALLTRACEFUNC_glDrawElementsBaseVertex,
+CALLTRACEFUNC_glDrawElementsIndirect,
+CALLTRACEFUNC_glDrawElementsInstanced,
+CALLTRACEFUNC_glDrawElementsInstancedBaseInstance,
+CALLTRACEFUNC_glDrawElementsInstancedBaseVertex,
+CALLTRACEFUNC_glDrawElementsInstancedBaseVertexBaseInstance,
+CALLTRACEFUNC_glDrawRangeElements,
+CALLTRACEFUNC_glDrawRangeElementsBaseVertex,
+CALLTRACEFUNC_glDrawTransformFeedback,
+CALLTRACEFUNC_glDrawTransformFeedbackInstanced,
+CALLTRACEFUNC_glDrawTransformFeedbackStream,
+CALLTRACEFUNC_glDrawTransformFeedbackStreamInstanced,
+CALLTRACEFUNC_glEGLImageTargetRenderbufferStorageOES,
+CALLTRACEFUNC_glEGLImageTargetTexture2DOES,
+CALLTRACEFUNC_glEnable,
+CALLTRACEFUNC_glEnableClientStateIndexedEXT,
+CALLTRACEFUNC_glEnableClientStateiEXT,
+CALLTRACEFUNC_glEnableIndexedEXT,
+CALLTRACEFUNC_glEnableVertexArrayAttrib,
+CALLTRACEFUNC_glEnableVertexArrayEXT,
+CALLTRACEFUNC_glEnableVertexAttribArray,
+CALLTRACEFUNC_glEnablei,
+CALLTRACEFUNC_glEndConditionalRender,
+CALLTRACEFUNC_glEndQuery,
+CALLTRACEFUNC_glEndQueryIndexed,
+CALLTRACEFUNC_glEndTransformFeedback,
+CALLTRACEFUNC_glFenceSync,
+CALLTRACEFUNC_glFinish,
+CALLTRACEFUNC_glFlush,
+CALLTRACEFUNC_glFlushMappedBufferRange,
+CALLTRACEFUNC_glFlushMappedNamedBufferRange,
+CALLTRACEFUNC_glFramebufferDrawBufferEXT,
+CALLTRACEFUNC_glFramebufferDrawBuffersEXT,
+CALLTRACEFUNC_glFramebufferParameteri,
+CALLTRACEFUNC_glFramebufferReadBufferEXT,
+CALLTRACEFUNC_glFramebufferRenderbuffer,
+CALLTRACEFUNC_glFramebufferTexture,
+CALLTRACEFUNC_glFramebufferTexture1D,
+CALLTRACEFUNC_glFramebufferTexture2D,
+CALLTRACEFUNC_glFramebufferTexture3D,
+CALLTRACEFUNC_glFramebufferTexture3DOES,
+CALLTRACEFUNC_glFramebufferTextureLayer,
+CALLTRACEFUNC_glFrontFace,
+CALLTRACEFUNC_glGenBuffers,
+CALLTRACEFUNC_glGenFramebuffers,
+CALLTRACEFUNC_glGenProgramPipelines,
+CALLTRACEFUNC_glGenQueries,
+CALLTRACEFUNC_glGenRenderbuffers,
+CALLTRACEFUNC_glGenSamplers,
+CALLTRACEFUNC_glGenTextures,
+CALLTRACEFUNC_glGenTransformFeedbacks,
+CALLTRACEFUNC_glGenVertexArrays,
+CALLTRACEFUNC_glGenerateMipmap,
+CALLTRACEFUNC_glGenerateMultiTexMipmapEXT,
+CALLTRACEFUNC_glGenerateTextureMipmap,
+CALLTRACEFUNC_glGetActiveAtomicCounterBufferiv,
+CALLTRACEFUNC_glGetActiveAttrib,
+CALLTRACEFUNC_glGetActiveSubroutineName,
+CALLTRACEFUNC_glGetActiveSubroutineUniformName,
+CALLTRACEFUNC_glGetActiveSubroutineUniformiv,
+CALLTRACEFUNC_glGetActiveUniform,
+CALLTRACEFUNC_glGetActiveUniformBlockName,
+CALLTRACEFUNC_glGetActiveUniformBlockiv,
+CALLTRACEFUNC_glGetActiveUniformName,
+CALLTRACEFUNC_glGetActiveUniformsiv,
+CALLTRACEFUNC_glGetAttachedShaders,
+CALLTRACEFUNC_glGetAttribLocation,
+CALLTRACEFUNC_glGetBooleanIndexedvEXT,
+CALLTRACEFUNC_glGetBooleani_v,
+CALLTRACEFUNC_glGetBooleanv,
+CALLTRACEFUNC_glGetBufferParameteri64v,
+CALLTRACEFUNC_glGetBufferParameteriv,
+CALLTRACEFUNC_glGetBufferPointerv,
+CALLTRACEFUNC_glGetBufferSubData,
+CALLTRACEFUNC_glGetCompressedMultiTexImageEXT,
+CALLTRACEFUNC_glGetCompressedTexImage,
+CALLTRACEFUNC_glGetCompressedTextureImage,
+CALLTRACEFUNC_glGetCompressedTextureSubImage,
+CALLTRACEFUNC_glGetDebugMessageLog,
+CALLTRACEFUNC_glGetDoubleIndexedvEXT,
+CALLTRACEFUNC_glGetDoublei_v,
+CALLTRACEFUNC_glGetDoublev,
+CALLTRACEFUNC_glGetError,
+CALLTRACEFUNC_glGetFloatIndexedvEXT,
+CALLTRACEFUNC_glGetFloati_v,
+CALLTRACEFUNC_glGetFloatv,
+CALLTRACEFUNC_glGetFragDataIndex,
+CALLTRACEFUNC_glGetFragDataLocation,
+CALLTRACEFUNC_glGetFramebufferAttachmentParameteriv,
+CALLTRACEFUNC_glGetFramebufferParameteriv,
+CALLTRACEFUNC_glGetGraphicsResetStatus,
+CALLTRACEFUNC_glGetInteger64i_v,
+CALLTRACEFUNC_glGetInteger64v,
+CALLTRACEFUNC_glGetIntegerIndexedvEXT,
+CALLTRACEFUNC_glGetIntegeri_v,
+CALLTRACEFUNC_glGetIntegerv,
+CALLTRACEFUNC_glGetInternalformatSampleivNV,
+CALLTRACEFUNC_glGetInternalformati64v,
+CALLTRACEFUNC_glGetInternalformativ,
+CALLTRACEFUNC_glGetMultiTexEnvfvEXT,
+CALLTRACEFUNC_glGetMultiTexEnvivEXT,
+CALLTRACEFUNC_glGetMultiTexGendvEXT,
+CALLTRACEFUNC_glGetMultiTexGenfvEXT,
+CALLTRACEFUNC_glGetMultiTexGenivEXT,
+CALLTRACEFUNC_glGetMultiTexImageEXT,
+CALLTRACEFUNC_glGetMultiTexLevelParameterfvEXT,
+CALLTRACEFUNC_glGetMultiTexLevelParameterivEXT,
+CALLTRACEFUNC_glGetMultiTexParameterIivEXT,
+CALLTRACEFUNC_glGetMultiTexParameterIuivEXT,
+CALLTRACEFUNC_glGetMultiTexParameterfvEXT,
+CALLTRACEFUNC_glGetMultiTexParameterivEXT,
+CALLTRACEFUNC_glGetMultisamplefv,
+CALLTRACEFUNC_glGetNamedBufferParameteri64v,
+CALLTRACEFUNC_glGetNamedBufferParameteriv,
+CALLTRACEFUNC_glGetNamedBufferPointerv,
+CALLTRACEFUNC_glGetNamedBufferSubData,
+CALLTRACEFUNC_glGetNamedFramebufferAttachmentParameteriv,
+CALLTRACEFUNC_glGetNamedFramebufferParameteriv,
+CALLTRACEFUNC_glGetNamedProgramLocalParameterIivEXT,
+CALLTRACEFUNC_glGetNamedProgramLocalParameterIuivEXT,
+CALLTRACEFUNC_glGetNamedProgramLocalParameterdvEXT,
+CALLTRACEFUNC_glGetNamedProgramLocalParameterfvEXT,
+CALLTRACEFUNC_glGetNamedProgramStringEXT,
+CALLTRACEFUNC_glGetNamedProgramivEXT,
+CALLTRACEFUNC_glGetNamedRenderbufferParameteriv,
+CALLTRACEFUNC_glGetObjectLabel,
+CALLTRACEFUNC_glGetObjectPtrLabel,
+CALLTRACEFUNC_glGetPointerIndexedvEXT,
+CALLTRACEFUNC_glGetPointeri_vEXT,
+CALLTRACEFUNC_glGetPointerv,
+CALLTRACEFUNC_glGetProgramBinary,
+CALLTRACEFUNC_glGetProgramInfoLog,
+CALLTRACEFUNC_glGetProgramInterfaceiv,
+CALLTRACEFUNC_glGetProgramPipelineInfoLog,
+CALLTRACEFUNC_glGetProgramPipelineiv,
+CALLTRACEFUNC_glGetProgramResourceIndex,
+CALLTRACEFUNC_glGetProgramResourceLocation,
+CALLTRACEFUNC_glGetProgramResourceLocationIndex,
+CALLTRACEFUNC_glGetProgramResourceName,
+CALLTRACEFUNC_glGetProgramResourceiv,
+CALLTRACEFUNC_glGetProgramStageiv,
+CALLTRACEFUNC_glGetProgramiv,
+CALLTRACEFUNC_glGetQueryBufferObjecti64v,
+CALLTRACEFUNC_glGetQueryBufferObjectiv,
+CALLTRACEFUNC_glGetQueryBufferObjectui64v,
+CALLTRACEFUNC_glGetQueryBufferObjectuiv,
+CALLTRACEFUNC_glGetQueryIndexediv,
+CALLTRACEFUNC_glGetQueryObjecti64v,
+CALLTRACEFUNC_glGetQueryObjectiv,
+CALLTRACEFUNC_glGetQueryObjectui64v,
+CALLTRACEFUNC_glGetQueryObjectuiv,
+CALLTRACEFUNC_glGetQueryiv,
+CALLTRACEFUNC_glGetRenderbufferParameteriv,
+CALLTRACEFUNC_glGetSamplerParameterIiv,
+CALLTRACEFUNC_glGetSamplerParameterIuiv,
+CALLTRACEFUNC_glGetSamplerParameterfv,
+CALLTRACEFUNC_glGetSamplerParameteriv,
+CALLTRACEFUNC_glGetShaderInfoLog,
+CALLTRACEFUNC_glGetShaderPrecisionFormat,
+CALLTRACEFUNC_glGetShaderSource,
+CALLTRACEFUNC_glGetShaderiv,
+CALLTRACEFUNC_glGetString,
+CALLTRACEFUNC_glGetStringi,
+CALLTRACEFUNC_glGetSubroutineIndex,
+CALLTRACEFUNC_glGetSubroutineUniformLocation,
+CALLTRACEFUNC_glGetSynciv,
+CALLTRACEFUNC_glGetTexImage,
+CALLTRACEFUNC_glGetTexLevelParameterfv,
+CALLTRACEFUNC_glGetTexLevelParameteriv,
+CALLTRACEFUNC_glGetTexParameterIiv,
+CALLTRACEFUNC_glGetTexParameterIuiv,
+CALLTRACEFUNC_glGetTexParameterfv,
+CALLTRACEFUNC_glGetTexParameteriv,
+CALLTRACEFUNC_glGetTextureImage,
+CALLTRACEFUNC_glGetTextureLevelParameterfv,
+CALLTRACEFUNC_glGetTextureLevelParameteriv,
+CALLTRACEFUNC_glGetTextureParameterIiv,
+CALLTRACEFUNC_glGetTextureParameterIuiv,
+CALLTRACEFUNC_glGetTextureParameterfv,
+CALLTRACEFUNC_glGetTextureParameteriv,
+CALLTRACEFUNC_glGetTextureSubImage,
+CALLTRACEFUNC_glGetTransformFeedbackVarying,
+CALLTRACEFUNC_glGetTransformFeedbacki64_v,
+CALLTRACEFUNC_glGetTransformFeedbacki_v,
+CALLTRACEFUNC_glGetTransformFeedbackiv,
+CALLTRACEFUNC_glGetUniformBlockIndex,
+CALLTRACEFUNC_glGetUniformIndices,
+CALLTRACEFUNC_glGetUniformLocation,
+CALLTRACEFUNC_glGetUniformSubroutineuiv,
+CALLTRACEFUNC_glGetUniformdv,
+CALLTRACEFUNC_glGetUniformfv,
+CALLTRACEFUNC_glGetUniformiv,
+CALLTRACEFUNC_glGetUniformuiv,
+CALLTRACEFUNC_glGetVertexArrayIndexed64iv,
+CALLTRACEFUNC_glGetVertexArrayIndexediv,
+CALLTRACEFUNC_glGetVertexArrayIntegeri_vEXT,
+CALLTRACEFUNC_glGetVertexArrayIntegervEXT,
+CALLTRACEFUNC_glGetVertexArrayPointeri_vEXT,
+CALLTRACEFUNC_glGetVertexArrayPointervEXT,
+CALLTRACEFUNC_glGetVertexArrayiv,
+CALLTRACEFUNC_glGetVertexAttribIiv,
+CALLTRACEFUNC_glGetVertexAttribIuiv,
+CALLTRACEFUNC_glGetVertexAttribLdv,
+CALLTRACEFUNC_glGetVertexAttribPointerv,
+CALLTRACEFUNC_glGetVertexAttribdv,
+CALLTRACEFUNC_glGetVertexAttribfv,
+CALLTRACEFUNC_glGetVertexAttribiv,
+CALLTRACEFUNC_glGetnCompressedTexImage,
+CALLTRACEFUNC_glGetnTexImage,
+CALLTRACEFUNC_glGetnUniformdv,
+CALLTRACEFUNC_glGetnUniformfv,
+CALLTRACEFUNC_glGetnUniformiv,
+CALLTRACEFUNC_glGetnUniformuiv,
+CALLTRACEFUNC_glHint,
+CALLTRACEFUNC_glInsertEventMarkerEXT,
+CALLTRACEFUNC_glInvalidateBufferData,
+CALLTRACEFUNC_glInvalidateBufferSubData,
+CALLTRACEFUNC_glInvalidateFramebuffer,
+CALLTRACEFUNC_glInvalidateNamedFramebufferData,
+CALLTRACEFUNC_glInvalidateNamedFramebufferSubData,
+CALLTRACEFUNC_glInvalidateSubFramebuffer,
+CALLTRACEFUNC_glInvalidateTexImage,
+CALLTRACEFUNC_glInvalidateTexSubImage,
+CALLTRACEFUNC_glIsBuffer,
+CALLTRACEFUNC_glIsEnabled,
+CALLTRACEFUNC_glIsEnabledIndexedEXT,
+CALLTRACEFUNC_glIsEnabledi,
+CALLTRACEFUNC_glIsFramebuffer,
+CALLTRACEFUNC_glIsProgram,
+CALLTRACEFUNC_glIsProgramPipeline,
+CALLTRACEFUNC_glIsQuery,
+CALLTRACEFUNC_glIsRenderbuffer,
+CALLTRACEFUNC_glIsSampler,
+CALLTRACEFUNC_glIsShader,
+CALLTRACEFUNC_glIsSync,
+CALLTRACEFUNC_glIsTexture,
+CALLTRACEFUNC_glIsTransformFeedback,
+CALLTRACEFUNC_glIsVertexArray,
+CALLTRACEFUNC_glLineWidth,
+CALLTRACEFUNC_glLinkProgram,
+CALLTRACEFUNC_glLogicOp,
+CALLTRACEFUNC_glMapBuffer,
+CALLTRACEFUNC_glMapBufferRange,
+CALLTRACEFUNC_glMapNamedBuffer,
+CALLTRACEFUNC_glMapNamedBufferRange,
+CALLTRACEFUNC_glMatrixFrustumEXT,
+CALLTRACEFUNC_glMatrixLoadIdentityEXT,
+CALLTRACEFUNC_glMatrixLoadTransposedEXT,
+CALLTRACEFUNC_glMatrixLoadTransposefEXT,
+CALLTRACEFUNC_glMatrixLoaddEXT,
+CALLTRACEFUNC_glMatrixLoadfEXT,
+CALLTRACEFUNC_glMatrixMultTransposedEXT,
+CALLTRACEFUNC_glMatrixMultTransposefEXT,
+CALLTRACEFUNC_glMatrixMultdEXT,
+CALLTRACEFUNC_glMatrixMultfEXT,
+CALLTRACEFUNC_glMatrixOrthoEXT,
+CALLTRACEFUNC_glMatrixPopEXT,
+CALLTRACEFUNC_glMatrixPushEXT,
+CALLTRACEFUNC_glMatrixRotatedEXT,
+CALLTRACEFUNC_glMatrixRotatefEXT,
+CALLTRACEFUNC_glMatrixScaledEXT,
+CALLTRACEFUNC_glMatrixScalefEXT,
+CALLTRACEFUNC_glMatrixTranslatedEXT,
+CALLTRACEFUNC_glMatrixTranslatefEXT,
+CALLTRACEFUNC_glMaxShaderCompilerThreadsARB,
+CALLTRACEFUNC_glMemoryBarrier,
+CALLTRACEFUNC_glMemoryBarrierByRegion,
+CALLTRACEFUNC_glMinSampleShading,
+CALLTRACEFUNC_glMultiDrawArrays,
+CALLTRACEFUNC_glMultiDrawArraysIndirect,
+CALLTRACEFUNC_glMultiDrawArraysIndirectCountARB,
+CALLTRACEFUNC_glMultiDrawElements,
+CALLTRACEFUNC_glMultiDrawElementsBaseVertex,
+CALLTRACEFUNC_glMultiDrawElementsIndirect,
+CALLTRACEFUNC_glMultiDrawElementsIndirectCountARB,
+CALLTRACEFUNC_glMultiTexBufferEXT,
+CALLTRACEFUNC_glMultiTexCoordPointerEXT,
+CALLTRACEFUNC_glMultiTexEnvfEXT,
+CALLTRACEFUNC_glMultiTexEnvfvEXT,
+CALLTRACEFUNC_glMultiTexEnviEXT,
+CALLTRACEFUNC_glMultiTexEnvivEXT,
+CALLTRACEFUNC_glMultiTexGendEXT,
+CALLTRACEFUNC_glMultiTexGendvEXT,
+CALLTRACEFUNC_glMultiTexGenfEXT,
+CALLTRACEFUNC_glMultiTexGenfvEXT,
+CALLTRACEFUNC_glMultiTexGeniEXT,
+CALLTRACEFUNC_glMultiTexGenivEXT,
+CALLTRACEFUNC_glMultiTexImage1DEXT,
+CALLTRACEFUNC_glMultiTexImage2DEXT,
+CALLTRACEFUNC_glMultiTexImage3DEXT,
+CALLTRACEFUNC_glMultiTexParameterIivEXT,
+CALLTRACEFUNC_glMultiTexParameterIuivEXT,
+CALLTRACEFUNC_glMultiTexParameterfEXT,
+CALLTRACEFUNC_glMultiTexParameterfvEXT,
+CALLTRACEFUNC_glMultiTexParameteriEXT,
+CALLTRACEFUNC_glMultiTexParameterivEXT,
+CALLTRACEFUNC_glMultiTexRenderbufferEXT,
+CALLTRACEFUNC_glMultiTexSubImage1DEXT,
+CALLTRACEFUNC_glMultiTexSubImage2DEXT,
+CALLTRACEFUNC_glMultiTexSubImage3DEXT,
+CALLTRACEFUNC_glNamedBufferData,
+CALLTRACEFUNC_glNamedBufferPageCommitmentARB,
+CALLTRACEFUNC_glNamedBufferPageCommitmentEXT,
+CALLTRACEFUNC_glNamedBufferStorage,
+CALLTRACEFUNC_glNamedBufferSubData,
+CALLTRACEFUNC_glNamedCopyBufferSubDataEXT,
+CALLTRACEFUNC_glNamedFramebufferDrawBuffer,
+CALLTRACEFUNC_glNamedFramebufferDrawBuffers,
+CALLTRACEFUNC_glNamedFramebufferParameteri,
+CALLTRACEFUNC_glNamedFramebufferReadBuffer,
+CALLTRACEFUNC_glNamedFramebufferRenderbuffer,
+CALLTRACEFUNC_glNamedFramebufferTexture,
+CALLTRACEFUNC_glNamedFramebufferTexture1DEXT,
+CALLTRACEFUNC_glNamedFramebufferTexture2DEXT,
+CALLTRACEFUNC_glNamedFramebufferTexture3DEXT,
+CALLTRACEFUNC_glNamedFramebufferTextureFaceEXT,
+CALLTRACEFUNC_glNamedFramebufferTextureLayer,
+CALLTRACEFUNC_glNamedProgramLocalParameter4dEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameter4dvEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameter4fEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameter4fvEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameterI4iEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameterI4ivEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameterI4uiEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameterI4uivEXT,
+CALLTRACEFUNC_glNamedProgramLocalParameters4fvEXT,
+CALLTRACEFUNC_glNamedProgramLocalParametersI4ivEXT,
+CALLTRACEFUNC_glNamedProgramLocalParametersI4uivEXT,
+CALLTRACEFUNC_glNamedProgramStringEXT,
+CALLTRACEFUNC_glNamedRenderbufferStorage,
+CALLTRACEFUNC_glNamedRenderbufferStorageMultisample,
+CALLTRACEFUNC_glNamedRenderbufferStorageMultisampleCoverageEXT,
+CALLTRACEFUNC_glObjectLabel,
+CALLTRACEFUNC_glObjectPtrLabel,
+CALLTRACEFUNC_glPatchParameterfv,
+CALLTRACEFUNC_glPatchParameteri,
+CALLTRACEFUNC_glPauseTransformFeedback,
+CALLTRACEFUNC_glPixelStoref,
+CALLTRACEFUNC_glPixelStorei,
+CALLTRACEFUNC_glPointParameterf,
+CALLTRACEFUNC_glPointParameterfv,
+CALLTRACEFUNC_glPointParameteri,
+CALLTRACEFUNC_glPointParameteriv,
+CALLTRACEFUNC_glPointSize,
+CALLTRACEFUNC_glPolygonMode,
+CALLTRACEFUNC_glPolygonOffset,
+CALLTRACEFUNC_glPopDebugGroup,
+CALLTRACEFUNC_glPopGroupMarkerEXT,
+CALLTRACEFUNC_glPrimitiveBoundingBox,
+CALLTRACEFUNC_glPrimitiveRestartIndex,
+CALLTRACEFUNC_glProgramBinary,
+CALLTRACEFUNC_glProgramParameteri,
+CALLTRACEFUNC_glProgramUniform1d,
+CALLTRACEFUNC_glProgramUniform1dv,
+CALLTRACEFUNC_glProgramUniform1f,
+CALLTRACEFUNC_glProgramUniform1fv,
+CALLTRACEFUNC_glProgramUniform1i,
+CALLTRACEFUNC_glProgramUniform1iv,
+CALLTRACEFUNC_glProgramUniform1ui,
+CALLTRACEFUNC_glProgramUniform1uiv,
+CALLTRACEFUNC_glProgramUniform2d,
+CALLTRACEFUNC_glProgramUniform2dv,
+CALLTRACEFUNC_glProgramUniform2f,
+CALLTRACEFUNC_glProgramUniform2fv,
+CALLTRACEFUNC_glProgramUniform2i,
+CALLTRACEFUNC_glProgramUniform2iv,
+CALLTRACEFUNC_glProgramUniform2ui,
+CALLTRACEFUNC_glProgramUniform2uiv,
+CALLTRACEFUNC_glProgramUniform3d,
+CALLTRACEFUNC_glProgramUniform3dv,
+CALLTRACEFUNC_glProgramUniform3f,
+CALLTRACEFUNC_glProgramUniform3fv,
+CALLTRACEFUNC_glProgramUniform3i,
+CALLTRACEFUNC_glProgramUniform3iv,
+CALLTRACEFUNC_glProgramUniform3ui,
+CALLTRACEFUNC_glProgramUniform3uiv,
+CALLTRACEFUNC_glProgramUniform4d,
+CALLTRACEFUNC_glProgramUniform4dv,
+CALLTRACEFUNC_glProgramUniform4f,
+CALLTRACEFUNC_glProgramUniform4fv,
+CALLTRACEFUNC_glProgramUniform4i,
+CALLTRACEFUNC_glProgramUniform4iv,
+CALLTRACEFUNC_glProgramUniform4ui,
+CALLTRACEFUNC_glProgramUniform4uiv,
+CALLTRACEFUNC_glProgramUniformMatrix2dv,
+CALLTRACEFUNC_glProgramUniformMatrix2fv,
+CALLTRACEFUNC_glProgramUniformMatrix2x3dv,
+CALLTRACEFUNC_glProgramUniformMatrix2x3fv,
+CALLTRACEFUNC_glProgramUniformMatrix2x4dv,
+CALLTRACEFUNC_glProgramUniformMatrix2x4fv,
+CALLTRACEFUNC_glProgramUniformMatrix3dv,
+CALLTRACEFUNC_glProgramUniformMatrix3fv,
+CALLTRACEFUNC_glProgramUniformMatrix3x2dv,
+CALLTRACEFUNC_glProgramUniformMatrix3x2fv,
+CALLTRACEFUNC_glProgramUniformMatrix3x4dv,
+CALLTRACEFUNC_glProgramUniformMatrix3x4fv,
+CALLTRACEFUNC_glProgramUniformMatrix4dv,
+CALLTRACEFUNC_glProgramUniformMatrix4fv,
+CALLTRACEFUNC_glProgramUniformMatrix4x2dv,
+CALLTRACEFUNC_glProgramUniformMatrix4x2fv,
+CALLTRACEFUNC_glProgramUniformMatrix4x3dv,
+CALLTRACEFUNC_glProgramUniformMatrix4x3fv,
+CALLTRACEFUNC_glProvokingVertex,
+CALLTRACEFUNC_glPushClientAttribDefaultEXT,
+CALLTRACEFUNC_glPushDebugGroup,
+CALLTRACEFUNC_glPushGroupMarkerEXT,
+CALLTRACEFUNC_glQueryCounter,
+CALLTRACEFUNC_glReadBuffer,
+CALLTRACEFUNC_glReadPixels,
+CALLTRACEFUNC_glReadnPixels,
+CALLTRACEFUNC_glReleaseShaderCompiler,
+CALLTRACEFUNC_glRenderbufferStorage,
+CALLTRACEFUNC_glRenderbufferStorageMultisample,
+CALLTRACEFUNC_glResumeTransformFeedback,
+CALLTRACEFUNC_glSampleCoverage,
+CALLTRACEFUNC_glSampleMaski,
+CALLTRACEFUNC_glSamplerParameterIiv,
+CALLTRACEFUNC_glSamplerParameterIuiv,
+CALLTRACEFUNC_glSamplerParameterf,
+CALLTRACEFUNC_glSamplerParameterfv,
+CALLTRACEFUNC_glSamplerParameteri,
+CALLTRACEFUNC_glSamplerParameteriv,
+CALLTRACEFUNC_glScissor,
+CALLTRACEFUNC_glScissorArrayv,
+CALLTRACEFUNC_glScissorIndexed,
+CALLTRACEFUNC_glScissorIndexedv,
+CALLTRACEFUNC_glShaderBinary,
+CALLTRACEFUNC_glShaderSource,
+CALLTRACEFUNC_glShaderStorageBlockBinding,
+CALLTRACEFUNC_glStencilFunc,
+CALLTRACEFUNC_glStencilFuncSeparate,
+CALLTRACEFUNC_glStencilMask,
+CALLTRACEFUNC_glStencilMaskSeparate,
+CALLTRACEFUNC_glStencilOp,
+CALLTRACEFUNC_glStencilOpSeparate,
+CALLTRACEFUNC_glTexBuffer,
+CALLTRACEFUNC_glTexBufferRange,
+CALLTRACEFUNC_glTexImage1D,
+CALLTRACEFUNC_glTexImage2D,
+CALLTRACEFUNC_glTexImage2DMultisample,
+CALLTRACEFUNC_glTexImage3D,
+CALLTRACEFUNC_glTexImage3DMultisample,
+CALLTRACEFUNC_glTexImage3DOES,
+CALLTRACEFUNC_glTexPageCommitmentARB,
+CALLTRACEFUNC_glTexParameterIiv,
+CALLTRACEFUNC_glTexParameterIuiv,
+CALLTRACEFUNC_glTexParameterf,
+CALLTRACEFUNC_glTexParameterfv,
+CALLTRACEFUNC_glTexParameteri,
+CALLTRACEFUNC_glTexParameteriv,
+CALLTRACEFUNC_glTexStorage1D,
+CALLTRACEFUNC_glTexStorage1DEXT,
+CALLTRACEFUNC_glTexStorage2D,
+CALLTRACEFUNC_glTexStorage2DEXT,
+CALLTRACEFUNC_glTexStorage2DMultisample,
+CALLTRACEFUNC_glTexStorage3D,
+CALLTRACEFUNC_glTexStorage3DEXT,
+CALLTRACEFUNC_glTexStorage3DMultisample,
+CALLTRACEFUNC_glTexSubImage1D,
+CALLTRACEFUNC_glTexSubImage2D,
+CALLTRACEFUNC_glTexSubImage3D,
+CALLTRACEFUNC_glTexSubImage3DOES,
+CALLTRACEFUNC_glTextureBarrier,
+CALLTRACEFUNC_glTextureBuffer,
+CALLTRACEFUNC_glTextureBufferRange,
+CALLTRACEFUNC_glTextureImage1DEXT,
+CALLTRACEFUNC_glTextureImage2DEXT,
+CALLTRACEFUNC_glTextureImage3DEXT,
+CALLTRACEFUNC_glTexturePageCommitmentEXT,
+CALLTRACEFUNC_glTextureParameterIiv,
+CALLTRACEFUNC_glTextureParameterIuiv,
+CALLTRACEFUNC_glTextureParameterf,
+CALLTRACEFUNC_glTextureParameterfv,
+CALLTRACEFUNC_glTextureParameteri,
+CALLTRACEFUNC_glTextureParameteriv,
+CALLTRACEFUNC_glTextureRenderbufferEXT,
+CALLTRACEFUNC_glTextureStorage1D,
+CALLTRACEFUNC_glTextureStorage1DEXT,
+CALLTRACEFUNC_glTextureStorage2D,
+CALLTRACEFUNC_glTextureStorage2DEXT,
+CALLTRACEFUNC_glTextureStorage2DMultisample,
+CALLTRACEFUNC_glTextureStorage3D,
+CALLTRACEFUNC_glTextureStorage3DEXT,
+CALLTRACEFUNC_glTextureStorage3DMultisample,
+CALLTRACEFUNC_glTextureSubImage1D,
+CALLTRACEFUNC_glTextureSubImage1DEXT,
+CALLTRACEFUNC_glTextureSubImage2D,
+CALLTRACEFUNC_glTextureSubImage2DEXT,
+CALLTRACEFUNC_glTextureSubImage3D,
+CALLTRACEFUNC_glTextureSubImage3DEXT,
+CALLTRACEFUNC_glTextureView,
+CALLTRACEFUNC_glTransformFeedbackBufferBase,
+CALLTRACEFUNC_glTransformFeedbackBufferRange,
+CALLTRACEFUNC_glTransformFeedbackVaryings,
+CALLTRACEFUNC_glUniform1d,
+CALLTRACEFUNC_glUniform1dv,
+CALLTRACEFUNC_glUniform1f,
+CALLTRACEFUNC_glUniform1fv,
+CALLTRACEFUNC_glUniform1i,
+CALLTRACEFUNC_glUniform1iv,
+CALLTRACEFUNC_glUniform1ui,
+CALLTRACEFUNC_glUniform1uiv,
+CALLTRACEFUNC_glUniform2d,
+CALLTRACEFUNC_glUniform2dv,
+CALLTRACEFUNC_glUniform2f,
+CALLTRACEFUNC_glUniform2fv,
+CALLTRACEFUNC_glUniform2i,
+CALLTRACEFUNC_glUniform2iv,
+CALLTRACEFUNC_glUniform2ui,
+CALLTRACEFUNC_glUniform2uiv,
+CALLTRACEFUNC_glUniform3d,
+CALLTRACEFUNC_glUniform3dv,
+CALLTRACEFUNC_glUniform3f,
+CALLTRACEFUNC_glUniform3fv,
+CALLTRACEFUNC_glUniform3i,
+CALLTRACEFUNC_glUniform3iv,
+CALLTRACEFUNC_glUniform3ui,
+CALLTRACEFUNC_glUniform3uiv,
+CALLTRACEFUNC_glUniform4d,
+CALLTRACEFUNC_glUniform4dv,
+CALLTRACEFUNC_glUniform4f,
+CALLTRACEFUNC_glUniform4fv,
+CALLTRACEFUNC_glUniform4i,
+CALLTRACEFUNC_glUniform4iv,
+CALLTRACEFUNC_glUniform4ui,
+CALLTRACEFUNC_glUniform4uiv,
+CALLTRACEFUNC_glUniformBlockBinding,
+CALLTRACEFUNC_glUniformMatrix2dv,
+CALLTRACEFUNC_glUniformMatrix2fv,
+CALLTRACEFUNC_glUniformMatrix2x3dv,
+CALLTRACEFUNC_glUniformMatrix2x3fv,
+CALLTRACEFUNC_glUniformMatrix2x4dv,
+CALLTRACEFUNC_glUniformMatrix2x4fv,
+CALLTRACEFUNC_glUniformMatrix3dv,
+CALLTRACEFUNC_glUniformMatrix3fv,
+CALLTRACEFUNC_glUniformMatrix3x2dv,
+CALLTRACEFUNC_glUniformMatrix3x2fv,
+CALLTRACEFUNC_glUniformMatrix3x4dv,
+CALLTRACEFUNC_glUniformMatrix3x4fv,
+CALLTRACEFUNC_glUniformMatrix4dv,
+CALLTRACEFUNC_glUniformMatrix4fv,
+CALLTRACEFUNC_glUniformMatrix4x2dv,
+CALLTRACEFUNC_glUniformMatrix4x2fv,
+CALLTRACEFUNC_glUniformMatrix4x3dv,
+CALLTRACEFUNC_glUniformMatrix4x3fv,
+CALLTRACEFUNC_glUniformSubroutinesuiv,
+CALLTRACEFUNC_glUnmapBuffer,
+CALLTRACEFUNC_glUnmapNamedBuffer,
+CALLTRACEFUNC_glUseProgram,
+CALLTRACEFUNC_glUseProgramStages,
+CALLTRACEFUNC_glValidateProgram,
+CALLTRACEFUNC_glValidateProgramPipeline,
+CALLTRACEFUNC_glVertexArrayAttribBinding,
+CALLTRACEFUNC_glVertexArrayAttribFormat,
+CALLTRACEFUNC_glVertexArrayAttribIFormat,
+CALLTRACEFUNC_glVertexArrayAttribLFormat,
+CALLTRACEFUNC_glVertexArrayBindVertexBufferEXT,
+CALLTRACEFUNC_glVertexArrayBindingDivisor,
+CALLTRACEFUNC_glVertexArrayColorOffsetEXT,
+CALLTRACEFUNC_glVertexArrayEdgeFlagOffsetEXT,
+CALLTRACEFUNC_glVertexArrayElementBuffer,
+CALLTRACEFUNC_glVertexArrayFogCoordOffsetEXT,
+CALLTRACEFUNC_glVertexArrayIndexOffsetEXT,
+CALLTRACEFUNC_glVertexArrayMultiTexCoordOffsetEXT,
+CALLTRACEFUNC_glVertexArrayNormalOffsetEXT,
+CALLTRACEFUNC_glVertexArraySecondaryColorOffsetEXT,
+CALLTRACEFUNC_glVertexArrayTexCoordOffsetEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribBindingEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribDivisorEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribFormatEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribIFormatEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribIOffsetEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribLFormatEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribLOffsetEXT,
+CALLTRACEFUNC_glVertexArrayVertexAttribOffsetEXT,
+CALLTRACEFUNC_glVertexArrayVertexBindingDivisorEXT,
+CALLTRACEFUNC_glVertexArrayVertexBuffer,
+CALLTRACEFUNC_glVertexArrayVertexBuffers,
+CALLTRACEFUNC_glVertexArrayVertexOffsetEXT,
+CALLTRACEFUNC_glVertexAttrib1d,
+CALLTRACEFUNC_glVertexAttrib1dv,
+CALLTRACEFUNC_glVertexAttrib1f,
+CALLTRACEFUNC_glVertexAttrib1fv,
+CALLTRACEFUNC_glVertexAttrib1s,
+CALLTRACEFUNC_glVertexAttrib1sv,
+CALLTRACEFUNC_glVertexAttrib2d,
+CALLTRACEFUNC_glVertexAttrib2dv,
+CALLTRACEFUNC_glVertexAttrib2f,
+CALLTRACEFUNC_glVertexAttrib2fv,
+CALLTRACEFUNC_glVertexAttrib2s,
+CALLTRACEFUNC_glVertexAttrib2sv,
+CALLTRACEFUNC_glVertexAttrib3d,
+CALLTRACEFUNC_glVertexAttrib3dv,
+CALLTRACEFUNC_glVertexAttrib3f,
+CALLTRACEFUNC_glVertexAttrib3fv,
+CALLTRACEFUNC_glVertexAttrib3s,
+CALLTRACEFUNC_glVertexAttrib3sv,
+CALLTRACEFUNC_glVertexAttrib4Nbv,
+CALLTRACEFUNC_glVertexAttrib4Niv,
+CALLTRACEFUNC_glVertexAttrib4Nsv,
+CALLTRACEFUNC_glVertexAttrib4Nub,
+CALLTRACEFUNC_glVertexAttrib4Nubv,
+CALLTRACEFUNC_glVertexAttrib4Nuiv,
+CALLTRACEFUNC_glVertexAttrib4Nusv,
+CALLTRACEFUNC_glVertexAttrib4bv,
+CALLTRACEFUNC_glVertexAttrib4d,
+CALLTRACEFUNC_glVertexAttrib4dv,
+CALLTRACEFUNC_glVertexAttrib4f,
+CALLTRACEFUNC_glVertexAttrib4fv,
+CALLTRACEFUNC_glVertexAttrib4iv,
+CALLTRACEFUNC_glVertexAttrib4s,
+CALLTRACEFUNC_glVertexAttrib4sv,
+CALLTRACEFUNC_glVertexAttrib4ubv,
+CALLTRACEFUNC_glVertexAttrib4uiv,
+CALLTRACEFUNC_glVertexAttrib4usv,
+CALLTRACEFUNC_glVertexAttribBinding,
+CALLTRACEFUNC_glVertexAttribDivisor,
+CALLTRACEFUNC_glVertexAttribFormat,
+CALLTRACEFUNC_glVertexAttribI1i,
+CALLTRACEFUNC_glVertexAttribI1iv,
+CALLTRACEFUNC_glVertexAttribI1ui,
+CALLTRACEFUNC_glVertexAttribI1uiv,
+CALLTRACEFUNC_glVertexAttribI2i,
+CALLTRACEFUNC_glVertexAttribI2iv,
+CALLTRACEFUNC_glVertexAttribI2ui,
+CALLTRACEFUNC_glVertexAttribI2uiv,
+CALLTRACEFUNC_glVertexAttribI3i,
+CALLTRACEFUNC_glVertexAttribI3iv,
+CALLTRACEFUNC_glVertexAttribI3ui,
+CALLTRACEFUNC_glVertexAttribI3uiv,
+CALLTRACEFUNC_glVertexAttribI4bv,
+CALLTRACEFUNC_glVertexAttribI4i,
+CALLTRACEFUNC_glVertexAttribI4iv,
+CALLTRACEFUNC_glVertexAttribI4sv,
+CALLTRACEFUNC_glVertexAttribI4ubv,
+CALLTRACEFUNC_glVertexAttribI4ui,
+CALLTRACEFUNC_glVertexAttribI4uiv,
+CALLTRACEFUNC_glVertexAttribI4usv,
+CALLTRACEFUNC_glVertexAttribIFormat,
+CALLTRACEFUNC_glVertexAttribIPointer,
+CALLTRACEFUNC_glVertexAttribL1d,
+CALLTRACEFUNC_glVertexAttribL1dv,
+CALLTRACEFUNC_glVertexAttribL2d,
+CALLTRACEFUNC_glVertexAttribL2dv,
+CALLTRACEFUNC_glVertexAttribL3d,
+CALLTRACEFUNC_glVertexAttribL3dv,
+CALLTRACEFUNC_glVertexAttribL4d,
+CALLTRACEFUNC_glVertexAttribL4dv,
+CALLTRACEFUNC_glVertexAttribLFormat,
+CALLTRACEFUNC_glVertexAttribLPointer,
+CALLTRACEFUNC_glVertexAttribP1ui,
+CALLTRACEFUNC_glVertexAttribP1uiv,
+CALLTRACEFUNC_glVertexAttribP2ui,
+CALLTRACEFUNC_glVertexAttribP2uiv,
+CALLTRACEFUNC_glVertexAttribP3ui,
+CALLTRACEFUNC_glVertexAttribP3uiv,
+CALLTRACEFUNC_glVertexAttribP4ui,
+CALLTRACEFUNC_glVertexAttribP4uiv,
+CALLTRACEFUNC_glVertexAttribPointer,
+CALLTRACEFUNC_glVertexBindingDivisor,
+CALLTRACEFUNC_glViewport,
+CALLTRACEFUNC_glViewportArrayv,
+CALLTRACEFUNC_glViewportIndexedf,
+CALLTRACEFUNC_glViewportIndexedfv,
+CALLTRACEFUNC_glWaitSync,
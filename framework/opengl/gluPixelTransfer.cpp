@@ -28,6 +28,7 @@
 #include "glwFunctions.hpp"
 #include "tcuTexture.hpp"
 #include "tcuSurface.hpp"
+#include "tcuInstrumentation.hpp"
 #include "deMemory.h"
 
 namespace glu
@@ -48,6 +49,8 @@ static inline int getTransferAlignment (tcu::TextureFormat format)
  *//*--------------------------------------------------------------------*/
 void readPixels (const RenderContext& context, int x, int y, const tcu::PixelBufferAccess& dst)
 {
+	const tcu::InstrumentationScope scope ("glu::readPixels");
+
 	const glw::Functions& gl = context.getFunctions();
 
 	TCU_CHECK_INTERNAL(dst.getDepth() == 1);
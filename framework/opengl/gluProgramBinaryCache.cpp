@@ -0,0 +1,294 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief On-disk program binary cache.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluProgramBinaryCache.hpp"
+#include "gluShaderProgram.hpp"
+#include "gluRenderContext.hpp"
+#include "glwFunctions.hpp"
+#include "glwEnums.hpp"
+#include "deAtomic.h"
+#include "deFilePath.hpp"
+#include "deMutex.hpp"
+#include "deProcess.h"
+#include "deSha1.hpp"
+#include "deStringUtil.hpp"
+
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+namespace glu
+{
+
+using std::string;
+using std::vector;
+
+namespace
+{
+
+enum
+{
+	BINARY_FORMAT_MAGIC		= 0x64504243,	//!< "dPBC"
+	BINARY_FORMAT_VERSION	= 2
+};
+
+de::Mutex			s_cacheDirLock;
+string				s_cacheDir;
+volatile deUint32	s_tmpFileCounter	= 0;
+
+string getGLString (const glw::Functions& gl, deUint32 name)
+{
+	const char* const str = (const char*)gl.getString(name);
+	return str ? string(str) : string();
+}
+
+class BinaryWriter
+{
+public:
+	BinaryWriter (vector<deUint8>& dst) : m_dst(dst) {}
+
+	void writeU32 (deUint32 value)
+	{
+		for (int shift = 0; shift < 32; shift += 8)
+			m_dst.push_back((deUint8)(value >> shift));
+	}
+
+	void writeBytes (size_t size, const deUint8* data)
+	{
+		writeU32((deUint32)size);
+		m_dst.insert(m_dst.end(), data, data+size);
+	}
+
+	void writeString (const string& str)
+	{
+		writeBytes(str.size(), (const deUint8*)str.c_str());
+	}
+
+private:
+	vector<deUint8>&	m_dst;
+};
+
+class BinaryReader
+{
+public:
+	BinaryReader (const vector<deUint8>& src) : m_src(src), m_pos(0) {}
+
+	deUint32 readU32 (void)
+	{
+		deUint32 value = 0;
+
+		require(4);
+		for (int shift = 0; shift < 32; shift += 8)
+			value |= (deUint32)m_src[m_pos++] << shift;
+
+		return value;
+	}
+
+	void readBytes (vector<deUint8>& dst)
+	{
+		const size_t size = (size_t)readU32();
+
+		require(size);
+		dst.assign(m_src.begin() + m_pos, m_src.begin() + m_pos + size);
+		m_pos += size;
+	}
+
+	string readString (void)
+	{
+		const size_t	size	= (size_t)readU32();
+		string			str;
+
+		require(size);
+		str.assign((const char*)&m_src[0] + m_pos, size);
+		m_pos += size;
+
+		return str;
+	}
+
+	bool isAtEnd (void) const { return m_pos == m_src.size(); }
+
+	static void check (bool condition)
+	{
+		if (!condition)
+			throw tcu::InternalError("Corrupted program binary cache file");
+	}
+
+private:
+	void require (size_t numBytes) const
+	{
+		check(m_src.size() - m_pos >= numBytes);
+	}
+
+	const vector<deUint8>&	m_src;
+	size_t					m_pos;
+};
+
+string getCacheFilePath (const string& key)
+{
+	const string cacheDir = getProgramBinaryCacheDir();
+	return cacheDir.empty() ? string() : de::FilePath::join(cacheDir, key + ".bin").getPath();
+}
+
+} // anonymous
+
+void setProgramBinaryCacheDir (const char* cacheDir)
+{
+	const de::ScopedLock lock (s_cacheDirLock);
+	s_cacheDir = cacheDir ? string(cacheDir) : string();
+}
+
+string getProgramBinaryCacheDir (void)
+{
+	const de::ScopedLock lock (s_cacheDirLock);
+	return s_cacheDir;
+}
+
+bool isProgramBinaryCacheEnabled (const RenderContext& renderCtx)
+{
+	const ContextType		ctxType		= renderCtx.getType();
+	const glw::Functions&	gl			= renderCtx.getFunctions();
+	int						numFormats	= 0;
+
+	if (getProgramBinaryCacheDir().empty())
+		return false;
+
+	if (!contextSupports(ctxType, ApiType::es(3,0)) && !contextSupports(ctxType, ApiType::core(4,1)))
+		return false;
+
+	if (!gl.getProgramBinary || !gl.programBinary || !gl.programParameteri)
+		return false;
+
+	gl.getIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+	GLU_EXPECT_NO_ERROR(gl.getError(), "glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS)");
+
+	return numFormats > 0;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Compute cache key for program
+ *
+ * Key covers everything that affects the program binary: all program
+ * sources and build state, context type and the implementation strings.
+ * Binaries from other drivers or driver versions are never looked up.
+ *//*--------------------------------------------------------------------*/
+string computeProgramBinaryKey (const RenderContext& renderCtx, const ProgramSources& sources)
+{
+	const glw::Functions&	gl		= renderCtx.getFunctions();
+	de::Sha1Stream			stream;
+
+	stream << (deUint32)BINARY_FORMAT_VERSION
+		   << renderCtx.getType().getAPI().getPacked() << (deUint32)renderCtx.getType().getFlags()
+		   << getGLString(gl, GL_VENDOR)
+		   << getGLString(gl, GL_RENDERER)
+		   << getGLString(gl, GL_VERSION)
+		   << getGLString(gl, GL_SHADING_LANGUAGE_VERSION);
+
+	for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		stream << sources.sources[shaderType];
+
+	stream << (deUint64)sources.attribLocationBindings.size();
+	for (size_t ndx = 0; ndx < sources.attribLocationBindings.size(); ndx++)
+		stream << sources.attribLocationBindings[ndx].name << sources.attribLocationBindings[ndx].location;
+
+	stream << sources.transformFeedbackBufferMode
+		   << sources.transformFeedbackVaryings
+		   << sources.separable;
+
+	return stream.finalize().toString();
+}
+
+bool readProgramBinary (const string& key, ProgramBinary& dst)
+{
+	const string	path	= getCacheFilePath(key);
+	std::ifstream	in		(path.c_str(), std::ios_base::binary);
+	vector<deUint8>	data;
+
+	if (path.empty() || !in.is_open())
+		return false;
+
+	in.seekg(0, std::ios_base::end);
+	data.resize((size_t)in.tellg());
+	in.seekg(0, std::ios_base::beg);
+
+	if (data.empty() || !in.read((char*)&data[0], (std::streamsize)data.size()))
+		return false;
+
+	try
+	{
+		BinaryReader reader (data);
+
+		BinaryReader::check(reader.readU32() == BINARY_FORMAT_MAGIC);
+		BinaryReader::check(reader.readU32() == BINARY_FORMAT_VERSION);
+
+		dst.format		= reader.readU32();
+		dst.linkInfoLog	= reader.readString();
+
+		reader.readBytes(dst.data);
+
+		BinaryReader::check(reader.isAtEnd() && !dst.data.empty());
+		return true;
+	}
+	catch (const tcu::InternalError&)
+	{
+		// Stale or corrupted cache file, compile from source
+		return false;
+	}
+}
+
+void writeProgramBinary (const string& key, const ProgramBinary& binary)
+{
+	// Written under unique temporary name first so that concurrent readers never see partial
+	// files and concurrent writers, possibly in other processes, don't write to same file.
+	const string	path	= getCacheFilePath(key);
+	const string	tmpPath	= path + "." + de::toString(deProcess_getCurrentId()) + "-" + de::toString(deAtomicIncrementUint32(&s_tmpFileCounter)) + ".tmp";
+	vector<deUint8>	data;
+	bool			ok;
+
+	if (path.empty())
+		return;
+
+	{
+		BinaryWriter writer (data);
+
+		writer.writeU32(BINARY_FORMAT_MAGIC);
+		writer.writeU32(BINARY_FORMAT_VERSION);
+		writer.writeU32(binary.format);
+		writer.writeString(binary.linkInfoLog);
+
+		writer.writeBytes(binary.data.size(), binary.data.empty() ? DE_NULL : &binary.data[0]);
+	}
+
+	{
+		std::ofstream out (tmpPath.c_str(), std::ios_base::binary);
+
+		out.write((const char*)&data[0], (std::streamsize)data.size());
+		out.close();
+		ok = !out.fail();
+	}
+
+	// Cache is best-effort, failures are ignored
+	if (!ok || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+		std::remove(tmpPath.c_str());
+}
+
+} // glu
@@ -0,0 +1,66 @@
+#ifndef _GLUPROGRAMBINARYCACHE_HPP
+#define _GLUPROGRAMBINARYCACHE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief On-disk program binary cache.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluDefs.hpp"
+#include "gluShaderUtil.hpp"
+
+#include <string>
+#include <vector>
+
+namespace glu
+{
+
+class RenderContext;
+struct ProgramSources;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Cached program binary and build results.
+ *
+ * Info log from the original link is stored along with the binary and
+ * reported as program info log when the binary is loaded from the cache.
+ *//*--------------------------------------------------------------------*/
+struct ProgramBinary
+{
+	deUint32					format;
+	std::vector<deUint8>		data;
+	std::string					linkInfoLog;
+
+	ProgramBinary (void) : format(0) {}
+};
+
+// Cache is disabled by default. Directory is normally set from
+// --deqp-program-binary-cache-dir when render context is created.
+
+void			setProgramBinaryCacheDir		(const char* cacheDir);
+std::string		getProgramBinaryCacheDir		(void);
+bool			isProgramBinaryCacheEnabled		(const RenderContext& renderCtx);
+
+std::string		computeProgramBinaryKey			(const RenderContext& renderCtx, const ProgramSources& sources);
+bool			readProgramBinary				(const std::string& key, ProgramBinary& dst);
+void			writeProgramBinary				(const std::string& key, const ProgramBinary& binary);
+
+} // glu
+
+#endif // _GLUPROGRAMBINARYCACHE_HPP
@@ -27,6 +27,7 @@
 #include "gluES3PlusWrapperContext.hpp"
 #include "gluFboRenderContext.hpp"
 #include "gluPlatform.hpp"
+#include "gluProgramBinaryCache.hpp"
 #include "gluStrUtil.hpp"
 #include "glwInitFunctions.hpp"
 #include "glwEnums.hpp"
@@ -137,6 +138,9 @@ RenderContext* createRenderContext (tcu::Platform& platform, const tcu::CommandL
 	const char*						factoryName		= cmdLine.getGLContextType();
 	const ContextFactory*			factory			= DE_NULL;
 
+	// Program binary cache is used by all ShaderPrograms created for this context.
+	setProgramBinaryCacheDir(cmdLine.getProgramBinaryCacheDir());
+
 	if (registry.empty())
 		throw tcu::NotSupportedError("OpenGL is not supported", DE_NULL, __FILE__, __LINE__);
 
@@ -26,16 +26,23 @@
 #include "tcuStringTemplate.hpp"
 #include "tcuResource.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuTestContext.hpp"
+#include "tcuCommandLine.hpp"
 
 #include "deStringUtil.hpp"
 #include "deUniquePtr.hpp"
 #include "deFilePath.hpp"
+#include "deSha1.hpp"
+#include "deMutex.hpp"
+#include "deMemory.h"
 
 #include "glwEnums.hpp"
 
 #include <sstream>
 #include <map>
 #include <cstdlib>
+#include <cstdio>
+#include <fstream>
 
 #if 0
 #	define PARSE_DBG(X) printf X
@@ -310,10 +317,10 @@ struct CaseRequirement
 class ShaderParser
 {
 public:
-							ShaderParser			(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
+							ShaderParser			(const std::string& filename, const vector<char>& input);
 							~ShaderParser			(void);
 
-	vector<tcu::TestNode*>	parse					(void);
+	vector<ShaderNodeSp>	parse					(void);
 
 private:
 	enum Token
@@ -416,27 +423,21 @@ private:
 	void						parseExpectResult			(ExpectResult& expectResult);
 	void						parseGLSLVersion			(glu::GLSLVersion& version);
 	void						parsePipelineProgram		(ProgramSpecification& program);
-	void						parseShaderCase				(vector<tcu::TestNode*>& shaderNodeList);
-	void						parseShaderGroup			(vector<tcu::TestNode*>& shaderNodeList);
-	void						parseImport					(vector<tcu::TestNode*>& shaderNodeList);
+	void						parseShaderCase				(vector<ShaderNodeSp>& shaderNodeList);
+	void						parseShaderGroup			(vector<ShaderNodeSp>& shaderNodeList);
+	void						parseImport					(vector<ShaderNodeSp>& shaderNodeList);
 
-	const tcu::Archive&			m_archive;
 	const string				m_filename;
-	ShaderCaseFactory* const	m_caseFactory;
-
-	UniquePtr<tcu::Resource>	m_resource;
-	vector<char>				m_input;
+	const vector<char>&			m_input;
 
 	const char*					m_curPtr;
 	Token						m_curToken;
 	std::string					m_curTokenStr;
 };
 
-ShaderParser::ShaderParser (const tcu::Archive& archive, const string& filename, ShaderCaseFactory* caseFactroy)
-	: m_archive			(archive)
-	, m_filename		(filename)
-	, m_caseFactory		(caseFactroy)
-	, m_resource		(archive.getResource(m_filename.c_str()))
+ShaderParser::ShaderParser (const string& filename, const vector<char>& input)
+	: m_filename		(filename)
+	, m_input			(input)
 	, m_curPtr			(DE_NULL)
 	, m_curToken		(TOKEN_LAST)
 {
@@ -1337,7 +1338,19 @@ void ShaderParser::parsePipelineProgram (ProgramSpecification& program)
 		parseError("program pipeline object must have active stages");
 }
 
-void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
+static ShaderNodeSp createCaseNode (const string& name, const string& description, const ShaderCaseSpecification& spec)
+{
+	ShaderNode* const node = new ShaderNode();
+
+	node->type			= ShaderNode::TYPE_CASE;
+	node->name			= name;
+	node->description	= description;
+	node->spec			= spec;
+
+	return ShaderNodeSp(node);
+}
+
+void ShaderParser::parseShaderCase (vector<ShaderNodeSp>& shaderNodeList)
 {
 	// Parse 'case'.
 	PARSE_DBG(("  parseShaderCase()\n"));
@@ -1490,7 +1503,7 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 			spec.programs[0].sources << VertexSource(bothSource);
 			spec.programs[0].requiredExtensions	= requiredExts;
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName + "_vertex", description, ShaderCaseSpecification(spec)));
+			shaderNodeList.push_back(createCaseNode(caseName + "_vertex", description, spec));
 		}
 
 		// fragment
@@ -1507,7 +1520,7 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 			spec.programs[0].sources << FragmentSource(bothSource);
 			spec.programs[0].requiredExtensions	= requiredExts;
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName + "_fragment", description, ShaderCaseSpecification(spec)));
+			shaderNodeList.push_back(createCaseNode(caseName + "_fragment", description, spec));
 		}
 	}
 	else if (pipelinePrograms.empty())
@@ -1528,7 +1541,7 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 		spec.programs[0].sources.sources[SHADERTYPE_GEOMETRY].swap(geometrySources);
 		spec.programs[0].requiredExtensions.swap(requiredExts);
 
-		shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+		shaderNodeList.push_back(createCaseNode(caseName, description, spec));
 	}
 	else
 	{
@@ -1556,12 +1569,12 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 
 			spec.programs.swap(pipelinePrograms);
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+			shaderNodeList.push_back(createCaseNode(caseName, description, spec));
 		}
 	}
 }
 
-void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::parseShaderGroup (vector<ShaderNodeSp>& shaderNodeList)
 {
 	// Parse 'case'.
 	PARSE_DBG(("  parseShaderGroup()\n"));
@@ -1576,7 +1589,7 @@ void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
 	string description = parseStringLiteral(m_curTokenStr.c_str());
 	advanceToken(TOKEN_STRING);
 
-	std::vector<tcu::TestNode*> children;
+	vector<ShaderNodeSp> children;
 
 	// Parse group children.
 	for (;;)
@@ -1596,11 +1609,19 @@ void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
 	advanceToken(TOKEN_END); // group end
 
 	// Create group node.
-	tcu::TestCaseGroup* groupNode = m_caseFactory->createGroup(name, description, children);
-	shaderNodeList.push_back(groupNode);
+	{
+		ShaderNode* const groupNode = new ShaderNode();
+
+		groupNode->type			= ShaderNode::TYPE_GROUP;
+		groupNode->name			= name;
+		groupNode->description	= description;
+		groupNode->children.swap(children);
+
+		shaderNodeList.push_back(ShaderNodeSp(groupNode));
+	}
 }
 
-void ShaderParser::parseImport (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::parseImport (vector<ShaderNodeSp>& shaderNodeList)
 {
 	std::string	importFileName;
 
@@ -1610,23 +1631,20 @@ void ShaderParser::parseImport (vector<tcu::TestNode*>& shaderNodeList)
 	importFileName = parseStringLiteral(m_curTokenStr.c_str());
 	advanceToken(TOKEN_STRING);
 
+	// Imports are resolved only when nodes are instantiated.
 	{
-		ShaderParser					subParser		(m_archive, de::FilePath::join(de::FilePath(m_filename).getDirName(), importFileName).getPath(), m_caseFactory);
-		const vector<tcu::TestNode*>	importedCases = subParser.parse();
+		ShaderNode* const importNode = new ShaderNode();
 
-		// \todo [2015-08-03 pyry] Not exception safe
-		shaderNodeList.insert(shaderNodeList.end(), importedCases.begin(), importedCases.end());
+		importNode->type	= ShaderNode::TYPE_IMPORT;
+		importNode->name	= de::FilePath::join(de::FilePath(m_filename).getDirName(), importFileName).getPath();
+
+		shaderNodeList.push_back(ShaderNodeSp(importNode));
 	}
 }
 
-vector<tcu::TestNode*> ShaderParser::parse (void)
+vector<ShaderNodeSp> ShaderParser::parse (void)
 {
-	const int	dataLen		= m_resource->getSize();
-
-	m_input.resize(dataLen+1);
-	m_resource->setPosition(0);
-	m_resource->read((deUint8*)&m_input[0], dataLen);
-	m_input[dataLen] = '\0';
+	DE_ASSERT(!m_input.empty() && m_input.back() == '\0');
 
 	// Initialize parser.
 	m_curPtr		= &m_input[0];
@@ -1634,7 +1652,7 @@ vector<tcu::TestNode*> ShaderParser::parse (void)
 	m_curTokenStr	= "";
 	advanceToken();
 
-	vector<tcu::TestNode*> nodeList;
+	vector<ShaderNodeSp> nodeList;
 
 	// Parse all cases.
 	PARSE_DBG(("parse()\n"));
@@ -1657,11 +1675,600 @@ vector<tcu::TestNode*> ShaderParser::parse (void)
 	return nodeList;
 }
 
-std::vector<tcu::TestNode*> parseFile (const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory)
+// Parsed tree serialization
+
+namespace
+{
+
+enum
 {
-	sl::ShaderParser	parser	(archive, filename, caseFactory);
+	TREE_FORMAT_MAGIC	= 0x4c536564u,	//!< "deSL"
+	TREE_FORMAT_VERSION	= 1u
+};
+
+class TreeWriter
+{
+public:
+	TreeWriter (vector<deUint8>& dst)
+		: m_dst(dst)
+	{
+	}
+
+	void writeU8 (deUint8 value)
+	{
+		m_dst.push_back(value);
+	}
+
+	void writeU32 (deUint32 value)
+	{
+		for (int byteNdx = 0; byteNdx < 4; byteNdx++)
+			m_dst.push_back((deUint8)(0xFFu & (value >> (8*byteNdx))));
+	}
+
+	void writeString (const string& str)
+	{
+		writeU32((deUint32)str.size());
+		m_dst.insert(m_dst.end(), str.begin(), str.end());
+	}
+
+	void writeStrings (const vector<string>& strings)
+	{
+		writeU32((deUint32)strings.size());
+		for (size_t ndx = 0; ndx < strings.size(); ndx++)
+			writeString(strings[ndx]);
+	}
+
+	void writeValues (const vector<Value>& values)
+	{
+		writeU32((deUint32)values.size());
+
+		for (size_t valNdx = 0; valNdx < values.size(); valNdx++)
+		{
+			const Value& value = values[valNdx];
+
+			DE_ASSERT(value.type.isBasicType());
+
+			writeU32((deUint32)value.type.getBasicType());
+			writeU32((deUint32)value.type.getPrecision());
+			writeString(value.name);
+			writeU32((deUint32)value.elements.size());
+
+			for (size_t elemNdx = 0; elemNdx < value.elements.size(); elemNdx++)
+			{
+				deUint32 bits;
+				deMemcpy(&bits, &value.elements[elemNdx], sizeof(bits));
+				writeU32(bits);
+			}
+		}
+	}
+
+	void writeSpec (const ShaderCaseSpecification& spec)
+	{
+		writeU32((deUint32)spec.caseType);
+		writeU32((deUint32)spec.expectResult);
+		writeU32((deUint32)spec.targetVersion);
+		writeU8(spec.fullGLSLES100Required ? 1u : 0u);
+
+		writeU32((deUint32)spec.requiredCaps.size());
+		for (size_t capNdx = 0; capNdx < spec.requiredCaps.size(); capNdx++)
+		{
+			writeU32(spec.requiredCaps[capNdx].enumName);
+			writeU32((deUint32)spec.requiredCaps[capNdx].referenceValue);
+		}
+
+		writeValues(spec.values.inputs);
+		writeValues(spec.values.outputs);
+		writeValues(spec.values.uniforms);
+
+		writeU32((deUint32)spec.programs.size());
+		for (size_t progNdx = 0; progNdx < spec.programs.size(); progNdx++)
+		{
+			const ProgramSpecification&	program	= spec.programs[progNdx];
+			const ProgramSources&		sources	= program.sources;
+
+			for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+				writeStrings(sources.sources[shaderType]);
+
+			writeU32((deUint32)sources.attribLocationBindings.size());
+			for (size_t bindingNdx = 0; bindingNdx < sources.attribLocationBindings.size(); bindingNdx++)
+			{
+				writeString(sources.attribLocationBindings[bindingNdx].name);
+				writeU32(sources.attribLocationBindings[bindingNdx].location);
+			}
+
+			writeU32(sources.transformFeedbackBufferMode);
+			writeStrings(sources.transformFeedbackVaryings);
+			writeU8(sources.separable ? 1u : 0u);
+
+			writeU32((deUint32)program.requiredExtensions.size());
+			for (size_t extNdx = 0; extNdx < program.requiredExtensions.size(); extNdx++)
+			{
+				writeStrings(program.requiredExtensions[extNdx].alternatives);
+				writeU32(program.requiredExtensions[extNdx].effectiveStages);
+			}
+
+			writeU32(program.activeStages);
+		}
+	}
+
+	void writeNodes (const vector<ShaderNodeSp>& nodes)
+	{
+		writeU32((deUint32)nodes.size());
+
+		for (size_t nodeNdx = 0; nodeNdx < nodes.size(); nodeNdx++)
+		{
+			const ShaderNode& node = *nodes[nodeNdx];
+
+			writeU8((deUint8)node.type);
+			writeString(node.name);
+			writeString(node.description);
+
+			if (node.type == ShaderNode::TYPE_GROUP)
+				writeNodes(node.children);
+			else if (node.type == ShaderNode::TYPE_CASE)
+				writeSpec(node.spec);
+		}
+	}
+
+private:
+	vector<deUint8>&	m_dst;
+};
+
+class TreeReader
+{
+public:
+	TreeReader (size_t size, const deUint8* data)
+		: m_cur	(data)
+		, m_end	(data + size)
+	{
+	}
+
+	bool isAtEnd (void) const
+	{
+		return m_cur == m_end;
+	}
+
+	deUint8 readU8 (void)
+	{
+		check(m_cur != m_end);
+		return *m_cur++;
+	}
+
+	deUint32 readU32 (void)
+	{
+		deUint32 value = 0;
+
+		check(m_end - m_cur >= 4);
+
+		for (int byteNdx = 0; byteNdx < 4; byteNdx++)
+			value |= (deUint32)(*m_cur++) << (8*byteNdx);
+
+		return value;
+	}
+
+	// Reads element count, rejecting counts that could not possibly fit in remaining data.
+	size_t readCount (void)
+	{
+		const deUint32 count = readU32();
+		check((size_t)count <= (size_t)(m_end - m_cur));
+		return (size_t)count;
+	}
+
+	deUint32 readEnum (deUint32 numValues)
+	{
+		const deUint32 value = readU32();
+		check(value < numValues);
+		return value;
+	}
+
+	string readString (void)
+	{
+		const size_t	len	= readCount();
+		const string	str	((const char*)m_cur, len);
+
+		m_cur += len;
+		return str;
+	}
+
+	void readStrings (vector<string>& dst)
+	{
+		dst.resize(readCount());
+		for (size_t ndx = 0; ndx < dst.size(); ndx++)
+			dst[ndx] = readString();
+	}
+
+	void readValues (vector<Value>& dst)
+	{
+		dst.resize(readCount());
+
+		for (size_t valNdx = 0; valNdx < dst.size(); valNdx++)
+		{
+			Value&				value		= dst[valNdx];
+			const DataType		basicType	= (DataType)readEnum(TYPE_LAST);
+			const Precision		precision	= (Precision)readEnum(PRECISION_LAST+1);
+
+			value.type	= VarType(basicType, precision);
+			value.name	= readString();
+			value.elements.resize(readCount());
+
+			for (size_t elemNdx = 0; elemNdx < value.elements.size(); elemNdx++)
+			{
+				const deUint32 bits = readU32();
+				deMemcpy(&value.elements[elemNdx], &bits, sizeof(bits));
+			}
+		}
+	}
+
+	void readSpec (ShaderCaseSpecification& spec)
+	{
+		spec.caseType				= (CaseType)readEnum(CASETYPE_LAST);
+		spec.expectResult			= (ExpectResult)readEnum(EXPECT_LAST);
+		spec.targetVersion			= (GLSLVersion)readEnum(GLSL_VERSION_LAST);
+		spec.fullGLSLES100Required	= readU8() != 0;
+
+		spec.requiredCaps.resize(readCount());
+		for (size_t capNdx = 0; capNdx < spec.requiredCaps.size(); capNdx++)
+		{
+			spec.requiredCaps[capNdx].enumName			= readU32();
+			spec.requiredCaps[capNdx].referenceValue	= (int)readU32();
+		}
+
+		readValues(spec.values.inputs);
+		readValues(spec.values.outputs);
+		readValues(spec.values.uniforms);
+
+		spec.programs.resize(readCount());
+		for (size_t progNdx = 0; progNdx < spec.programs.size(); progNdx++)
+		{
+			ProgramSpecification&	program	= spec.programs[progNdx];
+			ProgramSources&			sources	= program.sources;
+
+			for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+				readStrings(sources.sources[shaderType]);
+
+			sources.attribLocationBindings.resize(readCount());
+			for (size_t bindingNdx = 0; bindingNdx < sources.attribLocationBindings.size(); bindingNdx++)
+			{
+				sources.attribLocationBindings[bindingNdx].name		= readString();
+				sources.attribLocationBindings[bindingNdx].location	= readU32();
+			}
+
+			sources.transformFeedbackBufferMode = readU32();
+			readStrings(sources.transformFeedbackVaryings);
+			sources.separable = readU8() != 0;
+
+			program.requiredExtensions.resize(readCount());
+			for (size_t extNdx = 0; extNdx < program.requiredExtensions.size(); extNdx++)
+			{
+				readStrings(program.requiredExtensions[extNdx].alternatives);
+				program.requiredExtensions[extNdx].effectiveStages = readU32();
+			}
+
+			program.activeStages = readU32();
+		}
+	}
+
+	void readNodes (vector<ShaderNodeSp>& dst)
+	{
+		const size_t numNodes = readCount();
+
+		dst.reserve(numNodes);
+
+		for (size_t nodeNdx = 0; nodeNdx < numNodes; nodeNdx++)
+		{
+			ShaderNode* const	node	= new ShaderNode();
+			const ShaderNodeSp	nodeSp	(node);
+
+			node->type			= (ShaderNode::Type)readU8();
+			node->name			= readString();
+			node->description	= readString();
+
+			check(node->type < ShaderNode::TYPE_LAST);
+
+			if (node->type == ShaderNode::TYPE_GROUP)
+				readNodes(node->children);
+			else if (node->type == ShaderNode::TYPE_CASE)
+				readSpec(node->spec);
+
+			dst.push_back(nodeSp);
+		}
+	}
+
+	static void check (bool condition)
+	{
+		if (!condition)
+			throw tcu::InternalError("Malformed shader library tree data");
+	}
+
+private:
+	const deUint8*			m_cur;
+	const deUint8* const	m_end;
+};
+
+} // anonymous
+
+void serializeTree (vector<deUint8>& dst, const vector<ShaderNodeSp>& nodes)
+{
+	TreeWriter writer (dst);
+
+	writer.writeU32(TREE_FORMAT_MAGIC);
+	writer.writeU32(TREE_FORMAT_VERSION);
+	writer.writeNodes(nodes);
+}
+
+vector<ShaderNodeSp> deserializeTree (size_t size, const deUint8* data)
+{
+	TreeReader				reader	(size, data);
+	vector<ShaderNodeSp>	nodes;
+
+	TreeReader::check(reader.readU32() == TREE_FORMAT_MAGIC);
+	TreeReader::check(reader.readU32() == TREE_FORMAT_VERSION);
+
+	reader.readNodes(nodes);
+
+	TreeReader::check(reader.isAtEnd());
+
+	return nodes;
+}
+
+// Parsed file cache
+
+namespace
+{
+
+typedef map<string, vector<ShaderNodeSp> > ParsedFileMap;
+
+de::Mutex		s_parsedFilesLock;
+ParsedFileMap	s_parsedFiles;
+
+void readResource (const tcu::Archive& archive, const string& filename, vector<char>& dst)
+{
+	const UniquePtr<tcu::Resource>	resource	(archive.getResource(filename.c_str()));
+	const int						dataLen		= resource->getSize();
+
+	dst.resize(dataLen+1);
+	resource->setPosition(0);
+	resource->read((deUint8*)&dst[0], dataLen);
+	dst[dataLen] = '\0';
+}
+
+bool readCacheFile (const string& path, vector<ShaderNodeSp>& dst)
+{
+	std::ifstream	in		(path.c_str(), std::ios_base::binary);
+	vector<deUint8>	data;
+
+	if (!in.is_open())
+		return false;
+
+	in.seekg(0, std::ios_base::end);
+	data.resize((size_t)in.tellg());
+	in.seekg(0, std::ios_base::beg);
+
+	if (data.empty() || !in.read((char*)&data[0], (std::streamsize)data.size()))
+		return false;
+
+	try
+	{
+		dst = deserializeTree(data.size(), &data[0]);
+		return true;
+	}
+	catch (const tcu::InternalError&)
+	{
+		// Stale or corrupted cache file, re-parse
+		return false;
+	}
+}
+
+void writeCacheFile (const string& path, const vector<ShaderNodeSp>& nodes)
+{
+	// Written under temporary name first so that concurrent readers never see partial files.
+	const string	tmpPath	= path + ".tmp";
+	vector<deUint8>	data;
+	bool			ok;
+
+	serializeTree(data, nodes);
+
+	{
+		std::ofstream out (tmpPath.c_str(), std::ios_base::binary);
+
+		out.write((const char*)&data[0], (std::streamsize)data.size());
+		out.close();
+		ok = !out.fail();
+	}
+
+	// Cache is best-effort, failures are ignored
+	if (!ok || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+		std::remove(tmpPath.c_str());
+}
+
+} // anonymous
+
+vector<ShaderNodeSp> loadTree (const tcu::Archive& archive, const string& filename, const char* cacheDir)
+{
+	vector<char>	input;
+	string			key;
+
+	readResource(archive, filename, input);
+
+	// File name is part of the key since imports are resolved relative to it.
+	{
+		de::Sha1Stream stream;
+
+		stream << (deUint32)TREE_FORMAT_VERSION << filename;
+		stream.process(input.size(), &input[0]);
+
+		key = stream.finalize().toString();
+	}
+
+	{
+		const de::ScopedLock				lock	(s_parsedFilesLock);
+		const ParsedFileMap::const_iterator	pos		(s_parsedFiles.find(key));
+
+		if (pos != s_parsedFiles.end())
+			return pos->second;
+	}
+
+	{
+		const string			cachePath	= cacheDir ? de::FilePath::join(cacheDir, key + ".bin").getPath() : string();
+		vector<ShaderNodeSp>	nodes;
+
+		// \note Lock is not held while parsing, other threads may parse same file concurrently.
+		if (cachePath.empty() || !readCacheFile(cachePath, nodes))
+		{
+			ShaderParser parser (filename, input);
+
+			nodes = parser.parse();
+
+			if (!cachePath.empty())
+				writeCacheFile(cachePath, nodes);
+		}
+
+		{
+			const de::ScopedLock lock (s_parsedFilesLock);
+			return s_parsedFiles.insert(std::make_pair(key, nodes)).first->second;
+		}
+	}
+}
+
+// Test node creation
+
+namespace
+{
+
+void deleteNodes (const vector<tcu::TestNode*>& nodes)
+{
+	for (size_t ndx = 0; ndx < nodes.size(); ndx++)
+		delete nodes[ndx];
+}
+
+void createNodes (const tcu::Archive& archive, const vector<ShaderNodeSp>& nodes, ShaderCaseFactory* caseFactory, vector<tcu::TestNode*>& dst)
+{
+	for (size_t nodeNdx = 0; nodeNdx < nodes.size(); nodeNdx++)
+	{
+		const ShaderNode& node = *nodes[nodeNdx];
+
+		if (node.type == ShaderNode::TYPE_CASE)
+			dst.push_back(caseFactory->createCase(node.name, node.description, node.spec));
+		else if (node.type == ShaderNode::TYPE_GROUP)
+		{
+			vector<tcu::TestNode*>	children;
+			tcu::TestCaseGroup*		group		= DE_NULL;
+
+			try
+			{
+				createNodes(archive, node.children, caseFactory, children);
+				group = caseFactory->createGroup(node.name, node.description, children);
+			}
+			catch (...)
+			{
+				deleteNodes(children);
+				throw;
+			}
+
+			dst.push_back(group);
+		}
+		else
+		{
+			DE_ASSERT(node.type == ShaderNode::TYPE_IMPORT);
+			createNodes(archive, loadTree(archive, node.name, DE_NULL), caseFactory, dst);
+		}
+	}
+}
+
+void createLazyNodes (tcu::TestContext& testCtx, const vector<ShaderNodeSp>& nodes, const de::SharedPtr<ShaderCaseFactory>& caseFactory, vector<tcu::TestNode*>& dst);
+
+class LazyShaderGroup : public tcu::TestCaseGroup
+{
+public:
+	LazyShaderGroup (tcu::TestContext& testCtx, const ShaderNodeSp& node, const de::SharedPtr<ShaderCaseFactory>& caseFactory)
+		: tcu::TestCaseGroup	(testCtx, node->name.c_str(), node->description.c_str())
+		, m_node				(node)
+		, m_caseFactory			(caseFactory)
+	{
+	}
+
+	void init (void)
+	{
+		vector<tcu::TestNode*> children;
+
+		createLazyNodes(m_testCtx, m_node->children, m_caseFactory, children);
+
+		for (size_t ndx = 0; ndx < children.size(); ndx++)
+		{
+			try
+			{
+				addChild(children[ndx]);
+			}
+			catch (...)
+			{
+				for (; ndx < children.size(); ndx++)
+					delete children[ndx];
+				throw;
+			}
+		}
+	}
+
+private:
+	const ShaderNodeSp						m_node;
+	const de::SharedPtr<ShaderCaseFactory>	m_caseFactory;
+};
+
+void createLazyNodes (tcu::TestContext& testCtx, const vector<ShaderNodeSp>& nodes, const de::SharedPtr<ShaderCaseFactory>& caseFactory, vector<tcu::TestNode*>& dst)
+{
+	const size_t firstNdx = dst.size();
+
+	try
+	{
+		for (size_t nodeNdx = 0; nodeNdx < nodes.size(); nodeNdx++)
+		{
+			const ShaderNodeSp& node = nodes[nodeNdx];
+
+			if (node->type == ShaderNode::TYPE_CASE)
+				dst.push_back(caseFactory->createCase(node->name, node->description, node->spec));
+			else if (node->type == ShaderNode::TYPE_GROUP)
+				dst.push_back(new LazyShaderGroup(testCtx, node, caseFactory));
+			else
+			{
+				DE_ASSERT(node->type == ShaderNode::TYPE_IMPORT);
+				createLazyNodes(testCtx, loadTree(testCtx.getArchive(), node->name, testCtx.getCommandLine().getShaderLibraryCacheDir()), caseFactory, dst);
+			}
+		}
+	}
+	catch (...)
+	{
+		deleteNodes(vector<tcu::TestNode*>(dst.begin() + firstNdx, dst.end()));
+		dst.resize(firstNdx);
+		throw;
+	}
+}
+
+} // anonymous
+
+vector<tcu::TestNode*> parseFile (const tcu::Archive& archive, const string& filename, ShaderCaseFactory* caseFactory)
+{
+	vector<tcu::TestNode*> nodes;
+
+	try
+	{
+		createNodes(archive, loadTree(archive, filename, DE_NULL), caseFactory, nodes);
+	}
+	catch (...)
+	{
+		deleteNodes(nodes);
+		throw;
+	}
+
+	return nodes;
+}
+
+vector<tcu::TestNode*> loadFile (tcu::TestContext& testCtx, const string& filename, const de::SharedPtr<ShaderCaseFactory>& caseFactory)
+{
+	const vector<ShaderNodeSp>	tree	= loadTree(testCtx.getArchive(), filename, testCtx.getCommandLine().getShaderLibraryCacheDir());
+	vector<tcu::TestNode*>		nodes;
+
+	createLazyNodes(testCtx, tree, caseFactory, nodes);
 
-	return parser.parse();
+	return nodes;
 }
 
 // Execution utilities
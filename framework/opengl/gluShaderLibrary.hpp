@@ -27,6 +27,7 @@
 #include "gluVarType.hpp"
 #include "gluShaderProgram.hpp"
 #include "tcuTestCase.hpp"
+#include "deSharedPtr.hpp"
 
 #include <string>
 #include <vector>
@@ -158,14 +159,69 @@ struct ShaderCaseSpecification
 bool	isValid		(const ValueBlock& block);
 bool	isValid		(const ShaderCaseSpecification& spec);
 
+// Parsed .test file tree
+
+struct ShaderNode;
+
+typedef de::SharedPtr<const ShaderNode>	ShaderNodeSp;
+
+struct ShaderNode
+{
+	enum Type
+	{
+		TYPE_GROUP = 0,		//!< Group, children in 'children'.
+		TYPE_CASE,			//!< Case, specification in 'spec'.
+		TYPE_IMPORT,		//!< Import of file 'name', resolved when nodes are created.
+
+		TYPE_LAST
+	};
+
+	Type						type;
+	std::string					name;
+	std::string					description;
+	ShaderCaseSpecification		spec;
+	std::vector<ShaderNodeSp>	children;
+
+	ShaderNode (void)
+		: type(TYPE_LAST)
+	{
+	}
+};
+
 class ShaderCaseFactory
 {
 public:
-	virtual tcu::TestCaseGroup*	createGroup	(const std::string& name, const std::string& description, const std::vector<tcu::TestNode*>& children) = 0;
-	virtual tcu::TestCase*		createCase	(const std::string& name, const std::string& description, const ShaderCaseSpecification& spec) = 0;
+	virtual						~ShaderCaseFactory	(void) {}
+	virtual tcu::TestCaseGroup*	createGroup			(const std::string& name, const std::string& description, const std::vector<tcu::TestNode*>& children) = 0;
+	virtual tcu::TestCase*		createCase			(const std::string& name, const std::string& description, const ShaderCaseSpecification& spec) = 0;
 };
 
-std::vector<tcu::TestNode*>		parseFile	(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
+/*--------------------------------------------------------------------*//*!
+ * \brief Load parsed .test file
+ *
+ * Parsed trees are cached for the lifetime of the process, keyed by file
+ * name and contents. If cacheDir is non-null, trees are additionally
+ * stored in serialized form in that directory and re-used across runs.
+ * Imports are left unresolved in the returned tree.
+ *//*--------------------------------------------------------------------*/
+std::vector<ShaderNodeSp>		loadTree		(const tcu::Archive& archive, const std::string& filename, const char* cacheDir);
+
+void							serializeTree	(std::vector<deUint8>& dst, const std::vector<ShaderNodeSp>& nodes);
+std::vector<ShaderNodeSp>		deserializeTree	(size_t size, const deUint8* data);
+
+//! Parse file and create all nodes immediately using caseFactory.
+std::vector<tcu::TestNode*>		parseFile		(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Load file and create nodes lazily
+ *
+ * Cases are created using caseFactory, but groups are created as plain
+ * tcu::TestCaseGroups that instantiate (and resolve imports of) their
+ * children only in init(). Groups not matching case list filter are thus
+ * never materialized. Parsed files are cached as in loadTree(), using
+ * --deqp-shader-library-cache-dir as the on-disk cache location.
+ *//*--------------------------------------------------------------------*/
+std::vector<tcu::TestNode*>		loadFile		(tcu::TestContext& testCtx, const std::string& filename, const de::SharedPtr<ShaderCaseFactory>& caseFactory);
 
 // Specialization utilties
 
@@ -22,10 +22,12 @@
  *//*--------------------------------------------------------------------*/
 
 #include "gluShaderProgram.hpp"
+#include "gluProgramBinaryCache.hpp"
 #include "gluRenderContext.hpp"
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuInstrumentation.hpp"
 #include "deClock.h"
 
 #include <cstring>
@@ -82,7 +84,8 @@ void Shader::compile (void)
 	m_info.infoLog.clear();
 
 	{
-		deUint64 compileStart = deGetMicroseconds();
+		const tcu::InstrumentationScope	scope			("glu::Shader::compile");
+		deUint64						compileStart	= deGetMicroseconds();
 		m_gl.compileShader(m_shader);
 		m_info.compileTimeUs = deGetMicroseconds() - compileStart;
 	}
@@ -229,10 +232,12 @@ void Program::link (void)
 {
 	m_info.linkOk		= false;
 	m_info.linkTimeUs	= 0;
+	m_info.fromBinary	= false;
 	m_info.infoLog.clear();
 
 	{
-		deUint64 linkStart = deGetMicroseconds();
+		const tcu::InstrumentationScope	scope		("glu::Program::link");
+		deUint64						linkStart	= deGetMicroseconds();
 		m_gl.linkProgram(m_program);
 		m_info.linkTimeUs = deGetMicroseconds() - linkStart;
 	}
@@ -242,6 +247,74 @@ void Program::link (void)
 	m_info.infoLog	= getProgramInfoLog(m_gl, m_program);
 }
 
+void Program::setBinaryRetrievableHint (bool retrievable)
+{
+	m_gl.programParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, retrievable ? GL_TRUE : GL_FALSE);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glProgramParameteri()");
+}
+
+void Program::getBinary (deUint32& format, std::vector<deUint8>& data) const
+{
+	int binaryLength	= 0;
+	int numWritten		= 0;
+
+	m_gl.getProgramiv(m_program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetProgramiv()");
+
+	data.resize(binaryLength);
+	format = 0;
+
+	if (binaryLength > 0)
+	{
+		m_gl.getProgramBinary(m_program, binaryLength, &numWritten, &format, &data[0]);
+		GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetProgramBinary()");
+
+		TCU_CHECK(de::inRange(numWritten, 0, binaryLength));
+		data.resize(numWritten);
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Load program from binary
+ *
+ * Binary may be rejected by implementation, for example if driver has
+ * been updated. That is not an error; link status is false afterwards
+ * and program can still be built from sources.
+ *
+ * Info log of the original link is reported as program info log, since
+ * log from loading the binary usually doesn't describe the program.
+ *
+ * \param format		Binary format
+ * \param data			Program binary
+ * \param linkInfoLog	Info log from the link that produced the binary
+ * \return True if binary was accepted.
+ *//*--------------------------------------------------------------------*/
+bool Program::loadBinary (deUint32 format, const std::vector<deUint8>& data, const std::string& linkInfoLog)
+{
+	m_info.linkOk		= false;
+	m_info.linkTimeUs	= 0;
+	m_info.fromBinary	= false;
+	m_info.infoLog.clear();
+
+	DE_ASSERT(!data.empty());
+
+	{
+		deUint64 loadStart = deGetMicroseconds();
+		m_gl.programBinary(m_program, format, &data[0], (int)data.size());
+		m_info.linkTimeUs = deGetMicroseconds() - loadStart;
+	}
+
+	// Unsupported format is reported with GL_INVALID_ENUM.
+	if (m_gl.getError() != GL_NO_ERROR)
+		return false;
+
+	m_info.linkOk		= getProgramLinkStatus(m_gl, m_program);
+	m_info.infoLog		= m_info.linkOk ? linkInfoLog : getProgramInfoLog(m_gl, m_program);
+	m_info.fromBinary	= m_info.linkOk;
+
+	return m_info.linkOk;
+}
+
 bool Program::isSeparable (void) const
 {
 	int separable = GL_FALSE;
@@ -309,7 +382,10 @@ bool ProgramPipeline::isValid (void)
 ShaderProgram::ShaderProgram (const RenderContext& renderCtx, const ProgramSources& sources)
 	: m_program(renderCtx.getFunctions())
 {
-	init(renderCtx.getFunctions(), sources);
+	if (isProgramBinaryCacheEnabled(renderCtx))
+		initCached(renderCtx, sources);
+	else
+		init(renderCtx.getFunctions(), sources);
 }
 
 ShaderProgram::ShaderProgram (const glw::Functions& gl, const ProgramSources& sources)
@@ -322,49 +398,92 @@ void ShaderProgram::init (const glw::Functions& gl, const ProgramSources& source
 {
 	try
 	{
-		bool shadersOk = true;
-
+		if (setupProgram(gl, sources))
+			m_program.link();
+	}
+	catch (...)
+	{
 		for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+			for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
+				delete m_shaders[shaderType][shaderNdx];
+		throw;
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Compile and attach shaders and set pre-link program state
+ *
+ * \return True if all shaders compiled and program can be linked.
+ *//*--------------------------------------------------------------------*/
+bool ShaderProgram::setupProgram (const glw::Functions& gl, const ProgramSources& sources)
+{
+	bool shadersOk = true;
+
+	for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+	{
+		for (int shaderNdx = 0; shaderNdx < (int)sources.sources[shaderType].size(); ++shaderNdx)
 		{
-			for (int shaderNdx = 0; shaderNdx < (int)sources.sources[shaderType].size(); ++shaderNdx)
-			{
-				const char* source	= sources.sources[shaderType][shaderNdx].c_str();
-				const int	length	= (int)sources.sources[shaderType][shaderNdx].size();
+			const char* source	= sources.sources[shaderType][shaderNdx].c_str();
+			const int	length	= (int)sources.sources[shaderType][shaderNdx].size();
 
-				m_shaders[shaderType].reserve(m_shaders[shaderType].size() + 1);
+			m_shaders[shaderType].reserve(m_shaders[shaderType].size() + 1);
 
-				m_shaders[shaderType].push_back(new Shader(gl, ShaderType(shaderType)));
-				m_shaders[shaderType].back()->setSources(1, &source, &length);
-				m_shaders[shaderType].back()->compile();
+			m_shaders[shaderType].push_back(new Shader(gl, ShaderType(shaderType)));
+			m_shaders[shaderType].back()->setSources(1, &source, &length);
+			m_shaders[shaderType].back()->compile();
 
-				shadersOk = shadersOk && m_shaders[shaderType].back()->getCompileStatus();
-			}
+			shadersOk = shadersOk && m_shaders[shaderType].back()->getCompileStatus();
 		}
+	}
 
-		if (shadersOk)
-		{
-			for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
-				for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
-					m_program.attachShader(m_shaders[shaderType][shaderNdx]->getShader());
+	if (!shadersOk)
+		return false;
 
-			for (std::vector<AttribLocationBinding>::const_iterator binding = sources.attribLocationBindings.begin(); binding != sources.attribLocationBindings.end(); ++binding)
-				m_program.bindAttribLocation(binding->location, binding->name.c_str());
+	for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
+			m_program.attachShader(m_shaders[shaderType][shaderNdx]->getShader());
 
-			DE_ASSERT((sources.transformFeedbackBufferMode == GL_NONE) == sources.transformFeedbackVaryings.empty());
-			if (sources.transformFeedbackBufferMode != GL_NONE)
-			{
-				std::vector<const char*> tfVaryings(sources.transformFeedbackVaryings.size());
-				for (int ndx = 0; ndx < (int)tfVaryings.size(); ndx++)
-					tfVaryings[ndx] = sources.transformFeedbackVaryings[ndx].c_str();
+	for (std::vector<AttribLocationBinding>::const_iterator binding = sources.attribLocationBindings.begin(); binding != sources.attribLocationBindings.end(); ++binding)
+		m_program.bindAttribLocation(binding->location, binding->name.c_str());
 
-				m_program.transformFeedbackVaryings((int)tfVaryings.size(), &tfVaryings[0], sources.transformFeedbackBufferMode);
-			}
+	DE_ASSERT((sources.transformFeedbackBufferMode == GL_NONE) == sources.transformFeedbackVaryings.empty());
+	if (sources.transformFeedbackBufferMode != GL_NONE)
+	{
+		std::vector<const char*> tfVaryings(sources.transformFeedbackVaryings.size());
+		for (int ndx = 0; ndx < (int)tfVaryings.size(); ndx++)
+			tfVaryings[ndx] = sources.transformFeedbackVaryings[ndx].c_str();
 
-			if (sources.separable)
-				m_program.setSeparable(true);
+		m_program.transformFeedbackVaryings((int)tfVaryings.size(), &tfVaryings[0], sources.transformFeedbackBufferMode);
+	}
 
-			m_program.link();
+	if (sources.separable)
+		m_program.setSeparable(true);
+
+	return true;
+}
+
+void ShaderProgram::initCached (const RenderContext& renderCtx, const ProgramSources& sources)
+{
+	const glw::Functions&	gl		= renderCtx.getFunctions();
+	const std::string		key		= computeProgramBinaryKey(renderCtx, sources);
+
+	// \note Shaders are compiled and attached even if binary is loaded, since callers
+	//		 may relink the program, for example after changing attribute bindings.
+	try
+	{
+		if (!setupProgram(gl, sources))
+			return;
+
+		{
+			ProgramBinary binary;
+
+			if (readProgramBinary(key, binary) && m_program.loadBinary(binary.format, binary.data, binary.linkInfoLog))
+				return;
 		}
+
+		// Binary is missing or it was rejected; link and store result.
+		m_program.setBinaryRetrievableHint(true);
+		m_program.link();
 	}
 	catch (...)
 	{
@@ -373,6 +492,17 @@ void ShaderProgram::init (const glw::Functions& gl, const ProgramSources& source
 				delete m_shaders[shaderType][shaderNdx];
 		throw;
 	}
+
+	if (isOk())
+	{
+		ProgramBinary binary;
+
+		m_program.getBinary(binary.format, binary.data);
+		binary.linkInfoLog = m_program.getInfoLog();
+
+		if (!binary.data.empty())
+			writeProgramBinary(key, binary);
+	}
 }
 
 ShaderProgram::~ShaderProgram (void)
@@ -487,9 +617,15 @@ static void logShaderProgram (tcu::TestLog& log, const ProgramInfo& programInfo,
 			allShadersOk = allShadersOk && shaderInfo.compileOk;
 		}
 
-		if (allShadersOk)
+		if (programInfo.fromBinary)
+			log << tcu::TestLog::Float("ProgramBinaryLoadTime", "Program binary load time", "ms", QP_KEY_TAG_TIME, (float)programInfo.linkTimeUs / 1000.0f);
+		else if (allShadersOk)
 			log << tcu::TestLog::Float("LinkTime", "Link time", "ms", QP_KEY_TAG_TIME, (float)programInfo.linkTimeUs / 1000.0f);
 	}
+
+	// Make cached builds visible in logs; link log above is from loading the binary.
+	if (programInfo.fromBinary)
+		log << tcu::TestLog::Message << "Note: Program was loaded from program binary cache instead of linking" << tcu::TestLog::EndMessage;
 }
 
 tcu::TestLog& operator<< (tcu::TestLog& log, const ShaderProgramInfo& shaderProgramInfo)
@@ -62,8 +62,9 @@ struct ProgramInfo
 	std::string				infoLog;		//!< Link info log.
 	bool					linkOk;			//!< Did link succeed?
 	deUint64				linkTimeUs;		//!< Link time in microseconds (us).
+	bool					fromBinary;		//!< Was program loaded from binary instead of linking? linkTimeUs is then binary load time.
 
-	ProgramInfo (void) : linkOk(false), linkTimeUs(0) {}
+	ProgramInfo (void) : linkOk(false), linkTimeUs(0), fromBinary(false) {}
 };
 
 /*--------------------------------------------------------------------*//*!
@@ -126,6 +127,10 @@ public:
 
 	void					link						(void);
 
+	void					setBinaryRetrievableHint	(bool retrievable);
+	void					getBinary					(deUint32& format, std::vector<deUint8>& data) const;
+	bool					loadBinary					(deUint32 format, const std::vector<deUint8>& data, const std::string& linkInfoLog);
+
 	deUint32				getProgram					(void) const { return m_program;			}
 	const ProgramInfo&		getInfo						(void) const { return m_info;				}
 
@@ -179,6 +184,13 @@ struct ProgramSources;
  *
  * ShaderProgram manages both Shader and Program objects, and provides
  * convenient API for constructing such programs.
+ *
+ * If program binary cache is enabled (--deqp-program-binary-cache-dir),
+ * programs created with RenderContext are loaded with glProgramBinary()
+ * instead of linking when a binary for identical sources exists, and
+ * ProgramInfo::fromBinary is set. Shaders are still compiled and attached
+ * so that the program can be relinked. If the implementation rejects the
+ * binary, program is linked as usual.
  *//*--------------------------------------------------------------------*/
 class ShaderProgram
 {
@@ -199,6 +211,8 @@ private:
 							ShaderProgram				(const ShaderProgram& other);
 	ShaderProgram&			operator=					(const ShaderProgram& other);
 	void					init						(const glw::Functions& gl, const ProgramSources& sources);
+	void					initCached					(const RenderContext& renderCtx, const ProgramSources& sources);
+	bool					setupProgram				(const glw::Functions& gl, const ProgramSources& sources);
 
 	std::vector<Shader*>	m_shaders[SHADERTYPE_LAST];
 	Program					m_program;
@@ -25,8 +25,10 @@
 #include "gluTextureUtil.hpp"
 #include "deFilePath.hpp"
 #include "tcuImageIO.hpp"
+#include "tcuResourceCache.hpp"
 #include "tcuSurface.hpp"
 #include "tcuTextureUtil.hpp"
+#include "tcuInstrumentation.hpp"
 
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
@@ -79,6 +81,8 @@ Texture1D::~Texture1D (void)
 
 void Texture1D::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::Texture1D::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	TCU_CHECK(m_glTexture);
@@ -160,6 +164,8 @@ Texture2D::~Texture2D (void)
 
 void Texture2D::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::Texture2D::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	DE_ASSERT(!m_isCompressed);
@@ -223,6 +229,10 @@ Texture2D* Texture2D::create (const RenderContext& context, const ContextInfo& c
 
 		tcu::TextureLevel level;
 
+		// Decode remaining levels in background while level 0 is loaded.
+		if (numLevels > 1)
+			tcu::ResourceCache::getInstance().prefetchImages(archive, std::vector<std::string>(levelFileNames+1, levelFileNames+numLevels));
+
 		// Load level 0.
 		tcu::ImageIO::loadPNG(level, archive, levelFileNames[0]);
 
@@ -292,6 +302,8 @@ ImmutableTexture2D::ImmutableTexture2D (const RenderContext& context, deUint32 s
 
 void ImmutableTexture2D::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::ImmutableTexture2D::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	DE_ASSERT(!m_isCompressed);
@@ -379,6 +391,8 @@ TextureCube::~TextureCube (void)
 
 void TextureCube::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureCube::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	DE_ASSERT(!m_isCompressed);
@@ -502,6 +516,8 @@ Texture1DArray::~Texture1DArray (void)
 
 void Texture1DArray::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::Texture1DArray::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	TCU_CHECK(m_glTexture);
@@ -586,6 +602,8 @@ Texture2DArray::~Texture2DArray (void)
 
 void Texture2DArray::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::Texture2DArray::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	if (!gl.texImage3D)
@@ -706,6 +724,8 @@ Texture3D::~Texture3D (void)
 
 void Texture3D::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::Texture3D::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	DE_ASSERT(!m_isCompressed);
@@ -799,6 +819,8 @@ TextureCubeArray::~TextureCubeArray (void)
 
 void TextureCubeArray::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureCubeArray::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	if (!gl.texImage3D)
@@ -935,6 +957,8 @@ const tcu::ConstPixelBufferAccess TextureBuffer::getFullRefTexture (void) const
 
 void TextureBuffer::upload (void)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureBuffer::upload");
+
 	const glw::Functions& gl = m_context.getFunctions();
 
 	gl.bindBuffer(GL_TEXTURE_BUFFER, m_glBuffer);
@@ -27,6 +27,7 @@
 
 #include "tcuFloat.hpp"
 #include "tcuImageCompare.hpp"
+#include "tcuInstrumentation.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuVectorUtil.hpp"
 
@@ -441,6 +442,10 @@ static void sampleTextureNonProjected (const tcu::SurfaceAccess& dst, const tcu:
 	float										triLod[2]			= { de::clamp(computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[0], triT[0]) + lodBias, params.minLod, params.maxLod),
 																		de::clamp(computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[1], triT[1]) + lodBias, params.minLod, params.maxLod) };
 
+	// Texture2DSampler selects format and wrap mode specialized path once
+	const tcu::Texture2DSampler					sampler				(src, params.sampler);
+	const bool									useSampler			= params.samplerType != SAMPLERTYPE_SHADOW;
+
 	for (int y = 0; y < dst.getHeight(); y++)
 	{
 		for (int x = 0; x < dst.getWidth(); x++)
@@ -456,7 +461,9 @@ static void sampleTextureNonProjected (const tcu::SurfaceAccess& dst, const tcu:
 			float	t		= triangleInterpolate(triT[triNdx].x(), triT[triNdx].y(), triT[triNdx].z(), triX, triY);
 			float	lod		= triLod[triNdx];
 
-			dst.setPixel(execSample(src, params, s, t, lod) * params.colorScale + params.colorBias, x, y);
+			const tcu::Vec4	color	= useSampler ? sampler.sample(s, t, lod) : execSample(src, params, s, t, lod);
+
+			dst.setPixel(color * params.colorScale + params.colorBias, x, y);
 		}
 	}
 }
@@ -1232,6 +1239,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::LodPrecision&				lodPrec,
 							  qpWatchDog*							watchDog)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureLookupDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -1335,6 +1344,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::LodPrecision&				lodPrec,
 							  qpWatchDog*							watchDog)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureLookupDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -1444,6 +1455,8 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::LodPrecision&				lodPrec,
 						  const tcu::PixelFormat&				pixelFormat)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::verifyTextureResult");
+
 	tcu::TestLog&	log				= testCtx.getLog();
 	tcu::Surface	reference		(result.getWidth(), result.getHeight());
 	tcu::Surface	errorMask		(result.getWidth(), result.getHeight());
@@ -1480,6 +1493,8 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::LodPrecision&				lodPrec,
 						  const tcu::PixelFormat&				pixelFormat)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::verifyTextureResult");
+
 	tcu::TestLog&	log				= testCtx.getLog();
 	tcu::Surface	reference		(result.getWidth(), result.getHeight());
 	tcu::Surface	errorMask		(result.getWidth(), result.getHeight());
@@ -1518,6 +1533,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::LodPrecision&				lodPrec,
 							  qpWatchDog*							watchDog)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureLookupDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -1660,6 +1677,8 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::LodPrecision&				lodPrec,
 						  const tcu::PixelFormat&				pixelFormat)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::verifyTextureResult");
+
 	tcu::TestLog&	log				= testCtx.getLog();
 	tcu::Surface	reference		(result.getWidth(), result.getHeight());
 	tcu::Surface	errorMask		(result.getWidth(), result.getHeight());
@@ -1698,6 +1717,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::LodPrecision&				lodPrec,
 							  qpWatchDog*							watchDog)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureLookupDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -1831,6 +1852,8 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::LodPrecision&				lodPrec,
 						  const tcu::PixelFormat&				pixelFormat)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::verifyTextureResult");
+
 	tcu::TestLog&	log				= testCtx.getLog();
 	tcu::Surface	reference		(result.getWidth(), result.getHeight());
 	tcu::Surface	errorMask		(result.getWidth(), result.getHeight());
@@ -1869,6 +1892,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::LodPrecision&				lodPrec,
 							  qpWatchDog*							watchDog)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureLookupDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -1976,6 +2001,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::LodPrecision&				lodPrec,
 							  qpWatchDog*							watchDog)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureLookupDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -2088,6 +2115,8 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::LodPrecision&				lodPrec,
 						  const tcu::PixelFormat&				pixelFormat)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::verifyTextureResult");
+
 	tcu::TestLog&	log				= testCtx.getLog();
 	tcu::Surface	reference		(result.getWidth(), result.getHeight());
 	tcu::Surface	errorMask		(result.getWidth(), result.getHeight());
@@ -2124,6 +2153,8 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::LodPrecision&				lodPrec,
 						  const tcu::PixelFormat&				pixelFormat)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::verifyTextureResult");
+
 	tcu::TestLog&	log				= testCtx.getLog();
 	tcu::Surface	reference		(result.getWidth(), result.getHeight());
 	tcu::Surface	errorMask		(result.getWidth(), result.getHeight());
@@ -2163,6 +2194,8 @@ int computeTextureLookupDiff (const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::LodPrecision&				lodPrec,
 							  qpWatchDog*							watchDog)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureLookupDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -2309,6 +2342,8 @@ bool verifyTextureResult (tcu::TestContext&						testCtx,
 						  const tcu::LodPrecision&				lodPrec,
 						  const tcu::PixelFormat&				pixelFormat)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::verifyTextureResult");
+
 	tcu::TestLog&	log				= testCtx.getLog();
 	tcu::Surface	reference		(result.getWidth(), result.getHeight());
 	tcu::Surface	errorMask		(result.getWidth(), result.getHeight());
@@ -2348,6 +2383,8 @@ int computeTextureCompareDiff (const tcu::ConstPixelBufferAccess&	result,
 							   const tcu::LodPrecision&				lodPrec,
 							   const tcu::Vec3&						nonShadowThreshold)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureCompareDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -2460,6 +2497,8 @@ int computeTextureCompareDiff (const tcu::ConstPixelBufferAccess&	result,
 							   const tcu::LodPrecision&				lodPrec,
 							   const tcu::Vec3&						nonShadowThreshold)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureCompareDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -2582,6 +2621,8 @@ int computeTextureCompareDiff (const tcu::ConstPixelBufferAccess&	result,
 							   const tcu::LodPrecision&				lodPrec,
 							   const tcu::Vec3&						nonShadowThreshold)
 {
+	const tcu::InstrumentationScope scope ("glu::TextureTestUtil::computeTextureCompareDiff");
+
 	DE_ASSERT(result.getWidth() == reference.getWidth() && result.getHeight() == reference.getHeight());
 	DE_ASSERT(result.getWidth() == errorMask.getWidth() && result.getHeight() == errorMask.getHeight());
 
@@ -4912,6 +4912,11 @@ void Texture2D::sample4 (tcu::Vec4 output[4], const tcu::Vec2 packetTexcoords[4]
 	const tcu::Vec2 dFdy0 = packetTexcoords[2] - packetTexcoords[0];
 	const tcu::Vec2 dFdy1 = packetTexcoords[3] - packetTexcoords[1];
 
+	const tcu::Texture2DSampler	sampler		(m_view, getSampler());
+	const tcu::Vec2				coords[4]	= { packetTexcoords[0], packetTexcoords[1], packetTexcoords[2], packetTexcoords[3] };
+	float						lods[4];
+	tcu::Vec4					result[4];
+
 	for (int fragNdx = 0; fragNdx < 4; ++fragNdx)
 	{
 		const tcu::Vec2& dFdx = (fragNdx & 2) ? dFdx1 : dFdx0;
@@ -4921,10 +4926,13 @@ void Texture2D::sample4 (tcu::Vec4 output[4], const tcu::Vec2 packetTexcoords[4]
 		const float mv = de::max(de::abs(dFdx.y()), de::abs(dFdy.y()));
 		const float p = de::max(mu * texWidth, mv * texHeight);
 
-		const float	lod = deFloatLog2(p) + lodBias;
-
-		output[fragNdx] = sample(packetTexcoords[fragNdx].x(), packetTexcoords[fragNdx].y(), lod);
+		lods[fragNdx] = deFloatLog2(p) + lodBias;
 	}
+
+	sampler.sample4(result, coords, lods);
+
+	for (int fragNdx = 0; fragNdx < 4; ++fragNdx)
+		output[fragNdx] = result[fragNdx];
 }
 
 TextureCube::TextureCube (deUint32 name)
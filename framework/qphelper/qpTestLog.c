@@ -45,6 +45,10 @@
 #	include <io.h>
 #endif
 
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+#	define QP_TEST_LOG_SUPPORT_FD_OUTPUT 1
+#endif
+
 #if defined(DE_DEBUG)
 
 /* Utils for verifying container (Section, ImageSet, EglConfigSet) usage in debug builds. */
@@ -323,10 +327,33 @@ static deBool endSession (qpTestLog* log)
 	return DE_TRUE;
 }
 
+static FILE* openOutputFile (const char* fileName)
+{
+#if defined(QP_TEST_LOG_SUPPORT_FD_OUTPUT)
+	if (deStringBeginsWith(fileName, "fd:"))
+	{
+		const char*	fdStr	= fileName + 3;
+		char*		end		= DE_NULL;
+		const long	fd		= strtol(fdStr, &end, 10);
+
+		if (end == fdStr || *end != 0 || fd < 0)
+			return DE_NULL;
+
+		return fdopen((int)fd, "wb");
+	}
+#endif
+
+	return fopen(fileName, "wb");
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Create a file based logger instance
  * \param fileName Name of the file where to put logs
  * \return qpTestLog instance, or DE_NULL if cannot create file
+ *
+ * On POSIX platforms fileName of form "fd:<N>" writes the log into
+ * already open file descriptor N, such as a pipe inherited from the
+ * execution server. No file is created in that case.
  *//*--------------------------------------------------------------------*/
 qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 {
@@ -343,7 +370,7 @@ qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 	qpPrintf("Writing test log into %s\n", fileName);
 
 	/* Create output file. */
-	log->outputFile = fopen(fileName, "wb");
+	log->outputFile = openOutputFile(fileName);
 	if (!log->outputFile)
 	{
 		qpPrintf("ERROR: Unable to open test log output file '%s'.\n", fileName);
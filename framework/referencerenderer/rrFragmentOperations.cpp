@@ -24,6 +24,8 @@
 #include "rrFragmentOperations.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuTextureUtil.hpp"
+#include "deFloat16.h"
+#include "deMath.h"
 #include <limits>
 
 using tcu::IVec2;
@@ -47,20 +49,26 @@ static inline int maskedBitReplace (int oldValue, int newValue, deUint32 mask)
 	return (oldValue & ~mask) | (newValue & mask);
 }
 
-static inline bool isInsideRect (const IVec2& point, const WindowRectangle& rect)
+// Unpremultiply colors stored in SoA layout.
+template <int Size>
+static void unpremultiply (float (&color)[4][Size])
 {
-	return de::inBounds(point.x(), rect.left,		rect.left + rect.width) &&
-		   de::inBounds(point.y(), rect.bottom,		rect.bottom + rect.height);
-}
-
-static inline Vec4 unpremultiply (const Vec4& v)
-{
-	if (v.w() > 0.0f)
-		return Vec4(v.x()/v.w(), v.y()/v.w(), v.z()/v.w(), v.w());
-	else
+	for (int ndx = 0; ndx < Size; ndx++)
 	{
-		DE_ASSERT(v.x() == 0.0f && v.y() == 0.0f && v.z() == 0.0f);
-		return Vec4(0.0f, 0.0f, 0.0f, 0.0f);
+		const float alpha = color[3][ndx];
+
+		if (alpha > 0.0f)
+		{
+			for (int channelNdx = 0; channelNdx < 3; channelNdx++)
+				color[channelNdx][ndx] = color[channelNdx][ndx] / alpha;
+		}
+		else
+		{
+			DE_ASSERT(color[0][ndx] == 0.0f && color[1][ndx] == 0.0f && color[2][ndx] == 0.0f);
+
+			for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+				color[channelNdx][ndx] = 0.0f;
+		}
 	}
 }
 
@@ -70,376 +78,539 @@ void clearMultisampleColorBuffer	(const tcu::PixelBufferAccess& dst, const UVec4
 void clearMultisampleDepthBuffer	(const tcu::PixelBufferAccess& dst, float v,		const WindowRectangle& r)	{ tcu::clearDepth(tcu::getSubregion(dst, 0, r.left, r.bottom, dst.getWidth(), r.width, r.height), v);			}
 void clearMultisampleStencilBuffer	(const tcu::PixelBufferAccess& dst, int v,			const WindowRectangle& r)	{ tcu::clearStencil(tcu::getSubregion(dst, 0, r.left, r.bottom, dst.getWidth(), r.width, r.height), v);			}
 
+// Convert float to unorm value like tcu::PixelBufferAccess::setPixDepth() does: round to nearest even and saturate.
+static inline deUint32 convertSatRteUnorm (float f, deUint32 maxValue)
+{
+	const float	q		= deFloatFrac(f);
+	deInt64		intVal	= (deInt64)(f-q);
+
+	if (q == 0.5f)
+	{
+		if (intVal % 2 != 0)
+			intVal++;
+	}
+	else if (q > 0.5f)
+		intVal++;
+
+	return (deUint32)de::max((deInt64)0, de::min((deInt64)maxValue, intVal));
+}
+
+// Evaluate test function for all values. Called with whole sample register, results for dead samples are meaningless.
+template <typename T>
+static void executeTestFunc (TestFunc func, const T* ref, const T* value, bool* dst, int numValues)
+{
+#define TEST_FUNC_LOOP(COMPARE_EXPRESSION)			\
+	for (int ndx = 0; ndx < numValues; ndx++)		\
+		dst[ndx] = (COMPARE_EXPRESSION);
+
+	switch (func)
+	{
+		case TESTFUNC_NEVER:	TEST_FUNC_LOOP(false)					break;
+		case TESTFUNC_ALWAYS:	TEST_FUNC_LOOP(true)					break;
+		case TESTFUNC_LESS:		TEST_FUNC_LOOP(ref[ndx] <  value[ndx])	break;
+		case TESTFUNC_LEQUAL:	TEST_FUNC_LOOP(ref[ndx] <= value[ndx])	break;
+		case TESTFUNC_GREATER:	TEST_FUNC_LOOP(ref[ndx] >  value[ndx])	break;
+		case TESTFUNC_GEQUAL:	TEST_FUNC_LOOP(ref[ndx] >= value[ndx])	break;
+		case TESTFUNC_EQUAL:	TEST_FUNC_LOOP(ref[ndx] == value[ndx])	break;
+		case TESTFUNC_NOTEQUAL:	TEST_FUNC_LOOP(ref[ndx] != value[ndx])	break;
+		default:
+			DE_ASSERT(false);
+	}
+
+#undef TEST_FUNC_LOOP
+}
+
+static inline deUint32 readUint24 (const deUint8* src)
+{
+#if (DE_ENDIANNESS == DE_LITTLE_ENDIAN)
+	return (((deUint32)src[0]) << 0u) | (((deUint32)src[1]) << 8u) | (((deUint32)src[2]) << 16u);
+#else
+	return (((deUint32)src[0]) << 16u) | (((deUint32)src[1]) << 8u) | (((deUint32)src[2]) << 0u);
+#endif
+}
+
+static inline void writeUint24 (deUint8* dst, deUint32 val)
+{
+#if (DE_ENDIANNESS == DE_LITTLE_ENDIAN)
+	dst[0] = (deUint8)(val >> 0u);
+	dst[1] = (deUint8)(val >> 8u);
+	dst[2] = (deUint8)(val >> 16u);
+#else
+	dst[0] = (deUint8)(val >> 16u);
+	dst[1] = (deUint8)(val >> 8u);
+	dst[2] = (deUint8)(val >> 0u);
+#endif
+}
+
+static inline bool isStencil8Format (const tcu::TextureFormat& format)
+{
+	return format == tcu::TextureFormat(tcu::TextureFormat::S, tcu::TextureFormat::UNSIGNED_INT8);
+}
+
+static inline bool isRGBAFormat (const tcu::TextureFormat& format, tcu::TextureFormat::ChannelType type)
+{
+	return format == tcu::TextureFormat(tcu::TextureFormat::RGBA, type);
+}
+
 FragmentProcessor::FragmentProcessor (void)
 	: m_sampleRegister()
 {
 }
 
-void FragmentProcessor::executeScissorTest (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const WindowRectangle& scissorRect)
+void FragmentProcessor::initSampleRegister (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, int numFragments)
 {
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive)
+		const int	fragNdx			= fragNdxOffset + regSampleNdx/numSamplesPerFragment;
+		const int	fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
+
+		if (fragNdx < numFragments)
 		{
-			int fragNdx = fragNdxOffset + regSampleNdx/numSamplesPerFragment;
+			const Fragment& frag = inputFragments[fragNdx];
 
-			if (!isInsideRect(inputFragments[fragNdx].pixelCoord, scissorRect))
-				m_sampleRegister[regSampleNdx].isAlive = false;
+			m_sampleRegister.isAlive[regSampleNdx]			= (frag.coverage & (1u << fragSampleNdx)) != 0;
+			m_sampleRegister.fragNdx[regSampleNdx]			= fragNdx;
+			m_sampleRegister.fragSampleNdx[regSampleNdx]	= fragSampleNdx;
+			m_sampleRegister.pixelX[regSampleNdx]			= frag.pixelCoord.x();
+			m_sampleRegister.pixelY[regSampleNdx]			= frag.pixelCoord.y();
 		}
+		else
+		{
+			m_sampleRegister.isAlive[regSampleNdx]			= false;
+			m_sampleRegister.fragNdx[regSampleNdx]			= 0;
+			m_sampleRegister.fragSampleNdx[regSampleNdx]	= 0;
+			m_sampleRegister.pixelX[regSampleNdx]			= 0;
+			m_sampleRegister.pixelY[regSampleNdx]			= 0;
+		}
+
+		m_sampleRegister.depthPassed[regSampleNdx] = true; // \note This will stay true if depth test is disabled.
 	}
 }
 
-void FragmentProcessor::executeStencilCompare (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const StencilState& stencilState, int numStencilBits, const tcu::ConstPixelBufferAccess& stencilBuffer)
+void FragmentProcessor::executeScissorTest (const WindowRectangle& scissorRect)
 {
-#define SAMPLE_REGISTER_STENCIL_COMPARE(COMPARE_EXPRESSION)																					\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)															\
-	{																																		\
-		if (m_sampleRegister[regSampleNdx].isAlive)																							\
-		{																																	\
-			int					fragSampleNdx		= regSampleNdx % numSamplesPerFragment;													\
-			const Fragment&		frag				= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];					\
-			int					stencilBufferValue	= stencilBuffer.getPixStencil(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());	\
-			int					maskedRef			= stencilState.compMask & clampedStencilRef;											\
-			int					maskedBuf			= stencilState.compMask & stencilBufferValue;											\
-			DE_UNREF(maskedRef);																											\
-			DE_UNREF(maskedBuf);																											\
-																																			\
-			m_sampleRegister[regSampleNdx].stencilPassed = (COMPARE_EXPRESSION);															\
-		}																																	\
-	}
-
-	int clampedStencilRef = de::clamp(stencilState.ref, 0, (1<<numStencilBits)-1);
-
-	switch (stencilState.func)
-	{
-		case TESTFUNC_NEVER:	SAMPLE_REGISTER_STENCIL_COMPARE(false)						break;
-		case TESTFUNC_ALWAYS:	SAMPLE_REGISTER_STENCIL_COMPARE(true)						break;
-		case TESTFUNC_LESS:		SAMPLE_REGISTER_STENCIL_COMPARE(maskedRef <  maskedBuf)		break;
-		case TESTFUNC_LEQUAL:	SAMPLE_REGISTER_STENCIL_COMPARE(maskedRef <= maskedBuf)		break;
-		case TESTFUNC_GREATER:	SAMPLE_REGISTER_STENCIL_COMPARE(maskedRef >  maskedBuf)		break;
-		case TESTFUNC_GEQUAL:	SAMPLE_REGISTER_STENCIL_COMPARE(maskedRef >= maskedBuf)		break;
-		case TESTFUNC_EQUAL:	SAMPLE_REGISTER_STENCIL_COMPARE(maskedRef == maskedBuf)		break;
-		case TESTFUNC_NOTEQUAL:	SAMPLE_REGISTER_STENCIL_COMPARE(maskedRef != maskedBuf)		break;
-		default:
-			DE_ASSERT(false);
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+	{
+		const bool isInside = de::inBounds(m_sampleRegister.pixelX[regSampleNdx], scissorRect.left,		scissorRect.left + scissorRect.width) &&
+							  de::inBounds(m_sampleRegister.pixelY[regSampleNdx], scissorRect.bottom,	scissorRect.bottom + scissorRect.height);
+
+		m_sampleRegister.isAlive[regSampleNdx] = m_sampleRegister.isAlive[regSampleNdx] && isInside;
+	}
+}
+
+void FragmentProcessor::executeStencilCompare (const StencilState& stencilState, int numStencilBits, const tcu::ConstPixelBufferAccess& stencilBuffer)
+{
+	const int	clampedStencilRef	= de::clamp(stencilState.ref, 0, (1<<numStencilBits)-1);
+	int			maskedRef			[SAMPLE_REGISTER_SIZE];
+	int			maskedBuf			[SAMPLE_REGISTER_SIZE];
+
+	// Read stencil values. Values are kept in register for stencil operations.
+
+	if (isStencil8Format(stencilBuffer.getFormat()))
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			if (m_sampleRegister.isAlive[regSampleNdx])
+				m_sampleRegister.stencilBufferValue[regSampleNdx] = *(const deUint8*)stencilBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
+			else
+				m_sampleRegister.stencilBufferValue[regSampleNdx] = 0;
+		}
+	}
+	else
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			if (m_sampleRegister.isAlive[regSampleNdx])
+				m_sampleRegister.stencilBufferValue[regSampleNdx] = stencilBuffer.getPixStencil(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
+			else
+				m_sampleRegister.stencilBufferValue[regSampleNdx] = 0;
+		}
 	}
 
-#undef SAMPLE_REGISTER_STENCIL_COMPARE
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+	{
+		maskedRef[regSampleNdx] = stencilState.compMask & clampedStencilRef;
+		maskedBuf[regSampleNdx] = stencilState.compMask & m_sampleRegister.stencilBufferValue[regSampleNdx];
+	}
+
+	executeTestFunc(stencilState.func, maskedRef, maskedBuf, m_sampleRegister.stencilPassed, SAMPLE_REGISTER_SIZE);
 }
 
-void FragmentProcessor::executeStencilSFail (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer)
+// Apply stencil operation to samples selected by opMask. Stencil values must have been read with executeStencilCompare().
+void FragmentProcessor::executeStencilOp (StencilOp op, const bool* opMask, const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer)
 {
-#define SAMPLE_REGISTER_SFAIL(SFAIL_EXPRESSION)																																		\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)																									\
-	{																																												\
-		if (m_sampleRegister[regSampleNdx].isAlive && !m_sampleRegister[regSampleNdx].stencilPassed)																				\
-		{																																											\
-			int					fragSampleNdx		= regSampleNdx % numSamplesPerFragment;																							\
-			const Fragment&		frag				= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];															\
-			int					stencilBufferValue	= stencilBuffer.getPixStencil(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());											\
-																																													\
-			stencilBuffer.setPixStencil(maskedBitReplace(stencilBufferValue, (SFAIL_EXPRESSION), stencilState.writeMask), fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());	\
-			m_sampleRegister[regSampleNdx].isAlive = false;																															\
-		}																																											\
+#define SAMPLE_REGISTER_STENCIL_OP(EXPRESSION)																			\
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)										\
+	{																													\
+		const int stencilBufferValue = m_sampleRegister.stencilBufferValue[regSampleNdx];								\
+		DE_UNREF(stencilBufferValue);																					\
+																														\
+		newValue[regSampleNdx] = maskedBitReplace(stencilBufferValue, (EXPRESSION), stencilState.writeMask);			\
 	}
 
-	int clampedStencilRef = de::clamp(stencilState.ref, 0, (1<<numStencilBits)-1);
+	const int	clampedStencilRef	= de::clamp(stencilState.ref, 0, (1<<numStencilBits)-1);
+	int			newValue			[SAMPLE_REGISTER_SIZE];
 
-	switch (stencilState.sFail)
+	switch (op)
 	{
-		case STENCILOP_KEEP:		SAMPLE_REGISTER_SFAIL(stencilBufferValue)												break;
-		case STENCILOP_ZERO:		SAMPLE_REGISTER_SFAIL(0)																break;
-		case STENCILOP_REPLACE:		SAMPLE_REGISTER_SFAIL(clampedStencilRef)												break;
-		case STENCILOP_INCR:		SAMPLE_REGISTER_SFAIL(de::clamp(stencilBufferValue+1, 0, (1<<numStencilBits) - 1))		break;
-		case STENCILOP_DECR:		SAMPLE_REGISTER_SFAIL(de::clamp(stencilBufferValue-1, 0, (1<<numStencilBits) - 1))		break;
-		case STENCILOP_INCR_WRAP:	SAMPLE_REGISTER_SFAIL((stencilBufferValue + 1) & ((1<<numStencilBits) - 1))				break;
-		case STENCILOP_DECR_WRAP:	SAMPLE_REGISTER_SFAIL((stencilBufferValue - 1) & ((1<<numStencilBits) - 1))				break;
-		case STENCILOP_INVERT:		SAMPLE_REGISTER_SFAIL((~stencilBufferValue) & ((1<<numStencilBits) - 1))				break;
+		case STENCILOP_KEEP:		SAMPLE_REGISTER_STENCIL_OP(stencilBufferValue)												break;
+		case STENCILOP_ZERO:		SAMPLE_REGISTER_STENCIL_OP(0)																break;
+		case STENCILOP_REPLACE:		SAMPLE_REGISTER_STENCIL_OP(clampedStencilRef)												break;
+		case STENCILOP_INCR:		SAMPLE_REGISTER_STENCIL_OP(de::clamp(stencilBufferValue+1, 0, (1<<numStencilBits) - 1))		break;
+		case STENCILOP_DECR:		SAMPLE_REGISTER_STENCIL_OP(de::clamp(stencilBufferValue-1, 0, (1<<numStencilBits) - 1))		break;
+		case STENCILOP_INCR_WRAP:	SAMPLE_REGISTER_STENCIL_OP((stencilBufferValue + 1) & ((1<<numStencilBits) - 1))			break;
+		case STENCILOP_DECR_WRAP:	SAMPLE_REGISTER_STENCIL_OP((stencilBufferValue - 1) & ((1<<numStencilBits) - 1))			break;
+		case STENCILOP_INVERT:		SAMPLE_REGISTER_STENCIL_OP((~stencilBufferValue) & ((1<<numStencilBits) - 1))				break;
 		default:
 			DE_ASSERT(false);
 	}
 
-#undef SAMPLE_REGISTER_SFAIL
-}
-
-void FragmentProcessor::executeDepthCompare (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, TestFunc depthFunc, const tcu::ConstPixelBufferAccess& depthBuffer)
-{
-#define SAMPLE_REGISTER_DEPTH_COMPARE_F(COMPARE_EXPRESSION)																						\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)																\
-	{																																			\
-		if (m_sampleRegister[regSampleNdx].isAlive)																								\
-		{																																		\
-			int					fragSampleNdx		= regSampleNdx % numSamplesPerFragment;														\
-			const Fragment&		frag				= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];						\
-			float				depthBufferValue	= depthBuffer.getPixDepth(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());			\
-			float				sampleDepthFloat	= frag.sampleDepths[fragSampleNdx];															\
-			float				sampleDepth			= de::clamp(sampleDepthFloat, 0.0f, 1.0f);													\
-																																				\
-			m_sampleRegister[regSampleNdx].depthPassed = (COMPARE_EXPRESSION);																	\
-																																				\
-			DE_UNREF(depthBufferValue);																											\
-			DE_UNREF(sampleDepth);																												\
-		}																																		\
-	}
-
-#define SAMPLE_REGISTER_DEPTH_COMPARE_UI(COMPARE_EXPRESSION)																					\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)																\
-	{																																			\
-		if (m_sampleRegister[regSampleNdx].isAlive)																								\
-		{																																		\
-			int					fragSampleNdx		= regSampleNdx % numSamplesPerFragment;														\
-			const Fragment&		frag				= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];						\
-			deUint32			depthBufferValue	= depthBuffer.getPixelUint(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y()).x();	\
-			float				sampleDepthFloat	= frag.sampleDepths[fragSampleNdx];															\
-																																				\
-			/* Convert input float to target buffer format for comparison */																	\
-																																				\
-			deUint32 buffer[2];																													\
-																																				\
-			DE_ASSERT(sizeof(buffer) >= (size_t)depthBuffer.getFormat().getPixelSize());														\
-																																				\
-			tcu::PixelBufferAccess access(depthBuffer.getFormat(), 1, 1, 1, &buffer);															\
-			access.setPixDepth(sampleDepthFloat, 0, 0, 0);																						\
-			deUint32 sampleDepth = access.getPixelUint(0, 0, 0).x();																			\
-																																				\
-			m_sampleRegister[regSampleNdx].depthPassed = (COMPARE_EXPRESSION);																	\
-																																				\
-			DE_UNREF(depthBufferValue);																											\
-			DE_UNREF(sampleDepth);																												\
-		}																																		\
-	}
-
-	if (depthBuffer.getFormat().type == tcu::TextureFormat::FLOAT || depthBuffer.getFormat().type == tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV)
-	{
-
-		switch (depthFunc)
+#undef SAMPLE_REGISTER_STENCIL_OP
+
+	if (isStencil8Format(stencilBuffer.getFormat()))
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			if (opMask[regSampleNdx])
+			{
+				// \note Saturates like PixelBufferAccess::setPixStencil()
+				*(deUint8*)stencilBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]) = (deUint8)de::min((deUint32)newValue[regSampleNdx], 0xFFu);
+				m_sampleRegister.stencilBufferValue[regSampleNdx] = newValue[regSampleNdx];
+			}
+		}
+	}
+	else
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			if (opMask[regSampleNdx])
+			{
+				stencilBuffer.setPixStencil(newValue[regSampleNdx], m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
+				m_sampleRegister.stencilBufferValue[regSampleNdx] = newValue[regSampleNdx];
+			}
+		}
+	}
+}
+
+void FragmentProcessor::executeStencilSFail (const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer)
+{
+	bool failed[SAMPLE_REGISTER_SIZE];
+
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		failed[regSampleNdx] = m_sampleRegister.isAlive[regSampleNdx] && !m_sampleRegister.stencilPassed[regSampleNdx];
+
+	executeStencilOp(stencilState.sFail, failed, stencilState, numStencilBits, stencilBuffer);
+
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		m_sampleRegister.isAlive[regSampleNdx] = m_sampleRegister.isAlive[regSampleNdx] && !failed[regSampleNdx];
+}
+
+void FragmentProcessor::executeDepthCompare (const Fragment* inputFragments, TestFunc depthFunc, const tcu::ConstPixelBufferAccess& depthBuffer)
+{
+	const tcu::TextureFormat&	format	= depthBuffer.getFormat();
+
+	if (format.type == tcu::TextureFormat::FLOAT || format.type == tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV)
+	{
+		const bool isFloat32 = format.type == tcu::TextureFormat::FLOAT;
+
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 		{
-			case TESTFUNC_NEVER:	SAMPLE_REGISTER_DEPTH_COMPARE_F(false)							break;
-			case TESTFUNC_ALWAYS:	SAMPLE_REGISTER_DEPTH_COMPARE_F(true)								break;
-			case TESTFUNC_LESS:		SAMPLE_REGISTER_DEPTH_COMPARE_F(sampleDepth <  depthBufferValue)	break;
-			case TESTFUNC_LEQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_F(sampleDepth <= depthBufferValue)	break;
-			case TESTFUNC_GREATER:	SAMPLE_REGISTER_DEPTH_COMPARE_F(sampleDepth >  depthBufferValue)	break;
-			case TESTFUNC_GEQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_F(sampleDepth >= depthBufferValue)	break;
-			case TESTFUNC_EQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_F(sampleDepth == depthBufferValue)	break;
-			case TESTFUNC_NOTEQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_F(sampleDepth != depthBufferValue)	break;
-			default:
-				DE_ASSERT(false);
+			if (m_sampleRegister.isAlive[regSampleNdx])
+			{
+				const int	fragSampleNdx	= m_sampleRegister.fragSampleNdx[regSampleNdx];
+				const int	x				= m_sampleRegister.pixelX[regSampleNdx];
+				const int	y				= m_sampleRegister.pixelY[regSampleNdx];
+
+				m_sampleRegister.sampleDepth[regSampleNdx]		= inputFragments[m_sampleRegister.fragNdx[regSampleNdx]].sampleDepths[fragSampleNdx];
+				m_sampleRegister.depthBufferValue[regSampleNdx]	= isFloat32 ? *(const float*)depthBuffer.getPixelPtr(fragSampleNdx, x, y) : depthBuffer.getPixDepth(fragSampleNdx, x, y);
+			}
+			else
+			{
+				m_sampleRegister.sampleDepth[regSampleNdx]		= 0.0f;
+				m_sampleRegister.depthBufferValue[regSampleNdx]	= 0.0f;
+			}
 		}
 
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+			m_sampleRegister.sampleDepth[regSampleNdx] = de::clamp(m_sampleRegister.sampleDepth[regSampleNdx], 0.0f, 1.0f);
+
+		executeTestFunc(depthFunc, m_sampleRegister.sampleDepth, m_sampleRegister.depthBufferValue, m_sampleRegister.depthPassed, SAMPLE_REGISTER_SIZE);
+	}
+	else if (format.order == tcu::TextureFormat::D && (format.type == tcu::TextureFormat::UNORM_INT16 || format.type == tcu::TextureFormat::UNORM_INT24))
+	{
+		// Compare in fixed-point, sample depth is converted exactly like setPixDepth() would convert it.
+		const bool		isUnorm16	= format.type == tcu::TextureFormat::UNORM_INT16;
+		const deUint32	maxValue	= isUnorm16 ? 0xFFFFu : 0xFFFFFFu;
+		float			sampleDepth	[SAMPLE_REGISTER_SIZE];
+
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			if (m_sampleRegister.isAlive[regSampleNdx])
+			{
+				const deUint8* const ptr = (const deUint8*)depthBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
+
+				sampleDepth[regSampleNdx] = inputFragments[m_sampleRegister.fragNdx[regSampleNdx]].sampleDepths[m_sampleRegister.fragSampleNdx[regSampleNdx]];
+
+				m_sampleRegister.depthBufferValueUint[regSampleNdx] = isUnorm16 ? (deUint32)*(const deUint16*)ptr : readUint24(ptr);
+			}
+			else
+			{
+				sampleDepth[regSampleNdx]								= 0.0f;
+				m_sampleRegister.depthBufferValueUint[regSampleNdx]	= 0;
+			}
+		}
+
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+			m_sampleRegister.sampleDepthUint[regSampleNdx] = convertSatRteUnorm(sampleDepth[regSampleNdx] * (float)maxValue, maxValue);
+
+		executeTestFunc(depthFunc, m_sampleRegister.sampleDepthUint, m_sampleRegister.depthBufferValueUint, m_sampleRegister.depthPassed, SAMPLE_REGISTER_SIZE);
 	}
 	else
 	{
-		switch (depthFunc)
+		// Generic path: convert input float to target buffer format for comparison.
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 		{
-			case TESTFUNC_NEVER:	SAMPLE_REGISTER_DEPTH_COMPARE_UI(false)							break;
-			case TESTFUNC_ALWAYS:	SAMPLE_REGISTER_DEPTH_COMPARE_UI(true)								break;
-			case TESTFUNC_LESS:		SAMPLE_REGISTER_DEPTH_COMPARE_UI(sampleDepth <  depthBufferValue)	break;
-			case TESTFUNC_LEQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_UI(sampleDepth <= depthBufferValue)	break;
-			case TESTFUNC_GREATER:	SAMPLE_REGISTER_DEPTH_COMPARE_UI(sampleDepth >  depthBufferValue)	break;
-			case TESTFUNC_GEQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_UI(sampleDepth >= depthBufferValue)	break;
-			case TESTFUNC_EQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_UI(sampleDepth == depthBufferValue)	break;
-			case TESTFUNC_NOTEQUAL:	SAMPLE_REGISTER_DEPTH_COMPARE_UI(sampleDepth != depthBufferValue)	break;
-			default:
-				DE_ASSERT(false);
+			if (m_sampleRegister.isAlive[regSampleNdx])
+			{
+				const int				fragSampleNdx	= m_sampleRegister.fragSampleNdx[regSampleNdx];
+				deUint32				buffer[2];
+
+				DE_ASSERT(sizeof(buffer) >= (size_t)format.getPixelSize());
+
+				tcu::PixelBufferAccess	access			(format, 1, 1, 1, &buffer);
+
+				access.setPixDepth(inputFragments[m_sampleRegister.fragNdx[regSampleNdx]].sampleDepths[fragSampleNdx], 0, 0, 0);
+
+				m_sampleRegister.sampleDepthUint[regSampleNdx]		= access.getPixelUint(0, 0, 0).x();
+				m_sampleRegister.depthBufferValueUint[regSampleNdx]	= depthBuffer.getPixelUint(fragSampleNdx, m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]).x();
+			}
+			else
+			{
+				m_sampleRegister.sampleDepthUint[regSampleNdx]		= 0;
+				m_sampleRegister.depthBufferValueUint[regSampleNdx]	= 0;
+			}
 		}
+
+		executeTestFunc(depthFunc, m_sampleRegister.sampleDepthUint, m_sampleRegister.depthBufferValueUint, m_sampleRegister.depthPassed, SAMPLE_REGISTER_SIZE);
 	}
+}
 
-#undef SAMPLE_REGISTER_DEPTH_COMPARE_F
-#undef SAMPLE_REGISTER_DEPTH_COMPARE_UI
+void FragmentProcessor::executeDepthWrite (const Fragment* inputFragments, const tcu::PixelBufferAccess& depthBuffer)
+{
+	const tcu::TextureFormat&	format		= depthBuffer.getFormat();
+	const bool					isFloat32	= format.type == tcu::TextureFormat::FLOAT;
+	const bool					isUnorm16	= format.order == tcu::TextureFormat::D && format.type == tcu::TextureFormat::UNORM_INT16;
+	const bool					isUnorm24	= format.order == tcu::TextureFormat::D && format.type == tcu::TextureFormat::UNORM_INT24;
+
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+	{
+		if (m_sampleRegister.isAlive[regSampleNdx] && m_sampleRegister.depthPassed[regSampleNdx])
+		{
+			const int		fragSampleNdx	= m_sampleRegister.fragSampleNdx[regSampleNdx];
+			const int		x				= m_sampleRegister.pixelX[regSampleNdx];
+			const int		y				= m_sampleRegister.pixelY[regSampleNdx];
+			const float		clampedDepth	= de::clamp(inputFragments[m_sampleRegister.fragNdx[regSampleNdx]].sampleDepths[fragSampleNdx], 0.0f, 1.0f);
+			deUint8* const	ptr				= (deUint8*)depthBuffer.getPixelPtr(fragSampleNdx, x, y);
+
+			if (isFloat32)
+				*(float*)ptr = clampedDepth;
+			else if (isUnorm16)
+				*(deUint16*)ptr = (deUint16)convertSatRteUnorm(clampedDepth * 65535.0f, 0xFFFFu);
+			else if (isUnorm24)
+				writeUint24(ptr, convertSatRteUnorm(clampedDepth * 16777215.0f, 0xFFFFFFu));
+			else
+				depthBuffer.setPixDepth(clampedDepth, fragSampleNdx, x, y);
+		}
+	}
 }
 
-void FragmentProcessor::executeDepthWrite (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::PixelBufferAccess& depthBuffer)
+void FragmentProcessor::executeStencilDpFailAndPass (const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer)
 {
+	bool dpFail[SAMPLE_REGISTER_SIZE];
+	bool dpPass[SAMPLE_REGISTER_SIZE];
+
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive && m_sampleRegister[regSampleNdx].depthPassed)
+		dpFail[regSampleNdx] = m_sampleRegister.isAlive[regSampleNdx] && !m_sampleRegister.depthPassed[regSampleNdx];
+		dpPass[regSampleNdx] = m_sampleRegister.isAlive[regSampleNdx] && m_sampleRegister.depthPassed[regSampleNdx];
+	}
+
+	executeStencilOp(stencilState.dpFail, dpFail, stencilState, numStencilBits, stencilBuffer);
+	executeStencilOp(stencilState.dpPass, dpPass, stencilState, numStencilBits, stencilBuffer);
+}
+
+void FragmentProcessor::executeLoadBlendDstColor (bool isSRGB, const Vec4& minClampValue, const Vec4& maxClampValue, const tcu::ConstPixelBufferAccess& colorBuffer)
+{
+	float (&dst)[4][SAMPLE_REGISTER_SIZE] = m_sampleRegister.blendDst;
+
+	if (isRGBAFormat(colorBuffer.getFormat(), tcu::TextureFormat::UNORM_INT8))
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 		{
-			int					fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-			const Fragment&		frag			= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];
-			const float			clampedDepth	= de::clamp(frag.sampleDepths[fragSampleNdx], 0.0f, 1.0f);
+			if (m_sampleRegister.isAlive[regSampleNdx])
+			{
+				const deUint8* const ptr = (const deUint8*)colorBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
 
-			depthBuffer.setPixDepth(clampedDepth, fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+				for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+					dst[channelNdx][regSampleNdx] = ptr[channelNdx] / 255.0f;
+			}
+			else
+			{
+				for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+					dst[channelNdx][regSampleNdx] = 0.0f;
+			}
 		}
 	}
-}
+	else if (isRGBAFormat(colorBuffer.getFormat(), tcu::TextureFormat::HALF_FLOAT))
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			if (m_sampleRegister.isAlive[regSampleNdx])
+			{
+				const deFloat16* const ptr = (const deFloat16*)colorBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
 
-void FragmentProcessor::executeStencilDpFailAndPass (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer)
-{
-#define SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, EXPRESSION)																													\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)																								\
-	{																																											\
-		if (m_sampleRegister[regSampleNdx].isAlive && (CONDITION))																												\
-		{																																										\
-			int					fragSampleNdx		= regSampleNdx % numSamplesPerFragment;																						\
-			const Fragment&		frag				= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];														\
-			int					stencilBufferValue	= stencilBuffer.getPixStencil(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());										\
-																																												\
-			stencilBuffer.setPixStencil(maskedBitReplace(stencilBufferValue, (EXPRESSION), stencilState.writeMask), fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());	\
-		}																																										\
-	}
-
-#define SWITCH_DPFAIL_OR_DPPASS(OP_NAME, CONDITION)																											\
-		switch (stencilState.OP_NAME)																														\
-		{																																					\
-			case STENCILOP_KEEP:		SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, stencilBufferValue)												break;	\
-			case STENCILOP_ZERO:		SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, 0)																break;	\
-			case STENCILOP_REPLACE:		SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, clampedStencilRef)												break;	\
-			case STENCILOP_INCR:		SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, de::clamp(stencilBufferValue+1, 0, (1<<numStencilBits) - 1))	break;	\
-			case STENCILOP_DECR:		SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, de::clamp(stencilBufferValue-1, 0, (1<<numStencilBits) - 1))	break;	\
-			case STENCILOP_INCR_WRAP:	SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, (stencilBufferValue + 1) & ((1<<numStencilBits) - 1))			break;	\
-			case STENCILOP_DECR_WRAP:	SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, (stencilBufferValue - 1) & ((1<<numStencilBits) - 1))			break;	\
-			case STENCILOP_INVERT:		SAMPLE_REGISTER_DPFAIL_OR_DPPASS(CONDITION, (~stencilBufferValue) & ((1<<numStencilBits) - 1))				break;	\
-			default:																																		\
-				DE_ASSERT(false);																															\
+				for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+					dst[channelNdx][regSampleNdx] = deFloat16To32(ptr[channelNdx]);
+			}
+			else
+			{
+				for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+					dst[channelNdx][regSampleNdx] = 0.0f;
+			}
 		}
+	}
+	else if (isRGBAFormat(colorBuffer.getFormat(), tcu::TextureFormat::FLOAT))
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			if (m_sampleRegister.isAlive[regSampleNdx])
+			{
+				const float* const ptr = (const float*)colorBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
 
-	int clampedStencilRef = de::clamp(stencilState.ref, 0, (1<<numStencilBits)-1);
-
-	SWITCH_DPFAIL_OR_DPPASS(dpFail, !m_sampleRegister[regSampleNdx].depthPassed)
-	SWITCH_DPFAIL_OR_DPPASS(dpPass, m_sampleRegister[regSampleNdx].depthPassed)
-
-#undef SWITCH_DPFAIL_OR_DPPASS
-#undef SAMPLE_REGISTER_DPFAIL_OR_DPPASS
-}
-
-void FragmentProcessor::executeBlendFactorComputeRGB (const Vec4& blendColor, const BlendState& blendRGBState)
-{
-#define SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, FACTOR_EXPRESSION)																				\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)																	\
-	{																																				\
-		if (m_sampleRegister[regSampleNdx].isAlive)																									\
-		{																																			\
-			const Vec4& src		= m_sampleRegister[regSampleNdx].clampedBlendSrcColor;																\
-			const Vec4& src1	= m_sampleRegister[regSampleNdx].clampedBlendSrc1Color;																\
-			const Vec4& dst		= m_sampleRegister[regSampleNdx].clampedBlendDstColor;																\
-			DE_UNREF(src);																															\
-			DE_UNREF(src1);																															\
-			DE_UNREF(dst);																															\
-																																					\
-			m_sampleRegister[regSampleNdx].FACTOR_NAME = (FACTOR_EXPRESSION);																		\
-		}																																			\
-	}
-
-#define SWITCH_SRC_OR_DST_FACTOR_RGB(FUNC_NAME, FACTOR_NAME)																					\
-	switch (blendRGBState.FUNC_NAME)																											\
-	{																																			\
-		case BLENDFUNC_ZERO:						SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(0.0f))								break;	\
-		case BLENDFUNC_ONE:							SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f))								break;	\
-		case BLENDFUNC_SRC_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, src.swizzle(0,1,2))						break;	\
-		case BLENDFUNC_ONE_MINUS_SRC_COLOR:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f) - src.swizzle(0,1,2))			break;	\
-		case BLENDFUNC_DST_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, dst.swizzle(0,1,2))						break;	\
-		case BLENDFUNC_ONE_MINUS_DST_COLOR:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f) - dst.swizzle(0,1,2))			break;	\
-		case BLENDFUNC_SRC_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(src.w()))							break;	\
-		case BLENDFUNC_ONE_MINUS_SRC_ALPHA:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f - src.w()))						break;	\
-		case BLENDFUNC_DST_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(dst.w()))							break;	\
-		case BLENDFUNC_ONE_MINUS_DST_ALPHA:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f - dst.w()))						break;	\
-		case BLENDFUNC_CONSTANT_COLOR:				SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, blendColor.swizzle(0,1,2))				break;	\
-		case BLENDFUNC_ONE_MINUS_CONSTANT_COLOR:	SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f) - blendColor.swizzle(0,1,2))	break;	\
-		case BLENDFUNC_CONSTANT_ALPHA:				SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(blendColor.w()))						break;	\
-		case BLENDFUNC_ONE_MINUS_CONSTANT_ALPHA:	SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f - blendColor.w()))				break;	\
-		case BLENDFUNC_SRC_ALPHA_SATURATE:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(de::min(src.w(), 1.0f - dst.w())))	break;	\
-		case BLENDFUNC_SRC1_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, src1.swizzle(0,1,2))						break;	\
-		case BLENDFUNC_ONE_MINUS_SRC1_COLOR:		SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f) - src1.swizzle(0,1,2))			break;	\
-		case BLENDFUNC_SRC1_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(src1.w()))							break;	\
-		case BLENDFUNC_ONE_MINUS_SRC1_ALPHA:		SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, Vec3(1.0f - src1.w()))					break;	\
-		default:																																\
-			DE_ASSERT(false);																													\
-	}
-
-	SWITCH_SRC_OR_DST_FACTOR_RGB(srcFunc, blendSrcFactorRGB)
-	SWITCH_SRC_OR_DST_FACTOR_RGB(dstFunc, blendDstFactorRGB)
-
-#undef SWITCH_SRC_OR_DST_FACTOR_RGB
-#undef SAMPLE_REGISTER_BLEND_FACTOR
+				for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+					dst[channelNdx][regSampleNdx] = ptr[channelNdx];
+			}
+			else
+			{
+				for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+					dst[channelNdx][regSampleNdx] = 0.0f;
+			}
+		}
+	}
+	else
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+		{
+			Vec4 dstColor (0.0f);
+
+			if (m_sampleRegister.isAlive[regSampleNdx])
+			{
+				dstColor = colorBuffer.getPixel(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
+
+				if (isSRGB)
+					dstColor = tcu::sRGBToLinear(dstColor);
+			}
+
+			for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+				dst[channelNdx][regSampleNdx] = dstColor[channelNdx];
+		}
+	}
+
+	for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+	{
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+			dst[channelNdx][regSampleNdx] = de::clamp(dst[channelNdx][regSampleNdx], minClampValue[channelNdx], maxClampValue[channelNdx]);
+	}
 }
 
-void FragmentProcessor::executeBlendFactorComputeA (const Vec4& blendColor, const BlendState& blendAState)
-{
-#define SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, FACTOR_EXPRESSION)														\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)											\
-	{																														\
-		if (m_sampleRegister[regSampleNdx].isAlive)																			\
-		{																													\
-			const Vec4& src		= m_sampleRegister[regSampleNdx].clampedBlendSrcColor;										\
-			const Vec4& src1	= m_sampleRegister[regSampleNdx].clampedBlendSrc1Color;										\
-			const Vec4& dst		= m_sampleRegister[regSampleNdx].clampedBlendDstColor;										\
-			DE_UNREF(src);																									\
-			DE_UNREF(src1);																									\
-			DE_UNREF(dst);																									\
-																															\
-			m_sampleRegister[regSampleNdx].FACTOR_NAME = (FACTOR_EXPRESSION);												\
-		}																													\
-	}
-
-#define SWITCH_SRC_OR_DST_FACTOR_A(FUNC_NAME, FACTOR_NAME)																		\
-	switch (blendAState.FUNC_NAME)																								\
-	{																															\
-		case BLENDFUNC_ZERO:						SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 0.0f)						break;	\
-		case BLENDFUNC_ONE:							SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f)						break;	\
-		case BLENDFUNC_SRC_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, src.w())					break;	\
-		case BLENDFUNC_ONE_MINUS_SRC_COLOR:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - src.w())			break;	\
-		case BLENDFUNC_DST_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, dst.w())					break;	\
-		case BLENDFUNC_ONE_MINUS_DST_COLOR:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - dst.w())			break;	\
-		case BLENDFUNC_SRC_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, src.w())					break;	\
-		case BLENDFUNC_ONE_MINUS_SRC_ALPHA:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - src.w())			break;	\
-		case BLENDFUNC_DST_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, dst.w())					break;	\
-		case BLENDFUNC_ONE_MINUS_DST_ALPHA:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - dst.w())			break;	\
-		case BLENDFUNC_CONSTANT_COLOR:				SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, blendColor.w())			break;	\
-		case BLENDFUNC_ONE_MINUS_CONSTANT_COLOR:	SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - blendColor.w())	break;	\
-		case BLENDFUNC_CONSTANT_ALPHA:				SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, blendColor.w())			break;	\
-		case BLENDFUNC_ONE_MINUS_CONSTANT_ALPHA:	SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - blendColor.w())	break;	\
-		case BLENDFUNC_SRC_ALPHA_SATURATE:			SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f)						break;	\
-		case BLENDFUNC_SRC1_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, src1.w())					break;	\
-		case BLENDFUNC_ONE_MINUS_SRC1_COLOR:		SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - src1.w())			break;	\
-		case BLENDFUNC_SRC1_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, src1.w())					break;	\
-		case BLENDFUNC_ONE_MINUS_SRC1_ALPHA:		SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_NAME, 1.0f - src1.w())			break;	\
-		default:																												\
-			DE_ASSERT(false);																									\
-	}
-
-	SWITCH_SRC_OR_DST_FACTOR_A(srcFunc, blendSrcFactorA)
-	SWITCH_SRC_OR_DST_FACTOR_A(dstFunc, blendDstFactorA)
-
-#undef SWITCH_SRC_OR_DST_FACTOR_A
+void FragmentProcessor::executeBlendFactorCompute (const Vec4& blendColor, const BlendState& blendRGBState, const BlendState& blendAState)
+{
+#define SAMPLE_REGISTER_BLEND_FACTOR(FACTOR_EXPRESSION)								\
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)	\
+		factor[regSampleNdx] = (FACTOR_EXPRESSION);
+
+	// \note Factors are computed per channel; for alpha channel, color factors select alpha values.
+	for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+	{
+		const BlendState&	blendState	= (channelNdx < 3) ? blendRGBState : blendAState;
+		const float* const	src			= m_sampleRegister.blendSrc[channelNdx];
+		const float* const	src1		= m_sampleRegister.blendSrc1[channelNdx];
+		const float* const	dst			= m_sampleRegister.blendDst[channelNdx];
+		const float* const	srcA		= m_sampleRegister.blendSrc[3];
+		const float* const	src1A		= m_sampleRegister.blendSrc1[3];
+		const float* const	dstA		= m_sampleRegister.blendDst[3];
+		const float			constant	= blendColor[channelNdx];
+		const float			constantA	= blendColor.w();
+
+		for (int factorNdx = 0; factorNdx < 2; factorNdx++)
+		{
+			const BlendFunc	func	= (factorNdx == 0) ? blendState.srcFunc : blendState.dstFunc;
+			float* const	factor	= (factorNdx == 0) ? m_sampleRegister.blendSrcFactor[channelNdx] : m_sampleRegister.blendDstFactor[channelNdx];
+
+			switch (func)
+			{
+				case BLENDFUNC_ZERO:						SAMPLE_REGISTER_BLEND_FACTOR(0.0f)								break;
+				case BLENDFUNC_ONE:							SAMPLE_REGISTER_BLEND_FACTOR(1.0f)								break;
+				case BLENDFUNC_SRC_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(src[regSampleNdx])					break;
+				case BLENDFUNC_ONE_MINUS_SRC_COLOR:			SAMPLE_REGISTER_BLEND_FACTOR(1.0f - src[regSampleNdx])			break;
+				case BLENDFUNC_DST_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(dst[regSampleNdx])					break;
+				case BLENDFUNC_ONE_MINUS_DST_COLOR:			SAMPLE_REGISTER_BLEND_FACTOR(1.0f - dst[regSampleNdx])			break;
+				case BLENDFUNC_SRC_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(srcA[regSampleNdx])				break;
+				case BLENDFUNC_ONE_MINUS_SRC_ALPHA:			SAMPLE_REGISTER_BLEND_FACTOR(1.0f - srcA[regSampleNdx])			break;
+				case BLENDFUNC_DST_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(dstA[regSampleNdx])				break;
+				case BLENDFUNC_ONE_MINUS_DST_ALPHA:			SAMPLE_REGISTER_BLEND_FACTOR(1.0f - dstA[regSampleNdx])			break;
+				case BLENDFUNC_CONSTANT_COLOR:				SAMPLE_REGISTER_BLEND_FACTOR(constant)							break;
+				case BLENDFUNC_ONE_MINUS_CONSTANT_COLOR:	SAMPLE_REGISTER_BLEND_FACTOR(1.0f - constant)					break;
+				case BLENDFUNC_CONSTANT_ALPHA:				SAMPLE_REGISTER_BLEND_FACTOR(constantA)							break;
+				case BLENDFUNC_ONE_MINUS_CONSTANT_ALPHA:	SAMPLE_REGISTER_BLEND_FACTOR(1.0f - constantA)					break;
+				case BLENDFUNC_SRC1_COLOR:					SAMPLE_REGISTER_BLEND_FACTOR(src1[regSampleNdx])				break;
+				case BLENDFUNC_ONE_MINUS_SRC1_COLOR:		SAMPLE_REGISTER_BLEND_FACTOR(1.0f - src1[regSampleNdx])			break;
+				case BLENDFUNC_SRC1_ALPHA:					SAMPLE_REGISTER_BLEND_FACTOR(src1A[regSampleNdx])				break;
+				case BLENDFUNC_ONE_MINUS_SRC1_ALPHA:		SAMPLE_REGISTER_BLEND_FACTOR(1.0f - src1A[regSampleNdx])		break;
+
+				case BLENDFUNC_SRC_ALPHA_SATURATE:
+					if (channelNdx < 3)
+						SAMPLE_REGISTER_BLEND_FACTOR(de::min(srcA[regSampleNdx], 1.0f - dstA[regSampleNdx]))
+					else
+						SAMPLE_REGISTER_BLEND_FACTOR(1.0f)
+					break;
+
+				default:
+					DE_ASSERT(false);
+			}
+		}
+	}
+
 #undef SAMPLE_REGISTER_BLEND_FACTOR
 }
 
 void FragmentProcessor::executeBlend (const BlendState& blendRGBState, const BlendState& blendAState)
 {
-#define SAMPLE_REGISTER_BLENDED_COLOR(COLOR_NAME, COLOR_EXPRESSION)						\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)		\
-	{																					\
-		if (m_sampleRegister[regSampleNdx].isAlive)										\
-		{																				\
-			SampleData& sample		= m_sampleRegister[regSampleNdx];					\
-			const Vec4& srcColor	= sample.clampedBlendSrcColor;						\
-			const Vec4& dstColor	= sample.clampedBlendDstColor;						\
-																						\
-			sample.COLOR_NAME = (COLOR_EXPRESSION);										\
-		}																				\
-	}
-
-	switch (blendRGBState.equation)
-	{
-		case BLENDEQUATION_ADD:					SAMPLE_REGISTER_BLENDED_COLOR(blendedRGB, srcColor.swizzle(0,1,2)*sample.blendSrcFactorRGB + dstColor.swizzle(0,1,2)*sample.blendDstFactorRGB)	break;
-		case BLENDEQUATION_SUBTRACT:			SAMPLE_REGISTER_BLENDED_COLOR(blendedRGB, srcColor.swizzle(0,1,2)*sample.blendSrcFactorRGB - dstColor.swizzle(0,1,2)*sample.blendDstFactorRGB)	break;
-		case BLENDEQUATION_REVERSE_SUBTRACT:	SAMPLE_REGISTER_BLENDED_COLOR(blendedRGB, dstColor.swizzle(0,1,2)*sample.blendDstFactorRGB - srcColor.swizzle(0,1,2)*sample.blendSrcFactorRGB)	break;
-		case BLENDEQUATION_MIN:					SAMPLE_REGISTER_BLENDED_COLOR(blendedRGB, min(srcColor.swizzle(0,1,2), dstColor.swizzle(0,1,2)))												break;
-		case BLENDEQUATION_MAX:					SAMPLE_REGISTER_BLENDED_COLOR(blendedRGB, max(srcColor.swizzle(0,1,2), dstColor.swizzle(0,1,2)))												break;
-		default:
-			DE_ASSERT(false);
-	}
+#define SAMPLE_REGISTER_BLENDED_COLOR(COLOR_EXPRESSION)								\
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)	\
+		blended[regSampleNdx] = (COLOR_EXPRESSION);
 
-	switch (blendAState.equation)
+	for (int channelNdx = 0; channelNdx < 4; channelNdx++)
 	{
-		case BLENDEQUATION_ADD:					SAMPLE_REGISTER_BLENDED_COLOR(blendedA, srcColor.w()*sample.blendSrcFactorA + dstColor.w()*sample.blendDstFactorA)	break;
-		case BLENDEQUATION_SUBTRACT:			SAMPLE_REGISTER_BLENDED_COLOR(blendedA, srcColor.w()*sample.blendSrcFactorA - dstColor.w()*sample.blendDstFactorA)	break;
-		case BLENDEQUATION_REVERSE_SUBTRACT:	SAMPLE_REGISTER_BLENDED_COLOR(blendedA, dstColor.w()*sample.blendDstFactorA - srcColor.w()*sample.blendSrcFactorA)	break;
-		case BLENDEQUATION_MIN:					SAMPLE_REGISTER_BLENDED_COLOR(blendedA, min(srcColor.w(), dstColor.w()))											break;
-		case BLENDEQUATION_MAX:					SAMPLE_REGISTER_BLENDED_COLOR(blendedA, max(srcColor.w(), dstColor.w()))											break;
-		default:
-			DE_ASSERT(false);
+		const BlendEquation	equation	= (channelNdx < 3) ? blendRGBState.equation : blendAState.equation;
+		const float* const	src			= m_sampleRegister.blendSrc[channelNdx];
+		const float* const	dst			= m_sampleRegister.blendDst[channelNdx];
+		const float* const	srcFactor	= m_sampleRegister.blendSrcFactor[channelNdx];
+		const float* const	dstFactor	= m_sampleRegister.blendDstFactor[channelNdx];
+		float* const		blended		= m_sampleRegister.blended[channelNdx];
+
+		switch (equation)
+		{
+			case BLENDEQUATION_ADD:					SAMPLE_REGISTER_BLENDED_COLOR(src[regSampleNdx]*srcFactor[regSampleNdx] + dst[regSampleNdx]*dstFactor[regSampleNdx])	break;
+			case BLENDEQUATION_SUBTRACT:			SAMPLE_REGISTER_BLENDED_COLOR(src[regSampleNdx]*srcFactor[regSampleNdx] - dst[regSampleNdx]*dstFactor[regSampleNdx])	break;
+			case BLENDEQUATION_REVERSE_SUBTRACT:	SAMPLE_REGISTER_BLENDED_COLOR(dst[regSampleNdx]*dstFactor[regSampleNdx] - src[regSampleNdx]*srcFactor[regSampleNdx])	break;
+			case BLENDEQUATION_MIN:					SAMPLE_REGISTER_BLENDED_COLOR(de::min(src[regSampleNdx], dst[regSampleNdx]))											break;
+			case BLENDEQUATION_MAX:					SAMPLE_REGISTER_BLENDED_COLOR(de::max(src[regSampleNdx], dst[regSampleNdx]))											break;
+			default:
+				DE_ASSERT(false);
+		}
 	}
+
 #undef SAMPLE_REGISTER_BLENDED_COLOR
 }
 
@@ -557,61 +728,46 @@ void FragmentProcessor::executeAdvancedBlend (BlendEquationAdvanced equation)
 {
 	using namespace advblend;
 
-#define SAMPLE_REGISTER_ADV_BLEND(FUNCTION_NAME)											\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)			\
-	{																						\
-		if (m_sampleRegister[regSampleNdx].isAlive)											\
-		{																					\
-			SampleData&	sample		= m_sampleRegister[regSampleNdx];						\
-			const Vec4&	srcColor	= sample.clampedBlendSrcColor;							\
-			const Vec4&	dstColor	= sample.clampedBlendDstColor;							\
-			const Vec3&	bias		= sample.blendSrcFactorRGB;								\
-			const float	p0			= sample.blendSrcFactorA;								\
-			const float	r			= FUNCTION_NAME(srcColor[0], dstColor[0])*p0 + bias[0];	\
-			const float	g			= FUNCTION_NAME(srcColor[1], dstColor[1])*p0 + bias[1];	\
-			const float	b			= FUNCTION_NAME(srcColor[2], dstColor[2])*p0 + bias[2];	\
-																							\
-			sample.blendedRGB = Vec3(r, g, b);												\
-		}																					\
-	}
-
-#define SAMPLE_REGISTER_ADV_BLEND_HSL(COLOR_EXPRESSION)										\
-	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)			\
-	{																						\
-		if (m_sampleRegister[regSampleNdx].isAlive)											\
-		{																					\
-			SampleData&	sample		= m_sampleRegister[regSampleNdx];						\
-			const Vec3	srcColor	= sample.clampedBlendSrcColor.swizzle(0,1,2);			\
-			const Vec3	dstColor	= sample.clampedBlendDstColor.swizzle(0,1,2);			\
-			const Vec3&	bias		= sample.blendSrcFactorRGB;								\
-			const float	p0			= sample.blendSrcFactorA;								\
-																							\
-			sample.blendedRGB = (COLOR_EXPRESSION)*p0 + bias;								\
-		}																					\
-	}
-
-	// Pre-compute factors & compute alpha \todo [2014-03-18 pyry] Re-using variable names.
-	// \note clampedBlend*Color contains clamped & unpremultiplied colors
+	// \note blendSrcFactor is re-used for pre-computed factors: bias in RGB channels, p0 in A channel.
+	const float	(&src)[4][SAMPLE_REGISTER_SIZE]		= m_sampleRegister.blendSrc;
+	const float	(&dst)[4][SAMPLE_REGISTER_SIZE]		= m_sampleRegister.blendDst;
+	float		(&bias)[4][SAMPLE_REGISTER_SIZE]	= m_sampleRegister.blendSrcFactor;
+	float		(&p0)[SAMPLE_REGISTER_SIZE]			= m_sampleRegister.blendSrcFactor[3];
+	float		(&blended)[4][SAMPLE_REGISTER_SIZE]	= m_sampleRegister.blended;
+
+#define SAMPLE_REGISTER_ADV_BLEND(FUNCTION_NAME)																							\
+	for (int channelNdx = 0; channelNdx < 3; channelNdx++)																					\
+	{																																		\
+		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)														\
+			blended[channelNdx][regSampleNdx] = FUNCTION_NAME(src[channelNdx][regSampleNdx], dst[channelNdx][regSampleNdx])*p0[regSampleNdx] + bias[channelNdx][regSampleNdx];	\
+	}
+
+#define SAMPLE_REGISTER_ADV_BLEND_HSL(COLOR_EXPRESSION)																	\
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)										\
+	{																													\
+		const Vec3	srcColor	(src[0][regSampleNdx], src[1][regSampleNdx], src[2][regSampleNdx]);						\
+		const Vec3	dstColor	(dst[0][regSampleNdx], dst[1][regSampleNdx], dst[2][regSampleNdx]);						\
+		const Vec3	biasColor	(bias[0][regSampleNdx], bias[1][regSampleNdx], bias[2][regSampleNdx]);					\
+		const Vec3	color		= (COLOR_EXPRESSION)*p0[regSampleNdx] + biasColor;										\
+																														\
+		for (int channelNdx = 0; channelNdx < 3; channelNdx++)															\
+			blended[channelNdx][regSampleNdx] = color[channelNdx];														\
+	}
+
+	// Pre-compute factors & compute alpha
+	// \note src and dst contain clamped & unpremultiplied colors
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive)
-		{
-			SampleData&	sample		= m_sampleRegister[regSampleNdx];
-			const Vec4&	srcColor	= sample.clampedBlendSrcColor;
-			const Vec4&	dstColor	= sample.clampedBlendDstColor;
-			const float	srcA		= srcColor.w();
-			const float	dstA		= dstColor.w();
-			const float	p0			= srcA*dstA;
-			const float p1			= srcA*(1.0f-dstA);
-			const float p2			= dstA*(1.0f-srcA);
-			const Vec3	bias		(srcColor[0]*p1 + dstColor[0]*p2,
-									 srcColor[1]*p1 + dstColor[1]*p2,
-									 srcColor[2]*p1 + dstColor[2]*p2);
-
-			sample.blendSrcFactorRGB	= bias;
-			sample.blendSrcFactorA		= p0;
-			sample.blendedA				= p0 + p1 + p2;
-		}
+		const float	srcA	= src[3][regSampleNdx];
+		const float	dstA	= dst[3][regSampleNdx];
+		const float	p1		= srcA*(1.0f-dstA);
+		const float	p2		= dstA*(1.0f-srcA);
+
+		for (int channelNdx = 0; channelNdx < 3; channelNdx++)
+			bias[channelNdx][regSampleNdx] = src[channelNdx][regSampleNdx]*p1 + dst[channelNdx][regSampleNdx]*p2;
+
+		p0[regSampleNdx]			= srcA*dstA;
+		blended[3][regSampleNdx]	= p0[regSampleNdx] + p1 + p2;
 	}
 
 	switch (equation)
@@ -639,100 +795,122 @@ void FragmentProcessor::executeAdvancedBlend (BlendEquationAdvanced equation)
 #undef SAMPLE_REGISTER_ADV_BLEND_HSL
 }
 
-void FragmentProcessor::executeColorWrite (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, bool isSRGB, const tcu::PixelBufferAccess& colorBuffer)
+void FragmentProcessor::executeColorWrite (bool isSRGB, const tcu::PixelBufferAccess& colorBuffer)
 {
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive)
+		if (m_sampleRegister.isAlive[regSampleNdx])
 		{
-			int					fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-			const Fragment&		frag			= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];
-			Vec4				combinedColor;
-
-			combinedColor.xyz()	= m_sampleRegister[regSampleNdx].blendedRGB;
-			combinedColor.w()	= m_sampleRegister[regSampleNdx].blendedA;
+			Vec4 combinedColor (m_sampleRegister.blended[0][regSampleNdx],
+								m_sampleRegister.blended[1][regSampleNdx],
+								m_sampleRegister.blended[2][regSampleNdx],
+								m_sampleRegister.blended[3][regSampleNdx]);
 
 			if (isSRGB)
 				combinedColor = tcu::linearToSRGB(combinedColor);
 
-			colorBuffer.setPixel(combinedColor, fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+			colorBuffer.setPixel(combinedColor, m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
 		}
 	}
 }
 
-void FragmentProcessor::executeRGBA8ColorWrite (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::PixelBufferAccess& colorBuffer)
+void FragmentProcessor::executeRGBA8ColorWrite (const tcu::PixelBufferAccess& colorBuffer)
 {
-	const int		fragStride	= 4;
-	const int		xStride		= colorBuffer.getRowPitch();
-	const int		yStride		= colorBuffer.getSlicePitch();
-	deUint8* const	basePtr		= (deUint8*)colorBuffer.getDataPtr();
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+	{
+		if (m_sampleRegister.isAlive[regSampleNdx])
+		{
+			deUint8* const dstPtr = (deUint8*)colorBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
+
+			for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+				dstPtr[channelNdx] = tcu::floatToU8(m_sampleRegister.blended[channelNdx][regSampleNdx]);
+		}
+	}
+}
 
+void FragmentProcessor::executeRGBA16FColorWrite (const tcu::PixelBufferAccess& colorBuffer)
+{
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive)
+		if (m_sampleRegister.isAlive[regSampleNdx])
 		{
-			const int			fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-			const Fragment&		frag			= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];
-			deUint8*			dstPtr			= basePtr + fragSampleNdx*fragStride + frag.pixelCoord.x()*xStride + frag.pixelCoord.y()*yStride;
-
-			dstPtr[0] = tcu::floatToU8(m_sampleRegister[regSampleNdx].blendedRGB.x());
-			dstPtr[1] = tcu::floatToU8(m_sampleRegister[regSampleNdx].blendedRGB.y());
-			dstPtr[2] = tcu::floatToU8(m_sampleRegister[regSampleNdx].blendedRGB.z());
-			dstPtr[3] = tcu::floatToU8(m_sampleRegister[regSampleNdx].blendedA);
+			deFloat16* const dstPtr = (deFloat16*)colorBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
+
+			for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+				dstPtr[channelNdx] = deFloat32To16(m_sampleRegister.blended[channelNdx][regSampleNdx]);
 		}
 	}
 }
 
-void FragmentProcessor::executeMaskedColorWrite (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const Vec4& colorMaskFactor, const Vec4& colorMaskNegationFactor, bool isSRGB, const tcu::PixelBufferAccess& colorBuffer)
+void FragmentProcessor::executeRGBA32FColorWrite (const tcu::PixelBufferAccess& colorBuffer)
 {
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive)
+		if (m_sampleRegister.isAlive[regSampleNdx])
 		{
-			int					fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-			const Fragment&		frag			= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];
-			Vec4				originalColor	= colorBuffer.getPixel(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
-			Vec4				newColor;
+			float* const dstPtr = (float*)colorBuffer.getPixelPtr(m_sampleRegister.fragSampleNdx[regSampleNdx], m_sampleRegister.pixelX[regSampleNdx], m_sampleRegister.pixelY[regSampleNdx]);
 
-			newColor.xyz()	= m_sampleRegister[regSampleNdx].blendedRGB;
-			newColor.w()	= m_sampleRegister[regSampleNdx].blendedA;
+			for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+				dstPtr[channelNdx] = m_sampleRegister.blended[channelNdx][regSampleNdx];
+		}
+	}
+}
+
+void FragmentProcessor::executeMaskedColorWrite (const Vec4& colorMaskFactor, const Vec4& colorMaskNegationFactor, bool isSRGB, const tcu::PixelBufferAccess& colorBuffer)
+{
+	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+	{
+		if (m_sampleRegister.isAlive[regSampleNdx])
+		{
+			const int	fragSampleNdx	= m_sampleRegister.fragSampleNdx[regSampleNdx];
+			const int	x				= m_sampleRegister.pixelX[regSampleNdx];
+			const int	y				= m_sampleRegister.pixelY[regSampleNdx];
+			const Vec4	originalColor	= colorBuffer.getPixel(fragSampleNdx, x, y);
+			Vec4		newColor		(m_sampleRegister.blended[0][regSampleNdx],
+										 m_sampleRegister.blended[1][regSampleNdx],
+										 m_sampleRegister.blended[2][regSampleNdx],
+										 m_sampleRegister.blended[3][regSampleNdx]);
 
 			if (isSRGB)
 				newColor = tcu::linearToSRGB(newColor);
 
 			newColor = colorMaskFactor*newColor + colorMaskNegationFactor*originalColor;
 
-			colorBuffer.setPixel(newColor, fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+			colorBuffer.setPixel(newColor, fragSampleNdx, x, y);
 		}
 	}
 }
 
-void FragmentProcessor::executeSignedValueWrite (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer)
+void FragmentProcessor::executeSignedValueWrite (const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer)
 {
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive)
+		if (m_sampleRegister.isAlive[regSampleNdx])
 		{
-			int					fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-			const Fragment&		frag			= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];
-			const IVec4			originalValue	= colorBuffer.getPixelInt(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+			const int		fragSampleNdx	= m_sampleRegister.fragSampleNdx[regSampleNdx];
+			const int		x				= m_sampleRegister.pixelX[regSampleNdx];
+			const int		y				= m_sampleRegister.pixelY[regSampleNdx];
+			const IVec4		originalValue	= colorBuffer.getPixelInt(fragSampleNdx, x, y);
+			const IVec4&	signedValue		= inputFragments[m_sampleRegister.fragNdx[regSampleNdx]].value.get<deInt32>();
 
-			colorBuffer.setPixel(tcu::select(m_sampleRegister[regSampleNdx].signedValue, originalValue, colorMask), fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+			colorBuffer.setPixel(tcu::select(signedValue, originalValue, colorMask), fragSampleNdx, x, y);
 		}
 	}
 }
 
-void FragmentProcessor::executeUnsignedValueWrite (int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer)
+void FragmentProcessor::executeUnsignedValueWrite (const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer)
 {
 	for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 	{
-		if (m_sampleRegister[regSampleNdx].isAlive)
+		if (m_sampleRegister.isAlive[regSampleNdx])
 		{
-			int					fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-			const Fragment&		frag			= inputFragments[fragNdxOffset + regSampleNdx/numSamplesPerFragment];
-			const UVec4			originalValue	= colorBuffer.getPixelUint(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+			const int		fragSampleNdx	= m_sampleRegister.fragSampleNdx[regSampleNdx];
+			const int		x				= m_sampleRegister.pixelX[regSampleNdx];
+			const int		y				= m_sampleRegister.pixelY[regSampleNdx];
+			const UVec4		originalValue	= colorBuffer.getPixelUint(fragSampleNdx, x, y);
+			const UVec4&	unsignedValue	= inputFragments[m_sampleRegister.fragNdx[regSampleNdx]].value.get<deUint32>();
 
-			colorBuffer.setPixel(tcu::select(m_sampleRegister[regSampleNdx].unsignedValue, originalValue, colorMask), fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+			colorBuffer.setPixel(tcu::select(unsignedValue, originalValue, colorMask), fragSampleNdx, x, y);
 		}
 	}
 }
@@ -788,31 +966,19 @@ void FragmentProcessor::render (const rr::MultisamplePixelBufferAccess&		msColor
 
 		// Initialize sample data in the sample register.
 
-		for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
-		{
-			int fragNdx			= groupFirstFragNdx + regSampleNdx/numSamplesPerFragment;
-			int fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-
-			if (fragNdx < numFragments)
-			{
-				m_sampleRegister[regSampleNdx].isAlive		= (inputFragments[fragNdx].coverage & (1u << fragSampleNdx)) != 0;
-				m_sampleRegister[regSampleNdx].depthPassed	= true; // \note This will stay true if depth test is disabled.
-			}
-			else
-				m_sampleRegister[regSampleNdx].isAlive = false;
-		}
+		initSampleRegister(groupFirstFragNdx, numSamplesPerFragment, inputFragments, numFragments);
 
 		// Scissor test.
 
 		if (state.scissorTestEnabled)
-			executeScissorTest(groupFirstFragNdx, numSamplesPerFragment, inputFragments, state.scissorRectangle);
+			executeScissorTest(state.scissorRectangle);
 
 		// Stencil test.
 
 		if (doStencilTest)
 		{
-			executeStencilCompare(groupFirstFragNdx, numSamplesPerFragment, inputFragments, stencilState, state.numStencilBits, stencilBuffer);
-			executeStencilSFail(groupFirstFragNdx, numSamplesPerFragment, inputFragments, stencilState, state.numStencilBits, stencilBuffer);
+			executeStencilCompare(stencilState, state.numStencilBits, stencilBuffer);
+			executeStencilSFail(stencilState, state.numStencilBits, stencilBuffer);
 		}
 
 		// Depth test.
@@ -820,23 +986,23 @@ void FragmentProcessor::render (const rr::MultisamplePixelBufferAccess&		msColor
 
 		if (doDepthTest)
 		{
-			executeDepthCompare(groupFirstFragNdx, numSamplesPerFragment, inputFragments, state.depthFunc, depthBuffer);
+			executeDepthCompare(inputFragments, state.depthFunc, depthBuffer);
 
 			if (state.depthMask)
-				executeDepthWrite(groupFirstFragNdx, numSamplesPerFragment, inputFragments, depthBuffer);
+				executeDepthWrite(inputFragments, depthBuffer);
 		}
 
 		// Do dpFail and dpPass stencil writes.
 
 		if (doStencilTest)
-			executeStencilDpFailAndPass(groupFirstFragNdx, numSamplesPerFragment, inputFragments, stencilState, state.numStencilBits, stencilBuffer);
+			executeStencilDpFailAndPass(stencilState, state.numStencilBits, stencilBuffer);
 
 		// Kill the samples that failed depth test.
 
 		if (doDepthTest)
 		{
 			for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
-				m_sampleRegister[regSampleNdx].isAlive = m_sampleRegister[regSampleNdx].isAlive && m_sampleRegister[regSampleNdx].depthPassed;
+				m_sampleRegister.isAlive[regSampleNdx] = m_sampleRegister.isAlive[regSampleNdx] && m_sampleRegister.depthPassed[regSampleNdx];
 		}
 
 		// Paint fragments to target
@@ -867,49 +1033,61 @@ void FragmentProcessor::render (const rr::MultisamplePixelBufferAccess&		msColor
 				}
 
 				// Blend calculation - only if using blend.
-				if (state.blendMode == BLENDMODE_STANDARD)
+				if (state.blendMode == BLENDMODE_STANDARD || state.blendMode == BLENDMODE_ADVANCED)
 				{
-					// Put dst color to register, doing srgb-to-linear conversion if needed.
+					const bool useSrc1 = state.blendMode == BLENDMODE_STANDARD;
+
+					// Put src colors to register.
 					for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 					{
-						if (m_sampleRegister[regSampleNdx].isAlive)
+						if (m_sampleRegister.isAlive[regSampleNdx])
 						{
-							int					fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-							const Fragment&		frag			= inputFragments[groupFirstFragNdx + regSampleNdx/numSamplesPerFragment];
-							Vec4				dstColor		= colorBuffer.getPixel(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
+							const Fragment& frag = inputFragments[m_sampleRegister.fragNdx[regSampleNdx]];
 
-							m_sampleRegister[regSampleNdx].clampedBlendSrcColor		= clamp(frag.value.get<float>(), minClampValue, maxClampValue);
-							m_sampleRegister[regSampleNdx].clampedBlendSrc1Color	= clamp(frag.value1.get<float>(), minClampValue, maxClampValue);
-							m_sampleRegister[regSampleNdx].clampedBlendDstColor		= clamp(sRGBTarget ? tcu::sRGBToLinear(dstColor) : dstColor, minClampValue, maxClampValue);
+							for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+							{
+								m_sampleRegister.blendSrc[channelNdx][regSampleNdx]		= frag.value.get<float>()[channelNdx];
+								m_sampleRegister.blendSrc1[channelNdx][regSampleNdx]	= useSrc1 ? frag.value1.get<float>()[channelNdx] : 0.0f;
+							}
+						}
+						else
+						{
+							for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+							{
+								m_sampleRegister.blendSrc[channelNdx][regSampleNdx]		= 0.0f;
+								m_sampleRegister.blendSrc1[channelNdx][regSampleNdx]	= 0.0f;
+							}
 						}
 					}
 
-					// Calculate blend factors to register.
-					executeBlendFactorComputeRGB(state.blendColor, state.blendRGBState);
-					executeBlendFactorComputeA(state.blendColor, state.blendAState);
-
-					// Compute blended color.
-					executeBlend(state.blendRGBState, state.blendAState);
-				}
-				else if (state.blendMode == BLENDMODE_ADVANCED)
-				{
-					// Unpremultiply colors for blending, and do sRGB->linear if necessary
-					// \todo [2014-03-17 pyry] Re-consider clampedBlend*Color var names
-					for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+					for (int channelNdx = 0; channelNdx < 4; channelNdx++)
 					{
-						if (m_sampleRegister[regSampleNdx].isAlive)
+						for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 						{
-							int					fragSampleNdx	= regSampleNdx % numSamplesPerFragment;
-							const Fragment&		frag			= inputFragments[groupFirstFragNdx + regSampleNdx/numSamplesPerFragment];
-							const Vec4			srcColor		= frag.value.get<float>();
-							const Vec4			dstColor		= colorBuffer.getPixel(fragSampleNdx, frag.pixelCoord.x(), frag.pixelCoord.y());
-
-							m_sampleRegister[regSampleNdx].clampedBlendSrcColor		= unpremultiply(clamp(srcColor, minClampValue, maxClampValue));
-							m_sampleRegister[regSampleNdx].clampedBlendDstColor		= unpremultiply(clamp(sRGBTarget ? tcu::sRGBToLinear(dstColor) : dstColor, minClampValue, maxClampValue));
+							m_sampleRegister.blendSrc[channelNdx][regSampleNdx]		= de::clamp(m_sampleRegister.blendSrc[channelNdx][regSampleNdx], minClampValue[channelNdx], maxClampValue[channelNdx]);
+							m_sampleRegister.blendSrc1[channelNdx][regSampleNdx]	= de::clamp(m_sampleRegister.blendSrc1[channelNdx][regSampleNdx], minClampValue[channelNdx], maxClampValue[channelNdx]);
 						}
 					}
 
-					executeAdvancedBlend(state.blendEquationAdvaced);
+					// Put dst color to register, doing srgb-to-linear conversion if needed.
+					executeLoadBlendDstColor(sRGBTarget, minClampValue, maxClampValue, colorBuffer);
+
+					if (state.blendMode == BLENDMODE_STANDARD)
+					{
+						// Calculate blend factors to register.
+						executeBlendFactorCompute(state.blendColor, state.blendRGBState, state.blendAState);
+
+						// Compute blended color.
+						executeBlend(state.blendRGBState, state.blendAState);
+					}
+					else
+					{
+						// Unpremultiply colors for blending.
+						unpremultiply(m_sampleRegister.blendSrc);
+						unpremultiply(m_sampleRegister.blendDst);
+
+						executeAdvancedBlend(state.blendEquationAdvaced);
+					}
 				}
 				else
 				{
@@ -918,26 +1096,20 @@ void FragmentProcessor::render (const rr::MultisamplePixelBufferAccess&		msColor
 
 					for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
 					{
-						if (m_sampleRegister[regSampleNdx].isAlive)
-						{
-							const Fragment& frag = inputFragments[groupFirstFragNdx + regSampleNdx/numSamplesPerFragment];
+						const bool isAlive = m_sampleRegister.isAlive[regSampleNdx];
 
-							m_sampleRegister[regSampleNdx].blendedRGB	= frag.value.get<float>().xyz();
-							m_sampleRegister[regSampleNdx].blendedA		= frag.value.get<float>().w();
-						}
+						for (int channelNdx = 0; channelNdx < 4; channelNdx++)
+							m_sampleRegister.blended[channelNdx][regSampleNdx] = isAlive ? inputFragments[m_sampleRegister.fragNdx[regSampleNdx]].value.get<float>()[channelNdx] : 0.0f;
 					}
 				}
 
 				// Clamp result values in sample register
 				if (colorbufferClass != tcu::TEXTURECHANNELCLASS_FLOATING_POINT)
 				{
-					for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+					for (int channelNdx = 0; channelNdx < 4; channelNdx++)
 					{
-						if (m_sampleRegister[regSampleNdx].isAlive)
-						{
-							m_sampleRegister[regSampleNdx].blendedRGB	= clamp(m_sampleRegister[regSampleNdx].blendedRGB, minClampValue.swizzle(0, 1, 2), maxClampValue.swizzle(0, 1, 2));
-							m_sampleRegister[regSampleNdx].blendedA		= clamp(m_sampleRegister[regSampleNdx].blendedA, minClampValue.w(), maxClampValue.w());
-						}
+						for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
+							m_sampleRegister.blended[channelNdx][regSampleNdx] = de::clamp(m_sampleRegister.blended[channelNdx][regSampleNdx], minClampValue[channelNdx], maxClampValue[channelNdx]);
 					}
 				}
 
@@ -945,45 +1117,29 @@ void FragmentProcessor::render (const rr::MultisamplePixelBufferAccess&		msColor
 
 				if (state.colorMask[0] && state.colorMask[1] && state.colorMask[2] && state.colorMask[3])
 				{
-					if (colorBuffer.getFormat() == tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8))
-						executeRGBA8ColorWrite(groupFirstFragNdx, numSamplesPerFragment, inputFragments, colorBuffer);
+					if (isRGBAFormat(colorBuffer.getFormat(), tcu::TextureFormat::UNORM_INT8))
+						executeRGBA8ColorWrite(colorBuffer);
+					else if (isRGBAFormat(colorBuffer.getFormat(), tcu::TextureFormat::HALF_FLOAT))
+						executeRGBA16FColorWrite(colorBuffer);
+					else if (isRGBAFormat(colorBuffer.getFormat(), tcu::TextureFormat::FLOAT))
+						executeRGBA32FColorWrite(colorBuffer);
 					else
-						executeColorWrite(groupFirstFragNdx, numSamplesPerFragment, inputFragments, sRGBTarget, colorBuffer);
+						executeColorWrite(sRGBTarget, colorBuffer);
 				}
 				else if (state.colorMask[0] || state.colorMask[1] || state.colorMask[2] || state.colorMask[3])
-					executeMaskedColorWrite(groupFirstFragNdx, numSamplesPerFragment, inputFragments, colorMaskFactor, colorMaskNegationFactor, sRGBTarget, colorBuffer);
+					executeMaskedColorWrite(colorMaskFactor, colorMaskNegationFactor, sRGBTarget, colorBuffer);
 				break;
 			}
 			case rr::GENERICVECTYPE_INT32:
 				// Write fragments
-				for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
-				{
-					if (m_sampleRegister[regSampleNdx].isAlive)
-					{
-						const Fragment& frag = inputFragments[groupFirstFragNdx + regSampleNdx/numSamplesPerFragment];
-
-						m_sampleRegister[regSampleNdx].signedValue = frag.value.get<deInt32>();
-					}
-				}
-
 				if (state.colorMask[0] || state.colorMask[1] || state.colorMask[2] || state.colorMask[3])
-					executeSignedValueWrite(groupFirstFragNdx, numSamplesPerFragment, inputFragments, state.colorMask, colorBuffer);
+					executeSignedValueWrite(inputFragments, state.colorMask, colorBuffer);
 				break;
 
 			case rr::GENERICVECTYPE_UINT32:
 				// Write fragments
-				for (int regSampleNdx = 0; regSampleNdx < SAMPLE_REGISTER_SIZE; regSampleNdx++)
-				{
-					if (m_sampleRegister[regSampleNdx].isAlive)
-					{
-						const Fragment& frag = inputFragments[groupFirstFragNdx + regSampleNdx/numSamplesPerFragment];
-
-						m_sampleRegister[regSampleNdx].unsignedValue = frag.value.get<deUint32>();
-					}
-				}
-
 				if (state.colorMask[0] || state.colorMask[1] || state.colorMask[2] || state.colorMask[3])
-					executeUnsignedValueWrite(groupFirstFragNdx, numSamplesPerFragment, inputFragments, state.colorMask, colorBuffer);
+					executeUnsignedValueWrite(inputFragments, state.colorMask, colorBuffer);
 				break;
 
 			default:
@@ -111,44 +111,64 @@ private:
 	{
 		SAMPLE_REGISTER_SIZE = 64
 	};
-	struct SampleData
+
+	/*--------------------------------------------------------------------*//*!
+	 * \brief Sample register in structure-of-arrays layout.
+	 *
+	 * Buffer reads and writes are done per live sample, but tests, blend
+	 * factors and blend equations are evaluated for the whole register in
+	 * branchless loops that the compiler can vectorize. Values of dead
+	 * samples are kept initialized but otherwise meaningless.
+	 *//*--------------------------------------------------------------------*/
+	struct SampleRegister
 	{
-		bool						isAlive;
-		bool						stencilPassed;
-		bool						depthPassed;
-		tcu::Vec4					clampedBlendSrcColor;
-		tcu::Vec4					clampedBlendSrc1Color;
-		tcu::Vec4					clampedBlendDstColor;
-		tcu::Vec3					blendSrcFactorRGB;
-		float						blendSrcFactorA;
-		tcu::Vec3					blendDstFactorRGB;
-		float						blendDstFactorA;
-		tcu::Vec3					blendedRGB;
-		float						blendedA;
-		tcu::Vector<deInt32,  4>	signedValue;		//!< integer targets
-		tcu::Vector<deUint32, 4>	unsignedValue;		//!< unsigned integer targets
+		bool		isAlive				[SAMPLE_REGISTER_SIZE];
+		bool		stencilPassed		[SAMPLE_REGISTER_SIZE];
+		bool		depthPassed			[SAMPLE_REGISTER_SIZE];
+
+		int			fragNdx				[SAMPLE_REGISTER_SIZE];		//!< Index to input fragments.
+		int			fragSampleNdx		[SAMPLE_REGISTER_SIZE];
+		int			pixelX				[SAMPLE_REGISTER_SIZE];
+		int			pixelY				[SAMPLE_REGISTER_SIZE];
+
+		int			stencilBufferValue	[SAMPLE_REGISTER_SIZE];		//!< Read in executeStencilCompare().
+		float		sampleDepth			[SAMPLE_REGISTER_SIZE];		//!< Clamped sample depth for float depth buffers.
+		float		depthBufferValue	[SAMPLE_REGISTER_SIZE];
+		deUint32	sampleDepthUint		[SAMPLE_REGISTER_SIZE];		//!< Sample depth in depth buffer format for other depth buffers.
+		deUint32	depthBufferValueUint[SAMPLE_REGISTER_SIZE];
+
+		float		blendSrc			[4][SAMPLE_REGISTER_SIZE];	//!< Clamped source color, unpremultiplied in advanced blending.
+		float		blendSrc1			[4][SAMPLE_REGISTER_SIZE];
+		float		blendDst			[4][SAMPLE_REGISTER_SIZE];	//!< Clamped, linear destination color.
+		float		blendSrcFactor		[4][SAMPLE_REGISTER_SIZE];
+		float		blendDstFactor		[4][SAMPLE_REGISTER_SIZE];
+		float		blended				[4][SAMPLE_REGISTER_SIZE];
 	};
 
 	// These functions operate on the values in m_sampleRegister and, in some cases, the buffers.
 
-	void		executeScissorTest				(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const WindowRectangle& scissorRect);
-	void		executeStencilCompare			(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const StencilState& stencilState, int numStencilBits, const tcu::ConstPixelBufferAccess& stencilBuffer);
-	void		executeStencilSFail				(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer);
-	void		executeDepthCompare				(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, TestFunc depthFunc, const tcu::ConstPixelBufferAccess& depthBuffer);
-	void		executeDepthWrite				(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::PixelBufferAccess& depthBuffer);
-	void		executeStencilDpFailAndPass		(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer);
-	void		executeBlendFactorComputeRGB	(const tcu::Vec4& blendColor, const BlendState& blendRGBState);
-	void		executeBlendFactorComputeA		(const tcu::Vec4& blendColor, const BlendState& blendAState);
+	void		initSampleRegister				(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, int numFragments);
+	void		executeScissorTest				(const WindowRectangle& scissorRect);
+	void		executeStencilCompare			(const StencilState& stencilState, int numStencilBits, const tcu::ConstPixelBufferAccess& stencilBuffer);
+	void		executeStencilOp				(StencilOp op, const bool* opMask, const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer);
+	void		executeStencilSFail				(const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer);
+	void		executeDepthCompare				(const Fragment* inputFragments, TestFunc depthFunc, const tcu::ConstPixelBufferAccess& depthBuffer);
+	void		executeDepthWrite				(const Fragment* inputFragments, const tcu::PixelBufferAccess& depthBuffer);
+	void		executeStencilDpFailAndPass		(const StencilState& stencilState, int numStencilBits, const tcu::PixelBufferAccess& stencilBuffer);
+	void		executeLoadBlendDstColor		(bool isSRGB, const tcu::Vec4& minClampValue, const tcu::Vec4& maxClampValue, const tcu::ConstPixelBufferAccess& colorBuffer);
+	void		executeBlendFactorCompute		(const tcu::Vec4& blendColor, const BlendState& blendRGBState, const BlendState& blendAState);
 	void		executeBlend					(const BlendState& blendRGBState, const BlendState& blendAState);
 	void		executeAdvancedBlend			(BlendEquationAdvanced equation);
 
-	void		executeColorWrite				(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, bool isSRGB, const tcu::PixelBufferAccess& colorBuffer);
-	void		executeRGBA8ColorWrite			(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::PixelBufferAccess& colorBuffer);
-	void		executeMaskedColorWrite			(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::Vec4& colorMaskFactor, const tcu::Vec4& colorMaskNegationFactor, bool isSRGB, const tcu::PixelBufferAccess& colorBuffer);
-	void		executeSignedValueWrite			(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer);
-	void		executeUnsignedValueWrite		(int fragNdxOffset, int numSamplesPerFragment, const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer);
+	void		executeColorWrite				(bool isSRGB, const tcu::PixelBufferAccess& colorBuffer);
+	void		executeRGBA8ColorWrite			(const tcu::PixelBufferAccess& colorBuffer);
+	void		executeRGBA16FColorWrite		(const tcu::PixelBufferAccess& colorBuffer);
+	void		executeRGBA32FColorWrite		(const tcu::PixelBufferAccess& colorBuffer);
+	void		executeMaskedColorWrite			(const tcu::Vec4& colorMaskFactor, const tcu::Vec4& colorMaskNegationFactor, bool isSRGB, const tcu::PixelBufferAccess& colorBuffer);
+	void		executeSignedValueWrite			(const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer);
+	void		executeUnsignedValueWrite		(const Fragment* inputFragments, const tcu::BVec4& colorMask, const tcu::PixelBufferAccess& colorBuffer);
 
-	SampleData	m_sampleRegister[SAMPLE_REGISTER_SIZE];
+	SampleRegister	m_sampleRegister;
 } DE_WARN_UNUSED_TYPE;
 
 } // rr
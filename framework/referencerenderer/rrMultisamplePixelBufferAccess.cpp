@@ -23,6 +23,7 @@
 
 #include "rrMultisamplePixelBufferAccess.hpp"
 #include "tcuTextureUtil.hpp"
+#include "deParallel.hpp"
 
 namespace rr
 {
@@ -112,30 +113,236 @@ MultisampleConstPixelBufferAccess getSubregion (const MultisampleConstPixelBuffe
 	return MultisampleConstPixelBufferAccess::fromMultisampleAccess(tcu::getSubregion(access.raw(), 0, x, y, access.getNumSamples(), width, height));
 }
 
-void resolveMultisampleColorBuffer (const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src)
+namespace
 {
-	DE_ASSERT(dst.getWidth() == src.raw().getHeight());
-	DE_ASSERT(dst.getHeight() == src.raw().getDepth());
 
-	if (src.getNumSamples() == 1)
+enum
+{
+	PARALLEL_MIN_SAMPLES_PER_THREAD	= 1<<16
+};
+
+//! Resolve function for each pixel row of dst. Rows are resolved in parallel.
+template<typename RowFunc>
+class ResolveRowsTask : public de::RangeTask
+{
+public:
+	ResolveRowsTask (const RowFunc& func)
+		: m_func(func)
 	{
-		// fast-path for non-multisampled cases
-		tcu::copy(dst, src.toSinglesampleAccess());
 	}
-	else
+
+	void execute (int begin, int end)
+	{
+		for (int y = begin; y < end; y++)
+			m_func(y);
+	}
+
+private:
+	const RowFunc	m_func;
+};
+
+template<typename RowFunc>
+void resolveRows (const tcu::ConstPixelBufferAccess& dst, int numSamples, const RowFunc& func)
+{
+	const int					samplesPerRow	= de::max(1, dst.getWidth()*numSamples);
+	ResolveRowsTask<RowFunc>	task			(func);
+
+	if (dst.getHeight() > 0)
+		de::parallelFor(dst.getHeight(), de::max(1, PARALLEL_MIN_SAMPLES_PER_THREAD / samplesPerRow), task);
+}
+
+//! Same values as returned by ConstPixelBufferAccess::getPixel() for UNORM_INT8 channels.
+class Unorm8ToFloatTable
+{
+public:
+	Unorm8ToFloatTable (void)
+	{
+		for (int value = 0; value < DE_LENGTH_OF_ARRAY(m_values); value++)
+			m_values[value] = (float)value / 255.0f;
+	}
+
+	float operator[] (deUint8 value) const { return m_values[value]; }
+
+private:
+	float			m_values[256];
+};
+
+const Unorm8ToFloatTable s_unorm8ToFloat;
+
+struct Unorm8Channel
+{
+	static float	read	(const deUint8* ptr, int channelNdx)	{ return s_unorm8ToFloat[ptr[channelNdx]];						}
+	static void		write	(deUint8* ptr, int channelNdx, float v)	{ ptr[channelNdx] = tcu::floatToU8(v);							}
+};
+
+struct FloatChannel
+{
+	static float	read	(const deUint8* ptr, int channelNdx)	{ return ((const float*)ptr)[channelNdx];						}
+	static void		write	(deUint8* ptr, int channelNdx, float v)	{ ((float*)ptr)[channelNdx] = v;								}
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Average samples of R, RGB or RGBA pixels without format dispatch
+ *
+ * Samples of each pixel are read as a contiguous span. Samples are summed
+ * in the same order and rounded in the same way as by getPixel() and
+ * setPixel(), so results are identical to the generic path.
+ *//*--------------------------------------------------------------------*/
+template<typename Channel, int NumChannels>
+class AverageSamplesRowFunc
+{
+public:
+	AverageSamplesRowFunc (const tcu::PixelBufferAccess& dst, const tcu::ConstPixelBufferAccess& src)
+		: m_dst				(dst)
+		, m_src				(src)
+		, m_numSamplesInv	(1.0f / (float)src.getWidth())
+	{
+	}
+
+	void operator() (int y) const
 	{
-		const float numSamplesInv = 1.0f / (float)src.getNumSamples();
+		const int	numSamples	= m_src.getWidth();
+		const int	samplePitch	= m_src.getPixelPitch();
 
-		for (int y = 0; y < dst.getHeight(); y++)
-		for (int x = 0; x < dst.getWidth(); x++)
+		for (int x = 0; x < m_dst.getWidth(); x++)
+		{
+			const deUint8*	samplePtr	= (const deUint8*)m_src.getPixelPtr(0, x, y);
+			deUint8* const	dstPtr		= (deUint8*)m_dst.getPixelPtr(x, y);
+			float			sum[NumChannels];
+
+			for (int c = 0; c < NumChannels; c++)
+				sum[c] = 0.0f;
+
+			for (int s = 0; s < numSamples; s++)
+			{
+				for (int c = 0; c < NumChannels; c++)
+					sum[c] += Channel::read(samplePtr, c);
+
+				samplePtr += samplePitch;
+			}
+
+			for (int c = 0; c < NumChannels; c++)
+				Channel::write(dstPtr, c, sum[c]*m_numSamplesInv);
+		}
+	}
+
+private:
+	const tcu::PixelBufferAccess		m_dst;
+	const tcu::ConstPixelBufferAccess	m_src;
+	const float							m_numSamplesInv;
+};
+
+class AverageColorGenericRowFunc
+{
+public:
+	AverageColorGenericRowFunc (const tcu::PixelBufferAccess& dst, const tcu::ConstPixelBufferAccess& src)
+		: m_dst				(dst)
+		, m_src				(src)
+		, m_numSamplesInv	(1.0f / (float)src.getWidth())
+	{
+	}
+
+	void operator() (int y) const
+	{
+		for (int x = 0; x < m_dst.getWidth(); x++)
 		{
 			tcu::Vec4 sum;
-			for (int s = 0; s < src.raw().getWidth(); s++)
-				sum += src.raw().getPixel(s, x, y);
+			for (int s = 0; s < m_src.getWidth(); s++)
+				sum += m_src.getPixel(s, x, y);
+
+			m_dst.setPixel(sum*m_numSamplesInv, x, y);
+		}
+	}
+
+private:
+	const tcu::PixelBufferAccess		m_dst;
+	const tcu::ConstPixelBufferAccess	m_src;
+	const float							m_numSamplesInv;
+};
 
-			dst.setPixel(sum*numSamplesInv, x, y);
+class AverageDepthRowFunc
+{
+public:
+	AverageDepthRowFunc (const tcu::PixelBufferAccess& dst, const tcu::ConstPixelBufferAccess& src)
+		: m_dst				(dst)
+		, m_src				(src)
+		, m_numSamplesInv	(1.0f / (float)src.getWidth())
+	{
+	}
+
+	void operator() (int y) const
+	{
+		for (int x = 0; x < m_dst.getWidth(); x++)
+		{
+			float sum = 0.0f;
+			for (int s = 0; s < m_src.getWidth(); s++)
+				sum += m_src.getPixDepth(s, x, y);
+
+			m_dst.setPixDepth(sum*m_numSamplesInv, x, y);
 		}
 	}
+
+private:
+	const tcu::PixelBufferAccess		m_dst;
+	const tcu::ConstPixelBufferAccess	m_src;
+	const float							m_numSamplesInv;
+};
+
+bool isUnorm8Color (const tcu::TextureFormat& format, int numChannels)
+{
+	if (format.type != tcu::TextureFormat::UNORM_INT8)
+		return false;
+
+	if (numChannels == 4)
+		return format.order == tcu::TextureFormat::RGBA || format.order == tcu::TextureFormat::sRGBA;
+	else
+		return format.order == tcu::TextureFormat::RGB || format.order == tcu::TextureFormat::sRGB;
+}
+
+bool isFloatColor (const tcu::TextureFormat& format, int numChannels)
+{
+	return format.type == tcu::TextureFormat::FLOAT && format.order == (numChannels == 4 ? tcu::TextureFormat::RGBA : tcu::TextureFormat::RGB);
+}
+
+} // anonymous
+
+tcu::PixelBufferAccess getSample (const MultisamplePixelBufferAccess& access, int sampleNdx)
+{
+	DE_ASSERT(de::inBounds(sampleNdx, 0, access.getNumSamples()));
+
+	return MultisamplePixelBufferAccess::fromMultisampleAccess(tcu::getSubregion(access.raw(), sampleNdx, 0, 0, 1, access.raw().getHeight(), access.raw().getDepth())).toSinglesampleAccess();
+}
+
+tcu::ConstPixelBufferAccess getSample (const MultisampleConstPixelBufferAccess& access, int sampleNdx)
+{
+	DE_ASSERT(de::inBounds(sampleNdx, 0, access.getNumSamples()));
+
+	return MultisampleConstPixelBufferAccess::fromMultisampleAccess(tcu::getSubregion(access.raw(), sampleNdx, 0, 0, 1, access.raw().getHeight(), access.raw().getDepth())).toSinglesampleAccess();
+}
+
+void resolveMultisampleColorBuffer (const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src)
+{
+	DE_ASSERT(dst.getWidth() == src.raw().getHeight());
+	DE_ASSERT(dst.getHeight() == src.raw().getDepth());
+
+	const tcu::TextureFormat&	srcFormat	= src.raw().getFormat();
+	const tcu::TextureFormat&	dstFormat	= dst.getFormat();
+
+	if (src.getNumSamples() == 1)
+	{
+		// fast-path for non-multisampled cases
+		tcu::copy(dst, src.toSinglesampleAccess());
+	}
+	else if (isUnorm8Color(srcFormat, 4) && isUnorm8Color(dstFormat, 4))
+		resolveRows(dst, src.getNumSamples(), AverageSamplesRowFunc<Unorm8Channel, 4>(dst, src.raw()));
+	else if (isUnorm8Color(srcFormat, 3) && isUnorm8Color(dstFormat, 3))
+		resolveRows(dst, src.getNumSamples(), AverageSamplesRowFunc<Unorm8Channel, 3>(dst, src.raw()));
+	else if (isFloatColor(srcFormat, 4) && isFloatColor(dstFormat, 4))
+		resolveRows(dst, src.getNumSamples(), AverageSamplesRowFunc<FloatChannel, 4>(dst, src.raw()));
+	else if (isFloatColor(srcFormat, 3) && isFloatColor(dstFormat, 3))
+		resolveRows(dst, src.getNumSamples(), AverageSamplesRowFunc<FloatChannel, 3>(dst, src.raw()));
+	else
+		resolveRows(dst, src.getNumSamples(), AverageColorGenericRowFunc(dst, src.raw()));
 }
 
 void resolveMultisampleDepthBuffer (const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src)
@@ -151,20 +358,10 @@ void resolveMultisampleDepthBuffer (const tcu::PixelBufferAccess& dst, const Mul
 		// fast-path for non-multisampled cases
 		tcu::copy(effectiveDst, MultisampleConstPixelBufferAccess::fromMultisampleAccess(effectiveSrc).toSinglesampleAccess());
 	}
+	else if (effectiveSrc.getFormat().type == tcu::TextureFormat::FLOAT && effectiveDst.getFormat().type == tcu::TextureFormat::FLOAT)
+		resolveRows(effectiveDst, src.getNumSamples(), AverageSamplesRowFunc<FloatChannel, 1>(effectiveDst, effectiveSrc));
 	else
-	{
-		const float numSamplesInv = 1.0f / (float)src.getNumSamples();
-
-		for (int y = 0; y < dst.getHeight(); y++)
-		for (int x = 0; x < dst.getWidth(); x++)
-		{
-			float sum = 0.0f;
-			for (int s = 0; s < src.getNumSamples(); s++)
-				sum += effectiveSrc.getPixDepth(s, x, y);
-
-			effectiveDst.setPixDepth(sum*numSamplesInv, x, y);
-		}
-	}
+		resolveRows(effectiveDst, src.getNumSamples(), AverageDepthRowFunc(effectiveDst, effectiveSrc));
 }
 
 void resolveMultisampleStencilBuffer (const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src)
@@ -175,18 +372,8 @@ void resolveMultisampleStencilBuffer (const tcu::PixelBufferAccess& dst, const M
 	const tcu::ConstPixelBufferAccess	effectiveSrc = tcu::getEffectiveDepthStencilAccess(src.raw(), tcu::Sampler::MODE_STENCIL);
 	const tcu::PixelBufferAccess		effectiveDst = tcu::getEffectiveDepthStencilAccess(dst, tcu::Sampler::MODE_STENCIL);
 
-	if (src.getNumSamples() == 1)
-	{
-		// fast-path for non-multisampled cases
-		tcu::copy(effectiveDst, MultisampleConstPixelBufferAccess::fromMultisampleAccess(effectiveSrc).toSinglesampleAccess());
-	}
-	else
-	{
-		// Resolve by selecting one
-		for (int y = 0; y < dst.getHeight(); y++)
-		for (int x = 0; x < dst.getWidth(); x++)
-			effectiveDst.setPixStencil(effectiveSrc.getPixStencil(0, x, y), x, y);
-	}
+	// Resolve by selecting one. Also covers non-multisampled case.
+	tcu::copy(effectiveDst, getSample(MultisampleConstPixelBufferAccess::fromMultisampleAccess(effectiveSrc), 0));
 }
 
 void resolveMultisampleBuffer (const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src)
@@ -89,6 +89,10 @@ private:
 MultisamplePixelBufferAccess		getSubregion					(const MultisamplePixelBufferAccess& access, int x, int y, int width, int height);
 MultisampleConstPixelBufferAccess	getSubregion					(const MultisampleConstPixelBufferAccess& access, int x, int y, int width, int height);
 
+//! Single-sampled view to one sample of each pixel.
+tcu::PixelBufferAccess				getSample						(const MultisamplePixelBufferAccess& access, int sampleNdx);
+tcu::ConstPixelBufferAccess			getSample						(const MultisampleConstPixelBufferAccess& access, int sampleNdx);
+
 void								resolveMultisampleColorBuffer	(const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src);
 void								resolveMultisampleDepthBuffer	(const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src);
 void								resolveMultisampleStencilBuffer	(const tcu::PixelBufferAccess& dst, const MultisampleConstPixelBufferAccess& src);
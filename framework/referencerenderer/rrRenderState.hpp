@@ -79,6 +79,7 @@ struct RasterizationState
 		, horizontalFill		(FILL_LEFT)
 		, verticalFill			(FILL_BOTTOM)
 		, viewportOrientation	(VIEWPORTORIENTATION_LAST)
+		, clipToScissor			(false)
 	{
 	}
 
@@ -86,6 +87,7 @@ struct RasterizationState
 	HorizontalFill			horizontalFill;
 	VerticalFill			verticalFill;
 	ViewportOrientation		viewportOrientation;
+	bool					clipToScissor;			//!< Don't rasterize fragments outside enabled scissor rectangle. Changes 2x2 quad alignment, and thus derivatives, of clipped primitives.
 };
 
 enum TestFunc
@@ -25,12 +25,14 @@
 #include "tcuVectorUtil.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuInstrumentation.hpp"
 #include "rrPrimitiveAssembler.hpp"
 #include "rrFragmentOperations.hpp"
 #include "rrRasterizer.hpp"
 #include "deMemory.h"
 
 #include <set>
+#include <algorithm>
 
 namespace rr
 {
@@ -1293,7 +1295,13 @@ void rasterize (const RenderState&					state,
 
 	const tcu::IVec4				viewportRect		= tcu::IVec4(state.viewport.rect.left, state.viewport.rect.bottom, state.viewport.rect.width, state.viewport.rect.height);
 	const tcu::IVec4				bufferRect			= getBufferSize(renderTarget.getColorBuffer(0));
-	const tcu::IVec4				renderTargetRect	= rectIntersection(viewportRect, bufferRect);
+	const tcu::IVec4				scissorRect			= (state.fragOps.scissorTestEnabled && state.rasterization.clipToScissor)
+														? tcu::IVec4(state.fragOps.scissorRectangle.left, state.fragOps.scissorRectangle.bottom, state.fragOps.scissorRectangle.width, state.fragOps.scissorRectangle.height)
+														: bufferRect;
+	const tcu::IVec4				renderTargetRect	= rectIntersection(rectIntersection(viewportRect, bufferRect), scissorRect);
+
+	if (renderTargetRect.z() <= 0 || renderTargetRect.w() <= 0)
+		return;
 
 	// shared buffers for all primitives
 	std::vector<FragmentPacket>		fragmentPackets		(maxFragmentPackets);
@@ -1641,6 +1649,99 @@ bool isValidCommand (const DrawCommand& command, int numInstances)
 	return true;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Post-transform vertex cache
+ *
+ * Maps draw elements to unique vertex indices so that each unique vertex
+ * is shaded only once per instance. Restart elements split the element
+ * list into segments that are drawn separately.
+ *
+ * Downstream stages modify vertex packets in place, so shaded vertices
+ * can be handed out directly only if the draw consists of a single
+ * segment. Otherwise each segment gets copies of the shaded vertices.
+ *//*--------------------------------------------------------------------*/
+class VertexCache
+{
+public:
+	struct Segment
+	{
+		size_t	begin;
+		size_t	end;
+	};
+
+							VertexCache			(const DrawCommand& command);
+
+	size_t					getNumVertices		(void) const	{ return m_vertexIndices.size();	}
+	size_t					getNumReferences	(void) const	{ return m_numReferences;			}
+	const Segment*			getSegments			(void) const	{ return m_segments.empty() ? DE_NULL : &m_segments[0];	}
+	size_t					getNumSegments		(void) const	{ return m_segments.size();			}
+
+	int						getVertexIndex		(size_t vertexNdx) const	{ return m_vertexIndices[vertexNdx];	}
+	size_t					getElementVertex	(size_t elementNdx) const	{ return m_elementVertices[elementNdx];	}
+
+private:
+	std::vector<int>		m_vertexIndices;	//!< Unique vertex indices.
+	std::vector<size_t>		m_elementVertices;	//!< Element to unique vertex mapping.
+	std::vector<Segment>	m_segments;
+	size_t					m_numReferences;
+};
+
+VertexCache::VertexCache (const DrawCommand& command)
+	: m_elementVertices	(command.primitives.getNumElements(), 0)
+	, m_numReferences	(0)
+{
+	const PrimitiveList&						primitives		= command.primitives;
+	const bool									checkRestart	= command.state.restart.enabled;
+	std::vector<std::pair<size_t, size_t> >		indexElements;	// (vertex index, element) pairs
+
+	indexElements.reserve(primitives.getNumElements());
+
+	for (size_t elementNdx = 0; elementNdx < primitives.getNumElements(); ++elementNdx)
+	{
+		Segment segment;
+
+		segment.begin = elementNdx;
+
+		while (elementNdx < primitives.getNumElements() && !(checkRestart && primitives.isRestartIndex(elementNdx, command.state.restart.restartIndex)))
+		{
+			indexElements.push_back(std::make_pair(primitives.getIndex(elementNdx), elementNdx));
+			++elementNdx;
+		}
+
+		segment.end = elementNdx;
+
+		// Duplicated restart
+		if (segment.begin != segment.end)
+			m_segments.push_back(segment);
+	}
+
+	m_numReferences = indexElements.size();
+
+	// Non-indexed draws never reference same vertex twice
+	if (primitives.isIndexed())
+		std::sort(indexElements.begin(), indexElements.end());
+
+	for (size_t ndx = 0; ndx < indexElements.size(); ++ndx)
+	{
+		if (ndx == 0 || indexElements[ndx].first != indexElements[ndx-1].first)
+			m_vertexIndices.push_back((int)indexElements[ndx].first);
+
+		m_elementVertices[indexElements[ndx].second] = m_vertexIndices.size() - 1;
+	}
+}
+
+void copyVertexPacket (VertexPacket* dst, const VertexPacket* src, size_t numVertexOutputs)
+{
+	dst->instanceNdx	= src->instanceNdx;
+	dst->vertexNdx		= src->vertexNdx;
+	dst->position		= src->position;
+	dst->pointSize		= src->pointSize;
+	dst->primitiveID	= src->primitiveID;
+
+	for (size_t outputNdx = 0; outputNdx < numVertexOutputs; ++outputNdx)
+		dst->outputs[outputNdx] = src->outputs[outputNdx];
+}
+
 } // anonymous
 
 RenderTarget::RenderTarget (const MultisamplePixelBufferAccess& colorMultisampleBuffer,
@@ -1746,6 +1847,14 @@ void Renderer::draw (const DrawCommand& command) const
 
 void Renderer::drawInstanced (const DrawCommand& command, int numInstances) const
 {
+	DrawStatistics stats;
+	drawInstanced(command, numInstances, stats);
+}
+
+void Renderer::drawInstanced (const DrawCommand& command, int numInstances, DrawStatistics& stats) const
+{
+	const tcu::InstrumentationScope scope ("rr::Renderer::draw");
+
 	// Do not run bad commands
 	{
 		const bool validCommand = isValidCommand(command, numInstances);
@@ -1764,46 +1873,77 @@ void Renderer::drawInstanced (const DrawCommand& command, int numInstances) cons
 
 	// Prepare transformation
 
-	const size_t				numVaryings = command.program.vertexShader->getOutputs().size();
-	VertexPacketAllocator		vpalloc(numVaryings);
-	std::vector<VertexPacket*>	vertexPackets = vpalloc.allocArray(command.primitives.getNumElements());
+	const size_t				numVaryings			= command.program.vertexShader->getOutputs().size();
+	const VertexCache			vertexCache			(command);
+	const bool					copyVertices		= vertexCache.getNumSegments() > 1;
+	VertexPacketAllocator		vpalloc				(numVaryings);
+	std::vector<VertexPacket*>	shadedPackets		= vpalloc.allocArray(vertexCache.getNumVertices());
+	std::vector<VertexPacket*>	segmentPackets		= copyVertices ? vpalloc.allocArray(vertexCache.getNumVertices()) : std::vector<VertexPacket*>();
+	std::vector<VertexPacket*>	vertexPackets		(command.primitives.getNumElements());
+	std::vector<int>			segmentVertexCopies	(copyVertices ? vertexCache.getNumVertices() : 0, -1);
 	DrawContext					drawContext;
 
+	if (vertexCache.getNumVertices() == 0)
+		return;
+
+	stats.numVertexReferences	+= (deUint64)vertexCache.getNumReferences() * (deUint64)numInstances;
+	stats.numShadedVertices		+= (deUint64)vertexCache.getNumVertices() * (deUint64)numInstances;
+
 	for (int instanceID = 0; instanceID < numInstances; ++instanceID)
 	{
 		// Each instance has its own primitives
 		drawContext.primitiveID = 0;
 
-		for (size_t elementNdx = 0; elementNdx < command.primitives.getNumElements(); ++elementNdx)
+		// Transform unique vertices
+
+		for (size_t vertexNdx = 0; vertexNdx < vertexCache.getNumVertices(); ++vertexNdx)
 		{
-			int numVertexPackets = 0;
+			// input
+			shadedPackets[vertexNdx]->instanceNdx	= instanceID;
+			shadedPackets[vertexNdx]->vertexNdx		= vertexCache.getVertexIndex(vertexNdx);
 
-			// collect primitive vertices until restart
+			// output
+			shadedPackets[vertexNdx]->pointSize		= command.state.point.pointSize;	// default value from the current state
+			shadedPackets[vertexNdx]->position		= tcu::Vec4(0, 0, 0, 0);			// no undefined values
+		}
 
-			while (elementNdx < command.primitives.getNumElements() &&
-					!(command.state.restart.enabled && command.primitives.isRestartIndex(elementNdx, command.state.restart.restartIndex)))
-			{
-				// input
-				vertexPackets[numVertexPackets]->instanceNdx	= instanceID;
-				vertexPackets[numVertexPackets]->vertexNdx		= (int)command.primitives.getIndex(elementNdx);
+		command.program.vertexShader->shadeVertices(command.vertexAttribs, &shadedPackets[0], (int)shadedPackets.size());
+		stats.numShadeBatches += 1;
 
-				// output
-				vertexPackets[numVertexPackets]->pointSize		= command.state.point.pointSize;	// default value from the current state
-				vertexPackets[numVertexPackets]->position		= tcu::Vec4(0, 0, 0, 0);			// no undefined values
+		for (size_t segmentNdx = 0; segmentNdx < vertexCache.getNumSegments(); ++segmentNdx)
+		{
+			const VertexCache::Segment&	segment				= vertexCache.getSegments()[segmentNdx];
+			const int					numVertexPackets	= (int)(segment.end - segment.begin);
+			int							numSegmentCopies	= 0;
 
-				++numVertexPackets;
-				++elementNdx;
-			}
+			// collect primitive vertices
 
-			// Duplicated restart shade
-			if (numVertexPackets == 0)
-				continue;
+			for (size_t elementNdx = segment.begin; elementNdx < segment.end; ++elementNdx)
+			{
+				const size_t	vertexNdx	= vertexCache.getElementVertex(elementNdx);
+				VertexPacket*&	packet		= vertexPackets[elementNdx - segment.begin];
 
-			// \todo Vertex cache?
+				if (!copyVertices)
+					packet = shadedPackets[vertexNdx];
+				else
+				{
+					int& copyNdx = segmentVertexCopies[vertexNdx];
 
-			// Transform vertices
+					if (copyNdx < 0)
+					{
+						copyNdx = numSegmentCopies++;
+						copyVertexPacket(segmentPackets[copyNdx], shadedPackets[vertexNdx], numVaryings);
+					}
 
-			command.program.vertexShader->shadeVertices(command.vertexAttribs, &vertexPackets[0], numVertexPackets);
+					packet = segmentPackets[copyNdx];
+				}
+			}
+
+			if (copyVertices)
+			{
+				for (size_t elementNdx = segment.begin; elementNdx < segment.end; ++elementNdx)
+					segmentVertexCopies[vertexCache.getElementVertex(elementNdx)] = -1;
+			}
 
 			// Draw primitives
 
@@ -97,6 +97,7 @@ public:
 	inline size_t			getNumElements		(void) const	{ return m_numElements;		}
 	inline PrimitiveType	getPrimitiveType	(void) const	{ return m_primitiveType;	}
 	inline IndexType		getIndexType		(void) const	{ return m_indexType;		}
+	inline bool				isIndexed			(void) const	{ return m_indices != DE_NULL;	}
 
 private:
 	const PrimitiveType		m_primitiveType;
@@ -129,6 +130,27 @@ public:
 	const PrimitiveList&		primitives;
 } DE_WARN_UNUSED_TYPE;
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Vertex processing statistics
+ *
+ * Each unique vertex referenced by a draw is shaded once per instance,
+ * so numVertexReferences - numShadedVertices is the number of vertex
+ * cache hits. Statistics are accumulated over draw calls.
+ *//*--------------------------------------------------------------------*/
+struct DrawStatistics
+{
+	deUint64		numVertexReferences;	//!< Vertices referenced by primitives, excluding restart indices.
+	deUint64		numShadedVertices;		//!< Vertex shader invocations.
+	deUint64		numShadeBatches;		//!< Calls to VertexShader::shadeVertices().
+
+	DrawStatistics (void)
+		: numVertexReferences	(0)
+		, numShadedVertices		(0)
+		, numShadeBatches		(0)
+	{
+	}
+};
+
 class Renderer
 {
 public:
@@ -137,6 +159,7 @@ public:
 
 	void			draw			(const DrawCommand& command) const;
 	void			drawInstanced	(const DrawCommand& command, int numInstances) const;
+	void			drawInstanced	(const DrawCommand& command, int numInstances, DrawStatistics& stats) const;
 } DE_WARN_UNUSED_TYPE;
 
 } // rr
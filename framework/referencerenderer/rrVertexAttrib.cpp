@@ -22,10 +22,13 @@
  *//*--------------------------------------------------------------------*/
 
 #include "rrVertexAttrib.hpp"
+#include "rrVertexPacket.hpp"
 #include "tcuFloat.hpp"
 #include "deInt32.h"
 #include "deMemory.h"
 
+#include <algorithm>
+
 namespace rr
 {
 
@@ -456,6 +459,139 @@ int getComponentSize (const VertexAttribType type)
 	}
 }
 
+// batch readers
+
+template<int Size, typename DstScalarType, void (*Read)(tcu::Vector<DstScalarType, 4>&, const int, const void*)>
+inline void readSized (tcu::Vector<DstScalarType, 4>& dst, const int, const void* ptr)
+{
+	Read(dst, Size, ptr);
+}
+
+template<typename DstScalarType, void (*Read)(tcu::Vector<DstScalarType, 4>&, const int, const void*)>
+void readElements (tcu::Vector<DstScalarType, 4>* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	const int							compSize	= getComponentSize(vertexAttrib.type);
+	const int							stride		= (vertexAttrib.stride != 0) ? (vertexAttrib.stride) : (vertexAttrib.size*compSize);
+	const deUint8* const				basePtr		= (const deUint8*)vertexAttrib.pointer;
+	const tcu::Vector<DstScalarType, 4>	defaults	(0, 0, 0, 1);
+
+	for (int ndx = 0; ndx < count; ndx++)
+	{
+		const int elementNdx = (vertexAttrib.instanceDivisor != 0) ? (instanceNdx[ndx] / vertexAttrib.instanceDivisor) : vertexNdx[ndx];
+
+		dst[ndx] = defaults;
+		Read(dst[ndx], vertexAttrib.size, basePtr + elementNdx*stride);
+	}
+}
+
+// Component count known at compile time lets the compiler unroll and vectorize the conversion.
+template<typename DstScalarType, void (*Read)(tcu::Vector<DstScalarType, 4>&, const int, const void*)>
+void readElementsSized (tcu::Vector<DstScalarType, 4>* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	switch (vertexAttrib.size)
+	{
+		case 1:		readElements<DstScalarType, &readSized<1, DstScalarType, Read> >	(dst, vertexAttrib, instanceNdx, vertexNdx, count);	break;
+		case 2:		readElements<DstScalarType, &readSized<2, DstScalarType, Read> >	(dst, vertexAttrib, instanceNdx, vertexNdx, count);	break;
+		case 3:		readElements<DstScalarType, &readSized<3, DstScalarType, Read> >	(dst, vertexAttrib, instanceNdx, vertexNdx, count);	break;
+		case 4:		readElements<DstScalarType, &readSized<4, DstScalarType, Read> >	(dst, vertexAttrib, instanceNdx, vertexNdx, count);	break;
+		default:	readElements<DstScalarType, Read>									(dst, vertexAttrib, instanceNdx, vertexNdx, count);	break;
+	}
+}
+
+#define READ_ELEMENTS(DST_SCALAR_TYPE, FUNC)		readElements<DST_SCALAR_TYPE, FUNC>(dst, vertexAttrib, instanceNdx, vertexNdx, count)
+#define READ_ELEMENTS_SIZED(DST_SCALAR_TYPE, FUNC)	readElementsSized<DST_SCALAR_TYPE, FUNC>(dst, vertexAttrib, instanceNdx, vertexNdx, count)
+
+void readFloatElements (tcu::Vec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	switch (vertexAttrib.type)
+	{
+		case VERTEXATTRIBTYPE_FLOAT:									READ_ELEMENTS_SIZED	(float, &read<float>);						break;
+		case VERTEXATTRIBTYPE_HALF:										READ_ELEMENTS_SIZED	(float, &readHalf);							break;
+		case VERTEXATTRIBTYPE_FIXED:									READ_ELEMENTS		(float, &readFixed);						break;
+		case VERTEXATTRIBTYPE_DOUBLE:									READ_ELEMENTS		(float, &readDouble);						break;
+		case VERTEXATTRIBTYPE_NONPURE_UNORM8:							READ_ELEMENTS_SIZED	(float, &readUnorm<deUint8>);				break;
+		case VERTEXATTRIBTYPE_NONPURE_UNORM16:							READ_ELEMENTS		(float, &readUnorm<deUint16>);				break;
+		case VERTEXATTRIBTYPE_NONPURE_UNORM32:							READ_ELEMENTS		(float, &readUnorm<deUint32>);				break;
+		case VERTEXATTRIBTYPE_NONPURE_UNORM_2_10_10_10_REV:				READ_ELEMENTS		(float, &readUnorm2101010Rev);				break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM8_CLAMP:						READ_ELEMENTS		(float, &readSnormClamp<deInt8>);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM16_CLAMP:					READ_ELEMENTS		(float, &readSnormClamp<deInt16>);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM32_CLAMP:					READ_ELEMENTS		(float, &readSnormClamp<deInt32>);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM_2_10_10_10_REV_CLAMP:		READ_ELEMENTS		(float, &readSnorm2101010RevClamp);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM8_SCALE:						READ_ELEMENTS		(float, &readSnormScale<deInt8>);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM16_SCALE:					READ_ELEMENTS		(float, &readSnormScale<deInt16>);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM32_SCALE:					READ_ELEMENTS		(float, &readSnormScale<deInt32>);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM_2_10_10_10_REV_SCALE:		READ_ELEMENTS		(float, &readSnorm2101010RevScale);			break;
+		case VERTEXATTRIBTYPE_NONPURE_UINT8:							READ_ELEMENTS		(float, &read<deUint8>);					break;
+		case VERTEXATTRIBTYPE_NONPURE_UINT16:							READ_ELEMENTS		(float, &read<deUint16>);					break;
+		case VERTEXATTRIBTYPE_NONPURE_UINT32:							READ_ELEMENTS		(float, &read<deUint32>);					break;
+		case VERTEXATTRIBTYPE_NONPURE_INT8:								READ_ELEMENTS		(float, &read<deInt8>);						break;
+		case VERTEXATTRIBTYPE_NONPURE_INT16:							READ_ELEMENTS		(float, &read<deInt16>);					break;
+		case VERTEXATTRIBTYPE_NONPURE_INT32:							READ_ELEMENTS		(float, &read<deInt32>);					break;
+		case VERTEXATTRIBTYPE_NONPURE_UINT_2_10_10_10_REV:				READ_ELEMENTS		(float, &readUint2101010Rev);				break;
+		case VERTEXATTRIBTYPE_NONPURE_INT_2_10_10_10_REV:				READ_ELEMENTS		(float, &readInt2101010Rev);				break;
+		case VERTEXATTRIBTYPE_NONPURE_UNORM8_BGRA:						READ_ELEMENTS		(float, &readUnormBGRA<deUint8>);			break;
+		case VERTEXATTRIBTYPE_NONPURE_UNORM_2_10_10_10_REV_BGRA:		READ_ELEMENTS		(float, &readUnorm2101010RevBGRA);			break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM_2_10_10_10_REV_CLAMP_BGRA:	READ_ELEMENTS		(float, &readSnorm2101010RevClampBGRA);		break;
+		case VERTEXATTRIBTYPE_NONPURE_SNORM_2_10_10_10_REV_SCALE_BGRA:	READ_ELEMENTS		(float, &readSnorm2101010RevScaleBGRA);		break;
+
+		default:
+			// Invalid reads are reported by the per-element path
+			for (int ndx = 0; ndx < count; ndx++)
+				readVertexAttrib(dst[ndx], vertexAttrib, instanceNdx[ndx], vertexNdx[ndx]);
+	}
+}
+
+void readIntElements (tcu::IVec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	switch (vertexAttrib.type)
+	{
+		case VERTEXATTRIBTYPE_PURE_INT8:				READ_ELEMENTS_SIZED	(deInt32, &read<deInt8>);	break;
+		case VERTEXATTRIBTYPE_PURE_INT16:				READ_ELEMENTS_SIZED	(deInt32, &read<deInt16>);	break;
+		case VERTEXATTRIBTYPE_PURE_INT32:				READ_ELEMENTS_SIZED	(deInt32, &read<deInt32>);	break;
+
+		default:
+			for (int ndx = 0; ndx < count; ndx++)
+				readVertexAttrib(dst[ndx], vertexAttrib, instanceNdx[ndx], vertexNdx[ndx]);
+	}
+}
+
+void readUintElements (tcu::UVec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	switch (vertexAttrib.type)
+	{
+		case VERTEXATTRIBTYPE_PURE_UINT8:				READ_ELEMENTS_SIZED	(deUint32, &read<deUint8>);		break;
+		case VERTEXATTRIBTYPE_PURE_UINT16:				READ_ELEMENTS_SIZED	(deUint32, &read<deUint16>);	break;
+		case VERTEXATTRIBTYPE_PURE_UINT32:				READ_ELEMENTS_SIZED	(deUint32, &read<deUint32>);	break;
+
+		default:
+			for (int ndx = 0; ndx < count; ndx++)
+				readVertexAttrib(dst[ndx], vertexAttrib, instanceNdx[ndx], vertexNdx[ndx]);
+	}
+}
+
+#undef READ_ELEMENTS
+#undef READ_ELEMENTS_SIZED
+
+template<typename DstType>
+void readPacketAttribs (DstType* dst, const VertexAttrib& vertexAttrib, const VertexPacket* const* packets, const int numPackets)
+{
+	int instanceNdx	[VERTEX_ATTRIB_BATCH_SIZE];
+	int vertexNdx	[VERTEX_ATTRIB_BATCH_SIZE];
+
+	for (int batchStart = 0; batchStart < numPackets; batchStart += VERTEX_ATTRIB_BATCH_SIZE)
+	{
+		const int batchSize = de::min<int>(VERTEX_ATTRIB_BATCH_SIZE, numPackets - batchStart);
+
+		for (int ndx = 0; ndx < batchSize; ndx++)
+		{
+			instanceNdx[ndx]	= packets[batchStart + ndx]->instanceNdx;
+			vertexNdx[ndx]		= packets[batchStart + ndx]->vertexNdx;
+		}
+
+		readVertexAttribs(dst + batchStart, vertexAttrib, instanceNdx, vertexNdx, batchSize);
+	}
+}
+
 } // anonymous
 
 bool isValidVertexAttrib (const VertexAttrib& vertexAttrib)
@@ -545,4 +681,79 @@ void readVertexAttrib (tcu::UVec4& dst, const VertexAttrib& vertexAttrib, const
 	}
 }
 
+void readVertexAttribs (tcu::Vec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	DE_ASSERT(isValidVertexAttrib(vertexAttrib));
+
+	if (vertexAttrib.pointer)
+		readFloatElements(dst, vertexAttrib, instanceNdx, vertexNdx, count);
+	else
+		std::fill(dst, dst + count, vertexAttrib.generic.get<float>());
+}
+
+void readVertexAttribs (tcu::IVec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	DE_ASSERT(isValidVertexAttrib(vertexAttrib));
+
+	if (vertexAttrib.pointer)
+		readIntElements(dst, vertexAttrib, instanceNdx, vertexNdx, count);
+	else
+		std::fill(dst, dst + count, vertexAttrib.generic.get<deInt32>());
+}
+
+void readVertexAttribs (tcu::UVec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count)
+{
+	DE_ASSERT(isValidVertexAttrib(vertexAttrib));
+
+	if (vertexAttrib.pointer)
+		readUintElements(dst, vertexAttrib, instanceNdx, vertexNdx, count);
+	else
+		std::fill(dst, dst + count, vertexAttrib.generic.get<deUint32>());
+}
+
+void readVertexAttribs (tcu::Vec4* dst, const VertexAttrib& vertexAttrib, const VertexPacket* const* packets, const int numPackets)
+{
+	readPacketAttribs(dst, vertexAttrib, packets, numPackets);
+}
+
+void readVertexAttribs (tcu::IVec4* dst, const VertexAttrib& vertexAttrib, const VertexPacket* const* packets, const int numPackets)
+{
+	readPacketAttribs(dst, vertexAttrib, packets, numPackets);
+}
+
+void readVertexAttribs (tcu::UVec4* dst, const VertexAttrib& vertexAttrib, const VertexPacket* const* packets, const int numPackets)
+{
+	readPacketAttribs(dst, vertexAttrib, packets, numPackets);
+}
+
+void readVertexAttribsToPosition (const VertexAttrib& vertexAttrib, VertexPacket* const* packets, const int numPackets)
+{
+	tcu::Vec4 values[VERTEX_ATTRIB_BATCH_SIZE];
+
+	for (int batchStart = 0; batchStart < numPackets; batchStart += VERTEX_ATTRIB_BATCH_SIZE)
+	{
+		const int batchSize = de::min<int>(VERTEX_ATTRIB_BATCH_SIZE, numPackets - batchStart);
+
+		readPacketAttribs(values, vertexAttrib, packets + batchStart, batchSize);
+
+		for (int ndx = 0; ndx < batchSize; ndx++)
+			packets[batchStart + ndx]->position = values[ndx];
+	}
+}
+
+void readVertexAttribsToOutput (const VertexAttrib& vertexAttrib, const int outputNdx, VertexPacket* const* packets, const int numPackets)
+{
+	tcu::Vec4 values[VERTEX_ATTRIB_BATCH_SIZE];
+
+	for (int batchStart = 0; batchStart < numPackets; batchStart += VERTEX_ATTRIB_BATCH_SIZE)
+	{
+		const int batchSize = de::min<int>(VERTEX_ATTRIB_BATCH_SIZE, numPackets - batchStart);
+
+		readPacketAttribs(values, vertexAttrib, packets + batchStart, batchSize);
+
+		for (int ndx = 0; ndx < batchSize; ndx++)
+			packets[batchStart + ndx]->outputs[outputNdx] = values[ndx];
+	}
+}
+
 } // rr
@@ -30,6 +30,8 @@
 namespace rr
 {
 
+struct VertexPacket;
+
 enum VertexAttribType
 {
 	// Can only be read as floats
@@ -152,6 +154,34 @@ void		readVertexAttrib		(tcu::Vec4& dst, const VertexAttrib& vertexAttrib, const
 void		readVertexAttrib		(tcu::IVec4& dst, const VertexAttrib& vertexAttrib, const int instanceNdx, const int vertexNdx);
 void		readVertexAttrib		(tcu::UVec4& dst, const VertexAttrib& vertexAttrib, const int instanceNdx, const int vertexNdx);
 
+enum
+{
+	VERTEX_ATTRIB_BATCH_SIZE	= 64	//!< Vertices per readVertexAttribs() call when reading into fixed-size buffers.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read vertex attribute for multiple vertices
+ *
+ * Equivalent to calling readVertexAttrib() for each (instanceNdx[i],
+ * vertexNdx[i]) pair, but the component converter is resolved only
+ * once per call. Common float, half and unorm8 layouts are read with
+ * fixed-size loops.
+ *//*--------------------------------------------------------------------*/
+void		readVertexAttribs		(tcu::Vec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count);
+void		readVertexAttribs		(tcu::IVec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count);
+void		readVertexAttribs		(tcu::UVec4* dst, const VertexAttrib& vertexAttrib, const int* instanceNdx, const int* vertexNdx, const int count);
+
+// Batch read using indices stored in vertex packets.
+
+void		readVertexAttribs		(tcu::Vec4* dst, const VertexAttrib& vertexAttrib, const VertexPacket* const* packets, const int numPackets);
+void		readVertexAttribs		(tcu::IVec4* dst, const VertexAttrib& vertexAttrib, const VertexPacket* const* packets, const int numPackets);
+void		readVertexAttribs		(tcu::UVec4* dst, const VertexAttrib& vertexAttrib, const VertexPacket* const* packets, const int numPackets);
+
+// Batch read float attribute directly into vertex packet position or output. Helpers for pass-through vertex shaders.
+
+void		readVertexAttribsToPosition	(const VertexAttrib& vertexAttrib, VertexPacket* const* packets, const int numPackets);
+void		readVertexAttribsToOutput	(const VertexAttrib& vertexAttrib, const int outputNdx, VertexPacket* const* packets, const int numPackets);
+
 // Helpers that return by value (trivial for compiler to optimize).
 
 inline tcu::Vec4 readVertexAttribFloat (const VertexAttrib& vertexAttrib, const int instanceNdx, const int vertexNdx)
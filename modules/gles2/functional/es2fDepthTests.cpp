@@ -87,8 +87,7 @@ void DepthShader::setColor (sglr::Context& ctx, deUint32 programID, const tcu::V
 
 void DepthShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-		packets[packetNdx]->position = rr::readVertexAttribFloat(inputs[0], packets[packetNdx]->instanceNdx, packets[packetNdx]->vertexNdx);
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
 }
 
 void DepthShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -136,13 +136,8 @@ public:
 
 	void shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 	{
-		for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-		{
-			rr::VertexPacket& packet = *packets[packetNdx];
-
-			packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-			packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-		}
+		rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+		rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 	}
 
 	void shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -196,13 +191,8 @@ public:
 
 	void shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 	{
-		for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-		{
-			rr::VertexPacket& packet = *packets[packetNdx];
-
-			packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-			packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-		}
+		rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+		rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 	}
 
 	void shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -278,13 +268,8 @@ public:
 
 	void shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 	{
-		for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-		{
-			rr::VertexPacket& packet = *packets[packetNdx];
-
-			packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-			packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-		}
+		rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+		rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 	}
 
 	void shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -24,6 +24,7 @@
 #include "es3fApiCase.hpp"
 #include "gluStrUtil.hpp"
 #include "gluRenderContext.hpp"
+#include "tcuCommandLine.hpp"
 
 #include <algorithm>
 
@@ -55,15 +56,41 @@ ApiCase::IterateResult ApiCase::iterate (void)
 	// Initialize result to pass.
 	m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
 
+	// With --deqp-gl-call-trace calls are recorded to binary trace instead, and written to
+	// log only if case doesn't pass.
+	const bool callTrace = m_testCtx.getCommandLine().isGLCallTraceEnabled();
+
 	// Enable call logging.
-	enableLogging(true);
+	enableLogging(!callTrace);
+	enableCallTrace(callTrace);
 
 	// Run test.
-	test();
+	try
+	{
+		test();
+	}
+	catch (...)
+	{
+		logCallTraceAndDiscard();
+		throw;
+	}
+
+	if (m_testCtx.getTestResult() != QP_TEST_RESULT_PASS)
+		logCallTraceAndDiscard();
+	else
+		discardCallTrace();
 
 	return STOP;
 }
 
+void ApiCase::logCallTraceAndDiscard (void)
+{
+	if (isCallTraceEnabled())
+		logCallTrace();
+
+	discardCallTrace();
+}
+
 void ApiCase::expectError (deUint32 expected)
 {
 	deUint32 err = glGetError();
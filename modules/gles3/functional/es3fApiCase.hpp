@@ -53,6 +53,9 @@ protected:
 	void				checkBooleans			(deInt32 value, deUint8 expected);
 
 	tcu::TestLog&		m_log;
+
+private:
+	void				logCallTraceAndDiscard	(void);
 };
 
 // Helper macro for declaring ApiCases.
@@ -110,12 +110,7 @@ void FlatColorShader::setColor (sglr::Context& context, deUint32 program, const
 
 void FlatColorShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-	{
-		rr::VertexPacket& packet = *packets[packetNdx];
-
-		packet.position = rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
 }
 
 void FlatColorShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -195,13 +190,8 @@ void GradientShader::setGradient (sglr::Context& ctx, deUint32 program, const tc
 
 void GradientShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-	{
-		rr::VertexPacket& packet = *packets[packetNdx];
-
-		packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-		packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 }
 
 void GradientShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -359,13 +349,8 @@ void Texture2DShader::setUniforms (sglr::Context& gl, deUint32 program) const
 
 void Texture2DShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-	{
-		rr::VertexPacket& packet = *packets[packetNdx];
-
-		packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-		packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 }
 
 void Texture2DShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -620,13 +605,8 @@ void Texture2DArrayShader::setUniforms (sglr::Context& gl, deUint32 program) con
 
 void Texture2DArrayShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-	{
-		rr::VertexPacket& packet = *packets[packetNdx];
-
-		packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-		packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 }
 
 void Texture2DArrayShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -728,13 +708,8 @@ void Texture3DShader::setUniforms (sglr::Context& gl, deUint32 program) const
 
 void Texture3DShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-	{
-		rr::VertexPacket& packet = *packets[packetNdx];
-
-		packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-		packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 }
 
 void Texture3DShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -825,13 +800,8 @@ void DepthGradientShader::setUniforms (sglr::Context& ctx, deUint32 program, con
 
 void DepthGradientShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
-	{
-		rr::VertexPacket& packet = *packets[packetNdx];
-
-		packet.position		= rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
-		packet.outputs[0]	= rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 }
 
 void DepthGradientShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
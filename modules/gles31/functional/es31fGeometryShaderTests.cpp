@@ -224,12 +224,11 @@ VertexExpanderShader::VertexExpanderShader (const glu::ContextType& contextType,
 
 void VertexExpanderShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
+
 	for (int ndx = 0; ndx < numPackets; ++ndx)
-	{
-		packets[ndx]->position = rr::readVertexAttribFloat(inputs[0], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
 		packets[ndx]->pointSize = 1.0f;
-		packets[ndx]->outputs[0] = rr::readVertexAttribFloat(inputs[1], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-	}
 }
 
 void VertexExpanderShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -331,12 +330,11 @@ VertexEmitterShader::VertexEmitterShader (const glu::ContextType& contextType, i
 
 void VertexEmitterShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
+
 	for (int ndx = 0; ndx < numPackets; ++ndx)
-	{
-		packets[ndx]->position = rr::readVertexAttribFloat(inputs[0], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
 		packets[ndx]->pointSize = 1.0f;
-		packets[ndx]->outputs[0] = rr::readVertexAttribFloat(inputs[1], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-	}
 }
 
 void VertexEmitterShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -815,12 +813,11 @@ OutputCountShader::OutputCountShader (const glu::ContextType& contextType, const
 
 void OutputCountShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
+
 	for (int ndx = 0; ndx < numPackets; ++ndx)
-	{
-		packets[ndx]->position = rr::readVertexAttribFloat(inputs[0], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
 		packets[ndx]->pointSize = 1.0f;
-		packets[ndx]->outputs[0] = rr::readVertexAttribFloat(inputs[1], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-	}
 }
 
 void OutputCountShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -950,12 +947,11 @@ BuiltinVariableShader::BuiltinVariableShader (const glu::ContextType& contextTyp
 
 void BuiltinVariableShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
+
 	for (int ndx = 0; ndx < numPackets; ++ndx)
-	{
-		packets[ndx]->position = rr::readVertexAttribFloat(inputs[0], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
 		packets[ndx]->pointSize = 1.0f;
-		packets[ndx]->outputs[0] = rr::readVertexAttribFloat(inputs[1], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-	}
 }
 
 void BuiltinVariableShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -1250,11 +1246,8 @@ VaryingOutputCountShader::VaryingOutputCountShader (const glu::ContextType& cont
 
 void VaryingOutputCountShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int ndx = 0; ndx < numPackets; ++ndx)
-	{
-		packets[ndx]->position = rr::readVertexAttribFloat(inputs[0], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-		packets[ndx]->outputs[0] = rr::readVertexAttribFloat(inputs[1], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 }
 
 void VaryingOutputCountShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -1520,11 +1513,8 @@ InvocationCountShader::InvocationCountShader (const glu::ContextType& contextTyp
 
 void InvocationCountShader::shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
 {
-	for (int ndx = 0; ndx < numPackets; ++ndx)
-	{
-		packets[ndx]->position = rr::readVertexAttribFloat(inputs[0], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-		packets[ndx]->outputs[0] = rr::readVertexAttribFloat(inputs[1], packets[ndx]->instanceNdx, packets[ndx]->vertexNdx);
-	}
+	rr::readVertexAttribsToPosition(inputs[0], packets, numPackets);
+	rr::readVertexAttribsToOutput(inputs[1], 0, packets, numPackets);
 }
 
 void InvocationCountShader::shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
@@ -185,13 +185,15 @@ void RandomShaderProgram::shadeVertices (const rr::VertexAttrib* inputs, rr::Ver
 			const int					numComponents	= attribType.getNumElements();
 			rsg::ExecValueAccess		access			= m_execCtx.getValue(attribVar);
 
+			tcu::Vec4					attribValues[rsg::EXEC_VEC_WIDTH];
+
 			DE_ASSERT(attribType.isFloatOrVec() && de::inRange(numComponents, 1, 4));
 
+			rr::readVertexAttribs(&attribValues[0], inputs[attribNdx], packets + packetOffset, numToExecute);
+
 			for (int ndx = 0; ndx < numToExecute; ndx++)
 			{
-				const int				packetNdx	= ndx+packetOffset;
-				const rr::VertexPacket*	packet		= packets[packetNdx];
-				const tcu::Vec4			attribValue	= rr::readVertexAttribFloat(inputs[attribNdx], packet->instanceNdx, packet->vertexNdx);
+				const tcu::Vec4&		attribValue	= attribValues[ndx];
 
 										access.component(0).asFloat(ndx) = attribValue[0];
 				if (numComponents >= 2)	access.component(1).asFloat(ndx) = attribValue[1];
@@ -73,9 +73,10 @@ ShaderLibrary::~ShaderLibrary (void)
 
 std::vector<tcu::TestNode*> ShaderLibrary::loadShaderFile (const char* fileName)
 {
-	CaseFactory	caseFactory	(m_testCtx, m_renderCtx, m_contextInfo);
+	// Groups are instantiated lazily and keep factory alive as long as they need it
+	const de::SharedPtr<glu::sl::ShaderCaseFactory>	caseFactory	(new CaseFactory(m_testCtx, m_renderCtx, m_contextInfo));
 
-	return glu::sl::parseFile(m_testCtx.getArchive(), fileName, &caseFactory);
+	return glu::sl::loadFile(m_testCtx, fileName, caseFactory);
 }
 
 } // gls
@@ -33,6 +33,7 @@
 #include "tcuStringTemplate.hpp"
 #include "tcuTexLookupVerifier.hpp"
 #include "tcuTexVerifierUtil.hpp"
+#include "tcuInstrumentation.hpp"
 #include "glwEnums.hpp"
 #include "glwFunctions.hpp"
 #include "qpWatchDog.h"
@@ -301,6 +302,8 @@ void TextureRenderer::renderQuad (int texUnit, const float* texCoord, TextureTyp
 
 void TextureRenderer::renderQuad (int texUnit, const float* texCoord, const RenderParams& params)
 {
+	const tcu::InstrumentationScope scope ("gls::TextureTestUtil::TextureRenderer::renderQuad");
+
 	const glw::Functions&	gl			= m_renderCtx.getFunctions();
 	tcu::Vec4				wCoord		= params.flags & RenderParams::PROJECTED ? params.w : tcu::Vec4(1.0f);
 	bool					useBias		= !!(params.flags & RenderParams::USE_BIAS);
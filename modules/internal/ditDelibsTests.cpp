@@ -32,6 +32,8 @@
 #include "dePoolHashSet.h"
 #include "dePoolHashArray.h"
 #include "dePoolMultiSet.h"
+#include "dePoolTest.h"
+#include "deConcurrentMemPool.h"
 
 // dethread
 #include "deThreadTest.h"
@@ -40,6 +42,7 @@
 // deutil
 #include "deTimerTest.h"
 #include "deCommandLine.h"
+#include "deClock.h"
 
 // debase
 #include "deInt32.h"
@@ -63,12 +66,53 @@
 #include "deSpinBarrier.hpp"
 #include "deSTLUtil.hpp"
 #include "deAppendList.hpp"
+#include "deParallel.hpp"
 
 namespace dit
 {
 
 using tcu::TestLog;
 
+class PoolAllocBenchmarkCase : public tcu::TestCase
+{
+public:
+	PoolAllocBenchmarkCase (tcu::TestContext& testCtx, const char* name, const char* description)
+		: tcu::TestCase(testCtx, name, description)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const int	numAllocs		= 200000;
+		const int	numIterations	= 3;
+		TestLog&	log				= m_testCtx.getLog();
+
+		log << TestLog::Message << "Making " << numAllocs << " allocations of 8 to 256 bytes, best of " << numIterations << " runs" << TestLog::EndMessage;
+
+		for (int allocatorNdx = 0; allocatorNdx < DE_POOL_BENCHMARK_ALLOCATOR_LAST; allocatorNdx++)
+		{
+			const dePoolBenchmarkAllocator	allocator	= (dePoolBenchmarkAllocator)allocatorNdx;
+			deUint64						minTimeUs	= ~(deUint64)0;
+
+			for (int iterNdx = 0; iterNdx < numIterations; iterNdx++)
+			{
+				const deUint64	startTime	= deGetMicroseconds();
+				const deUint32	checksum	= dePool_runAllocBenchmark(allocator, numAllocs);
+				const deUint64	timeUs		= deGetMicroseconds() - startTime;
+
+				DE_UNREF(checksum);
+				minTimeUs = de::min(minTimeUs, timeUs);
+			}
+
+			log << TestLog::Message << dePool_getBenchmarkAllocatorName(allocator) << ": " << minTimeUs << " us, "
+				<< (minTimeUs > 0 ? (deUint64)numAllocs * 1000000u / minTimeUs : (deUint64)0) << " allocs/s" << TestLog::EndMessage;
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
 class DepoolTests : public tcu::TestCaseGroup
 {
 public:
@@ -86,6 +130,8 @@ public:
 		addChild(new SelfCheckCase(m_testCtx, "hash_set",	"dePoolHashSet_selfTest()",		dePoolHashSet_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "hash_array",	"dePoolHashArray_selfTest()",	dePoolHashArray_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "multi_set",	"dePoolMultiSet_selfTest()",	dePoolMultiSet_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "concurrent_mem_pool",	"deConcurrentMemPool_selfTest()",	deConcurrentMemPool_selfTest));
+		addChild(new PoolAllocBenchmarkCase(m_testCtx, "alloc_benchmark",	"Pool allocation throughput"));
 	}
 };
 
@@ -129,6 +175,7 @@ public:
 		addChild(new SelfCheckCase(m_testCtx, "semaphore",					"deSemaphore_selfTest()",			deSemaphore_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "atomic",						"deAtomic_selfTest()",				deAtomic_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "singleton",					"deSingleton_selfTest()",			deSingleton_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "concurrent_mem_pool",		"deConcurrentMemPool_threadedSelfTest()",	deConcurrentMemPool_threadedSelfTest));
 		addChild(new GetUint32Case(m_testCtx, "total_physical_cores",		"deGetNumTotalPhysicalCores()",		deGetNumTotalPhysicalCores));
 		addChild(new GetUint32Case(m_testCtx, "total_logical_cores",		"deGetNumTotalLogicalCores()",		deGetNumTotalLogicalCores));
 		addChild(new GetUint32Case(m_testCtx, "available_logical_cores",	"deGetNumAvailableLogicalCores()",	deGetNumAvailableLogicalCores));
@@ -192,6 +239,7 @@ public:
 		addChild(new SelfCheckCase(m_testCtx, "spin_barrier",				"de::SpinBarrier_selfTest()",			de::SpinBarrier_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "stl_util",					"de::STLUtil_selfTest()",				de::STLUtil_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "append_list",				"de::AppendList_selfTest()",			de::AppendList_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "parallel",					"de::Parallel_selfTest()",				de::Parallel_selfTest));
 	}
 };
 
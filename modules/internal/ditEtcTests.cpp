@@ -0,0 +1,202 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Test Module
+ * ---------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief ETC decompression tests.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditEtcTests.hpp"
+
+#include "tcuCompressedTexture.hpp"
+#include "tcuTextureUtil.hpp"
+#include "tcuTestLog.hpp"
+
+#include "deUniquePtr.hpp"
+#include "deStringUtil.hpp"
+#include "deRandom.hpp"
+#include "deInt32.h"
+#include "deMemory.h"
+
+#include <vector>
+
+namespace dit
+{
+
+using std::string;
+using std::vector;
+using tcu::TestLog;
+using namespace tcu;
+
+namespace
+{
+
+static string getEtcFormatShortName (CompressedTexFormat format)
+{
+	switch (format)
+	{
+		case COMPRESSEDTEXFORMAT_ETC1_RGB8:							return "etc1_rgb8";
+		case COMPRESSEDTEXFORMAT_EAC_R11:							return "eac_r11";
+		case COMPRESSEDTEXFORMAT_EAC_SIGNED_R11:					return "eac_signed_r11";
+		case COMPRESSEDTEXFORMAT_EAC_RG11:							return "eac_rg11";
+		case COMPRESSEDTEXFORMAT_EAC_SIGNED_RG11:					return "eac_signed_rg11";
+		case COMPRESSEDTEXFORMAT_ETC2_RGB8:							return "etc2_rgb8";
+		case COMPRESSEDTEXFORMAT_ETC2_SRGB8:						return "etc2_srgb8";
+		case COMPRESSEDTEXFORMAT_ETC2_RGB8_PUNCHTHROUGH_ALPHA1:		return "etc2_rgb8_punchthrough_alpha1";
+		case COMPRESSEDTEXFORMAT_ETC2_SRGB8_PUNCHTHROUGH_ALPHA1:	return "etc2_srgb8_punchthrough_alpha1";
+		case COMPRESSEDTEXFORMAT_ETC2_EAC_RGBA8:					return "etc2_eac_rgba8";
+		case COMPRESSEDTEXFORMAT_ETC2_EAC_SRGB8_ALPHA8:				return "etc2_eac_srgb8_alpha8";
+		default:
+			DE_ASSERT(false);
+			return "";
+	}
+}
+
+// ETC1 has no T, H or planar modes; differential blocks where base + delta overflows are invalid.
+static void makeValidEtc1Block (deUint8* block)
+{
+	const bool diffBit = (block[3] & 0x2) != 0;
+
+	if (diffBit)
+	{
+		for (int channelNdx = 0; channelNdx < 3; channelNdx++)
+		{
+			const int	base	= block[channelNdx] >> 3;
+			const int	delta	= ((block[channelNdx] & 0x7) ^ 0x4) - 0x4;
+
+			if (!de::inRange(base + delta, 0, 31))
+			{
+				block[3] &= (deUint8)~0x2u;
+				break;
+			}
+		}
+	}
+}
+
+class EtcDecompressCase : public tcu::TestCase
+{
+public:
+								EtcDecompressCase	(tcu::TestContext& testCtx, CompressedTexFormat format);
+
+	IterateResult				iterate				(void);
+
+private:
+	bool						testSize			(int width, int height, int depth, deUint32 seed);
+
+	const CompressedTexFormat	m_format;
+};
+
+EtcDecompressCase::EtcDecompressCase (tcu::TestContext& testCtx, CompressedTexFormat format)
+	: tcu::TestCase	(testCtx, getEtcFormatShortName(format).c_str(), "Compare decompress() against block-by-block reference decoder")
+	, m_format		(format)
+{
+}
+
+bool EtcDecompressCase::testSize (int width, int height, int depth, deUint32 seed)
+{
+	const IVec3				blockPixelSize	= getBlockPixelSize(m_format);
+	const int				blockSize		= getBlockSize(m_format);
+	const int				numBlocks		= deDivRoundUp32(width, blockPixelSize.x()) * deDivRoundUp32(height, blockPixelSize.y()) * depth;
+	const TextureFormat		format			= getUncompressedFormat(m_format);
+	vector<deUint8>			data			(numBlocks*blockSize);
+	TextureLevel			result			(format, width, height, depth);
+	TextureLevel			reference		(format, width, height, depth);
+	de::Random				rnd				(seed);
+
+	for (size_t ndx = 0; ndx < data.size(); ndx++)
+		data[ndx] = rnd.getUint8();
+
+	if (m_format == COMPRESSEDTEXFORMAT_ETC1_RGB8)
+	{
+		for (int blockNdx = 0; blockNdx < numBlocks; blockNdx++)
+			makeValidEtc1Block(&data[blockNdx*blockSize]);
+	}
+
+	// Fill destination with different garbage so that missing writes are caught.
+	deMemset(result.getAccess().getDataPtr(), 0xcd, (size_t)(format.getPixelSize()*width*height*depth));
+	deMemset(reference.getAccess().getDataPtr(), 0x00, (size_t)(format.getPixelSize()*width*height*depth));
+
+	decompress(result.getAccess(), m_format, &data[0]);
+	decompressReference(reference.getAccess(), m_format, &data[0]);
+
+	for (int z = 0; z < depth; z++)
+	for (int y = 0; y < height; y++)
+	for (int x = 0; x < width; x++)
+	{
+		if (deMemCmp(result.getAccess().getPixelPtr(x, y, z), reference.getAccess().getPixelPtr(x, y, z), (size_t)format.getPixelSize()) != 0)
+		{
+			m_testCtx.getLog() << TestLog::Message << "ERROR: " << width << "x" << height << "x" << depth
+												   << ": mismatch at (" << x << ", " << y << ", " << z << ")"
+												   << ", got " << result.getAccess().getPixelInt(x, y, z)
+												   << ", expected " << reference.getAccess().getPixelInt(x, y, z)
+												   << TestLog::EndMessage;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+EtcDecompressCase::IterateResult EtcDecompressCase::iterate (void)
+{
+	static const struct
+	{
+		int width;
+		int height;
+		int depth;
+	} s_sizes[] =
+	{
+		{   4,   4, 1 },
+		{   1,   1, 1 },
+		{  37,  23, 1 },
+		{ 128, 128, 1 },
+		{  61,  29, 3 },
+		{ 517, 301, 2 },
+	};
+
+	bool allOk = true;
+
+	for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(s_sizes); sizeNdx++)
+		allOk = testSize(s_sizes[sizeNdx].width, s_sizes[sizeNdx].height, s_sizes[sizeNdx].depth, deInt32Hash(m_format) ^ deInt32Hash(sizeNdx)) && allOk;
+
+	if (allOk)
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "All checks passed");
+	else
+		m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Result doesn't match reference decoder");
+
+	return STOP;
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createEtcTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup>	etcTests	(new tcu::TestCaseGroup(testCtx, "etc", "Tests for ETC decompression"));
+
+	for (int formatNdx = 0; formatNdx < COMPRESSEDTEXFORMAT_LAST; formatNdx++)
+	{
+		const CompressedTexFormat	format	= (CompressedTexFormat)formatNdx;
+
+		if (isEtcFormat(format))
+			etcTests->addChild(new EtcDecompressCase(testCtx, format));
+	}
+
+	return etcTests.release();
+}
+
+} // dit
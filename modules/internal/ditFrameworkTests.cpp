@@ -24,22 +24,45 @@
 #include "ditFrameworkTests.hpp"
 #include "ditTextureFormatTests.hpp"
 #include "ditAstcTests.hpp"
+#include "ditEtcTests.hpp"
+#include "ditShaderLibraryTests.hpp"
+#include "ditTextureSamplerTests.hpp"
 #include "ditVulkanTests.hpp"
 
 #include "tcuFloatFormat.hpp"
 #include "tcuEither.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuTestHierarchyIndex.hpp"
+#include "tcuTestHierarchyIterator.hpp"
+#include "tcuInstrumentation.hpp"
+#include "gluCallLogWrapper.hpp"
+#include "gluCallTrace.hpp"
+#include "glwFunctions.hpp"
+#include "glwEnums.hpp"
 
 #include "rrRenderer.hpp"
+#include "rrFragmentOperations.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuImageCompare.hpp"
 
 #include "deRandom.hpp"
+#include "deThread.hpp"
+#include "deParallel.hpp"
 #include "deArrayUtil.hpp"
+#include "deStringUtil.hpp"
+#include "deClock.h"
+#include "deMemory.h"
+#include "deString.h"
+#include "deProcess.h"
 
 #include <stdexcept>
+#include <sstream>
+#include <algorithm>
+#include <map>
+#include <cstdio>
 
 namespace dit
 {
@@ -880,6 +903,1451 @@ protected:
 	vector<SubCase>::const_iterator	m_caseIter;
 };
 
+class VertexCacheTest : public tcu::TestCase
+{
+public:
+	enum DrawType
+	{
+		DRAWTYPE_TRIANGLES = 0,
+		DRAWTYPE_TRIANGLE_STRIP_RESTART,
+		DRAWTYPE_TRIANGLES_INSTANCED,
+
+		DRAWTYPE_LAST
+	};
+
+	VertexCacheTest (tcu::TestContext& testCtx, const char* name, const char* description, DrawType drawType)
+		: tcu::TestCase	(testCtx, name, description)
+		, m_drawType	(drawType)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		using tcu::Vec4;
+
+		const int				gridSize		= 8;
+		const int				numGridVertices	= (gridSize+1)*(gridSize+1);
+		const deUint16			restartIndex	= 0xffff;
+		const int				numInstances	= m_drawType == DRAWTYPE_TRIANGLES_INSTANCED ? 3 : 1;
+		const bool				isStrip			= m_drawType == DRAWTYPE_TRIANGLE_STRIP_RESTART;
+		const int				renderSize		= 64;
+		vector<Vec4>			positions;
+		vector<Vec4>			colors;
+		vector<deUint16>		indices;
+
+		for (int y = 0; y <= gridSize; y++)
+		{
+			for (int x = 0; x <= gridSize; x++)
+			{
+				const float fx = float(x) / float(gridSize);
+				const float fy = float(y) / float(gridSize);
+
+				positions.push_back(Vec4(fx*1.6f - 0.9f, fy*1.8f - 0.9f, 0.0f, 1.0f));
+				colors.push_back(Vec4(fx, fy, 1.0f - fx*fy, 1.0f));
+			}
+		}
+
+		for (int y = 0; y < gridSize; y++)
+		{
+			for (int x = 0; x < gridSize; x++)
+			{
+				const deUint16 v00 = (deUint16)(y*(gridSize+1) + x);
+				const deUint16 v10 = (deUint16)(v00 + 1);
+				const deUint16 v01 = (deUint16)(v00 + gridSize+1);
+				const deUint16 v11 = (deUint16)(v01 + 1);
+
+				if (isStrip)
+				{
+					if (x == 0)
+					{
+						indices.push_back(v00);
+						indices.push_back(v01);
+					}
+
+					indices.push_back(v10);
+					indices.push_back(v11);
+				}
+				else
+				{
+					const deUint16 quad[] = { v00, v10, v01, v01, v10, v11 };
+					indices.insert(indices.end(), DE_ARRAY_BEGIN(quad), DE_ARRAY_END(quad));
+				}
+			}
+
+			if (isStrip)
+				indices.push_back(restartIndex);
+		}
+
+		{
+			const rr::PrimitiveType		primitiveType	= isStrip ? rr::PRIMITIVETYPE_TRIANGLE_STRIP : rr::PRIMITIVETYPE_TRIANGLES;
+			const int					numReferences	= (int)indices.size() - (isStrip ? gridSize : 0);
+			tcu::TextureLevel			result			(tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8), renderSize, renderSize);
+			tcu::TextureLevel			reference		(result.getFormat(), renderSize, renderSize);
+			rr::DrawStatistics			stats;
+			rr::DrawStatistics			refStats;
+			int							numInvocations	= 0;
+			int							refInvocations	= 0;
+
+			// Indexed draw through vertex cache
+			tcu::clear(result.getAccess(), Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+
+			{
+				const rr::VertexAttrib	attribs[]	=
+				{
+					rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &positions[0]),
+					rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &colors[0])
+				};
+
+				draw(result.getAccess(), attribs, rr::PrimitiveList(primitiveType, (int)indices.size(), rr::DrawIndices(&indices[0])), restartIndex, numInstances, stats, numInvocations);
+			}
+
+			// Reference draws every segment with de-indexed vertices
+			tcu::clear(reference.getAccess(), Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+
+			for (size_t segmentBegin = 0; segmentBegin < indices.size();)
+			{
+				vector<Vec4>	segmentPositions;
+				vector<Vec4>	segmentColors;
+				size_t			ndx				= segmentBegin;
+
+				for (; ndx < indices.size() && !(isStrip && indices[ndx] == restartIndex); ndx++)
+				{
+					segmentPositions.push_back(positions[indices[ndx]]);
+					segmentColors.push_back(colors[indices[ndx]]);
+				}
+
+				{
+					const rr::VertexAttrib	attribs[]	=
+					{
+						rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &segmentPositions[0]),
+						rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &segmentColors[0])
+					};
+
+					draw(reference.getAccess(), attribs, rr::PrimitiveList(primitiveType, (int)segmentPositions.size(), 0), restartIndex, numInstances, refStats, refInvocations);
+				}
+
+				segmentBegin = ndx + 1;
+			}
+
+			m_testCtx.getLog() << TestLog::Message
+							   << "Indexed draw: " << stats.numVertexReferences << " vertex references, "
+							   << stats.numShadedVertices << " shaded vertices, "
+							   << stats.numShadeBatches << " shading batches"
+							   << TestLog::EndMessage;
+
+			if (stats.numVertexReferences != (deUint64)(numReferences*numInstances) ||
+				stats.numShadedVertices != (deUint64)(numGridVertices*numInstances) ||
+				stats.numShadeBatches != (deUint64)numInstances ||
+				numInvocations != numGridVertices*numInstances)
+			{
+				m_testCtx.getLog() << TestLog::Message << "FAIL: Expected " << numGridVertices*numInstances << " shaded vertices in " << numInstances << " batches, got " << numInvocations << " shader invocations" << TestLog::EndMessage;
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Invalid vertex cache statistics");
+			}
+			else if (refStats.numShadedVertices != (deUint64)(numReferences*numInstances))
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Invalid statistics for non-indexed draw");
+			else if (!tcu::intThresholdCompare(m_testCtx.getLog(), "Result", "Result of indexed draw", reference.getAccess(), result.getAccess(), tcu::UVec4(0u), tcu::COMPARE_LOG_RESULT))
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Indexed draw differs from non-indexed draw");
+			else
+				m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		}
+
+		return STOP;
+	}
+
+private:
+	class VtxShader : public rr::VertexShader
+	{
+	public:
+		VtxShader (int& numInvocations)
+			: rr::VertexShader	(2, 1)
+			, m_numInvocations	(numInvocations)
+		{
+			m_inputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+			m_inputs[1].type	= rr::GENERICVECTYPE_FLOAT;
+			m_outputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+		}
+
+		void shadeVertices (const rr::VertexAttrib* inputs, rr::VertexPacket* const* packets, const int numPackets) const
+		{
+			for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+			{
+				rr::VertexPacket* const packet = packets[packetNdx];
+
+				rr::readVertexAttrib(packet->position, inputs[0], packet->instanceNdx, packet->vertexNdx);
+				packet->position.x() += 0.05f*float(packet->instanceNdx);
+				packet->outputs[0] = rr::readVertexAttribFloat(inputs[1], packet->instanceNdx, packet->vertexNdx);
+			}
+
+			m_numInvocations += numPackets;
+		}
+
+	private:
+		int&	m_numInvocations;
+	};
+
+	class FragShader : public rr::FragmentShader
+	{
+	public:
+		FragShader (void)
+			: rr::FragmentShader(1, 1)
+		{
+			m_inputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+			m_outputs[0].type	= rr::GENERICVECTYPE_FLOAT;
+		}
+
+		void shadeFragments (rr::FragmentPacket* packets, const int numPackets, const rr::FragmentShadingContext& context) const
+		{
+			for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+			{
+				for (int fragNdx = 0; fragNdx < rr::NUM_FRAGMENTS_PER_PACKET; fragNdx++)
+					rr::writeFragmentOutput(context, packetNdx, fragNdx, 0, rr::readTriangleVarying<float>(packets[packetNdx], context, 0, fragNdx));
+			}
+		}
+	};
+
+	static void draw (const tcu::PixelBufferAccess& dst, const rr::VertexAttrib* attribs, const rr::PrimitiveList& primitives, deUint32 restartIndex, int numInstances, rr::DrawStatistics& stats, int& numInvocations)
+	{
+		const VtxShader							vtxShader		(numInvocations);
+		const FragShader						fragShader;
+		const rr::Program						program			(&vtxShader, &fragShader);
+		const rr::MultisamplePixelBufferAccess	colorAccess		= rr::MultisamplePixelBufferAccess::fromSinglesampleAccess(dst);
+		const rr::RenderTarget					renderTarget	(colorAccess);
+		rr::RenderState							state			((rr::ViewportState(colorAccess)));
+		const rr::Renderer						renderer;
+
+		state.restart.enabled		= primitives.isIndexed();
+		state.restart.restartIndex	= restartIndex;
+
+		renderer.drawInstanced(rr::DrawCommand(state, renderTarget, program, 2, attribs, primitives), numInstances, stats);
+	}
+
+	const DrawType	m_drawType;
+};
+
+class FragmentOpsDepthFormatTest : public tcu::TestCase
+{
+public:
+	FragmentOpsDepthFormatTest (tcu::TestContext& testCtx, const char* name, const tcu::TextureFormat& format)
+		: tcu::TestCase	(testCtx, name, "rr::FragmentProcessor depth test and write")
+		, m_format		(format)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		using tcu::Vec4;
+		using tcu::IVec2;
+
+		const int					numSamples	= 4;
+		const int					size		= 16;
+		const int					numPasses	= 4;
+		const bool					isCombined	= m_format.order == tcu::TextureFormat::DS;
+		de::Random					rnd			(deStringHash(getName()));
+		tcu::TextureLevel			color		(tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8), numSamples, size, size);
+		tcu::TextureLevel			result		(m_format, numSamples, size, size);
+		tcu::TextureLevel			reference	(m_format, numSamples, size, size);
+		const tcu::PixelBufferAccess	resultDepth	= isCombined ? tcu::getEffectiveDepthStencilAccess(result.getAccess(), tcu::Sampler::MODE_DEPTH) : result.getAccess();
+		const tcu::PixelBufferAccess	refDepth	= isCombined ? tcu::getEffectiveDepthStencilAccess(reference.getAccess(), tcu::Sampler::MODE_DEPTH) : reference.getAccess();
+		const bool					isFloat		= refDepth.getFormat().type == tcu::TextureFormat::FLOAT;
+		rr::FragmentOperationState	state;
+		rr::FragmentProcessor		processor;
+
+		state.depthTestEnabled	= true;
+		state.depthFunc			= rr::TESTFUNC_LESS;
+		state.depthMask			= true;
+
+		for (int z = 0; z < size; z++)
+		for (int y = 0; y < size; y++)
+		for (int x = 0; x < numSamples; x++)
+		{
+			const float depth = getRandomDepth(rnd);
+
+			if (isCombined)
+			{
+				result.getAccess().setPixStencil(x+y+z, x, y, z);
+				reference.getAccess().setPixStencil(x+y+z, x, y, z);
+			}
+
+			resultDepth.setPixDepth(depth, x, y, z);
+			refDepth.setPixDepth(depth, x, y, z);
+		}
+
+		for (int passNdx = 0; passNdx < numPasses; passNdx++)
+		{
+			vector<float>			sampleDepths	(size*size*numSamples);
+			vector<rr::Fragment>	fragments;
+
+			for (int pixelNdx = 0; pixelNdx < size*size; pixelNdx++)
+			{
+				const IVec2		pixelCoord	(pixelNdx % size, pixelNdx / size);
+				const deUint32	coverage	= rnd.getUint32() & ((1u << numSamples) - 1u);
+
+				if (rnd.getInt(0, 3) == 0)
+					continue;
+
+				for (int sampleNdx = 0; sampleNdx < numSamples; sampleNdx++)
+				{
+					const float depth = getRandomDepth(rnd);
+
+					sampleDepths[pixelNdx*numSamples + sampleNdx] = depth;
+
+					if ((coverage & (1u << sampleNdx)) == 0)
+						continue;
+
+					// Reference: fixed-point formats compare in buffer format, float formats compare clamped value.
+					if (isFloat ? (de::clamp(depth, 0.0f, 1.0f) < refDepth.getPixDepth(sampleNdx, pixelCoord.x(), pixelCoord.y()))
+								: (convertDepth(depth) < refDepth.getPixelUint(sampleNdx, pixelCoord.x(), pixelCoord.y()).x()))
+						refDepth.setPixDepth(de::clamp(depth, 0.0f, 1.0f), sampleNdx, pixelCoord.x(), pixelCoord.y());
+				}
+
+				fragments.push_back(rr::Fragment(pixelCoord, rr::GenericVec4(Vec4(1.0f)), coverage, &sampleDepths[pixelNdx*numSamples]));
+			}
+
+			if (!fragments.empty())
+				processor.render(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(color.getAccess()),
+								 rr::MultisamplePixelBufferAccess::fromMultisampleAccess(resultDepth),
+								 rr::MultisamplePixelBufferAccess(),
+								 &fragments[0], (int)fragments.size(), rr::FACETYPE_FRONT, state);
+		}
+
+		{
+			const size_t	dataSize	= (size_t)numSamples*size*size*m_format.getPixelSize();
+			const bool		isOk		= deMemCmp(result.getAccess().getDataPtr(), reference.getAccess().getDataPtr(), dataSize) == 0;
+
+			m_testCtx.getLog() << TestLog::Message << "Depth buffer format " << m_format << (isOk ? ", result matches reference" : ", result differs from reference") << TestLog::EndMessage;
+			m_testCtx.setTestResult(isOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+									isOk ? "Pass"				: "Depth buffer differs from reference");
+		}
+
+		return STOP;
+	}
+
+private:
+	static float getRandomDepth (de::Random& rnd)
+	{
+		// Include values outside [0, 1] and values at exact rounding midpoints
+		switch (rnd.getInt(0, 3))
+		{
+			case 0:		return rnd.getFloat(-0.25f, 1.25f);
+			case 1:		return (float)rnd.getInt(0, 255) / 255.0f;
+			case 2:		return ((float)rnd.getInt(0, 65535) + 0.5f) / 65535.0f;
+			default:	return rnd.getFloat();
+		}
+	}
+
+	deUint32 convertDepth (float depth) const
+	{
+		deUint32				buffer[2]	= { 0u, 0u };
+		const tcu::PixelBufferAccess	access	(tcu::getEffectiveDepthStencilTextureFormat(m_format, tcu::Sampler::MODE_DEPTH), 1, 1, 1, &buffer);
+
+		access.setPixDepth(depth, 0, 0, 0);
+		return access.getPixelUint(0, 0, 0).x();
+	}
+
+	const tcu::TextureFormat	m_format;
+};
+
+class FragmentOpsThroughputTest : public tcu::TestCase
+{
+public:
+	FragmentOpsThroughputTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "fragment_ops_throughput", "rr::FragmentProcessor throughput with depth, stencil and blending")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		using tcu::TextureFormat;
+
+		// \note RGBA4444 has no color buffer fast path and measures the generic access path.
+		static const struct
+		{
+			const char*				name;
+			TextureFormat			colorFormat;
+			TextureFormat			depthStencilFormat;
+		} s_configs[] =
+		{
+			{ "D24S8, RGBA8",		TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8),			TextureFormat(TextureFormat::DS, TextureFormat::UNSIGNED_INT_24_8)				},
+			{ "D32FS8, RGBA16F",	TextureFormat(TextureFormat::RGBA, TextureFormat::HALF_FLOAT),			TextureFormat(TextureFormat::DS, TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV)	},
+			{ "D32FS8, RGBA32F",	TextureFormat(TextureFormat::RGBA, TextureFormat::FLOAT),				TextureFormat(TextureFormat::DS, TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV)	},
+			{ "D24S8, RGBA4444",	TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_SHORT_4444),	TextureFormat(TextureFormat::DS, TextureFormat::UNSIGNED_INT_24_8)				},
+		};
+
+		const int				numIterations	= 16;
+		TestLog&				log				= m_testCtx.getLog();
+		de::Random				rnd				(0x7c3a91);
+		vector<float>			sampleDepths	(FRAMEBUFFER_SIZE*FRAMEBUFFER_SIZE);
+		vector<rr::Fragment>	fragments;
+
+		for (int pixelNdx = 0; pixelNdx < FRAMEBUFFER_SIZE*FRAMEBUFFER_SIZE; pixelNdx++)
+		{
+			sampleDepths[pixelNdx] = rnd.getFloat();
+			fragments.push_back(rr::Fragment(tcu::IVec2(pixelNdx % FRAMEBUFFER_SIZE, pixelNdx / FRAMEBUFFER_SIZE), rr::GenericVec4(tcu::Vec4(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), rnd.getFloat())), 1u, &sampleDepths[pixelNdx]));
+		}
+
+		log << TestLog::Message << "Rendering " << fragments.size() << " fragments with depth & stencil test and blending, best of " << numIterations << " runs" << TestLog::EndMessage;
+
+		for (int configNdx = 0; configNdx < DE_LENGTH_OF_ARRAY(s_configs); configNdx++)
+		{
+			const deUint64 timeUs = measure(s_configs[configNdx].colorFormat, s_configs[configNdx].depthStencilFormat, fragments, numIterations);
+
+			log << TestLog::Message << s_configs[configNdx].name << ": " << timeUs << " us, "
+				<< (timeUs > 0 ? (deUint64)fragments.size() * 1000000u / timeUs : (deUint64)0) << " fragments/s" << TestLog::EndMessage;
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	enum { FRAMEBUFFER_SIZE = 128 };
+
+	static deUint64 measure (const tcu::TextureFormat& colorFormat, const tcu::TextureFormat& depthStencilFormat, const vector<rr::Fragment>& fragments, int numIterations)
+	{
+		tcu::TextureLevel			color			(colorFormat, 1, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+		tcu::TextureLevel			depthStencil	(depthStencilFormat, 1, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+		rr::FragmentOperationState	state;
+		rr::FragmentProcessor		processor;
+		deUint64					minTimeUs		= ~(deUint64)0;
+
+		state.depthTestEnabled					= true;
+		state.depthFunc							= rr::TESTFUNC_LEQUAL;
+		state.stencilTestEnabled				= true;
+		state.stencilStates[0].func				= rr::TESTFUNC_ALWAYS;
+		state.stencilStates[0].dpPass			= rr::STENCILOP_INCR_WRAP;
+		state.numStencilBits					= 8;
+		state.blendMode							= rr::BLENDMODE_STANDARD;
+		state.blendRGBState.srcFunc				= rr::BLENDFUNC_SRC_ALPHA;
+		state.blendRGBState.dstFunc				= rr::BLENDFUNC_ONE_MINUS_SRC_ALPHA;
+		state.blendAState.srcFunc				= rr::BLENDFUNC_ONE;
+		state.blendAState.dstFunc				= rr::BLENDFUNC_ONE_MINUS_SRC_ALPHA;
+
+		for (int iterNdx = 0; iterNdx < numIterations; iterNdx++)
+		{
+			tcu::clear(color.getAccess(), tcu::Vec4(0.0f));
+			tcu::clearDepth(depthStencil.getAccess(), 1.0f);
+			tcu::clearStencil(depthStencil.getAccess(), 0);
+
+			{
+				const deUint64 startTime = deGetMicroseconds();
+
+				processor.render(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(color.getAccess()),
+								 rr::MultisamplePixelBufferAccess::fromMultisampleAccess(tcu::getEffectiveDepthStencilAccess(depthStencil.getAccess(), tcu::Sampler::MODE_DEPTH)),
+								 rr::MultisamplePixelBufferAccess::fromMultisampleAccess(tcu::getEffectiveDepthStencilAccess(depthStencil.getAccess(), tcu::Sampler::MODE_STENCIL)),
+								 &fragments[0], (int)fragments.size(), rr::FACETYPE_FRONT, state);
+
+				minTimeUs = de::min(minTimeUs, deGetMicroseconds() - startTime);
+			}
+		}
+
+		return minTimeUs;
+	}
+};
+
+namespace hierarchy_index
+{
+
+static const char* const s_casePaths[] =
+{
+	"a.x",
+	"a.y",
+	"b.c.x",
+	"b.c.z",
+	"b.d.w",
+	"e.f.g.x",
+	"h.top"
+};
+
+//! Cases of a newer build of the same package.
+static const char* const s_newCasePaths[] =
+{
+	"a.new"
+};
+
+class DummyCase : public tcu::TestCase
+{
+public:
+	DummyCase (tcu::TestContext& testCtx, const string& name)
+		: tcu::TestCase(testCtx, name.c_str(), "")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
+//! Group that creates its children lazily from case paths and counts init() calls.
+class PathGroup : public tcu::TestCaseGroup
+{
+public:
+	PathGroup (tcu::TestContext& testCtx, const string& name, const string& prefix, const vector<string>& paths, int* numInits)
+		: tcu::TestCaseGroup	(testCtx, name.c_str(), (string("Group ") + name).c_str())
+		, m_prefix				(prefix)
+		, m_paths				(paths)
+		, m_numInits			(numInits)
+	{
+	}
+
+	void init (void)
+	{
+		vector<string> added;
+
+		*m_numInits += 1;
+
+		for (size_t pathNdx = 0; pathNdx < m_paths.size(); pathNdx++)
+		{
+			const string&	path	= m_paths[pathNdx];
+
+			if (path.compare(0, m_prefix.size(), m_prefix) != 0)
+				continue;
+
+			{
+				const string	rest		= path.substr(m_prefix.size());
+				const size_t	dotPos		= rest.find('.');
+				const string	childName	= rest.substr(0, dotPos);
+
+				if (std::find(added.begin(), added.end(), childName) != added.end())
+					continue;
+
+				added.push_back(childName);
+
+				if (dotPos == string::npos)
+					addChild(new DummyCase(m_testCtx, childName));
+				else
+					addChild(new PathGroup(m_testCtx, childName, m_prefix + childName + ".", m_paths, m_numInits));
+			}
+		}
+	}
+
+private:
+	const string			m_prefix;
+	const vector<string>&	m_paths;
+	int* const				m_numInits;
+};
+
+//! Test hierarchy, optionally of a newer build that adds cases to the package and a new top-level group.
+class RootHolder
+{
+public:
+	RootHolder (tcu::TestContext& testCtx, int* numInits, bool isNewBuild = false)
+		: m_paths		(getCasePaths(isNewBuild))
+		, m_newPaths	(1, "x")
+		, m_root		(testCtx, createPackages(testCtx, isNewBuild, numInits))
+	{
+	}
+
+	tcu::TestPackageRoot& get (void) { return m_root; }
+
+private:
+	static vector<string> getCasePaths (bool isNewBuild)
+	{
+		vector<string> paths (DE_ARRAY_BEGIN(s_casePaths), DE_ARRAY_END(s_casePaths));
+
+		if (isNewBuild)
+			paths.insert(paths.end(), DE_ARRAY_BEGIN(s_newCasePaths), DE_ARRAY_END(s_newCasePaths));
+
+		return paths;
+	}
+
+	vector<tcu::TestNode*> createPackages (tcu::TestContext& testCtx, bool isNewBuild, int* numInits)
+	{
+		vector<tcu::TestNode*> packages;
+
+		packages.push_back(new PathGroup(testCtx, "pkg", "", m_paths, numInits));
+
+		if (isNewBuild)
+			packages.push_back(new PathGroup(testCtx, "new", "", m_newPaths, numInits));
+
+		return packages;
+	}
+
+	const vector<string>	m_paths;
+	const vector<string>	m_newPaths;
+	tcu::TestPackageRoot	m_root;
+};
+
+static const char* stateName (tcu::TestHierarchyIterator::State state)
+{
+	return state == tcu::TestHierarchyIterator::STATE_ENTER_NODE ? "enter " : "leave ";
+}
+
+static vector<string> iterateInflated (tcu::TestContext& testCtx, const tcu::CaseListFilter& filter, const tcu::TestHierarchyIndex* index, int* numInits, bool isNewBuild = false)
+{
+	RootHolder							root		(testCtx, numInits, isNewBuild);
+	tcu::DefaultHierarchyInflater		inflater	(testCtx);
+	tcu::TestHierarchyIterator			iter		(root.get(), inflater, filter, index);
+	vector<string>						events;
+
+	while (iter.getState() != tcu::TestHierarchyIterator::STATE_FINISHED)
+	{
+		events.push_back(stateName(iter.getState()) + iter.getNodePath());
+		iter.next();
+	}
+
+	return events;
+}
+
+static vector<string> iterateIndex (const tcu::TestHierarchyIndex& index, const tcu::CaseListFilter& filter)
+{
+	tcu::TestHierarchyIndexIterator		iter		(index, filter);
+	vector<string>						events;
+
+	while (iter.getState() != tcu::TestHierarchyIterator::STATE_FINISHED)
+	{
+		events.push_back(stateName(iter.getState()) + iter.getNodePath());
+		iter.next();
+	}
+
+	return events;
+}
+
+//! Remove groups without any cases, which index-assisted iteration skips entirely.
+static vector<string> removeEmptyGroups (const vector<string>& events, const tcu::TestHierarchyIndex& index)
+{
+	vector<string>	casePaths;
+	vector<string>	result;
+
+	for (size_t ndx = 0; ndx < events.size(); ndx++)
+	{
+		const string path = events[ndx].substr(events[ndx].find(' ') + 1);
+
+		if (tcu::isTestNodeTypeExecutable(index.getNodeType(index.findNode(path))))
+			casePaths.push_back(path + ".");
+	}
+
+	for (size_t ndx = 0; ndx < events.size(); ndx++)
+	{
+		const string	path	= events[ndx].substr(events[ndx].find(' ') + 1) + ".";
+		bool			isEmpty	= true;
+
+		for (size_t caseNdx = 0; caseNdx < casePaths.size() && isEmpty; caseNdx++)
+			isEmpty = casePaths[caseNdx].compare(0, path.size(), path) != 0;
+
+		if (!isEmpty)
+			result.push_back(events[ndx]);
+	}
+
+	return result;
+}
+
+static string joinEvents (const vector<string>& events)
+{
+	std::ostringstream str;
+
+	for (size_t ndx = 0; ndx < events.size(); ndx++)
+		str << events[ndx] << "\n";
+
+	return str.str();
+}
+
+class HierarchyIndexTest : public tcu::TestCase
+{
+public:
+	HierarchyIndexTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "test_hierarchy_index", "tcu::TestHierarchyIndex and index-assisted iteration")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		static const char* const	s_patterns[]	=
+		{
+			"pkg.*",
+			"pkg.a.*",
+			"pkg.b.c.*",
+			"pkg.*.x",
+			"pkg.b.d.w",
+			"pkg.e.*",
+			"pkg.h.top",
+			"other.*",
+			"{pkg{a{x},b{d{w}},h{top}}}",
+		};
+
+		TestLog&		log			= m_testCtx.getLog();
+		vector<deUint8>	data;
+		bool			allOk		= true;
+
+		{
+			int								numInits	= 0;
+			RootHolder						root		(m_testCtx, &numInits);
+			tcu::DefaultHierarchyInflater	inflater	(m_testCtx);
+
+			tcu::TestHierarchyIndex::build(data, root.get(), inflater);
+		}
+
+		log << TestLog::Message << "Index size: " << data.size() << " bytes" << TestLog::EndMessage;
+
+		{
+			const tcu::TestHierarchyIndex	index	(&data[0], data.size());
+
+			// Path lookup
+			for (int nodeNdx = 1; nodeNdx < index.getNumNodes(); nodeNdx++)
+			{
+				const string path = index.getNodePath(nodeNdx);
+
+				if (index.findNode(path) != nodeNdx)
+				{
+					log << TestLog::Message << "ERROR: findNode(\"" << path << "\") != " << nodeNdx << TestLog::EndMessage;
+					allOk = false;
+				}
+			}
+
+			if (index.findNode("pkg.b.c.x") < 0 || index.findNode("pkg.b.c.y") >= 0 || index.findNode("pkg.a.x.y") >= 0)
+			{
+				log << TestLog::Message << "ERROR: Unexpected findNode() result" << TestLog::EndMessage;
+				allOk = false;
+			}
+
+			// Iteration
+			for (int patternNdx = 0; patternNdx < DE_LENGTH_OF_ARRAY(s_patterns); patternNdx++)
+			{
+				const char* const					pattern				= s_patterns[patternNdx];
+				const bool							isTrie				= pattern[0] == '{';
+				tcu::CommandLine					cmdLine;
+				de::MovePtr<tcu::CaseListFilter>	filter;
+				int									numInits			= 0;
+				int									numInitsWithIndex	= 0;
+
+				{
+					const char* argv[] =
+					{
+						"deqp",
+						isTrie ? "--deqp-caselist" : "--deqp-case",
+						pattern
+					};
+
+					if (!cmdLine.parse(DE_LENGTH_OF_ARRAY(argv), argv))
+						TCU_FAIL("Failed to parse command line");
+				}
+
+				filter = cmdLine.createCaseListFilter(m_testCtx.getArchive());
+
+				{
+					const vector<string>	reference		= iterateInflated(m_testCtx, *filter, DE_NULL, &numInits);
+					const vector<string>	fromIndex		= iterateIndex(index, *filter);
+					const vector<string>	pruned			= iterateInflated(m_testCtx, *filter, &index, &numInitsWithIndex);
+
+					log << TestLog::Message << pattern << ": " << reference.size() << " events, "
+											<< numInits << " group inits without index, "
+											<< numInitsWithIndex << " with index"
+						<< TestLog::EndMessage;
+
+					if (fromIndex != reference)
+					{
+						log << TestLog::Message << "ERROR: TestHierarchyIndexIterator mismatch, expected:\n" << joinEvents(reference)
+												<< "got:\n" << joinEvents(fromIndex)
+							<< TestLog::EndMessage;
+						allOk = false;
+					}
+
+					if (pruned != removeEmptyGroups(reference, index))
+					{
+						log << TestLog::Message << "ERROR: Index-assisted TestHierarchyIterator mismatch, expected:\n" << joinEvents(removeEmptyGroups(reference, index))
+												<< "got:\n" << joinEvents(pruned)
+							<< TestLog::EndMessage;
+						allOk = false;
+					}
+
+					if (numInitsWithIndex > numInits)
+					{
+						log << TestLog::Message << "ERROR: Index-assisted iteration initialized more groups" << TestLog::EndMessage;
+						allOk = false;
+					}
+				}
+			}
+		}
+
+		// Corrupted data must be rejected
+		{
+			vector<deUint8>	truncated	(data.begin(), data.begin() + data.size()/2);
+			vector<deUint8>	badMagic	= data;
+			vector<deUint8>	badString	= data;
+			int				numThrown	= 0;
+
+			badMagic[0] ^= 0xffu;
+			badString[badString.size()-2] ^= 0x20u;
+
+			try { tcu::TestHierarchyIndex index(&truncated[0], truncated.size()); } catch (const tcu::Exception&) { numThrown += 1; }
+			try { tcu::TestHierarchyIndex index(&badMagic[0], badMagic.size()); } catch (const tcu::Exception&) { numThrown += 1; }
+			try { tcu::TestHierarchyIndex index(&badString[0], badString.size()); } catch (const tcu::Exception&) { numThrown += 1; }
+
+			if (numThrown != 3)
+			{
+				log << TestLog::Message << "ERROR: Invalid index data was not rejected" << TestLog::EndMessage;
+				allOk = false;
+			}
+		}
+
+		// Index from a different build must be ignored
+		{
+			static const char* const		s_newBuildPatterns[]	= { "pkg.*", "pkg.a.new", "new.*" };
+			const tcu::TestHierarchyIndex	index					(&data[0], data.size());
+			int								numInits				= 0;
+			RootHolder						oldRoot					(m_testCtx, &numInits);
+			RootHolder						newRoot					(m_testCtx, &numInits, true);
+
+			if (!index.isCompatible(oldRoot.get()) || index.isCompatible(newRoot.get()))
+			{
+				log << TestLog::Message << "ERROR: Unexpected isCompatible() result" << TestLog::EndMessage;
+				allOk = false;
+			}
+
+			for (int patternNdx = 0; patternNdx < DE_LENGTH_OF_ARRAY(s_newBuildPatterns); patternNdx++)
+			{
+				const char* const					pattern		= s_newBuildPatterns[patternNdx];
+				tcu::CommandLine					cmdLine;
+				de::MovePtr<tcu::CaseListFilter>	filter;
+
+				{
+					const char* argv[] = { "deqp", "--deqp-case", pattern };
+
+					if (!cmdLine.parse(DE_LENGTH_OF_ARRAY(argv), argv))
+						TCU_FAIL("Failed to parse command line");
+				}
+
+				filter = cmdLine.createCaseListFilter(m_testCtx.getArchive());
+
+				{
+					const vector<string>	reference	= iterateInflated(m_testCtx, *filter, DE_NULL, &numInits, true);
+					const vector<string>	withIndex	= iterateInflated(m_testCtx, *filter, &index, &numInits, true);
+
+					log << TestLog::Message << pattern << " on newer build: " << reference.size() << " events" << TestLog::EndMessage;
+
+					if (reference.empty() || withIndex != reference)
+					{
+						log << TestLog::Message << "ERROR: Iteration with stale index differs, expected:\n" << joinEvents(reference)
+												<< "got:\n" << joinEvents(withIndex)
+							<< TestLog::EndMessage;
+						allOk = false;
+					}
+				}
+			}
+		}
+
+		m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								allOk ? "Pass"				: "Fail");
+		return STOP;
+	}
+};
+
+} // hierarchy_index
+
+namespace instrumentation
+{
+
+using tcu::TestLog;
+using tcu::InstrumentationEvent;
+using std::vector;
+
+enum
+{
+	NUM_THREADS				= 4,
+	NUM_ROUNDS				= 3,
+	NUM_SCOPES_PER_THREAD	= 1000
+};
+
+static const deUint32 ACTIVE_CONTEXT = 1000u;
+
+static bool compareEventBegin (const InstrumentationEvent* a, const InstrumentationEvent* b)
+{
+	return a->beginNs < b->beginNs;
+}
+
+class RecordThread : public de::Thread
+{
+public:
+	RecordThread (void)
+		: m_contextId(0)
+	{
+	}
+
+	//! Record with own context, 0 to use active context.
+	void setContextId (deUint32 contextId) { m_contextId = contextId; }
+
+	void run (void)
+	{
+		const tcu::InstrumentationContextScope context (m_contextId);
+
+		for (int scopeNdx = 0; scopeNdx < NUM_SCOPES_PER_THREAD; scopeNdx++)
+		{
+			const tcu::InstrumentationScope outer ("outer");
+
+			{
+				const tcu::InstrumentationScope inner ("inner");
+			}
+		}
+	}
+
+private:
+	deUint32	m_contextId;
+};
+
+class InstrumentationTest : public tcu::TestCase
+{
+public:
+	InstrumentationTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "instrumentation", "tcu::Instrumentation event recording from multiple threads")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		TestLog&						log				= m_testCtx.getLog();
+		const bool						wasEnabled		= tcu::Instrumentation::isEnabled();
+		const deUint32					prevContext		= tcu::Instrumentation::getCurrentContext();
+		vector<InstrumentationEvent>	events;
+		bool							allOk			= true;
+		size_t							lastCollectStart;
+
+		tcu::Instrumentation::setEnabled(true);
+		tcu::Instrumentation::setActiveContext(ACTIVE_CONTEXT);
+		tcu::Instrumentation::collectEvents(events);
+		events.clear();
+
+		// First round records with active context, rest with own contexts. Threads of later rounds must reuse tracks.
+		for (int roundNdx = 0; roundNdx < NUM_ROUNDS; roundNdx++)
+		{
+			RecordThread threads[NUM_THREADS];
+
+			for (int threadNdx = 0; threadNdx < NUM_THREADS; threadNdx++)
+			{
+				threads[threadNdx].setContextId(roundNdx == 0 ? 0u : (deUint32)(1 + (roundNdx-1)*NUM_THREADS + threadNdx));
+				threads[threadNdx].start();
+			}
+
+			// Collect concurrently with recording
+			for (int iterNdx = 0; iterNdx < 100; iterNdx++)
+			{
+				tcu::Instrumentation::collectEvents(events);
+				deYield();
+			}
+
+			for (int threadNdx = 0; threadNdx < NUM_THREADS; threadNdx++)
+				threads[threadNdx].join();
+
+			// Unbinds tracks of exited threads
+			tcu::Instrumentation::collectEvents(events);
+		}
+
+		lastCollectStart = events.size();
+
+		tcu::Instrumentation::collectEvents(events);
+		tcu::Instrumentation::setActiveContext(prevContext);
+		tcu::Instrumentation::setEnabled(wasEnabled);
+
+		{
+			typedef std::map<deUint32, vector<const InstrumentationEvent*> > TrackEventMap;
+
+			std::map<deUint32, int>	numOuterPerContext;
+			std::map<deUint32, int>	numInnerPerContext;
+			TrackEventMap			outerPerTrack;
+			int						numBadEvents	= 0;
+
+			for (size_t eventNdx = 0; eventNdx < events.size(); eventNdx++)
+			{
+				const InstrumentationEvent&	event	= events[eventNdx];
+				const bool					isOuter	= deStringEqual(event.name, "outer") == DE_TRUE;
+
+				if (event.endNs < event.beginNs || event.depth != (isOuter ? 0u : 1u))
+					numBadEvents += 1;
+
+				if (isOuter)
+				{
+					numOuterPerContext[event.contextId] += 1;
+					outerPerTrack[event.trackNdx].push_back(&event);
+				}
+				else
+					numInnerPerContext[event.contextId] += 1;
+			}
+
+			log << TestLog::Message << "Collected " << events.size() << " events on " << outerPerTrack.size() << " tracks from " << NUM_ROUNDS*NUM_THREADS << " threads" << TestLog::EndMessage;
+
+			if (numBadEvents > 0)
+			{
+				log << TestLog::Message << "ERROR: " << numBadEvents << " events with invalid time span or depth" << TestLog::EndMessage;
+				allOk = false;
+			}
+
+			if (events.size() != (size_t)(NUM_ROUNDS*NUM_THREADS*NUM_SCOPES_PER_THREAD*2))
+			{
+				log << TestLog::Message << "ERROR: Expected " << NUM_ROUNDS*NUM_THREADS*NUM_SCOPES_PER_THREAD*2 << " events" << TestLog::EndMessage;
+				allOk = false;
+			}
+
+			if (outerPerTrack.size() > (size_t)NUM_THREADS)
+			{
+				log << TestLog::Message << "ERROR: Tracks of exited threads were not reused" << TestLog::EndMessage;
+				allOk = false;
+			}
+
+			// Each thread with own context, and all first round threads with active context
+			if (numOuterPerContext.size() != (size_t)((NUM_ROUNDS-1)*NUM_THREADS + 1))
+			{
+				log << TestLog::Message << "ERROR: Unexpected number of contexts" << TestLog::EndMessage;
+				allOk = false;
+			}
+
+			for (std::map<deUint32, int>::const_iterator iter = numOuterPerContext.begin(); iter != numOuterPerContext.end(); ++iter)
+			{
+				const int expected = iter->first == ACTIVE_CONTEXT ? NUM_THREADS*NUM_SCOPES_PER_THREAD : NUM_SCOPES_PER_THREAD;
+
+				if (iter->second != expected || numInnerPerContext[iter->first] != expected)
+				{
+					log << TestLog::Message << "ERROR: Unexpected number of events with context " << iter->first << TestLog::EndMessage;
+					allOk = false;
+				}
+			}
+
+			// Track is used by one thread at a time
+			for (TrackEventMap::iterator iter = outerPerTrack.begin(); iter != outerPerTrack.end(); ++iter)
+			{
+				vector<const InstrumentationEvent*>& trackEvents = iter->second;
+
+				std::sort(trackEvents.begin(), trackEvents.end(), compareEventBegin);
+
+				for (size_t eventNdx = 1; eventNdx < trackEvents.size(); eventNdx++)
+				{
+					if (trackEvents[eventNdx]->beginNs < trackEvents[eventNdx-1]->endNs)
+					{
+						log << TestLog::Message << "ERROR: Overlapping outermost events on track " << iter->first << TestLog::EndMessage;
+						allOk = false;
+						break;
+					}
+				}
+			}
+
+			// Ordering is guaranteed only within events returned by single collectEvents() call
+			for (size_t eventNdx = lastCollectStart+1; eventNdx < events.size(); eventNdx++)
+			{
+				if (events[eventNdx].beginNs < events[eventNdx-1].beginNs)
+				{
+					log << TestLog::Message << "ERROR: Events are not ordered by begin time" << TestLog::EndMessage;
+					allOk = false;
+					break;
+				}
+			}
+		}
+
+		tcu::logInstrumentationEvents(log, events);
+
+		m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								allOk ? "Pass"				: "Fail");
+		return STOP;
+	}
+};
+
+} // instrumentation
+
+namespace texture_util
+{
+
+using tcu::TestLog;
+using tcu::TextureFormat;
+using tcu::TextureLevel;
+using tcu::PixelBufferAccess;
+using tcu::ConstPixelBufferAccess;
+using tcu::Vec4;
+using tcu::IVec4;
+using std::vector;
+using std::string;
+
+//! Operation that is run once serially and once split to multiple threads.
+class TextureOp
+{
+public:
+	virtual			~TextureOp	(void) {}
+	virtual void	run			(const PixelBufferAccess& dst, const ConstPixelBufferAccess& src) const = 0;
+};
+
+class ClearFloatOp : public TextureOp
+{
+public:
+	void run (const PixelBufferAccess& dst, const ConstPixelBufferAccess&) const { tcu::clear(dst, Vec4(0.25f, 0.5f, 0.75f, 1.0f)); }
+};
+
+class ClearIntOp : public TextureOp
+{
+public:
+	void run (const PixelBufferAccess& dst, const ConstPixelBufferAccess&) const { tcu::clear(dst, IVec4(-3, 7, 100, 1)); }
+};
+
+class GradientOp : public TextureOp
+{
+public:
+	void run (const PixelBufferAccess& dst, const ConstPixelBufferAccess&) const { tcu::fillWithComponentGradients(dst, Vec4(-1.0f, 0.0f, 0.5f, 1.0f), Vec4(1.0f, 1.0f, 0.0f, 0.0f)); }
+};
+
+class GridOp : public TextureOp
+{
+public:
+	void run (const PixelBufferAccess& dst, const ConstPixelBufferAccess&) const { tcu::fillWithGrid(dst, 7, Vec4(1.0f, 0.0f, 0.0f, 1.0f), Vec4(0.0f, 0.5f, 1.0f, 0.0f)); }
+};
+
+class CopyOp : public TextureOp
+{
+public:
+	void run (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src) const { tcu::copy(dst, src); }
+};
+
+class BoxFilterOp : public TextureOp
+{
+public:
+	void run (const PixelBufferAccess& dst, const ConstPixelBufferAccess& src) const { tcu::boxFilter(dst, src); }
+};
+
+struct OpCase
+{
+	const char*			name;
+	const TextureOp*	op;
+	TextureFormat		srcFormat;
+	TextureFormat		dstFormat;
+	tcu::IVec3			srcSize;
+	tcu::IVec3			dstSize;
+};
+
+bool isBitExactEqual (const ConstPixelBufferAccess& a, const ConstPixelBufferAccess& b)
+{
+	const int rowSize = a.getWidth()*a.getFormat().getPixelSize();
+
+	for (int z = 0; z < a.getDepth(); z++)
+	for (int y = 0; y < a.getHeight(); y++)
+	{
+		if (deMemCmp(a.getPixelPtr(0, y, z), b.getPixelPtr(0, y, z), rowSize) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+class ParallelTextureUtilTest : public tcu::TestCase
+{
+public:
+	ParallelTextureUtilTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "texture_util_parallel", "Threaded tcu::TextureUtil operations match serial execution")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const TextureFormat		rgba8		(TextureFormat::RGBA,	TextureFormat::UNORM_INT8);
+		const TextureFormat		srgba8		(TextureFormat::sRGBA,	TextureFormat::UNORM_INT8);
+		const TextureFormat		rgb565		(TextureFormat::RGB,	TextureFormat::UNORM_SHORT_565);
+		const TextureFormat		rgba32f		(TextureFormat::RGBA,	TextureFormat::FLOAT);
+		const TextureFormat		rgba16i		(TextureFormat::RGBA,	TextureFormat::SIGNED_INT16);
+		const TextureFormat		rgba32i		(TextureFormat::RGBA,	TextureFormat::SIGNED_INT32);
+		const TextureFormat		d24s8		(TextureFormat::DS,		TextureFormat::UNSIGNED_INT_24_8);
+		const TextureFormat		d32fs8		(TextureFormat::DS,		TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV);
+		// Sizes are chosen so that operations are split to multiple threads.
+		const tcu::IVec3		size		(256, 256, 4);
+		const tcu::IVec3		size2D		(512, 512, 1);
+		const tcu::IVec3		sizeLarge	(1024, 512, 2);
+		const ClearFloatOp		clearFloat;
+		const ClearIntOp		clearInt;
+		const GradientOp		gradient;
+		const GridOp			grid;
+		const CopyOp			copy;
+		const BoxFilterOp		boxFilter;
+
+		const OpCase			cases[]		=
+		{
+			{ "clear_rgba8",			&clearFloat,	rgba8,		rgba8,		sizeLarge,	sizeLarge					},
+			{ "clear_rgba32f",			&clearFloat,	rgba32f,	rgba32f,	size,		size						},
+			{ "clear_rgba32i",			&clearInt,		rgba32i,	rgba32i,	size,		size						},
+			{ "gradient_2d_rgba32f",	&gradient,		rgba32f,	rgba32f,	size2D,		size2D						},
+			{ "gradient_3d_rgb565",		&gradient,		rgb565,		rgb565,		size,		size						},
+			{ "grid_2d_rgba8",			&grid,			rgba8,		rgba8,		size2D,		size2D						},
+			{ "grid_3d_d24s8",			&grid,			d24s8,		d24s8,		size,		size						},
+			{ "copy_rgba8",				&copy,			rgba8,		rgba8,		sizeLarge,	sizeLarge					},
+			{ "copy_rgba32f_rgba8",		&copy,			rgba32f,	rgba8,		size,		size						},
+			{ "copy_rgba16i_rgba32i",	&copy,			rgba16i,	rgba32i,	size,		size						},
+			{ "copy_d32fs8_d24s8",		&copy,			d32fs8,		d24s8,		size,		size						},
+			{ "box_filter_2d_srgba8",	&boxFilter,		srgba8,		srgba8,		size2D,		tcu::IVec3(256, 256, 1)		},
+			{ "box_filter_3d_rgba32f",	&boxFilter,		rgba32f,	rgba32f,	size,		tcu::IVec3(128, 128, 2)		},
+			{ "box_filter_npot_rgb565",	&boxFilter,		rgb565,		rgb565,		size,		tcu::IVec3(171, 85, 3)		},
+		};
+
+		TestLog&		log				= m_testCtx.getLog();
+		const int		origMaxThreads	= de::getMaxParallelThreads();
+		bool			allOk			= true;
+
+		for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(cases); caseNdx++)
+		{
+			const OpCase&		opCase		= cases[caseNdx];
+			TextureLevel		src			(opCase.srcFormat, opCase.srcSize.x(), opCase.srcSize.y(), opCase.srcSize.z());
+			TextureLevel		serial		(opCase.dstFormat, opCase.dstSize.x(), opCase.dstSize.y(), opCase.dstSize.z());
+			TextureLevel		threaded	(opCase.dstFormat, opCase.dstSize.x(), opCase.dstSize.y(), opCase.dstSize.z());
+
+			de::setMaxParallelThreads(1);
+			tcu::fillWithComponentGradients(src.getAccess(), Vec4(-0.5f, 0.0f, 0.25f, 1.0f), Vec4(1.0f, 1.0f, 0.0f, 0.0f));
+			opCase.op->run(serial.getAccess(), src.getAccess());
+
+			de::setMaxParallelThreads(4);
+			opCase.op->run(threaded.getAccess(), src.getAccess());
+
+			if (!isBitExactEqual(serial.getAccess(), threaded.getAccess()))
+			{
+				log << TestLog::Message << "ERROR: " << opCase.name << ": threaded result differs from serial result" << TestLog::EndMessage;
+				allOk = false;
+			}
+		}
+
+		de::setMaxParallelThreads(origMaxThreads);
+
+		// Mipmap chain of constant color remains constant and box filter averages 2x2 blocks
+		{
+			tcu::Texture2D	texture		(rgba32f, 16, 9);
+			const Vec4		colors[]	= { Vec4(0.0f), Vec4(1.0f), Vec4(0.5f), Vec4(0.25f) };
+
+			texture.allocLevel(0);
+			tcu::clear(texture.getLevel(0), Vec4(0.5f, 0.25f, 1.0f, 0.0f));
+			tcu::generateMipmaps(texture);
+
+			for (int levelNdx = 0; levelNdx < texture.getNumLevels(); levelNdx++)
+			{
+				const ConstPixelBufferAccess& level = texture.getLevel(levelNdx);
+
+				if (level.getPixel(level.getWidth()-1, level.getHeight()-1) != Vec4(0.5f, 0.25f, 1.0f, 0.0f))
+				{
+					log << TestLog::Message << "ERROR: Level " << levelNdx << " of constant color mipmap chain is not constant" << TestLog::EndMessage;
+					allOk = false;
+				}
+			}
+
+			for (int ndx = 0; ndx < 4; ndx++)
+				texture.getLevel(0).setPixel(colors[ndx], 2 + ndx%2, 4 + ndx/2);
+
+			tcu::generateMipmaps(texture);
+
+			if (texture.getLevel(1).getPixel(1, 2) != Vec4(0.4375f))
+			{
+				log << TestLog::Message << "ERROR: Box filter result " << texture.getLevel(1).getPixel(1, 2) << ", expected " << Vec4(0.4375f) << TestLog::EndMessage;
+				allOk = false;
+			}
+		}
+
+		m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								allOk ? "Pass"				: "Fail");
+		return STOP;
+	}
+};
+
+} // texture_util
+
+class ThrowingRangeTask : public de::RangeTask
+{
+public:
+	ThrowingRangeTask (qpTestResult result)
+		: m_result(result)
+	{
+	}
+
+	void execute (int begin, int end)
+	{
+		if (begin <= 50 && 50 < end)
+		{
+			switch (m_result)
+			{
+				case QP_TEST_RESULT_NOT_SUPPORTED:	throw tcu::NotSupportedError("Not supported");
+				case QP_TEST_RESULT_RESOURCE_ERROR:	throw tcu::ResourceError("Resource error");
+				default:							throw tcu::TestError("Test error");
+			}
+		}
+	}
+
+private:
+	const qpTestResult	m_result;
+};
+
+class ParallelExceptionTest : public tcu::TestCase
+{
+public:
+	ParallelExceptionTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "parallel_exceptions", "tcu exceptions thrown from de::parallelFor() workers keep their type")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const qpTestResult	results[]		= { QP_TEST_RESULT_NOT_SUPPORTED, QP_TEST_RESULT_RESOURCE_ERROR, QP_TEST_RESULT_FAIL };
+		const int			origMaxThreads	= de::getMaxParallelThreads();
+		bool				allOk			= true;
+
+		de::setMaxParallelThreads(4);
+
+		for (int resultNdx = 0; resultNdx < DE_LENGTH_OF_ARRAY(results); resultNdx++)
+		{
+			ThrowingRangeTask	task		(results[resultNdx]);
+			qpTestResult		caught		= QP_TEST_RESULT_LAST;
+			bool				isFatal		= false;
+
+			try
+			{
+				de::parallelFor(100, 1, task);
+			}
+			catch (const tcu::TestException& e)
+			{
+				caught	= e.getTestResult();
+				isFatal	= e.isFatal();
+			}
+			catch (const std::exception&)
+			{
+			}
+
+			if (caught != results[resultNdx] || isFatal != (results[resultNdx] == QP_TEST_RESULT_RESOURCE_ERROR))
+			{
+				m_testCtx.getLog() << TestLog::Message << "ERROR: Expected " << qpGetTestResultName(results[resultNdx]) << " from parallelFor()" << TestLog::EndMessage;
+				allOk = false;
+			}
+		}
+
+		de::setMaxParallelThreads(origMaxThreads);
+
+		m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								allOk ? "Pass"				: "Fail");
+		return STOP;
+	}
+};
+
+namespace call_trace
+{
+
+using tcu::TestLog;
+using std::string;
+using std::vector;
+
+enum
+{
+	TRACE_CAPACITY	= 4,
+	NUM_VIEWPORTS	= 10
+};
+
+static void			GLW_APIENTRY stubViewport	(glw::GLint, glw::GLint, glw::GLsizei, glw::GLsizei)		{}
+static void			GLW_APIENTRY stubClearColor	(glw::GLfloat, glw::GLfloat, glw::GLfloat, glw::GLfloat)	{}
+static glw::GLenum	GLW_APIENTRY stubGetError	(void)														{ return GL_INVALID_ENUM; }
+
+//! Decode as decode-gl-call-trace prints it, return value on separate line.
+static string decodeRecord (const glu::CallTraceRecord& record)
+{
+	std::ostringstream	callStr;
+	std::ostringstream	returnStr;
+
+	glu::decodeCallTraceRecord(record, callStr, returnStr);
+
+	return returnStr.str().empty() ? callStr.str() : callStr.str() + "\n" + returnStr.str();
+}
+
+class CallTraceTest : public tcu::TestCase
+{
+public:
+	CallTraceTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "gl_call_trace", "glu::CallLogWrapper binary call trace ring buffer and decoding")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		// Oldest calls are dropped once buffer wraps around
+		static const char* const	s_expected[]	=
+		{
+			"glViewport(8, -8, 18, 28);",
+			"glViewport(9, -9, 19, 29);",
+			"glClearColor(0.25, 0.5, 1, -1);",
+			"glGetError();\n// GL_INVALID_ENUM returned",
+		};
+		DE_STATIC_ASSERT(DE_LENGTH_OF_ARRAY(s_expected) == TRACE_CAPACITY);
+
+		TestLog&				log			= m_testCtx.getLog();
+		const string			filename	= string("dit-gl-call-trace.") + de::toString(deProcess_getCurrentId()) + ".bin";
+		glw::Functions			gl;
+		glu::CallLogWrapper		wrapper		(gl, log);
+		bool					allOk		= true;
+
+		deMemset(&gl, 0, sizeof(gl));
+		gl.viewport		= stubViewport;
+		gl.clearColor	= stubClearColor;
+		gl.getError		= stubGetError;
+
+		wrapper.enableCallTrace(true, TRACE_CAPACITY);
+
+		for (int ndx = 0; ndx < NUM_VIEWPORTS; ndx++)
+			wrapper.glViewport(ndx, -ndx, 10 + ndx, 20 + ndx);
+
+		wrapper.glClearColor(0.25f, 0.5f, 1.0f, -1.0f);
+		wrapper.glGetError();
+
+		// Calls made with trace disabled are not recorded
+		wrapper.enableCallTrace(false, TRACE_CAPACITY);
+		wrapper.glViewport(0, 0, 1, 1);
+
+		{
+			const glu::CallTraceBuffer&	trace	= *wrapper.getCallTrace();
+
+			if (trace.getNumRecords() != TRACE_CAPACITY || trace.getNumDroppedRecords() != NUM_VIEWPORTS + 2 - TRACE_CAPACITY)
+			{
+				log << TestLog::Message << "ERROR: Got " << trace.getNumRecords() << " records and " << trace.getNumDroppedRecords() << " dropped records, "
+					<< "expected " << (int)TRACE_CAPACITY << " and " << (NUM_VIEWPORTS + 2 - TRACE_CAPACITY) << TestLog::EndMessage;
+				allOk = false;
+			}
+
+			for (size_t ndx = 0; ndx < de::min<size_t>(trace.getNumRecords(), TRACE_CAPACITY); ndx++)
+			{
+				const string decoded = decodeRecord(trace.getRecord(ndx));
+
+				if (decoded != s_expected[ndx])
+				{
+					log << TestLog::Message << "ERROR: Record " << ndx << " decoded as \"" << decoded << "\", expected \"" << s_expected[ndx] << "\"" << TestLog::EndMessage;
+					allOk = false;
+				}
+			}
+
+			// Round trip through trace file as read by decode-gl-call-trace
+			{
+				vector<glu::CallTraceRecord> records;
+
+				wrapper.writeCallTrace(filename.c_str());
+
+				try
+				{
+					glu::readCallTraceFile(filename.c_str(), records);
+				}
+				catch (...)
+				{
+					std::remove(filename.c_str());
+					throw;
+				}
+
+				std::remove(filename.c_str());
+
+				if (records.size() != trace.getNumRecords())
+				{
+					log << TestLog::Message << "ERROR: Read " << records.size() << " records from trace file, expected " << trace.getNumRecords() << TestLog::EndMessage;
+					allOk = false;
+				}
+
+				for (size_t ndx = 0; ndx < de::min(records.size(), trace.getNumRecords()); ndx++)
+				{
+					if (deMemCmp(&records[ndx], &trace.getRecord(ndx), sizeof(glu::CallTraceRecord)) != 0 || decodeRecord(records[ndx]) != decodeRecord(trace.getRecord(ndx)))
+					{
+						log << TestLog::Message << "ERROR: Record " << ndx << " changed in trace file" << TestLog::EndMessage;
+						allOk = false;
+					}
+				}
+			}
+		}
+
+		wrapper.logCallTrace();
+
+		m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								allOk ? "Pass"				: "Fail");
+		return STOP;
+	}
+};
+
+} // call_trace
+
 class CommonFrameworkTests : public tcu::TestCaseGroup
 {
 public:
@@ -894,6 +2362,281 @@ public:
 								   tcu::FloatFormat_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "either","tcu::Either_selfTest()",
 								   tcu::Either_selfTest));
+		addChild(new hierarchy_index::HierarchyIndexTest(m_testCtx));
+		addChild(new instrumentation::InstrumentationTest(m_testCtx));
+		addChild(new texture_util::ParallelTextureUtilTest(m_testCtx));
+		addChild(new ParallelExceptionTest(m_testCtx));
+		addChild(new call_trace::CallTraceTest(m_testCtx));
+	}
+};
+
+class VertexAttribBatchReadTest : public tcu::TestCase
+{
+public:
+	VertexAttribBatchReadTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "vertex_attrib_batch_read", "Compare rr batch attribute reads against per-vertex reads")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const int		numElements		= 64;
+		const int		maxStride		= 37;
+		const int		numReads		= 150;
+		TestLog&		log				= m_testCtx.getLog();
+		de::Random		rnd				(0x4fa21);
+		vector<deUint8>	data			(numElements*maxStride);
+		vector<int>		instanceNdx		(numReads);
+		vector<int>		vertexNdx		(numReads);
+		int				numFailed		= 0;
+
+		for (size_t ndx = 0; ndx < data.size(); ndx++)
+			data[ndx] = rnd.getUint8();
+
+		for (int typeNdx = 0; typeNdx < rr::VERTEXATTRIBTYPE_DONT_CARE; typeNdx++)
+		for (int size = 1; size <= 4; size++)
+		for (int divisor = 0; divisor <= 3; divisor += 3)
+		for (int strideNdx = 0; strideNdx < 2; strideNdx++)
+		{
+			const rr::VertexAttribType	type	= (rr::VertexAttribType)typeNdx;
+			const rr::VertexAttrib		attrib	(type, size, strideNdx == 0 ? 0 : maxStride, divisor, &data[0]);
+
+			if (!rr::isValidVertexAttrib(attrib))
+				continue;
+
+			for (int readNdx = 0; readNdx < numReads; readNdx++)
+			{
+				instanceNdx[readNdx]	= rnd.getInt(0, numElements*de::max(divisor, 1) - 1);
+				vertexNdx[readNdx]		= rnd.getInt(0, numElements - 1);
+			}
+
+			if (!compareReads(attrib, instanceNdx, vertexNdx))
+			{
+				log << TestLog::Message << "ERROR: Batch read mismatch, type = " << typeNdx << ", size = " << size << ", divisor = " << divisor << ", stride = " << attrib.stride << TestLog::EndMessage;
+				numFailed++;
+			}
+		}
+
+		// Generic attribute
+		{
+			const rr::VertexAttrib attrib (tcu::Vec4(0.25f, 0.5f, 0.75f, 1.0f));
+
+			if (!compareReads(attrib, instanceNdx, vertexNdx))
+			{
+				log << TestLog::Message << "ERROR: Batch read mismatch with generic attribute" << TestLog::EndMessage;
+				numFailed++;
+			}
+		}
+
+		m_testCtx.setTestResult(numFailed == 0	? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								numFailed == 0	? "Pass"				: "Batch read results differ");
+		return STOP;
+	}
+
+private:
+	template<typename T>
+	static bool compareReadsAs (const rr::VertexAttrib& attrib, const vector<int>& instanceNdx, const vector<int>& vertexNdx)
+	{
+		const int	count	= (int)instanceNdx.size();
+		vector<T>	batched	(count);
+
+		rr::readVertexAttribs(&batched[0], attrib, &instanceNdx[0], &vertexNdx[0], count);
+
+		for (int ndx = 0; ndx < count; ndx++)
+		{
+			T reference;
+
+			rr::readVertexAttrib(reference, attrib, instanceNdx[ndx], vertexNdx[ndx]);
+
+			if (deMemCmp(reference.getPtr(), batched[ndx].getPtr(), sizeof(T)) != 0)
+				return false;
+		}
+
+		return true;
+	}
+
+	static bool comparePacketReads (const rr::VertexAttrib& attrib, const vector<int>& instanceNdx, const vector<int>& vertexNdx)
+	{
+		const int					count		= (int)instanceNdx.size();
+		rr::VertexPacketAllocator	allocator	(1);
+		vector<rr::VertexPacket*>	packets		= allocator.allocArray(count);
+
+		for (int ndx = 0; ndx < count; ndx++)
+		{
+			packets[ndx]->instanceNdx	= instanceNdx[ndx];
+			packets[ndx]->vertexNdx		= vertexNdx[ndx];
+		}
+
+		rr::readVertexAttribsToPosition(attrib, &packets[0], count);
+		rr::readVertexAttribsToOutput(attrib, 0, &packets[0], count);
+
+		for (int ndx = 0; ndx < count; ndx++)
+		{
+			const tcu::Vec4 reference	= rr::readVertexAttribFloat(attrib, instanceNdx[ndx], vertexNdx[ndx]);
+			const tcu::Vec4 output		= packets[ndx]->outputs[0].get<float>();
+
+			if (deMemCmp(reference.getPtr(), packets[ndx]->position.getPtr(), sizeof(tcu::Vec4)) != 0 ||
+				deMemCmp(reference.getPtr(), output.getPtr(), sizeof(tcu::Vec4)) != 0)
+				return false;
+		}
+
+		return true;
+	}
+
+	static bool compareReads (const rr::VertexAttrib& attrib, const vector<int>& instanceNdx, const vector<int>& vertexNdx)
+	{
+		switch (attrib.type)
+		{
+			case rr::VERTEXATTRIBTYPE_PURE_UINT8:
+			case rr::VERTEXATTRIBTYPE_PURE_UINT16:
+			case rr::VERTEXATTRIBTYPE_PURE_UINT32:
+				return compareReadsAs<tcu::UVec4>(attrib, instanceNdx, vertexNdx);
+
+			case rr::VERTEXATTRIBTYPE_PURE_INT8:
+			case rr::VERTEXATTRIBTYPE_PURE_INT16:
+			case rr::VERTEXATTRIBTYPE_PURE_INT32:
+				return compareReadsAs<tcu::IVec4>(attrib, instanceNdx, vertexNdx);
+
+			case rr::VERTEXATTRIBTYPE_DONT_CARE:
+				return compareReadsAs<tcu::Vec4>(attrib, instanceNdx, vertexNdx) &&
+					   compareReadsAs<tcu::IVec4>(attrib, instanceNdx, vertexNdx) &&
+					   compareReadsAs<tcu::UVec4>(attrib, instanceNdx, vertexNdx) &&
+					   comparePacketReads(attrib, instanceNdx, vertexNdx);
+
+			default:
+				return compareReadsAs<tcu::Vec4>(attrib, instanceNdx, vertexNdx) &&
+					   comparePacketReads(attrib, instanceNdx, vertexNdx);
+		}
+	}
+};
+
+class MultisampleResolveTest : public tcu::TestCase
+{
+public:
+	MultisampleResolveTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "multisample_resolve", "Compare rr multisample resolve against per-sample reads")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		using tcu::TextureFormat;
+		using tcu::TextureLevel;
+		using tcu::Vec4;
+
+		struct ResolveCase
+		{
+			TextureFormat	format;
+			int				numSamples;
+			int				width;
+			int				height;
+		};
+
+		const ResolveCase cases[] =
+		{
+			{ TextureFormat(TextureFormat::RGBA,	TextureFormat::UNORM_INT8),						4,	256,	256	},
+			{ TextureFormat(TextureFormat::sRGBA,	TextureFormat::UNORM_INT8),						2,	61,		17	},
+			{ TextureFormat(TextureFormat::RGB,		TextureFormat::UNORM_INT8),						8,	33,		40	},
+			{ TextureFormat(TextureFormat::RGBA,	TextureFormat::FLOAT),							4,	128,	96	},
+			{ TextureFormat(TextureFormat::RGB,		TextureFormat::FLOAT),							3,	29,		31	},
+			{ TextureFormat(TextureFormat::RGB,		TextureFormat::UNORM_SHORT_565),				4,	64,		64	},
+			{ TextureFormat(TextureFormat::RGBA,	TextureFormat::SIGNED_INT32),					4,	16,		16	},
+			{ TextureFormat(TextureFormat::D,		TextureFormat::FLOAT),							4,	128,	128	},
+			{ TextureFormat(TextureFormat::D,		TextureFormat::UNORM_INT16),					4,	45,		12	},
+			{ TextureFormat(TextureFormat::DS,		TextureFormat::UNSIGNED_INT_24_8),				4,	64,		32	},
+			{ TextureFormat(TextureFormat::DS,		TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV),	8,	32,		64	},
+		};
+
+		TestLog&		log			= m_testCtx.getLog();
+		de::Random		rnd			(0x73e1);
+		int				numFailed	= 0;
+
+		for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(cases); caseNdx++)
+		{
+			const ResolveCase&							resolveCase	= cases[caseNdx];
+			const int									numSamples	= resolveCase.numSamples;
+			const bool									hasDepth	= tcu::hasDepthComponent(resolveCase.format.order);
+			const bool									hasStencil	= tcu::hasStencilComponent(resolveCase.format.order);
+			TextureLevel								msBuffer	(resolveCase.format, numSamples, resolveCase.width, resolveCase.height);
+			TextureLevel								resolved	(resolveCase.format, resolveCase.width, resolveCase.height);
+			TextureLevel								reference	(resolveCase.format, resolveCase.width, resolveCase.height);
+			const tcu::PixelBufferAccess				ms			= msBuffer.getAccess();
+			const rr::MultisampleConstPixelBufferAccess	msAccess	= rr::MultisampleConstPixelBufferAccess::fromMultisampleAccess(ms);
+
+			deMemset(resolved.getAccess().getDataPtr(), 0, resolveCase.format.getPixelSize()*resolveCase.width*resolveCase.height);
+			deMemset(reference.getAccess().getDataPtr(), 0, resolveCase.format.getPixelSize()*resolveCase.width*resolveCase.height);
+
+			for (int y = 0; y < resolveCase.height; y++)
+			for (int x = 0; x < resolveCase.width; x++)
+			for (int s = 0; s < numSamples; s++)
+			{
+				if (hasDepth)
+					ms.setPixDepth(rnd.getFloat(), s, x, y);
+				if (hasStencil)
+					ms.setPixStencil(rnd.getInt(0, 255), s, x, y);
+				if (!hasDepth && !hasStencil)
+				{
+					if (tcu::getTextureChannelClass(resolveCase.format.type) == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER)
+						ms.setPixel(tcu::IVec4(rnd.getInt(-1000, 1000), rnd.getInt(-1000, 1000), rnd.getInt(-1000, 1000), rnd.getInt(-1000, 1000)), s, x, y);
+					else
+						ms.setPixel(Vec4(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), rnd.getFloat()), s, x, y);
+				}
+			}
+
+			// Reference resolve through per-sample getters
+			for (int y = 0; y < resolveCase.height; y++)
+			for (int x = 0; x < resolveCase.width; x++)
+			{
+				if (hasDepth)
+				{
+					float sum = 0.0f;
+					for (int s = 0; s < numSamples; s++)
+						sum += ms.getPixDepth(s, x, y);
+					reference.getAccess().setPixDepth(sum*(1.0f / (float)numSamples), x, y);
+				}
+
+				if (hasStencil)
+					reference.getAccess().setPixStencil(ms.getPixStencil(0, x, y), x, y);
+
+				if (!hasDepth && !hasStencil)
+				{
+					Vec4 sum;
+					for (int s = 0; s < numSamples; s++)
+						sum += ms.getPixel(s, x, y);
+					reference.getAccess().setPixel(sum*(1.0f / (float)numSamples), x, y);
+				}
+			}
+
+			rr::resolveMultisampleBuffer(resolved.getAccess(), msAccess);
+
+			if (!texture_util::isBitExactEqual(reference.getAccess(), resolved.getAccess()))
+			{
+				log << TestLog::Message << "ERROR: Resolve of " << resolveCase.format << " with " << numSamples << " samples differs from reference" << TestLog::EndMessage;
+				numFailed += 1;
+			}
+
+			// Sample views
+			for (int s = 0; s < numSamples; s++)
+			{
+				const tcu::ConstPixelBufferAccess	sample	= rr::getSample(msAccess, s);
+				bool								isOk	= sample.getWidth() == resolveCase.width && sample.getHeight() == resolveCase.height;
+
+				for (int y = 0; y < resolveCase.height && isOk; y++)
+				for (int x = 0; x < resolveCase.width && isOk; x++)
+					isOk = deMemCmp(sample.getPixelPtr(x, y), ms.getPixelPtr(s, x, y), resolveCase.format.getPixelSize()) == 0;
+
+				if (!isOk)
+				{
+					log << TestLog::Message << "ERROR: Sample " << s << " view of " << resolveCase.format << " does not match buffer contents" << TestLog::EndMessage;
+					numFailed += 1;
+					break;
+				}
+			}
+		}
+
+		m_testCtx.setTestResult(numFailed == 0 ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								numFailed == 0 ? "Pass"					: "Fail");
+		return STOP;
 	}
 };
 
@@ -908,6 +2651,16 @@ public:
 	void init (void)
 	{
 		addChild(new ConstantInterpolationTest(m_testCtx));
+		addChild(new VertexCacheTest(m_testCtx, "vertex_cache_triangles",				"Vertex cache with indexed triangles",				VertexCacheTest::DRAWTYPE_TRIANGLES));
+		addChild(new VertexCacheTest(m_testCtx, "vertex_cache_triangle_strip_restart",	"Vertex cache with primitive restart",				VertexCacheTest::DRAWTYPE_TRIANGLE_STRIP_RESTART));
+		addChild(new VertexCacheTest(m_testCtx, "vertex_cache_instanced",				"Vertex cache with instanced indexed triangles",	VertexCacheTest::DRAWTYPE_TRIANGLES_INSTANCED));
+		addChild(new FragmentOpsDepthFormatTest(m_testCtx, "fragment_ops_depth_d16",			tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNORM_INT16)));
+		addChild(new FragmentOpsDepthFormatTest(m_testCtx, "fragment_ops_depth_d24s8",			tcu::TextureFormat(tcu::TextureFormat::DS, tcu::TextureFormat::UNSIGNED_INT_24_8)));
+		addChild(new FragmentOpsDepthFormatTest(m_testCtx, "fragment_ops_depth_d32f",			tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::FLOAT)));
+		addChild(new FragmentOpsDepthFormatTest(m_testCtx, "fragment_ops_depth_d8",				tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNORM_INT8)));
+		addChild(new FragmentOpsThroughputTest(m_testCtx));
+		addChild(new VertexAttribBatchReadTest(m_testCtx));
+		addChild(new MultisampleResolveTest(m_testCtx));
 	}
 };
 
@@ -929,6 +2682,9 @@ void FrameworkTests::init (void)
 	addChild(new ReferenceRendererTests	(m_testCtx));
 	addChild(createTextureFormatTests	(m_testCtx));
 	addChild(createAstcTests			(m_testCtx));
+	addChild(createEtcTests				(m_testCtx));
+	addChild(createShaderLibraryTests	(m_testCtx));
+	addChild(createTextureSamplerTests	(m_testCtx));
 	addChild(createVulkanTests			(m_testCtx));
 }
 
@@ -30,7 +30,9 @@
 #include "tcuTestLog.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuRGBA.hpp"
+#include "tcuVectorUtil.hpp"
 #include "deFilePath.hpp"
+#include "deRandom.hpp"
 #include "deClock.h"
 
 namespace dit
@@ -154,6 +156,130 @@ private:
 	const bool				m_expectedResult;
 };
 
+//! Straightforward exhaustive search used to verify optimized position deviation compare.
+static int countPositionDeviationFailingPixels (const tcu::ConstPixelBufferAccess& reference, const tcu::ConstPixelBufferAccess& result, const tcu::UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue)
+{
+	const int	width				= reference.getWidth();
+	const int	height				= reference.getHeight();
+	const int	depth				= reference.getDepth();
+	const int	beginX				= (acceptOutOfBoundsAsAnyValue) ? (maxPositionDeviation.x()) : (0);
+	const int	beginY				= (acceptOutOfBoundsAsAnyValue) ? (maxPositionDeviation.y()) : (0);
+	const int	beginZ				= (acceptOutOfBoundsAsAnyValue) ? (maxPositionDeviation.z()) : (0);
+	const int	endX				= (acceptOutOfBoundsAsAnyValue) ? (width  - maxPositionDeviation.x()) : (width);
+	const int	endY				= (acceptOutOfBoundsAsAnyValue) ? (height - maxPositionDeviation.y()) : (height);
+	const int	endZ				= (acceptOutOfBoundsAsAnyValue) ? (depth  - maxPositionDeviation.z()) : (depth);
+	int			numFailingPixels	= 0;
+
+	for (int z = beginZ; z < endZ; z++)
+	for (int y = beginY; y < endY; y++)
+	for (int x = beginX; x < endX; x++)
+	{
+		const tcu::IVec4	refPix	= reference.getPixelInt(x, y, z);
+		const tcu::IVec4	cmpPix	= result.getPixelInt(x, y, z);
+		bool				refOk	= false;
+		bool				cmpOk	= false;
+
+		for (int sz = de::max(0, z - maxPositionDeviation.z()); sz <= de::min(depth  - 1, z + maxPositionDeviation.z()); ++sz)
+		for (int sy = de::max(0, y - maxPositionDeviation.y()); sy <= de::min(height - 1, y + maxPositionDeviation.y()); ++sy)
+		for (int sx = de::max(0, x - maxPositionDeviation.x()); sx <= de::min(width  - 1, x + maxPositionDeviation.x()); ++sx)
+		{
+			refOk = refOk || tcu::boolAll(tcu::lessThanEqual(tcu::abs(refPix - result.getPixelInt(sx, sy, sz)).cast<deUint32>(), threshold));
+			cmpOk = cmpOk || tcu::boolAll(tcu::lessThanEqual(tcu::abs(cmpPix - reference.getPixelInt(sx, sy, sz)).cast<deUint32>(), threshold));
+		}
+
+		if (!refOk || !cmpOk)
+			++numFailingPixels;
+	}
+
+	return numFailingPixels;
+}
+
+class PositionDeviationCompareCase : public tcu::TestCase
+{
+public:
+	PositionDeviationCompareCase (tcu::TestContext& testCtx, const char* name, const tcu::TextureFormat& format, const tcu::IVec3& size, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, float noiseProbability, deUint32 seed)
+		: tcu::TestCase					(testCtx, name, "")
+		, m_format						(format)
+		, m_size						(size)
+		, m_maxPositionDeviation		(maxPositionDeviation)
+		, m_acceptOutOfBoundsAsAnyValue	(acceptOutOfBoundsAsAnyValue)
+		, m_noiseProbability			(noiseProbability)
+		, m_seed						(seed)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const tcu::UVec4	threshold		(2, 2, 2, 2);
+		const bool			isLargeRange	= tcu::getTextureChannelClass(m_format.type) == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER;
+		tcu::TextureLevel	reference		(m_format, m_size.x(), m_size.y(), m_size.z());
+		tcu::TextureLevel	result			(m_format, m_size.x(), m_size.y(), m_size.z());
+		de::Random			rnd				(m_seed);
+		int					expectedCount;
+		bool				allowedOk;
+		bool				tooStrictOk		= false;
+		deUint64			compareTime;
+
+		// Blocky reference with result shifted by a random offset per block and sprinkled noise
+		for (int z = 0; z < m_size.z(); z++)
+		for (int y = 0; y < m_size.y(); y++)
+		for (int x = 0; x < m_size.x(); x++)
+		{
+			const int			blockNdx	= (x / 5) + (y / 7)*17 + z*31;
+			const tcu::IVec4	value		= tcu::IVec4((blockNdx*37) & 0xff, (blockNdx*11 + z) & 0xff, (255 - blockNdx*3) & 0xff, 255);
+
+			reference.getAccess().setPixel(isLargeRange ? value*tcu::IVec4(0x1000000) : value, x, y, z);
+		}
+
+		for (int z = 0; z < m_size.z(); z++)
+		for (int y = 0; y < m_size.y(); y++)
+		for (int x = 0; x < m_size.x(); x++)
+		{
+			const int	dx	= rnd.getInt(-2, 2);
+			const int	dy	= rnd.getInt(-2, 2);
+			const int	sx	= de::clamp(x + dx, 0, m_size.x()-1);
+			const int	sy	= de::clamp(y + dy, 0, m_size.y()-1);
+			tcu::IVec4	pix	= reference.getAccess().getPixelInt(sx, sy, z);
+
+			if (rnd.getFloat() < m_noiseProbability)
+				pix[rnd.getInt(0, 2)] += rnd.getInt(-5, 5);
+
+			result.getAccess().setPixel(pix, x, y, z);
+		}
+
+		expectedCount = countPositionDeviationFailingPixels(reference, result, threshold, m_maxPositionDeviation, m_acceptOutOfBoundsAsAnyValue);
+
+		m_testCtx.getLog() << TestLog::Message << "Expecting " << expectedCount << " failing pixels" << TestLog::EndMessage;
+
+		{
+			const deUint64 startTime = deGetMicroseconds();
+			allowedOk = tcu::intThresholdPositionDeviationErrorThresholdCompare(m_testCtx.getLog(), "AllowedCount", "Compare with exact failing pixel count allowed", reference, result, threshold, m_maxPositionDeviation, m_acceptOutOfBoundsAsAnyValue, expectedCount, tcu::COMPARE_LOG_ON_ERROR);
+			compareTime = deGetMicroseconds()-startTime;
+		}
+
+		if (expectedCount > 0)
+			tooStrictOk = tcu::intThresholdPositionDeviationErrorThresholdCompare(m_testCtx.getLog(), "TooStrict", "Compare with one less failing pixel allowed", reference, result, threshold, m_maxPositionDeviation, m_acceptOutOfBoundsAsAnyValue, expectedCount-1, tcu::COMPARE_LOG_ON_ERROR);
+
+		m_testCtx.getLog() << TestLog::Integer("CompareTime", "Comparison time", "us", QP_KEY_TAG_TIME, compareTime);
+
+		{
+			const bool isOk = allowedOk && !tooStrictOk;
+			m_testCtx.setTestResult(isOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+									isOk ? "Pass"				: "Failing pixel count doesn't match exhaustive search");
+		}
+
+		return STOP;
+	}
+
+private:
+	const tcu::TextureFormat	m_format;
+	const tcu::IVec3			m_size;
+	const tcu::IVec3			m_maxPositionDeviation;
+	const bool					m_acceptOutOfBoundsAsAnyValue;
+	const float					m_noiseProbability;
+	const deUint32				m_seed;
+};
+
 class FuzzyComparisonMetricTests : public tcu::TestCaseGroup
 {
 public:
@@ -217,6 +343,33 @@ public:
 	}
 };
 
+class PositionDeviationCompareTests : public tcu::TestCaseGroup
+{
+public:
+	PositionDeviationCompareTests (tcu::TestContext& testCtx)
+		: tcu::TestCaseGroup(testCtx, "position_deviation", "Position deviation ignoring comparison tests")
+	{
+	}
+
+	void init (void)
+	{
+		const tcu::TextureFormat	rgba8	(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8);
+		const tcu::TextureFormat	rgba32i	(tcu::TextureFormat::RGBA, tcu::TextureFormat::SIGNED_INT32);
+
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_no_deviation",		rgba8,		tcu::IVec3(64, 48, 1),		tcu::IVec3(0, 0, 0),	false,	0.05f,	1));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_1x1",				rgba8,		tcu::IVec3(64, 48, 1),		tcu::IVec3(1, 1, 0),	false,	0.05f,	2));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_1x1_accept_oob",	rgba8,		tcu::IVec3(64, 48, 1),		tcu::IVec3(1, 1, 0),	true,	0.05f,	3));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_2x1",				rgba8,		tcu::IVec3(61, 37, 1),		tcu::IVec3(2, 1, 0),	false,	0.05f,	4));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_3d",				rgba8,		tcu::IVec3(23, 19, 7),		tcu::IVec3(1, 1, 1),	true,	0.05f,	5));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_noisy_4x4",			rgba8,		tcu::IVec3(64, 48, 1),		tcu::IVec3(4, 4, 0),	false,	0.9f,	6));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_noisy_3d",			rgba8,		tcu::IVec3(23, 19, 7),		tcu::IVec3(2, 2, 2),	true,	0.9f,	7));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba32i_1x1",				rgba32i,	tcu::IVec3(64, 48, 1),		tcu::IVec3(1, 1, 0),	false,	0.05f,	8));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba32i_noisy_4x4",		rgba32i,	tcu::IVec3(64, 48, 1),		tcu::IVec3(4, 4, 0),	false,	0.9f,	9));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_large",				rgba8,		tcu::IVec3(512, 512, 1),	tcu::IVec3(2, 2, 0),	false,	0.05f,	10));
+		addChild(new PositionDeviationCompareCase(m_testCtx, "rgba8_large_noisy",		rgba8,		tcu::IVec3(512, 512, 1),	tcu::IVec3(3, 3, 0),	false,	0.9f,	11));
+	}
+};
+
 ImageCompareTests::ImageCompareTests (tcu::TestContext& testCtx)
 	: tcu::TestCaseGroup(testCtx, "image_compare", "Image comparison tests")
 {
@@ -230,6 +383,7 @@ void ImageCompareTests::init (void)
 {
 	addChild(new FuzzyComparisonMetricTests	(m_testCtx));
 	addChild(new BilinearCompareTests		(m_testCtx));
+	addChild(new PositionDeviationCompareTests	(m_testCtx));
 }
 
 } // dit
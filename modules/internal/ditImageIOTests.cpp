@@ -24,6 +24,7 @@
 #include "ditImageIOTests.hpp"
 #include "tcuResource.hpp"
 #include "tcuImageIO.hpp"
+#include "tcuResourceCache.hpp"
 #include "tcuTexture.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuFormatUtil.hpp"
@@ -97,6 +98,206 @@ public:
 	}
 };
 
+static deUint32 hashImage (const tcu::TextureLevel& texture)
+{
+	return deMemoryHash(texture.getAccess().getDataPtr(), texture.getAccess().getSlicePitch()*texture.getDepth());
+}
+
+static size_t getImageSize (const tcu::TextureLevel& texture)
+{
+	return (size_t)(texture.getAccess().getSlicePitch()*texture.getDepth());
+}
+
+static bool checkStatistics (TestLog& log, const tcu::ImageCacheStatistics& stats, const tcu::ImageCacheStatistics& minStats, const tcu::ImageCacheStatistics& maxStats)
+{
+	const struct
+	{
+		const char*	name;
+		int			value;
+		int			minValue;
+		int			maxValue;
+	} counts[] =
+	{
+		{ "hits",		stats.numHits,			minStats.numHits,		maxStats.numHits		},
+		{ "misses",		stats.numMisses,		minStats.numMisses,		maxStats.numMisses		},
+		{ "prefetches",	stats.numPrefetches,	minStats.numPrefetches,	maxStats.numPrefetches	},
+		{ "evictions",	stats.numEvictions,		minStats.numEvictions,	maxStats.numEvictions	},
+	};
+	bool allOk = true;
+
+	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(counts); ndx++)
+	{
+		log << TestLog::Message << counts[ndx].value << " " << counts[ndx].name << TestLog::EndMessage;
+
+		if (counts[ndx].value < counts[ndx].minValue || counts[ndx].value > counts[ndx].maxValue)
+		{
+			log << TestLog::Message << "ERROR: Expected " << counts[ndx].minValue << ".." << counts[ndx].maxValue << " " << counts[ndx].name << TestLog::EndMessage;
+			allOk = false;
+		}
+	}
+
+	return allOk;
+}
+
+class ImageCacheCase : public tcu::TestCase
+{
+public:
+	ImageCacheCase (tcu::TestContext& testCtx, const char* name, const char* description, size_t maxCacheSize, bool prefetch)
+		: TestCase			(testCtx, name, description)
+		, m_maxCacheSize	(maxCacheSize)
+		, m_prefetch		(prefetch)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		static const struct
+		{
+			const char*		filename;
+			deUint32		hash;
+		} s_images[] =
+		{
+			{ "internal/data/imageio/rgb24_256x256.png",	0x6efad777	},
+			{ "internal/data/imageio/rgb24_209x181.png",	0xfd6ea668	},
+			{ "internal/data/imageio/rgba32_256x256.png",	0xcf4883da	},
+			{ "internal/data/imageio/rgba32_207x219.png",	0x404ba06b	},
+		};
+
+		const int					numImages		= DE_LENGTH_OF_ARRAY(s_images);
+		tcu::ResourceCache&			cache			= tcu::ResourceCache::getInstance();
+		const size_t				origCacheSize	= cache.getMaxImageCacheSize();
+		std::vector<std::string>	filenames;
+		size_t						totalSize		= 0;
+		bool						allOk			= true;
+		tcu::ImageCacheStatistics	stats;
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_images); ndx++)
+			filenames.push_back(s_images[ndx].filename);
+
+		m_testCtx.getLog() << TestLog::Message << "Max image cache size: " << m_maxCacheSize << " bytes" << TestLog::EndMessage;
+
+		cache.clear();
+		cache.setMaxImageCacheSize(m_maxCacheSize);
+
+		try
+		{
+			// Load every image twice: first load populates cache, second is served from it.
+			for (int iter = 0; iter < 2; iter++)
+			{
+				if (m_prefetch)
+					cache.prefetchImages(m_testCtx.getArchive(), filenames);
+
+				for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_images); ndx++)
+				{
+					tcu::TextureLevel	texture;
+					cache.loadImage(texture, m_testCtx.getArchive(), s_images[ndx].filename);
+
+					const deUint32		hash		= hashImage(texture);
+
+					if (hash != s_images[ndx].hash)
+					{
+						m_testCtx.getLog() << TestLog::Message << "ERROR: " << s_images[ndx].filename << ": expected hash " << tcu::toHex(s_images[ndx].hash) << ", got " << tcu::toHex(hash) << TestLog::EndMessage;
+						allOk = false;
+					}
+
+					if (iter == 0)
+						totalSize += getImageSize(texture);
+				}
+			}
+
+			stats = cache.getImageCacheStatistics();
+		}
+		catch (...)
+		{
+			cache.clear();
+			cache.setMaxImageCacheSize(origCacheSize);
+			throw;
+		}
+
+		cache.clear();
+		cache.setMaxImageCacheSize(origCacheSize);
+
+		if (!allOk)
+		{
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Hash check failed");
+			return STOP;
+		}
+
+		{
+			tcu::ImageCacheStatistics minStats;
+			tcu::ImageCacheStatistics maxStats;
+
+			if (m_maxCacheSize == 0)
+			{
+				// Every load decodes
+				minStats.numMisses	= maxStats.numMisses	= 2*numImages;
+			}
+			else if (totalSize <= m_maxCacheSize && !m_prefetch)
+			{
+				// Second load of each image is a hit
+				minStats.numHits	= maxStats.numHits		= numImages;
+				minStats.numMisses	= maxStats.numMisses	= numImages;
+			}
+			else if (totalSize <= m_maxCacheSize)
+			{
+				// Images are prefetched once and every load is a hit
+				minStats.numHits		= maxStats.numHits			= 2*numImages;
+				minStats.numPrefetches	= maxStats.numPrefetches	= numImages;
+			}
+			else if (!m_prefetch)
+			{
+				// Cache holds only the most recently loaded image, so every load misses and evicts previous one
+				minStats.numMisses		= maxStats.numMisses		= 2*numImages;
+				minStats.numEvictions	= maxStats.numEvictions		= 2*numImages - 1;
+			}
+			else
+			{
+				// Prefetch thread may evict images before they are loaded. All images are prefetched
+				// on first iteration and evicted by later ones, except the last one.
+				minStats.numPrefetches	= numImages;
+				maxStats.numPrefetches	= 2*numImages;
+				maxStats.numHits		= 2*numImages;
+				maxStats.numMisses		= 2*numImages;
+				minStats.numEvictions	= numImages - 1;
+				maxStats.numEvictions	= 4*numImages;
+			}
+
+			if (!checkStatistics(m_testCtx.getLog(), stats, minStats, maxStats) || stats.numHits + stats.numMisses != 2*numImages)
+			{
+				m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Unexpected cache statistics");
+				return STOP;
+			}
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	const size_t	m_maxCacheSize;
+	const bool		m_prefetch;
+};
+
+class ImageCacheTests : public tcu::TestCaseGroup
+{
+public:
+	ImageCacheTests (tcu::TestContext& testCtx)
+		: TestCaseGroup(testCtx, "cache", "Decoded image cache tests")
+	{
+	}
+
+	void init (void)
+	{
+		const size_t defaultSize = tcu::ResourceCache::DEFAULT_MAX_IMAGE_CACHE_SIZE;
+
+		addChild(new ImageCacheCase(m_testCtx, "disabled",			"Caching disabled",							0,				false));
+		addChild(new ImageCacheCase(m_testCtx, "load",				"Load through cache",						defaultSize,	false));
+		addChild(new ImageCacheCase(m_testCtx, "evict",				"Load through cache that fits one image",	256*256*4,		false));
+		addChild(new ImageCacheCase(m_testCtx, "prefetch",			"Prefetch and load through cache",			defaultSize,	true));
+		addChild(new ImageCacheCase(m_testCtx, "prefetch_evict",	"Prefetch through cache that fits one image",	256*256*4,	true));
+	}
+};
+
 ImageIOTests::ImageIOTests(tcu::TestContext& testCtx)
 	: TestCaseGroup(testCtx, "image_io", "Image read and write tests")
 {
@@ -109,6 +310,7 @@ ImageIOTests::~ImageIOTests (void)
 void ImageIOTests::init (void)
 {
 	addChild(new ImageReadTests(m_testCtx));
+	addChild(new ImageCacheTests(m_testCtx));
 }
 
 } // dit
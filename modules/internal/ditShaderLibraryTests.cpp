@@ -0,0 +1,192 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Test Module
+ * ---------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Shader library parser tests.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditShaderLibraryTests.hpp"
+
+#include "gluShaderLibrary.hpp"
+#include "tcuTestLog.hpp"
+
+#include "deUniquePtr.hpp"
+
+#include <vector>
+#include <string>
+
+namespace dit
+{
+
+using std::string;
+using std::vector;
+using tcu::TestLog;
+
+namespace
+{
+
+static const char* const	s_treeFileName	= "internal/data/shaderlibrary/tree.test";
+
+class DummyCase : public tcu::TestCase
+{
+public:
+	DummyCase (tcu::TestContext& testCtx, const string& name, const string& description)
+		: tcu::TestCase(testCtx, name.c_str(), description.c_str())
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
+class DummyCaseFactory : public glu::sl::ShaderCaseFactory
+{
+public:
+	DummyCaseFactory (tcu::TestContext& testCtx)
+		: m_testCtx(testCtx)
+	{
+	}
+
+	tcu::TestCaseGroup* createGroup (const string& name, const string& description, const vector<tcu::TestNode*>& children)
+	{
+		return new tcu::TestCaseGroup(m_testCtx, name.c_str(), description.c_str(), children);
+	}
+
+	tcu::TestCase* createCase (const string& name, const string& description, const glu::sl::ShaderCaseSpecification&)
+	{
+		return new DummyCase(m_testCtx, name, description);
+	}
+
+private:
+	tcu::TestContext&	m_testCtx;
+};
+
+class TreeSerializationCase : public tcu::TestCase
+{
+public:
+	TreeSerializationCase (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "serialization", "Parsed tree serialization round-trip")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const vector<glu::sl::ShaderNodeSp>	tree		= glu::sl::loadTree(m_testCtx.getArchive(), s_treeFileName, DE_NULL);
+		vector<deUint8>						serialized;
+		vector<deUint8>						reserialized;
+		bool								truncatedOk	= true;
+
+		glu::sl::serializeTree(serialized, tree);
+		glu::sl::serializeTree(reserialized, glu::sl::deserializeTree(serialized.size(), &serialized[0]));
+
+		m_testCtx.getLog() << TestLog::Message << "Serialized " << s_treeFileName << " to " << serialized.size() << " bytes" << TestLog::EndMessage;
+
+		// Every truncated stream must be rejected
+		for (size_t size = 0; size < serialized.size(); size += 7)
+		{
+			try
+			{
+				glu::sl::deserializeTree(size, &serialized[0]);
+				truncatedOk = false;
+			}
+			catch (const tcu::InternalError&)
+			{
+				// Expected
+			}
+		}
+
+		if (tree.size() != 4 || tree[1]->type != glu::sl::ShaderNode::TYPE_GROUP || tree[1]->name != "basic")
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Unexpected tree structure");
+		else if (serialized != reserialized)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Serialized trees don't match");
+		else if (!truncatedOk)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Truncated data was accepted");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+
+		return STOP;
+	}
+};
+
+class LazyInstantiationCase : public tcu::TestCase
+{
+public:
+	LazyInstantiationCase (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "lazy_instantiation", "Lazily created hierarchy matches eagerly created hierarchy")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		DummyCaseFactory								eagerFactory	(m_testCtx);
+		const de::SharedPtr<glu::sl::ShaderCaseFactory>	lazyFactory		(new DummyCaseFactory(m_testCtx));
+		tcu::TestCaseGroup								lazyRoot		(m_testCtx, "root", "", glu::sl::loadFile(m_testCtx, s_treeFileName, lazyFactory));
+		tcu::TestCaseGroup								eagerRoot		(m_testCtx, "root", "", glu::sl::parseFile(m_testCtx.getArchive(), s_treeFileName, &eagerFactory));
+		vector<string>									eagerPaths;
+		vector<string>									lazyPaths;
+
+		listPaths(eagerRoot, "", eagerPaths);
+		listPaths(lazyRoot, "", lazyPaths);
+
+		for (size_t ndx = 0; ndx < lazyPaths.size(); ndx++)
+			m_testCtx.getLog() << TestLog::Message << lazyPaths[ndx] << TestLog::EndMessage;
+
+		if (eagerPaths == lazyPaths && !lazyPaths.empty())
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Hierarchies differ");
+
+		return STOP;
+	}
+
+private:
+	// \note Calls init() on all groups below root, which is a no-op for eagerly created groups.
+	static void listPaths (tcu::TestNode& node, const string& prefix, vector<string>& dst)
+	{
+		const string			path		= prefix + node.getName();
+		vector<tcu::TestNode*>	children;
+
+		dst.push_back(path);
+
+		if (node.getNodeType() == tcu::NODETYPE_GROUP && !prefix.empty())
+			node.init();
+
+		node.getChildren(children);
+
+		for (size_t ndx = 0; ndx < children.size(); ndx++)
+			listPaths(*children[ndx], path + ".", dst);
+	}
+};
+
+} // anonymous
+
+tcu::TestCaseGroup* createShaderLibraryTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup>	shaderLibraryTests	(new tcu::TestCaseGroup(testCtx, "shader_library", "Shader library parser tests"));
+
+	shaderLibraryTests->addChild(new TreeSerializationCase	(testCtx));
+	shaderLibraryTests->addChild(new LazyInstantiationCase	(testCtx));
+
+	return shaderLibraryTests.release();
+}
+
+} // dit
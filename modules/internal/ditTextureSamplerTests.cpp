@@ -0,0 +1,201 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Test Module
+ * ---------------------------------
+ *
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Texture sampler tests.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditTextureSamplerTests.hpp"
+
+#include "tcuTexture.hpp"
+#include "tcuTextureUtil.hpp"
+#include "tcuTestLog.hpp"
+
+#include "deUniquePtr.hpp"
+#include "deRandom.hpp"
+#include "deMemory.h"
+#include "deString.h"
+
+#include <vector>
+#include <sstream>
+
+namespace dit
+{
+
+using std::vector;
+using tcu::TestLog;
+using tcu::TextureFormat;
+using tcu::Sampler;
+using tcu::Vec2;
+using tcu::Vec4;
+
+namespace
+{
+
+static std::string getSamplerDesc (const Sampler& sampler)
+{
+	std::ostringstream str;
+
+	str << "wrap = (" << sampler.wrapS << ", " << sampler.wrapT << ")"
+		<< ", filter = (" << sampler.minFilter << ", " << sampler.magFilter << ")"
+		<< ", normalized = " << (sampler.normalizedCoords ? "true" : "false");
+
+	return str.str();
+}
+
+class Texture2DSamplerCase : public tcu::TestCase
+{
+public:
+	Texture2DSamplerCase (tcu::TestContext& testCtx, const char* name, const TextureFormat& format, bool expectSpecialized)
+		: tcu::TestCase			(testCtx, name, "Compare Texture2DSampler against Texture2DView::sample()")
+		, m_format				(format)
+		, m_expectSpecialized	(expectSpecialized)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		static const Sampler::WrapMode wrapModes[] =
+		{
+			Sampler::CLAMP_TO_EDGE,
+			Sampler::CLAMP_TO_BORDER,
+			Sampler::REPEAT_GL,
+			Sampler::MIRRORED_REPEAT_GL,
+			Sampler::MIRRORED_ONCE,
+		};
+		static const Sampler::FilterMode minFilters[] =
+		{
+			Sampler::NEAREST,
+			Sampler::LINEAR,
+			Sampler::NEAREST_MIPMAP_NEAREST,
+			Sampler::LINEAR_MIPMAP_NEAREST,
+			Sampler::NEAREST_MIPMAP_LINEAR,
+			Sampler::LINEAR_MIPMAP_LINEAR,
+		};
+		static const Sampler::FilterMode magFilters[] =
+		{
+			Sampler::NEAREST,
+			Sampler::LINEAR,
+		};
+
+		tcu::Texture2D				texture		(m_format, 37, 19);
+		de::Random					rnd			(deStringHash(getName()));
+		int							numFailed	= 0;
+		int							numChecked	= 0;
+
+		for (int levelNdx = 0; levelNdx < texture.getNumLevels(); levelNdx++)
+		{
+			texture.allocLevel(levelNdx);
+
+			const tcu::PixelBufferAccess&	level		= texture.getLevel(levelNdx);
+			const int						dataSize	= level.getWidth()*level.getHeight()*level.getFormat().getPixelSize();
+
+			// \note Random bits could produce NaNs in float formats
+			if (m_format.type == TextureFormat::HALF_FLOAT)
+				tcu::fillWithComponentGradients(level, Vec4(-1.0f), Vec4(1.0f));
+			else
+			{
+				for (int ndx = 0; ndx < dataSize; ndx++)
+					((deUint8*)level.getDataPtr())[ndx] = rnd.getUint8();
+			}
+		}
+
+		for (int wrapSNdx = 0; wrapSNdx < DE_LENGTH_OF_ARRAY(wrapModes); wrapSNdx++)
+		for (int wrapTNdx = 0; wrapTNdx < DE_LENGTH_OF_ARRAY(wrapModes); wrapTNdx++)
+		for (int minNdx = 0; minNdx < DE_LENGTH_OF_ARRAY(minFilters); minNdx++)
+		for (int magNdx = 0; magNdx < DE_LENGTH_OF_ARRAY(magFilters); magNdx++)
+		for (int normalized = 0; normalized < 2; normalized++)
+		{
+			Sampler						sampler		(wrapModes[wrapSNdx], wrapModes[wrapTNdx], Sampler::CLAMP_TO_EDGE, minFilters[minNdx], magFilters[magNdx]);
+			const tcu::Texture2DView	view		= texture;
+
+			sampler.normalizedCoords = normalized != 0;
+
+			const tcu::Texture2DSampler	fastSampler	(view, sampler);
+			const bool					isBasicWrap	= (sampler.wrapS == Sampler::CLAMP_TO_EDGE || sampler.wrapS == Sampler::REPEAT_GL || sampler.wrapS == Sampler::MIRRORED_REPEAT_GL) &&
+													  (sampler.wrapT == Sampler::CLAMP_TO_EDGE || sampler.wrapT == Sampler::REPEAT_GL || sampler.wrapT == Sampler::MIRRORED_REPEAT_GL);
+
+			if (fastSampler.isSpecialized() != (m_expectSpecialized && isBasicWrap))
+			{
+				m_testCtx.getLog() << TestLog::Message << "ERROR: Unexpected specialization state for " << getSamplerDesc(sampler) << TestLog::EndMessage;
+				numFailed += 1;
+			}
+
+			for (int packetNdx = 0; packetNdx < 16; packetNdx++)
+			{
+				const float		coordScale	= sampler.normalizedCoords ? 1.0f : 40.0f;
+				Vec2			coords[4];
+				float			lods[4];
+				Vec4			result[4];
+
+				for (int fragNdx = 0; fragNdx < 4; fragNdx++)
+				{
+					coords[fragNdx]	= Vec2(rnd.getFloat(-2.5f, 2.5f), rnd.getFloat(-2.5f, 2.5f)) * coordScale;
+					lods[fragNdx]	= rnd.getFloat(-1.0f, 7.0f);
+				}
+
+				fastSampler.sample4(result, coords, lods);
+
+				for (int fragNdx = 0; fragNdx < 4; fragNdx++)
+				{
+					const Vec4 reference = view.sample(sampler, coords[fragNdx].x(), coords[fragNdx].y(), lods[fragNdx]);
+
+					numChecked += 1;
+
+					if (deMemCmp(&result[fragNdx], &reference, sizeof(Vec4)) != 0)
+					{
+						if (numFailed < 10)
+							m_testCtx.getLog() << TestLog::Message << "ERROR: " << getSamplerDesc(sampler) << ", coord = " << coords[fragNdx] << ", lod = " << lods[fragNdx]
+																   << ": got " << result[fragNdx] << ", expected " << reference << TestLog::EndMessage;
+						numFailed += 1;
+					}
+				}
+			}
+		}
+
+		m_testCtx.getLog() << TestLog::Message << numChecked << " samples checked, " << numFailed << " failures" << TestLog::EndMessage;
+
+		if (numFailed == 0)
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "All checks passed");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Result doesn't match generic sampling");
+
+		return STOP;
+	}
+
+private:
+	const TextureFormat		m_format;
+	const bool				m_expectSpecialized;
+};
+
+} // anonymous
+
+tcu::TestCaseGroup* createTextureSamplerTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup>	samplerTests	(new tcu::TestCaseGroup(testCtx, "texture_sampler", "Texture sampler tests"));
+
+	samplerTests->addChild(new Texture2DSamplerCase(testCtx, "texture_2d_rgba8",	TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8),	true));
+	samplerTests->addChild(new Texture2DSamplerCase(testCtx, "texture_2d_rgb8",		TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8),	true));
+	samplerTests->addChild(new Texture2DSamplerCase(testCtx, "texture_2d_srgb8",	TextureFormat(TextureFormat::sRGBA, TextureFormat::UNORM_INT8),	false));
+	samplerTests->addChild(new Texture2DSamplerCase(testCtx, "texture_2d_rgba16f",	TextureFormat(TextureFormat::RGBA, TextureFormat::HALF_FLOAT),	false));
+
+	return samplerTests.release();
+}
+
+} // dit
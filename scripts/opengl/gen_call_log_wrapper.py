@@ -406,13 +406,26 @@ def commandLogWrapperMemberDef (command):
 	src += "\tif (m_enableLog)\n"
 	src += "\t\tm_log << TestLog::Message << %s;\n" % " << ".join(callPrintItems)
 
+	# Record arguments to binary call trace
+	src += "\tCallTraceRecord* const traceRecord = beginCallTrace(%s);\n" % getCallTraceFunctionId(command)
+	if len(command.params) > 0:
+		src += "\tif (traceRecord)\n"
+		if len(command.params) != 1:
+			src += "\t{\n"
+		for paramNdx, param in enumerate(command.params):
+			src += "\t\ttraceRecord->args[%d] = encodeCallTraceArg(%s);\n" % (paramNdx, param.name)
+		if len(command.params) != 1:
+			src += "\t}\n"
+
 	callStr = "m_gl.%s(%s)" % (getFunctionMemberName(command.name), ", ".join([p.name for p in command.params]))
 
 	isVoid	= command.type == 'void'
 	if isVoid:
 		src += "\t%s;\n" % callStr
+		src += "\tendCallTrace(traceRecord);\n"
 	else:
 		src += "\t%s returnValue = %s;\n" % (glwPrefix(command.type), callStr)
+		src += "\tendCallTrace(traceRecord, encodeCallTraceArg(returnValue));\n"
 
 	if logSpec and len(logSpec.argOutPrints) > 0:
 		# Print values returned in pointers
@@ -449,9 +462,73 @@ def commandLogWrapperMemberDef (command):
 	src += "}"
 	return src
 
+# Must match MAX_CALL_TRACE_ARGS in gluCallTrace.hpp
+MAX_CALL_TRACE_ARGS = 16
+
+def getCallTraceFunctionId (command):
+	return "CALLTRACEFUNC_%s" % command.name
+
+def isPointerType (type):
+	return "*" in type
+
+def getCallTracePrint (type, varName, customPrint):
+	# Call trace captures only argument values, so pointed-to data is no
+	# longer valid when the trace is decoded. Print pointers as addresses.
+	if isPointerType(type):
+		return voidPointer(varName)
+	elif customPrint:
+		return customPrint(varName)
+	else:
+		return getVarDefaultPrint(type, varName)
+
+def commandCallTraceFunctionId (command):
+	if len(command.params) > MAX_CALL_TRACE_ARGS:
+		raise Exception("Too many arguments for call trace in command %s" % command.name)
+	return "%s," % getCallTraceFunctionId(command)
+
+def commandCallTraceFunctionName (command):
+	return "\"%s\"," % command.name
+
+def commandCallTraceDecoderCase (command):
+	try:
+		logSpec = CALL_LOG_SPECS[command.name]
+	except KeyError:
+		logSpec = None
+
+	src = ""
+	src += "case %s:\n{\n" % getCallTraceFunctionId(command)
+
+	for paramNdx, param in enumerate(command.params):
+		src += "\t%s = decodeCallTraceArg<%s>(traceRecord.args[%d]);\n" % (glwPrefix(param.declaration), glwPrefix(param.type), paramNdx)
+
+	callPrintItems = ["\"%s(\"" % command.name]
+	for paramNdx, param in enumerate(command.params):
+		if paramNdx > 0:
+			callPrintItems.append("\", \"")
+
+		customPrint = logSpec.argInPrints.get(paramNdx) if logSpec else None
+		callPrintItems.append(getCallTracePrint(param.type, param.name, customPrint))
+
+	callPrintItems.append("\");\"")
+
+	src += "\tcallStr << %s;\n" % " << ".join(callPrintItems)
+
+	if command.type != 'void':
+		returnPrint = getCallTracePrint(command.type, "returnValue", logSpec.returnPrint if logSpec else None)
+
+		src += "\t%s returnValue = decodeCallTraceArg<%s>(traceRecord.returnValue);\n" % (glwPrefix(command.type), glwPrefix(command.type))
+		src += "\treturnStr << \"// \" << %s << \" returned\";\n" % returnPrint
+
+	src += "\tbreak;\n"
+	src += "}"
+	return src
+
 def genCallLogWrapper (iface):
 	genCommandList(iface, commandLogWrapperMemberDecl, OPENGL_DIR, "gluCallLogWrapperApi.inl", True)
 	genCommandList(iface, commandLogWrapperMemberDef, OPENGL_DIR, "gluCallLogWrapper.inl", False)
+	genCommandList(iface, commandCallTraceFunctionId, OPENGL_DIR, "gluCallTraceFunctions.inl", False)
+	genCommandList(iface, commandCallTraceFunctionName, OPENGL_DIR, "gluCallTraceFunctionNames.inl", False)
+	genCommandList(iface, commandCallTraceDecoderCase, OPENGL_DIR, "gluCallTraceDecoder.inl", False)
 
 if __name__ == "__main__":
 	genCallLogWrapper(getHybridInterface())